@@ -2,13 +2,45 @@
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aColor;
 layout (location = 2) in vec2 aTexCoord;
+layout (location = 3) in mat4 aModel; // per instance, from the transform hierarchy
 
 out vec3 ourColor;
 out vec2 TexCoord;
 
+uniform mat4 transform;
+
+#ifdef SKINNING
+// built with "#define SKINNING": up to 4 joints per vertex, skinning
+// matrices from a BonePaletteBuffer, 3 texels (rows 0-2) per joint
+layout (location = 7) in vec4 aJoints;  // unsigned bytes, not normalized
+layout (location = 8) in vec4 aWeights; // normalized unsigned bytes, sum to 1
+
+uniform samplerBuffer bonePalette;
+uniform int paletteBase;   // first joint of instance 0
+uniform int paletteStride; // joints per instance
+
+vec4 skin(vec4 position)
+{
+    int base = paletteBase + gl_InstanceID * paletteStride;
+    vec4 rows[3] = vec4[3](vec4(0.0), vec4(0.0), vec4(0.0));
+    for (int i = 0; i < 4; i++)
+    {
+        int texel = (base + int(aJoints[i])) * 3;
+        rows[0] += texelFetch(bonePalette, texel) * aWeights[i];
+        rows[1] += texelFetch(bonePalette, texel + 1) * aWeights[i];
+        rows[2] += texelFetch(bonePalette, texel + 2) * aWeights[i];
+    }
+    return vec4(dot(rows[0], position), dot(rows[1], position), dot(rows[2], position), 1.0);
+}
+#endif
+
 void main()
 {
-    gl_Position = vec4(aPos, 1.0);
+    vec4 position = vec4(aPos, 1.0);
+#ifdef SKINNING
+    position = skin(position);
+#endif
+    gl_Position = transform * aModel * position;
     ourColor = aColor;
     TexCoord = aTexCoord;
 }
\ No newline at end of file
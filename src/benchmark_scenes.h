@@ -0,0 +1,363 @@
+#ifndef BENCHMARK_SCENES_H
+#define BENCHMARK_SCENES_H
+
+#include <glad/glad.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+#include "gl_verify.h"
+#include "shader.h"
+#include "thread_pool.h"
+#include "geometry_arena.h"
+#include "block_compression.h"
+#include "texture_upload.h"
+#include "texture_streamer.h"
+#include "texture_cache.h"
+#include "progressive_streamer.h"
+#include "math3d.h"
+#include "transform_hierarchy.h"
+#include "instance_buffer.h"
+#include "bone_palette_buffer.h"
+#include "gpu_profiler.h"
+#include "cpu_profiler.h"
+#include "demo_scene.h"
+
+// Scenes for runHeadlessBenchmark (headless_benchmark.h). The stress scenes
+// draw the app's textured quad with the app's shader, so they load
+// 3.3.shader.vs/.fs from the working directory like DemoScene.
+
+// the app's scene, measured once its textures have streamed in
+class DemoBenchmarkScene
+{
+public:
+    // loadProc finds glTexStorage2D, pass the loader GLAD was initialised with
+    DemoBenchmarkScene(int width, int height, GLADloadproc loadProc)
+        : m_width(width)
+        , m_height(height)
+        , m_scene(m_workers, BlockCompressionSupport::query(), TextureStorageSupport::query(loadProc))
+    {
+    }
+
+    // ------------------------------------------------------------------------
+    bool ready() const { return !m_scene.loading(); }
+    void frame(GpuProfiler& gpu, float time)
+    {
+        m_scene.updateTextures(gpu, m_width, m_height);
+        m_scene.draw(gpu, time);
+    }
+
+private:
+    int m_width;
+    int m_height;
+    ThreadPool m_workers;
+    DemoScene m_scene;
+};
+
+// The app's two images through a TextureCache of its own, decoded on the
+// workers and streamed in through PBOs as at startup; ready() once all of
+// them are uploaded
+class TextureLoadScene
+{
+public:
+    // loadProc finds glTexStorage2D, pass the loader GLAD was initialised with
+    explicit TextureLoadScene(GLADloadproc loadProc)
+        : m_compression(BlockCompressionSupport::query())
+        , m_streamer(m_workers)
+        , m_progressive(m_workers, m_compression)
+        , m_textures(m_streamer, m_workers, m_compression, &m_progressive)
+    {
+        m_streamer.setTextureStorage(TextureStorageSupport::query(loadProc));
+        m_handles[0] = m_textures.acquire("container.jpg");
+        m_handles[1] = m_textures.acquire("awesomeface.png", true);
+    }
+    ~TextureLoadScene()
+    {
+        m_textures.release(m_handles[0]);
+        m_textures.release(m_handles[1]);
+    }
+    TextureLoadScene(const TextureLoadScene&) = delete;
+    TextureLoadScene& operator=(const TextureLoadScene&) = delete;
+
+    // ------------------------------------------------------------------------
+    bool ready() const { return m_textures.idle() && m_streamer.idle() && m_progressive.idle(); }
+    void frame(GpuProfiler& gpu, float time)
+    {
+        (void)time;
+        PROFILE_ZONE("texture uploads");
+        GpuScope scope(gpu, "texture uploads");
+        m_textures.update();
+        m_streamer.update();
+        for (TextureHandle handle : m_handles)
+            m_progressive.setScreenSize(m_textures.texture(handle), 400.0f);
+        m_progressive.update();
+    }
+
+private:
+    ThreadPool m_workers;
+    BlockCompressionSupport m_compression;
+    TextureStreamer m_streamer;
+    ProgressiveTextureStreamer m_progressive;
+    TextureCache m_textures;
+    TextureHandle m_handles[2];
+};
+
+// The quad with two small generated textures, the shared part of the stress
+// scenes. Instances read their model matrix from `instances`.
+class BenchmarkQuad
+{
+public:
+    BenchmarkQuad()
+        : geometry(glState), m_shader("3.3.shader.vs", "3.3.shader.fs")
+    {
+        float vertices[] = {
+            // positions          // colors           // texture coords
+             0.5f,  0.5f, 0.0f,   1.0f, 0.0f, 0.0f,   1.0f, 1.0f,
+             0.5f, -0.5f, 0.0f,   0.0f, 1.0f, 0.0f,   1.0f, 0.0f,
+            -0.5f, -0.5f, 0.0f,   0.0f, 0.0f, 1.0f,   0.0f, 0.0f,
+            -0.5f,  0.5f, 0.0f,   1.0f, 1.0f, 0.0f,   0.0f, 1.0f,
+        };
+        GLuint indices[] = { 0, 1, 3, 1, 2, 3 };
+        VertexLayout layout;
+        layout.stride = 8 * sizeof(float);
+        layout.attributes = {
+            { 0, 3, GL_FLOAT, GL_FALSE, 0 },
+            { 1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float) },
+            { 2, 2, GL_FLOAT, GL_FALSE, 6 * sizeof(float) },
+        };
+        quad = geometry.allocate(geometry.registerLayout(layout), 4, 6);
+        geometry.upload(quad, vertices, indices);
+        instances.attach(glState, geometry.vertexArray(quad));
+
+        // a checkerboard and a gradient, 64x64
+        const int SIZE = 64;
+        std::vector<uint8_t> pixels((size_t)SIZE * SIZE * 4);
+        GL_VERIFY(glGenTextures(2, m_textures));
+        for (int t = 0; t < 2; t++)
+        {
+            for (int y = 0; y < SIZE; y++)
+            {
+                for (int x = 0; x < SIZE; x++)
+                {
+                    uint8_t* texel = &pixels[((size_t)y * SIZE + x) * 4];
+                    uint8_t value = t == 0 ? (((x >> 3) ^ (y >> 3)) & 1 ? 255 : 64) : (uint8_t)(x * 4);
+                    texel[0] = value;
+                    texel[1] = t == 0 ? value : (uint8_t)(y * 4);
+                    texel[2] = value;
+                    texel[3] = 255;
+                }
+            }
+            GL_VERIFY(glBindTexture(GL_TEXTURE_2D, m_textures[t]));
+            GL_VERIFY(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, SIZE, SIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data()));
+            GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
+            GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+        }
+
+        m_shader.use();
+        m_shader.setInt("texture1", 0);
+        m_shader.setInt("texture2", 1);
+        m_shader.setMat4("transform", Mat4::identity());
+        transformLocation = glGetUniformLocation(m_shader.ID, "transform");
+    }
+    ~BenchmarkQuad()
+    {
+        GL_VERIFY(glDeleteTextures(2, m_textures));
+        GL_VERIFY(glDeleteProgram(m_shader.ID));
+    }
+    BenchmarkQuad(const BenchmarkQuad&) = delete;
+    BenchmarkQuad& operator=(const BenchmarkQuad&) = delete;
+
+    // program and textures
+    // ------------------------------------------------------------------------
+    void bind()
+    {
+        m_shader.use();
+        GL_VERIFY(glActiveTexture(GL_TEXTURE0));
+        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, m_textures[0]));
+        GL_VERIFY(glActiveTexture(GL_TEXTURE1));
+        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, m_textures[1]));
+    }
+
+    // cell i of a grid of `count` cells over the viewport, turned by angle
+    // ------------------------------------------------------------------------
+    static Mat4 gridCell(uint32_t i, uint32_t count, float angle)
+    {
+        uint32_t columns = (uint32_t)std::ceil(std::sqrt((float)std::max(count, 1u)));
+        float cell = 2.0f / columns;
+        Vec3 center(-1.0f + cell * (i % columns + 0.5f), -1.0f + cell * (i / columns + 0.5f), 0.0f);
+        return composeTransform(center, quatFromAxisAngle(Vec3(0.0f, 0.0f, 1.0f), angle), Vec3(cell * 0.8f));
+    }
+
+    GLStateCache glState; // the arena's VAO binds
+    GeometryArena geometry;
+    GeometryHandle quad;
+    InstanceBuffer instances;
+    GLint transformLocation;
+
+private:
+    Shader m_shader;
+    GLuint m_textures[2] = { 0, 0 };
+};
+
+// `count` quads drawn one by one with their own transform uniform: the
+// per-draw cost of the driver and of the arena's draw path
+class ManyDrawsScene
+{
+public:
+    explicit ManyDrawsScene(uint32_t count) : m_count(count)
+    {
+        Mat4 identity = Mat4::identity();
+        m_quad.instances.upload(&identity, 0, 1); // non-instanced draws read instance 0
+    }
+
+    // ------------------------------------------------------------------------
+    bool ready() const { return true; }
+    void frame(GpuProfiler& gpu, float time)
+    {
+        PROFILE_ZONE("draws");
+        GpuScope scope(gpu, "draws");
+        m_quad.bind();
+        for (uint32_t i = 0; i < m_count; i++)
+        {
+            Mat4 transform = BenchmarkQuad::gridCell(i, m_count, time + 0.01f * i);
+            GL_VERIFY(glUniformMatrix4fv(m_quad.transformLocation, 1, GL_FALSE, transform.data()));
+            m_quad.geometry.draw(m_quad.quad);
+        }
+    }
+
+private:
+    uint32_t m_count;
+    BenchmarkQuad m_quad;
+};
+
+// `count` quads as nodes of a TransformHierarchy, all turning every frame
+// and drawn as one instanced draw, the app's path for many objects
+class InstancingScene
+{
+public:
+    explicit InstancingScene(uint32_t count)
+    {
+        TransformNode root = m_hierarchy.create();
+        for (uint32_t i = 0; i < count; i++)
+        {
+            Mat4 cell = BenchmarkQuad::gridCell(i, count, 0.0f);
+            TransformNode node = m_hierarchy.create(root);
+            float size = cell.data()[0];
+            m_hierarchy.setLocal(node, Vec3(cell.data()[12], cell.data()[13], 0.0f), Quat(), Vec3(size));
+            m_nodes.push_back(node);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    bool ready() const { return true; }
+    void frame(GpuProfiler& gpu, float time)
+    {
+        {
+            PROFILE_ZONE("scene update");
+            for (size_t i = 0; i < m_nodes.size(); i++)
+                m_hierarchy.setRotation(m_nodes[i], quatFromAxisAngle(Vec3(0.0f, 0.0f, 1.0f), time + 0.01f * i));
+            m_hierarchy.update(&m_workers);
+            m_quad.instances.update(m_hierarchy);
+        }
+        {
+            PROFILE_ZONE("draw instances");
+            GpuScope scope(gpu, "instances");
+            m_quad.bind();
+            m_quad.geometry.drawInstanced(m_quad.quad, (GLsizei)m_quad.instances.count());
+        }
+    }
+
+private:
+    ThreadPool m_workers;
+    BenchmarkQuad m_quad;
+    TransformHierarchy m_hierarchy;
+    std::vector<TransformNode> m_nodes;
+};
+
+// `layers` blended quads over the whole viewport, fill rate bound
+class OverdrawScene
+{
+public:
+    explicit OverdrawScene(uint32_t layers)
+    {
+        std::vector<Mat4> matrices(std::max(layers, 1u), scaling(Vec3(2.0f)));
+        m_quad.instances.upload(matrices.data(), 0, (uint32_t)matrices.size());
+    }
+
+    // ------------------------------------------------------------------------
+    bool ready() const { return true; }
+    void frame(GpuProfiler& gpu, float time)
+    {
+        (void)time;
+        PROFILE_ZONE("draw layers");
+        GpuScope scope(gpu, "layers");
+        m_quad.bind();
+        GL_VERIFY(glEnable(GL_BLEND));
+        GL_VERIFY(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+        m_quad.geometry.drawInstanced(m_quad.quad, (GLsizei)m_quad.instances.count());
+        GL_VERIFY(glDisable(GL_BLEND));
+    }
+
+private:
+    BenchmarkQuad m_quad;
+};
+
+// Both variants of the app's shader compiled, linked and drawn with every
+// frame. Each frame's sources differ by a define so no cache of the driver
+// can hand back an earlier program; drawing makes drivers that compile
+// lazily, llvmpipe among them, finish the job. The skinned variant reads
+// identity joints from unit 2, apart from the quad's sampler2Ds.
+class ShaderCompileScene
+{
+public:
+    ShaderCompileScene()
+    {
+        Mat4 identity = Mat4::identity();
+        m_quad.instances.upload(&identity, 0, 1);
+        // without joint attributes every vertex takes joint 1 at full weight
+        const float rows[2][12] = {
+            { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f },
+            { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f },
+        };
+        m_palette.upload(&rows[0][0], 2);
+    }
+
+    // ------------------------------------------------------------------------
+    bool ready() const { return true; }
+    void frame(GpuProfiler& gpu, float time)
+    {
+        (void)time;
+        PROFILE_ZONE("compile shaders");
+        GpuScope scope(gpu, "compile shaders");
+        char defines[2][96];
+        snprintf(defines[0], sizeof(defines[0]), "#define VARIANT %u\n", m_variant);
+        snprintf(defines[1], sizeof(defines[1]), "#define VARIANT %u\n#define SKINNING\n", m_variant);
+        m_variant++;
+        m_quad.bind();
+        GL_VERIFY(glActiveTexture(GL_TEXTURE2));
+        GL_VERIFY(glBindTexture(GL_TEXTURE_BUFFER, m_palette.texture()));
+        for (const char* variant : defines)
+        {
+            Shader shader("3.3.shader.vs", "3.3.shader.fs", variant);
+            shader.use();
+            shader.setInt("texture1", 0);
+            shader.setInt("texture2", 1);
+            shader.setInt("bonePalette", 2); // no-op in the unskinned variant
+            shader.setInt("paletteBase", 0);
+            shader.setInt("paletteStride", 0);
+            shader.setMat4("transform", Mat4::identity());
+            m_quad.geometry.draw(m_quad.quad);
+            GL_VERIFY(glDeleteProgram(shader.ID));
+        }
+    }
+
+private:
+    BenchmarkQuad m_quad;
+    BonePaletteBuffer m_palette;
+    uint32_t m_variant = 0;
+};
+
+#endif
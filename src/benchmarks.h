@@ -0,0 +1,637 @@
+#ifndef BENCHMARKS_H
+#define BENCHMARKS_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "block_compression.h"
+#include "texture_atlas.h"
+#include "texture_residency.h"
+#include "thread_pool.h"
+#include "texture_upload.h"
+#include "decode_arena.h"
+#include "supercompressed_texture.h"
+#include "image_resampler.h"
+#include "math3d.h"
+#include "transform_hierarchy.h"
+#include "matrix_kernels.h"
+#include "skeletal_animation.h"
+#include "../stb/stb_image.h"
+
+// CPU side micro benchmarks for the asset pipeline. Each one prints a small
+// table to the given stream; they need no GL context unless noted.
+
+class BenchmarkTimer
+{
+public:
+    BenchmarkTimer() : m_start(std::chrono::steady_clock::now()) {}
+
+    double seconds() const
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point m_start;
+};
+
+// 1, 2, 4, ... up to the hardware thread count
+// ----------------------------------------------------------------------------
+inline std::vector<unsigned> benchmarkThreadCounts()
+{
+    unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> counts;
+    for (unsigned n = 1; n < hardware; n *= 2)
+        counts.push_back(n);
+    counts.push_back(hardware);
+    return counts;
+}
+
+// PSNR and encode throughput per format and thread count, on an RGBA8 image
+// ----------------------------------------------------------------------------
+inline void benchmarkBlockCompression(const uint8_t* rgba, int width, int height, std::ostream& out, int repeat = 3)
+{
+    const BlockFormat formats[] = { BlockFormat::BC1, BlockFormat::BC3, BlockFormat::BC4, BlockFormat::BC5, BlockFormat::BC7 };
+    const int channels[] = { 3, 4, 1, 2, 4 };
+    double megapixels = (double)width * height / 1e6;
+
+    out << "block compression " << width << "x" << height << "\n";
+    out << std::left << std::setw(8) << "format" << std::setw(10) << "PSNR dB" << std::setw(10) << "threads" << "MPix/s\n";
+    for (int f = 0; f < 5; f++)
+    {
+        std::vector<uint8_t> blocks = compressImage(rgba, width, height, formats[f]);
+        std::vector<uint8_t> decoded = decompressImage(blocks.data(), width, height, formats[f]);
+        double psnr = computePSNR(rgba, decoded.data(), (size_t)width * height, channels[f]);
+
+        for (unsigned threads : benchmarkThreadCounts())
+        {
+            ThreadPool pool(std::max(1u, threads - 1)); // the calling thread encodes too
+            BenchmarkTimer timer;
+            for (int i = 0; i < repeat; i++)
+                compressImage(rgba, width, height, formats[f], threads > 1 ? &pool : nullptr);
+            double rate = megapixels * repeat / timer.seconds();
+
+            out << std::left << std::setw(8) << blockFormatName(formats[f])
+                << std::setw(10) << std::fixed << std::setprecision(2) << psnr
+                << std::setw(10) << threads << rate << "\n";
+        }
+    }
+}
+
+// Packs imageCount images of 8 to 128 texels a side into pageSize pages,
+// then replaces every other image with one of a new size: pages, mean
+// occupancy and time of both passes. Needs a current GL context.
+// ----------------------------------------------------------------------------
+inline void benchmarkTextureAtlas(std::ostream& out, int imageCount = 500, int pageSize = 1024)
+{
+    uint32_t seed = 1;
+    auto side = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return 8 + (int)((seed >> 8) % 121);
+    };
+    std::vector<uint8_t> pixels(128 * 128 * 4, 200);
+    std::vector<AtlasImage> images;
+    for (int i = 0; i < imageCount; i++)
+        images.push_back(AtlasImage{ "image" + std::to_string(i), pixels.data(), side(), side() });
+
+    TextureAtlas atlas(pageSize);
+    auto report = [&atlas, &out](const char* pass, double seconds) {
+        float occupancy = 0.0f;
+        for (uint32_t page = 0; page < atlas.pageCount(); page++)
+            occupancy += atlas.pageOccupancy(page);
+        out << std::left << std::setw(10) << pass << std::setw(8) << atlas.pageCount() << std::setw(12) << std::fixed
+            << std::setprecision(1) << 100.0f * occupancy / std::max(atlas.pageCount(), 1u) << seconds * 1000.0 << "\n";
+    };
+
+    out << "texture atlas, " << imageCount << " images into " << pageSize << "x" << pageSize << " pages\n";
+    out << std::left << std::setw(10) << "pass" << std::setw(8) << "pages" << std::setw(12) << "occupied %" << "ms\n";
+    BenchmarkTimer buildTimer;
+    atlas.build(images);
+    report("build", buildTimer.seconds());
+    BenchmarkTimer replaceTimer;
+    for (int i = 0; i < imageCount; i += 2)
+        atlas.insert(images[i].name, pixels.data(), side(), side());
+    report("replace", replaceTimer.seconds());
+}
+
+// Walks a window of `window` textures across textureCount RGBA8 textures of
+// size x size under a budget of a third of them all: time per frame, what the
+// manager did, and whether every name stayed the same. Needs a current GL
+// context.
+// ----------------------------------------------------------------------------
+inline void benchmarkTextureResidency(std::ostream& out, int textureCount = 64, int size = 256, int window = 16, int frames = 200)
+{
+    uint64_t textureBytes = (uint64_t)size * size * 4 * 4 / 3;
+    TextureResidencyManager manager(textureBytes * textureCount / 3, size / 4);
+    std::vector<ResidentTextureId> ids;
+    for (int i = 0; i < textureCount; i++)
+    {
+        ids.push_back(manager.add("texture" + std::to_string(i), [size, i](TextureLevels& levels) {
+            CompressedLevel level;
+            level.width = size;
+            level.height = size;
+            level.data.assign((size_t)size * size * 4, (uint8_t)(i * 37));
+            levels.levels.push_back(std::move(level));
+            return true;
+        }));
+    }
+
+    std::vector<GLuint> names(textureCount, 0);
+    bool stable = true;
+    BenchmarkTimer timer;
+    for (int frame = 0; frame < frames; frame++)
+    {
+        manager.beginFrame();
+        for (int i = 0; i < window; i++)
+        {
+            int index = (frame * 4 + i) % textureCount;
+            GLuint name = manager.use(ids[index]);
+            stable = stable && (!names[index] || names[index] == name);
+            names[index] = name;
+        }
+        manager.enforceBudget();
+    }
+    glFinish();
+    double ms = timer.seconds() * 1000.0 / frames;
+
+    const TextureResidencyStats& stats = manager.stats();
+    out << "texture residency, " << textureCount << " textures of " << size << "x" << size << ", " << window
+        << " used per frame\n";
+    out << std::left << std::setw(12) << "ms/frame" << std::setw(12) << "peak MB" << std::setw(11) << "evictions"
+        << std::setw(11) << "mip drops" << std::setw(9) << "reloads" << "names\n";
+    out << std::left << std::setw(12) << std::fixed << std::setprecision(3) << ms << std::setw(12)
+        << std::setprecision(1) << stats.peakResidentBytes / (1024.0 * 1024.0) << std::setw(11) << stats.evictions
+        << std::setw(11) << stats.mipDrops << std::setw(9) << stats.reloads << (stable ? "stable" : "CHANGED") << "\n";
+}
+
+// RGB to RGBA expansion per kernel, then upload throughput per format as the
+// driver sees it: the naive GL_RGB upload it converts itself against our
+// normalized layouts. Needs a current GL context.
+// ----------------------------------------------------------------------------
+inline void benchmarkTextureUpload(int width, int height, const TextureStorageSupport& storage, std::ostream& out, int repeat = 10)
+{
+    size_t pixels = (size_t)width * height;
+    std::vector<uint8_t> source(pixels * 4);
+    for (size_t i = 0; i < source.size(); i++)
+        source[i] = (uint8_t)(i * 7 + (i >> 9));
+    std::vector<uint8_t> converted(pixels * 4);
+
+    out << "rgb to rgba expansion " << width << "x" << height << "\n";
+    out << std::left << std::setw(10) << "kernel" << "MPix/s\n";
+    struct
+    {
+        const char* name;
+        void (*kernel)(const uint8_t*, uint8_t*, size_t);
+        bool supported;
+    } kernels[] = {
+        { "scalar", texel::expandRGBToRGBAScalar, true },
+#ifdef CPU_HAS_SSE2
+        { "ssse3", texel::expandRGBToRGBASSSE3, cpuFeatures().ssse3 },
+        { "avx2", texel::expandRGBToRGBAAVX2, cpuFeatures().avx2 },
+#endif
+    };
+    for (const auto& kernel : kernels)
+    {
+        if (!kernel.supported)
+            continue;
+        BenchmarkTimer timer;
+        for (int i = 0; i < repeat; i++)
+            kernel.kernel(source.data(), converted.data(), pixels);
+        out << std::left << std::setw(10) << kernel.name << std::fixed << std::setprecision(1)
+            << pixels * repeat / timer.seconds() / 1e6 << "\n";
+    }
+
+    out << "texture upload " << width << "x" << height << (storage.texStorage2D ? ", immutable storage" : "") << "\n";
+    out << std::left << std::setw(22) << "format" << std::setw(12) << "ms/upload" << "MPix/s\n";
+    struct
+    {
+        const char* name;
+        int sourceChannels;
+        ColorSpace colorSpace;
+        bool naive; // GL_RGB as is, the driver converts
+    } cases[] = {
+        { "R8", 1, ColorSpace::Linear, false },
+        { "RG8", 2, ColorSpace::Linear, false },
+        { "RGB8 from GL_RGB", 3, ColorSpace::Linear, true },
+        { "RGBA8 from rgb", 3, ColorSpace::Linear, false },
+        { "RGBA8", 4, ColorSpace::Linear, false },
+        { "SRGB8_ALPHA8 from rgb", 3, ColorSpace::sRGB, false },
+    };
+    for (const auto& test : cases)
+    {
+        UploadFormat upload = chooseUploadFormat(test.sourceChannels, test.colorSpace);
+        GLuint texture;
+        GL_VERIFY(glGenTextures(1, &texture));
+        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, texture));
+        if (test.naive)
+        {
+            upload.internalFormat = GL_RGB8;
+            upload.format = GL_RGB;
+            upload.channels = 3;
+            GL_VERIFY(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB8, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr));
+        }
+        else
+        {
+            storage.allocate(upload, width, height, 1);
+        }
+        GL_VERIFY(glFinish());
+
+        BenchmarkTimer timer;
+        for (int i = 0; i < repeat; i++)
+        {
+            const uint8_t* pixelsToUpload = source.data();
+            if (!test.naive && upload.sourceChannels != upload.channels)
+            {
+                convertImageForUpload(upload, source.data(), converted.data(), width, height, false);
+                pixelsToUpload = converted.data();
+            }
+            uploadTextureRows(upload, width, 0, height, pixelsToUpload);
+        }
+        GL_VERIFY(glFinish());
+        double seconds = timer.seconds();
+        GL_VERIFY(glDeleteTextures(1, &texture));
+
+        out << std::left << std::setw(22) << test.name << std::fixed << std::setprecision(3) << std::setw(12)
+            << seconds * 1000.0 / repeat << std::setprecision(1) << pixels * repeat / seconds / 1e6 << "\n";
+    }
+}
+
+// Decodes imageCount images, cycling through the encoded files given, once
+// with stb_image on the C heap and once inside a DecodeArenaScope per image.
+// Heap calls are counted by the allocator hooks in stb_image.cpp. stb_image
+// allocates only a few blocks per image, so the times are close and noisy:
+// the two run alternately for a few rounds, first one then the other, and
+// the best round of each is shown.
+// ----------------------------------------------------------------------------
+inline void benchmarkImageDecode(const std::vector<std::vector<uint8_t>>& files, std::ostream& out, int imageCount = 500,
+    int rounds = 4)
+{
+    if (files.empty())
+        return;
+    DecodeArena& arena = DecodeArena::local();
+
+    double best[2] = { 1e30, 1e30 };
+    double megapixels = 0;
+    DecodeArenaStats stats[2];
+    for (int round = 0; round < rounds * 2; round++)
+    {
+        int useArena = (round + round / 2) & 1; // heap, arena, arena, heap, ...
+        arena.resetStats();
+        megapixels = 0;
+        BenchmarkTimer timer;
+        for (int i = 0; i < imageCount; i++)
+        {
+            const std::vector<uint8_t>& file = files[i % files.size()];
+            if (useArena)
+                arena.enter();
+            int width, height, channels;
+            stbi_uc* pixels = stbi_load_from_memory(file.data(), (int)file.size(), &width, &height, &channels, 0);
+            if (pixels)
+            {
+                megapixels += (double)width * height / 1e6;
+                stbi_image_free(pixels);
+            }
+            if (useArena)
+                arena.leave();
+        }
+        best[useArena] = std::min(best[useArena], timer.seconds());
+        stats[useArena] = arena.stats();
+    }
+
+    out << "image decode, " << imageCount << " images from " << files.size() << " files, best of " << rounds << "\n";
+    out << std::left << std::setw(8) << "alloc" << std::setw(12) << "heap calls" << std::setw(12) << "stb allocs"
+        << std::setw(10) << "ms" << "MPix/s\n";
+    for (int useArena = 0; useArena < 2; useArena++)
+    {
+        out << std::left << std::setw(8) << (useArena ? "arena" : "heap") << std::setw(12) << stats[useArena].heapCalls
+            << std::setw(12) << stats[useArena].allocations + stats[useArena].reallocations << std::setw(10) << std::fixed
+            << std::setprecision(1) << best[useArena] * 1000.0 << megapixels / best[useArena] << "\n";
+    }
+}
+
+// Size of a .sct against the .bct of the same blocks, then transcode
+// throughput and PSNR per target
+// ----------------------------------------------------------------------------
+inline void benchmarkTranscode(const uint8_t* rgba, int width, int height, std::ostream& out, int repeat = 10)
+{
+    bool hasAlpha = false;
+    for (size_t i = 0, count = (size_t)width * height; i < count && !hasAlpha; i++)
+        hasAlpha = rgba[i * 4 + 3] != 255;
+    BlockFormat format = hasAlpha ? BlockFormat::BC3 : BlockFormat::BC1;
+    size_t blockBytes = 0;
+    for (const CompressedLevel& level : bakeCompressedTexture(rgba, width, height, format).levels)
+        blockBytes += level.data.size();
+    std::vector<uint8_t> file = bakeSupercompressedTexture(rgba, width, height);
+    double megapixels = (double)width * height * 4 / 3 / 1e6; // with the mips
+
+    out << "transcode " << width << "x" << height << ", " << blockFormatName(format) << " " << blockBytes
+        << " bytes, .sct " << file.size() << " bytes (" << std::fixed << std::setprecision(2)
+        << (double)blockBytes / file.size() << "x)\n";
+    out << std::left << std::setw(8) << "target" << std::setw(10) << "PSNR dB" << "MPix/s\n";
+    const TranscodeTarget targets[] = { TranscodeTarget::BC1, TranscodeTarget::BC3, TranscodeTarget::BC7, TranscodeTarget::RGBA8 };
+    for (TranscodeTarget target : targets)
+    {
+        TextureLevels levels;
+        BenchmarkTimer timer;
+        for (int i = 0; i < repeat; i++)
+            transcodeSupercompressed(file.data(), file.size(), target, levels);
+        double rate = megapixels * repeat / timer.seconds();
+
+        const CompressedLevel& top = levels.levels[0];
+        std::vector<uint8_t> decoded = levels.compressed ? decompressImage(top.data.data(), width, height, levels.blockFormat) : top.data;
+        double psnr = computePSNR(rgba, decoded.data(), (size_t)width * height, target == TranscodeTarget::BC1 ? 3 : 4);
+        out << std::left << std::setw(8) << transcodeTargetName(target) << std::setw(10) << std::fixed
+            << std::setprecision(2) << psnr << rate << "\n";
+    }
+}
+
+// Half size downscale and full mip chain per filter and thread count, on an
+// RGBA8 sRGB image with alpha
+// ----------------------------------------------------------------------------
+inline void benchmarkResample(const uint8_t* rgba, int width, int height, std::ostream& out, int repeat = 3)
+{
+    const ResampleFilter filters[] = { ResampleFilter::Box, ResampleFilter::Triangle, ResampleFilter::Lanczos3, ResampleFilter::Kaiser };
+    const char* names[] = { "box", "triangle", "lanczos3", "kaiser" };
+    double megapixels = (double)width * height / 1e6;
+    std::vector<uint8_t> half((size_t)(width / 2) * (height / 2) * 4);
+    std::vector<uint8_t> chain(mipChainBytes(width, height, 4));
+
+    out << "resample " << width << "x" << height << " sRGB, MPix/s of the source\n";
+    out << std::left << std::setw(10) << "filter" << std::setw(10) << "threads" << std::setw(10) << "half" << "mip chain\n";
+    for (int f = 0; f < 4; f++)
+    {
+        ResampleOptions options;
+        options.filter = filters[f];
+        options.colorSpace = ColorSpace::sRGB;
+        options.alphaChannel = 3;
+        for (unsigned threads : benchmarkThreadCounts())
+        {
+            ThreadPool pool(std::max(1u, threads - 1)); // the calling thread resamples too
+            ThreadPool* usePool = threads > 1 ? &pool : nullptr;
+            BenchmarkTimer halfTimer;
+            for (int i = 0; i < repeat; i++)
+                resampleImage(rgba, width, height, half.data(), width / 2, height / 2, 4, options, usePool);
+            double halfRate = megapixels * repeat / halfTimer.seconds();
+            BenchmarkTimer chainTimer;
+            for (int i = 0; i < repeat; i++)
+                buildMipChain(rgba, width, height, 4, options, chain.data(), usePool);
+            double chainRate = megapixels * repeat / chainTimer.seconds();
+
+            out << std::left << std::setw(10) << names[f] << std::setw(10) << threads << std::fixed << std::setprecision(1)
+                << std::setw(10) << halfRate << chainRate << "\n";
+        }
+    }
+}
+
+// Batch math kernels against the scalar reference, count elements per call;
+// the default keeps everything in L2 so the kernels are not memory bound
+// ----------------------------------------------------------------------------
+inline void benchmarkMath(std::ostream& out, size_t count = 10000, int repeat = 200)
+{
+    std::vector<Vec3> points(count), transformedPoints(count);
+    std::vector<Vec4> vectors(count), transformedVectors(count);
+    std::vector<Mat4> locals(count), parents(count), worlds(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        float f = (float)i;
+        points[i] = Vec3(f, f * 0.5f, -f);
+        vectors[i] = Vec4(points[i], 1.0f);
+        locals[i] = composeTransform(points[i], quatFromAxisAngle(Vec3(0.0f, 1.0f, 0.0f), f), Vec3(1.0f));
+        parents[i] = rotation(f * 0.01f, Vec3(1.0f, 0.0f, 0.0f));
+    }
+    Mat4 viewProjection = perspective(radians(45.0f), 4.0f / 3.0f, 0.1f, 100.0f) *
+                          lookAt(Vec3(0.0f, 0.0f, 3.0f), Vec3(0.0f), Vec3(0.0f, 1.0f, 0.0f));
+
+    struct Kernel
+    {
+        const char* name;
+        std::function<void()> scalar;
+        std::function<void()> simd;
+    };
+    Kernel kernels[] = {
+        { "points",
+          [&] { vecmath::transformPointsScalar(viewProjection, points.data(), transformedPoints.data(), count); },
+          [&] { transformPoints(viewProjection, points.data(), transformedPoints.data(), count); } },
+        { "vec4",
+          [&] { vecmath::transformVectorsScalar(viewProjection, vectors.data(), transformedVectors.data(), count); },
+          [&] { transformVectors(viewProjection, vectors.data(), transformedVectors.data(), count); } },
+        { "mat4*mat4",
+          [&] { vecmath::multiplyMatricesScalar(parents.data(), locals.data(), worlds.data(), count); },
+          [&] { multiplyMatrices(parents.data(), locals.data(), worlds.data(), count); } },
+    };
+
+    out << "math kernels, " << count << " elements\n";
+    out << std::left << std::setw(12) << "kernel" << std::setw(14) << "scalar M/s" << std::setw(14) << "simd M/s" << "speedup\n";
+    for (Kernel& kernel : kernels)
+    {
+        double rates[2];
+        for (int simd = 0; simd < 2; simd++)
+        {
+            BenchmarkTimer timer;
+            for (int i = 0; i < repeat; i++)
+                (simd ? kernel.simd : kernel.scalar)();
+            rates[simd] = (double)count * repeat / timer.seconds() / 1e6;
+        }
+        out << std::left << std::setw(12) << kernel.name << std::fixed << std::setprecision(1) << std::setw(14) << rates[0]
+            << std::setw(14) << rates[1] << std::setprecision(2) << rates[1] / rates[0] << "x\n";
+    }
+}
+
+// World matrix update of a hierarchy of nodeCount nodes, 8 children per node,
+// per thread count: the root moved (everything recomputes), 1% of the nodes moved, and one node
+// near the root moved (its subtree recomputes, the rest is skipped)
+// ----------------------------------------------------------------------------
+inline void benchmarkTransformHierarchy(std::ostream& out, uint32_t nodeCount = 1000000, int repeat = 10)
+{
+    TransformHierarchy hierarchy(nodeCount);
+    std::vector<TransformNode> nodes;
+    nodes.reserve(nodeCount);
+    for (uint32_t i = 0; i < nodeCount; i++)
+    {
+        TransformNode node = hierarchy.create(i ? nodes[(i - 1) / 8] : INVALID_NODE);
+        float f = (float)i;
+        hierarchy.setLocal(node, Vec3(f * 0.001f, 1.0f, 0.0f), quatFromAxisAngle(Vec3(0.0f, 1.0f, 0.0f), f), Vec3(1.0f));
+        nodes.push_back(node);
+    }
+    BenchmarkTimer sortTimer;
+    hierarchy.update();
+    double sortMilliseconds = sortTimer.seconds() * 1000.0;
+
+    out << "transform hierarchy, " << nodeCount << " nodes, " << hierarchy.stats().levels << " levels, first update "
+        << std::fixed << std::setprecision(1) << sortMilliseconds << " ms\n";
+    out << std::left << std::setw(10) << "threads" << std::setw(14) << "all ms" << std::setw(14) << "1% ms" << "subtree ms\n";
+    for (unsigned threads : benchmarkThreadCounts())
+    {
+        ThreadPool pool(std::max(1u, threads - 1)); // the calling thread updates too
+        ThreadPool* usePool = threads > 1 ? &pool : nullptr;
+        double milliseconds[3];
+        for (int pass = 0; pass < 3; pass++)
+        {
+            double total = 0.0;
+            for (int i = 0; i < repeat; i++)
+            {
+                float angle = (float)i * 0.1f;
+                if (pass == 0)
+                    hierarchy.setRotation(nodes[0], quatFromAxisAngle(Vec3(0.0f, 0.0f, 1.0f), angle));
+                else if (pass == 1)
+                {
+                    for (uint32_t n = i; n < nodeCount; n += 100)
+                        hierarchy.setRotation(nodes[n], quatFromAxisAngle(Vec3(0.0f, 0.0f, 1.0f), angle));
+                }
+                else
+                    hierarchy.setRotation(nodes[1 + i % 8], quatFromAxisAngle(Vec3(0.0f, 0.0f, 1.0f), angle));
+                BenchmarkTimer timer;
+                hierarchy.update(usePool);
+                total += timer.seconds();
+            }
+            milliseconds[pass] = total * 1000.0 / repeat;
+        }
+        out << std::left << std::setw(10) << threads << std::fixed << std::setprecision(2) << std::setw(14)
+            << milliseconds[0] << std::setw(14) << milliseconds[1] << milliseconds[2] << "\n";
+    }
+}
+
+// Per-instance kernels of matrix_kernels.h at every ISA level this CPU has,
+// count elements per call, in million matrices (or boxes) per second
+// ----------------------------------------------------------------------------
+inline void benchmarkMatrixKernels(std::ostream& out, size_t count = 4096, int repeat = 500)
+{
+    std::vector<Mat4> models(count), results(count);
+    std::vector<Aabb> boxes(count), transformedBoxes(count);
+    std::vector<uint8_t> packed(count * sizeof(Mat4));
+    for (size_t i = 0; i < count; i++)
+    {
+        float f = (float)i;
+        models[i] = composeTransform(Vec3(f, f * 0.5f, -f), quatFromAxisAngle(Vec3(0.0f, 1.0f, 0.0f), f), Vec3(1.0f + f * 0.001f));
+        boxes[i] = Aabb(Vec3(-f, -1.0f, -2.0f), Vec3(f, 1.0f, 2.0f));
+    }
+    Mat4 viewProjection = perspective(radians(45.0f), 4.0f / 3.0f, 0.1f, 100.0f) *
+                          lookAt(Vec3(0.0f, 0.0f, 3.0f), Vec3(0.0f), Vec3(0.0f, 1.0f, 0.0f));
+
+    struct Level
+    {
+        const char* name;
+        bool supported;
+        void (*multiply)(const Mat4&, const Mat4*, Mat4*, size_t);
+        void (*transformAabbs)(const Mat4&, const Aabb*, Aabb*, size_t);
+        void (*pack)(const Mat4*, size_t, MatrixPacking, void*);
+    } levels[] = {
+        { "scalar", true, batch::multiplyScalar, batch::transformAabbsScalar, batch::packMatricesScalar },
+#ifdef CPU_HAS_SSE2
+        { "sse2", true, batch::multiplySSE2, batch::transformAabbsSSE2, batch::packMatricesSSE2 },
+        { "avx2", cpuFeatures().avx2 && cpuFeatures().fma && cpuFeatures().f16c, batch::multiplyAVX2, batch::transformAabbsAVX2, batch::packMatricesAVX2 },
+        { "avx512", cpuFeatures().avx512f, batch::multiplyAVX512, batch::transformAabbsAVX512, batch::packMatricesAVX512 },
+#endif
+    };
+    const char* kernels[] = { "vp*model", "aabb", "float3x4", "half4x4", "half3x4" };
+    const MatrixPacking packings[] = { MatrixPacking::Float3x4, MatrixPacking::Half4x4, MatrixPacking::Half3x4 };
+
+    out << "matrix kernels, " << count << " elements, M/s\n";
+    out << std::left << std::setw(10) << "kernel";
+    for (const Level& level : levels)
+    {
+        if (level.supported)
+            out << std::setw(10) << level.name;
+    }
+    out << "\n";
+    for (int k = 0; k < 5; k++)
+    {
+        out << std::left << std::setw(10) << kernels[k];
+        for (const Level& level : levels)
+        {
+            if (!level.supported)
+                continue;
+            BenchmarkTimer timer;
+            for (int i = 0; i < repeat; i++)
+            {
+                if (k == 0)
+                    level.multiply(viewProjection, models.data(), results.data(), count);
+                else if (k == 1)
+                    level.transformAabbs(viewProjection, boxes.data(), transformedBoxes.data(), count);
+                else
+                    level.pack(models.data(), count, packings[k - 2], packed.data());
+            }
+            out << std::fixed << std::setprecision(1) << std::setw(10) << (double)count * repeat / timer.seconds() / 1e6;
+        }
+        out << "\n";
+    }
+}
+
+// One frame of animation for `characters` characters sharing a skeleton of
+// `joints` joints, each blending two 60 frame clips: the scalar and SIMD
+// sampling paths on one thread, then animateCharacters() per thread count
+// ----------------------------------------------------------------------------
+inline void benchmarkSkinning(std::ostream& out, uint32_t characters = 1000, uint32_t joints = 64, int repeat = 20)
+{
+    Skeleton skeleton;
+    skeleton.parents.resize(joints);
+    skeleton.inverseBindPose.resize(joints);
+    for (uint32_t j = 0; j < joints; j++)
+    {
+        skeleton.parents[j] = (int16_t)(j ? (j - 1) / 2 : -1);
+        skeleton.inverseBindPose[j] = translation(Vec3(0.0f, -0.1f * j, 0.0f));
+    }
+    AnimationClip clips[2];
+    for (int c = 0; c < 2; c++)
+    {
+        clips[c].resize(joints, 60);
+        for (uint32_t f = 0; f < 60; f++)
+        {
+            for (uint32_t j = 0; j < joints; j++)
+            {
+                size_t key = (size_t)f * joints + j;
+                float angle = std::sin((float)f * 0.1f * (c + 1) + (float)j);
+                clips[c].translations[key] = Vec4(0.0f, 0.1f, 0.0f, 0.0f);
+                clips[c].rotations[key] = quatFromAxisAngle(normalize(Vec3(1.0f, (float)j, (float)c)), angle);
+            }
+        }
+    }
+    std::vector<AnimatedCharacter> crowd(characters);
+    for (uint32_t i = 0; i < characters; i++)
+    {
+        crowd[i].clips[0] = &clips[0];
+        crowd[i].clips[1] = &clips[1];
+        crowd[i].times[0] = crowd[i].times[1] = (float)i * 0.013f;
+        crowd[i].blend = 0.3f;
+    }
+    std::vector<float> palettes(paletteFloats(skeleton) * characters);
+
+    out << "skinning, " << characters << " characters, " << joints << " joints, 2 clips blended, "
+        << palettes.size() * sizeof(float) / 1024 << " KB of palettes\n";
+    out << std::left << std::setw(16) << "path" << std::setw(10) << "threads" << "ms/frame\n";
+    for (int simd = 0; simd < 2; simd++)
+    {
+        anim::Scratch scratch;
+        BenchmarkTimer timer;
+        for (int r = 0; r < repeat; r++)
+        {
+            for (uint32_t i = 0; i < characters; i++)
+            {
+                float* palette = &palettes[i * paletteFloats(skeleton)];
+                if (simd)
+                    anim::animateCharacter<true>(skeleton, crowd[i], scratch, palette);
+                else
+                    anim::animateCharacter<false>(skeleton, crowd[i], scratch, palette);
+            }
+        }
+        out << std::left << std::setw(16) << (simd ? "simd" : "scalar") << std::setw(10) << 1 << std::fixed
+            << std::setprecision(2) << timer.seconds() * 1000.0 / repeat << "\n";
+    }
+    for (unsigned threads : benchmarkThreadCounts())
+    {
+        ThreadPool pool(std::max(1u, threads - 1)); // the calling thread animates too
+        BenchmarkTimer timer;
+        for (int r = 0; r < repeat; r++)
+            animateCharacters(skeleton, crowd.data(), characters, palettes.data(), threads > 1 ? &pool : nullptr);
+        out << std::left << std::setw(16) << "animate" << std::setw(10) << threads << std::fixed
+            << std::setprecision(2) << timer.seconds() * 1000.0 / repeat << "\n";
+    }
+}
+
+#endif
@@ -0,0 +1,1065 @@
+#ifndef BLOCK_COMPRESSION_H
+#define BLOCK_COMPRESSION_H
+
+#include <glad/glad.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "cpu_features.h"
+#include "gl_verify.h"
+#include "thread_pool.h"
+
+// the loader only exposes core 3.3, add the extension enums we upload with
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+#ifndef GL_COMPRESSED_RGBA_BPTC_UNORM
+#define GL_COMPRESSED_RGBA_BPTC_UNORM 0x8E8C
+#endif
+
+// Block compression (BC1/BC3/BC4/BC5/BC7) of RGBA8 images into 4x4 blocks.
+// Meant to run at bake time: bakeCompressedTexture() builds the mip chain and
+// encodes every level, saveCompressedTexture() writes a .bct file, and at run
+// time loadCompressedTexture() + uploadCompressedTexture() feed the blocks to
+// glCompressedTexImage2D per mip level.
+//
+// BC7 is encoded with mode 6 only (one subset, RGBA 7.7.7.7 + p-bit endpoints,
+// 4 bit indices), which is a good fit for photos and soft alpha.
+
+enum class BlockFormat
+{
+    BC1, // RGB, 4 bpp
+    BC3, // RGBA, 8 bpp: BC4 alpha + BC1 color
+    BC4, // R, 4 bpp
+    BC5, // RG, 8 bpp: two BC4 blocks, for normal maps
+    BC7, // RGBA, 8 bpp, best quality
+};
+
+enum class TextureContent
+{
+    Auto,      // look at the pixels
+    Color,
+    NormalMap, // tangent space, xy in RG
+};
+
+struct CompressedLevel
+{
+    int width;
+    int height;
+    std::vector<uint8_t> data;
+};
+
+struct CompressedTexture
+{
+    BlockFormat format = BlockFormat::BC1;
+    std::vector<CompressedLevel> levels;
+};
+
+// ----------------------------------------------------------------------------
+inline uint32_t blockBytes(BlockFormat format)
+{
+    return (format == BlockFormat::BC1 || format == BlockFormat::BC4) ? 8 : 16;
+}
+inline size_t compressedLevelSize(BlockFormat format, int width, int height)
+{
+    return (size_t)((width + 3) / 4) * ((height + 3) / 4) * blockBytes(format);
+}
+inline GLenum glCompressedFormat(BlockFormat format)
+{
+    switch (format)
+    {
+    case BlockFormat::BC1: return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+    case BlockFormat::BC3: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    case BlockFormat::BC4: return GL_COMPRESSED_RED_RGTC1;
+    case BlockFormat::BC5: return GL_COMPRESSED_RG_RGTC2;
+    case BlockFormat::BC7: return GL_COMPRESSED_RGBA_BPTC_UNORM;
+    }
+    return 0;
+}
+inline const char* blockFormatName(BlockFormat format)
+{
+    switch (format)
+    {
+    case BlockFormat::BC1: return "BC1";
+    case BlockFormat::BC3: return "BC3";
+    case BlockFormat::BC4: return "BC4";
+    case BlockFormat::BC5: return "BC5";
+    case BlockFormat::BC7: return "BC7";
+    }
+    return "?";
+}
+
+namespace bc
+{
+    // Picks the nearest palette entry for each of the 16 texels.
+    // texels are planar: channel c of texel i is texels[c * 16 + i].
+    // Returns the summed squared error.
+    // ------------------------------------------------------------------------
+    inline float selectIndices(const float* texels, int channels, const float (*palette)[4], int paletteSize, uint8_t indices[16])
+    {
+#ifdef CPU_HAS_SSE2
+        float total = 0.0f;
+        for (int i = 0; i < 16; i += 4)
+        {
+            __m128 bestError = _mm_set1_ps(1e30f);
+            __m128i bestIndex = _mm_setzero_si128();
+            for (int p = 0; p < paletteSize; p++)
+            {
+                __m128 error = _mm_setzero_ps();
+                for (int c = 0; c < channels; c++)
+                {
+                    __m128 d = _mm_sub_ps(_mm_loadu_ps(texels + c * 16 + i), _mm_set1_ps(palette[p][c]));
+                    error = _mm_add_ps(error, _mm_mul_ps(d, d));
+                }
+                __m128 better = _mm_cmplt_ps(error, bestError);
+                __m128i betterMask = _mm_castps_si128(better);
+                bestError = _mm_min_ps(error, bestError);
+                bestIndex = _mm_or_si128(_mm_and_si128(betterMask, _mm_set1_epi32(p)), _mm_andnot_si128(betterMask, bestIndex));
+            }
+            alignas(16) int32_t index[4];
+            alignas(16) float error[4];
+            _mm_store_si128((__m128i*)index, bestIndex);
+            _mm_store_ps(error, bestError);
+            for (int k = 0; k < 4; k++)
+            {
+                indices[i + k] = (uint8_t)index[k];
+                total += error[k];
+            }
+        }
+        return total;
+#else
+        float total = 0.0f;
+        for (int i = 0; i < 16; i++)
+        {
+            float bestError = 1e30f;
+            int best = 0;
+            for (int p = 0; p < paletteSize; p++)
+            {
+                float error = 0.0f;
+                for (int c = 0; c < channels; c++)
+                {
+                    float d = texels[c * 16 + i] - palette[p][c];
+                    error += d * d;
+                }
+                if (error < bestError)
+                {
+                    bestError = error;
+                    best = p;
+                }
+            }
+            indices[i] = (uint8_t)best;
+            total += bestError;
+        }
+        return total;
+#endif
+    }
+
+    // principal axis of the texels through power iteration, used to pick endpoints
+    // ------------------------------------------------------------------------
+    inline void principalAxis(const float* texels, int channels, float mean[4], float axis[4])
+    {
+        for (int c = 0; c < 4; c++)
+        {
+            mean[c] = 0.0f;
+            axis[c] = 0.0f;
+        }
+        for (int c = 0; c < channels; c++)
+        {
+            for (int i = 0; i < 16; i++)
+                mean[c] += texels[c * 16 + i];
+            mean[c] /= 16.0f;
+        }
+
+        float cov[4][4] = {};
+        for (int i = 0; i < 16; i++)
+        {
+            for (int a = 0; a < channels; a++)
+            {
+                float da = texels[a * 16 + i] - mean[a];
+                for (int b = a; b < channels; b++)
+                    cov[a][b] += da * (texels[b * 16 + i] - mean[b]);
+            }
+        }
+        for (int a = 0; a < channels; a++)
+        {
+            for (int b = 0; b < a; b++)
+                cov[a][b] = cov[b][a];
+        }
+
+        // start from the bounding box diagonal, converges quickly
+        for (int c = 0; c < channels; c++)
+        {
+            float lo = 255.0f;
+            float hi = 0.0f;
+            for (int i = 0; i < 16; i++)
+            {
+                lo = std::min(lo, texels[c * 16 + i]);
+                hi = std::max(hi, texels[c * 16 + i]);
+            }
+            axis[c] = hi - lo;
+        }
+        for (int iteration = 0; iteration < 8; iteration++)
+        {
+            float next[4] = {};
+            for (int a = 0; a < channels; a++)
+            {
+                for (int b = 0; b < channels; b++)
+                    next[a] += cov[a][b] * axis[b];
+            }
+            float length = 0.0f;
+            for (int c = 0; c < channels; c++)
+                length = std::max(length, std::fabs(next[c]));
+            if (length < 1e-6f)
+                break;
+            for (int c = 0; c < channels; c++)
+                axis[c] = next[c] / length;
+        }
+        float length = 0.0f;
+        for (int c = 0; c < channels; c++)
+            length += axis[c] * axis[c];
+        length = std::sqrt(length);
+        if (length < 1e-6f)
+        {
+            for (int c = 0; c < channels; c++)
+                axis[c] = 0.0f;
+            return;
+        }
+        for (int c = 0; c < channels; c++)
+            axis[c] /= length;
+    }
+    // endpoints at the extreme projections onto the principal axis
+    // ------------------------------------------------------------------------
+    inline void axisEndpoints(const float* texels, int channels, float e0[4], float e1[4])
+    {
+        float mean[4];
+        float axis[4];
+        principalAxis(texels, channels, mean, axis);
+        float lo = 0.0f;
+        float hi = 0.0f;
+        for (int i = 0; i < 16; i++)
+        {
+            float t = 0.0f;
+            for (int c = 0; c < channels; c++)
+                t += (texels[c * 16 + i] - mean[c]) * axis[c];
+            lo = std::min(lo, t);
+            hi = std::max(hi, t);
+        }
+        for (int c = 0; c < channels; c++)
+        {
+            e0[c] = std::min(255.0f, std::max(0.0f, mean[c] + axis[c] * hi));
+            e1[c] = std::min(255.0f, std::max(0.0f, mean[c] + axis[c] * lo));
+        }
+    }
+    // Least squares endpoints for the given indices. weights[i] is how much of
+    // e0 goes into palette entry i. Returns false when the system is singular.
+    // ------------------------------------------------------------------------
+    inline bool refineEndpoints(const float* texels, int channels, const uint8_t indices[16], const float* weights, float e0[4], float e1[4])
+    {
+        float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+        float ax[4] = {}, bx[4] = {};
+        for (int i = 0; i < 16; i++)
+        {
+            float a = weights[indices[i]];
+            float b = 1.0f - a;
+            aa += a * a;
+            ab += a * b;
+            bb += b * b;
+            for (int c = 0; c < channels; c++)
+            {
+                ax[c] += a * texels[c * 16 + i];
+                bx[c] += b * texels[c * 16 + i];
+            }
+        }
+        float det = aa * bb - ab * ab;
+        if (std::fabs(det) < 1e-6f)
+            return false;
+        float inv = 1.0f / det;
+        for (int c = 0; c < channels; c++)
+        {
+            e0[c] = std::min(255.0f, std::max(0.0f, (ax[c] * bb - bx[c] * ab) * inv));
+            e1[c] = std::min(255.0f, std::max(0.0f, (bx[c] * aa - ax[c] * ab) * inv));
+        }
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    inline uint16_t packRGB565(const float color[4])
+    {
+        int r = (int)(color[0] * 31.0f / 255.0f + 0.5f);
+        int g = (int)(color[1] * 63.0f / 255.0f + 0.5f);
+        int b = (int)(color[2] * 31.0f / 255.0f + 0.5f);
+        return (uint16_t)((r << 11) | (g << 5) | b);
+    }
+    inline void unpackRGB565(uint16_t packed, int out[3])
+    {
+        int r = (packed >> 11) & 31;
+        int g = (packed >> 5) & 63;
+        int b = packed & 31;
+        out[0] = (r << 3) | (r >> 2);
+        out[1] = (g << 2) | (g >> 4);
+        out[2] = (b << 3) | (b >> 2);
+    }
+    // the palette exactly as a decoder builds it in four color mode
+    inline void bc1Palette(uint16_t c0, uint16_t c1, float palette[4][4])
+    {
+        int a[3], b[3];
+        unpackRGB565(c0, a);
+        unpackRGB565(c1, b);
+        for (int c = 0; c < 3; c++)
+        {
+            palette[0][c] = (float)a[c];
+            palette[1][c] = (float)b[c];
+            palette[2][c] = (float)((2 * a[c] + b[c]) / 3);
+            palette[3][c] = (float)((a[c] + 2 * b[c]) / 3);
+        }
+        for (int p = 0; p < 4; p++)
+            palette[p][3] = 0.0f;
+    }
+
+    // texels: planar RGB(A), 16 floats per channel
+    // ------------------------------------------------------------------------
+    inline void encodeBC1Color(const float* texels, uint8_t out[8])
+    {
+        static const float weights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+
+        float e0[4], e1[4];
+        axisEndpoints(texels, 3, e0, e1);
+
+        uint16_t c0 = packRGB565(e0);
+        uint16_t c1 = packRGB565(e1);
+        float palette[4][4];
+        bc1Palette(c0, c1, palette);
+        uint8_t indices[16];
+        float error = selectIndices(texels, 3, palette, 4, indices);
+
+        // two rounds of least squares on the chosen indices
+        for (int iteration = 0; iteration < 2 && c0 != c1; iteration++)
+        {
+            float r0[4], r1[4];
+            if (!refineEndpoints(texels, 3, indices, weights, r0, r1))
+                break;
+            uint16_t n0 = packRGB565(r0);
+            uint16_t n1 = packRGB565(r1);
+            float candidate[4][4];
+            bc1Palette(n0, n1, candidate);
+            uint8_t candidateIndices[16];
+            float candidateError = selectIndices(texels, 3, candidate, 4, candidateIndices);
+            if (candidateError >= error)
+                break;
+            error = candidateError;
+            c0 = n0;
+            c1 = n1;
+            memcpy(indices, candidateIndices, 16);
+        }
+
+        // four color mode needs c0 > c1
+        if (c0 < c1)
+        {
+            std::swap(c0, c1);
+            for (int i = 0; i < 16; i++)
+                indices[i] ^= 1; // 0 <-> 1, 2 <-> 3
+        }
+        uint32_t bits = 0;
+        if (c0 != c1)
+        {
+            for (int i = 0; i < 16; i++)
+                bits |= (uint32_t)indices[i] << (2 * i);
+        }
+
+        out[0] = (uint8_t)(c0 & 0xff);
+        out[1] = (uint8_t)(c0 >> 8);
+        out[2] = (uint8_t)(c1 & 0xff);
+        out[3] = (uint8_t)(c1 >> 8);
+        out[4] = (uint8_t)(bits & 0xff);
+        out[5] = (uint8_t)((bits >> 8) & 0xff);
+        out[6] = (uint8_t)((bits >> 16) & 0xff);
+        out[7] = (uint8_t)(bits >> 24);
+    }
+    // single channel, 16 floats
+    // ------------------------------------------------------------------------
+    inline void encodeBC4Channel(const float* values, uint8_t out[8])
+    {
+        float lo = 255.0f;
+        float hi = 0.0f;
+        for (int i = 0; i < 16; i++)
+        {
+            lo = std::min(lo, values[i]);
+            hi = std::max(hi, values[i]);
+        }
+        int a0 = (int)(hi + 0.5f);
+        int a1 = (int)(lo + 0.5f);
+
+        uint64_t bits = 0;
+        if (a0 != a1)
+        {
+            // eight value mode: a0 > a1, indices 2..7 interpolate
+            float palette[8][4] = {};
+            palette[0][0] = (float)a0;
+            palette[1][0] = (float)a1;
+            for (int i = 2; i < 8; i++)
+                palette[i][0] = (float)(((8 - i) * a0 + (i - 1) * a1) / 7);
+            uint8_t indices[16];
+            selectIndices(values, 1, palette, 8, indices);
+            for (int i = 0; i < 16; i++)
+                bits |= (uint64_t)indices[i] << (3 * i);
+        }
+
+        out[0] = (uint8_t)a0;
+        out[1] = (uint8_t)a1;
+        for (int i = 0; i < 6; i++)
+            out[2 + i] = (uint8_t)((bits >> (8 * i)) & 0xff);
+    }
+
+    // BC7 mode 6 ---------------------------------------------------------------
+    static const int BC7_WEIGHTS4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+    static const int BC7_WEIGHTS2[4] = { 0, 21, 43, 64 };
+
+    struct BitWriter
+    {
+        uint64_t lo = 0;
+        uint64_t hi = 0;
+        int position = 0;
+
+        void write(uint32_t value, int count)
+        {
+            for (int i = 0; i < count; i++, position++)
+            {
+                uint64_t bit = (value >> i) & 1;
+                if (position < 64)
+                    lo |= bit << position;
+                else
+                    hi |= bit << (position - 64);
+            }
+        }
+    };
+    struct BitReader
+    {
+        uint64_t lo;
+        uint64_t hi;
+        int position = 0;
+
+        uint32_t read(int count)
+        {
+            uint32_t value = 0;
+            for (int i = 0; i < count; i++, position++)
+            {
+                uint64_t bit = position < 64 ? (lo >> position) & 1 : (hi >> (position - 64)) & 1;
+                value |= (uint32_t)bit << i;
+            }
+            return value;
+        }
+    };
+
+    // 7 bit endpoint plus a shared p-bit, picks the p-bit with the lower error
+    // ------------------------------------------------------------------------
+    inline void quantizeBC7Endpoint(const float endpoint[4], int quantized[4], int& pbit)
+    {
+        float bestError = 1e30f;
+        for (int p = 0; p < 2; p++)
+        {
+            int q[4];
+            float error = 0.0f;
+            for (int c = 0; c < 4; c++)
+            {
+                q[c] = std::min(127, std::max(0, (int)std::floor((endpoint[c] - p) / 2.0f + 0.5f)));
+                float d = (float)((q[c] << 1) | p) - endpoint[c];
+                error += d * d;
+            }
+            if (error < bestError)
+            {
+                bestError = error;
+                pbit = p;
+                for (int c = 0; c < 4; c++)
+                    quantized[c] = q[c];
+            }
+        }
+    }
+    inline void bc7Palette(const int q0[4], int p0, const int q1[4], int p1, float palette[16][4])
+    {
+        for (int i = 0; i < 16; i++)
+        {
+            int w = BC7_WEIGHTS4[i];
+            for (int c = 0; c < 4; c++)
+            {
+                int a = (q0[c] << 1) | p0;
+                int b = (q1[c] << 1) | p1;
+                palette[i][c] = (float)(((64 - w) * a + w * b + 32) >> 6);
+            }
+        }
+    }
+    // texels: planar RGBA
+    // ------------------------------------------------------------------------
+    inline void encodeBC7Mode6(const float* texels, uint8_t out[16])
+    {
+        // share of e0 in each palette entry
+        static const float weights[16] = {
+            1.0f - 0 / 64.0f, 1.0f - 4 / 64.0f, 1.0f - 9 / 64.0f, 1.0f - 13 / 64.0f,
+            1.0f - 17 / 64.0f, 1.0f - 21 / 64.0f, 1.0f - 26 / 64.0f, 1.0f - 30 / 64.0f,
+            1.0f - 34 / 64.0f, 1.0f - 38 / 64.0f, 1.0f - 43 / 64.0f, 1.0f - 47 / 64.0f,
+            1.0f - 51 / 64.0f, 1.0f - 55 / 64.0f, 1.0f - 60 / 64.0f, 1.0f - 64 / 64.0f,
+        };
+
+        float e0[4], e1[4];
+        axisEndpoints(texels, 4, e0, e1);
+
+        int q0[4], q1[4], p0 = 0, p1 = 0;
+        quantizeBC7Endpoint(e0, q0, p0);
+        quantizeBC7Endpoint(e1, q1, p1);
+        float palette[16][4];
+        bc7Palette(q0, p0, q1, p1, palette);
+        uint8_t indices[16];
+        float error = selectIndices(texels, 4, palette, 16, indices);
+
+        for (int iteration = 0; iteration < 2; iteration++)
+        {
+            float r0[4], r1[4];
+            if (!refineEndpoints(texels, 4, indices, weights, r0, r1))
+                break;
+            int n0[4], n1[4], np0 = 0, np1 = 0;
+            quantizeBC7Endpoint(r0, n0, np0);
+            quantizeBC7Endpoint(r1, n1, np1);
+            float candidate[16][4];
+            bc7Palette(n0, np0, n1, np1, candidate);
+            uint8_t candidateIndices[16];
+            float candidateError = selectIndices(texels, 4, candidate, 16, candidateIndices);
+            if (candidateError >= error)
+                break;
+            error = candidateError;
+            memcpy(q0, n0, sizeof(q0));
+            memcpy(q1, n1, sizeof(q1));
+            p0 = np0;
+            p1 = np1;
+            memcpy(indices, candidateIndices, 16);
+        }
+
+        // the anchor index is stored with 3 bits, its top bit must be 0
+        if (indices[0] & 8)
+        {
+            for (int c = 0; c < 4; c++)
+                std::swap(q0[c], q1[c]);
+            std::swap(p0, p1);
+            for (int i = 0; i < 16; i++)
+                indices[i] = (uint8_t)(15 - indices[i]);
+        }
+
+        BitWriter writer;
+        writer.write(1 << 6, 7); // mode 6
+        for (int c = 0; c < 4; c++)
+        {
+            writer.write(q0[c], 7);
+            writer.write(q1[c], 7);
+        }
+        writer.write(p0, 1);
+        writer.write(p1, 1);
+        writer.write(indices[0], 3);
+        for (int i = 1; i < 16; i++)
+            writer.write(indices[i], 4);
+        memcpy(out, &writer.lo, 8);
+        memcpy(out + 8, &writer.hi, 8);
+    }
+
+    // decoders, only what we write ---------------------------------------------
+    inline void decodeBC1(const uint8_t* block, uint8_t out[16][4], bool forceFourColor)
+    {
+        uint16_t c0 = (uint16_t)(block[0] | (block[1] << 8));
+        uint16_t c1 = (uint16_t)(block[2] | (block[3] << 8));
+        uint32_t bits = (uint32_t)block[4] | ((uint32_t)block[5] << 8) | ((uint32_t)block[6] << 16) | ((uint32_t)block[7] << 24);
+        int a[3], b[3];
+        unpackRGB565(c0, a);
+        unpackRGB565(c1, b);
+        uint8_t palette[4][4];
+        for (int c = 0; c < 3; c++)
+        {
+            palette[0][c] = (uint8_t)a[c];
+            palette[1][c] = (uint8_t)b[c];
+            if (c0 > c1 || forceFourColor)
+            {
+                palette[2][c] = (uint8_t)((2 * a[c] + b[c]) / 3);
+                palette[3][c] = (uint8_t)((a[c] + 2 * b[c]) / 3);
+            }
+            else
+            {
+                palette[2][c] = (uint8_t)((a[c] + b[c]) / 2);
+                palette[3][c] = 0;
+            }
+        }
+        palette[0][3] = palette[1][3] = palette[2][3] = 255;
+        palette[3][3] = (c0 > c1 || forceFourColor) ? 255 : 0;
+        for (int i = 0; i < 16; i++)
+            memcpy(out[i], palette[(bits >> (2 * i)) & 3], 4);
+    }
+    inline void decodeBC4(const uint8_t* block, uint8_t out[16][4], int channel)
+    {
+        int a0 = block[0];
+        int a1 = block[1];
+        uint8_t palette[8];
+        palette[0] = (uint8_t)a0;
+        palette[1] = (uint8_t)a1;
+        if (a0 > a1)
+        {
+            for (int i = 2; i < 8; i++)
+                palette[i] = (uint8_t)(((8 - i) * a0 + (i - 1) * a1) / 7);
+        }
+        else
+        {
+            for (int i = 2; i < 6; i++)
+                palette[i] = (uint8_t)(((6 - i) * a0 + (i - 1) * a1) / 5);
+            palette[6] = 0;
+            palette[7] = 255;
+        }
+        uint64_t bits = 0;
+        for (int i = 0; i < 6; i++)
+            bits |= (uint64_t)block[2 + i] << (8 * i);
+        for (int i = 0; i < 16; i++)
+            out[i][channel] = palette[(bits >> (3 * i)) & 7];
+    }
+    inline void decodeBC7Mode6(const uint8_t* block, uint8_t out[16][4])
+    {
+        BitReader reader;
+        memcpy(&reader.lo, block, 8);
+        memcpy(&reader.hi, block + 8, 8);
+        if (reader.read(7) != (1 << 6))
+        {
+            // not mode 6, we never write those
+            memset(out, 0, 64);
+            return;
+        }
+        int q0[4], q1[4];
+        for (int c = 0; c < 4; c++)
+        {
+            q0[c] = (int)reader.read(7);
+            q1[c] = (int)reader.read(7);
+        }
+        int p0 = (int)reader.read(1);
+        int p1 = (int)reader.read(1);
+        float palette[16][4];
+        bc7Palette(q0, p0, q1, p1, palette);
+        for (int i = 0; i < 16; i++)
+        {
+            int index = (int)reader.read(i == 0 ? 3 : 4);
+            for (int c = 0; c < 4; c++)
+                out[i][c] = (uint8_t)palette[index][c];
+        }
+    }
+
+    // mode 5: rotation, RGB 7.7.7 and A 8.8 endpoints, 2 bit color and alpha
+    // indices. Written by the supercompressed texture transcoder.
+    inline void decodeBC7Mode5(const uint8_t* block, uint8_t out[16][4])
+    {
+        BitReader reader;
+        memcpy(&reader.lo, block, 8);
+        memcpy(&reader.hi, block + 8, 8);
+        reader.read(6); // mode
+        int rotation = (int)reader.read(2);
+        int e[2][4];
+        for (int c = 0; c < 3; c++)
+        {
+            for (int i = 0; i < 2; i++)
+            {
+                int q = (int)reader.read(7);
+                e[i][c] = (q << 1) | (q >> 6);
+            }
+        }
+        e[0][3] = (int)reader.read(8);
+        e[1][3] = (int)reader.read(8);
+        int colorIndex[16], alphaIndex[16];
+        for (int i = 0; i < 16; i++)
+            colorIndex[i] = (int)reader.read(i == 0 ? 1 : 2);
+        for (int i = 0; i < 16; i++)
+            alphaIndex[i] = (int)reader.read(i == 0 ? 1 : 2);
+        for (int i = 0; i < 16; i++)
+        {
+            int wc = BC7_WEIGHTS2[colorIndex[i]];
+            int wa = BC7_WEIGHTS2[alphaIndex[i]];
+            for (int c = 0; c < 3; c++)
+                out[i][c] = (uint8_t)(((64 - wc) * e[0][c] + wc * e[1][c] + 32) >> 6);
+            out[i][3] = (uint8_t)(((64 - wa) * e[0][3] + wa * e[1][3] + 32) >> 6);
+            if (rotation)
+                std::swap(out[i][3], out[i][rotation - 1]);
+        }
+    }
+    inline void decodeBC7(const uint8_t* block, uint8_t out[16][4])
+    {
+        if (block[0] & 0x1f)
+        {
+            // modes 0-4, we never write those
+            memset(out, 0, 64);
+            return;
+        }
+        if (block[0] & 0x20)
+            decodeBC7Mode5(block, out);
+        else
+            decodeBC7Mode6(block, out);
+    }
+
+    // gathers a 4x4 block as planar floats, edge texels are repeated
+    // ------------------------------------------------------------------------
+    inline void extractBlock(const uint8_t* rgba, int width, int height, int bx, int by, float texels[64])
+    {
+        for (int y = 0; y < 4; y++)
+        {
+            int sy = std::min(by * 4 + y, height - 1);
+            for (int x = 0; x < 4; x++)
+            {
+                int sx = std::min(bx * 4 + x, width - 1);
+                const uint8_t* p = rgba + ((size_t)sy * width + sx) * 4;
+                for (int c = 0; c < 4; c++)
+                    texels[c * 16 + y * 4 + x] = (float)p[c];
+            }
+        }
+    }
+    // ------------------------------------------------------------------------
+    inline void encodeBlock(BlockFormat format, const float texels[64], uint8_t* out)
+    {
+        switch (format)
+        {
+        case BlockFormat::BC1:
+            encodeBC1Color(texels, out);
+            break;
+        case BlockFormat::BC3:
+            encodeBC4Channel(texels + 48, out);
+            encodeBC1Color(texels, out + 8);
+            break;
+        case BlockFormat::BC4:
+            encodeBC4Channel(texels, out);
+            break;
+        case BlockFormat::BC5:
+            encodeBC4Channel(texels, out);
+            encodeBC4Channel(texels + 16, out + 8);
+            break;
+        case BlockFormat::BC7:
+            encodeBC7Mode6(texels, out);
+            break;
+        }
+    }
+}
+
+// Encodes one RGBA8 image. Rows of blocks are spread over the pool when one is given.
+// ----------------------------------------------------------------------------
+inline std::vector<uint8_t> compressImage(const uint8_t* rgba, int width, int height, BlockFormat format, ThreadPool* pool = nullptr)
+{
+    int blocksX = (width + 3) / 4;
+    int blocksY = (height + 3) / 4;
+    uint32_t size = blockBytes(format);
+    std::vector<uint8_t> out(compressedLevelSize(format, width, height));
+
+    auto encodeRows = [&](uint32_t begin, uint32_t end) {
+        float texels[64];
+        for (uint32_t by = begin; by < end; by++)
+        {
+            for (int bx = 0; bx < blocksX; bx++)
+            {
+                bc::extractBlock(rgba, width, height, bx, (int)by, texels);
+                bc::encodeBlock(format, texels, &out[((size_t)by * blocksX + bx) * size]);
+            }
+        }
+    };
+    if (pool)
+        pool->parallelFor((uint32_t)blocksY, 4, encodeRows);
+    else
+        encodeRows(0, (uint32_t)blocksY);
+    return out;
+}
+// Decodes blocks back to RGBA8, channels a format does not store come back as 0 (alpha 255).
+// ----------------------------------------------------------------------------
+inline std::vector<uint8_t> decompressImage(const uint8_t* blocks, int width, int height, BlockFormat format)
+{
+    int blocksX = (width + 3) / 4;
+    int blocksY = (height + 3) / 4;
+    uint32_t size = blockBytes(format);
+    std::vector<uint8_t> rgba((size_t)width * height * 4);
+
+    for (int by = 0; by < blocksY; by++)
+    {
+        for (int bx = 0; bx < blocksX; bx++)
+        {
+            const uint8_t* block = blocks + ((size_t)by * blocksX + bx) * size;
+            uint8_t texels[16][4];
+            for (int i = 0; i < 16; i++)
+            {
+                texels[i][0] = texels[i][1] = texels[i][2] = 0;
+                texels[i][3] = 255;
+            }
+            switch (format)
+            {
+            case BlockFormat::BC1: bc::decodeBC1(block, texels, false); break;
+            case BlockFormat::BC3: bc::decodeBC1(block + 8, texels, true); bc::decodeBC4(block, texels, 3); break;
+            case BlockFormat::BC4: bc::decodeBC4(block, texels, 0); break;
+            case BlockFormat::BC5: bc::decodeBC4(block, texels, 0); bc::decodeBC4(block + 8, texels, 1); break;
+            case BlockFormat::BC7: bc::decodeBC7(block, texels); break;
+            }
+            for (int y = 0; y < 4 && by * 4 + y < height; y++)
+            {
+                for (int x = 0; x < 4 && bx * 4 + x < width; x++)
+                    memcpy(&rgba[((size_t)(by * 4 + y) * width + bx * 4 + x) * 4], texels[y * 4 + x], 4);
+            }
+        }
+    }
+    return rgba;
+}
+// 2x2 box filter to the next mip level
+// ----------------------------------------------------------------------------
+inline std::vector<uint8_t> downsampleRGBA(const uint8_t* rgba, int width, int height, int& outWidth, int& outHeight)
+{
+    outWidth = std::max(1, width / 2);
+    outHeight = std::max(1, height / 2);
+    std::vector<uint8_t> out((size_t)outWidth * outHeight * 4);
+    for (int y = 0; y < outHeight; y++)
+    {
+        int y0 = std::min(y * 2, height - 1);
+        int y1 = std::min(y * 2 + 1, height - 1);
+        for (int x = 0; x < outWidth; x++)
+        {
+            int x0 = std::min(x * 2, width - 1);
+            int x1 = std::min(x * 2 + 1, width - 1);
+            for (int c = 0; c < 4; c++)
+            {
+                int sum = rgba[((size_t)y0 * width + x0) * 4 + c] + rgba[((size_t)y0 * width + x1) * 4 + c] +
+                          rgba[((size_t)y1 * width + x0) * 4 + c] + rgba[((size_t)y1 * width + x1) * 4 + c];
+                out[((size_t)y * outWidth + x) * 4 + c] = (uint8_t)((sum + 2) / 4);
+            }
+        }
+    }
+    return out;
+}
+// PSNR in dB over the first `channels` channels of two RGBA8 images
+// ----------------------------------------------------------------------------
+inline double computePSNR(const uint8_t* a, const uint8_t* b, size_t pixelCount, int channels = 4)
+{
+    double sum = 0.0;
+    for (size_t i = 0; i < pixelCount; i++)
+    {
+        for (int c = 0; c < channels; c++)
+        {
+            double d = (double)a[i * 4 + c] - (double)b[i * 4 + c];
+            sum += d * d;
+        }
+    }
+    if (sum == 0.0)
+        return 99.0;
+    double mse = sum / ((double)pixelCount * channels);
+    return 10.0 * std::log10(255.0 * 255.0 / mse);
+}
+
+// Chooses a format from what the pixels contain: normal maps go to BC5, any
+// non opaque alpha to BC3 (or BC7), everything else to BC1 (or BC7).
+// ----------------------------------------------------------------------------
+inline BlockFormat selectBlockFormat(const uint8_t* rgba, int width, int height, TextureContent content = TextureContent::Auto, bool allowBC7 = false)
+{
+    size_t pixelCount = (size_t)width * height;
+    if (content == TextureContent::NormalMap)
+        return BlockFormat::BC5;
+
+    bool hasAlpha = false;
+    size_t unitLength = 0;
+    size_t samples = 0;
+    // every pixel for alpha, a sparse grid for the normal map guess
+    size_t step = std::max<size_t>(1, pixelCount / 4096);
+    for (size_t i = 0; i < pixelCount; i++)
+    {
+        const uint8_t* p = rgba + i * 4;
+        if (p[3] != 255)
+            hasAlpha = true;
+        if (content == TextureContent::Auto && i % step == 0)
+        {
+            float x = p[0] / 127.5f - 1.0f;
+            float y = p[1] / 127.5f - 1.0f;
+            float z = p[2] / 127.5f - 1.0f;
+            float length = x * x + y * y + z * z;
+            if (z > 0.0f && length > 0.8f && length < 1.2f)
+                unitLength++;
+            samples++;
+        }
+    }
+    // nearly all texels unit length and facing +z: a tangent space normal map
+    if (content == TextureContent::Auto && !hasAlpha && samples && unitLength * 100 >= samples * 95)
+        return BlockFormat::BC5;
+    if (hasAlpha)
+        return allowBC7 ? BlockFormat::BC7 : BlockFormat::BC3;
+    return allowBC7 ? BlockFormat::BC7 : BlockFormat::BC1;
+}
+
+// Builds the full mip chain down to 1x1 and encodes every level.
+// ----------------------------------------------------------------------------
+inline CompressedTexture bakeCompressedTexture(const uint8_t* rgba, int width, int height, BlockFormat format, ThreadPool* pool = nullptr)
+{
+    CompressedTexture texture;
+    texture.format = format;
+
+    std::vector<uint8_t> level(rgba, rgba + (size_t)width * height * 4);
+    for (;;)
+    {
+        CompressedLevel compressed;
+        compressed.width = width;
+        compressed.height = height;
+        compressed.data = compressImage(level.data(), width, height, format, pool);
+        texture.levels.push_back(std::move(compressed));
+        if (width == 1 && height == 1)
+            break;
+        int nextWidth, nextHeight;
+        level = downsampleRGBA(level.data(), width, height, nextWidth, nextHeight);
+        width = nextWidth;
+        height = nextHeight;
+    }
+    return texture;
+}
+
+// .bct file: "BCT1", format, level count, then per level width, height, byte count, blocks
+// ----------------------------------------------------------------------------
+inline bool saveCompressedTexture(const char* path, const CompressedTexture& texture)
+{
+    FILE* file = fopen(path, "wb");
+    if (!file)
+        return false;
+    uint32_t header[3] = { 0x31544342, (uint32_t)texture.format, (uint32_t)texture.levels.size() };
+    bool ok = fwrite(header, sizeof(header), 1, file) == 1;
+    for (const CompressedLevel& level : texture.levels)
+    {
+        uint32_t levelHeader[3] = { (uint32_t)level.width, (uint32_t)level.height, (uint32_t)level.data.size() };
+        ok = ok && fwrite(levelHeader, sizeof(levelHeader), 1, file) == 1;
+        ok = ok && fwrite(level.data.data(), level.data.size(), 1, file) == 1;
+    }
+    fclose(file);
+    return ok;
+}
+// parses a .bct file read into memory
+// ----------------------------------------------------------------------------
+inline bool parseCompressedTexture(const uint8_t* data, size_t size, CompressedTexture& texture)
+{
+    const uint8_t* end = data + size;
+    auto read = [&data, end](void* out, size_t bytes) {
+        if ((size_t)(end - data) < bytes)
+            return false;
+        memcpy(out, data, bytes);
+        data += bytes;
+        return true;
+    };
+    uint32_t header[3];
+    if (!read(header, sizeof(header)) || header[0] != 0x31544342 ||
+        header[1] > (uint32_t)BlockFormat::BC7 || header[2] > 32)
+        return false;
+
+    texture.format = (BlockFormat)header[1];
+    texture.levels.resize(header[2]);
+    for (CompressedLevel& level : texture.levels)
+    {
+        uint32_t levelHeader[3];
+        if (!read(levelHeader, sizeof(levelHeader)))
+            return false;
+        level.width = (int)levelHeader[0];
+        level.height = (int)levelHeader[1];
+        if (levelHeader[2] != compressedLevelSize(texture.format, level.width, level.height))
+            return false;
+        level.data.resize(levelHeader[2]);
+        if (!read(level.data.data(), level.data.size()))
+            return false;
+    }
+    return true;
+}
+// ----------------------------------------------------------------------------
+inline bool loadCompressedTexture(const char* path, CompressedTexture& texture)
+{
+    FILE* file = fopen(path, "rb");
+    if (!file)
+        return false;
+    std::vector<uint8_t> bytes;
+    if (fseek(file, 0, SEEK_END) == 0)
+    {
+        long size = ftell(file);
+        if (size > 0 && fseek(file, 0, SEEK_SET) == 0)
+        {
+            bytes.resize((size_t)size);
+            if (fread(bytes.data(), bytes.size(), 1, file) != 1)
+                bytes.clear();
+        }
+    }
+    fclose(file);
+    return !bytes.empty() && parseCompressedTexture(bytes.data(), bytes.size(), texture);
+}
+
+// what the current context can sample directly
+// ----------------------------------------------------------------------------
+struct BlockCompressionSupport
+{
+    bool s3tc = false; // BC1, BC3
+    bool rgtc = true;  // BC4, BC5, core since 3.0
+    bool bptc = false; // BC7, core since 4.2
+
+    static BlockCompressionSupport query()
+    {
+        BlockCompressionSupport support;
+        GLint major = 0, minor = 0;
+        glGetIntegerv(GL_MAJOR_VERSION, &major);
+        glGetIntegerv(GL_MINOR_VERSION, &minor);
+        support.bptc = major > 4 || (major == 4 && minor >= 2);
+
+        GLint count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        for (GLint i = 0; i < count; i++)
+        {
+            const char* name = (const char*)glGetStringi(GL_EXTENSIONS, i);
+            if (!strcmp(name, "GL_EXT_texture_compression_s3tc"))
+                support.s3tc = true;
+            else if (!strcmp(name, "GL_ARB_texture_compression_bptc"))
+                support.bptc = true;
+        }
+        return support;
+    }
+    bool supports(BlockFormat format) const
+    {
+        switch (format)
+        {
+        case BlockFormat::BC1:
+        case BlockFormat::BC3: return s3tc;
+        case BlockFormat::BC4:
+        case BlockFormat::BC5: return rgtc;
+        case BlockFormat::BC7: return bptc;
+        }
+        return false;
+    }
+};
+
+// Uploads every level with glCompressedTexImage2D and leaves the texture bound
+// to GL_TEXTURE_2D. Formats the driver lacks are decoded to RGBA8 instead.
+// ----------------------------------------------------------------------------
+inline GLuint uploadCompressedTexture(const CompressedTexture& texture, const BlockCompressionSupport& support)
+{
+    GLuint id;
+    GL_VERIFY(glGenTextures(1, &id));
+    GL_VERIFY(glBindTexture(GL_TEXTURE_2D, id));
+
+    bool native = support.supports(texture.format);
+    for (size_t i = 0; i < texture.levels.size(); i++)
+    {
+        const CompressedLevel& level = texture.levels[i];
+        if (native)
+        {
+            GL_VERIFY(glCompressedTexImage2D(
+                GL_TEXTURE_2D,
+                (GLint)i, // mipmap level
+                glCompressedFormat(texture.format),
+                level.width, level.height,
+                0, // reserved
+                (GLsizei)level.data.size(),
+                level.data.data()));
+        }
+        else
+        {
+            std::vector<uint8_t> rgba = decompressImage(level.data.data(), level.width, level.height, texture.format);
+            GL_VERIFY(glTexImage2D(GL_TEXTURE_2D, (GLint)i, GL_RGBA8, level.width, level.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgba.data()));
+        }
+    }
+    GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint)texture.levels.size() - 1));
+    return id;
+}
+
+#endif
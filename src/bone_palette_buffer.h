@@ -0,0 +1,81 @@
+#ifndef BONE_PALETTE_BUFFER_H
+#define BONE_PALETTE_BUFFER_H
+
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <algorithm>
+
+#include "gl_verify.h"
+
+// Skinning palettes of all characters in one texture buffer: three RGBA32F
+// texels per joint holding rows 0-2 of its skinning matrix, as written by
+// animateCharacters(). The skinned path of 3.3.shader.vs fetches them with
+// texelFetch at (paletteBase + gl_InstanceID * paletteStride + joint) * 3.
+//
+// A uniform block would cap a draw at 64 KB, about 1300 joints; a buffer
+// texture holds every character of a frame, so one instanced draw can skin
+// them all.
+class BonePaletteBuffer
+{
+public:
+    BonePaletteBuffer() {}
+    ~BonePaletteBuffer()
+    {
+        release();
+    }
+    BonePaletteBuffer(const BonePaletteBuffer&) = delete;
+    BonePaletteBuffer& operator=(const BonePaletteBuffer&) = delete;
+
+    // Replaces the contents with joints * 12 floats. The storage is orphaned
+    // first so the driver never waits for last frame's draws. The first
+    // call leaves GL_TEXTURE_BUFFER of the active unit unbound.
+    // ------------------------------------------------------------------------
+    void upload(const float* rows, uint32_t joints)
+    {
+        bool created = !m_buffer;
+        if (created)
+        {
+            GL_VERIFY(glGenBuffers(1, &m_buffer));
+            GL_VERIFY(glGenTextures(1, &m_texture));
+        }
+        m_capacity = std::max(m_capacity, std::max(joints, 64u));
+        GL_VERIFY(glBindBuffer(GL_TEXTURE_BUFFER, m_buffer));
+        GL_VERIFY(glBufferData(GL_TEXTURE_BUFFER, (GLsizeiptr)m_capacity * JOINT_BYTES, nullptr, GL_STREAM_DRAW));
+        GL_VERIFY(glBufferSubData(GL_TEXTURE_BUFFER, 0, (GLsizeiptr)joints * JOINT_BYTES, rows));
+        GL_VERIFY(glBindBuffer(GL_TEXTURE_BUFFER, 0));
+        if (created)
+        {
+            GL_VERIFY(glBindTexture(GL_TEXTURE_BUFFER, m_texture));
+            GL_VERIFY(glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, m_buffer));
+            GL_VERIFY(glBindTexture(GL_TEXTURE_BUFFER, 0));
+        }
+        m_joints = joints;
+    }
+
+    // bind to a unit as GL_TEXTURE_BUFFER, the samplerBuffer bonePalette
+    // ------------------------------------------------------------------------
+    GLuint texture() const { return m_texture; }
+    uint32_t joints() const { return m_joints; }
+
+    // ------------------------------------------------------------------------
+    void release()
+    {
+        if (m_texture)
+            GL_VERIFY(glDeleteTextures(1, &m_texture));
+        if (m_buffer)
+            GL_VERIFY(glDeleteBuffers(1, &m_buffer));
+        m_texture = m_buffer = 0;
+        m_capacity = m_joints = 0;
+    }
+
+private:
+    static const GLsizeiptr JOINT_BYTES = 12 * sizeof(float);
+
+    GLuint m_buffer = 0;
+    GLuint m_texture = 0;
+    uint32_t m_capacity = 0; // joints
+    uint32_t m_joints = 0;
+};
+
+#endif
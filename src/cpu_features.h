@@ -0,0 +1,92 @@
+#ifndef CPU_FEATURES_H
+#define CPU_FEATURES_H
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// SSE2 is part of every x64 target, so its kernels are chosen at compile
+// time: CPU_HAS_SSE2 guards them and the newer ones below, everything else
+// gets the scalar code.
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <immintrin.h>
+#define CPU_HAS_SSE2 1
+#endif
+
+// Instruction sets we dispatch on at run time. SSE2 is the x64 baseline and
+// always there; anything newer is compiled per function (TARGET_* below) and
+// only called after checking cpuFeatures().
+struct CpuFeatures
+{
+    bool ssse3 = false;
+    bool sse41 = false;
+    bool avx2 = false;
+    bool f16c = false;
+    bool fma = false;
+    bool avx512f = false;
+};
+
+// MSVC emits any intrinsic without flags, gcc and clang need the target spelled out
+#if defined(_MSC_VER) && !defined(__clang__)
+#define TARGET_SSSE3
+#define TARGET_SSE41
+#define TARGET_AVX2
+#define TARGET_AVX512
+#else
+#define TARGET_SSSE3 __attribute__((target("ssse3")))
+#define TARGET_SSE41 __attribute__((target("sse4.1")))
+#define TARGET_AVX2 __attribute__((target("avx2,fma,f16c")))
+#define TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl,avx2,fma,f16c")))
+#endif
+
+// ----------------------------------------------------------------------------
+inline CpuFeatures detectCpuFeatures()
+{
+    CpuFeatures features;
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int regs[4];
+    __cpuid(regs, 0);
+    int maxLeaf = regs[0];
+    __cpuid(regs, 1);
+    int ecx1 = regs[2];
+    int ebx7 = 0;
+    if (maxLeaf >= 7)
+    {
+        __cpuidex(regs, 7, 0);
+        ebx7 = regs[1];
+    }
+    // the OS has to save the ymm/zmm registers too
+    bool osxsave = (ecx1 & (1 << 27)) != 0;
+    unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+    bool osAvx = (xcr0 & 0x6) == 0x6;
+    bool osAvx512 = (xcr0 & 0xe6) == 0xe6;
+
+    features.ssse3 = (ecx1 & (1 << 9)) != 0;
+    features.sse41 = (ecx1 & (1 << 19)) != 0;
+    features.fma = osAvx && (ecx1 & (1 << 12)) != 0;
+    features.f16c = osAvx && (ecx1 & (1 << 29)) != 0;
+    features.avx2 = osAvx && (ebx7 & (1 << 5)) != 0;
+    // F, DQ, BW, VL: everything our kernels use
+    const int avx512Bits = (1 << 16) | (1 << 17) | (1 << 30) | (1 << 31);
+    features.avx512f = osAvx512 && (ebx7 & avx512Bits) == avx512Bits;
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    features.ssse3 = __builtin_cpu_supports("ssse3");
+    features.sse41 = __builtin_cpu_supports("sse4.1");
+    features.avx2 = __builtin_cpu_supports("avx2");
+    features.fma = __builtin_cpu_supports("fma");
+    features.f16c = features.avx2; // not queryable here, every AVX2 part has it
+    features.avx512f = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+                       __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl");
+#endif
+    return features;
+}
+// detected once
+// ----------------------------------------------------------------------------
+inline const CpuFeatures& cpuFeatures()
+{
+    static const CpuFeatures features = detectCpuFeatures();
+    return features;
+}
+
+#endif
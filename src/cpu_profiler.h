@@ -0,0 +1,586 @@
+#ifndef CPU_PROFILER_H
+#define CPU_PROFILER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <string>
+#include <ostream>
+#include <iomanip>
+#include <algorithm>
+#include <unordered_set>
+
+// PROFILE_ZONE compiles to nothing with CPU_PROFILER defined to 0
+#ifndef CPU_PROFILER
+#define CPU_PROFILER 1
+#endif
+
+// the clock CPU and GPU timelines share, steady_clock in nanoseconds
+// ----------------------------------------------------------------------------
+inline uint64_t profilerNanoseconds()
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// a quoted, escaped JSON string
+// ----------------------------------------------------------------------------
+inline void writeJsonString(std::ostream& out, const char* text)
+{
+    out << '"';
+    for (; *text; text++)
+    {
+        unsigned char c = (unsigned char)*text;
+        if (c == '"' || c == '\\')
+            out << '\\' << (char)c;
+        else if (c < 0x20)
+        {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out << escaped;
+        }
+        else
+            out << (char)c;
+    }
+    out << '"';
+}
+
+// one finished zone, on the profilerNanoseconds() clock
+struct ProfileEvent
+{
+    const char* name;
+    uint64_t begin;
+    uint64_t end;
+    uint32_t depth; // 0 is outermost on its thread
+};
+
+// the events of one thread, or of the GPU
+struct ProfileTrack
+{
+    const char* name;
+    std::vector<ProfileEvent> events; // sorted by begin once the capture is stopped
+};
+
+// Zones and frame boundaries recorded between CpuProfiler::startCapture()
+// and stopCapture(), or read back from a binary capture. Names point into
+// the capture's own string set, except those of ring events, which are the
+// string literals PROFILE_ZONE was given.
+//
+// The binary format is "CPRF", a version byte, then LEB128 varints: the
+// string table, frame starts as deltas, and per track its events sorted by
+// begin as (name, begin delta, duration, depth). That is about 8 bytes
+// per zone instead of the 32 in memory.
+class CpuCapture
+{
+public:
+    std::vector<uint64_t> frames; // start of each frame
+    std::vector<ProfileTrack> tracks;
+
+    CpuCapture() {}
+    CpuCapture(CpuCapture&&) = default;
+    CpuCapture& operator=(CpuCapture&&) = default;
+    CpuCapture(const CpuCapture&) = delete;
+    CpuCapture& operator=(const CpuCapture&) = delete;
+
+    // ------------------------------------------------------------------------
+    const char* intern(const char* name)
+    {
+        return m_strings.insert(name).first->c_str(); // node based, stays put
+    }
+    // the track with this name, added at the end if there is none
+    // ------------------------------------------------------------------------
+    uint32_t track(const char* name)
+    {
+        for (uint32_t i = 0; i < tracks.size(); i++)
+        {
+            if (strcmp(tracks[i].name, name) == 0)
+                return i;
+        }
+        ProfileTrack track;
+        track.name = intern(name);
+        tracks.push_back(track);
+        return (uint32_t)tracks.size() - 1;
+    }
+    size_t eventCount() const
+    {
+        size_t count = 0;
+        for (const ProfileTrack& track : tracks)
+            count += track.events.size();
+        return count;
+    }
+
+    // ------------------------------------------------------------------------
+    void sort()
+    {
+        for (ProfileTrack& track : tracks)
+        {
+            std::stable_sort(track.events.begin(), track.events.end(), [](const ProfileEvent& a, const ProfileEvent& b) {
+                return a.begin < b.begin || (a.begin == b.begin && a.depth < b.depth);
+            });
+        }
+    }
+
+    // Chrome trace event JSON (chrome://tracing, Perfetto). Frames become a
+    // track of their own, times are microseconds since the first frame.
+    // ------------------------------------------------------------------------
+    void writeChromeTrace(std::ostream& out) const
+    {
+        uint64_t origin = this->origin();
+        auto micros = [origin](uint64_t ns) { return (double)(int64_t)(ns - origin) / 1000.0; };
+        out << std::fixed << std::setprecision(3);
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        out << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"frames\"}}";
+        for (uint32_t i = 0; i < tracks.size(); i++)
+        {
+            out << ",\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << i + 1 << ",\"args\":{\"name\":";
+            writeJsonString(out, tracks[i].name);
+            out << "}}";
+        }
+        for (size_t f = 0; f + 1 < frames.size(); f++)
+        {
+            out << ",\n{\"ph\":\"X\",\"name\":\"frame " << f << "\",\"pid\":1,\"tid\":0,\"ts\":" << micros(frames[f])
+                << ",\"dur\":" << (double)(frames[f + 1] - frames[f]) / 1000.0 << "}";
+        }
+        for (uint32_t i = 0; i < tracks.size(); i++)
+        {
+            for (const ProfileEvent& event : tracks[i].events)
+            {
+                out << ",\n{\"ph\":\"X\",\"name\":";
+                writeJsonString(out, event.name);
+                out << ",\"pid\":1,\"tid\":" << i + 1 << ",\"ts\":" << micros(event.begin)
+                    << ",\"dur\":" << (double)(event.end - event.begin) / 1000.0 << "}";
+            }
+        }
+        out << "\n]}\n";
+    }
+
+    // ------------------------------------------------------------------------
+    void writeBinary(std::vector<uint8_t>& out) const
+    {
+        std::vector<const char*> names;
+        auto nameIndex = [&names](const char* name) {
+            for (size_t i = 0; i < names.size(); i++)
+            {
+                if (names[i] == name || strcmp(names[i], name) == 0)
+                    return (uint64_t)i;
+            }
+            names.push_back(name);
+            return (uint64_t)names.size() - 1;
+        };
+        std::vector<uint8_t> body;
+        writeVarint(body, frames.size());
+        uint64_t previous = 0;
+        for (uint64_t frame : frames)
+        {
+            writeVarint(body, frame - previous);
+            previous = frame;
+        }
+        writeVarint(body, tracks.size());
+        for (const ProfileTrack& track : tracks)
+        {
+            writeVarint(body, nameIndex(track.name));
+            writeVarint(body, track.events.size());
+            previous = 0;
+            for (const ProfileEvent& event : track.events)
+            {
+                writeVarint(body, nameIndex(event.name));
+                writeVarint(body, event.begin - previous); // sorted, never negative
+                writeVarint(body, event.end - event.begin);
+                writeVarint(body, event.depth);
+                previous = event.begin;
+            }
+        }
+
+        out.insert(out.end(), magic(), magic() + 4);
+        out.push_back(VERSION);
+        writeVarint(out, names.size());
+        for (const char* name : names)
+        {
+            size_t length = strlen(name);
+            writeVarint(out, length);
+            out.insert(out.end(), name, name + length);
+        }
+        out.insert(out.end(), body.begin(), body.end());
+    }
+    // replaces the contents, false on a truncated or foreign file
+    // ------------------------------------------------------------------------
+    bool readBinary(const uint8_t* data, size_t size)
+    {
+        frames.clear();
+        tracks.clear();
+        m_strings.clear();
+        const uint8_t* cursor = data;
+        const uint8_t* end = data + size;
+        if (size < 5 || memcmp(data, magic(), 4) != 0 || data[4] != VERSION)
+            return false;
+        cursor += 5;
+
+        uint64_t count = 0, value = 0;
+        std::vector<const char*> names;
+        if (!readVarint(cursor, end, count))
+            return false;
+        for (uint64_t i = 0; i < count; i++)
+        {
+            if (!readVarint(cursor, end, value) || (uint64_t)(end - cursor) < value)
+                return false;
+            names.push_back(m_strings.insert(std::string((const char*)cursor, (size_t)value)).first->c_str());
+            cursor += value;
+        }
+        auto readName = [&](const char*& name) {
+            uint64_t index;
+            if (!readVarint(cursor, end, index) || index >= names.size())
+                return false;
+            name = names[(size_t)index];
+            return true;
+        };
+
+        if (!readVarint(cursor, end, count) || count > (uint64_t)(end - cursor))
+            return false;
+        uint64_t time = 0;
+        for (uint64_t i = 0; i < count; i++)
+        {
+            if (!readVarint(cursor, end, value))
+                return false;
+            time += value;
+            frames.push_back(time);
+        }
+        if (!readVarint(cursor, end, count) || count > (uint64_t)(end - cursor))
+            return false;
+        tracks.resize((size_t)count);
+        for (ProfileTrack& track : tracks)
+        {
+            if (!readName(track.name) || !readVarint(cursor, end, count) || count > (uint64_t)(end - cursor) / 4)
+                return false;
+            track.events.resize((size_t)count);
+            time = 0;
+            for (ProfileEvent& event : track.events)
+            {
+                uint64_t duration, depth;
+                if (!readName(event.name) || !readVarint(cursor, end, value) || !readVarint(cursor, end, duration) ||
+                    !readVarint(cursor, end, depth))
+                    return false;
+                time += value;
+                event.begin = time;
+                event.end = time + duration;
+                event.depth = (uint32_t)depth;
+            }
+        }
+        return cursor == end;
+    }
+
+private:
+    enum : uint8_t { VERSION = 1 };
+
+    std::unordered_set<std::string> m_strings;
+
+    // ------------------------------------------------------------------------
+    static const uint8_t* magic()
+    {
+        static const uint8_t bytes[4] = { 'C', 'P', 'R', 'F' };
+        return bytes;
+    }
+    uint64_t origin() const
+    {
+        uint64_t origin = frames.empty() ? UINT64_MAX : frames.front();
+        for (const ProfileTrack& track : tracks)
+        {
+            if (!track.events.empty())
+                origin = std::min(origin, track.events.front().begin);
+        }
+        return origin == UINT64_MAX ? 0 : origin;
+    }
+    static void writeVarint(std::vector<uint8_t>& out, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back((uint8_t)(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back((uint8_t)value);
+    }
+    static bool readVarint(const uint8_t*& cursor, const uint8_t* end, uint64_t& value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            if (cursor == end)
+                return false;
+            uint8_t byte = *cursor++;
+            value |= (uint64_t)(byte & 0x7f) << shift;
+            if (!(byte & 0x80))
+                return true;
+        }
+        return false;
+    }
+};
+
+// Zones from any thread. Each thread writes finished zones into its own
+// ring, a single producer single consumer queue, so recording takes no lock
+// and never waits: a full ring drops the event and counts it. The frame
+// thread drains every ring in endFrame(), keeping the events while a
+// capture runs and discarding them otherwise.
+//
+// Recording is off until setEnabled(true); a disabled zone costs one
+// relaxed load. A thread gets its ring on its first enabled zone, and a
+// thread that exits hands its ring to the next new one, so pools that
+// come and go (asset loading workers) do not pile up rings.
+class CpuProfiler
+{
+public:
+    enum : uint32_t { RING_EVENTS = 4096 }; // per thread, a power of two
+
+    struct ThreadBuffer
+    {
+        ProfileEvent events[RING_EVENTS];
+        std::atomic<uint32_t> head{ 0 }; // written by the owning thread
+        std::atomic<uint32_t> tail{ 0 }; // written by the collector
+        std::atomic<uint64_t> dropped{ 0 };
+        std::atomic<bool> retired{ false };
+        uint32_t depth = 0;  // owning thread only
+        std::string name;    // under m_mutex
+        uint32_t track = 0;  // capture track, under m_mutex
+        uint64_t captureId = 0;
+
+        // ------------------------------------------------------------------------
+        void push(const ProfileEvent& event)
+        {
+            uint32_t h = head.load(std::memory_order_relaxed);
+            if (h - tail.load(std::memory_order_acquire) == RING_EVENTS)
+            {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            events[h & (RING_EVENTS - 1)] = event;
+            head.store(h + 1, std::memory_order_release);
+        }
+    };
+
+    CpuProfiler() {}
+    CpuProfiler(const CpuProfiler&) = delete;
+    CpuProfiler& operator=(const CpuProfiler&) = delete;
+
+    // ------------------------------------------------------------------------
+    void setEnabled(bool enabled) { m_enabled.store(enabled, std::memory_order_relaxed); }
+    bool enabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    // names the calling thread's track, cheap enough to call from every worker
+    // ------------------------------------------------------------------------
+    void setThreadName(const char* name)
+    {
+        ThreadSlot& slot = threadSlot();
+        snprintf(slot.name, sizeof(slot.name), "%s", name);
+        if (slot.buffer)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            slot.buffer->name = slot.name;
+        }
+    }
+    // the calling thread's ring, registered on first use
+    // ------------------------------------------------------------------------
+    ThreadBuffer* threadBuffer()
+    {
+        ThreadSlot& slot = threadSlot();
+        if (!slot.buffer)
+            slot.buffer = acquireBuffer(slot.name);
+        return slot.buffer;
+    }
+
+    // ------------------------------------------------------------------------
+    void startCapture()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_capture = CpuCapture();
+        m_capture.frames.push_back(profilerNanoseconds());
+        m_capturing = true;
+        m_captureId++;
+    }
+    // finishes the capture, events still in the rings are left out
+    // ------------------------------------------------------------------------
+    CpuCapture stopCapture()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_capturing = false;
+        m_capture.sort();
+        return std::move(m_capture);
+    }
+    bool capturing() const { return m_capturing; }
+
+    // marks the start of the next frame and drains every ring
+    // ------------------------------------------------------------------------
+    void endFrame()
+    {
+        uint64_t now = profilerNanoseconds();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const std::unique_ptr<ThreadBuffer>& buffer : m_buffers)
+            drain(*buffer);
+        if (m_capturing)
+            m_capture.frames.push_back(now);
+    }
+    // adds events recorded elsewhere, the GPU timeline, to the capture
+    // ------------------------------------------------------------------------
+    void addEvents(const char* track, const ProfileEvent* events, size_t count)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_capturing || count == 0)
+            return;
+        ProfileTrack& target = m_capture.tracks[m_capture.track(track)];
+        for (size_t i = 0; i < count; i++)
+        {
+            ProfileEvent event = events[i];
+            event.name = m_capture.intern(event.name);
+            target.events.push_back(event);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    uint64_t droppedEvents() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        uint64_t dropped = 0;
+        for (const std::unique_ptr<ThreadBuffer>& buffer : m_buffers)
+            dropped += buffer->dropped.load(std::memory_order_relaxed);
+        return dropped;
+    }
+    uint32_t threadCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return (uint32_t)m_buffers.size();
+    }
+
+private:
+    // the thread_local side; retires the ring when its thread exits
+    struct ThreadSlot
+    {
+        ThreadBuffer* buffer = nullptr;
+        char name[32] = "";
+
+        ~ThreadSlot()
+        {
+            if (buffer)
+                buffer->retired.store(true, std::memory_order_release);
+        }
+    };
+
+    std::atomic<bool> m_enabled{ false };
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+    CpuCapture m_capture;
+    bool m_capturing = false;
+    uint64_t m_captureId = 0;
+
+    // ------------------------------------------------------------------------
+    static ThreadSlot& threadSlot()
+    {
+        static thread_local ThreadSlot slot;
+        return slot;
+    }
+    // a drained ring of an exited thread, or a new one
+    // ------------------------------------------------------------------------
+    ThreadBuffer* acquireBuffer(const char* name)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ThreadBuffer* buffer = nullptr;
+        for (const std::unique_ptr<ThreadBuffer>& candidate : m_buffers)
+        {
+            if (candidate->retired.load(std::memory_order_acquire) &&
+                candidate->head.load(std::memory_order_relaxed) == candidate->tail.load(std::memory_order_relaxed))
+            {
+                buffer = candidate.get();
+                break;
+            }
+        }
+        if (!buffer)
+        {
+            m_buffers.emplace_back(new ThreadBuffer());
+            buffer = m_buffers.back().get();
+        }
+        buffer->retired.store(false, std::memory_order_relaxed);
+        buffer->depth = 0;
+        buffer->captureId = 0; // gets a track of its own
+        if (name[0])
+            buffer->name = name;
+        else
+        {
+            char unnamed[32];
+            snprintf(unnamed, sizeof(unnamed), "thread %u", (unsigned)m_buffers.size());
+            buffer->name = unnamed;
+        }
+        return buffer;
+    }
+    // the collector side of the ring, under m_mutex
+    // ------------------------------------------------------------------------
+    void drain(ThreadBuffer& buffer)
+    {
+        uint32_t tail = buffer.tail.load(std::memory_order_relaxed);
+        uint32_t head = buffer.head.load(std::memory_order_acquire);
+        if (tail == head)
+            return;
+        if (m_capturing)
+        {
+            if (buffer.captureId != m_captureId)
+            {
+                buffer.track = m_capture.track(buffer.name.c_str());
+                buffer.captureId = m_captureId;
+            }
+            std::vector<ProfileEvent>& events = m_capture.tracks[buffer.track].events;
+            for (uint32_t i = tail; i != head; i++)
+                events.push_back(buffer.events[i & (RING_EVENTS - 1)]);
+        }
+        buffer.tail.store(head, std::memory_order_release);
+    }
+};
+
+// ----------------------------------------------------------------------------
+inline CpuProfiler& cpuProfiler()
+{
+    static CpuProfiler profiler;
+    return profiler;
+}
+
+// Times the enclosing block on the calling thread. The name must outlive
+// the capture, a string literal.
+class CpuZone
+{
+public:
+    explicit CpuZone(const char* name)
+    {
+        CpuProfiler& profiler = cpuProfiler();
+        if (!profiler.enabled())
+            return;
+        m_buffer = profiler.threadBuffer();
+        m_name = name;
+        m_depth = m_buffer->depth++;
+        m_begin = profilerNanoseconds();
+    }
+    ~CpuZone()
+    {
+        if (!m_buffer)
+            return;
+        ProfileEvent event = { m_name, m_begin, profilerNanoseconds(), m_depth };
+        m_buffer->depth--;
+        m_buffer->push(event);
+    }
+    CpuZone(const CpuZone&) = delete;
+    CpuZone& operator=(const CpuZone&) = delete;
+
+private:
+    CpuProfiler::ThreadBuffer* m_buffer = nullptr;
+    const char* m_name = nullptr;
+    uint64_t m_begin = 0;
+    uint32_t m_depth = 0;
+};
+
+#if CPU_PROFILER
+#define PROFILE_CONCAT_INNER(A, B) A##B
+#define PROFILE_CONCAT(A, B) PROFILE_CONCAT_INNER(A, B)
+#define PROFILE_ZONE(NAME) CpuZone PROFILE_CONCAT(profileZone, __LINE__)(NAME)
+#else
+#define PROFILE_ZONE(NAME) do {} while (false)
+#endif
+
+#endif
@@ -0,0 +1,332 @@
+#ifndef DECODE_ARENA_H
+#define DECODE_ARENA_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+struct DecodeArenaStats
+{
+    uint64_t allocations = 0;
+    uint64_t reallocations = 0;
+    uint64_t inPlaceReallocations = 0; // grew the newest block without copying
+    uint64_t frees = 0;
+    uint64_t heapCalls = 0;            // malloc/realloc/free that reached the C heap
+    uint64_t bytesRequested = 0;
+    uint64_t peakBytes = 0;            // highest arena fill between two resets
+    uint64_t resets = 0;
+    uint64_t leakedAtReset = 0;        // blocks still live when the arena was rewound
+};
+
+// Bump allocator behind STBI_MALLOC/STBI_REALLOC/STBI_FREE, one per thread.
+//
+// Decoding an image makes a handful of short lived allocations, the output
+// buffer being the only one that leaves stb_image. Inside a DecodeArenaScope
+// they all come from this thread's arena; freeing only rewinds when it hits
+// the newest block, and the whole arena is rewound when the outermost scope
+// ends. After a few images the arena has one chunk as big as the largest
+// decode and stops touching the heap. Outside a scope everything goes to
+// malloc as before, so nothing returned by stbi_load may outlive the scope
+// it was decoded in.
+class DecodeArena
+{
+public:
+    static const size_t MIN_CHUNK_BYTES = 1024 * 1024;
+
+    static DecodeArena& local()
+    {
+        static thread_local DecodeArena arena;
+        return arena;
+    }
+    ~DecodeArena()
+    {
+        releaseMemory();
+    }
+    DecodeArena(const DecodeArena&) = delete;
+    DecodeArena& operator=(const DecodeArena&) = delete;
+
+    // ------------------------------------------------------------------------
+    void* allocate(size_t size)
+    {
+        m_stats.allocations++;
+        m_stats.bytesRequested += size;
+        if (m_depth == 0)
+            return heapAllocate(size);
+
+        size_t blockBytes = sizeof(Header) + alignUp(size);
+        if (m_chunks.empty() || m_chunks.back().used + blockBytes > m_chunks.back().capacity)
+        {
+            if (!addChunk(blockBytes))
+                return nullptr;
+        }
+
+        Chunk& chunk = m_chunks.back();
+        Header* header = (Header*)(chunk.memory + chunk.used);
+        header->size = size;
+        header->arena = this;
+        chunk.used += blockBytes;
+        m_fill += blockBytes;
+        m_stats.peakBytes = std::max<uint64_t>(m_stats.peakBytes, m_fill);
+        m_newest = header;
+        m_live++;
+        return header + 1;
+    }
+    // ------------------------------------------------------------------------
+    void* reallocate(void* pointer, size_t size)
+    {
+        if (!pointer)
+            return allocate(size);
+        m_stats.reallocations++;
+        Header* header = (Header*)pointer - 1;
+        if (!header->arena)
+        {
+            m_stats.heapCalls++;
+            header = (Header*)realloc(header, sizeof(Header) + size);
+            if (!header)
+                return nullptr;
+            header->size = size;
+            return header + 1;
+        }
+
+        // the newest block can simply grow into the rest of its chunk
+        if (header == m_newest)
+        {
+            Chunk& chunk = m_chunks.back();
+            size_t oldBytes = alignUp(header->size);
+            size_t newBytes = alignUp(size);
+            if (chunk.used - oldBytes + newBytes <= chunk.capacity)
+            {
+                m_stats.inPlaceReallocations++;
+                chunk.used = chunk.used - oldBytes + newBytes;
+                m_fill = m_fill - oldBytes + newBytes;
+                m_stats.peakBytes = std::max<uint64_t>(m_stats.peakBytes, m_fill);
+                header->size = size;
+                return pointer;
+            }
+        }
+        size_t oldSize = header->size;
+        void* moved = allocate(size);
+        m_stats.allocations--; // counted as a reallocation
+        if (!moved)
+            return nullptr; // the old block stays valid, like realloc
+        memcpy(moved, pointer, std::min(oldSize, size));
+        release(header);
+        return moved;
+    }
+    // ------------------------------------------------------------------------
+    void free(void* pointer)
+    {
+        if (!pointer)
+            return;
+        m_stats.frees++;
+        Header* header = (Header*)pointer - 1;
+        if (!header->arena)
+        {
+            m_stats.heapCalls++;
+            ::free(header);
+            return;
+        }
+        release(header);
+    }
+
+    // rewinds the arena, keeping one chunk big enough for what it held
+    // ------------------------------------------------------------------------
+    void reset()
+    {
+        m_stats.resets++;
+        uint64_t foreignFrees = m_foreignFrees.exchange(0, std::memory_order_relaxed);
+        m_stats.leakedAtReset += m_live > foreignFrees ? m_live - foreignFrees : 0;
+        if (m_chunks.size() > 1)
+        {
+            size_t capacity = 0;
+            for (const Chunk& chunk : m_chunks)
+                capacity += chunk.capacity;
+            releaseMemory();
+            addChunk(capacity); // on failure the next allocate() tries again
+        }
+        if (!m_chunks.empty())
+            m_chunks.back().used = 0;
+        m_fill = 0;
+        m_live = 0;
+        m_newest = nullptr;
+        publish();
+    }
+    // hands the chunks back to the heap
+    // ------------------------------------------------------------------------
+    void releaseMemory()
+    {
+        for (Chunk& chunk : m_chunks)
+        {
+            m_stats.heapCalls++;
+            ::free(chunk.memory);
+        }
+        m_chunks.clear();
+        m_fill = 0;
+        m_newest = nullptr;
+    }
+
+    void enter() { m_depth++; }
+    void leave()
+    {
+        if (--m_depth == 0)
+            reset();
+    }
+    bool active() const { return m_depth > 0; }
+
+    // this thread only
+    const DecodeArenaStats& stats() const { return m_stats; }
+    void resetStats()
+    {
+        publish();
+        m_stats = DecodeArenaStats();
+        m_published = DecodeArenaStats();
+    }
+    // all threads, as of each thread's last reset
+    // ------------------------------------------------------------------------
+    static DecodeArenaStats totals()
+    {
+        DecodeArenaStats stats;
+        stats.allocations = counter(0);
+        stats.reallocations = counter(1);
+        stats.inPlaceReallocations = counter(2);
+        stats.frees = counter(3);
+        stats.heapCalls = counter(4);
+        stats.bytesRequested = counter(5);
+        stats.resets = counter(6);
+        stats.leakedAtReset = counter(7);
+        return stats;
+    }
+
+private:
+    // keeps the blocks 16 byte aligned like malloc does
+    struct alignas(16) Header
+    {
+        uint64_t size;
+        DecodeArena* arena; // the one that allocated it, nullptr for a heap block
+    };
+    struct Chunk
+    {
+        uint8_t* memory;
+        size_t capacity;
+        size_t used;
+    };
+
+    std::vector<Chunk> m_chunks; // blocks come from the last one
+    Header* m_newest = nullptr;
+    size_t m_fill = 0;
+    uint64_t m_live = 0;
+    std::atomic<uint64_t> m_foreignFrees{ 0 }; // our blocks freed on other threads, taken off m_live at reset
+    int m_depth = 0;
+    DecodeArenaStats m_stats;
+    DecodeArenaStats m_published; // part of m_stats already added to the totals
+
+    DecodeArena() {}
+
+    // ------------------------------------------------------------------------
+    static size_t alignUp(size_t size)
+    {
+        return (size + 15) & ~(size_t)15;
+    }
+    // ------------------------------------------------------------------------
+    void* heapAllocate(size_t size)
+    {
+        m_stats.heapCalls++;
+        Header* header = (Header*)malloc(sizeof(Header) + size);
+        if (!header)
+            return nullptr;
+        header->size = size;
+        header->arena = nullptr;
+        return header + 1;
+    }
+    // false when the heap is out of memory, nothing changes then
+    // ------------------------------------------------------------------------
+    bool addChunk(size_t minBytes)
+    {
+        Chunk chunk;
+        chunk.capacity = std::max(minBytes, MIN_CHUNK_BYTES);
+        if (!m_chunks.empty())
+            chunk.capacity = std::max(chunk.capacity, m_chunks.back().capacity * 2);
+        chunk.memory = (uint8_t*)malloc(chunk.capacity);
+        m_stats.heapCalls++;
+        if (!chunk.memory)
+            return false;
+        chunk.used = 0;
+        m_chunks.push_back(chunk);
+        return true;
+    }
+    // only the newest block gives its bytes back before the reset, and only
+    // on the thread that allocated it; a block of another thread's arena is
+    // counted there
+    // ------------------------------------------------------------------------
+    void release(Header* header)
+    {
+        if (header->arena != this)
+        {
+            header->arena->m_foreignFrees.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        if (header != m_newest)
+        {
+            if (m_live > 0)
+                m_live--;
+            return;
+        }
+        size_t bytes = sizeof(Header) + alignUp(header->size);
+        m_chunks.back().used -= bytes;
+        m_fill -= bytes;
+        m_newest = nullptr;
+        m_live--;
+    }
+
+    // ------------------------------------------------------------------------
+    static std::atomic<uint64_t>& counterSlot(int index)
+    {
+        static std::atomic<uint64_t> counters[8];
+        return counters[index];
+    }
+    static uint64_t counter(int index)
+    {
+        return counterSlot(index).load(std::memory_order_relaxed);
+    }
+    // adds what changed since the last publish to the process wide totals
+    void publish()
+    {
+        const uint64_t now[8] = { m_stats.allocations, m_stats.reallocations, m_stats.inPlaceReallocations, m_stats.frees,
+                                  m_stats.heapCalls, m_stats.bytesRequested, m_stats.resets, m_stats.leakedAtReset };
+        const uint64_t before[8] = { m_published.allocations, m_published.reallocations, m_published.inPlaceReallocations, m_published.frees,
+                                     m_published.heapCalls, m_published.bytesRequested, m_published.resets, m_published.leakedAtReset };
+        for (int i = 0; i < 8; i++)
+            counterSlot(i).fetch_add(now[i] - before[i], std::memory_order_relaxed);
+        m_published = m_stats;
+    }
+};
+
+// Decodes on this thread use the arena while one of these is alive
+class DecodeArenaScope
+{
+public:
+    DecodeArenaScope() { DecodeArena::local().enter(); }
+    ~DecodeArenaScope() { DecodeArena::local().leave(); }
+    DecodeArenaScope(const DecodeArenaScope&) = delete;
+    DecodeArenaScope& operator=(const DecodeArenaScope&) = delete;
+};
+
+// what stb_image.cpp plugs into STBI_MALLOC and friends
+// ----------------------------------------------------------------------------
+inline void* decodeArenaMalloc(size_t size)
+{
+    return DecodeArena::local().allocate(size);
+}
+inline void* decodeArenaRealloc(void* pointer, size_t size)
+{
+    return DecodeArena::local().reallocate(pointer, size);
+}
+inline void decodeArenaFree(void* pointer)
+{
+    DecodeArena::local().free(pointer);
+}
+
+#endif
@@ -0,0 +1,318 @@
+#ifndef DEMO_SCENE_H
+#define DEMO_SCENE_H
+
+#include <glad/glad.h>
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "gl_verify.h"
+#include "shader.h"
+#include "thread_pool.h"
+#include "geometry_arena.h"
+#include "block_compression.h"
+#include "texture_upload.h"
+#include "texture_streamer.h"
+#include "texture_cache.h"
+#include "progressive_streamer.h"
+#include "gl_state_cache.h"
+#include "sampler_cache.h"
+#include "math3d.h"
+#include "transform_hierarchy.h"
+#include "instance_buffer.h"
+#include "skeletal_animation.h"
+#include "bone_palette_buffer.h"
+#include "gpu_profiler.h"
+#include "cpu_profiler.h"
+
+// A ribbon standing on a chain of joints with a looping wave clip, the
+// stand-in for a skinned character until we load real ones
+// ----------------------------------------------------------------------------
+inline GeometryHandle buildRibbon(GeometryArena& geometry, Skeleton& skeleton, AnimationClip& wave)
+{
+    const int JOINTS = 6;
+    const int SEGMENTS = 12;
+    const float HEIGHT = 0.9f;
+    const float SPACING = HEIGHT / (JOINTS - 1);
+
+    skeleton.parents.resize(JOINTS);
+    skeleton.inverseBindPose.resize(JOINTS);
+    for (int j = 0; j < JOINTS; j++)
+    {
+        skeleton.parents[j] = (int16_t)(j - 1);
+        skeleton.inverseBindPose[j] = translation(Vec3(0.0f, -SPACING * j, 0.0f));
+    }
+
+    wave.frameRate = 30.0f;
+    wave.resize(JOINTS, 31);
+    for (uint32_t f = 0; f < wave.frameCount; f++)
+    {
+        float phase = 6.2831853f * f / (wave.frameCount - 1);
+        for (int j = 0; j < JOINTS; j++)
+        {
+            size_t key = (size_t)f * JOINTS + j;
+            wave.translations[key] = Vec4(0.0f, j ? SPACING : 0.0f, 0.0f, 0.0f);
+            wave.rotations[key] = quatFromAxisAngle(Vec3(0.0f, 0.0f, 1.0f), j ? 0.35f * std::sin(phase + 0.6f * j) : 0.0f);
+        }
+    }
+
+    struct SkinnedVertex
+    {
+        float position[3];
+        float color[3];
+        float texCoord[2];
+        uint8_t joints[4];
+        uint8_t weights[4];
+    };
+    std::vector<SkinnedVertex> vertices;
+    std::vector<GLuint> indices;
+    for (int s = 0; s <= SEGMENTS; s++)
+    {
+        float v = (float)s / SEGMENTS;
+        // linear between the two joints around this height
+        float joint = v * (JOINTS - 1);
+        int lower = std::min((int)joint, JOINTS - 2);
+        uint8_t upperWeight = (uint8_t)std::lround((joint - lower) * 255.0f);
+        for (int side = 0; side < 2; side++)
+        {
+            SkinnedVertex vertex = {
+                { side ? 0.1f : -0.1f, v * HEIGHT, 0.0f },
+                { 1.0f, 1.0f, 1.0f },
+                { (float)side, v },
+                { (uint8_t)lower, (uint8_t)(lower + 1), 0, 0 },
+                { (uint8_t)(255 - upperWeight), upperWeight, 0, 0 },
+            };
+            vertices.push_back(vertex);
+        }
+        if (s < SEGMENTS)
+        {
+            GLuint base = (GLuint)s * 2;
+            GLuint quad[] = { base, base + 1, base + 3, base, base + 3, base + 2 };
+            indices.insert(indices.end(), quad, quad + 6);
+        }
+    }
+
+    VertexLayout layout;
+    layout.stride = sizeof(SkinnedVertex);
+    layout.attributes = {
+        { 0, 3, GL_FLOAT, GL_FALSE, 0 },
+        { 1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float) },
+        { 2, 2, GL_FLOAT, GL_FALSE, 6 * sizeof(float) },
+        // joint indices as plain numbers, weights as 0..1
+        { 7, 4, GL_UNSIGNED_BYTE, GL_FALSE, 8 * sizeof(float) },
+        { 8, 4, GL_UNSIGNED_BYTE, GL_TRUE, 8 * sizeof(float) + 4 },
+    };
+    GeometryHandle ribbon = geometry.allocate(geometry.registerLayout(layout), (uint32_t)vertices.size(), (uint32_t)indices.size());
+    geometry.upload(ribbon, vertices.data(), indices.data());
+    return ribbon;
+}
+
+// The scene the app shows: two textured quads, one circling the other, and
+// the skinned ribbon, with the textures streamed in over the first frames.
+// Kept apart from the window so tools/gl_benchmark can run it headless.
+// The shaders and images are loaded from the working directory.
+class DemoScene
+{
+public:
+    DemoScene(ThreadPool& workers, const BlockCompressionSupport& compression, const TextureStorageSupport& storage)
+        : m_workers(workers)
+        , m_streamer(workers)
+        , m_geometry(m_glState)
+        , m_shader("3.3.shader.vs", "3.3.shader.fs") // you can name your shader files however you like
+        , m_skinnedShader("3.3.shader.vs", "3.3.shader.fs", "#define SKINNING\n")
+        , m_progressive(workers, compression) // baked mip chains come in smallest level first, sharpening over a few frames
+        , m_textures(m_streamer, workers, compression, &m_progressive) // one texture per file however often it is asked for, baked .bct and .sct files win
+    {
+        // decodes images on workers, uploads them through PBOs a few rows per frame
+        m_streamer.setTextureStorage(storage);
+        // wrapping/filtering lives in shared sampler objects, not in each texture
+        m_linearRepeat = m_samplers.get(SamplerDesc::linear(GL_REPEAT));
+
+        float vertices[] = {
+            // positions          // colors           // texture coords
+             0.5f,  0.5f, 0.0f,   1.0f, 0.0f, 0.0f,   1.0f, 1.0f,   // top right
+             0.5f, -0.5f, 0.0f,   0.0f, 1.0f, 0.0f,   1.0f, 0.0f,   // bottom right
+            -0.5f, -0.5f, 0.0f,   0.0f, 0.0f, 1.0f,   0.0f, 0.0f,   // bottom left
+            -0.5f,  0.5f, 0.0f,   1.0f, 1.0f, 0.0f,   0.0f, 1.0f    // top left
+        };
+        const int ELEMENT_COUNT = 8;
+        unsigned int indices[] = {
+            0, 1, 3, // first triangle
+            1, 2, 3  // second triangle
+        };
+
+        // the quad lives in the shared geometry arena, one VAO per vertex layout
+        VertexLayout quadLayout;
+        quadLayout.stride = ELEMENT_COUNT * sizeof(float); // byte count of 1 vertex
+        quadLayout.attributes = {
+            // location in shader, x/y/z, type, normalize, offset
+            { 0, 3, GL_FLOAT, GL_FALSE, 0 },
+            // color attribute
+            { 1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float) },
+            // texture coords
+            { 2, 2, GL_FLOAT, GL_FALSE, 6 * sizeof(float) },
+        };
+        uint32_t layoutId = m_geometry.registerLayout(quadLayout);
+        m_quad = m_geometry.allocate(layoutId, sizeof(vertices) / sizeof(float) / ELEMENT_COUNT, sizeof(indices) / sizeof(indices[0]));
+        m_geometry.upload(m_quad, vertices, indices);
+
+        // every scene node is one quad instance: a big one in the bottom right
+        // corner and a small one circling it
+        m_pivot = m_scene.create();
+        m_scene.setTranslation(m_pivot, Vec3(0.5f, -0.5f, 0.0f));
+        m_moon = m_scene.create(m_pivot);
+        m_scene.setLocal(m_moon, Vec3(0.6f, 0.0f, 0.0f), Quat(), Vec3(0.3f));
+        m_instances.attach(m_glState, m_geometry.vertexArray(m_quad)); // world matrices at locations 3-6
+
+        // the skinned ribbon on the left, animated on the workers and drawn with
+        // the SKINNING variant of the shader
+        m_ribbon = buildRibbon(m_geometry, m_ribbonSkeleton, m_ribbonWave);
+        m_ribbonInstances.attach(m_glState, m_geometry.vertexArray(m_ribbon));
+        Mat4 ribbonModel = translation(Vec3(-0.6f, -0.6f, 0.0f));
+        m_ribbonInstances.upload(&ribbonModel, 0, 1);
+        m_ribbonAnimation.clips[0] = &m_ribbonWave;
+        m_ribbonPalette.resize(paletteFloats(m_ribbonSkeleton));
+
+        m_texture1 = m_textures.acquire("container.jpg");
+        m_texture2 = m_textures.acquire("awesomeface.png", true);
+        m_acquired = true;
+
+        m_shader.use(); // don't forget to activate the shader before setting uniforms!
+        glUniform1i(glGetUniformLocation(m_shader.ID, "texture1"), 0); // set it manually
+        glUniform1i(glGetUniformLocation(m_shader.ID, "texture2"), 1); // set it manually
+        m_skinnedShader.use();
+        m_skinnedShader.setInt("texture1", 0);
+        m_skinnedShader.setInt("texture2", 1);
+        m_skinnedShader.setInt("bonePalette", 2);
+        m_skinnedShader.setInt("paletteBase", 0);
+        m_skinnedShader.setInt("paletteStride", (int)m_ribbonSkeleton.jointCount());
+        m_skinnedShader.setMat4("transform", Mat4::identity());
+    }
+    ~DemoScene()
+    {
+        release();
+    }
+    DemoScene(const DemoScene&) = delete;
+    DemoScene& operator=(const DemoScene&) = delete;
+
+    // the loaders' share of a frame, for a framebuffer of width x height
+    // ------------------------------------------------------------------------
+    void updateTextures(GpuProfiler& gpu, int width, int height)
+    {
+        // the loaders bind textures while they work
+        bool loading = !m_textures.idle() || !m_streamer.idle();
+        {
+            PROFILE_ZONE("texture uploads");
+            GpuScope scope(gpu, "texture uploads");
+            m_textures.update();
+            m_streamer.update();
+            // the quad covers half the window, finer levels would never be sampled
+            float quadPixels = 0.5f * (float)std::max(width, height);
+            m_progressive.setScreenSize(m_textures.texture(m_texture1), quadPixels);
+            m_progressive.setScreenSize(m_textures.texture(m_texture2), quadPixels);
+            loading = loading || !m_progressive.idle();
+            m_progressive.update();
+        }
+        if (loading)
+            m_glState.invalidateTextures();
+    }
+
+    // animates to `time` seconds and draws into the bound framebuffer
+    // ------------------------------------------------------------------------
+    void draw(GpuProfiler& gpu, float time)
+    {
+        m_glState.useProgram(m_shader.ID);
+
+        // only the changed nodes get new world matrices and get uploaded
+        {
+            PROFILE_ZONE("scene update");
+            m_scene.setRotation(m_pivot, quatFromAxisAngle(Vec3(0.0f, 0.0f, 1.0f), time));
+            m_scene.setRotation(m_moon, quatFromAxisAngle(Vec3(0.0f, 0.0f, 1.0f), -2.0f * time));
+            m_scene.update(&m_workers);
+            m_instances.update(m_scene);
+        }
+        m_shader.setMat4("transform", Mat4::identity()); // no camera yet
+
+        m_glState.bindTexture(0, GL_TEXTURE_2D, m_textures.texture(m_texture1));
+        m_glState.bindSampler(0, m_linearRepeat);
+        m_glState.bindTexture(1, GL_TEXTURE_2D, m_textures.texture(m_texture2));
+        m_glState.bindSampler(1, m_linearRepeat);
+
+        // binds the page VAO only when it changes, then glDrawElementsInstancedBaseVertex,
+        // one instance per scene node
+        {
+            PROFILE_ZONE("draw quads");
+            GpuScope scope(gpu, "quads");
+            m_geometry.drawInstanced(m_quad, (GLsizei)m_instances.count());
+        }
+
+        m_ribbonAnimation.times[0] = time;
+        {
+            PROFILE_ZONE("animate");
+            animateCharacters(m_ribbonSkeleton, &m_ribbonAnimation, 1, m_ribbonPalette.data(), &m_workers);
+        }
+        {
+            PROFILE_ZONE("draw ribbon");
+            GpuScope scope(gpu, "ribbon");
+            m_bonePalettes.upload(m_ribbonPalette.data(), m_ribbonSkeleton.jointCount());
+            m_glState.useProgram(m_skinnedShader.ID);
+            m_glState.bindTexture(2, GL_TEXTURE_BUFFER, m_bonePalettes.texture());
+            m_geometry.drawInstanced(m_ribbon, 1);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    bool loading() const { return !m_textures.idle() || !m_streamer.idle() || !m_progressive.idle(); }
+    const TextureStreamer& streamer() const { return m_streamer; }
+    // for overlays drawn after the scene, so they share its binding shadow
+    GLStateCache& glState() { return m_glState; }
+
+    // ------------------------------------------------------------------------
+    void release()
+    {
+        if (m_acquired)
+        {
+            m_textures.release(m_texture1);
+            m_textures.release(m_texture2);
+            m_acquired = false;
+        }
+        m_streamer.release();
+        m_progressive.release();
+        m_textures.release();
+        m_samplers.release();
+        m_instances.release();
+        m_ribbonInstances.release();
+        m_bonePalettes.release();
+        m_geometry.release();
+    }
+
+private:
+    ThreadPool& m_workers;
+    TextureStreamer m_streamer;
+    GLStateCache m_glState;
+    SamplerCache m_samplers;
+    GLuint m_linearRepeat = 0;
+    GeometryArena m_geometry;
+    GeometryHandle m_quad;
+    TransformHierarchy m_scene;
+    TransformNode m_pivot;
+    TransformNode m_moon;
+    InstanceBuffer m_instances;
+    Skeleton m_ribbonSkeleton;
+    AnimationClip m_ribbonWave;
+    GeometryHandle m_ribbon;
+    InstanceBuffer m_ribbonInstances;
+    AnimatedCharacter m_ribbonAnimation;
+    std::vector<float> m_ribbonPalette;
+    BonePaletteBuffer m_bonePalettes;
+    Shader m_shader;
+    Shader m_skinnedShader;
+    ProgressiveTextureStreamer m_progressive;
+    TextureCache m_textures;
+    TextureHandle m_texture1;
+    TextureHandle m_texture2;
+    bool m_acquired = false;
+};
+
+#endif
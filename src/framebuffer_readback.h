@@ -0,0 +1,498 @@
+#ifndef FRAMEBUFFER_READBACK_H
+#define FRAMEBUFFER_READBACK_H
+
+#include <glad/glad.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "../stb/stb_image.h"
+
+#include "gl_verify.h"
+#include "thread_pool.h"
+#include "png_writer.h"
+
+// one frame read back: RGBA8, rows bottom to top as glReadPixels returns them
+struct ReadbackFrame
+{
+    uint64_t frame = 0; // as passed to capture()
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> pixels;
+};
+typedef std::shared_ptr<const ReadbackFrame> ReadbackFramePtr;
+
+// Called on the GL thread from update(). Sinks that do real work per frame
+// hand the frame to a worker; it stays alive as long as they hold it.
+typedef std::function<void(const ReadbackFramePtr&)> ReadbackSink;
+
+// totals since construction, mapMilliseconds for the last update()
+struct ReadbackStats
+{
+    uint64_t captured = 0;
+    uint64_t delivered = 0;
+    uint64_t dropped = 0;       // capture() found every buffer still in flight
+    double mapMilliseconds = 0; // GL thread time in map, copy and unmap
+};
+
+// Reads frames back without stalling the pipeline.
+//
+// capture() issues glReadPixels into the next free pixel buffer object of a
+// ring and fences it, which returns as soon as the copy is queued. update(),
+// once per frame, maps the buffers that are at least `latency` updates old
+// and whose fence has signalled, copies the pixels out and hands them to the
+// sinks in capture order. A buffer whose fence has not signalled yet waits
+// for the next update; if the whole ring is in flight capture() drops the
+// frame instead of waiting. flush() blocks for everything in flight, for
+// shutdown and tests.
+class FramebufferReadback
+{
+public:
+    explicit FramebufferReadback(unsigned ringSize = 4, unsigned latency = 2)
+        : m_slots(std::max(ringSize, 1u)), m_latency(latency)
+    {
+    }
+    ~FramebufferReadback()
+    {
+        release();
+    }
+    FramebufferReadback(const FramebufferReadback&) = delete;
+    FramebufferReadback& operator=(const FramebufferReadback&) = delete;
+
+    void addSink(ReadbackSink sink) { m_sinks.push_back(std::move(sink)); }
+
+    // Queues a copy of a rectangle of framebuffer's color buffer (its read
+    // buffer, GL_BACK for the window). The read framebuffer binding is
+    // restored, the pack buffer binding is left at 0.
+    // ------------------------------------------------------------------------
+    bool capture(uint64_t frame, GLuint framebuffer, int x, int y, int width, int height)
+    {
+        Slot* slot = nullptr;
+        for (size_t i = 0; i < m_slots.size() && !slot; i++)
+        {
+            Slot& candidate = m_slots[(m_next + i) % m_slots.size()];
+            if (!candidate.fence)
+            {
+                slot = &candidate;
+                m_next = (m_next + i + 1) % m_slots.size();
+            }
+        }
+        if (!slot || width <= 0 || height <= 0)
+        {
+            m_stats.dropped++;
+            return false;
+        }
+
+        size_t bytes = (size_t)width * height * 4;
+        if (!slot->buffer)
+            GL_VERIFY(glGenBuffers(1, &slot->buffer));
+        GL_VERIFY(glBindBuffer(GL_PIXEL_PACK_BUFFER, slot->buffer));
+        if (slot->capacity < bytes)
+        {
+            GL_VERIFY(glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)bytes, nullptr, GL_STREAM_READ));
+            slot->capacity = bytes;
+        }
+        GLint previous = 0;
+        GL_VERIFY(glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previous));
+        GL_VERIFY(glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer));
+        GL_VERIFY(glReadPixels(x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+        GL_VERIFY(glBindFramebuffer(GL_READ_FRAMEBUFFER, (GLuint)previous));
+        GL_VERIFY(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+        slot->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        slot->frame = frame;
+        slot->width = width;
+        slot->height = height;
+        slot->issuedAt = m_updates;
+        slot->sequence = m_sequence++;
+        m_stats.captured++;
+        return true;
+    }
+    // GL thread, once per frame
+    // ------------------------------------------------------------------------
+    void update()
+    {
+        m_updates++;
+        m_stats.mapMilliseconds = 0;
+        deliver(false);
+    }
+    // waits for every capture in flight and delivers it
+    // ------------------------------------------------------------------------
+    void flush()
+    {
+        deliver(true);
+    }
+
+    // ------------------------------------------------------------------------
+    const ReadbackStats& stats() const { return m_stats; }
+    bool idle() const
+    {
+        return std::none_of(m_slots.begin(), m_slots.end(), [](const Slot& slot) { return slot.fence != 0; });
+    }
+
+    // drops the frames in flight, the sinks stay
+    // ------------------------------------------------------------------------
+    void release()
+    {
+        for (Slot& slot : m_slots)
+        {
+            if (slot.fence)
+                GL_VERIFY(glDeleteSync(slot.fence));
+            if (slot.buffer)
+                GL_VERIFY(glDeleteBuffers(1, &slot.buffer));
+            slot = Slot();
+        }
+    }
+
+private:
+    struct Slot
+    {
+        GLuint buffer = 0;
+        size_t capacity = 0;
+        GLsync fence = 0; // set while a capture is in flight
+        uint64_t frame = 0;
+        uint64_t issuedAt = 0;
+        uint64_t sequence = 0;
+        int width = 0;
+        int height = 0;
+    };
+
+    std::vector<Slot> m_slots;
+    std::vector<ReadbackSink> m_sinks;
+    ReadbackStats m_stats;
+    unsigned m_latency;
+    size_t m_next = 0;
+    uint64_t m_updates = 0;
+    uint64_t m_sequence = 0;
+
+    // oldest first, stopping at the first one that is not ready so frames
+    // reach the sinks in order
+    // ------------------------------------------------------------------------
+    void deliver(bool wait)
+    {
+        for (;;)
+        {
+            Slot* oldest = nullptr;
+            for (Slot& slot : m_slots)
+            {
+                if (slot.fence && (!oldest || slot.sequence < oldest->sequence))
+                    oldest = &slot;
+            }
+            if (!oldest)
+                return;
+            if (!wait)
+            {
+                if (m_updates - oldest->issuedAt < m_latency)
+                    return;
+                GLenum status = glClientWaitSync(oldest->fence, 0, 0);
+                if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+                    return;
+            }
+            else
+                glClientWaitSync(oldest->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+            GL_VERIFY(glDeleteSync(oldest->fence));
+            oldest->fence = 0;
+
+            ReadbackFramePtr frame = map(*oldest);
+            if (!frame)
+                continue;
+            m_stats.delivered++;
+            for (const ReadbackSink& sink : m_sinks)
+                sink(frame);
+        }
+    }
+    // ------------------------------------------------------------------------
+    ReadbackFramePtr map(const Slot& slot)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        std::shared_ptr<ReadbackFrame> frame = std::make_shared<ReadbackFrame>();
+        frame->frame = slot.frame;
+        frame->width = slot.width;
+        frame->height = slot.height;
+        size_t bytes = (size_t)slot.width * slot.height * 4;
+        GL_VERIFY(glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer));
+        const void* data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)bytes, GL_MAP_READ_BIT);
+        if (data)
+        {
+            frame->pixels.assign((const uint8_t*)data, (const uint8_t*)data + bytes);
+            GL_VERIFY(glUnmapBuffer(GL_PIXEL_PACK_BUFFER));
+        }
+        GL_VERIFY(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+        m_stats.mapMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (!data)
+        {
+            m_stats.dropped++;
+            return nullptr;
+        }
+        return frame;
+    }
+};
+
+// Encodes frames to PNG files on the pool. pattern is a printf format for
+// the frame number, "capture_%05llu.png". At most maxQueued frames wait for
+// a worker, more are dropped rather than piling up memory.
+class PngFrameWriter
+{
+public:
+    PngFrameWriter(ThreadPool& pool, std::string pattern, unsigned maxQueued = 8)
+        : m_pool(pool), m_pattern(std::move(pattern)), m_maxQueued(maxQueued), m_state(std::make_shared<State>())
+    {
+    }
+    ~PngFrameWriter()
+    {
+        wait();
+    }
+    PngFrameWriter(const PngFrameWriter&) = delete;
+    PngFrameWriter& operator=(const PngFrameWriter&) = delete;
+
+    // the writer must outlive the FramebufferReadback it is added to
+    // ------------------------------------------------------------------------
+    ReadbackSink sink()
+    {
+        return [this](const ReadbackFramePtr& frame) { write(frame); };
+    }
+    // ------------------------------------------------------------------------
+    void write(const ReadbackFramePtr& frame)
+    {
+        m_pending.erase(std::remove_if(m_pending.begin(), m_pending.end(), [](const std::future<void>& pending) {
+            return pending.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }), m_pending.end());
+        if (m_pending.size() >= m_maxQueued)
+        {
+            m_state->dropped++;
+            return;
+        }
+        char path[512];
+        snprintf(path, sizeof(path), m_pattern.c_str(), (unsigned long long)frame->frame);
+        std::shared_ptr<State> state = m_state;
+        std::string file = path;
+        m_pending.push_back(m_pool.submit([frame, state, file] {
+            PROFILE_ZONE("encode png");
+            if (savePng(file.c_str(), frame->pixels.data(), frame->width, frame->height, 4, true))
+                state->written++;
+            else
+                state->failed++;
+        }));
+    }
+    // ------------------------------------------------------------------------
+    void wait()
+    {
+        for (std::future<void>& pending : m_pending)
+            pending.wait();
+        m_pending.clear();
+    }
+    uint64_t written() const { return m_state->written; }
+    uint64_t failed() const { return m_state->failed; }
+    uint64_t dropped() const { return m_state->dropped; }
+
+private:
+    struct State
+    {
+        std::atomic<uint64_t> written{ 0 };
+        std::atomic<uint64_t> failed{ 0 };
+        std::atomic<uint64_t> dropped{ 0 };
+    };
+
+    ThreadPool& m_pool;
+    std::string m_pattern;
+    unsigned m_maxQueued;
+    std::shared_ptr<State> m_state;
+    std::vector<std::future<void>> m_pending;
+};
+
+// Appends frames to one file as raw RGBA8, top row first, for
+//
+//     ffmpeg -f rawvideo -pix_fmt rgba -s WxH -r 60 -i capture.rgba capture.mp4
+//
+// Writing happens on a thread of its own so frames stay in order. Frames of
+// another size than the first are skipped.
+class RawVideoWriter
+{
+public:
+    RawVideoWriter() : m_writer(1), m_state(std::make_shared<State>()) {}
+    ~RawVideoWriter()
+    {
+        close();
+    }
+    RawVideoWriter(const RawVideoWriter&) = delete;
+    RawVideoWriter& operator=(const RawVideoWriter&) = delete;
+
+    // ------------------------------------------------------------------------
+    bool open(const char* path)
+    {
+        close();
+        m_state->file = fopen(path, "wb");
+        m_width = 0;
+        m_height = 0;
+        return m_state->file != nullptr;
+    }
+    // the writer must outlive the FramebufferReadback it is added to
+    // ------------------------------------------------------------------------
+    ReadbackSink sink()
+    {
+        return [this](const ReadbackFramePtr& frame) { write(frame); };
+    }
+    // ------------------------------------------------------------------------
+    void write(const ReadbackFramePtr& frame)
+    {
+        if (!m_state->file)
+            return;
+        if (!m_width)
+        {
+            m_width = frame->width;
+            m_height = frame->height;
+        }
+        if (frame->width != m_width || frame->height != m_height)
+        {
+            m_state->skipped++;
+            return;
+        }
+        std::shared_ptr<State> state = m_state;
+        m_pending.push_back(m_writer.submit([frame, state] {
+            size_t row = (size_t)frame->width * 4;
+            bool ok = true;
+            for (int y = frame->height - 1; y >= 0 && ok; y--)
+                ok = fwrite(frame->pixels.data() + row * y, row, 1, state->file) == 1;
+            if (ok)
+                state->written++;
+            else
+                state->failed++;
+        }));
+        // the single writer finishes in order, so the front is the oldest
+        while (!m_pending.empty() && m_pending.front().wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            m_pending.erase(m_pending.begin());
+    }
+    // waits for the queued frames and closes the file
+    // ------------------------------------------------------------------------
+    void close()
+    {
+        for (std::future<void>& pending : m_pending)
+            pending.wait();
+        m_pending.clear();
+        if (m_state->file)
+            fclose(m_state->file);
+        m_state->file = nullptr;
+    }
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+    uint64_t written() const { return m_state->written; }
+    uint64_t failed() const { return m_state->failed; }
+    uint64_t skipped() const { return m_state->skipped; }
+
+private:
+    struct State
+    {
+        FILE* file = nullptr;
+        std::atomic<uint64_t> written{ 0 };
+        std::atomic<uint64_t> failed{ 0 };
+        std::atomic<uint64_t> skipped{ 0 };
+    };
+
+    ThreadPool m_writer;
+    std::shared_ptr<State> m_state;
+    std::vector<std::future<void>> m_pending;
+    int m_width = 0;
+    int m_height = 0;
+};
+
+// how far a frame may be from its reference and still match
+struct ImageTolerance
+{
+    int channel = 2;             // per channel difference that still counts as equal
+    double pixelFraction = 0.0;  // of the pixels allowed to differ by more
+};
+
+struct ImageComparison
+{
+    uint64_t frame = 0;
+    std::string reference;
+    bool loaded = false;         // the reference was read and has the frame's size
+    bool matched = false;
+    int maxDifference = 0;       // largest channel difference
+    uint64_t differingPixels = 0;
+};
+
+// Golden image test: compares every frame with the PNG that pattern names for
+// its frame number, as PngFrameWriter wrote it on a known good run. A frame
+// that does not match is written next to its reference as .actual.png. Runs
+// on the GL thread, this is for tests rather than frame rate.
+class ImageComparator
+{
+public:
+    explicit ImageComparator(std::string pattern, ImageTolerance tolerance = ImageTolerance())
+        : m_pattern(std::move(pattern)), m_tolerance(tolerance)
+    {
+    }
+
+    // the comparator must outlive the FramebufferReadback it is added to
+    // ------------------------------------------------------------------------
+    ReadbackSink sink()
+    {
+        return [this](const ReadbackFramePtr& frame) { compare(*frame); };
+    }
+    // ------------------------------------------------------------------------
+    const ImageComparison& compare(const ReadbackFrame& frame)
+    {
+        char path[512];
+        snprintf(path, sizeof(path), m_pattern.c_str(), (unsigned long long)frame.frame);
+        ImageComparison result;
+        result.frame = frame.frame;
+        result.reference = path;
+
+        int width = 0, height = 0, channels = 0;
+        stbi_uc* reference = stbi_load(path, &width, &height, &channels, 4);
+        result.loaded = reference && width == frame.width && height == frame.height;
+        if (result.loaded)
+        {
+            uint64_t allowed = (uint64_t)(m_tolerance.pixelFraction * width * height);
+            for (int y = 0; y < height; y++)
+            {
+                // the reference is stored top row first
+                const uint8_t* expected = reference + (size_t)width * 4 * (height - 1 - y);
+                const uint8_t* actual = frame.pixels.data() + (size_t)width * 4 * y;
+                for (int x = 0; x < width * 4; x += 4)
+                {
+                    int difference = 0;
+                    for (int c = 0; c < 4; c++)
+                        difference = std::max(difference, abs(expected[x + c] - actual[x + c]));
+                    result.maxDifference = std::max(result.maxDifference, difference);
+                    result.differingPixels += difference > m_tolerance.channel;
+                }
+            }
+            result.matched = result.differingPixels <= allowed;
+        }
+        if (reference)
+            stbi_image_free(reference);
+        if (!result.matched)
+        {
+            std::string actualPath = result.reference.substr(0, result.reference.rfind('.')) + ".actual.png";
+            savePng(actualPath.c_str(), frame.pixels.data(), frame.width, frame.height, 4, true);
+        }
+        m_results.push_back(result);
+        return m_results.back();
+    }
+
+    // ------------------------------------------------------------------------
+    const std::vector<ImageComparison>& results() const { return m_results; }
+    size_t failures() const
+    {
+        return (size_t)std::count_if(m_results.begin(), m_results.end(), [](const ImageComparison& result) {
+            return !result.matched;
+        });
+    }
+
+private:
+    std::string m_pattern;
+    ImageTolerance m_tolerance;
+    std::vector<ImageComparison> m_results;
+};
+
+#endif
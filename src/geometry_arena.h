@@ -0,0 +1,515 @@
+#ifndef GEOMETRY_ARENA_H
+#define GEOMETRY_ARENA_H
+
+#include <glad/glad.h>
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+#include "gl_verify.h"
+#include "gl_state_cache.h"
+#include "offset_allocator.h"
+
+// one vertex attribute as passed to glVertexAttribPointer
+struct VertexAttribute
+{
+    GLuint location;
+    GLint components;
+    GLenum type;
+    GLboolean normalized;
+    GLuint offset; // byte offset inside the vertex
+};
+
+struct VertexLayout
+{
+    std::vector<VertexAttribute> attributes;
+    GLsizei stride; // byte count of 1 vertex
+
+    bool operator==(const VertexLayout& other) const
+    {
+        if (stride != other.stride || attributes.size() != other.attributes.size())
+            return false;
+        for (size_t i = 0; i < attributes.size(); i++)
+        {
+            const VertexAttribute& a = attributes[i];
+            const VertexAttribute& b = other.attributes[i];
+            if (a.location != b.location || a.components != b.components || a.type != b.type ||
+                a.normalized != b.normalized || a.offset != b.offset)
+                return false;
+        }
+        return true;
+    }
+};
+
+// stable handle to a mesh living in the arena, survives defragmentation
+typedef uint32_t GeometryHandle;
+const GeometryHandle INVALID_GEOMETRY = 0xffffffff;
+const uint32_t INVALID_LAYOUT = 0xffffffff;
+
+struct GeometryArenaStats
+{
+    uint32_t layoutCount = 0;
+    uint32_t pageCount = 0;
+    uint32_t meshCount = 0;
+    uint64_t vertexBytesCapacity = 0;
+    uint64_t vertexBytesUsed = 0;
+    uint64_t indexBytesCapacity = 0;
+    uint64_t indexBytesUsed = 0;
+    uint64_t largestFreeVertexBytes = 0;
+    uint64_t largestFreeIndexBytes = 0;
+    // 0 = all free space is one block, close to 1 = free space is scattered
+    float vertexFragmentation = 0.0f;
+    float indexFragmentation = 0.0f;
+};
+
+// Shared geometry storage. Every vertex layout gets a few big VBO/EBO pairs
+// ("pages") with one VAO each, and meshes are sub-allocated from them with an
+// OffsetAllocator. Indices stay mesh local and are drawn with
+// glDrawElementsBaseVertex, so drawing any mesh of a page only needs the page
+// VAO bound, and meshes sharing a page can be batched into few draws.
+// VAOs are bound through the GLStateCache the rest of the frame binds with,
+// so a VAO bound elsewhere never leaves the arena skipping a bind.
+class GeometryArena
+{
+public:
+    // page sizes are in bytes, a mesh bigger than a page gets a page of its own
+    explicit GeometryArena(GLStateCache& state, uint32_t vertexPageBytes = 8 * 1024 * 1024,
+        uint32_t indexPageBytes = 4 * 1024 * 1024)
+        : m_state(state), m_vertexPageBytes(vertexPageBytes), m_indexPageBytes(indexPageBytes)
+    {
+    }
+    ~GeometryArena()
+    {
+        release();
+    }
+    GeometryArena(const GeometryArena&) = delete;
+    GeometryArena& operator=(const GeometryArena&) = delete;
+
+    // returns the id of the layout, registering the same layout twice gives the same id;
+    // INVALID_LAYOUT for a zero stride, which allocate() then turns away
+    // ------------------------------------------------------------------------
+    uint32_t registerLayout(const VertexLayout& layout)
+    {
+        assert(layout.stride > 0);
+        if (layout.stride <= 0)
+            return INVALID_LAYOUT;
+        for (size_t i = 0; i < m_pools.size(); i++)
+        {
+            if (m_pools[i].layout == layout)
+                return (uint32_t)i;
+        }
+        Pool pool;
+        pool.layout = layout;
+        m_pools.push_back(pool);
+        return (uint32_t)(m_pools.size() - 1);
+    }
+    // Reserves room for a mesh, indices are 32 bit and relative to the mesh's
+    // first vertex. INVALID_GEOMETRY for an unknown layout or an empty mesh.
+    // ------------------------------------------------------------------------
+    GeometryHandle allocate(uint32_t layoutId, uint32_t vertexCount, uint32_t indexCount)
+    {
+        if (layoutId >= m_pools.size() || vertexCount == 0 || indexCount == 0)
+            return INVALID_GEOMETRY;
+        Pool& pool = m_pools[layoutId];
+
+        Mesh mesh;
+        mesh.layout = layoutId;
+        mesh.vertexCount = vertexCount;
+        mesh.indexCount = indexCount;
+
+        for (size_t i = 0; i < pool.pages.size(); i++)
+        {
+            if (allocateInPage(*pool.pages[i], mesh))
+            {
+                mesh.page = (uint32_t)i;
+                return addMesh(mesh);
+            }
+        }
+
+        // no page has room: open a new one, big enough for this mesh
+        uint32_t vertexCapacity = std::max(m_vertexPageBytes / pool.layout.stride, vertexCount);
+        uint32_t indexCapacity = std::max(m_indexPageBytes / (uint32_t)sizeof(GLuint), indexCount);
+        pool.pages.push_back(createPage(pool.layout, vertexCapacity, indexCapacity));
+        mesh.page = (uint32_t)(pool.pages.size() - 1);
+        if (!allocateInPage(*pool.pages.back(), mesh))
+            return INVALID_GEOMETRY;
+        return addMesh(mesh);
+    }
+    // copies the mesh data into its range of the page buffers
+    // ------------------------------------------------------------------------
+    void upload(GeometryHandle handle, const void* vertices, const GLuint* indices)
+    {
+        if (!valid(handle))
+            return;
+        const Mesh& mesh = m_meshes[handle];
+        const Pool& pool = m_pools[mesh.layout];
+        const Page& page = *pool.pages[mesh.page];
+        GLsizei stride = pool.layout.stride;
+
+        // the EBO is part of the VAO state, unbind the VAO so we don't clobber it
+        m_state.bindVertexArray(0);
+        GL_VERIFY(glBindBuffer(GL_ARRAY_BUFFER, page.VBO));
+        GL_VERIFY(glBufferSubData(GL_ARRAY_BUFFER,
+            (GLintptr)mesh.vertices.offset * stride,
+            (GLsizeiptr)mesh.vertexCount * stride,
+            vertices));
+        GL_VERIFY(glBindBuffer(GL_COPY_WRITE_BUFFER, page.EBO));
+        GL_VERIFY(glBufferSubData(GL_COPY_WRITE_BUFFER,
+            (GLintptr)mesh.indices.offset * sizeof(GLuint),
+            (GLsizeiptr)mesh.indexCount * sizeof(GLuint),
+            indices));
+    }
+    // ------------------------------------------------------------------------
+    void free(GeometryHandle handle)
+    {
+        if (!valid(handle))
+            return;
+        Mesh& mesh = m_meshes[handle];
+        Page& page = *m_pools[mesh.layout].pages[mesh.page];
+        page.vertexAllocator.free(mesh.vertices);
+        page.indexAllocator.free(mesh.indices);
+        page.meshCount--;
+        mesh.live = false;
+        m_freeHandles.push_back(handle);
+    }
+    // binds the VAO of the mesh's page, skipped when it is already bound
+    // ------------------------------------------------------------------------
+    void bind(GeometryHandle handle)
+    {
+        if (!valid(handle))
+            return;
+        const Mesh& mesh = m_meshes[handle];
+        m_state.bindVertexArray(m_pools[mesh.layout].pages[mesh.page]->VAO);
+    }
+    // ------------------------------------------------------------------------
+    void draw(GeometryHandle handle, GLenum mode = GL_TRIANGLES)
+    {
+        if (!valid(handle))
+            return;
+        const Mesh& mesh = m_meshes[handle];
+        bind(handle);
+        GL_VERIFY(glDrawElementsBaseVertex(mode,
+            (GLsizei)mesh.indexCount,
+            GL_UNSIGNED_INT,
+            (void*)((uintptr_t)mesh.indices.offset * sizeof(GLuint)),
+            (GLint)mesh.vertices.offset));
+    }
+    // per-instance attributes have to be attached to vertexArray() first
+    // ------------------------------------------------------------------------
+    void drawInstanced(GeometryHandle handle, GLsizei instanceCount, GLenum mode = GL_TRIANGLES)
+    {
+        if (!valid(handle))
+            return;
+        const Mesh& mesh = m_meshes[handle];
+        bind(handle);
+        GL_VERIFY(glDrawElementsInstancedBaseVertex(mode,
+            (GLsizei)mesh.indexCount,
+            GL_UNSIGNED_INT,
+            (void*)((uintptr_t)mesh.indices.offset * sizeof(GLuint)),
+            instanceCount,
+            (GLint)mesh.vertices.offset));
+    }
+    // values to feed glDrawElements*BaseVertex yourself, e.g. for instancing
+    // ------------------------------------------------------------------------
+    GLint baseVertex(GeometryHandle handle) const { return (GLint)m_meshes[handle].vertices.offset; }
+    const void* firstIndexOffset(GeometryHandle handle) const
+    {
+        return (const void*)((uintptr_t)m_meshes[handle].indices.offset * sizeof(GLuint));
+    }
+    GLsizei indexCount(GeometryHandle handle) const { return (GLsizei)m_meshes[handle].indexCount; }
+    GLuint vertexArray(GeometryHandle handle) const
+    {
+        const Mesh& mesh = m_meshes[handle];
+        return m_pools[mesh.layout].pages[mesh.page]->VAO;
+    }
+
+    // Compacts every page so its meshes are packed at the start of the
+    // buffers, using GPU side copies, and deletes pages that became empty.
+    // Handles stay valid. Returns the number of pages that were compacted.
+    // ------------------------------------------------------------------------
+    uint32_t defragment(float minFragmentation = 0.25f)
+    {
+        uint32_t compacted = 0;
+        m_state.bindVertexArray(0);
+
+        for (uint32_t l = 0; l < m_pools.size(); l++)
+        {
+            Pool& pool = m_pools[l];
+            for (uint32_t p = 0; p < pool.pages.size(); )
+            {
+                Page& page = *pool.pages[p];
+
+                // drop empty pages, keeping the first one around for new meshes
+                if (page.meshCount == 0 && pool.pages.size() > 1)
+                {
+                    destroyPage(page);
+                    pool.pages.erase(pool.pages.begin() + p);
+                    for (Mesh& mesh : m_meshes)
+                    {
+                        if (mesh.live && mesh.layout == l && mesh.page > p)
+                            mesh.page--;
+                    }
+                    continue;
+                }
+
+                if (fragmentation(page.vertexAllocator) >= minFragmentation ||
+                    fragmentation(page.indexAllocator) >= minFragmentation)
+                {
+                    compactPage(pool, page, l, p);
+                    compacted++;
+                }
+                p++;
+            }
+        }
+        return compacted;
+    }
+    // ------------------------------------------------------------------------
+    GeometryArenaStats stats() const
+    {
+        GeometryArenaStats stats;
+        stats.layoutCount = (uint32_t)m_pools.size();
+        uint64_t freeVertexBytes = 0;
+        uint64_t freeIndexBytes = 0;
+        for (const Pool& pool : m_pools)
+        {
+            uint64_t stride = pool.layout.stride;
+            for (const Page* page : pool.pages)
+            {
+                stats.pageCount++;
+                stats.meshCount += page->meshCount;
+
+                OffsetAllocator::StorageReport vertexReport = page->vertexAllocator.storageReport();
+                OffsetAllocator::StorageReport indexReport = page->indexAllocator.storageReport();
+                stats.vertexBytesCapacity += (uint64_t)page->vertexAllocator.size() * stride;
+                stats.vertexBytesUsed += (uint64_t)page->vertexAllocator.usedSpace() * stride;
+                stats.indexBytesCapacity += (uint64_t)page->indexAllocator.size() * sizeof(GLuint);
+                stats.indexBytesUsed += (uint64_t)page->indexAllocator.usedSpace() * sizeof(GLuint);
+                freeVertexBytes += (uint64_t)vertexReport.totalFreeSpace * stride;
+                freeIndexBytes += (uint64_t)indexReport.totalFreeSpace * sizeof(GLuint);
+                stats.largestFreeVertexBytes = std::max(stats.largestFreeVertexBytes, (uint64_t)vertexReport.largestFreeRegion * stride);
+                stats.largestFreeIndexBytes = std::max(stats.largestFreeIndexBytes, (uint64_t)indexReport.largestFreeRegion * sizeof(GLuint));
+            }
+        }
+        if (freeVertexBytes)
+            stats.vertexFragmentation = 1.0f - (float)stats.largestFreeVertexBytes / (float)freeVertexBytes;
+        if (freeIndexBytes)
+            stats.indexFragmentation = 1.0f - (float)stats.largestFreeIndexBytes / (float)freeIndexBytes;
+        return stats;
+    }
+    // deletes all GL objects, must be called while the context is still alive
+    // ------------------------------------------------------------------------
+    void release()
+    {
+        for (Pool& pool : m_pools)
+        {
+            for (Page* page : pool.pages)
+                destroyPage(*page);
+            pool.pages.clear();
+        }
+        m_pools.clear();
+        m_meshes.clear();
+        m_freeHandles.clear();
+    }
+
+private:
+    struct Page
+    {
+        GLuint VBO = 0;
+        GLuint EBO = 0;
+        GLuint VAO = 0;
+        OffsetAllocator vertexAllocator; // in vertices
+        OffsetAllocator indexAllocator;  // in indices
+        uint32_t meshCount = 0;
+
+        Page(uint32_t vertexCapacity, uint32_t indexCapacity)
+            : vertexAllocator(vertexCapacity), indexAllocator(indexCapacity)
+        {
+        }
+    };
+    struct Pool
+    {
+        VertexLayout layout;
+        std::vector<Page*> pages;
+    };
+    struct Mesh
+    {
+        uint32_t layout = 0;
+        uint32_t page = 0;
+        uint32_t vertexCount = 0;
+        uint32_t indexCount = 0;
+        OffsetAllocator::Allocation vertices;
+        OffsetAllocator::Allocation indices;
+        bool live = false;
+    };
+
+    GLStateCache& m_state;
+    uint32_t m_vertexPageBytes;
+    uint32_t m_indexPageBytes;
+    std::vector<Pool> m_pools;
+    std::vector<Mesh> m_meshes;
+    std::vector<GeometryHandle> m_freeHandles;
+
+    // ------------------------------------------------------------------------
+    static float fragmentation(const OffsetAllocator& allocator)
+    {
+        OffsetAllocator::StorageReport report = allocator.storageReport();
+        if (report.totalFreeSpace == 0)
+            return 0.0f;
+        return 1.0f - (float)report.largestFreeRegion / (float)report.totalFreeSpace;
+    }
+    // ------------------------------------------------------------------------
+    static bool allocateInPage(Page& page, Mesh& mesh)
+    {
+        OffsetAllocator::Allocation vertices = page.vertexAllocator.allocate(mesh.vertexCount);
+        if (!vertices.valid())
+            return false;
+        OffsetAllocator::Allocation indices = page.indexAllocator.allocate(mesh.indexCount);
+        if (!indices.valid())
+        {
+            page.vertexAllocator.free(vertices);
+            return false;
+        }
+        mesh.vertices = vertices;
+        mesh.indices = indices;
+        page.meshCount++;
+        return true;
+    }
+    // a live mesh of this arena; asserts so a stale or foreign handle shows up in debug
+    // ------------------------------------------------------------------------
+    bool valid(GeometryHandle handle) const
+    {
+        bool live = handle < m_meshes.size() && m_meshes[handle].live;
+        assert(live);
+        return live;
+    }
+    // ------------------------------------------------------------------------
+    GeometryHandle addMesh(const Mesh& mesh)
+    {
+        GeometryHandle handle;
+        if (!m_freeHandles.empty())
+        {
+            handle = m_freeHandles.back();
+            m_freeHandles.pop_back();
+        }
+        else
+        {
+            handle = (GeometryHandle)m_meshes.size();
+            m_meshes.push_back(Mesh());
+        }
+        m_meshes[handle] = mesh;
+        m_meshes[handle].live = true;
+        return handle;
+    }
+    // ------------------------------------------------------------------------
+    static void setupVertexArray(const VertexLayout& layout, GLuint VBO, GLuint EBO)
+    {
+        GL_VERIFY(glBindBuffer(GL_ARRAY_BUFFER, VBO));
+        GL_VERIFY(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO));
+        for (const VertexAttribute& attribute : layout.attributes)
+        {
+            GL_VERIFY(glVertexAttribPointer(
+                attribute.location,
+                attribute.components,
+                attribute.type,
+                attribute.normalized,
+                layout.stride,
+                (void*)(uintptr_t)attribute.offset));
+            GL_VERIFY(glEnableVertexAttribArray(attribute.location));
+        }
+    }
+    // ------------------------------------------------------------------------
+    Page* createPage(const VertexLayout& layout, uint32_t vertexCapacity, uint32_t indexCapacity)
+    {
+        Page* page = new Page(vertexCapacity, indexCapacity);
+
+        GL_VERIFY(glGenBuffers(1, &page->VBO));
+        GL_VERIFY(glBindBuffer(GL_ARRAY_BUFFER, page->VBO));
+        GL_VERIFY(glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)vertexCapacity * layout.stride, nullptr, GL_STATIC_DRAW));
+
+        GL_VERIFY(glGenVertexArrays(1, &page->VAO));
+        m_state.bindVertexArray(page->VAO);
+
+        GL_VERIFY(glGenBuffers(1, &page->EBO));
+        GL_VERIFY(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, page->EBO));
+        GL_VERIFY(glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)indexCapacity * sizeof(GLuint), nullptr, GL_STATIC_DRAW));
+
+        setupVertexArray(layout, page->VBO, page->EBO);
+        m_state.bindVertexArray(0);
+        return page;
+    }
+    // ------------------------------------------------------------------------
+    void destroyPage(Page& page)
+    {
+        // deleting the bound VAO would unbind it behind the cache's back
+        m_state.bindVertexArray(0);
+        GL_VERIFY(glDeleteVertexArrays(1, &page.VAO));
+        GL_VERIFY(glDeleteBuffers(1, &page.VBO));
+        GL_VERIFY(glDeleteBuffers(1, &page.EBO));
+        delete &page;
+    }
+    // ------------------------------------------------------------------------
+    void compactPage(const Pool& pool, Page& page, uint32_t layoutId, uint32_t pageIndex)
+    {
+        GLsizei stride = pool.layout.stride;
+        uint32_t vertexCapacity = page.vertexAllocator.size();
+        uint32_t indexCapacity = page.indexAllocator.size();
+
+        std::vector<Mesh*> meshes;
+        for (Mesh& mesh : m_meshes)
+        {
+            if (mesh.live && mesh.layout == layoutId && mesh.page == pageIndex)
+                meshes.push_back(&mesh);
+        }
+        std::sort(meshes.begin(), meshes.end(), [](const Mesh* a, const Mesh* b) {
+            return a->vertices.offset < b->vertices.offset;
+        });
+
+        GLuint newVBO = 0;
+        GLuint newEBO = 0;
+        GL_VERIFY(glGenBuffers(1, &newVBO));
+        GL_VERIFY(glBindBuffer(GL_COPY_WRITE_BUFFER, newVBO));
+        GL_VERIFY(glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)vertexCapacity * stride, nullptr, GL_STATIC_DRAW));
+        GL_VERIFY(glBindBuffer(GL_COPY_READ_BUFFER, page.VBO));
+
+        // a fresh allocator hands out ranges back to back
+        page.vertexAllocator.reset();
+        page.indexAllocator.reset();
+        for (Mesh* mesh : meshes)
+        {
+            OffsetAllocator::Allocation vertices = page.vertexAllocator.allocate(mesh->vertexCount);
+            GL_VERIFY(glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+                (GLintptr)mesh->vertices.offset * stride,
+                (GLintptr)vertices.offset * stride,
+                (GLsizeiptr)mesh->vertexCount * stride));
+            mesh->vertices = vertices;
+        }
+
+        GL_VERIFY(glGenBuffers(1, &newEBO));
+        GL_VERIFY(glBindBuffer(GL_COPY_WRITE_BUFFER, newEBO));
+        GL_VERIFY(glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)indexCapacity * sizeof(GLuint), nullptr, GL_STATIC_DRAW));
+        GL_VERIFY(glBindBuffer(GL_COPY_READ_BUFFER, page.EBO));
+        for (Mesh* mesh : meshes)
+        {
+            OffsetAllocator::Allocation indices = page.indexAllocator.allocate(mesh->indexCount);
+            GL_VERIFY(glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+                (GLintptr)mesh->indices.offset * sizeof(GLuint),
+                (GLintptr)indices.offset * sizeof(GLuint),
+                (GLsizeiptr)mesh->indexCount * sizeof(GLuint)));
+            mesh->indices = indices;
+        }
+
+        GL_VERIFY(glDeleteBuffers(1, &page.VBO));
+        GL_VERIFY(glDeleteBuffers(1, &page.EBO));
+        page.VBO = newVBO;
+        page.EBO = newEBO;
+
+        // point the VAO at the new buffers
+        m_state.bindVertexArray(page.VAO);
+        setupVertexArray(pool.layout, page.VBO, page.EBO);
+        m_state.bindVertexArray(0);
+    }
+};
+
+#endif
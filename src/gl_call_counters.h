@@ -0,0 +1,215 @@
+#ifndef GL_CALL_COUNTERS_H
+#define GL_CALL_COUNTERS_H
+
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <ostream>
+#include <utility>
+#include <algorithm>
+
+// Counting every GL call costs an extra indirect call each, so like
+// GL_VERIFY it is on in debug builds only unless GL_CALL_COUNTERS says
+// otherwise. Compiled out, install() returns false and nothing is counted.
+#ifndef GL_CALL_COUNTERS
+#ifndef NDEBUG
+#define GL_CALL_COUNTERS 1
+#else
+#define GL_CALL_COUNTERS 0
+#endif
+#endif
+
+// what a GL entry point does, assigned by tools/gen_gl_call_table.py
+enum class GLCallCategory : uint8_t
+{
+    Draw,
+    Clear,
+    Bind,     // objects to targets and units, programs
+    State,    // fixed function, vertex layout and sampling state
+    Uniform,
+    Transfer, // buffer and texture uploads, readbacks, blits
+    Query,
+    Object,   // creation, deletion
+    Shader,   // compiling, linking, reflection
+    Sync,
+    Get,
+    Debug,
+    Other,    // the rest, mostly compatibility profile calls
+    Count
+};
+
+#if GL_CALL_COUNTERS
+#include "gl_call_table.h"
+#endif
+
+// calls of one frame
+struct GLFrameCalls
+{
+    uint64_t frame;
+    uint32_t total;
+    uint32_t categories[(size_t)GLCallCategory::Count];
+
+    uint32_t operator[](GLCallCategory category) const { return categories[(size_t)category]; }
+};
+
+// Per-frame GL call counts by entry point and by category. install() points
+// every glad_gl* pointer at a generated wrapper (src/gl_call_table.h) that
+// bumps the entry's counter and forwards the call, so everything that goes
+// through glad is seen, GL_VERIFY's glGetError included. Functions loaded
+// past glad (TextureStorageSupport) are not.
+//
+// endFrame() closes the frame: its counts become lastFrame(), are appended
+// to the log and checked against the per-category budgets, so a change that
+// adds draws or binds to every frame shows up as overBudgetFrames().
+// GL thread only, like the calls it counts.
+class GLCallCounters
+{
+public:
+    GLCallCounters() {}
+    ~GLCallCounters()
+    {
+        uninstall();
+    }
+    GLCallCounters(const GLCallCounters&) = delete;
+    GLCallCounters& operator=(const GLCallCounters&) = delete;
+
+    // after gladLoadGL*(); false when compiled out
+    // ------------------------------------------------------------------------
+    bool install()
+    {
+#if GL_CALL_COUNTERS
+        glcalls::install();
+        std::fill(glcalls::Table<>::counts, glcalls::Table<>::counts + glcalls::ENTRY_COUNT, 0u);
+        m_lastCounts.assign(glcalls::ENTRY_COUNT, 0);
+        m_installed = true;
+#endif
+        return m_installed;
+    }
+    void uninstall()
+    {
+#if GL_CALL_COUNTERS
+        if (m_installed)
+            glcalls::uninstall();
+#endif
+        m_installed = false;
+    }
+    bool installed() const { return m_installed; }
+
+    // at most maxCalls of a category per frame, 0 for no limit
+    // ------------------------------------------------------------------------
+    void setBudget(GLCallCategory category, uint32_t maxCalls)
+    {
+        m_budgets[(size_t)category] = maxCalls;
+    }
+
+    // takes the frame's counts and starts the next frame; false when the
+    // frame broke a budget
+    // ------------------------------------------------------------------------
+    bool endFrame()
+    {
+        GLFrameCalls calls = {};
+        calls.frame = m_frame++;
+#if GL_CALL_COUNTERS
+        if (m_installed)
+        {
+            uint32_t* counts = glcalls::Table<>::counts;
+            for (uint32_t entry = 0; entry < glcalls::ENTRY_COUNT; entry++)
+            {
+                calls.categories[(size_t)glcalls::entryCategory(entry)] += counts[entry];
+                calls.total += counts[entry];
+            }
+            std::copy(counts, counts + glcalls::ENTRY_COUNT, m_lastCounts.begin());
+            std::fill(counts, counts + glcalls::ENTRY_COUNT, 0u);
+        }
+#endif
+        m_lastFrame = calls;
+        if (m_log.size() == LOG_CAPACITY)
+            m_log.erase(m_log.begin(), m_log.begin() + LOG_CAPACITY / 2);
+        m_log.push_back(calls);
+
+        bool withinBudget = true;
+        for (size_t c = 0; c < (size_t)GLCallCategory::Count; c++)
+            withinBudget = withinBudget && (m_budgets[c] == 0 || calls.categories[c] <= m_budgets[c]);
+        if (!withinBudget)
+            m_overBudgetFrames++;
+        return withinBudget;
+    }
+
+    // ------------------------------------------------------------------------
+    const GLFrameCalls& lastFrame() const { return m_lastFrame; }
+    const std::vector<GLFrameCalls>& log() const { return m_log; } // the newest LOG_CAPACITY frames at most
+    uint64_t overBudgetFrames() const { return m_overBudgetFrames; }
+
+    // calls of the last frame to one entry point, "glDrawArrays"
+    // ------------------------------------------------------------------------
+    uint32_t calls(const char* entryPoint) const
+    {
+#if GL_CALL_COUNTERS
+        for (uint32_t entry = 0; entry < (uint32_t)m_lastCounts.size(); entry++)
+        {
+            if (strcmp(glcalls::entryName(entry), entryPoint) == 0)
+                return m_lastCounts[entry];
+        }
+#endif
+        (void)entryPoint;
+        return 0;
+    }
+    // the last frame's most called entry points, most first
+    // ------------------------------------------------------------------------
+    std::vector<std::pair<const char*, uint32_t>> topEntryPoints(size_t count) const
+    {
+        std::vector<std::pair<const char*, uint32_t>> top;
+#if GL_CALL_COUNTERS
+        for (uint32_t entry = 0; entry < (uint32_t)m_lastCounts.size(); entry++)
+        {
+            if (m_lastCounts[entry])
+                top.emplace_back(glcalls::entryName(entry), m_lastCounts[entry]);
+        }
+        std::sort(top.begin(), top.end(), [](const std::pair<const char*, uint32_t>& a, const std::pair<const char*, uint32_t>& b) {
+            return a.second > b.second;
+        });
+        top.resize(std::min(top.size(), count));
+#endif
+        (void)count;
+        return top;
+    }
+
+    // ------------------------------------------------------------------------
+    static const char* categoryName(GLCallCategory category)
+    {
+        static const char* const names[] = { "draw", "clear", "bind", "state", "uniform", "transfer", "query",
+            "object", "shader", "sync", "get", "debug", "other" };
+        return category < GLCallCategory::Count ? names[(size_t)category] : "";
+    }
+    // the log as CSV, one line per frame
+    // ------------------------------------------------------------------------
+    void writeCsv(std::ostream& out) const
+    {
+        out << "frame,total";
+        for (size_t c = 0; c < (size_t)GLCallCategory::Count; c++)
+            out << "," << categoryName((GLCallCategory)c);
+        out << "\n";
+        for (const GLFrameCalls& calls : m_log)
+        {
+            out << calls.frame << "," << calls.total;
+            for (size_t c = 0; c < (size_t)GLCallCategory::Count; c++)
+                out << "," << calls.categories[c];
+            out << "\n";
+        }
+    }
+
+private:
+    static const size_t LOG_CAPACITY = 65536;
+
+    bool m_installed = false;
+    uint64_t m_frame = 0;
+    GLFrameCalls m_lastFrame = {};
+    std::vector<uint32_t> m_lastCounts; // per entry point
+    std::vector<GLFrameCalls> m_log;
+    uint32_t m_budgets[(size_t)GLCallCategory::Count] = {};
+    uint64_t m_overBudgetFrames = 0;
+};
+
+#endif
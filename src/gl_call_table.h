@@ -0,0 +1,10913 @@
+// Generated by tools/gen_gl_call_table.py from GLAD/include/glad/glad.h,
+// do not edit. Included by gl_call_counters.h when GL_CALL_COUNTERS is on.
+#ifndef GL_CALL_TABLE_H
+#define GL_CALL_TABLE_H
+
+#include <glad/glad.h>
+
+#include <cstdint>
+
+namespace glcalls
+{
+    enum Entry : uint32_t
+    {
+        ENTRY_glCullFace,
+        ENTRY_glFrontFace,
+        ENTRY_glHint,
+        ENTRY_glLineWidth,
+        ENTRY_glPointSize,
+        ENTRY_glPolygonMode,
+        ENTRY_glScissor,
+        ENTRY_glTexParameterf,
+        ENTRY_glTexParameterfv,
+        ENTRY_glTexParameteri,
+        ENTRY_glTexParameteriv,
+        ENTRY_glTexImage1D,
+        ENTRY_glTexImage2D,
+        ENTRY_glDrawBuffer,
+        ENTRY_glClear,
+        ENTRY_glClearColor,
+        ENTRY_glClearStencil,
+        ENTRY_glClearDepth,
+        ENTRY_glStencilMask,
+        ENTRY_glColorMask,
+        ENTRY_glDepthMask,
+        ENTRY_glDisable,
+        ENTRY_glEnable,
+        ENTRY_glFinish,
+        ENTRY_glFlush,
+        ENTRY_glBlendFunc,
+        ENTRY_glLogicOp,
+        ENTRY_glStencilFunc,
+        ENTRY_glStencilOp,
+        ENTRY_glDepthFunc,
+        ENTRY_glPixelStoref,
+        ENTRY_glPixelStorei,
+        ENTRY_glReadBuffer,
+        ENTRY_glReadPixels,
+        ENTRY_glGetBooleanv,
+        ENTRY_glGetDoublev,
+        ENTRY_glGetError,
+        ENTRY_glGetFloatv,
+        ENTRY_glGetIntegerv,
+        ENTRY_glGetString,
+        ENTRY_glGetTexImage,
+        ENTRY_glGetTexParameterfv,
+        ENTRY_glGetTexParameteriv,
+        ENTRY_glGetTexLevelParameterfv,
+        ENTRY_glGetTexLevelParameteriv,
+        ENTRY_glIsEnabled,
+        ENTRY_glDepthRange,
+        ENTRY_glViewport,
+        ENTRY_glNewList,
+        ENTRY_glEndList,
+        ENTRY_glCallList,
+        ENTRY_glCallLists,
+        ENTRY_glDeleteLists,
+        ENTRY_glGenLists,
+        ENTRY_glListBase,
+        ENTRY_glBegin,
+        ENTRY_glBitmap,
+        ENTRY_glColor3b,
+        ENTRY_glColor3bv,
+        ENTRY_glColor3d,
+        ENTRY_glColor3dv,
+        ENTRY_glColor3f,
+        ENTRY_glColor3fv,
+        ENTRY_glColor3i,
+        ENTRY_glColor3iv,
+        ENTRY_glColor3s,
+        ENTRY_glColor3sv,
+        ENTRY_glColor3ub,
+        ENTRY_glColor3ubv,
+        ENTRY_glColor3ui,
+        ENTRY_glColor3uiv,
+        ENTRY_glColor3us,
+        ENTRY_glColor3usv,
+        ENTRY_glColor4b,
+        ENTRY_glColor4bv,
+        ENTRY_glColor4d,
+        ENTRY_glColor4dv,
+        ENTRY_glColor4f,
+        ENTRY_glColor4fv,
+        ENTRY_glColor4i,
+        ENTRY_glColor4iv,
+        ENTRY_glColor4s,
+        ENTRY_glColor4sv,
+        ENTRY_glColor4ub,
+        ENTRY_glColor4ubv,
+        ENTRY_glColor4ui,
+        ENTRY_glColor4uiv,
+        ENTRY_glColor4us,
+        ENTRY_glColor4usv,
+        ENTRY_glEdgeFlag,
+        ENTRY_glEdgeFlagv,
+        ENTRY_glEnd,
+        ENTRY_glIndexd,
+        ENTRY_glIndexdv,
+        ENTRY_glIndexf,
+        ENTRY_glIndexfv,
+        ENTRY_glIndexi,
+        ENTRY_glIndexiv,
+        ENTRY_glIndexs,
+        ENTRY_glIndexsv,
+        ENTRY_glNormal3b,
+        ENTRY_glNormal3bv,
+        ENTRY_glNormal3d,
+        ENTRY_glNormal3dv,
+        ENTRY_glNormal3f,
+        ENTRY_glNormal3fv,
+        ENTRY_glNormal3i,
+        ENTRY_glNormal3iv,
+        ENTRY_glNormal3s,
+        ENTRY_glNormal3sv,
+        ENTRY_glRasterPos2d,
+        ENTRY_glRasterPos2dv,
+        ENTRY_glRasterPos2f,
+        ENTRY_glRasterPos2fv,
+        ENTRY_glRasterPos2i,
+        ENTRY_glRasterPos2iv,
+        ENTRY_glRasterPos2s,
+        ENTRY_glRasterPos2sv,
+        ENTRY_glRasterPos3d,
+        ENTRY_glRasterPos3dv,
+        ENTRY_glRasterPos3f,
+        ENTRY_glRasterPos3fv,
+        ENTRY_glRasterPos3i,
+        ENTRY_glRasterPos3iv,
+        ENTRY_glRasterPos3s,
+        ENTRY_glRasterPos3sv,
+        ENTRY_glRasterPos4d,
+        ENTRY_glRasterPos4dv,
+        ENTRY_glRasterPos4f,
+        ENTRY_glRasterPos4fv,
+        ENTRY_glRasterPos4i,
+        ENTRY_glRasterPos4iv,
+        ENTRY_glRasterPos4s,
+        ENTRY_glRasterPos4sv,
+        ENTRY_glRectd,
+        ENTRY_glRectdv,
+        ENTRY_glRectf,
+        ENTRY_glRectfv,
+        ENTRY_glRecti,
+        ENTRY_glRectiv,
+        ENTRY_glRects,
+        ENTRY_glRectsv,
+        ENTRY_glTexCoord1d,
+        ENTRY_glTexCoord1dv,
+        ENTRY_glTexCoord1f,
+        ENTRY_glTexCoord1fv,
+        ENTRY_glTexCoord1i,
+        ENTRY_glTexCoord1iv,
+        ENTRY_glTexCoord1s,
+        ENTRY_glTexCoord1sv,
+        ENTRY_glTexCoord2d,
+        ENTRY_glTexCoord2dv,
+        ENTRY_glTexCoord2f,
+        ENTRY_glTexCoord2fv,
+        ENTRY_glTexCoord2i,
+        ENTRY_glTexCoord2iv,
+        ENTRY_glTexCoord2s,
+        ENTRY_glTexCoord2sv,
+        ENTRY_glTexCoord3d,
+        ENTRY_glTexCoord3dv,
+        ENTRY_glTexCoord3f,
+        ENTRY_glTexCoord3fv,
+        ENTRY_glTexCoord3i,
+        ENTRY_glTexCoord3iv,
+        ENTRY_glTexCoord3s,
+        ENTRY_glTexCoord3sv,
+        ENTRY_glTexCoord4d,
+        ENTRY_glTexCoord4dv,
+        ENTRY_glTexCoord4f,
+        ENTRY_glTexCoord4fv,
+        ENTRY_glTexCoord4i,
+        ENTRY_glTexCoord4iv,
+        ENTRY_glTexCoord4s,
+        ENTRY_glTexCoord4sv,
+        ENTRY_glVertex2d,
+        ENTRY_glVertex2dv,
+        ENTRY_glVertex2f,
+        ENTRY_glVertex2fv,
+        ENTRY_glVertex2i,
+        ENTRY_glVertex2iv,
+        ENTRY_glVertex2s,
+        ENTRY_glVertex2sv,
+        ENTRY_glVertex3d,
+        ENTRY_glVertex3dv,
+        ENTRY_glVertex3f,
+        ENTRY_glVertex3fv,
+        ENTRY_glVertex3i,
+        ENTRY_glVertex3iv,
+        ENTRY_glVertex3s,
+        ENTRY_glVertex3sv,
+        ENTRY_glVertex4d,
+        ENTRY_glVertex4dv,
+        ENTRY_glVertex4f,
+        ENTRY_glVertex4fv,
+        ENTRY_glVertex4i,
+        ENTRY_glVertex4iv,
+        ENTRY_glVertex4s,
+        ENTRY_glVertex4sv,
+        ENTRY_glClipPlane,
+        ENTRY_glColorMaterial,
+        ENTRY_glFogf,
+        ENTRY_glFogfv,
+        ENTRY_glFogi,
+        ENTRY_glFogiv,
+        ENTRY_glLightf,
+        ENTRY_glLightfv,
+        ENTRY_glLighti,
+        ENTRY_glLightiv,
+        ENTRY_glLightModelf,
+        ENTRY_glLightModelfv,
+        ENTRY_glLightModeli,
+        ENTRY_glLightModeliv,
+        ENTRY_glLineStipple,
+        ENTRY_glMaterialf,
+        ENTRY_glMaterialfv,
+        ENTRY_glMateriali,
+        ENTRY_glMaterialiv,
+        ENTRY_glPolygonStipple,
+        ENTRY_glShadeModel,
+        ENTRY_glTexEnvf,
+        ENTRY_glTexEnvfv,
+        ENTRY_glTexEnvi,
+        ENTRY_glTexEnviv,
+        ENTRY_glTexGend,
+        ENTRY_glTexGendv,
+        ENTRY_glTexGenf,
+        ENTRY_glTexGenfv,
+        ENTRY_glTexGeni,
+        ENTRY_glTexGeniv,
+        ENTRY_glFeedbackBuffer,
+        ENTRY_glSelectBuffer,
+        ENTRY_glRenderMode,
+        ENTRY_glInitNames,
+        ENTRY_glLoadName,
+        ENTRY_glPassThrough,
+        ENTRY_glPopName,
+        ENTRY_glPushName,
+        ENTRY_glClearAccum,
+        ENTRY_glClearIndex,
+        ENTRY_glIndexMask,
+        ENTRY_glAccum,
+        ENTRY_glPopAttrib,
+        ENTRY_glPushAttrib,
+        ENTRY_glMap1d,
+        ENTRY_glMap1f,
+        ENTRY_glMap2d,
+        ENTRY_glMap2f,
+        ENTRY_glMapGrid1d,
+        ENTRY_glMapGrid1f,
+        ENTRY_glMapGrid2d,
+        ENTRY_glMapGrid2f,
+        ENTRY_glEvalCoord1d,
+        ENTRY_glEvalCoord1dv,
+        ENTRY_glEvalCoord1f,
+        ENTRY_glEvalCoord1fv,
+        ENTRY_glEvalCoord2d,
+        ENTRY_glEvalCoord2dv,
+        ENTRY_glEvalCoord2f,
+        ENTRY_glEvalCoord2fv,
+        ENTRY_glEvalMesh1,
+        ENTRY_glEvalPoint1,
+        ENTRY_glEvalMesh2,
+        ENTRY_glEvalPoint2,
+        ENTRY_glAlphaFunc,
+        ENTRY_glPixelZoom,
+        ENTRY_glPixelTransferf,
+        ENTRY_glPixelTransferi,
+        ENTRY_glPixelMapfv,
+        ENTRY_glPixelMapuiv,
+        ENTRY_glPixelMapusv,
+        ENTRY_glCopyPixels,
+        ENTRY_glDrawPixels,
+        ENTRY_glGetClipPlane,
+        ENTRY_glGetLightfv,
+        ENTRY_glGetLightiv,
+        ENTRY_glGetMapdv,
+        ENTRY_glGetMapfv,
+        ENTRY_glGetMapiv,
+        ENTRY_glGetMaterialfv,
+        ENTRY_glGetMaterialiv,
+        ENTRY_glGetPixelMapfv,
+        ENTRY_glGetPixelMapuiv,
+        ENTRY_glGetPixelMapusv,
+        ENTRY_glGetPolygonStipple,
+        ENTRY_glGetTexEnvfv,
+        ENTRY_glGetTexEnviv,
+        ENTRY_glGetTexGendv,
+        ENTRY_glGetTexGenfv,
+        ENTRY_glGetTexGeniv,
+        ENTRY_glIsList,
+        ENTRY_glFrustum,
+        ENTRY_glLoadIdentity,
+        ENTRY_glLoadMatrixf,
+        ENTRY_glLoadMatrixd,
+        ENTRY_glMatrixMode,
+        ENTRY_glMultMatrixf,
+        ENTRY_glMultMatrixd,
+        ENTRY_glOrtho,
+        ENTRY_glPopMatrix,
+        ENTRY_glPushMatrix,
+        ENTRY_glRotated,
+        ENTRY_glRotatef,
+        ENTRY_glScaled,
+        ENTRY_glScalef,
+        ENTRY_glTranslated,
+        ENTRY_glTranslatef,
+        ENTRY_glDrawArrays,
+        ENTRY_glDrawElements,
+        ENTRY_glGetPointerv,
+        ENTRY_glPolygonOffset,
+        ENTRY_glCopyTexImage1D,
+        ENTRY_glCopyTexImage2D,
+        ENTRY_glCopyTexSubImage1D,
+        ENTRY_glCopyTexSubImage2D,
+        ENTRY_glTexSubImage1D,
+        ENTRY_glTexSubImage2D,
+        ENTRY_glBindTexture,
+        ENTRY_glDeleteTextures,
+        ENTRY_glGenTextures,
+        ENTRY_glIsTexture,
+        ENTRY_glArrayElement,
+        ENTRY_glColorPointer,
+        ENTRY_glDisableClientState,
+        ENTRY_glEdgeFlagPointer,
+        ENTRY_glEnableClientState,
+        ENTRY_glIndexPointer,
+        ENTRY_glInterleavedArrays,
+        ENTRY_glNormalPointer,
+        ENTRY_glTexCoordPointer,
+        ENTRY_glVertexPointer,
+        ENTRY_glAreTexturesResident,
+        ENTRY_glPrioritizeTextures,
+        ENTRY_glIndexub,
+        ENTRY_glIndexubv,
+        ENTRY_glPopClientAttrib,
+        ENTRY_glPushClientAttrib,
+        ENTRY_glDrawRangeElements,
+        ENTRY_glTexImage3D,
+        ENTRY_glTexSubImage3D,
+        ENTRY_glCopyTexSubImage3D,
+        ENTRY_glActiveTexture,
+        ENTRY_glSampleCoverage,
+        ENTRY_glCompressedTexImage3D,
+        ENTRY_glCompressedTexImage2D,
+        ENTRY_glCompressedTexImage1D,
+        ENTRY_glCompressedTexSubImage3D,
+        ENTRY_glCompressedTexSubImage2D,
+        ENTRY_glCompressedTexSubImage1D,
+        ENTRY_glGetCompressedTexImage,
+        ENTRY_glClientActiveTexture,
+        ENTRY_glMultiTexCoord1d,
+        ENTRY_glMultiTexCoord1dv,
+        ENTRY_glMultiTexCoord1f,
+        ENTRY_glMultiTexCoord1fv,
+        ENTRY_glMultiTexCoord1i,
+        ENTRY_glMultiTexCoord1iv,
+        ENTRY_glMultiTexCoord1s,
+        ENTRY_glMultiTexCoord1sv,
+        ENTRY_glMultiTexCoord2d,
+        ENTRY_glMultiTexCoord2dv,
+        ENTRY_glMultiTexCoord2f,
+        ENTRY_glMultiTexCoord2fv,
+        ENTRY_glMultiTexCoord2i,
+        ENTRY_glMultiTexCoord2iv,
+        ENTRY_glMultiTexCoord2s,
+        ENTRY_glMultiTexCoord2sv,
+        ENTRY_glMultiTexCoord3d,
+        ENTRY_glMultiTexCoord3dv,
+        ENTRY_glMultiTexCoord3f,
+        ENTRY_glMultiTexCoord3fv,
+        ENTRY_glMultiTexCoord3i,
+        ENTRY_glMultiTexCoord3iv,
+        ENTRY_glMultiTexCoord3s,
+        ENTRY_glMultiTexCoord3sv,
+        ENTRY_glMultiTexCoord4d,
+        ENTRY_glMultiTexCoord4dv,
+        ENTRY_glMultiTexCoord4f,
+        ENTRY_glMultiTexCoord4fv,
+        ENTRY_glMultiTexCoord4i,
+        ENTRY_glMultiTexCoord4iv,
+        ENTRY_glMultiTexCoord4s,
+        ENTRY_glMultiTexCoord4sv,
+        ENTRY_glLoadTransposeMatrixf,
+        ENTRY_glLoadTransposeMatrixd,
+        ENTRY_glMultTransposeMatrixf,
+        ENTRY_glMultTransposeMatrixd,
+        ENTRY_glBlendFuncSeparate,
+        ENTRY_glMultiDrawArrays,
+        ENTRY_glMultiDrawElements,
+        ENTRY_glPointParameterf,
+        ENTRY_glPointParameterfv,
+        ENTRY_glPointParameteri,
+        ENTRY_glPointParameteriv,
+        ENTRY_glFogCoordf,
+        ENTRY_glFogCoordfv,
+        ENTRY_glFogCoordd,
+        ENTRY_glFogCoorddv,
+        ENTRY_glFogCoordPointer,
+        ENTRY_glSecondaryColor3b,
+        ENTRY_glSecondaryColor3bv,
+        ENTRY_glSecondaryColor3d,
+        ENTRY_glSecondaryColor3dv,
+        ENTRY_glSecondaryColor3f,
+        ENTRY_glSecondaryColor3fv,
+        ENTRY_glSecondaryColor3i,
+        ENTRY_glSecondaryColor3iv,
+        ENTRY_glSecondaryColor3s,
+        ENTRY_glSecondaryColor3sv,
+        ENTRY_glSecondaryColor3ub,
+        ENTRY_glSecondaryColor3ubv,
+        ENTRY_glSecondaryColor3ui,
+        ENTRY_glSecondaryColor3uiv,
+        ENTRY_glSecondaryColor3us,
+        ENTRY_glSecondaryColor3usv,
+        ENTRY_glSecondaryColorPointer,
+        ENTRY_glWindowPos2d,
+        ENTRY_glWindowPos2dv,
+        ENTRY_glWindowPos2f,
+        ENTRY_glWindowPos2fv,
+        ENTRY_glWindowPos2i,
+        ENTRY_glWindowPos2iv,
+        ENTRY_glWindowPos2s,
+        ENTRY_glWindowPos2sv,
+        ENTRY_glWindowPos3d,
+        ENTRY_glWindowPos3dv,
+        ENTRY_glWindowPos3f,
+        ENTRY_glWindowPos3fv,
+        ENTRY_glWindowPos3i,
+        ENTRY_glWindowPos3iv,
+        ENTRY_glWindowPos3s,
+        ENTRY_glWindowPos3sv,
+        ENTRY_glBlendColor,
+        ENTRY_glBlendEquation,
+        ENTRY_glGenQueries,
+        ENTRY_glDeleteQueries,
+        ENTRY_glIsQuery,
+        ENTRY_glBeginQuery,
+        ENTRY_glEndQuery,
+        ENTRY_glGetQueryiv,
+        ENTRY_glGetQueryObjectiv,
+        ENTRY_glGetQueryObjectuiv,
+        ENTRY_glBindBuffer,
+        ENTRY_glDeleteBuffers,
+        ENTRY_glGenBuffers,
+        ENTRY_glIsBuffer,
+        ENTRY_glBufferData,
+        ENTRY_glBufferSubData,
+        ENTRY_glGetBufferSubData,
+        ENTRY_glMapBuffer,
+        ENTRY_glUnmapBuffer,
+        ENTRY_glGetBufferParameteriv,
+        ENTRY_glGetBufferPointerv,
+        ENTRY_glBlendEquationSeparate,
+        ENTRY_glDrawBuffers,
+        ENTRY_glStencilOpSeparate,
+        ENTRY_glStencilFuncSeparate,
+        ENTRY_glStencilMaskSeparate,
+        ENTRY_glAttachShader,
+        ENTRY_glBindAttribLocation,
+        ENTRY_glCompileShader,
+        ENTRY_glCreateProgram,
+        ENTRY_glCreateShader,
+        ENTRY_glDeleteProgram,
+        ENTRY_glDeleteShader,
+        ENTRY_glDetachShader,
+        ENTRY_glDisableVertexAttribArray,
+        ENTRY_glEnableVertexAttribArray,
+        ENTRY_glGetActiveAttrib,
+        ENTRY_glGetActiveUniform,
+        ENTRY_glGetAttachedShaders,
+        ENTRY_glGetAttribLocation,
+        ENTRY_glGetProgramiv,
+        ENTRY_glGetProgramInfoLog,
+        ENTRY_glGetShaderiv,
+        ENTRY_glGetShaderInfoLog,
+        ENTRY_glGetShaderSource,
+        ENTRY_glGetUniformLocation,
+        ENTRY_glGetUniformfv,
+        ENTRY_glGetUniformiv,
+        ENTRY_glGetVertexAttribdv,
+        ENTRY_glGetVertexAttribfv,
+        ENTRY_glGetVertexAttribiv,
+        ENTRY_glGetVertexAttribPointerv,
+        ENTRY_glIsProgram,
+        ENTRY_glIsShader,
+        ENTRY_glLinkProgram,
+        ENTRY_glShaderSource,
+        ENTRY_glUseProgram,
+        ENTRY_glUniform1f,
+        ENTRY_glUniform2f,
+        ENTRY_glUniform3f,
+        ENTRY_glUniform4f,
+        ENTRY_glUniform1i,
+        ENTRY_glUniform2i,
+        ENTRY_glUniform3i,
+        ENTRY_glUniform4i,
+        ENTRY_glUniform1fv,
+        ENTRY_glUniform2fv,
+        ENTRY_glUniform3fv,
+        ENTRY_glUniform4fv,
+        ENTRY_glUniform1iv,
+        ENTRY_glUniform2iv,
+        ENTRY_glUniform3iv,
+        ENTRY_glUniform4iv,
+        ENTRY_glUniformMatrix2fv,
+        ENTRY_glUniformMatrix3fv,
+        ENTRY_glUniformMatrix4fv,
+        ENTRY_glValidateProgram,
+        ENTRY_glVertexAttrib1d,
+        ENTRY_glVertexAttrib1dv,
+        ENTRY_glVertexAttrib1f,
+        ENTRY_glVertexAttrib1fv,
+        ENTRY_glVertexAttrib1s,
+        ENTRY_glVertexAttrib1sv,
+        ENTRY_glVertexAttrib2d,
+        ENTRY_glVertexAttrib2dv,
+        ENTRY_glVertexAttrib2f,
+        ENTRY_glVertexAttrib2fv,
+        ENTRY_glVertexAttrib2s,
+        ENTRY_glVertexAttrib2sv,
+        ENTRY_glVertexAttrib3d,
+        ENTRY_glVertexAttrib3dv,
+        ENTRY_glVertexAttrib3f,
+        ENTRY_glVertexAttrib3fv,
+        ENTRY_glVertexAttrib3s,
+        ENTRY_glVertexAttrib3sv,
+        ENTRY_glVertexAttrib4Nbv,
+        ENTRY_glVertexAttrib4Niv,
+        ENTRY_glVertexAttrib4Nsv,
+        ENTRY_glVertexAttrib4Nub,
+        ENTRY_glVertexAttrib4Nubv,
+        ENTRY_glVertexAttrib4Nuiv,
+        ENTRY_glVertexAttrib4Nusv,
+        ENTRY_glVertexAttrib4bv,
+        ENTRY_glVertexAttrib4d,
+        ENTRY_glVertexAttrib4dv,
+        ENTRY_glVertexAttrib4f,
+        ENTRY_glVertexAttrib4fv,
+        ENTRY_glVertexAttrib4iv,
+        ENTRY_glVertexAttrib4s,
+        ENTRY_glVertexAttrib4sv,
+        ENTRY_glVertexAttrib4ubv,
+        ENTRY_glVertexAttrib4uiv,
+        ENTRY_glVertexAttrib4usv,
+        ENTRY_glVertexAttribPointer,
+        ENTRY_glUniformMatrix2x3fv,
+        ENTRY_glUniformMatrix3x2fv,
+        ENTRY_glUniformMatrix2x4fv,
+        ENTRY_glUniformMatrix4x2fv,
+        ENTRY_glUniformMatrix3x4fv,
+        ENTRY_glUniformMatrix4x3fv,
+        ENTRY_glColorMaski,
+        ENTRY_glGetBooleani_v,
+        ENTRY_glGetIntegeri_v,
+        ENTRY_glEnablei,
+        ENTRY_glDisablei,
+        ENTRY_glIsEnabledi,
+        ENTRY_glBeginTransformFeedback,
+        ENTRY_glEndTransformFeedback,
+        ENTRY_glBindBufferRange,
+        ENTRY_glBindBufferBase,
+        ENTRY_glTransformFeedbackVaryings,
+        ENTRY_glGetTransformFeedbackVarying,
+        ENTRY_glClampColor,
+        ENTRY_glBeginConditionalRender,
+        ENTRY_glEndConditionalRender,
+        ENTRY_glVertexAttribIPointer,
+        ENTRY_glGetVertexAttribIiv,
+        ENTRY_glGetVertexAttribIuiv,
+        ENTRY_glVertexAttribI1i,
+        ENTRY_glVertexAttribI2i,
+        ENTRY_glVertexAttribI3i,
+        ENTRY_glVertexAttribI4i,
+        ENTRY_glVertexAttribI1ui,
+        ENTRY_glVertexAttribI2ui,
+        ENTRY_glVertexAttribI3ui,
+        ENTRY_glVertexAttribI4ui,
+        ENTRY_glVertexAttribI1iv,
+        ENTRY_glVertexAttribI2iv,
+        ENTRY_glVertexAttribI3iv,
+        ENTRY_glVertexAttribI4iv,
+        ENTRY_glVertexAttribI1uiv,
+        ENTRY_glVertexAttribI2uiv,
+        ENTRY_glVertexAttribI3uiv,
+        ENTRY_glVertexAttribI4uiv,
+        ENTRY_glVertexAttribI4bv,
+        ENTRY_glVertexAttribI4sv,
+        ENTRY_glVertexAttribI4ubv,
+        ENTRY_glVertexAttribI4usv,
+        ENTRY_glGetUniformuiv,
+        ENTRY_glBindFragDataLocation,
+        ENTRY_glGetFragDataLocation,
+        ENTRY_glUniform1ui,
+        ENTRY_glUniform2ui,
+        ENTRY_glUniform3ui,
+        ENTRY_glUniform4ui,
+        ENTRY_glUniform1uiv,
+        ENTRY_glUniform2uiv,
+        ENTRY_glUniform3uiv,
+        ENTRY_glUniform4uiv,
+        ENTRY_glTexParameterIiv,
+        ENTRY_glTexParameterIuiv,
+        ENTRY_glGetTexParameterIiv,
+        ENTRY_glGetTexParameterIuiv,
+        ENTRY_glClearBufferiv,
+        ENTRY_glClearBufferuiv,
+        ENTRY_glClearBufferfv,
+        ENTRY_glClearBufferfi,
+        ENTRY_glGetStringi,
+        ENTRY_glIsRenderbuffer,
+        ENTRY_glBindRenderbuffer,
+        ENTRY_glDeleteRenderbuffers,
+        ENTRY_glGenRenderbuffers,
+        ENTRY_glRenderbufferStorage,
+        ENTRY_glGetRenderbufferParameteriv,
+        ENTRY_glIsFramebuffer,
+        ENTRY_glBindFramebuffer,
+        ENTRY_glDeleteFramebuffers,
+        ENTRY_glGenFramebuffers,
+        ENTRY_glCheckFramebufferStatus,
+        ENTRY_glFramebufferTexture1D,
+        ENTRY_glFramebufferTexture2D,
+        ENTRY_glFramebufferTexture3D,
+        ENTRY_glFramebufferRenderbuffer,
+        ENTRY_glGetFramebufferAttachmentParameteriv,
+        ENTRY_glGenerateMipmap,
+        ENTRY_glBlitFramebuffer,
+        ENTRY_glRenderbufferStorageMultisample,
+        ENTRY_glFramebufferTextureLayer,
+        ENTRY_glMapBufferRange,
+        ENTRY_glFlushMappedBufferRange,
+        ENTRY_glBindVertexArray,
+        ENTRY_glDeleteVertexArrays,
+        ENTRY_glGenVertexArrays,
+        ENTRY_glIsVertexArray,
+        ENTRY_glDrawArraysInstanced,
+        ENTRY_glDrawElementsInstanced,
+        ENTRY_glTexBuffer,
+        ENTRY_glPrimitiveRestartIndex,
+        ENTRY_glCopyBufferSubData,
+        ENTRY_glGetUniformIndices,
+        ENTRY_glGetActiveUniformsiv,
+        ENTRY_glGetActiveUniformName,
+        ENTRY_glGetUniformBlockIndex,
+        ENTRY_glGetActiveUniformBlockiv,
+        ENTRY_glGetActiveUniformBlockName,
+        ENTRY_glUniformBlockBinding,
+        ENTRY_glDrawElementsBaseVertex,
+        ENTRY_glDrawRangeElementsBaseVertex,
+        ENTRY_glDrawElementsInstancedBaseVertex,
+        ENTRY_glMultiDrawElementsBaseVertex,
+        ENTRY_glProvokingVertex,
+        ENTRY_glFenceSync,
+        ENTRY_glIsSync,
+        ENTRY_glDeleteSync,
+        ENTRY_glClientWaitSync,
+        ENTRY_glWaitSync,
+        ENTRY_glGetInteger64v,
+        ENTRY_glGetSynciv,
+        ENTRY_glGetInteger64i_v,
+        ENTRY_glGetBufferParameteri64v,
+        ENTRY_glFramebufferTexture,
+        ENTRY_glTexImage2DMultisample,
+        ENTRY_glTexImage3DMultisample,
+        ENTRY_glGetMultisamplefv,
+        ENTRY_glSampleMaski,
+        ENTRY_glBindFragDataLocationIndexed,
+        ENTRY_glGetFragDataIndex,
+        ENTRY_glGenSamplers,
+        ENTRY_glDeleteSamplers,
+        ENTRY_glIsSampler,
+        ENTRY_glBindSampler,
+        ENTRY_glSamplerParameteri,
+        ENTRY_glSamplerParameteriv,
+        ENTRY_glSamplerParameterf,
+        ENTRY_glSamplerParameterfv,
+        ENTRY_glSamplerParameterIiv,
+        ENTRY_glSamplerParameterIuiv,
+        ENTRY_glGetSamplerParameteriv,
+        ENTRY_glGetSamplerParameterIiv,
+        ENTRY_glGetSamplerParameterfv,
+        ENTRY_glGetSamplerParameterIuiv,
+        ENTRY_glQueryCounter,
+        ENTRY_glGetQueryObjecti64v,
+        ENTRY_glGetQueryObjectui64v,
+        ENTRY_glVertexAttribDivisor,
+        ENTRY_glVertexAttribP1ui,
+        ENTRY_glVertexAttribP1uiv,
+        ENTRY_glVertexAttribP2ui,
+        ENTRY_glVertexAttribP2uiv,
+        ENTRY_glVertexAttribP3ui,
+        ENTRY_glVertexAttribP3uiv,
+        ENTRY_glVertexAttribP4ui,
+        ENTRY_glVertexAttribP4uiv,
+        ENTRY_glVertexP2ui,
+        ENTRY_glVertexP2uiv,
+        ENTRY_glVertexP3ui,
+        ENTRY_glVertexP3uiv,
+        ENTRY_glVertexP4ui,
+        ENTRY_glVertexP4uiv,
+        ENTRY_glTexCoordP1ui,
+        ENTRY_glTexCoordP1uiv,
+        ENTRY_glTexCoordP2ui,
+        ENTRY_glTexCoordP2uiv,
+        ENTRY_glTexCoordP3ui,
+        ENTRY_glTexCoordP3uiv,
+        ENTRY_glTexCoordP4ui,
+        ENTRY_glTexCoordP4uiv,
+        ENTRY_glMultiTexCoordP1ui,
+        ENTRY_glMultiTexCoordP1uiv,
+        ENTRY_glMultiTexCoordP2ui,
+        ENTRY_glMultiTexCoordP2uiv,
+        ENTRY_glMultiTexCoordP3ui,
+        ENTRY_glMultiTexCoordP3uiv,
+        ENTRY_glMultiTexCoordP4ui,
+        ENTRY_glMultiTexCoordP4uiv,
+        ENTRY_glNormalP3ui,
+        ENTRY_glNormalP3uiv,
+        ENTRY_glColorP3ui,
+        ENTRY_glColorP3uiv,
+        ENTRY_glColorP4ui,
+        ENTRY_glColorP4uiv,
+        ENTRY_glSecondaryColorP3ui,
+        ENTRY_glSecondaryColorP3uiv,
+        ENTRY_COUNT
+    };
+
+    // ------------------------------------------------------------------------
+    inline const char* entryName(uint32_t entry)
+    {
+        static const char* const names[ENTRY_COUNT] = {
+            "glCullFace",
+            "glFrontFace",
+            "glHint",
+            "glLineWidth",
+            "glPointSize",
+            "glPolygonMode",
+            "glScissor",
+            "glTexParameterf",
+            "glTexParameterfv",
+            "glTexParameteri",
+            "glTexParameteriv",
+            "glTexImage1D",
+            "glTexImage2D",
+            "glDrawBuffer",
+            "glClear",
+            "glClearColor",
+            "glClearStencil",
+            "glClearDepth",
+            "glStencilMask",
+            "glColorMask",
+            "glDepthMask",
+            "glDisable",
+            "glEnable",
+            "glFinish",
+            "glFlush",
+            "glBlendFunc",
+            "glLogicOp",
+            "glStencilFunc",
+            "glStencilOp",
+            "glDepthFunc",
+            "glPixelStoref",
+            "glPixelStorei",
+            "glReadBuffer",
+            "glReadPixels",
+            "glGetBooleanv",
+            "glGetDoublev",
+            "glGetError",
+            "glGetFloatv",
+            "glGetIntegerv",
+            "glGetString",
+            "glGetTexImage",
+            "glGetTexParameterfv",
+            "glGetTexParameteriv",
+            "glGetTexLevelParameterfv",
+            "glGetTexLevelParameteriv",
+            "glIsEnabled",
+            "glDepthRange",
+            "glViewport",
+            "glNewList",
+            "glEndList",
+            "glCallList",
+            "glCallLists",
+            "glDeleteLists",
+            "glGenLists",
+            "glListBase",
+            "glBegin",
+            "glBitmap",
+            "glColor3b",
+            "glColor3bv",
+            "glColor3d",
+            "glColor3dv",
+            "glColor3f",
+            "glColor3fv",
+            "glColor3i",
+            "glColor3iv",
+            "glColor3s",
+            "glColor3sv",
+            "glColor3ub",
+            "glColor3ubv",
+            "glColor3ui",
+            "glColor3uiv",
+            "glColor3us",
+            "glColor3usv",
+            "glColor4b",
+            "glColor4bv",
+            "glColor4d",
+            "glColor4dv",
+            "glColor4f",
+            "glColor4fv",
+            "glColor4i",
+            "glColor4iv",
+            "glColor4s",
+            "glColor4sv",
+            "glColor4ub",
+            "glColor4ubv",
+            "glColor4ui",
+            "glColor4uiv",
+            "glColor4us",
+            "glColor4usv",
+            "glEdgeFlag",
+            "glEdgeFlagv",
+            "glEnd",
+            "glIndexd",
+            "glIndexdv",
+            "glIndexf",
+            "glIndexfv",
+            "glIndexi",
+            "glIndexiv",
+            "glIndexs",
+            "glIndexsv",
+            "glNormal3b",
+            "glNormal3bv",
+            "glNormal3d",
+            "glNormal3dv",
+            "glNormal3f",
+            "glNormal3fv",
+            "glNormal3i",
+            "glNormal3iv",
+            "glNormal3s",
+            "glNormal3sv",
+            "glRasterPos2d",
+            "glRasterPos2dv",
+            "glRasterPos2f",
+            "glRasterPos2fv",
+            "glRasterPos2i",
+            "glRasterPos2iv",
+            "glRasterPos2s",
+            "glRasterPos2sv",
+            "glRasterPos3d",
+            "glRasterPos3dv",
+            "glRasterPos3f",
+            "glRasterPos3fv",
+            "glRasterPos3i",
+            "glRasterPos3iv",
+            "glRasterPos3s",
+            "glRasterPos3sv",
+            "glRasterPos4d",
+            "glRasterPos4dv",
+            "glRasterPos4f",
+            "glRasterPos4fv",
+            "glRasterPos4i",
+            "glRasterPos4iv",
+            "glRasterPos4s",
+            "glRasterPos4sv",
+            "glRectd",
+            "glRectdv",
+            "glRectf",
+            "glRectfv",
+            "glRecti",
+            "glRectiv",
+            "glRects",
+            "glRectsv",
+            "glTexCoord1d",
+            "glTexCoord1dv",
+            "glTexCoord1f",
+            "glTexCoord1fv",
+            "glTexCoord1i",
+            "glTexCoord1iv",
+            "glTexCoord1s",
+            "glTexCoord1sv",
+            "glTexCoord2d",
+            "glTexCoord2dv",
+            "glTexCoord2f",
+            "glTexCoord2fv",
+            "glTexCoord2i",
+            "glTexCoord2iv",
+            "glTexCoord2s",
+            "glTexCoord2sv",
+            "glTexCoord3d",
+            "glTexCoord3dv",
+            "glTexCoord3f",
+            "glTexCoord3fv",
+            "glTexCoord3i",
+            "glTexCoord3iv",
+            "glTexCoord3s",
+            "glTexCoord3sv",
+            "glTexCoord4d",
+            "glTexCoord4dv",
+            "glTexCoord4f",
+            "glTexCoord4fv",
+            "glTexCoord4i",
+            "glTexCoord4iv",
+            "glTexCoord4s",
+            "glTexCoord4sv",
+            "glVertex2d",
+            "glVertex2dv",
+            "glVertex2f",
+            "glVertex2fv",
+            "glVertex2i",
+            "glVertex2iv",
+            "glVertex2s",
+            "glVertex2sv",
+            "glVertex3d",
+            "glVertex3dv",
+            "glVertex3f",
+            "glVertex3fv",
+            "glVertex3i",
+            "glVertex3iv",
+            "glVertex3s",
+            "glVertex3sv",
+            "glVertex4d",
+            "glVertex4dv",
+            "glVertex4f",
+            "glVertex4fv",
+            "glVertex4i",
+            "glVertex4iv",
+            "glVertex4s",
+            "glVertex4sv",
+            "glClipPlane",
+            "glColorMaterial",
+            "glFogf",
+            "glFogfv",
+            "glFogi",
+            "glFogiv",
+            "glLightf",
+            "glLightfv",
+            "glLighti",
+            "glLightiv",
+            "glLightModelf",
+            "glLightModelfv",
+            "glLightModeli",
+            "glLightModeliv",
+            "glLineStipple",
+            "glMaterialf",
+            "glMaterialfv",
+            "glMateriali",
+            "glMaterialiv",
+            "glPolygonStipple",
+            "glShadeModel",
+            "glTexEnvf",
+            "glTexEnvfv",
+            "glTexEnvi",
+            "glTexEnviv",
+            "glTexGend",
+            "glTexGendv",
+            "glTexGenf",
+            "glTexGenfv",
+            "glTexGeni",
+            "glTexGeniv",
+            "glFeedbackBuffer",
+            "glSelectBuffer",
+            "glRenderMode",
+            "glInitNames",
+            "glLoadName",
+            "glPassThrough",
+            "glPopName",
+            "glPushName",
+            "glClearAccum",
+            "glClearIndex",
+            "glIndexMask",
+            "glAccum",
+            "glPopAttrib",
+            "glPushAttrib",
+            "glMap1d",
+            "glMap1f",
+            "glMap2d",
+            "glMap2f",
+            "glMapGrid1d",
+            "glMapGrid1f",
+            "glMapGrid2d",
+            "glMapGrid2f",
+            "glEvalCoord1d",
+            "glEvalCoord1dv",
+            "glEvalCoord1f",
+            "glEvalCoord1fv",
+            "glEvalCoord2d",
+            "glEvalCoord2dv",
+            "glEvalCoord2f",
+            "glEvalCoord2fv",
+            "glEvalMesh1",
+            "glEvalPoint1",
+            "glEvalMesh2",
+            "glEvalPoint2",
+            "glAlphaFunc",
+            "glPixelZoom",
+            "glPixelTransferf",
+            "glPixelTransferi",
+            "glPixelMapfv",
+            "glPixelMapuiv",
+            "glPixelMapusv",
+            "glCopyPixels",
+            "glDrawPixels",
+            "glGetClipPlane",
+            "glGetLightfv",
+            "glGetLightiv",
+            "glGetMapdv",
+            "glGetMapfv",
+            "glGetMapiv",
+            "glGetMaterialfv",
+            "glGetMaterialiv",
+            "glGetPixelMapfv",
+            "glGetPixelMapuiv",
+            "glGetPixelMapusv",
+            "glGetPolygonStipple",
+            "glGetTexEnvfv",
+            "glGetTexEnviv",
+            "glGetTexGendv",
+            "glGetTexGenfv",
+            "glGetTexGeniv",
+            "glIsList",
+            "glFrustum",
+            "glLoadIdentity",
+            "glLoadMatrixf",
+            "glLoadMatrixd",
+            "glMatrixMode",
+            "glMultMatrixf",
+            "glMultMatrixd",
+            "glOrtho",
+            "glPopMatrix",
+            "glPushMatrix",
+            "glRotated",
+            "glRotatef",
+            "glScaled",
+            "glScalef",
+            "glTranslated",
+            "glTranslatef",
+            "glDrawArrays",
+            "glDrawElements",
+            "glGetPointerv",
+            "glPolygonOffset",
+            "glCopyTexImage1D",
+            "glCopyTexImage2D",
+            "glCopyTexSubImage1D",
+            "glCopyTexSubImage2D",
+            "glTexSubImage1D",
+            "glTexSubImage2D",
+            "glBindTexture",
+            "glDeleteTextures",
+            "glGenTextures",
+            "glIsTexture",
+            "glArrayElement",
+            "glColorPointer",
+            "glDisableClientState",
+            "glEdgeFlagPointer",
+            "glEnableClientState",
+            "glIndexPointer",
+            "glInterleavedArrays",
+            "glNormalPointer",
+            "glTexCoordPointer",
+            "glVertexPointer",
+            "glAreTexturesResident",
+            "glPrioritizeTextures",
+            "glIndexub",
+            "glIndexubv",
+            "glPopClientAttrib",
+            "glPushClientAttrib",
+            "glDrawRangeElements",
+            "glTexImage3D",
+            "glTexSubImage3D",
+            "glCopyTexSubImage3D",
+            "glActiveTexture",
+            "glSampleCoverage",
+            "glCompressedTexImage3D",
+            "glCompressedTexImage2D",
+            "glCompressedTexImage1D",
+            "glCompressedTexSubImage3D",
+            "glCompressedTexSubImage2D",
+            "glCompressedTexSubImage1D",
+            "glGetCompressedTexImage",
+            "glClientActiveTexture",
+            "glMultiTexCoord1d",
+            "glMultiTexCoord1dv",
+            "glMultiTexCoord1f",
+            "glMultiTexCoord1fv",
+            "glMultiTexCoord1i",
+            "glMultiTexCoord1iv",
+            "glMultiTexCoord1s",
+            "glMultiTexCoord1sv",
+            "glMultiTexCoord2d",
+            "glMultiTexCoord2dv",
+            "glMultiTexCoord2f",
+            "glMultiTexCoord2fv",
+            "glMultiTexCoord2i",
+            "glMultiTexCoord2iv",
+            "glMultiTexCoord2s",
+            "glMultiTexCoord2sv",
+            "glMultiTexCoord3d",
+            "glMultiTexCoord3dv",
+            "glMultiTexCoord3f",
+            "glMultiTexCoord3fv",
+            "glMultiTexCoord3i",
+            "glMultiTexCoord3iv",
+            "glMultiTexCoord3s",
+            "glMultiTexCoord3sv",
+            "glMultiTexCoord4d",
+            "glMultiTexCoord4dv",
+            "glMultiTexCoord4f",
+            "glMultiTexCoord4fv",
+            "glMultiTexCoord4i",
+            "glMultiTexCoord4iv",
+            "glMultiTexCoord4s",
+            "glMultiTexCoord4sv",
+            "glLoadTransposeMatrixf",
+            "glLoadTransposeMatrixd",
+            "glMultTransposeMatrixf",
+            "glMultTransposeMatrixd",
+            "glBlendFuncSeparate",
+            "glMultiDrawArrays",
+            "glMultiDrawElements",
+            "glPointParameterf",
+            "glPointParameterfv",
+            "glPointParameteri",
+            "glPointParameteriv",
+            "glFogCoordf",
+            "glFogCoordfv",
+            "glFogCoordd",
+            "glFogCoorddv",
+            "glFogCoordPointer",
+            "glSecondaryColor3b",
+            "glSecondaryColor3bv",
+            "glSecondaryColor3d",
+            "glSecondaryColor3dv",
+            "glSecondaryColor3f",
+            "glSecondaryColor3fv",
+            "glSecondaryColor3i",
+            "glSecondaryColor3iv",
+            "glSecondaryColor3s",
+            "glSecondaryColor3sv",
+            "glSecondaryColor3ub",
+            "glSecondaryColor3ubv",
+            "glSecondaryColor3ui",
+            "glSecondaryColor3uiv",
+            "glSecondaryColor3us",
+            "glSecondaryColor3usv",
+            "glSecondaryColorPointer",
+            "glWindowPos2d",
+            "glWindowPos2dv",
+            "glWindowPos2f",
+            "glWindowPos2fv",
+            "glWindowPos2i",
+            "glWindowPos2iv",
+            "glWindowPos2s",
+            "glWindowPos2sv",
+            "glWindowPos3d",
+            "glWindowPos3dv",
+            "glWindowPos3f",
+            "glWindowPos3fv",
+            "glWindowPos3i",
+            "glWindowPos3iv",
+            "glWindowPos3s",
+            "glWindowPos3sv",
+            "glBlendColor",
+            "glBlendEquation",
+            "glGenQueries",
+            "glDeleteQueries",
+            "glIsQuery",
+            "glBeginQuery",
+            "glEndQuery",
+            "glGetQueryiv",
+            "glGetQueryObjectiv",
+            "glGetQueryObjectuiv",
+            "glBindBuffer",
+            "glDeleteBuffers",
+            "glGenBuffers",
+            "glIsBuffer",
+            "glBufferData",
+            "glBufferSubData",
+            "glGetBufferSubData",
+            "glMapBuffer",
+            "glUnmapBuffer",
+            "glGetBufferParameteriv",
+            "glGetBufferPointerv",
+            "glBlendEquationSeparate",
+            "glDrawBuffers",
+            "glStencilOpSeparate",
+            "glStencilFuncSeparate",
+            "glStencilMaskSeparate",
+            "glAttachShader",
+            "glBindAttribLocation",
+            "glCompileShader",
+            "glCreateProgram",
+            "glCreateShader",
+            "glDeleteProgram",
+            "glDeleteShader",
+            "glDetachShader",
+            "glDisableVertexAttribArray",
+            "glEnableVertexAttribArray",
+            "glGetActiveAttrib",
+            "glGetActiveUniform",
+            "glGetAttachedShaders",
+            "glGetAttribLocation",
+            "glGetProgramiv",
+            "glGetProgramInfoLog",
+            "glGetShaderiv",
+            "glGetShaderInfoLog",
+            "glGetShaderSource",
+            "glGetUniformLocation",
+            "glGetUniformfv",
+            "glGetUniformiv",
+            "glGetVertexAttribdv",
+            "glGetVertexAttribfv",
+            "glGetVertexAttribiv",
+            "glGetVertexAttribPointerv",
+            "glIsProgram",
+            "glIsShader",
+            "glLinkProgram",
+            "glShaderSource",
+            "glUseProgram",
+            "glUniform1f",
+            "glUniform2f",
+            "glUniform3f",
+            "glUniform4f",
+            "glUniform1i",
+            "glUniform2i",
+            "glUniform3i",
+            "glUniform4i",
+            "glUniform1fv",
+            "glUniform2fv",
+            "glUniform3fv",
+            "glUniform4fv",
+            "glUniform1iv",
+            "glUniform2iv",
+            "glUniform3iv",
+            "glUniform4iv",
+            "glUniformMatrix2fv",
+            "glUniformMatrix3fv",
+            "glUniformMatrix4fv",
+            "glValidateProgram",
+            "glVertexAttrib1d",
+            "glVertexAttrib1dv",
+            "glVertexAttrib1f",
+            "glVertexAttrib1fv",
+            "glVertexAttrib1s",
+            "glVertexAttrib1sv",
+            "glVertexAttrib2d",
+            "glVertexAttrib2dv",
+            "glVertexAttrib2f",
+            "glVertexAttrib2fv",
+            "glVertexAttrib2s",
+            "glVertexAttrib2sv",
+            "glVertexAttrib3d",
+            "glVertexAttrib3dv",
+            "glVertexAttrib3f",
+            "glVertexAttrib3fv",
+            "glVertexAttrib3s",
+            "glVertexAttrib3sv",
+            "glVertexAttrib4Nbv",
+            "glVertexAttrib4Niv",
+            "glVertexAttrib4Nsv",
+            "glVertexAttrib4Nub",
+            "glVertexAttrib4Nubv",
+            "glVertexAttrib4Nuiv",
+            "glVertexAttrib4Nusv",
+            "glVertexAttrib4bv",
+            "glVertexAttrib4d",
+            "glVertexAttrib4dv",
+            "glVertexAttrib4f",
+            "glVertexAttrib4fv",
+            "glVertexAttrib4iv",
+            "glVertexAttrib4s",
+            "glVertexAttrib4sv",
+            "glVertexAttrib4ubv",
+            "glVertexAttrib4uiv",
+            "glVertexAttrib4usv",
+            "glVertexAttribPointer",
+            "glUniformMatrix2x3fv",
+            "glUniformMatrix3x2fv",
+            "glUniformMatrix2x4fv",
+            "glUniformMatrix4x2fv",
+            "glUniformMatrix3x4fv",
+            "glUniformMatrix4x3fv",
+            "glColorMaski",
+            "glGetBooleani_v",
+            "glGetIntegeri_v",
+            "glEnablei",
+            "glDisablei",
+            "glIsEnabledi",
+            "glBeginTransformFeedback",
+            "glEndTransformFeedback",
+            "glBindBufferRange",
+            "glBindBufferBase",
+            "glTransformFeedbackVaryings",
+            "glGetTransformFeedbackVarying",
+            "glClampColor",
+            "glBeginConditionalRender",
+            "glEndConditionalRender",
+            "glVertexAttribIPointer",
+            "glGetVertexAttribIiv",
+            "glGetVertexAttribIuiv",
+            "glVertexAttribI1i",
+            "glVertexAttribI2i",
+            "glVertexAttribI3i",
+            "glVertexAttribI4i",
+            "glVertexAttribI1ui",
+            "glVertexAttribI2ui",
+            "glVertexAttribI3ui",
+            "glVertexAttribI4ui",
+            "glVertexAttribI1iv",
+            "glVertexAttribI2iv",
+            "glVertexAttribI3iv",
+            "glVertexAttribI4iv",
+            "glVertexAttribI1uiv",
+            "glVertexAttribI2uiv",
+            "glVertexAttribI3uiv",
+            "glVertexAttribI4uiv",
+            "glVertexAttribI4bv",
+            "glVertexAttribI4sv",
+            "glVertexAttribI4ubv",
+            "glVertexAttribI4usv",
+            "glGetUniformuiv",
+            "glBindFragDataLocation",
+            "glGetFragDataLocation",
+            "glUniform1ui",
+            "glUniform2ui",
+            "glUniform3ui",
+            "glUniform4ui",
+            "glUniform1uiv",
+            "glUniform2uiv",
+            "glUniform3uiv",
+            "glUniform4uiv",
+            "glTexParameterIiv",
+            "glTexParameterIuiv",
+            "glGetTexParameterIiv",
+            "glGetTexParameterIuiv",
+            "glClearBufferiv",
+            "glClearBufferuiv",
+            "glClearBufferfv",
+            "glClearBufferfi",
+            "glGetStringi",
+            "glIsRenderbuffer",
+            "glBindRenderbuffer",
+            "glDeleteRenderbuffers",
+            "glGenRenderbuffers",
+            "glRenderbufferStorage",
+            "glGetRenderbufferParameteriv",
+            "glIsFramebuffer",
+            "glBindFramebuffer",
+            "glDeleteFramebuffers",
+            "glGenFramebuffers",
+            "glCheckFramebufferStatus",
+            "glFramebufferTexture1D",
+            "glFramebufferTexture2D",
+            "glFramebufferTexture3D",
+            "glFramebufferRenderbuffer",
+            "glGetFramebufferAttachmentParameteriv",
+            "glGenerateMipmap",
+            "glBlitFramebuffer",
+            "glRenderbufferStorageMultisample",
+            "glFramebufferTextureLayer",
+            "glMapBufferRange",
+            "glFlushMappedBufferRange",
+            "glBindVertexArray",
+            "glDeleteVertexArrays",
+            "glGenVertexArrays",
+            "glIsVertexArray",
+            "glDrawArraysInstanced",
+            "glDrawElementsInstanced",
+            "glTexBuffer",
+            "glPrimitiveRestartIndex",
+            "glCopyBufferSubData",
+            "glGetUniformIndices",
+            "glGetActiveUniformsiv",
+            "glGetActiveUniformName",
+            "glGetUniformBlockIndex",
+            "glGetActiveUniformBlockiv",
+            "glGetActiveUniformBlockName",
+            "glUniformBlockBinding",
+            "glDrawElementsBaseVertex",
+            "glDrawRangeElementsBaseVertex",
+            "glDrawElementsInstancedBaseVertex",
+            "glMultiDrawElementsBaseVertex",
+            "glProvokingVertex",
+            "glFenceSync",
+            "glIsSync",
+            "glDeleteSync",
+            "glClientWaitSync",
+            "glWaitSync",
+            "glGetInteger64v",
+            "glGetSynciv",
+            "glGetInteger64i_v",
+            "glGetBufferParameteri64v",
+            "glFramebufferTexture",
+            "glTexImage2DMultisample",
+            "glTexImage3DMultisample",
+            "glGetMultisamplefv",
+            "glSampleMaski",
+            "glBindFragDataLocationIndexed",
+            "glGetFragDataIndex",
+            "glGenSamplers",
+            "glDeleteSamplers",
+            "glIsSampler",
+            "glBindSampler",
+            "glSamplerParameteri",
+            "glSamplerParameteriv",
+            "glSamplerParameterf",
+            "glSamplerParameterfv",
+            "glSamplerParameterIiv",
+            "glSamplerParameterIuiv",
+            "glGetSamplerParameteriv",
+            "glGetSamplerParameterIiv",
+            "glGetSamplerParameterfv",
+            "glGetSamplerParameterIuiv",
+            "glQueryCounter",
+            "glGetQueryObjecti64v",
+            "glGetQueryObjectui64v",
+            "glVertexAttribDivisor",
+            "glVertexAttribP1ui",
+            "glVertexAttribP1uiv",
+            "glVertexAttribP2ui",
+            "glVertexAttribP2uiv",
+            "glVertexAttribP3ui",
+            "glVertexAttribP3uiv",
+            "glVertexAttribP4ui",
+            "glVertexAttribP4uiv",
+            "glVertexP2ui",
+            "glVertexP2uiv",
+            "glVertexP3ui",
+            "glVertexP3uiv",
+            "glVertexP4ui",
+            "glVertexP4uiv",
+            "glTexCoordP1ui",
+            "glTexCoordP1uiv",
+            "glTexCoordP2ui",
+            "glTexCoordP2uiv",
+            "glTexCoordP3ui",
+            "glTexCoordP3uiv",
+            "glTexCoordP4ui",
+            "glTexCoordP4uiv",
+            "glMultiTexCoordP1ui",
+            "glMultiTexCoordP1uiv",
+            "glMultiTexCoordP2ui",
+            "glMultiTexCoordP2uiv",
+            "glMultiTexCoordP3ui",
+            "glMultiTexCoordP3uiv",
+            "glMultiTexCoordP4ui",
+            "glMultiTexCoordP4uiv",
+            "glNormalP3ui",
+            "glNormalP3uiv",
+            "glColorP3ui",
+            "glColorP3uiv",
+            "glColorP4ui",
+            "glColorP4uiv",
+            "glSecondaryColorP3ui",
+            "glSecondaryColorP3uiv",
+        };
+        return entry < ENTRY_COUNT ? names[entry] : "";
+    }
+    inline GLCallCategory entryCategory(uint32_t entry)
+    {
+        static const GLCallCategory categories[ENTRY_COUNT] = {
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::State,
+            GLCallCategory::Clear,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::Sync,
+            GLCallCategory::Sync,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::Transfer,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Debug,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Transfer,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Object,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Object,
+            GLCallCategory::Object,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::State,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Clear,
+            GLCallCategory::Clear,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Draw,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Object,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Draw,
+            GLCallCategory::Draw,
+            GLCallCategory::Get,
+            GLCallCategory::State,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Bind,
+            GLCallCategory::Object,
+            GLCallCategory::Object,
+            GLCallCategory::Object,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::State,
+            GLCallCategory::Other,
+            GLCallCategory::State,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Draw,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Bind,
+            GLCallCategory::State,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::State,
+            GLCallCategory::Draw,
+            GLCallCategory::Draw,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::Object,
+            GLCallCategory::Object,
+            GLCallCategory::Object,
+            GLCallCategory::Query,
+            GLCallCategory::Query,
+            GLCallCategory::Query,
+            GLCallCategory::Query,
+            GLCallCategory::Query,
+            GLCallCategory::Bind,
+            GLCallCategory::Object,
+            GLCallCategory::Object,
+            GLCallCategory::Object,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::Shader,
+            GLCallCategory::Bind,
+            GLCallCategory::Shader,
+            GLCallCategory::Object,
+            GLCallCategory::Object,
+            GLCallCategory::Object,
+            GLCallCategory::Object,
+            GLCallCategory::Shader,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::Shader,
+            GLCallCategory::Shader,
+            GLCallCategory::Shader,
+            GLCallCategory::Shader,
+            GLCallCategory::Shader,
+            GLCallCategory::Shader,
+            GLCallCategory::Shader,
+            GLCallCategory::Shader,
+            GLCallCategory::Shader,
+            GLCallCategory::Shader,
+            GLCallCategory::Shader,
+            GLCallCategory::Shader,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Object,
+            GLCallCategory::Object,
+            GLCallCategory::Shader,
+            GLCallCategory::Shader,
+            GLCallCategory::Bind,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Shader,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::State,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::Object,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::Bind,
+            GLCallCategory::Bind,
+            GLCallCategory::Shader,
+            GLCallCategory::Get,
+            GLCallCategory::State,
+            GLCallCategory::Query,
+            GLCallCategory::Query,
+            GLCallCategory::State,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::Shader,
+            GLCallCategory::Bind,
+            GLCallCategory::Shader,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::Uniform,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Clear,
+            GLCallCategory::Clear,
+            GLCallCategory::Clear,
+            GLCallCategory::Clear,
+            GLCallCategory::Get,
+            GLCallCategory::Object,
+            GLCallCategory::Bind,
+            GLCallCategory::Object,
+            GLCallCategory::Object,
+            GLCallCategory::State,
+            GLCallCategory::Get,
+            GLCallCategory::Object,
+            GLCallCategory::Bind,
+            GLCallCategory::Object,
+            GLCallCategory::Object,
+            GLCallCategory::Get,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::Get,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Bind,
+            GLCallCategory::Object,
+            GLCallCategory::Object,
+            GLCallCategory::Object,
+            GLCallCategory::Draw,
+            GLCallCategory::Draw,
+            GLCallCategory::Transfer,
+            GLCallCategory::State,
+            GLCallCategory::Transfer,
+            GLCallCategory::Shader,
+            GLCallCategory::Shader,
+            GLCallCategory::Shader,
+            GLCallCategory::Shader,
+            GLCallCategory::Shader,
+            GLCallCategory::Shader,
+            GLCallCategory::Uniform,
+            GLCallCategory::Draw,
+            GLCallCategory::Draw,
+            GLCallCategory::Draw,
+            GLCallCategory::Draw,
+            GLCallCategory::State,
+            GLCallCategory::Sync,
+            GLCallCategory::Object,
+            GLCallCategory::Object,
+            GLCallCategory::Sync,
+            GLCallCategory::Sync,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::State,
+            GLCallCategory::Transfer,
+            GLCallCategory::Transfer,
+            GLCallCategory::Get,
+            GLCallCategory::State,
+            GLCallCategory::Bind,
+            GLCallCategory::Shader,
+            GLCallCategory::Object,
+            GLCallCategory::Object,
+            GLCallCategory::Object,
+            GLCallCategory::Bind,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Get,
+            GLCallCategory::Query,
+            GLCallCategory::Query,
+            GLCallCategory::Query,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::State,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+            GLCallCategory::Other,
+        };
+        return entry < ENTRY_COUNT ? categories[entry] : GLCallCategory::Other;
+    }
+
+    // the loaded pointers and this frame's calls, a template so the header
+    // can define them
+    template<typename Unused = void>
+    struct Table
+    {
+        static void* loaded[ENTRY_COUNT];
+        static uint32_t counts[ENTRY_COUNT];
+    };
+    template<typename Unused> void* Table<Unused>::loaded[ENTRY_COUNT] = {};
+    template<typename Unused> uint32_t Table<Unused>::counts[ENTRY_COUNT] = {};
+
+    inline void APIENTRY counted_glCullFace(GLenum mode)
+    {
+        Table<>::counts[ENTRY_glCullFace]++;
+        ((PFNGLCULLFACEPROC)Table<>::loaded[ENTRY_glCullFace])(mode);
+    }
+    inline void APIENTRY counted_glFrontFace(GLenum mode)
+    {
+        Table<>::counts[ENTRY_glFrontFace]++;
+        ((PFNGLFRONTFACEPROC)Table<>::loaded[ENTRY_glFrontFace])(mode);
+    }
+    inline void APIENTRY counted_glHint(GLenum target, GLenum mode)
+    {
+        Table<>::counts[ENTRY_glHint]++;
+        ((PFNGLHINTPROC)Table<>::loaded[ENTRY_glHint])(target, mode);
+    }
+    inline void APIENTRY counted_glLineWidth(GLfloat width)
+    {
+        Table<>::counts[ENTRY_glLineWidth]++;
+        ((PFNGLLINEWIDTHPROC)Table<>::loaded[ENTRY_glLineWidth])(width);
+    }
+    inline void APIENTRY counted_glPointSize(GLfloat size)
+    {
+        Table<>::counts[ENTRY_glPointSize]++;
+        ((PFNGLPOINTSIZEPROC)Table<>::loaded[ENTRY_glPointSize])(size);
+    }
+    inline void APIENTRY counted_glPolygonMode(GLenum face, GLenum mode)
+    {
+        Table<>::counts[ENTRY_glPolygonMode]++;
+        ((PFNGLPOLYGONMODEPROC)Table<>::loaded[ENTRY_glPolygonMode])(face, mode);
+    }
+    inline void APIENTRY counted_glScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+    {
+        Table<>::counts[ENTRY_glScissor]++;
+        ((PFNGLSCISSORPROC)Table<>::loaded[ENTRY_glScissor])(x, y, width, height);
+    }
+    inline void APIENTRY counted_glTexParameterf(GLenum target, GLenum pname, GLfloat param)
+    {
+        Table<>::counts[ENTRY_glTexParameterf]++;
+        ((PFNGLTEXPARAMETERFPROC)Table<>::loaded[ENTRY_glTexParameterf])(target, pname, param);
+    }
+    inline void APIENTRY counted_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params)
+    {
+        Table<>::counts[ENTRY_glTexParameterfv]++;
+        ((PFNGLTEXPARAMETERFVPROC)Table<>::loaded[ENTRY_glTexParameterfv])(target, pname, params);
+    }
+    inline void APIENTRY counted_glTexParameteri(GLenum target, GLenum pname, GLint param)
+    {
+        Table<>::counts[ENTRY_glTexParameteri]++;
+        ((PFNGLTEXPARAMETERIPROC)Table<>::loaded[ENTRY_glTexParameteri])(target, pname, param);
+    }
+    inline void APIENTRY counted_glTexParameteriv(GLenum target, GLenum pname, const GLint *params)
+    {
+        Table<>::counts[ENTRY_glTexParameteriv]++;
+        ((PFNGLTEXPARAMETERIVPROC)Table<>::loaded[ENTRY_glTexParameteriv])(target, pname, params);
+    }
+    inline void APIENTRY counted_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels)
+    {
+        Table<>::counts[ENTRY_glTexImage1D]++;
+        ((PFNGLTEXIMAGE1DPROC)Table<>::loaded[ENTRY_glTexImage1D])(target, level, internalformat, width, border, format, type, pixels);
+    }
+    inline void APIENTRY counted_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+    {
+        Table<>::counts[ENTRY_glTexImage2D]++;
+        ((PFNGLTEXIMAGE2DPROC)Table<>::loaded[ENTRY_glTexImage2D])(target, level, internalformat, width, height, border, format, type, pixels);
+    }
+    inline void APIENTRY counted_glDrawBuffer(GLenum buf)
+    {
+        Table<>::counts[ENTRY_glDrawBuffer]++;
+        ((PFNGLDRAWBUFFERPROC)Table<>::loaded[ENTRY_glDrawBuffer])(buf);
+    }
+    inline void APIENTRY counted_glClear(GLbitfield mask)
+    {
+        Table<>::counts[ENTRY_glClear]++;
+        ((PFNGLCLEARPROC)Table<>::loaded[ENTRY_glClear])(mask);
+    }
+    inline void APIENTRY counted_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+    {
+        Table<>::counts[ENTRY_glClearColor]++;
+        ((PFNGLCLEARCOLORPROC)Table<>::loaded[ENTRY_glClearColor])(red, green, blue, alpha);
+    }
+    inline void APIENTRY counted_glClearStencil(GLint s)
+    {
+        Table<>::counts[ENTRY_glClearStencil]++;
+        ((PFNGLCLEARSTENCILPROC)Table<>::loaded[ENTRY_glClearStencil])(s);
+    }
+    inline void APIENTRY counted_glClearDepth(GLdouble depth)
+    {
+        Table<>::counts[ENTRY_glClearDepth]++;
+        ((PFNGLCLEARDEPTHPROC)Table<>::loaded[ENTRY_glClearDepth])(depth);
+    }
+    inline void APIENTRY counted_glStencilMask(GLuint mask)
+    {
+        Table<>::counts[ENTRY_glStencilMask]++;
+        ((PFNGLSTENCILMASKPROC)Table<>::loaded[ENTRY_glStencilMask])(mask);
+    }
+    inline void APIENTRY counted_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+    {
+        Table<>::counts[ENTRY_glColorMask]++;
+        ((PFNGLCOLORMASKPROC)Table<>::loaded[ENTRY_glColorMask])(red, green, blue, alpha);
+    }
+    inline void APIENTRY counted_glDepthMask(GLboolean flag)
+    {
+        Table<>::counts[ENTRY_glDepthMask]++;
+        ((PFNGLDEPTHMASKPROC)Table<>::loaded[ENTRY_glDepthMask])(flag);
+    }
+    inline void APIENTRY counted_glDisable(GLenum cap)
+    {
+        Table<>::counts[ENTRY_glDisable]++;
+        ((PFNGLDISABLEPROC)Table<>::loaded[ENTRY_glDisable])(cap);
+    }
+    inline void APIENTRY counted_glEnable(GLenum cap)
+    {
+        Table<>::counts[ENTRY_glEnable]++;
+        ((PFNGLENABLEPROC)Table<>::loaded[ENTRY_glEnable])(cap);
+    }
+    inline void APIENTRY counted_glFinish(void)
+    {
+        Table<>::counts[ENTRY_glFinish]++;
+        ((PFNGLFINISHPROC)Table<>::loaded[ENTRY_glFinish])();
+    }
+    inline void APIENTRY counted_glFlush(void)
+    {
+        Table<>::counts[ENTRY_glFlush]++;
+        ((PFNGLFLUSHPROC)Table<>::loaded[ENTRY_glFlush])();
+    }
+    inline void APIENTRY counted_glBlendFunc(GLenum sfactor, GLenum dfactor)
+    {
+        Table<>::counts[ENTRY_glBlendFunc]++;
+        ((PFNGLBLENDFUNCPROC)Table<>::loaded[ENTRY_glBlendFunc])(sfactor, dfactor);
+    }
+    inline void APIENTRY counted_glLogicOp(GLenum opcode)
+    {
+        Table<>::counts[ENTRY_glLogicOp]++;
+        ((PFNGLLOGICOPPROC)Table<>::loaded[ENTRY_glLogicOp])(opcode);
+    }
+    inline void APIENTRY counted_glStencilFunc(GLenum func, GLint ref, GLuint mask)
+    {
+        Table<>::counts[ENTRY_glStencilFunc]++;
+        ((PFNGLSTENCILFUNCPROC)Table<>::loaded[ENTRY_glStencilFunc])(func, ref, mask);
+    }
+    inline void APIENTRY counted_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass)
+    {
+        Table<>::counts[ENTRY_glStencilOp]++;
+        ((PFNGLSTENCILOPPROC)Table<>::loaded[ENTRY_glStencilOp])(fail, zfail, zpass);
+    }
+    inline void APIENTRY counted_glDepthFunc(GLenum func)
+    {
+        Table<>::counts[ENTRY_glDepthFunc]++;
+        ((PFNGLDEPTHFUNCPROC)Table<>::loaded[ENTRY_glDepthFunc])(func);
+    }
+    inline void APIENTRY counted_glPixelStoref(GLenum pname, GLfloat param)
+    {
+        Table<>::counts[ENTRY_glPixelStoref]++;
+        ((PFNGLPIXELSTOREFPROC)Table<>::loaded[ENTRY_glPixelStoref])(pname, param);
+    }
+    inline void APIENTRY counted_glPixelStorei(GLenum pname, GLint param)
+    {
+        Table<>::counts[ENTRY_glPixelStorei]++;
+        ((PFNGLPIXELSTOREIPROC)Table<>::loaded[ENTRY_glPixelStorei])(pname, param);
+    }
+    inline void APIENTRY counted_glReadBuffer(GLenum src)
+    {
+        Table<>::counts[ENTRY_glReadBuffer]++;
+        ((PFNGLREADBUFFERPROC)Table<>::loaded[ENTRY_glReadBuffer])(src);
+    }
+    inline void APIENTRY counted_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+    {
+        Table<>::counts[ENTRY_glReadPixels]++;
+        ((PFNGLREADPIXELSPROC)Table<>::loaded[ENTRY_glReadPixels])(x, y, width, height, format, type, pixels);
+    }
+    inline void APIENTRY counted_glGetBooleanv(GLenum pname, GLboolean *data)
+    {
+        Table<>::counts[ENTRY_glGetBooleanv]++;
+        ((PFNGLGETBOOLEANVPROC)Table<>::loaded[ENTRY_glGetBooleanv])(pname, data);
+    }
+    inline void APIENTRY counted_glGetDoublev(GLenum pname, GLdouble *data)
+    {
+        Table<>::counts[ENTRY_glGetDoublev]++;
+        ((PFNGLGETDOUBLEVPROC)Table<>::loaded[ENTRY_glGetDoublev])(pname, data);
+    }
+    inline GLenum APIENTRY counted_glGetError(void)
+    {
+        Table<>::counts[ENTRY_glGetError]++;
+        return ((PFNGLGETERRORPROC)Table<>::loaded[ENTRY_glGetError])();
+    }
+    inline void APIENTRY counted_glGetFloatv(GLenum pname, GLfloat *data)
+    {
+        Table<>::counts[ENTRY_glGetFloatv]++;
+        ((PFNGLGETFLOATVPROC)Table<>::loaded[ENTRY_glGetFloatv])(pname, data);
+    }
+    inline void APIENTRY counted_glGetIntegerv(GLenum pname, GLint *data)
+    {
+        Table<>::counts[ENTRY_glGetIntegerv]++;
+        ((PFNGLGETINTEGERVPROC)Table<>::loaded[ENTRY_glGetIntegerv])(pname, data);
+    }
+    inline const GLubyte * APIENTRY counted_glGetString(GLenum name)
+    {
+        Table<>::counts[ENTRY_glGetString]++;
+        return ((PFNGLGETSTRINGPROC)Table<>::loaded[ENTRY_glGetString])(name);
+    }
+    inline void APIENTRY counted_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
+    {
+        Table<>::counts[ENTRY_glGetTexImage]++;
+        ((PFNGLGETTEXIMAGEPROC)Table<>::loaded[ENTRY_glGetTexImage])(target, level, format, type, pixels);
+    }
+    inline void APIENTRY counted_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params)
+    {
+        Table<>::counts[ENTRY_glGetTexParameterfv]++;
+        ((PFNGLGETTEXPARAMETERFVPROC)Table<>::loaded[ENTRY_glGetTexParameterfv])(target, pname, params);
+    }
+    inline void APIENTRY counted_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetTexParameteriv]++;
+        ((PFNGLGETTEXPARAMETERIVPROC)Table<>::loaded[ENTRY_glGetTexParameteriv])(target, pname, params);
+    }
+    inline void APIENTRY counted_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params)
+    {
+        Table<>::counts[ENTRY_glGetTexLevelParameterfv]++;
+        ((PFNGLGETTEXLEVELPARAMETERFVPROC)Table<>::loaded[ENTRY_glGetTexLevelParameterfv])(target, level, pname, params);
+    }
+    inline void APIENTRY counted_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetTexLevelParameteriv]++;
+        ((PFNGLGETTEXLEVELPARAMETERIVPROC)Table<>::loaded[ENTRY_glGetTexLevelParameteriv])(target, level, pname, params);
+    }
+    inline GLboolean APIENTRY counted_glIsEnabled(GLenum cap)
+    {
+        Table<>::counts[ENTRY_glIsEnabled]++;
+        return ((PFNGLISENABLEDPROC)Table<>::loaded[ENTRY_glIsEnabled])(cap);
+    }
+    inline void APIENTRY counted_glDepthRange(GLdouble n, GLdouble f)
+    {
+        Table<>::counts[ENTRY_glDepthRange]++;
+        ((PFNGLDEPTHRANGEPROC)Table<>::loaded[ENTRY_glDepthRange])(n, f);
+    }
+    inline void APIENTRY counted_glViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+    {
+        Table<>::counts[ENTRY_glViewport]++;
+        ((PFNGLVIEWPORTPROC)Table<>::loaded[ENTRY_glViewport])(x, y, width, height);
+    }
+    inline void APIENTRY counted_glNewList(GLuint list, GLenum mode)
+    {
+        Table<>::counts[ENTRY_glNewList]++;
+        ((PFNGLNEWLISTPROC)Table<>::loaded[ENTRY_glNewList])(list, mode);
+    }
+    inline void APIENTRY counted_glEndList(void)
+    {
+        Table<>::counts[ENTRY_glEndList]++;
+        ((PFNGLENDLISTPROC)Table<>::loaded[ENTRY_glEndList])();
+    }
+    inline void APIENTRY counted_glCallList(GLuint list)
+    {
+        Table<>::counts[ENTRY_glCallList]++;
+        ((PFNGLCALLLISTPROC)Table<>::loaded[ENTRY_glCallList])(list);
+    }
+    inline void APIENTRY counted_glCallLists(GLsizei n, GLenum type, const void *lists)
+    {
+        Table<>::counts[ENTRY_glCallLists]++;
+        ((PFNGLCALLLISTSPROC)Table<>::loaded[ENTRY_glCallLists])(n, type, lists);
+    }
+    inline void APIENTRY counted_glDeleteLists(GLuint list, GLsizei range)
+    {
+        Table<>::counts[ENTRY_glDeleteLists]++;
+        ((PFNGLDELETELISTSPROC)Table<>::loaded[ENTRY_glDeleteLists])(list, range);
+    }
+    inline GLuint APIENTRY counted_glGenLists(GLsizei range)
+    {
+        Table<>::counts[ENTRY_glGenLists]++;
+        return ((PFNGLGENLISTSPROC)Table<>::loaded[ENTRY_glGenLists])(range);
+    }
+    inline void APIENTRY counted_glListBase(GLuint base)
+    {
+        Table<>::counts[ENTRY_glListBase]++;
+        ((PFNGLLISTBASEPROC)Table<>::loaded[ENTRY_glListBase])(base);
+    }
+    inline void APIENTRY counted_glBegin(GLenum mode)
+    {
+        Table<>::counts[ENTRY_glBegin]++;
+        ((PFNGLBEGINPROC)Table<>::loaded[ENTRY_glBegin])(mode);
+    }
+    inline void APIENTRY counted_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap)
+    {
+        Table<>::counts[ENTRY_glBitmap]++;
+        ((PFNGLBITMAPPROC)Table<>::loaded[ENTRY_glBitmap])(width, height, xorig, yorig, xmove, ymove, bitmap);
+    }
+    inline void APIENTRY counted_glColor3b(GLbyte red, GLbyte green, GLbyte blue)
+    {
+        Table<>::counts[ENTRY_glColor3b]++;
+        ((PFNGLCOLOR3BPROC)Table<>::loaded[ENTRY_glColor3b])(red, green, blue);
+    }
+    inline void APIENTRY counted_glColor3bv(const GLbyte *v)
+    {
+        Table<>::counts[ENTRY_glColor3bv]++;
+        ((PFNGLCOLOR3BVPROC)Table<>::loaded[ENTRY_glColor3bv])(v);
+    }
+    inline void APIENTRY counted_glColor3d(GLdouble red, GLdouble green, GLdouble blue)
+    {
+        Table<>::counts[ENTRY_glColor3d]++;
+        ((PFNGLCOLOR3DPROC)Table<>::loaded[ENTRY_glColor3d])(red, green, blue);
+    }
+    inline void APIENTRY counted_glColor3dv(const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glColor3dv]++;
+        ((PFNGLCOLOR3DVPROC)Table<>::loaded[ENTRY_glColor3dv])(v);
+    }
+    inline void APIENTRY counted_glColor3f(GLfloat red, GLfloat green, GLfloat blue)
+    {
+        Table<>::counts[ENTRY_glColor3f]++;
+        ((PFNGLCOLOR3FPROC)Table<>::loaded[ENTRY_glColor3f])(red, green, blue);
+    }
+    inline void APIENTRY counted_glColor3fv(const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glColor3fv]++;
+        ((PFNGLCOLOR3FVPROC)Table<>::loaded[ENTRY_glColor3fv])(v);
+    }
+    inline void APIENTRY counted_glColor3i(GLint red, GLint green, GLint blue)
+    {
+        Table<>::counts[ENTRY_glColor3i]++;
+        ((PFNGLCOLOR3IPROC)Table<>::loaded[ENTRY_glColor3i])(red, green, blue);
+    }
+    inline void APIENTRY counted_glColor3iv(const GLint *v)
+    {
+        Table<>::counts[ENTRY_glColor3iv]++;
+        ((PFNGLCOLOR3IVPROC)Table<>::loaded[ENTRY_glColor3iv])(v);
+    }
+    inline void APIENTRY counted_glColor3s(GLshort red, GLshort green, GLshort blue)
+    {
+        Table<>::counts[ENTRY_glColor3s]++;
+        ((PFNGLCOLOR3SPROC)Table<>::loaded[ENTRY_glColor3s])(red, green, blue);
+    }
+    inline void APIENTRY counted_glColor3sv(const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glColor3sv]++;
+        ((PFNGLCOLOR3SVPROC)Table<>::loaded[ENTRY_glColor3sv])(v);
+    }
+    inline void APIENTRY counted_glColor3ub(GLubyte red, GLubyte green, GLubyte blue)
+    {
+        Table<>::counts[ENTRY_glColor3ub]++;
+        ((PFNGLCOLOR3UBPROC)Table<>::loaded[ENTRY_glColor3ub])(red, green, blue);
+    }
+    inline void APIENTRY counted_glColor3ubv(const GLubyte *v)
+    {
+        Table<>::counts[ENTRY_glColor3ubv]++;
+        ((PFNGLCOLOR3UBVPROC)Table<>::loaded[ENTRY_glColor3ubv])(v);
+    }
+    inline void APIENTRY counted_glColor3ui(GLuint red, GLuint green, GLuint blue)
+    {
+        Table<>::counts[ENTRY_glColor3ui]++;
+        ((PFNGLCOLOR3UIPROC)Table<>::loaded[ENTRY_glColor3ui])(red, green, blue);
+    }
+    inline void APIENTRY counted_glColor3uiv(const GLuint *v)
+    {
+        Table<>::counts[ENTRY_glColor3uiv]++;
+        ((PFNGLCOLOR3UIVPROC)Table<>::loaded[ENTRY_glColor3uiv])(v);
+    }
+    inline void APIENTRY counted_glColor3us(GLushort red, GLushort green, GLushort blue)
+    {
+        Table<>::counts[ENTRY_glColor3us]++;
+        ((PFNGLCOLOR3USPROC)Table<>::loaded[ENTRY_glColor3us])(red, green, blue);
+    }
+    inline void APIENTRY counted_glColor3usv(const GLushort *v)
+    {
+        Table<>::counts[ENTRY_glColor3usv]++;
+        ((PFNGLCOLOR3USVPROC)Table<>::loaded[ENTRY_glColor3usv])(v);
+    }
+    inline void APIENTRY counted_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha)
+    {
+        Table<>::counts[ENTRY_glColor4b]++;
+        ((PFNGLCOLOR4BPROC)Table<>::loaded[ENTRY_glColor4b])(red, green, blue, alpha);
+    }
+    inline void APIENTRY counted_glColor4bv(const GLbyte *v)
+    {
+        Table<>::counts[ENTRY_glColor4bv]++;
+        ((PFNGLCOLOR4BVPROC)Table<>::loaded[ENTRY_glColor4bv])(v);
+    }
+    inline void APIENTRY counted_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha)
+    {
+        Table<>::counts[ENTRY_glColor4d]++;
+        ((PFNGLCOLOR4DPROC)Table<>::loaded[ENTRY_glColor4d])(red, green, blue, alpha);
+    }
+    inline void APIENTRY counted_glColor4dv(const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glColor4dv]++;
+        ((PFNGLCOLOR4DVPROC)Table<>::loaded[ENTRY_glColor4dv])(v);
+    }
+    inline void APIENTRY counted_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+    {
+        Table<>::counts[ENTRY_glColor4f]++;
+        ((PFNGLCOLOR4FPROC)Table<>::loaded[ENTRY_glColor4f])(red, green, blue, alpha);
+    }
+    inline void APIENTRY counted_glColor4fv(const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glColor4fv]++;
+        ((PFNGLCOLOR4FVPROC)Table<>::loaded[ENTRY_glColor4fv])(v);
+    }
+    inline void APIENTRY counted_glColor4i(GLint red, GLint green, GLint blue, GLint alpha)
+    {
+        Table<>::counts[ENTRY_glColor4i]++;
+        ((PFNGLCOLOR4IPROC)Table<>::loaded[ENTRY_glColor4i])(red, green, blue, alpha);
+    }
+    inline void APIENTRY counted_glColor4iv(const GLint *v)
+    {
+        Table<>::counts[ENTRY_glColor4iv]++;
+        ((PFNGLCOLOR4IVPROC)Table<>::loaded[ENTRY_glColor4iv])(v);
+    }
+    inline void APIENTRY counted_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha)
+    {
+        Table<>::counts[ENTRY_glColor4s]++;
+        ((PFNGLCOLOR4SPROC)Table<>::loaded[ENTRY_glColor4s])(red, green, blue, alpha);
+    }
+    inline void APIENTRY counted_glColor4sv(const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glColor4sv]++;
+        ((PFNGLCOLOR4SVPROC)Table<>::loaded[ENTRY_glColor4sv])(v);
+    }
+    inline void APIENTRY counted_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha)
+    {
+        Table<>::counts[ENTRY_glColor4ub]++;
+        ((PFNGLCOLOR4UBPROC)Table<>::loaded[ENTRY_glColor4ub])(red, green, blue, alpha);
+    }
+    inline void APIENTRY counted_glColor4ubv(const GLubyte *v)
+    {
+        Table<>::counts[ENTRY_glColor4ubv]++;
+        ((PFNGLCOLOR4UBVPROC)Table<>::loaded[ENTRY_glColor4ubv])(v);
+    }
+    inline void APIENTRY counted_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha)
+    {
+        Table<>::counts[ENTRY_glColor4ui]++;
+        ((PFNGLCOLOR4UIPROC)Table<>::loaded[ENTRY_glColor4ui])(red, green, blue, alpha);
+    }
+    inline void APIENTRY counted_glColor4uiv(const GLuint *v)
+    {
+        Table<>::counts[ENTRY_glColor4uiv]++;
+        ((PFNGLCOLOR4UIVPROC)Table<>::loaded[ENTRY_glColor4uiv])(v);
+    }
+    inline void APIENTRY counted_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha)
+    {
+        Table<>::counts[ENTRY_glColor4us]++;
+        ((PFNGLCOLOR4USPROC)Table<>::loaded[ENTRY_glColor4us])(red, green, blue, alpha);
+    }
+    inline void APIENTRY counted_glColor4usv(const GLushort *v)
+    {
+        Table<>::counts[ENTRY_glColor4usv]++;
+        ((PFNGLCOLOR4USVPROC)Table<>::loaded[ENTRY_glColor4usv])(v);
+    }
+    inline void APIENTRY counted_glEdgeFlag(GLboolean flag)
+    {
+        Table<>::counts[ENTRY_glEdgeFlag]++;
+        ((PFNGLEDGEFLAGPROC)Table<>::loaded[ENTRY_glEdgeFlag])(flag);
+    }
+    inline void APIENTRY counted_glEdgeFlagv(const GLboolean *flag)
+    {
+        Table<>::counts[ENTRY_glEdgeFlagv]++;
+        ((PFNGLEDGEFLAGVPROC)Table<>::loaded[ENTRY_glEdgeFlagv])(flag);
+    }
+    inline void APIENTRY counted_glEnd(void)
+    {
+        Table<>::counts[ENTRY_glEnd]++;
+        ((PFNGLENDPROC)Table<>::loaded[ENTRY_glEnd])();
+    }
+    inline void APIENTRY counted_glIndexd(GLdouble c)
+    {
+        Table<>::counts[ENTRY_glIndexd]++;
+        ((PFNGLINDEXDPROC)Table<>::loaded[ENTRY_glIndexd])(c);
+    }
+    inline void APIENTRY counted_glIndexdv(const GLdouble *c)
+    {
+        Table<>::counts[ENTRY_glIndexdv]++;
+        ((PFNGLINDEXDVPROC)Table<>::loaded[ENTRY_glIndexdv])(c);
+    }
+    inline void APIENTRY counted_glIndexf(GLfloat c)
+    {
+        Table<>::counts[ENTRY_glIndexf]++;
+        ((PFNGLINDEXFPROC)Table<>::loaded[ENTRY_glIndexf])(c);
+    }
+    inline void APIENTRY counted_glIndexfv(const GLfloat *c)
+    {
+        Table<>::counts[ENTRY_glIndexfv]++;
+        ((PFNGLINDEXFVPROC)Table<>::loaded[ENTRY_glIndexfv])(c);
+    }
+    inline void APIENTRY counted_glIndexi(GLint c)
+    {
+        Table<>::counts[ENTRY_glIndexi]++;
+        ((PFNGLINDEXIPROC)Table<>::loaded[ENTRY_glIndexi])(c);
+    }
+    inline void APIENTRY counted_glIndexiv(const GLint *c)
+    {
+        Table<>::counts[ENTRY_glIndexiv]++;
+        ((PFNGLINDEXIVPROC)Table<>::loaded[ENTRY_glIndexiv])(c);
+    }
+    inline void APIENTRY counted_glIndexs(GLshort c)
+    {
+        Table<>::counts[ENTRY_glIndexs]++;
+        ((PFNGLINDEXSPROC)Table<>::loaded[ENTRY_glIndexs])(c);
+    }
+    inline void APIENTRY counted_glIndexsv(const GLshort *c)
+    {
+        Table<>::counts[ENTRY_glIndexsv]++;
+        ((PFNGLINDEXSVPROC)Table<>::loaded[ENTRY_glIndexsv])(c);
+    }
+    inline void APIENTRY counted_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz)
+    {
+        Table<>::counts[ENTRY_glNormal3b]++;
+        ((PFNGLNORMAL3BPROC)Table<>::loaded[ENTRY_glNormal3b])(nx, ny, nz);
+    }
+    inline void APIENTRY counted_glNormal3bv(const GLbyte *v)
+    {
+        Table<>::counts[ENTRY_glNormal3bv]++;
+        ((PFNGLNORMAL3BVPROC)Table<>::loaded[ENTRY_glNormal3bv])(v);
+    }
+    inline void APIENTRY counted_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz)
+    {
+        Table<>::counts[ENTRY_glNormal3d]++;
+        ((PFNGLNORMAL3DPROC)Table<>::loaded[ENTRY_glNormal3d])(nx, ny, nz);
+    }
+    inline void APIENTRY counted_glNormal3dv(const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glNormal3dv]++;
+        ((PFNGLNORMAL3DVPROC)Table<>::loaded[ENTRY_glNormal3dv])(v);
+    }
+    inline void APIENTRY counted_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz)
+    {
+        Table<>::counts[ENTRY_glNormal3f]++;
+        ((PFNGLNORMAL3FPROC)Table<>::loaded[ENTRY_glNormal3f])(nx, ny, nz);
+    }
+    inline void APIENTRY counted_glNormal3fv(const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glNormal3fv]++;
+        ((PFNGLNORMAL3FVPROC)Table<>::loaded[ENTRY_glNormal3fv])(v);
+    }
+    inline void APIENTRY counted_glNormal3i(GLint nx, GLint ny, GLint nz)
+    {
+        Table<>::counts[ENTRY_glNormal3i]++;
+        ((PFNGLNORMAL3IPROC)Table<>::loaded[ENTRY_glNormal3i])(nx, ny, nz);
+    }
+    inline void APIENTRY counted_glNormal3iv(const GLint *v)
+    {
+        Table<>::counts[ENTRY_glNormal3iv]++;
+        ((PFNGLNORMAL3IVPROC)Table<>::loaded[ENTRY_glNormal3iv])(v);
+    }
+    inline void APIENTRY counted_glNormal3s(GLshort nx, GLshort ny, GLshort nz)
+    {
+        Table<>::counts[ENTRY_glNormal3s]++;
+        ((PFNGLNORMAL3SPROC)Table<>::loaded[ENTRY_glNormal3s])(nx, ny, nz);
+    }
+    inline void APIENTRY counted_glNormal3sv(const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glNormal3sv]++;
+        ((PFNGLNORMAL3SVPROC)Table<>::loaded[ENTRY_glNormal3sv])(v);
+    }
+    inline void APIENTRY counted_glRasterPos2d(GLdouble x, GLdouble y)
+    {
+        Table<>::counts[ENTRY_glRasterPos2d]++;
+        ((PFNGLRASTERPOS2DPROC)Table<>::loaded[ENTRY_glRasterPos2d])(x, y);
+    }
+    inline void APIENTRY counted_glRasterPos2dv(const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glRasterPos2dv]++;
+        ((PFNGLRASTERPOS2DVPROC)Table<>::loaded[ENTRY_glRasterPos2dv])(v);
+    }
+    inline void APIENTRY counted_glRasterPos2f(GLfloat x, GLfloat y)
+    {
+        Table<>::counts[ENTRY_glRasterPos2f]++;
+        ((PFNGLRASTERPOS2FPROC)Table<>::loaded[ENTRY_glRasterPos2f])(x, y);
+    }
+    inline void APIENTRY counted_glRasterPos2fv(const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glRasterPos2fv]++;
+        ((PFNGLRASTERPOS2FVPROC)Table<>::loaded[ENTRY_glRasterPos2fv])(v);
+    }
+    inline void APIENTRY counted_glRasterPos2i(GLint x, GLint y)
+    {
+        Table<>::counts[ENTRY_glRasterPos2i]++;
+        ((PFNGLRASTERPOS2IPROC)Table<>::loaded[ENTRY_glRasterPos2i])(x, y);
+    }
+    inline void APIENTRY counted_glRasterPos2iv(const GLint *v)
+    {
+        Table<>::counts[ENTRY_glRasterPos2iv]++;
+        ((PFNGLRASTERPOS2IVPROC)Table<>::loaded[ENTRY_glRasterPos2iv])(v);
+    }
+    inline void APIENTRY counted_glRasterPos2s(GLshort x, GLshort y)
+    {
+        Table<>::counts[ENTRY_glRasterPos2s]++;
+        ((PFNGLRASTERPOS2SPROC)Table<>::loaded[ENTRY_glRasterPos2s])(x, y);
+    }
+    inline void APIENTRY counted_glRasterPos2sv(const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glRasterPos2sv]++;
+        ((PFNGLRASTERPOS2SVPROC)Table<>::loaded[ENTRY_glRasterPos2sv])(v);
+    }
+    inline void APIENTRY counted_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z)
+    {
+        Table<>::counts[ENTRY_glRasterPos3d]++;
+        ((PFNGLRASTERPOS3DPROC)Table<>::loaded[ENTRY_glRasterPos3d])(x, y, z);
+    }
+    inline void APIENTRY counted_glRasterPos3dv(const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glRasterPos3dv]++;
+        ((PFNGLRASTERPOS3DVPROC)Table<>::loaded[ENTRY_glRasterPos3dv])(v);
+    }
+    inline void APIENTRY counted_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z)
+    {
+        Table<>::counts[ENTRY_glRasterPos3f]++;
+        ((PFNGLRASTERPOS3FPROC)Table<>::loaded[ENTRY_glRasterPos3f])(x, y, z);
+    }
+    inline void APIENTRY counted_glRasterPos3fv(const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glRasterPos3fv]++;
+        ((PFNGLRASTERPOS3FVPROC)Table<>::loaded[ENTRY_glRasterPos3fv])(v);
+    }
+    inline void APIENTRY counted_glRasterPos3i(GLint x, GLint y, GLint z)
+    {
+        Table<>::counts[ENTRY_glRasterPos3i]++;
+        ((PFNGLRASTERPOS3IPROC)Table<>::loaded[ENTRY_glRasterPos3i])(x, y, z);
+    }
+    inline void APIENTRY counted_glRasterPos3iv(const GLint *v)
+    {
+        Table<>::counts[ENTRY_glRasterPos3iv]++;
+        ((PFNGLRASTERPOS3IVPROC)Table<>::loaded[ENTRY_glRasterPos3iv])(v);
+    }
+    inline void APIENTRY counted_glRasterPos3s(GLshort x, GLshort y, GLshort z)
+    {
+        Table<>::counts[ENTRY_glRasterPos3s]++;
+        ((PFNGLRASTERPOS3SPROC)Table<>::loaded[ENTRY_glRasterPos3s])(x, y, z);
+    }
+    inline void APIENTRY counted_glRasterPos3sv(const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glRasterPos3sv]++;
+        ((PFNGLRASTERPOS3SVPROC)Table<>::loaded[ENTRY_glRasterPos3sv])(v);
+    }
+    inline void APIENTRY counted_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+    {
+        Table<>::counts[ENTRY_glRasterPos4d]++;
+        ((PFNGLRASTERPOS4DPROC)Table<>::loaded[ENTRY_glRasterPos4d])(x, y, z, w);
+    }
+    inline void APIENTRY counted_glRasterPos4dv(const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glRasterPos4dv]++;
+        ((PFNGLRASTERPOS4DVPROC)Table<>::loaded[ENTRY_glRasterPos4dv])(v);
+    }
+    inline void APIENTRY counted_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+    {
+        Table<>::counts[ENTRY_glRasterPos4f]++;
+        ((PFNGLRASTERPOS4FPROC)Table<>::loaded[ENTRY_glRasterPos4f])(x, y, z, w);
+    }
+    inline void APIENTRY counted_glRasterPos4fv(const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glRasterPos4fv]++;
+        ((PFNGLRASTERPOS4FVPROC)Table<>::loaded[ENTRY_glRasterPos4fv])(v);
+    }
+    inline void APIENTRY counted_glRasterPos4i(GLint x, GLint y, GLint z, GLint w)
+    {
+        Table<>::counts[ENTRY_glRasterPos4i]++;
+        ((PFNGLRASTERPOS4IPROC)Table<>::loaded[ENTRY_glRasterPos4i])(x, y, z, w);
+    }
+    inline void APIENTRY counted_glRasterPos4iv(const GLint *v)
+    {
+        Table<>::counts[ENTRY_glRasterPos4iv]++;
+        ((PFNGLRASTERPOS4IVPROC)Table<>::loaded[ENTRY_glRasterPos4iv])(v);
+    }
+    inline void APIENTRY counted_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w)
+    {
+        Table<>::counts[ENTRY_glRasterPos4s]++;
+        ((PFNGLRASTERPOS4SPROC)Table<>::loaded[ENTRY_glRasterPos4s])(x, y, z, w);
+    }
+    inline void APIENTRY counted_glRasterPos4sv(const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glRasterPos4sv]++;
+        ((PFNGLRASTERPOS4SVPROC)Table<>::loaded[ENTRY_glRasterPos4sv])(v);
+    }
+    inline void APIENTRY counted_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2)
+    {
+        Table<>::counts[ENTRY_glRectd]++;
+        ((PFNGLRECTDPROC)Table<>::loaded[ENTRY_glRectd])(x1, y1, x2, y2);
+    }
+    inline void APIENTRY counted_glRectdv(const GLdouble *v1, const GLdouble *v2)
+    {
+        Table<>::counts[ENTRY_glRectdv]++;
+        ((PFNGLRECTDVPROC)Table<>::loaded[ENTRY_glRectdv])(v1, v2);
+    }
+    inline void APIENTRY counted_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2)
+    {
+        Table<>::counts[ENTRY_glRectf]++;
+        ((PFNGLRECTFPROC)Table<>::loaded[ENTRY_glRectf])(x1, y1, x2, y2);
+    }
+    inline void APIENTRY counted_glRectfv(const GLfloat *v1, const GLfloat *v2)
+    {
+        Table<>::counts[ENTRY_glRectfv]++;
+        ((PFNGLRECTFVPROC)Table<>::loaded[ENTRY_glRectfv])(v1, v2);
+    }
+    inline void APIENTRY counted_glRecti(GLint x1, GLint y1, GLint x2, GLint y2)
+    {
+        Table<>::counts[ENTRY_glRecti]++;
+        ((PFNGLRECTIPROC)Table<>::loaded[ENTRY_glRecti])(x1, y1, x2, y2);
+    }
+    inline void APIENTRY counted_glRectiv(const GLint *v1, const GLint *v2)
+    {
+        Table<>::counts[ENTRY_glRectiv]++;
+        ((PFNGLRECTIVPROC)Table<>::loaded[ENTRY_glRectiv])(v1, v2);
+    }
+    inline void APIENTRY counted_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2)
+    {
+        Table<>::counts[ENTRY_glRects]++;
+        ((PFNGLRECTSPROC)Table<>::loaded[ENTRY_glRects])(x1, y1, x2, y2);
+    }
+    inline void APIENTRY counted_glRectsv(const GLshort *v1, const GLshort *v2)
+    {
+        Table<>::counts[ENTRY_glRectsv]++;
+        ((PFNGLRECTSVPROC)Table<>::loaded[ENTRY_glRectsv])(v1, v2);
+    }
+    inline void APIENTRY counted_glTexCoord1d(GLdouble s)
+    {
+        Table<>::counts[ENTRY_glTexCoord1d]++;
+        ((PFNGLTEXCOORD1DPROC)Table<>::loaded[ENTRY_glTexCoord1d])(s);
+    }
+    inline void APIENTRY counted_glTexCoord1dv(const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glTexCoord1dv]++;
+        ((PFNGLTEXCOORD1DVPROC)Table<>::loaded[ENTRY_glTexCoord1dv])(v);
+    }
+    inline void APIENTRY counted_glTexCoord1f(GLfloat s)
+    {
+        Table<>::counts[ENTRY_glTexCoord1f]++;
+        ((PFNGLTEXCOORD1FPROC)Table<>::loaded[ENTRY_glTexCoord1f])(s);
+    }
+    inline void APIENTRY counted_glTexCoord1fv(const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glTexCoord1fv]++;
+        ((PFNGLTEXCOORD1FVPROC)Table<>::loaded[ENTRY_glTexCoord1fv])(v);
+    }
+    inline void APIENTRY counted_glTexCoord1i(GLint s)
+    {
+        Table<>::counts[ENTRY_glTexCoord1i]++;
+        ((PFNGLTEXCOORD1IPROC)Table<>::loaded[ENTRY_glTexCoord1i])(s);
+    }
+    inline void APIENTRY counted_glTexCoord1iv(const GLint *v)
+    {
+        Table<>::counts[ENTRY_glTexCoord1iv]++;
+        ((PFNGLTEXCOORD1IVPROC)Table<>::loaded[ENTRY_glTexCoord1iv])(v);
+    }
+    inline void APIENTRY counted_glTexCoord1s(GLshort s)
+    {
+        Table<>::counts[ENTRY_glTexCoord1s]++;
+        ((PFNGLTEXCOORD1SPROC)Table<>::loaded[ENTRY_glTexCoord1s])(s);
+    }
+    inline void APIENTRY counted_glTexCoord1sv(const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glTexCoord1sv]++;
+        ((PFNGLTEXCOORD1SVPROC)Table<>::loaded[ENTRY_glTexCoord1sv])(v);
+    }
+    inline void APIENTRY counted_glTexCoord2d(GLdouble s, GLdouble t)
+    {
+        Table<>::counts[ENTRY_glTexCoord2d]++;
+        ((PFNGLTEXCOORD2DPROC)Table<>::loaded[ENTRY_glTexCoord2d])(s, t);
+    }
+    inline void APIENTRY counted_glTexCoord2dv(const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glTexCoord2dv]++;
+        ((PFNGLTEXCOORD2DVPROC)Table<>::loaded[ENTRY_glTexCoord2dv])(v);
+    }
+    inline void APIENTRY counted_glTexCoord2f(GLfloat s, GLfloat t)
+    {
+        Table<>::counts[ENTRY_glTexCoord2f]++;
+        ((PFNGLTEXCOORD2FPROC)Table<>::loaded[ENTRY_glTexCoord2f])(s, t);
+    }
+    inline void APIENTRY counted_glTexCoord2fv(const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glTexCoord2fv]++;
+        ((PFNGLTEXCOORD2FVPROC)Table<>::loaded[ENTRY_glTexCoord2fv])(v);
+    }
+    inline void APIENTRY counted_glTexCoord2i(GLint s, GLint t)
+    {
+        Table<>::counts[ENTRY_glTexCoord2i]++;
+        ((PFNGLTEXCOORD2IPROC)Table<>::loaded[ENTRY_glTexCoord2i])(s, t);
+    }
+    inline void APIENTRY counted_glTexCoord2iv(const GLint *v)
+    {
+        Table<>::counts[ENTRY_glTexCoord2iv]++;
+        ((PFNGLTEXCOORD2IVPROC)Table<>::loaded[ENTRY_glTexCoord2iv])(v);
+    }
+    inline void APIENTRY counted_glTexCoord2s(GLshort s, GLshort t)
+    {
+        Table<>::counts[ENTRY_glTexCoord2s]++;
+        ((PFNGLTEXCOORD2SPROC)Table<>::loaded[ENTRY_glTexCoord2s])(s, t);
+    }
+    inline void APIENTRY counted_glTexCoord2sv(const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glTexCoord2sv]++;
+        ((PFNGLTEXCOORD2SVPROC)Table<>::loaded[ENTRY_glTexCoord2sv])(v);
+    }
+    inline void APIENTRY counted_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r)
+    {
+        Table<>::counts[ENTRY_glTexCoord3d]++;
+        ((PFNGLTEXCOORD3DPROC)Table<>::loaded[ENTRY_glTexCoord3d])(s, t, r);
+    }
+    inline void APIENTRY counted_glTexCoord3dv(const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glTexCoord3dv]++;
+        ((PFNGLTEXCOORD3DVPROC)Table<>::loaded[ENTRY_glTexCoord3dv])(v);
+    }
+    inline void APIENTRY counted_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r)
+    {
+        Table<>::counts[ENTRY_glTexCoord3f]++;
+        ((PFNGLTEXCOORD3FPROC)Table<>::loaded[ENTRY_glTexCoord3f])(s, t, r);
+    }
+    inline void APIENTRY counted_glTexCoord3fv(const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glTexCoord3fv]++;
+        ((PFNGLTEXCOORD3FVPROC)Table<>::loaded[ENTRY_glTexCoord3fv])(v);
+    }
+    inline void APIENTRY counted_glTexCoord3i(GLint s, GLint t, GLint r)
+    {
+        Table<>::counts[ENTRY_glTexCoord3i]++;
+        ((PFNGLTEXCOORD3IPROC)Table<>::loaded[ENTRY_glTexCoord3i])(s, t, r);
+    }
+    inline void APIENTRY counted_glTexCoord3iv(const GLint *v)
+    {
+        Table<>::counts[ENTRY_glTexCoord3iv]++;
+        ((PFNGLTEXCOORD3IVPROC)Table<>::loaded[ENTRY_glTexCoord3iv])(v);
+    }
+    inline void APIENTRY counted_glTexCoord3s(GLshort s, GLshort t, GLshort r)
+    {
+        Table<>::counts[ENTRY_glTexCoord3s]++;
+        ((PFNGLTEXCOORD3SPROC)Table<>::loaded[ENTRY_glTexCoord3s])(s, t, r);
+    }
+    inline void APIENTRY counted_glTexCoord3sv(const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glTexCoord3sv]++;
+        ((PFNGLTEXCOORD3SVPROC)Table<>::loaded[ENTRY_glTexCoord3sv])(v);
+    }
+    inline void APIENTRY counted_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q)
+    {
+        Table<>::counts[ENTRY_glTexCoord4d]++;
+        ((PFNGLTEXCOORD4DPROC)Table<>::loaded[ENTRY_glTexCoord4d])(s, t, r, q);
+    }
+    inline void APIENTRY counted_glTexCoord4dv(const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glTexCoord4dv]++;
+        ((PFNGLTEXCOORD4DVPROC)Table<>::loaded[ENTRY_glTexCoord4dv])(v);
+    }
+    inline void APIENTRY counted_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+    {
+        Table<>::counts[ENTRY_glTexCoord4f]++;
+        ((PFNGLTEXCOORD4FPROC)Table<>::loaded[ENTRY_glTexCoord4f])(s, t, r, q);
+    }
+    inline void APIENTRY counted_glTexCoord4fv(const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glTexCoord4fv]++;
+        ((PFNGLTEXCOORD4FVPROC)Table<>::loaded[ENTRY_glTexCoord4fv])(v);
+    }
+    inline void APIENTRY counted_glTexCoord4i(GLint s, GLint t, GLint r, GLint q)
+    {
+        Table<>::counts[ENTRY_glTexCoord4i]++;
+        ((PFNGLTEXCOORD4IPROC)Table<>::loaded[ENTRY_glTexCoord4i])(s, t, r, q);
+    }
+    inline void APIENTRY counted_glTexCoord4iv(const GLint *v)
+    {
+        Table<>::counts[ENTRY_glTexCoord4iv]++;
+        ((PFNGLTEXCOORD4IVPROC)Table<>::loaded[ENTRY_glTexCoord4iv])(v);
+    }
+    inline void APIENTRY counted_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q)
+    {
+        Table<>::counts[ENTRY_glTexCoord4s]++;
+        ((PFNGLTEXCOORD4SPROC)Table<>::loaded[ENTRY_glTexCoord4s])(s, t, r, q);
+    }
+    inline void APIENTRY counted_glTexCoord4sv(const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glTexCoord4sv]++;
+        ((PFNGLTEXCOORD4SVPROC)Table<>::loaded[ENTRY_glTexCoord4sv])(v);
+    }
+    inline void APIENTRY counted_glVertex2d(GLdouble x, GLdouble y)
+    {
+        Table<>::counts[ENTRY_glVertex2d]++;
+        ((PFNGLVERTEX2DPROC)Table<>::loaded[ENTRY_glVertex2d])(x, y);
+    }
+    inline void APIENTRY counted_glVertex2dv(const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glVertex2dv]++;
+        ((PFNGLVERTEX2DVPROC)Table<>::loaded[ENTRY_glVertex2dv])(v);
+    }
+    inline void APIENTRY counted_glVertex2f(GLfloat x, GLfloat y)
+    {
+        Table<>::counts[ENTRY_glVertex2f]++;
+        ((PFNGLVERTEX2FPROC)Table<>::loaded[ENTRY_glVertex2f])(x, y);
+    }
+    inline void APIENTRY counted_glVertex2fv(const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glVertex2fv]++;
+        ((PFNGLVERTEX2FVPROC)Table<>::loaded[ENTRY_glVertex2fv])(v);
+    }
+    inline void APIENTRY counted_glVertex2i(GLint x, GLint y)
+    {
+        Table<>::counts[ENTRY_glVertex2i]++;
+        ((PFNGLVERTEX2IPROC)Table<>::loaded[ENTRY_glVertex2i])(x, y);
+    }
+    inline void APIENTRY counted_glVertex2iv(const GLint *v)
+    {
+        Table<>::counts[ENTRY_glVertex2iv]++;
+        ((PFNGLVERTEX2IVPROC)Table<>::loaded[ENTRY_glVertex2iv])(v);
+    }
+    inline void APIENTRY counted_glVertex2s(GLshort x, GLshort y)
+    {
+        Table<>::counts[ENTRY_glVertex2s]++;
+        ((PFNGLVERTEX2SPROC)Table<>::loaded[ENTRY_glVertex2s])(x, y);
+    }
+    inline void APIENTRY counted_glVertex2sv(const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glVertex2sv]++;
+        ((PFNGLVERTEX2SVPROC)Table<>::loaded[ENTRY_glVertex2sv])(v);
+    }
+    inline void APIENTRY counted_glVertex3d(GLdouble x, GLdouble y, GLdouble z)
+    {
+        Table<>::counts[ENTRY_glVertex3d]++;
+        ((PFNGLVERTEX3DPROC)Table<>::loaded[ENTRY_glVertex3d])(x, y, z);
+    }
+    inline void APIENTRY counted_glVertex3dv(const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glVertex3dv]++;
+        ((PFNGLVERTEX3DVPROC)Table<>::loaded[ENTRY_glVertex3dv])(v);
+    }
+    inline void APIENTRY counted_glVertex3f(GLfloat x, GLfloat y, GLfloat z)
+    {
+        Table<>::counts[ENTRY_glVertex3f]++;
+        ((PFNGLVERTEX3FPROC)Table<>::loaded[ENTRY_glVertex3f])(x, y, z);
+    }
+    inline void APIENTRY counted_glVertex3fv(const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glVertex3fv]++;
+        ((PFNGLVERTEX3FVPROC)Table<>::loaded[ENTRY_glVertex3fv])(v);
+    }
+    inline void APIENTRY counted_glVertex3i(GLint x, GLint y, GLint z)
+    {
+        Table<>::counts[ENTRY_glVertex3i]++;
+        ((PFNGLVERTEX3IPROC)Table<>::loaded[ENTRY_glVertex3i])(x, y, z);
+    }
+    inline void APIENTRY counted_glVertex3iv(const GLint *v)
+    {
+        Table<>::counts[ENTRY_glVertex3iv]++;
+        ((PFNGLVERTEX3IVPROC)Table<>::loaded[ENTRY_glVertex3iv])(v);
+    }
+    inline void APIENTRY counted_glVertex3s(GLshort x, GLshort y, GLshort z)
+    {
+        Table<>::counts[ENTRY_glVertex3s]++;
+        ((PFNGLVERTEX3SPROC)Table<>::loaded[ENTRY_glVertex3s])(x, y, z);
+    }
+    inline void APIENTRY counted_glVertex3sv(const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glVertex3sv]++;
+        ((PFNGLVERTEX3SVPROC)Table<>::loaded[ENTRY_glVertex3sv])(v);
+    }
+    inline void APIENTRY counted_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+    {
+        Table<>::counts[ENTRY_glVertex4d]++;
+        ((PFNGLVERTEX4DPROC)Table<>::loaded[ENTRY_glVertex4d])(x, y, z, w);
+    }
+    inline void APIENTRY counted_glVertex4dv(const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glVertex4dv]++;
+        ((PFNGLVERTEX4DVPROC)Table<>::loaded[ENTRY_glVertex4dv])(v);
+    }
+    inline void APIENTRY counted_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+    {
+        Table<>::counts[ENTRY_glVertex4f]++;
+        ((PFNGLVERTEX4FPROC)Table<>::loaded[ENTRY_glVertex4f])(x, y, z, w);
+    }
+    inline void APIENTRY counted_glVertex4fv(const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glVertex4fv]++;
+        ((PFNGLVERTEX4FVPROC)Table<>::loaded[ENTRY_glVertex4fv])(v);
+    }
+    inline void APIENTRY counted_glVertex4i(GLint x, GLint y, GLint z, GLint w)
+    {
+        Table<>::counts[ENTRY_glVertex4i]++;
+        ((PFNGLVERTEX4IPROC)Table<>::loaded[ENTRY_glVertex4i])(x, y, z, w);
+    }
+    inline void APIENTRY counted_glVertex4iv(const GLint *v)
+    {
+        Table<>::counts[ENTRY_glVertex4iv]++;
+        ((PFNGLVERTEX4IVPROC)Table<>::loaded[ENTRY_glVertex4iv])(v);
+    }
+    inline void APIENTRY counted_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w)
+    {
+        Table<>::counts[ENTRY_glVertex4s]++;
+        ((PFNGLVERTEX4SPROC)Table<>::loaded[ENTRY_glVertex4s])(x, y, z, w);
+    }
+    inline void APIENTRY counted_glVertex4sv(const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glVertex4sv]++;
+        ((PFNGLVERTEX4SVPROC)Table<>::loaded[ENTRY_glVertex4sv])(v);
+    }
+    inline void APIENTRY counted_glClipPlane(GLenum plane, const GLdouble *equation)
+    {
+        Table<>::counts[ENTRY_glClipPlane]++;
+        ((PFNGLCLIPPLANEPROC)Table<>::loaded[ENTRY_glClipPlane])(plane, equation);
+    }
+    inline void APIENTRY counted_glColorMaterial(GLenum face, GLenum mode)
+    {
+        Table<>::counts[ENTRY_glColorMaterial]++;
+        ((PFNGLCOLORMATERIALPROC)Table<>::loaded[ENTRY_glColorMaterial])(face, mode);
+    }
+    inline void APIENTRY counted_glFogf(GLenum pname, GLfloat param)
+    {
+        Table<>::counts[ENTRY_glFogf]++;
+        ((PFNGLFOGFPROC)Table<>::loaded[ENTRY_glFogf])(pname, param);
+    }
+    inline void APIENTRY counted_glFogfv(GLenum pname, const GLfloat *params)
+    {
+        Table<>::counts[ENTRY_glFogfv]++;
+        ((PFNGLFOGFVPROC)Table<>::loaded[ENTRY_glFogfv])(pname, params);
+    }
+    inline void APIENTRY counted_glFogi(GLenum pname, GLint param)
+    {
+        Table<>::counts[ENTRY_glFogi]++;
+        ((PFNGLFOGIPROC)Table<>::loaded[ENTRY_glFogi])(pname, param);
+    }
+    inline void APIENTRY counted_glFogiv(GLenum pname, const GLint *params)
+    {
+        Table<>::counts[ENTRY_glFogiv]++;
+        ((PFNGLFOGIVPROC)Table<>::loaded[ENTRY_glFogiv])(pname, params);
+    }
+    inline void APIENTRY counted_glLightf(GLenum light, GLenum pname, GLfloat param)
+    {
+        Table<>::counts[ENTRY_glLightf]++;
+        ((PFNGLLIGHTFPROC)Table<>::loaded[ENTRY_glLightf])(light, pname, param);
+    }
+    inline void APIENTRY counted_glLightfv(GLenum light, GLenum pname, const GLfloat *params)
+    {
+        Table<>::counts[ENTRY_glLightfv]++;
+        ((PFNGLLIGHTFVPROC)Table<>::loaded[ENTRY_glLightfv])(light, pname, params);
+    }
+    inline void APIENTRY counted_glLighti(GLenum light, GLenum pname, GLint param)
+    {
+        Table<>::counts[ENTRY_glLighti]++;
+        ((PFNGLLIGHTIPROC)Table<>::loaded[ENTRY_glLighti])(light, pname, param);
+    }
+    inline void APIENTRY counted_glLightiv(GLenum light, GLenum pname, const GLint *params)
+    {
+        Table<>::counts[ENTRY_glLightiv]++;
+        ((PFNGLLIGHTIVPROC)Table<>::loaded[ENTRY_glLightiv])(light, pname, params);
+    }
+    inline void APIENTRY counted_glLightModelf(GLenum pname, GLfloat param)
+    {
+        Table<>::counts[ENTRY_glLightModelf]++;
+        ((PFNGLLIGHTMODELFPROC)Table<>::loaded[ENTRY_glLightModelf])(pname, param);
+    }
+    inline void APIENTRY counted_glLightModelfv(GLenum pname, const GLfloat *params)
+    {
+        Table<>::counts[ENTRY_glLightModelfv]++;
+        ((PFNGLLIGHTMODELFVPROC)Table<>::loaded[ENTRY_glLightModelfv])(pname, params);
+    }
+    inline void APIENTRY counted_glLightModeli(GLenum pname, GLint param)
+    {
+        Table<>::counts[ENTRY_glLightModeli]++;
+        ((PFNGLLIGHTMODELIPROC)Table<>::loaded[ENTRY_glLightModeli])(pname, param);
+    }
+    inline void APIENTRY counted_glLightModeliv(GLenum pname, const GLint *params)
+    {
+        Table<>::counts[ENTRY_glLightModeliv]++;
+        ((PFNGLLIGHTMODELIVPROC)Table<>::loaded[ENTRY_glLightModeliv])(pname, params);
+    }
+    inline void APIENTRY counted_glLineStipple(GLint factor, GLushort pattern)
+    {
+        Table<>::counts[ENTRY_glLineStipple]++;
+        ((PFNGLLINESTIPPLEPROC)Table<>::loaded[ENTRY_glLineStipple])(factor, pattern);
+    }
+    inline void APIENTRY counted_glMaterialf(GLenum face, GLenum pname, GLfloat param)
+    {
+        Table<>::counts[ENTRY_glMaterialf]++;
+        ((PFNGLMATERIALFPROC)Table<>::loaded[ENTRY_glMaterialf])(face, pname, param);
+    }
+    inline void APIENTRY counted_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params)
+    {
+        Table<>::counts[ENTRY_glMaterialfv]++;
+        ((PFNGLMATERIALFVPROC)Table<>::loaded[ENTRY_glMaterialfv])(face, pname, params);
+    }
+    inline void APIENTRY counted_glMateriali(GLenum face, GLenum pname, GLint param)
+    {
+        Table<>::counts[ENTRY_glMateriali]++;
+        ((PFNGLMATERIALIPROC)Table<>::loaded[ENTRY_glMateriali])(face, pname, param);
+    }
+    inline void APIENTRY counted_glMaterialiv(GLenum face, GLenum pname, const GLint *params)
+    {
+        Table<>::counts[ENTRY_glMaterialiv]++;
+        ((PFNGLMATERIALIVPROC)Table<>::loaded[ENTRY_glMaterialiv])(face, pname, params);
+    }
+    inline void APIENTRY counted_glPolygonStipple(const GLubyte *mask)
+    {
+        Table<>::counts[ENTRY_glPolygonStipple]++;
+        ((PFNGLPOLYGONSTIPPLEPROC)Table<>::loaded[ENTRY_glPolygonStipple])(mask);
+    }
+    inline void APIENTRY counted_glShadeModel(GLenum mode)
+    {
+        Table<>::counts[ENTRY_glShadeModel]++;
+        ((PFNGLSHADEMODELPROC)Table<>::loaded[ENTRY_glShadeModel])(mode);
+    }
+    inline void APIENTRY counted_glTexEnvf(GLenum target, GLenum pname, GLfloat param)
+    {
+        Table<>::counts[ENTRY_glTexEnvf]++;
+        ((PFNGLTEXENVFPROC)Table<>::loaded[ENTRY_glTexEnvf])(target, pname, param);
+    }
+    inline void APIENTRY counted_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params)
+    {
+        Table<>::counts[ENTRY_glTexEnvfv]++;
+        ((PFNGLTEXENVFVPROC)Table<>::loaded[ENTRY_glTexEnvfv])(target, pname, params);
+    }
+    inline void APIENTRY counted_glTexEnvi(GLenum target, GLenum pname, GLint param)
+    {
+        Table<>::counts[ENTRY_glTexEnvi]++;
+        ((PFNGLTEXENVIPROC)Table<>::loaded[ENTRY_glTexEnvi])(target, pname, param);
+    }
+    inline void APIENTRY counted_glTexEnviv(GLenum target, GLenum pname, const GLint *params)
+    {
+        Table<>::counts[ENTRY_glTexEnviv]++;
+        ((PFNGLTEXENVIVPROC)Table<>::loaded[ENTRY_glTexEnviv])(target, pname, params);
+    }
+    inline void APIENTRY counted_glTexGend(GLenum coord, GLenum pname, GLdouble param)
+    {
+        Table<>::counts[ENTRY_glTexGend]++;
+        ((PFNGLTEXGENDPROC)Table<>::loaded[ENTRY_glTexGend])(coord, pname, param);
+    }
+    inline void APIENTRY counted_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params)
+    {
+        Table<>::counts[ENTRY_glTexGendv]++;
+        ((PFNGLTEXGENDVPROC)Table<>::loaded[ENTRY_glTexGendv])(coord, pname, params);
+    }
+    inline void APIENTRY counted_glTexGenf(GLenum coord, GLenum pname, GLfloat param)
+    {
+        Table<>::counts[ENTRY_glTexGenf]++;
+        ((PFNGLTEXGENFPROC)Table<>::loaded[ENTRY_glTexGenf])(coord, pname, param);
+    }
+    inline void APIENTRY counted_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params)
+    {
+        Table<>::counts[ENTRY_glTexGenfv]++;
+        ((PFNGLTEXGENFVPROC)Table<>::loaded[ENTRY_glTexGenfv])(coord, pname, params);
+    }
+    inline void APIENTRY counted_glTexGeni(GLenum coord, GLenum pname, GLint param)
+    {
+        Table<>::counts[ENTRY_glTexGeni]++;
+        ((PFNGLTEXGENIPROC)Table<>::loaded[ENTRY_glTexGeni])(coord, pname, param);
+    }
+    inline void APIENTRY counted_glTexGeniv(GLenum coord, GLenum pname, const GLint *params)
+    {
+        Table<>::counts[ENTRY_glTexGeniv]++;
+        ((PFNGLTEXGENIVPROC)Table<>::loaded[ENTRY_glTexGeniv])(coord, pname, params);
+    }
+    inline void APIENTRY counted_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer)
+    {
+        Table<>::counts[ENTRY_glFeedbackBuffer]++;
+        ((PFNGLFEEDBACKBUFFERPROC)Table<>::loaded[ENTRY_glFeedbackBuffer])(size, type, buffer);
+    }
+    inline void APIENTRY counted_glSelectBuffer(GLsizei size, GLuint *buffer)
+    {
+        Table<>::counts[ENTRY_glSelectBuffer]++;
+        ((PFNGLSELECTBUFFERPROC)Table<>::loaded[ENTRY_glSelectBuffer])(size, buffer);
+    }
+    inline GLint APIENTRY counted_glRenderMode(GLenum mode)
+    {
+        Table<>::counts[ENTRY_glRenderMode]++;
+        return ((PFNGLRENDERMODEPROC)Table<>::loaded[ENTRY_glRenderMode])(mode);
+    }
+    inline void APIENTRY counted_glInitNames(void)
+    {
+        Table<>::counts[ENTRY_glInitNames]++;
+        ((PFNGLINITNAMESPROC)Table<>::loaded[ENTRY_glInitNames])();
+    }
+    inline void APIENTRY counted_glLoadName(GLuint name)
+    {
+        Table<>::counts[ENTRY_glLoadName]++;
+        ((PFNGLLOADNAMEPROC)Table<>::loaded[ENTRY_glLoadName])(name);
+    }
+    inline void APIENTRY counted_glPassThrough(GLfloat token)
+    {
+        Table<>::counts[ENTRY_glPassThrough]++;
+        ((PFNGLPASSTHROUGHPROC)Table<>::loaded[ENTRY_glPassThrough])(token);
+    }
+    inline void APIENTRY counted_glPopName(void)
+    {
+        Table<>::counts[ENTRY_glPopName]++;
+        ((PFNGLPOPNAMEPROC)Table<>::loaded[ENTRY_glPopName])();
+    }
+    inline void APIENTRY counted_glPushName(GLuint name)
+    {
+        Table<>::counts[ENTRY_glPushName]++;
+        ((PFNGLPUSHNAMEPROC)Table<>::loaded[ENTRY_glPushName])(name);
+    }
+    inline void APIENTRY counted_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+    {
+        Table<>::counts[ENTRY_glClearAccum]++;
+        ((PFNGLCLEARACCUMPROC)Table<>::loaded[ENTRY_glClearAccum])(red, green, blue, alpha);
+    }
+    inline void APIENTRY counted_glClearIndex(GLfloat c)
+    {
+        Table<>::counts[ENTRY_glClearIndex]++;
+        ((PFNGLCLEARINDEXPROC)Table<>::loaded[ENTRY_glClearIndex])(c);
+    }
+    inline void APIENTRY counted_glIndexMask(GLuint mask)
+    {
+        Table<>::counts[ENTRY_glIndexMask]++;
+        ((PFNGLINDEXMASKPROC)Table<>::loaded[ENTRY_glIndexMask])(mask);
+    }
+    inline void APIENTRY counted_glAccum(GLenum op, GLfloat value)
+    {
+        Table<>::counts[ENTRY_glAccum]++;
+        ((PFNGLACCUMPROC)Table<>::loaded[ENTRY_glAccum])(op, value);
+    }
+    inline void APIENTRY counted_glPopAttrib(void)
+    {
+        Table<>::counts[ENTRY_glPopAttrib]++;
+        ((PFNGLPOPATTRIBPROC)Table<>::loaded[ENTRY_glPopAttrib])();
+    }
+    inline void APIENTRY counted_glPushAttrib(GLbitfield mask)
+    {
+        Table<>::counts[ENTRY_glPushAttrib]++;
+        ((PFNGLPUSHATTRIBPROC)Table<>::loaded[ENTRY_glPushAttrib])(mask);
+    }
+    inline void APIENTRY counted_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points)
+    {
+        Table<>::counts[ENTRY_glMap1d]++;
+        ((PFNGLMAP1DPROC)Table<>::loaded[ENTRY_glMap1d])(target, u1, u2, stride, order, points);
+    }
+    inline void APIENTRY counted_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points)
+    {
+        Table<>::counts[ENTRY_glMap1f]++;
+        ((PFNGLMAP1FPROC)Table<>::loaded[ENTRY_glMap1f])(target, u1, u2, stride, order, points);
+    }
+    inline void APIENTRY counted_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points)
+    {
+        Table<>::counts[ENTRY_glMap2d]++;
+        ((PFNGLMAP2DPROC)Table<>::loaded[ENTRY_glMap2d])(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+    }
+    inline void APIENTRY counted_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points)
+    {
+        Table<>::counts[ENTRY_glMap2f]++;
+        ((PFNGLMAP2FPROC)Table<>::loaded[ENTRY_glMap2f])(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+    }
+    inline void APIENTRY counted_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2)
+    {
+        Table<>::counts[ENTRY_glMapGrid1d]++;
+        ((PFNGLMAPGRID1DPROC)Table<>::loaded[ENTRY_glMapGrid1d])(un, u1, u2);
+    }
+    inline void APIENTRY counted_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2)
+    {
+        Table<>::counts[ENTRY_glMapGrid1f]++;
+        ((PFNGLMAPGRID1FPROC)Table<>::loaded[ENTRY_glMapGrid1f])(un, u1, u2);
+    }
+    inline void APIENTRY counted_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2)
+    {
+        Table<>::counts[ENTRY_glMapGrid2d]++;
+        ((PFNGLMAPGRID2DPROC)Table<>::loaded[ENTRY_glMapGrid2d])(un, u1, u2, vn, v1, v2);
+    }
+    inline void APIENTRY counted_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2)
+    {
+        Table<>::counts[ENTRY_glMapGrid2f]++;
+        ((PFNGLMAPGRID2FPROC)Table<>::loaded[ENTRY_glMapGrid2f])(un, u1, u2, vn, v1, v2);
+    }
+    inline void APIENTRY counted_glEvalCoord1d(GLdouble u)
+    {
+        Table<>::counts[ENTRY_glEvalCoord1d]++;
+        ((PFNGLEVALCOORD1DPROC)Table<>::loaded[ENTRY_glEvalCoord1d])(u);
+    }
+    inline void APIENTRY counted_glEvalCoord1dv(const GLdouble *u)
+    {
+        Table<>::counts[ENTRY_glEvalCoord1dv]++;
+        ((PFNGLEVALCOORD1DVPROC)Table<>::loaded[ENTRY_glEvalCoord1dv])(u);
+    }
+    inline void APIENTRY counted_glEvalCoord1f(GLfloat u)
+    {
+        Table<>::counts[ENTRY_glEvalCoord1f]++;
+        ((PFNGLEVALCOORD1FPROC)Table<>::loaded[ENTRY_glEvalCoord1f])(u);
+    }
+    inline void APIENTRY counted_glEvalCoord1fv(const GLfloat *u)
+    {
+        Table<>::counts[ENTRY_glEvalCoord1fv]++;
+        ((PFNGLEVALCOORD1FVPROC)Table<>::loaded[ENTRY_glEvalCoord1fv])(u);
+    }
+    inline void APIENTRY counted_glEvalCoord2d(GLdouble u, GLdouble v)
+    {
+        Table<>::counts[ENTRY_glEvalCoord2d]++;
+        ((PFNGLEVALCOORD2DPROC)Table<>::loaded[ENTRY_glEvalCoord2d])(u, v);
+    }
+    inline void APIENTRY counted_glEvalCoord2dv(const GLdouble *u)
+    {
+        Table<>::counts[ENTRY_glEvalCoord2dv]++;
+        ((PFNGLEVALCOORD2DVPROC)Table<>::loaded[ENTRY_glEvalCoord2dv])(u);
+    }
+    inline void APIENTRY counted_glEvalCoord2f(GLfloat u, GLfloat v)
+    {
+        Table<>::counts[ENTRY_glEvalCoord2f]++;
+        ((PFNGLEVALCOORD2FPROC)Table<>::loaded[ENTRY_glEvalCoord2f])(u, v);
+    }
+    inline void APIENTRY counted_glEvalCoord2fv(const GLfloat *u)
+    {
+        Table<>::counts[ENTRY_glEvalCoord2fv]++;
+        ((PFNGLEVALCOORD2FVPROC)Table<>::loaded[ENTRY_glEvalCoord2fv])(u);
+    }
+    inline void APIENTRY counted_glEvalMesh1(GLenum mode, GLint i1, GLint i2)
+    {
+        Table<>::counts[ENTRY_glEvalMesh1]++;
+        ((PFNGLEVALMESH1PROC)Table<>::loaded[ENTRY_glEvalMesh1])(mode, i1, i2);
+    }
+    inline void APIENTRY counted_glEvalPoint1(GLint i)
+    {
+        Table<>::counts[ENTRY_glEvalPoint1]++;
+        ((PFNGLEVALPOINT1PROC)Table<>::loaded[ENTRY_glEvalPoint1])(i);
+    }
+    inline void APIENTRY counted_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2)
+    {
+        Table<>::counts[ENTRY_glEvalMesh2]++;
+        ((PFNGLEVALMESH2PROC)Table<>::loaded[ENTRY_glEvalMesh2])(mode, i1, i2, j1, j2);
+    }
+    inline void APIENTRY counted_glEvalPoint2(GLint i, GLint j)
+    {
+        Table<>::counts[ENTRY_glEvalPoint2]++;
+        ((PFNGLEVALPOINT2PROC)Table<>::loaded[ENTRY_glEvalPoint2])(i, j);
+    }
+    inline void APIENTRY counted_glAlphaFunc(GLenum func, GLfloat ref)
+    {
+        Table<>::counts[ENTRY_glAlphaFunc]++;
+        ((PFNGLALPHAFUNCPROC)Table<>::loaded[ENTRY_glAlphaFunc])(func, ref);
+    }
+    inline void APIENTRY counted_glPixelZoom(GLfloat xfactor, GLfloat yfactor)
+    {
+        Table<>::counts[ENTRY_glPixelZoom]++;
+        ((PFNGLPIXELZOOMPROC)Table<>::loaded[ENTRY_glPixelZoom])(xfactor, yfactor);
+    }
+    inline void APIENTRY counted_glPixelTransferf(GLenum pname, GLfloat param)
+    {
+        Table<>::counts[ENTRY_glPixelTransferf]++;
+        ((PFNGLPIXELTRANSFERFPROC)Table<>::loaded[ENTRY_glPixelTransferf])(pname, param);
+    }
+    inline void APIENTRY counted_glPixelTransferi(GLenum pname, GLint param)
+    {
+        Table<>::counts[ENTRY_glPixelTransferi]++;
+        ((PFNGLPIXELTRANSFERIPROC)Table<>::loaded[ENTRY_glPixelTransferi])(pname, param);
+    }
+    inline void APIENTRY counted_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values)
+    {
+        Table<>::counts[ENTRY_glPixelMapfv]++;
+        ((PFNGLPIXELMAPFVPROC)Table<>::loaded[ENTRY_glPixelMapfv])(map, mapsize, values);
+    }
+    inline void APIENTRY counted_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values)
+    {
+        Table<>::counts[ENTRY_glPixelMapuiv]++;
+        ((PFNGLPIXELMAPUIVPROC)Table<>::loaded[ENTRY_glPixelMapuiv])(map, mapsize, values);
+    }
+    inline void APIENTRY counted_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values)
+    {
+        Table<>::counts[ENTRY_glPixelMapusv]++;
+        ((PFNGLPIXELMAPUSVPROC)Table<>::loaded[ENTRY_glPixelMapusv])(map, mapsize, values);
+    }
+    inline void APIENTRY counted_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type)
+    {
+        Table<>::counts[ENTRY_glCopyPixels]++;
+        ((PFNGLCOPYPIXELSPROC)Table<>::loaded[ENTRY_glCopyPixels])(x, y, width, height, type);
+    }
+    inline void APIENTRY counted_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+    {
+        Table<>::counts[ENTRY_glDrawPixels]++;
+        ((PFNGLDRAWPIXELSPROC)Table<>::loaded[ENTRY_glDrawPixels])(width, height, format, type, pixels);
+    }
+    inline void APIENTRY counted_glGetClipPlane(GLenum plane, GLdouble *equation)
+    {
+        Table<>::counts[ENTRY_glGetClipPlane]++;
+        ((PFNGLGETCLIPPLANEPROC)Table<>::loaded[ENTRY_glGetClipPlane])(plane, equation);
+    }
+    inline void APIENTRY counted_glGetLightfv(GLenum light, GLenum pname, GLfloat *params)
+    {
+        Table<>::counts[ENTRY_glGetLightfv]++;
+        ((PFNGLGETLIGHTFVPROC)Table<>::loaded[ENTRY_glGetLightfv])(light, pname, params);
+    }
+    inline void APIENTRY counted_glGetLightiv(GLenum light, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetLightiv]++;
+        ((PFNGLGETLIGHTIVPROC)Table<>::loaded[ENTRY_glGetLightiv])(light, pname, params);
+    }
+    inline void APIENTRY counted_glGetMapdv(GLenum target, GLenum query, GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glGetMapdv]++;
+        ((PFNGLGETMAPDVPROC)Table<>::loaded[ENTRY_glGetMapdv])(target, query, v);
+    }
+    inline void APIENTRY counted_glGetMapfv(GLenum target, GLenum query, GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glGetMapfv]++;
+        ((PFNGLGETMAPFVPROC)Table<>::loaded[ENTRY_glGetMapfv])(target, query, v);
+    }
+    inline void APIENTRY counted_glGetMapiv(GLenum target, GLenum query, GLint *v)
+    {
+        Table<>::counts[ENTRY_glGetMapiv]++;
+        ((PFNGLGETMAPIVPROC)Table<>::loaded[ENTRY_glGetMapiv])(target, query, v);
+    }
+    inline void APIENTRY counted_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params)
+    {
+        Table<>::counts[ENTRY_glGetMaterialfv]++;
+        ((PFNGLGETMATERIALFVPROC)Table<>::loaded[ENTRY_glGetMaterialfv])(face, pname, params);
+    }
+    inline void APIENTRY counted_glGetMaterialiv(GLenum face, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetMaterialiv]++;
+        ((PFNGLGETMATERIALIVPROC)Table<>::loaded[ENTRY_glGetMaterialiv])(face, pname, params);
+    }
+    inline void APIENTRY counted_glGetPixelMapfv(GLenum map, GLfloat *values)
+    {
+        Table<>::counts[ENTRY_glGetPixelMapfv]++;
+        ((PFNGLGETPIXELMAPFVPROC)Table<>::loaded[ENTRY_glGetPixelMapfv])(map, values);
+    }
+    inline void APIENTRY counted_glGetPixelMapuiv(GLenum map, GLuint *values)
+    {
+        Table<>::counts[ENTRY_glGetPixelMapuiv]++;
+        ((PFNGLGETPIXELMAPUIVPROC)Table<>::loaded[ENTRY_glGetPixelMapuiv])(map, values);
+    }
+    inline void APIENTRY counted_glGetPixelMapusv(GLenum map, GLushort *values)
+    {
+        Table<>::counts[ENTRY_glGetPixelMapusv]++;
+        ((PFNGLGETPIXELMAPUSVPROC)Table<>::loaded[ENTRY_glGetPixelMapusv])(map, values);
+    }
+    inline void APIENTRY counted_glGetPolygonStipple(GLubyte *mask)
+    {
+        Table<>::counts[ENTRY_glGetPolygonStipple]++;
+        ((PFNGLGETPOLYGONSTIPPLEPROC)Table<>::loaded[ENTRY_glGetPolygonStipple])(mask);
+    }
+    inline void APIENTRY counted_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params)
+    {
+        Table<>::counts[ENTRY_glGetTexEnvfv]++;
+        ((PFNGLGETTEXENVFVPROC)Table<>::loaded[ENTRY_glGetTexEnvfv])(target, pname, params);
+    }
+    inline void APIENTRY counted_glGetTexEnviv(GLenum target, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetTexEnviv]++;
+        ((PFNGLGETTEXENVIVPROC)Table<>::loaded[ENTRY_glGetTexEnviv])(target, pname, params);
+    }
+    inline void APIENTRY counted_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params)
+    {
+        Table<>::counts[ENTRY_glGetTexGendv]++;
+        ((PFNGLGETTEXGENDVPROC)Table<>::loaded[ENTRY_glGetTexGendv])(coord, pname, params);
+    }
+    inline void APIENTRY counted_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params)
+    {
+        Table<>::counts[ENTRY_glGetTexGenfv]++;
+        ((PFNGLGETTEXGENFVPROC)Table<>::loaded[ENTRY_glGetTexGenfv])(coord, pname, params);
+    }
+    inline void APIENTRY counted_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetTexGeniv]++;
+        ((PFNGLGETTEXGENIVPROC)Table<>::loaded[ENTRY_glGetTexGeniv])(coord, pname, params);
+    }
+    inline GLboolean APIENTRY counted_glIsList(GLuint list)
+    {
+        Table<>::counts[ENTRY_glIsList]++;
+        return ((PFNGLISLISTPROC)Table<>::loaded[ENTRY_glIsList])(list);
+    }
+    inline void APIENTRY counted_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
+    {
+        Table<>::counts[ENTRY_glFrustum]++;
+        ((PFNGLFRUSTUMPROC)Table<>::loaded[ENTRY_glFrustum])(left, right, bottom, top, zNear, zFar);
+    }
+    inline void APIENTRY counted_glLoadIdentity(void)
+    {
+        Table<>::counts[ENTRY_glLoadIdentity]++;
+        ((PFNGLLOADIDENTITYPROC)Table<>::loaded[ENTRY_glLoadIdentity])();
+    }
+    inline void APIENTRY counted_glLoadMatrixf(const GLfloat *m)
+    {
+        Table<>::counts[ENTRY_glLoadMatrixf]++;
+        ((PFNGLLOADMATRIXFPROC)Table<>::loaded[ENTRY_glLoadMatrixf])(m);
+    }
+    inline void APIENTRY counted_glLoadMatrixd(const GLdouble *m)
+    {
+        Table<>::counts[ENTRY_glLoadMatrixd]++;
+        ((PFNGLLOADMATRIXDPROC)Table<>::loaded[ENTRY_glLoadMatrixd])(m);
+    }
+    inline void APIENTRY counted_glMatrixMode(GLenum mode)
+    {
+        Table<>::counts[ENTRY_glMatrixMode]++;
+        ((PFNGLMATRIXMODEPROC)Table<>::loaded[ENTRY_glMatrixMode])(mode);
+    }
+    inline void APIENTRY counted_glMultMatrixf(const GLfloat *m)
+    {
+        Table<>::counts[ENTRY_glMultMatrixf]++;
+        ((PFNGLMULTMATRIXFPROC)Table<>::loaded[ENTRY_glMultMatrixf])(m);
+    }
+    inline void APIENTRY counted_glMultMatrixd(const GLdouble *m)
+    {
+        Table<>::counts[ENTRY_glMultMatrixd]++;
+        ((PFNGLMULTMATRIXDPROC)Table<>::loaded[ENTRY_glMultMatrixd])(m);
+    }
+    inline void APIENTRY counted_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
+    {
+        Table<>::counts[ENTRY_glOrtho]++;
+        ((PFNGLORTHOPROC)Table<>::loaded[ENTRY_glOrtho])(left, right, bottom, top, zNear, zFar);
+    }
+    inline void APIENTRY counted_glPopMatrix(void)
+    {
+        Table<>::counts[ENTRY_glPopMatrix]++;
+        ((PFNGLPOPMATRIXPROC)Table<>::loaded[ENTRY_glPopMatrix])();
+    }
+    inline void APIENTRY counted_glPushMatrix(void)
+    {
+        Table<>::counts[ENTRY_glPushMatrix]++;
+        ((PFNGLPUSHMATRIXPROC)Table<>::loaded[ENTRY_glPushMatrix])();
+    }
+    inline void APIENTRY counted_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z)
+    {
+        Table<>::counts[ENTRY_glRotated]++;
+        ((PFNGLROTATEDPROC)Table<>::loaded[ENTRY_glRotated])(angle, x, y, z);
+    }
+    inline void APIENTRY counted_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
+    {
+        Table<>::counts[ENTRY_glRotatef]++;
+        ((PFNGLROTATEFPROC)Table<>::loaded[ENTRY_glRotatef])(angle, x, y, z);
+    }
+    inline void APIENTRY counted_glScaled(GLdouble x, GLdouble y, GLdouble z)
+    {
+        Table<>::counts[ENTRY_glScaled]++;
+        ((PFNGLSCALEDPROC)Table<>::loaded[ENTRY_glScaled])(x, y, z);
+    }
+    inline void APIENTRY counted_glScalef(GLfloat x, GLfloat y, GLfloat z)
+    {
+        Table<>::counts[ENTRY_glScalef]++;
+        ((PFNGLSCALEFPROC)Table<>::loaded[ENTRY_glScalef])(x, y, z);
+    }
+    inline void APIENTRY counted_glTranslated(GLdouble x, GLdouble y, GLdouble z)
+    {
+        Table<>::counts[ENTRY_glTranslated]++;
+        ((PFNGLTRANSLATEDPROC)Table<>::loaded[ENTRY_glTranslated])(x, y, z);
+    }
+    inline void APIENTRY counted_glTranslatef(GLfloat x, GLfloat y, GLfloat z)
+    {
+        Table<>::counts[ENTRY_glTranslatef]++;
+        ((PFNGLTRANSLATEFPROC)Table<>::loaded[ENTRY_glTranslatef])(x, y, z);
+    }
+    inline void APIENTRY counted_glDrawArrays(GLenum mode, GLint first, GLsizei count)
+    {
+        Table<>::counts[ENTRY_glDrawArrays]++;
+        ((PFNGLDRAWARRAYSPROC)Table<>::loaded[ENTRY_glDrawArrays])(mode, first, count);
+    }
+    inline void APIENTRY counted_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
+    {
+        Table<>::counts[ENTRY_glDrawElements]++;
+        ((PFNGLDRAWELEMENTSPROC)Table<>::loaded[ENTRY_glDrawElements])(mode, count, type, indices);
+    }
+    inline void APIENTRY counted_glGetPointerv(GLenum pname, void **params)
+    {
+        Table<>::counts[ENTRY_glGetPointerv]++;
+        ((PFNGLGETPOINTERVPROC)Table<>::loaded[ENTRY_glGetPointerv])(pname, params);
+    }
+    inline void APIENTRY counted_glPolygonOffset(GLfloat factor, GLfloat units)
+    {
+        Table<>::counts[ENTRY_glPolygonOffset]++;
+        ((PFNGLPOLYGONOFFSETPROC)Table<>::loaded[ENTRY_glPolygonOffset])(factor, units);
+    }
+    inline void APIENTRY counted_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+    {
+        Table<>::counts[ENTRY_glCopyTexImage1D]++;
+        ((PFNGLCOPYTEXIMAGE1DPROC)Table<>::loaded[ENTRY_glCopyTexImage1D])(target, level, internalformat, x, y, width, border);
+    }
+    inline void APIENTRY counted_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+    {
+        Table<>::counts[ENTRY_glCopyTexImage2D]++;
+        ((PFNGLCOPYTEXIMAGE2DPROC)Table<>::loaded[ENTRY_glCopyTexImage2D])(target, level, internalformat, x, y, width, height, border);
+    }
+    inline void APIENTRY counted_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+    {
+        Table<>::counts[ENTRY_glCopyTexSubImage1D]++;
+        ((PFNGLCOPYTEXSUBIMAGE1DPROC)Table<>::loaded[ENTRY_glCopyTexSubImage1D])(target, level, xoffset, x, y, width);
+    }
+    inline void APIENTRY counted_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+    {
+        Table<>::counts[ENTRY_glCopyTexSubImage2D]++;
+        ((PFNGLCOPYTEXSUBIMAGE2DPROC)Table<>::loaded[ENTRY_glCopyTexSubImage2D])(target, level, xoffset, yoffset, x, y, width, height);
+    }
+    inline void APIENTRY counted_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+    {
+        Table<>::counts[ENTRY_glTexSubImage1D]++;
+        ((PFNGLTEXSUBIMAGE1DPROC)Table<>::loaded[ENTRY_glTexSubImage1D])(target, level, xoffset, width, format, type, pixels);
+    }
+    inline void APIENTRY counted_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+    {
+        Table<>::counts[ENTRY_glTexSubImage2D]++;
+        ((PFNGLTEXSUBIMAGE2DPROC)Table<>::loaded[ENTRY_glTexSubImage2D])(target, level, xoffset, yoffset, width, height, format, type, pixels);
+    }
+    inline void APIENTRY counted_glBindTexture(GLenum target, GLuint texture)
+    {
+        Table<>::counts[ENTRY_glBindTexture]++;
+        ((PFNGLBINDTEXTUREPROC)Table<>::loaded[ENTRY_glBindTexture])(target, texture);
+    }
+    inline void APIENTRY counted_glDeleteTextures(GLsizei n, const GLuint *textures)
+    {
+        Table<>::counts[ENTRY_glDeleteTextures]++;
+        ((PFNGLDELETETEXTURESPROC)Table<>::loaded[ENTRY_glDeleteTextures])(n, textures);
+    }
+    inline void APIENTRY counted_glGenTextures(GLsizei n, GLuint *textures)
+    {
+        Table<>::counts[ENTRY_glGenTextures]++;
+        ((PFNGLGENTEXTURESPROC)Table<>::loaded[ENTRY_glGenTextures])(n, textures);
+    }
+    inline GLboolean APIENTRY counted_glIsTexture(GLuint texture)
+    {
+        Table<>::counts[ENTRY_glIsTexture]++;
+        return ((PFNGLISTEXTUREPROC)Table<>::loaded[ENTRY_glIsTexture])(texture);
+    }
+    inline void APIENTRY counted_glArrayElement(GLint i)
+    {
+        Table<>::counts[ENTRY_glArrayElement]++;
+        ((PFNGLARRAYELEMENTPROC)Table<>::loaded[ENTRY_glArrayElement])(i);
+    }
+    inline void APIENTRY counted_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer)
+    {
+        Table<>::counts[ENTRY_glColorPointer]++;
+        ((PFNGLCOLORPOINTERPROC)Table<>::loaded[ENTRY_glColorPointer])(size, type, stride, pointer);
+    }
+    inline void APIENTRY counted_glDisableClientState(GLenum array)
+    {
+        Table<>::counts[ENTRY_glDisableClientState]++;
+        ((PFNGLDISABLECLIENTSTATEPROC)Table<>::loaded[ENTRY_glDisableClientState])(array);
+    }
+    inline void APIENTRY counted_glEdgeFlagPointer(GLsizei stride, const void *pointer)
+    {
+        Table<>::counts[ENTRY_glEdgeFlagPointer]++;
+        ((PFNGLEDGEFLAGPOINTERPROC)Table<>::loaded[ENTRY_glEdgeFlagPointer])(stride, pointer);
+    }
+    inline void APIENTRY counted_glEnableClientState(GLenum array)
+    {
+        Table<>::counts[ENTRY_glEnableClientState]++;
+        ((PFNGLENABLECLIENTSTATEPROC)Table<>::loaded[ENTRY_glEnableClientState])(array);
+    }
+    inline void APIENTRY counted_glIndexPointer(GLenum type, GLsizei stride, const void *pointer)
+    {
+        Table<>::counts[ENTRY_glIndexPointer]++;
+        ((PFNGLINDEXPOINTERPROC)Table<>::loaded[ENTRY_glIndexPointer])(type, stride, pointer);
+    }
+    inline void APIENTRY counted_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer)
+    {
+        Table<>::counts[ENTRY_glInterleavedArrays]++;
+        ((PFNGLINTERLEAVEDARRAYSPROC)Table<>::loaded[ENTRY_glInterleavedArrays])(format, stride, pointer);
+    }
+    inline void APIENTRY counted_glNormalPointer(GLenum type, GLsizei stride, const void *pointer)
+    {
+        Table<>::counts[ENTRY_glNormalPointer]++;
+        ((PFNGLNORMALPOINTERPROC)Table<>::loaded[ENTRY_glNormalPointer])(type, stride, pointer);
+    }
+    inline void APIENTRY counted_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer)
+    {
+        Table<>::counts[ENTRY_glTexCoordPointer]++;
+        ((PFNGLTEXCOORDPOINTERPROC)Table<>::loaded[ENTRY_glTexCoordPointer])(size, type, stride, pointer);
+    }
+    inline void APIENTRY counted_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer)
+    {
+        Table<>::counts[ENTRY_glVertexPointer]++;
+        ((PFNGLVERTEXPOINTERPROC)Table<>::loaded[ENTRY_glVertexPointer])(size, type, stride, pointer);
+    }
+    inline GLboolean APIENTRY counted_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences)
+    {
+        Table<>::counts[ENTRY_glAreTexturesResident]++;
+        return ((PFNGLARETEXTURESRESIDENTPROC)Table<>::loaded[ENTRY_glAreTexturesResident])(n, textures, residences);
+    }
+    inline void APIENTRY counted_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities)
+    {
+        Table<>::counts[ENTRY_glPrioritizeTextures]++;
+        ((PFNGLPRIORITIZETEXTURESPROC)Table<>::loaded[ENTRY_glPrioritizeTextures])(n, textures, priorities);
+    }
+    inline void APIENTRY counted_glIndexub(GLubyte c)
+    {
+        Table<>::counts[ENTRY_glIndexub]++;
+        ((PFNGLINDEXUBPROC)Table<>::loaded[ENTRY_glIndexub])(c);
+    }
+    inline void APIENTRY counted_glIndexubv(const GLubyte *c)
+    {
+        Table<>::counts[ENTRY_glIndexubv]++;
+        ((PFNGLINDEXUBVPROC)Table<>::loaded[ENTRY_glIndexubv])(c);
+    }
+    inline void APIENTRY counted_glPopClientAttrib(void)
+    {
+        Table<>::counts[ENTRY_glPopClientAttrib]++;
+        ((PFNGLPOPCLIENTATTRIBPROC)Table<>::loaded[ENTRY_glPopClientAttrib])();
+    }
+    inline void APIENTRY counted_glPushClientAttrib(GLbitfield mask)
+    {
+        Table<>::counts[ENTRY_glPushClientAttrib]++;
+        ((PFNGLPUSHCLIENTATTRIBPROC)Table<>::loaded[ENTRY_glPushClientAttrib])(mask);
+    }
+    inline void APIENTRY counted_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
+    {
+        Table<>::counts[ENTRY_glDrawRangeElements]++;
+        ((PFNGLDRAWRANGEELEMENTSPROC)Table<>::loaded[ENTRY_glDrawRangeElements])(mode, start, end, count, type, indices);
+    }
+    inline void APIENTRY counted_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
+    {
+        Table<>::counts[ENTRY_glTexImage3D]++;
+        ((PFNGLTEXIMAGE3DPROC)Table<>::loaded[ENTRY_glTexImage3D])(target, level, internalformat, width, height, depth, border, format, type, pixels);
+    }
+    inline void APIENTRY counted_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+    {
+        Table<>::counts[ENTRY_glTexSubImage3D]++;
+        ((PFNGLTEXSUBIMAGE3DPROC)Table<>::loaded[ENTRY_glTexSubImage3D])(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    }
+    inline void APIENTRY counted_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+    {
+        Table<>::counts[ENTRY_glCopyTexSubImage3D]++;
+        ((PFNGLCOPYTEXSUBIMAGE3DPROC)Table<>::loaded[ENTRY_glCopyTexSubImage3D])(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+    }
+    inline void APIENTRY counted_glActiveTexture(GLenum texture)
+    {
+        Table<>::counts[ENTRY_glActiveTexture]++;
+        ((PFNGLACTIVETEXTUREPROC)Table<>::loaded[ENTRY_glActiveTexture])(texture);
+    }
+    inline void APIENTRY counted_glSampleCoverage(GLfloat value, GLboolean invert)
+    {
+        Table<>::counts[ENTRY_glSampleCoverage]++;
+        ((PFNGLSAMPLECOVERAGEPROC)Table<>::loaded[ENTRY_glSampleCoverage])(value, invert);
+    }
+    inline void APIENTRY counted_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data)
+    {
+        Table<>::counts[ENTRY_glCompressedTexImage3D]++;
+        ((PFNGLCOMPRESSEDTEXIMAGE3DPROC)Table<>::loaded[ENTRY_glCompressedTexImage3D])(target, level, internalformat, width, height, depth, border, imageSize, data);
+    }
+    inline void APIENTRY counted_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+    {
+        Table<>::counts[ENTRY_glCompressedTexImage2D]++;
+        ((PFNGLCOMPRESSEDTEXIMAGE2DPROC)Table<>::loaded[ENTRY_glCompressedTexImage2D])(target, level, internalformat, width, height, border, imageSize, data);
+    }
+    inline void APIENTRY counted_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data)
+    {
+        Table<>::counts[ENTRY_glCompressedTexImage1D]++;
+        ((PFNGLCOMPRESSEDTEXIMAGE1DPROC)Table<>::loaded[ENTRY_glCompressedTexImage1D])(target, level, internalformat, width, border, imageSize, data);
+    }
+    inline void APIENTRY counted_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+    {
+        Table<>::counts[ENTRY_glCompressedTexSubImage3D]++;
+        ((PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)Table<>::loaded[ENTRY_glCompressedTexSubImage3D])(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    }
+    inline void APIENTRY counted_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+    {
+        Table<>::counts[ENTRY_glCompressedTexSubImage2D]++;
+        ((PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)Table<>::loaded[ENTRY_glCompressedTexSubImage2D])(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+    }
+    inline void APIENTRY counted_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+    {
+        Table<>::counts[ENTRY_glCompressedTexSubImage1D]++;
+        ((PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)Table<>::loaded[ENTRY_glCompressedTexSubImage1D])(target, level, xoffset, width, format, imageSize, data);
+    }
+    inline void APIENTRY counted_glGetCompressedTexImage(GLenum target, GLint level, void *img)
+    {
+        Table<>::counts[ENTRY_glGetCompressedTexImage]++;
+        ((PFNGLGETCOMPRESSEDTEXIMAGEPROC)Table<>::loaded[ENTRY_glGetCompressedTexImage])(target, level, img);
+    }
+    inline void APIENTRY counted_glClientActiveTexture(GLenum texture)
+    {
+        Table<>::counts[ENTRY_glClientActiveTexture]++;
+        ((PFNGLCLIENTACTIVETEXTUREPROC)Table<>::loaded[ENTRY_glClientActiveTexture])(texture);
+    }
+    inline void APIENTRY counted_glMultiTexCoord1d(GLenum target, GLdouble s)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord1d]++;
+        ((PFNGLMULTITEXCOORD1DPROC)Table<>::loaded[ENTRY_glMultiTexCoord1d])(target, s);
+    }
+    inline void APIENTRY counted_glMultiTexCoord1dv(GLenum target, const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord1dv]++;
+        ((PFNGLMULTITEXCOORD1DVPROC)Table<>::loaded[ENTRY_glMultiTexCoord1dv])(target, v);
+    }
+    inline void APIENTRY counted_glMultiTexCoord1f(GLenum target, GLfloat s)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord1f]++;
+        ((PFNGLMULTITEXCOORD1FPROC)Table<>::loaded[ENTRY_glMultiTexCoord1f])(target, s);
+    }
+    inline void APIENTRY counted_glMultiTexCoord1fv(GLenum target, const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord1fv]++;
+        ((PFNGLMULTITEXCOORD1FVPROC)Table<>::loaded[ENTRY_glMultiTexCoord1fv])(target, v);
+    }
+    inline void APIENTRY counted_glMultiTexCoord1i(GLenum target, GLint s)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord1i]++;
+        ((PFNGLMULTITEXCOORD1IPROC)Table<>::loaded[ENTRY_glMultiTexCoord1i])(target, s);
+    }
+    inline void APIENTRY counted_glMultiTexCoord1iv(GLenum target, const GLint *v)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord1iv]++;
+        ((PFNGLMULTITEXCOORD1IVPROC)Table<>::loaded[ENTRY_glMultiTexCoord1iv])(target, v);
+    }
+    inline void APIENTRY counted_glMultiTexCoord1s(GLenum target, GLshort s)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord1s]++;
+        ((PFNGLMULTITEXCOORD1SPROC)Table<>::loaded[ENTRY_glMultiTexCoord1s])(target, s);
+    }
+    inline void APIENTRY counted_glMultiTexCoord1sv(GLenum target, const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord1sv]++;
+        ((PFNGLMULTITEXCOORD1SVPROC)Table<>::loaded[ENTRY_glMultiTexCoord1sv])(target, v);
+    }
+    inline void APIENTRY counted_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord2d]++;
+        ((PFNGLMULTITEXCOORD2DPROC)Table<>::loaded[ENTRY_glMultiTexCoord2d])(target, s, t);
+    }
+    inline void APIENTRY counted_glMultiTexCoord2dv(GLenum target, const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord2dv]++;
+        ((PFNGLMULTITEXCOORD2DVPROC)Table<>::loaded[ENTRY_glMultiTexCoord2dv])(target, v);
+    }
+    inline void APIENTRY counted_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord2f]++;
+        ((PFNGLMULTITEXCOORD2FPROC)Table<>::loaded[ENTRY_glMultiTexCoord2f])(target, s, t);
+    }
+    inline void APIENTRY counted_glMultiTexCoord2fv(GLenum target, const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord2fv]++;
+        ((PFNGLMULTITEXCOORD2FVPROC)Table<>::loaded[ENTRY_glMultiTexCoord2fv])(target, v);
+    }
+    inline void APIENTRY counted_glMultiTexCoord2i(GLenum target, GLint s, GLint t)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord2i]++;
+        ((PFNGLMULTITEXCOORD2IPROC)Table<>::loaded[ENTRY_glMultiTexCoord2i])(target, s, t);
+    }
+    inline void APIENTRY counted_glMultiTexCoord2iv(GLenum target, const GLint *v)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord2iv]++;
+        ((PFNGLMULTITEXCOORD2IVPROC)Table<>::loaded[ENTRY_glMultiTexCoord2iv])(target, v);
+    }
+    inline void APIENTRY counted_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord2s]++;
+        ((PFNGLMULTITEXCOORD2SPROC)Table<>::loaded[ENTRY_glMultiTexCoord2s])(target, s, t);
+    }
+    inline void APIENTRY counted_glMultiTexCoord2sv(GLenum target, const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord2sv]++;
+        ((PFNGLMULTITEXCOORD2SVPROC)Table<>::loaded[ENTRY_glMultiTexCoord2sv])(target, v);
+    }
+    inline void APIENTRY counted_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord3d]++;
+        ((PFNGLMULTITEXCOORD3DPROC)Table<>::loaded[ENTRY_glMultiTexCoord3d])(target, s, t, r);
+    }
+    inline void APIENTRY counted_glMultiTexCoord3dv(GLenum target, const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord3dv]++;
+        ((PFNGLMULTITEXCOORD3DVPROC)Table<>::loaded[ENTRY_glMultiTexCoord3dv])(target, v);
+    }
+    inline void APIENTRY counted_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord3f]++;
+        ((PFNGLMULTITEXCOORD3FPROC)Table<>::loaded[ENTRY_glMultiTexCoord3f])(target, s, t, r);
+    }
+    inline void APIENTRY counted_glMultiTexCoord3fv(GLenum target, const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord3fv]++;
+        ((PFNGLMULTITEXCOORD3FVPROC)Table<>::loaded[ENTRY_glMultiTexCoord3fv])(target, v);
+    }
+    inline void APIENTRY counted_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord3i]++;
+        ((PFNGLMULTITEXCOORD3IPROC)Table<>::loaded[ENTRY_glMultiTexCoord3i])(target, s, t, r);
+    }
+    inline void APIENTRY counted_glMultiTexCoord3iv(GLenum target, const GLint *v)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord3iv]++;
+        ((PFNGLMULTITEXCOORD3IVPROC)Table<>::loaded[ENTRY_glMultiTexCoord3iv])(target, v);
+    }
+    inline void APIENTRY counted_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord3s]++;
+        ((PFNGLMULTITEXCOORD3SPROC)Table<>::loaded[ENTRY_glMultiTexCoord3s])(target, s, t, r);
+    }
+    inline void APIENTRY counted_glMultiTexCoord3sv(GLenum target, const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord3sv]++;
+        ((PFNGLMULTITEXCOORD3SVPROC)Table<>::loaded[ENTRY_glMultiTexCoord3sv])(target, v);
+    }
+    inline void APIENTRY counted_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord4d]++;
+        ((PFNGLMULTITEXCOORD4DPROC)Table<>::loaded[ENTRY_glMultiTexCoord4d])(target, s, t, r, q);
+    }
+    inline void APIENTRY counted_glMultiTexCoord4dv(GLenum target, const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord4dv]++;
+        ((PFNGLMULTITEXCOORD4DVPROC)Table<>::loaded[ENTRY_glMultiTexCoord4dv])(target, v);
+    }
+    inline void APIENTRY counted_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord4f]++;
+        ((PFNGLMULTITEXCOORD4FPROC)Table<>::loaded[ENTRY_glMultiTexCoord4f])(target, s, t, r, q);
+    }
+    inline void APIENTRY counted_glMultiTexCoord4fv(GLenum target, const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord4fv]++;
+        ((PFNGLMULTITEXCOORD4FVPROC)Table<>::loaded[ENTRY_glMultiTexCoord4fv])(target, v);
+    }
+    inline void APIENTRY counted_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord4i]++;
+        ((PFNGLMULTITEXCOORD4IPROC)Table<>::loaded[ENTRY_glMultiTexCoord4i])(target, s, t, r, q);
+    }
+    inline void APIENTRY counted_glMultiTexCoord4iv(GLenum target, const GLint *v)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord4iv]++;
+        ((PFNGLMULTITEXCOORD4IVPROC)Table<>::loaded[ENTRY_glMultiTexCoord4iv])(target, v);
+    }
+    inline void APIENTRY counted_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord4s]++;
+        ((PFNGLMULTITEXCOORD4SPROC)Table<>::loaded[ENTRY_glMultiTexCoord4s])(target, s, t, r, q);
+    }
+    inline void APIENTRY counted_glMultiTexCoord4sv(GLenum target, const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoord4sv]++;
+        ((PFNGLMULTITEXCOORD4SVPROC)Table<>::loaded[ENTRY_glMultiTexCoord4sv])(target, v);
+    }
+    inline void APIENTRY counted_glLoadTransposeMatrixf(const GLfloat *m)
+    {
+        Table<>::counts[ENTRY_glLoadTransposeMatrixf]++;
+        ((PFNGLLOADTRANSPOSEMATRIXFPROC)Table<>::loaded[ENTRY_glLoadTransposeMatrixf])(m);
+    }
+    inline void APIENTRY counted_glLoadTransposeMatrixd(const GLdouble *m)
+    {
+        Table<>::counts[ENTRY_glLoadTransposeMatrixd]++;
+        ((PFNGLLOADTRANSPOSEMATRIXDPROC)Table<>::loaded[ENTRY_glLoadTransposeMatrixd])(m);
+    }
+    inline void APIENTRY counted_glMultTransposeMatrixf(const GLfloat *m)
+    {
+        Table<>::counts[ENTRY_glMultTransposeMatrixf]++;
+        ((PFNGLMULTTRANSPOSEMATRIXFPROC)Table<>::loaded[ENTRY_glMultTransposeMatrixf])(m);
+    }
+    inline void APIENTRY counted_glMultTransposeMatrixd(const GLdouble *m)
+    {
+        Table<>::counts[ENTRY_glMultTransposeMatrixd]++;
+        ((PFNGLMULTTRANSPOSEMATRIXDPROC)Table<>::loaded[ENTRY_glMultTransposeMatrixd])(m);
+    }
+    inline void APIENTRY counted_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+    {
+        Table<>::counts[ENTRY_glBlendFuncSeparate]++;
+        ((PFNGLBLENDFUNCSEPARATEPROC)Table<>::loaded[ENTRY_glBlendFuncSeparate])(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+    }
+    inline void APIENTRY counted_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount)
+    {
+        Table<>::counts[ENTRY_glMultiDrawArrays]++;
+        ((PFNGLMULTIDRAWARRAYSPROC)Table<>::loaded[ENTRY_glMultiDrawArrays])(mode, first, count, drawcount);
+    }
+    inline void APIENTRY counted_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount)
+    {
+        Table<>::counts[ENTRY_glMultiDrawElements]++;
+        ((PFNGLMULTIDRAWELEMENTSPROC)Table<>::loaded[ENTRY_glMultiDrawElements])(mode, count, type, indices, drawcount);
+    }
+    inline void APIENTRY counted_glPointParameterf(GLenum pname, GLfloat param)
+    {
+        Table<>::counts[ENTRY_glPointParameterf]++;
+        ((PFNGLPOINTPARAMETERFPROC)Table<>::loaded[ENTRY_glPointParameterf])(pname, param);
+    }
+    inline void APIENTRY counted_glPointParameterfv(GLenum pname, const GLfloat *params)
+    {
+        Table<>::counts[ENTRY_glPointParameterfv]++;
+        ((PFNGLPOINTPARAMETERFVPROC)Table<>::loaded[ENTRY_glPointParameterfv])(pname, params);
+    }
+    inline void APIENTRY counted_glPointParameteri(GLenum pname, GLint param)
+    {
+        Table<>::counts[ENTRY_glPointParameteri]++;
+        ((PFNGLPOINTPARAMETERIPROC)Table<>::loaded[ENTRY_glPointParameteri])(pname, param);
+    }
+    inline void APIENTRY counted_glPointParameteriv(GLenum pname, const GLint *params)
+    {
+        Table<>::counts[ENTRY_glPointParameteriv]++;
+        ((PFNGLPOINTPARAMETERIVPROC)Table<>::loaded[ENTRY_glPointParameteriv])(pname, params);
+    }
+    inline void APIENTRY counted_glFogCoordf(GLfloat coord)
+    {
+        Table<>::counts[ENTRY_glFogCoordf]++;
+        ((PFNGLFOGCOORDFPROC)Table<>::loaded[ENTRY_glFogCoordf])(coord);
+    }
+    inline void APIENTRY counted_glFogCoordfv(const GLfloat *coord)
+    {
+        Table<>::counts[ENTRY_glFogCoordfv]++;
+        ((PFNGLFOGCOORDFVPROC)Table<>::loaded[ENTRY_glFogCoordfv])(coord);
+    }
+    inline void APIENTRY counted_glFogCoordd(GLdouble coord)
+    {
+        Table<>::counts[ENTRY_glFogCoordd]++;
+        ((PFNGLFOGCOORDDPROC)Table<>::loaded[ENTRY_glFogCoordd])(coord);
+    }
+    inline void APIENTRY counted_glFogCoorddv(const GLdouble *coord)
+    {
+        Table<>::counts[ENTRY_glFogCoorddv]++;
+        ((PFNGLFOGCOORDDVPROC)Table<>::loaded[ENTRY_glFogCoorddv])(coord);
+    }
+    inline void APIENTRY counted_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer)
+    {
+        Table<>::counts[ENTRY_glFogCoordPointer]++;
+        ((PFNGLFOGCOORDPOINTERPROC)Table<>::loaded[ENTRY_glFogCoordPointer])(type, stride, pointer);
+    }
+    inline void APIENTRY counted_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue)
+    {
+        Table<>::counts[ENTRY_glSecondaryColor3b]++;
+        ((PFNGLSECONDARYCOLOR3BPROC)Table<>::loaded[ENTRY_glSecondaryColor3b])(red, green, blue);
+    }
+    inline void APIENTRY counted_glSecondaryColor3bv(const GLbyte *v)
+    {
+        Table<>::counts[ENTRY_glSecondaryColor3bv]++;
+        ((PFNGLSECONDARYCOLOR3BVPROC)Table<>::loaded[ENTRY_glSecondaryColor3bv])(v);
+    }
+    inline void APIENTRY counted_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue)
+    {
+        Table<>::counts[ENTRY_glSecondaryColor3d]++;
+        ((PFNGLSECONDARYCOLOR3DPROC)Table<>::loaded[ENTRY_glSecondaryColor3d])(red, green, blue);
+    }
+    inline void APIENTRY counted_glSecondaryColor3dv(const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glSecondaryColor3dv]++;
+        ((PFNGLSECONDARYCOLOR3DVPROC)Table<>::loaded[ENTRY_glSecondaryColor3dv])(v);
+    }
+    inline void APIENTRY counted_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue)
+    {
+        Table<>::counts[ENTRY_glSecondaryColor3f]++;
+        ((PFNGLSECONDARYCOLOR3FPROC)Table<>::loaded[ENTRY_glSecondaryColor3f])(red, green, blue);
+    }
+    inline void APIENTRY counted_glSecondaryColor3fv(const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glSecondaryColor3fv]++;
+        ((PFNGLSECONDARYCOLOR3FVPROC)Table<>::loaded[ENTRY_glSecondaryColor3fv])(v);
+    }
+    inline void APIENTRY counted_glSecondaryColor3i(GLint red, GLint green, GLint blue)
+    {
+        Table<>::counts[ENTRY_glSecondaryColor3i]++;
+        ((PFNGLSECONDARYCOLOR3IPROC)Table<>::loaded[ENTRY_glSecondaryColor3i])(red, green, blue);
+    }
+    inline void APIENTRY counted_glSecondaryColor3iv(const GLint *v)
+    {
+        Table<>::counts[ENTRY_glSecondaryColor3iv]++;
+        ((PFNGLSECONDARYCOLOR3IVPROC)Table<>::loaded[ENTRY_glSecondaryColor3iv])(v);
+    }
+    inline void APIENTRY counted_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue)
+    {
+        Table<>::counts[ENTRY_glSecondaryColor3s]++;
+        ((PFNGLSECONDARYCOLOR3SPROC)Table<>::loaded[ENTRY_glSecondaryColor3s])(red, green, blue);
+    }
+    inline void APIENTRY counted_glSecondaryColor3sv(const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glSecondaryColor3sv]++;
+        ((PFNGLSECONDARYCOLOR3SVPROC)Table<>::loaded[ENTRY_glSecondaryColor3sv])(v);
+    }
+    inline void APIENTRY counted_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue)
+    {
+        Table<>::counts[ENTRY_glSecondaryColor3ub]++;
+        ((PFNGLSECONDARYCOLOR3UBPROC)Table<>::loaded[ENTRY_glSecondaryColor3ub])(red, green, blue);
+    }
+    inline void APIENTRY counted_glSecondaryColor3ubv(const GLubyte *v)
+    {
+        Table<>::counts[ENTRY_glSecondaryColor3ubv]++;
+        ((PFNGLSECONDARYCOLOR3UBVPROC)Table<>::loaded[ENTRY_glSecondaryColor3ubv])(v);
+    }
+    inline void APIENTRY counted_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue)
+    {
+        Table<>::counts[ENTRY_glSecondaryColor3ui]++;
+        ((PFNGLSECONDARYCOLOR3UIPROC)Table<>::loaded[ENTRY_glSecondaryColor3ui])(red, green, blue);
+    }
+    inline void APIENTRY counted_glSecondaryColor3uiv(const GLuint *v)
+    {
+        Table<>::counts[ENTRY_glSecondaryColor3uiv]++;
+        ((PFNGLSECONDARYCOLOR3UIVPROC)Table<>::loaded[ENTRY_glSecondaryColor3uiv])(v);
+    }
+    inline void APIENTRY counted_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue)
+    {
+        Table<>::counts[ENTRY_glSecondaryColor3us]++;
+        ((PFNGLSECONDARYCOLOR3USPROC)Table<>::loaded[ENTRY_glSecondaryColor3us])(red, green, blue);
+    }
+    inline void APIENTRY counted_glSecondaryColor3usv(const GLushort *v)
+    {
+        Table<>::counts[ENTRY_glSecondaryColor3usv]++;
+        ((PFNGLSECONDARYCOLOR3USVPROC)Table<>::loaded[ENTRY_glSecondaryColor3usv])(v);
+    }
+    inline void APIENTRY counted_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer)
+    {
+        Table<>::counts[ENTRY_glSecondaryColorPointer]++;
+        ((PFNGLSECONDARYCOLORPOINTERPROC)Table<>::loaded[ENTRY_glSecondaryColorPointer])(size, type, stride, pointer);
+    }
+    inline void APIENTRY counted_glWindowPos2d(GLdouble x, GLdouble y)
+    {
+        Table<>::counts[ENTRY_glWindowPos2d]++;
+        ((PFNGLWINDOWPOS2DPROC)Table<>::loaded[ENTRY_glWindowPos2d])(x, y);
+    }
+    inline void APIENTRY counted_glWindowPos2dv(const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glWindowPos2dv]++;
+        ((PFNGLWINDOWPOS2DVPROC)Table<>::loaded[ENTRY_glWindowPos2dv])(v);
+    }
+    inline void APIENTRY counted_glWindowPos2f(GLfloat x, GLfloat y)
+    {
+        Table<>::counts[ENTRY_glWindowPos2f]++;
+        ((PFNGLWINDOWPOS2FPROC)Table<>::loaded[ENTRY_glWindowPos2f])(x, y);
+    }
+    inline void APIENTRY counted_glWindowPos2fv(const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glWindowPos2fv]++;
+        ((PFNGLWINDOWPOS2FVPROC)Table<>::loaded[ENTRY_glWindowPos2fv])(v);
+    }
+    inline void APIENTRY counted_glWindowPos2i(GLint x, GLint y)
+    {
+        Table<>::counts[ENTRY_glWindowPos2i]++;
+        ((PFNGLWINDOWPOS2IPROC)Table<>::loaded[ENTRY_glWindowPos2i])(x, y);
+    }
+    inline void APIENTRY counted_glWindowPos2iv(const GLint *v)
+    {
+        Table<>::counts[ENTRY_glWindowPos2iv]++;
+        ((PFNGLWINDOWPOS2IVPROC)Table<>::loaded[ENTRY_glWindowPos2iv])(v);
+    }
+    inline void APIENTRY counted_glWindowPos2s(GLshort x, GLshort y)
+    {
+        Table<>::counts[ENTRY_glWindowPos2s]++;
+        ((PFNGLWINDOWPOS2SPROC)Table<>::loaded[ENTRY_glWindowPos2s])(x, y);
+    }
+    inline void APIENTRY counted_glWindowPos2sv(const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glWindowPos2sv]++;
+        ((PFNGLWINDOWPOS2SVPROC)Table<>::loaded[ENTRY_glWindowPos2sv])(v);
+    }
+    inline void APIENTRY counted_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z)
+    {
+        Table<>::counts[ENTRY_glWindowPos3d]++;
+        ((PFNGLWINDOWPOS3DPROC)Table<>::loaded[ENTRY_glWindowPos3d])(x, y, z);
+    }
+    inline void APIENTRY counted_glWindowPos3dv(const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glWindowPos3dv]++;
+        ((PFNGLWINDOWPOS3DVPROC)Table<>::loaded[ENTRY_glWindowPos3dv])(v);
+    }
+    inline void APIENTRY counted_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z)
+    {
+        Table<>::counts[ENTRY_glWindowPos3f]++;
+        ((PFNGLWINDOWPOS3FPROC)Table<>::loaded[ENTRY_glWindowPos3f])(x, y, z);
+    }
+    inline void APIENTRY counted_glWindowPos3fv(const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glWindowPos3fv]++;
+        ((PFNGLWINDOWPOS3FVPROC)Table<>::loaded[ENTRY_glWindowPos3fv])(v);
+    }
+    inline void APIENTRY counted_glWindowPos3i(GLint x, GLint y, GLint z)
+    {
+        Table<>::counts[ENTRY_glWindowPos3i]++;
+        ((PFNGLWINDOWPOS3IPROC)Table<>::loaded[ENTRY_glWindowPos3i])(x, y, z);
+    }
+    inline void APIENTRY counted_glWindowPos3iv(const GLint *v)
+    {
+        Table<>::counts[ENTRY_glWindowPos3iv]++;
+        ((PFNGLWINDOWPOS3IVPROC)Table<>::loaded[ENTRY_glWindowPos3iv])(v);
+    }
+    inline void APIENTRY counted_glWindowPos3s(GLshort x, GLshort y, GLshort z)
+    {
+        Table<>::counts[ENTRY_glWindowPos3s]++;
+        ((PFNGLWINDOWPOS3SPROC)Table<>::loaded[ENTRY_glWindowPos3s])(x, y, z);
+    }
+    inline void APIENTRY counted_glWindowPos3sv(const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glWindowPos3sv]++;
+        ((PFNGLWINDOWPOS3SVPROC)Table<>::loaded[ENTRY_glWindowPos3sv])(v);
+    }
+    inline void APIENTRY counted_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+    {
+        Table<>::counts[ENTRY_glBlendColor]++;
+        ((PFNGLBLENDCOLORPROC)Table<>::loaded[ENTRY_glBlendColor])(red, green, blue, alpha);
+    }
+    inline void APIENTRY counted_glBlendEquation(GLenum mode)
+    {
+        Table<>::counts[ENTRY_glBlendEquation]++;
+        ((PFNGLBLENDEQUATIONPROC)Table<>::loaded[ENTRY_glBlendEquation])(mode);
+    }
+    inline void APIENTRY counted_glGenQueries(GLsizei n, GLuint *ids)
+    {
+        Table<>::counts[ENTRY_glGenQueries]++;
+        ((PFNGLGENQUERIESPROC)Table<>::loaded[ENTRY_glGenQueries])(n, ids);
+    }
+    inline void APIENTRY counted_glDeleteQueries(GLsizei n, const GLuint *ids)
+    {
+        Table<>::counts[ENTRY_glDeleteQueries]++;
+        ((PFNGLDELETEQUERIESPROC)Table<>::loaded[ENTRY_glDeleteQueries])(n, ids);
+    }
+    inline GLboolean APIENTRY counted_glIsQuery(GLuint id)
+    {
+        Table<>::counts[ENTRY_glIsQuery]++;
+        return ((PFNGLISQUERYPROC)Table<>::loaded[ENTRY_glIsQuery])(id);
+    }
+    inline void APIENTRY counted_glBeginQuery(GLenum target, GLuint id)
+    {
+        Table<>::counts[ENTRY_glBeginQuery]++;
+        ((PFNGLBEGINQUERYPROC)Table<>::loaded[ENTRY_glBeginQuery])(target, id);
+    }
+    inline void APIENTRY counted_glEndQuery(GLenum target)
+    {
+        Table<>::counts[ENTRY_glEndQuery]++;
+        ((PFNGLENDQUERYPROC)Table<>::loaded[ENTRY_glEndQuery])(target);
+    }
+    inline void APIENTRY counted_glGetQueryiv(GLenum target, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetQueryiv]++;
+        ((PFNGLGETQUERYIVPROC)Table<>::loaded[ENTRY_glGetQueryiv])(target, pname, params);
+    }
+    inline void APIENTRY counted_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetQueryObjectiv]++;
+        ((PFNGLGETQUERYOBJECTIVPROC)Table<>::loaded[ENTRY_glGetQueryObjectiv])(id, pname, params);
+    }
+    inline void APIENTRY counted_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
+    {
+        Table<>::counts[ENTRY_glGetQueryObjectuiv]++;
+        ((PFNGLGETQUERYOBJECTUIVPROC)Table<>::loaded[ENTRY_glGetQueryObjectuiv])(id, pname, params);
+    }
+    inline void APIENTRY counted_glBindBuffer(GLenum target, GLuint buffer)
+    {
+        Table<>::counts[ENTRY_glBindBuffer]++;
+        ((PFNGLBINDBUFFERPROC)Table<>::loaded[ENTRY_glBindBuffer])(target, buffer);
+    }
+    inline void APIENTRY counted_glDeleteBuffers(GLsizei n, const GLuint *buffers)
+    {
+        Table<>::counts[ENTRY_glDeleteBuffers]++;
+        ((PFNGLDELETEBUFFERSPROC)Table<>::loaded[ENTRY_glDeleteBuffers])(n, buffers);
+    }
+    inline void APIENTRY counted_glGenBuffers(GLsizei n, GLuint *buffers)
+    {
+        Table<>::counts[ENTRY_glGenBuffers]++;
+        ((PFNGLGENBUFFERSPROC)Table<>::loaded[ENTRY_glGenBuffers])(n, buffers);
+    }
+    inline GLboolean APIENTRY counted_glIsBuffer(GLuint buffer)
+    {
+        Table<>::counts[ENTRY_glIsBuffer]++;
+        return ((PFNGLISBUFFERPROC)Table<>::loaded[ENTRY_glIsBuffer])(buffer);
+    }
+    inline void APIENTRY counted_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+    {
+        Table<>::counts[ENTRY_glBufferData]++;
+        ((PFNGLBUFFERDATAPROC)Table<>::loaded[ENTRY_glBufferData])(target, size, data, usage);
+    }
+    inline void APIENTRY counted_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+    {
+        Table<>::counts[ENTRY_glBufferSubData]++;
+        ((PFNGLBUFFERSUBDATAPROC)Table<>::loaded[ENTRY_glBufferSubData])(target, offset, size, data);
+    }
+    inline void APIENTRY counted_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data)
+    {
+        Table<>::counts[ENTRY_glGetBufferSubData]++;
+        ((PFNGLGETBUFFERSUBDATAPROC)Table<>::loaded[ENTRY_glGetBufferSubData])(target, offset, size, data);
+    }
+    inline void * APIENTRY counted_glMapBuffer(GLenum target, GLenum access)
+    {
+        Table<>::counts[ENTRY_glMapBuffer]++;
+        return ((PFNGLMAPBUFFERPROC)Table<>::loaded[ENTRY_glMapBuffer])(target, access);
+    }
+    inline GLboolean APIENTRY counted_glUnmapBuffer(GLenum target)
+    {
+        Table<>::counts[ENTRY_glUnmapBuffer]++;
+        return ((PFNGLUNMAPBUFFERPROC)Table<>::loaded[ENTRY_glUnmapBuffer])(target);
+    }
+    inline void APIENTRY counted_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetBufferParameteriv]++;
+        ((PFNGLGETBUFFERPARAMETERIVPROC)Table<>::loaded[ENTRY_glGetBufferParameteriv])(target, pname, params);
+    }
+    inline void APIENTRY counted_glGetBufferPointerv(GLenum target, GLenum pname, void **params)
+    {
+        Table<>::counts[ENTRY_glGetBufferPointerv]++;
+        ((PFNGLGETBUFFERPOINTERVPROC)Table<>::loaded[ENTRY_glGetBufferPointerv])(target, pname, params);
+    }
+    inline void APIENTRY counted_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
+    {
+        Table<>::counts[ENTRY_glBlendEquationSeparate]++;
+        ((PFNGLBLENDEQUATIONSEPARATEPROC)Table<>::loaded[ENTRY_glBlendEquationSeparate])(modeRGB, modeAlpha);
+    }
+    inline void APIENTRY counted_glDrawBuffers(GLsizei n, const GLenum *bufs)
+    {
+        Table<>::counts[ENTRY_glDrawBuffers]++;
+        ((PFNGLDRAWBUFFERSPROC)Table<>::loaded[ENTRY_glDrawBuffers])(n, bufs);
+    }
+    inline void APIENTRY counted_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+    {
+        Table<>::counts[ENTRY_glStencilOpSeparate]++;
+        ((PFNGLSTENCILOPSEPARATEPROC)Table<>::loaded[ENTRY_glStencilOpSeparate])(face, sfail, dpfail, dppass);
+    }
+    inline void APIENTRY counted_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
+    {
+        Table<>::counts[ENTRY_glStencilFuncSeparate]++;
+        ((PFNGLSTENCILFUNCSEPARATEPROC)Table<>::loaded[ENTRY_glStencilFuncSeparate])(face, func, ref, mask);
+    }
+    inline void APIENTRY counted_glStencilMaskSeparate(GLenum face, GLuint mask)
+    {
+        Table<>::counts[ENTRY_glStencilMaskSeparate]++;
+        ((PFNGLSTENCILMASKSEPARATEPROC)Table<>::loaded[ENTRY_glStencilMaskSeparate])(face, mask);
+    }
+    inline void APIENTRY counted_glAttachShader(GLuint program, GLuint shader)
+    {
+        Table<>::counts[ENTRY_glAttachShader]++;
+        ((PFNGLATTACHSHADERPROC)Table<>::loaded[ENTRY_glAttachShader])(program, shader);
+    }
+    inline void APIENTRY counted_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name)
+    {
+        Table<>::counts[ENTRY_glBindAttribLocation]++;
+        ((PFNGLBINDATTRIBLOCATIONPROC)Table<>::loaded[ENTRY_glBindAttribLocation])(program, index, name);
+    }
+    inline void APIENTRY counted_glCompileShader(GLuint shader)
+    {
+        Table<>::counts[ENTRY_glCompileShader]++;
+        ((PFNGLCOMPILESHADERPROC)Table<>::loaded[ENTRY_glCompileShader])(shader);
+    }
+    inline GLuint APIENTRY counted_glCreateProgram(void)
+    {
+        Table<>::counts[ENTRY_glCreateProgram]++;
+        return ((PFNGLCREATEPROGRAMPROC)Table<>::loaded[ENTRY_glCreateProgram])();
+    }
+    inline GLuint APIENTRY counted_glCreateShader(GLenum type)
+    {
+        Table<>::counts[ENTRY_glCreateShader]++;
+        return ((PFNGLCREATESHADERPROC)Table<>::loaded[ENTRY_glCreateShader])(type);
+    }
+    inline void APIENTRY counted_glDeleteProgram(GLuint program)
+    {
+        Table<>::counts[ENTRY_glDeleteProgram]++;
+        ((PFNGLDELETEPROGRAMPROC)Table<>::loaded[ENTRY_glDeleteProgram])(program);
+    }
+    inline void APIENTRY counted_glDeleteShader(GLuint shader)
+    {
+        Table<>::counts[ENTRY_glDeleteShader]++;
+        ((PFNGLDELETESHADERPROC)Table<>::loaded[ENTRY_glDeleteShader])(shader);
+    }
+    inline void APIENTRY counted_glDetachShader(GLuint program, GLuint shader)
+    {
+        Table<>::counts[ENTRY_glDetachShader]++;
+        ((PFNGLDETACHSHADERPROC)Table<>::loaded[ENTRY_glDetachShader])(program, shader);
+    }
+    inline void APIENTRY counted_glDisableVertexAttribArray(GLuint index)
+    {
+        Table<>::counts[ENTRY_glDisableVertexAttribArray]++;
+        ((PFNGLDISABLEVERTEXATTRIBARRAYPROC)Table<>::loaded[ENTRY_glDisableVertexAttribArray])(index);
+    }
+    inline void APIENTRY counted_glEnableVertexAttribArray(GLuint index)
+    {
+        Table<>::counts[ENTRY_glEnableVertexAttribArray]++;
+        ((PFNGLENABLEVERTEXATTRIBARRAYPROC)Table<>::loaded[ENTRY_glEnableVertexAttribArray])(index);
+    }
+    inline void APIENTRY counted_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+    {
+        Table<>::counts[ENTRY_glGetActiveAttrib]++;
+        ((PFNGLGETACTIVEATTRIBPROC)Table<>::loaded[ENTRY_glGetActiveAttrib])(program, index, bufSize, length, size, type, name);
+    }
+    inline void APIENTRY counted_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
+    {
+        Table<>::counts[ENTRY_glGetActiveUniform]++;
+        ((PFNGLGETACTIVEUNIFORMPROC)Table<>::loaded[ENTRY_glGetActiveUniform])(program, index, bufSize, length, size, type, name);
+    }
+    inline void APIENTRY counted_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders)
+    {
+        Table<>::counts[ENTRY_glGetAttachedShaders]++;
+        ((PFNGLGETATTACHEDSHADERSPROC)Table<>::loaded[ENTRY_glGetAttachedShaders])(program, maxCount, count, shaders);
+    }
+    inline GLint APIENTRY counted_glGetAttribLocation(GLuint program, const GLchar *name)
+    {
+        Table<>::counts[ENTRY_glGetAttribLocation]++;
+        return ((PFNGLGETATTRIBLOCATIONPROC)Table<>::loaded[ENTRY_glGetAttribLocation])(program, name);
+    }
+    inline void APIENTRY counted_glGetProgramiv(GLuint program, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetProgramiv]++;
+        ((PFNGLGETPROGRAMIVPROC)Table<>::loaded[ENTRY_glGetProgramiv])(program, pname, params);
+    }
+    inline void APIENTRY counted_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+    {
+        Table<>::counts[ENTRY_glGetProgramInfoLog]++;
+        ((PFNGLGETPROGRAMINFOLOGPROC)Table<>::loaded[ENTRY_glGetProgramInfoLog])(program, bufSize, length, infoLog);
+    }
+    inline void APIENTRY counted_glGetShaderiv(GLuint shader, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetShaderiv]++;
+        ((PFNGLGETSHADERIVPROC)Table<>::loaded[ENTRY_glGetShaderiv])(shader, pname, params);
+    }
+    inline void APIENTRY counted_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+    {
+        Table<>::counts[ENTRY_glGetShaderInfoLog]++;
+        ((PFNGLGETSHADERINFOLOGPROC)Table<>::loaded[ENTRY_glGetShaderInfoLog])(shader, bufSize, length, infoLog);
+    }
+    inline void APIENTRY counted_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source)
+    {
+        Table<>::counts[ENTRY_glGetShaderSource]++;
+        ((PFNGLGETSHADERSOURCEPROC)Table<>::loaded[ENTRY_glGetShaderSource])(shader, bufSize, length, source);
+    }
+    inline GLint APIENTRY counted_glGetUniformLocation(GLuint program, const GLchar *name)
+    {
+        Table<>::counts[ENTRY_glGetUniformLocation]++;
+        return ((PFNGLGETUNIFORMLOCATIONPROC)Table<>::loaded[ENTRY_glGetUniformLocation])(program, name);
+    }
+    inline void APIENTRY counted_glGetUniformfv(GLuint program, GLint location, GLfloat *params)
+    {
+        Table<>::counts[ENTRY_glGetUniformfv]++;
+        ((PFNGLGETUNIFORMFVPROC)Table<>::loaded[ENTRY_glGetUniformfv])(program, location, params);
+    }
+    inline void APIENTRY counted_glGetUniformiv(GLuint program, GLint location, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetUniformiv]++;
+        ((PFNGLGETUNIFORMIVPROC)Table<>::loaded[ENTRY_glGetUniformiv])(program, location, params);
+    }
+    inline void APIENTRY counted_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params)
+    {
+        Table<>::counts[ENTRY_glGetVertexAttribdv]++;
+        ((PFNGLGETVERTEXATTRIBDVPROC)Table<>::loaded[ENTRY_glGetVertexAttribdv])(index, pname, params);
+    }
+    inline void APIENTRY counted_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params)
+    {
+        Table<>::counts[ENTRY_glGetVertexAttribfv]++;
+        ((PFNGLGETVERTEXATTRIBFVPROC)Table<>::loaded[ENTRY_glGetVertexAttribfv])(index, pname, params);
+    }
+    inline void APIENTRY counted_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetVertexAttribiv]++;
+        ((PFNGLGETVERTEXATTRIBIVPROC)Table<>::loaded[ENTRY_glGetVertexAttribiv])(index, pname, params);
+    }
+    inline void APIENTRY counted_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer)
+    {
+        Table<>::counts[ENTRY_glGetVertexAttribPointerv]++;
+        ((PFNGLGETVERTEXATTRIBPOINTERVPROC)Table<>::loaded[ENTRY_glGetVertexAttribPointerv])(index, pname, pointer);
+    }
+    inline GLboolean APIENTRY counted_glIsProgram(GLuint program)
+    {
+        Table<>::counts[ENTRY_glIsProgram]++;
+        return ((PFNGLISPROGRAMPROC)Table<>::loaded[ENTRY_glIsProgram])(program);
+    }
+    inline GLboolean APIENTRY counted_glIsShader(GLuint shader)
+    {
+        Table<>::counts[ENTRY_glIsShader]++;
+        return ((PFNGLISSHADERPROC)Table<>::loaded[ENTRY_glIsShader])(shader);
+    }
+    inline void APIENTRY counted_glLinkProgram(GLuint program)
+    {
+        Table<>::counts[ENTRY_glLinkProgram]++;
+        ((PFNGLLINKPROGRAMPROC)Table<>::loaded[ENTRY_glLinkProgram])(program);
+    }
+    inline void APIENTRY counted_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length)
+    {
+        Table<>::counts[ENTRY_glShaderSource]++;
+        ((PFNGLSHADERSOURCEPROC)Table<>::loaded[ENTRY_glShaderSource])(shader, count, string, length);
+    }
+    inline void APIENTRY counted_glUseProgram(GLuint program)
+    {
+        Table<>::counts[ENTRY_glUseProgram]++;
+        ((PFNGLUSEPROGRAMPROC)Table<>::loaded[ENTRY_glUseProgram])(program);
+    }
+    inline void APIENTRY counted_glUniform1f(GLint location, GLfloat v0)
+    {
+        Table<>::counts[ENTRY_glUniform1f]++;
+        ((PFNGLUNIFORM1FPROC)Table<>::loaded[ENTRY_glUniform1f])(location, v0);
+    }
+    inline void APIENTRY counted_glUniform2f(GLint location, GLfloat v0, GLfloat v1)
+    {
+        Table<>::counts[ENTRY_glUniform2f]++;
+        ((PFNGLUNIFORM2FPROC)Table<>::loaded[ENTRY_glUniform2f])(location, v0, v1);
+    }
+    inline void APIENTRY counted_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+    {
+        Table<>::counts[ENTRY_glUniform3f]++;
+        ((PFNGLUNIFORM3FPROC)Table<>::loaded[ENTRY_glUniform3f])(location, v0, v1, v2);
+    }
+    inline void APIENTRY counted_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+    {
+        Table<>::counts[ENTRY_glUniform4f]++;
+        ((PFNGLUNIFORM4FPROC)Table<>::loaded[ENTRY_glUniform4f])(location, v0, v1, v2, v3);
+    }
+    inline void APIENTRY counted_glUniform1i(GLint location, GLint v0)
+    {
+        Table<>::counts[ENTRY_glUniform1i]++;
+        ((PFNGLUNIFORM1IPROC)Table<>::loaded[ENTRY_glUniform1i])(location, v0);
+    }
+    inline void APIENTRY counted_glUniform2i(GLint location, GLint v0, GLint v1)
+    {
+        Table<>::counts[ENTRY_glUniform2i]++;
+        ((PFNGLUNIFORM2IPROC)Table<>::loaded[ENTRY_glUniform2i])(location, v0, v1);
+    }
+    inline void APIENTRY counted_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2)
+    {
+        Table<>::counts[ENTRY_glUniform3i]++;
+        ((PFNGLUNIFORM3IPROC)Table<>::loaded[ENTRY_glUniform3i])(location, v0, v1, v2);
+    }
+    inline void APIENTRY counted_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+    {
+        Table<>::counts[ENTRY_glUniform4i]++;
+        ((PFNGLUNIFORM4IPROC)Table<>::loaded[ENTRY_glUniform4i])(location, v0, v1, v2, v3);
+    }
+    inline void APIENTRY counted_glUniform1fv(GLint location, GLsizei count, const GLfloat *value)
+    {
+        Table<>::counts[ENTRY_glUniform1fv]++;
+        ((PFNGLUNIFORM1FVPROC)Table<>::loaded[ENTRY_glUniform1fv])(location, count, value);
+    }
+    inline void APIENTRY counted_glUniform2fv(GLint location, GLsizei count, const GLfloat *value)
+    {
+        Table<>::counts[ENTRY_glUniform2fv]++;
+        ((PFNGLUNIFORM2FVPROC)Table<>::loaded[ENTRY_glUniform2fv])(location, count, value);
+    }
+    inline void APIENTRY counted_glUniform3fv(GLint location, GLsizei count, const GLfloat *value)
+    {
+        Table<>::counts[ENTRY_glUniform3fv]++;
+        ((PFNGLUNIFORM3FVPROC)Table<>::loaded[ENTRY_glUniform3fv])(location, count, value);
+    }
+    inline void APIENTRY counted_glUniform4fv(GLint location, GLsizei count, const GLfloat *value)
+    {
+        Table<>::counts[ENTRY_glUniform4fv]++;
+        ((PFNGLUNIFORM4FVPROC)Table<>::loaded[ENTRY_glUniform4fv])(location, count, value);
+    }
+    inline void APIENTRY counted_glUniform1iv(GLint location, GLsizei count, const GLint *value)
+    {
+        Table<>::counts[ENTRY_glUniform1iv]++;
+        ((PFNGLUNIFORM1IVPROC)Table<>::loaded[ENTRY_glUniform1iv])(location, count, value);
+    }
+    inline void APIENTRY counted_glUniform2iv(GLint location, GLsizei count, const GLint *value)
+    {
+        Table<>::counts[ENTRY_glUniform2iv]++;
+        ((PFNGLUNIFORM2IVPROC)Table<>::loaded[ENTRY_glUniform2iv])(location, count, value);
+    }
+    inline void APIENTRY counted_glUniform3iv(GLint location, GLsizei count, const GLint *value)
+    {
+        Table<>::counts[ENTRY_glUniform3iv]++;
+        ((PFNGLUNIFORM3IVPROC)Table<>::loaded[ENTRY_glUniform3iv])(location, count, value);
+    }
+    inline void APIENTRY counted_glUniform4iv(GLint location, GLsizei count, const GLint *value)
+    {
+        Table<>::counts[ENTRY_glUniform4iv]++;
+        ((PFNGLUNIFORM4IVPROC)Table<>::loaded[ENTRY_glUniform4iv])(location, count, value);
+    }
+    inline void APIENTRY counted_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        Table<>::counts[ENTRY_glUniformMatrix2fv]++;
+        ((PFNGLUNIFORMMATRIX2FVPROC)Table<>::loaded[ENTRY_glUniformMatrix2fv])(location, count, transpose, value);
+    }
+    inline void APIENTRY counted_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        Table<>::counts[ENTRY_glUniformMatrix3fv]++;
+        ((PFNGLUNIFORMMATRIX3FVPROC)Table<>::loaded[ENTRY_glUniformMatrix3fv])(location, count, transpose, value);
+    }
+    inline void APIENTRY counted_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        Table<>::counts[ENTRY_glUniformMatrix4fv]++;
+        ((PFNGLUNIFORMMATRIX4FVPROC)Table<>::loaded[ENTRY_glUniformMatrix4fv])(location, count, transpose, value);
+    }
+    inline void APIENTRY counted_glValidateProgram(GLuint program)
+    {
+        Table<>::counts[ENTRY_glValidateProgram]++;
+        ((PFNGLVALIDATEPROGRAMPROC)Table<>::loaded[ENTRY_glValidateProgram])(program);
+    }
+    inline void APIENTRY counted_glVertexAttrib1d(GLuint index, GLdouble x)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib1d]++;
+        ((PFNGLVERTEXATTRIB1DPROC)Table<>::loaded[ENTRY_glVertexAttrib1d])(index, x);
+    }
+    inline void APIENTRY counted_glVertexAttrib1dv(GLuint index, const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib1dv]++;
+        ((PFNGLVERTEXATTRIB1DVPROC)Table<>::loaded[ENTRY_glVertexAttrib1dv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib1f(GLuint index, GLfloat x)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib1f]++;
+        ((PFNGLVERTEXATTRIB1FPROC)Table<>::loaded[ENTRY_glVertexAttrib1f])(index, x);
+    }
+    inline void APIENTRY counted_glVertexAttrib1fv(GLuint index, const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib1fv]++;
+        ((PFNGLVERTEXATTRIB1FVPROC)Table<>::loaded[ENTRY_glVertexAttrib1fv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib1s(GLuint index, GLshort x)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib1s]++;
+        ((PFNGLVERTEXATTRIB1SPROC)Table<>::loaded[ENTRY_glVertexAttrib1s])(index, x);
+    }
+    inline void APIENTRY counted_glVertexAttrib1sv(GLuint index, const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib1sv]++;
+        ((PFNGLVERTEXATTRIB1SVPROC)Table<>::loaded[ENTRY_glVertexAttrib1sv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib2d]++;
+        ((PFNGLVERTEXATTRIB2DPROC)Table<>::loaded[ENTRY_glVertexAttrib2d])(index, x, y);
+    }
+    inline void APIENTRY counted_glVertexAttrib2dv(GLuint index, const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib2dv]++;
+        ((PFNGLVERTEXATTRIB2DVPROC)Table<>::loaded[ENTRY_glVertexAttrib2dv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib2f]++;
+        ((PFNGLVERTEXATTRIB2FPROC)Table<>::loaded[ENTRY_glVertexAttrib2f])(index, x, y);
+    }
+    inline void APIENTRY counted_glVertexAttrib2fv(GLuint index, const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib2fv]++;
+        ((PFNGLVERTEXATTRIB2FVPROC)Table<>::loaded[ENTRY_glVertexAttrib2fv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib2s(GLuint index, GLshort x, GLshort y)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib2s]++;
+        ((PFNGLVERTEXATTRIB2SPROC)Table<>::loaded[ENTRY_glVertexAttrib2s])(index, x, y);
+    }
+    inline void APIENTRY counted_glVertexAttrib2sv(GLuint index, const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib2sv]++;
+        ((PFNGLVERTEXATTRIB2SVPROC)Table<>::loaded[ENTRY_glVertexAttrib2sv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib3d]++;
+        ((PFNGLVERTEXATTRIB3DPROC)Table<>::loaded[ENTRY_glVertexAttrib3d])(index, x, y, z);
+    }
+    inline void APIENTRY counted_glVertexAttrib3dv(GLuint index, const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib3dv]++;
+        ((PFNGLVERTEXATTRIB3DVPROC)Table<>::loaded[ENTRY_glVertexAttrib3dv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib3f]++;
+        ((PFNGLVERTEXATTRIB3FPROC)Table<>::loaded[ENTRY_glVertexAttrib3f])(index, x, y, z);
+    }
+    inline void APIENTRY counted_glVertexAttrib3fv(GLuint index, const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib3fv]++;
+        ((PFNGLVERTEXATTRIB3FVPROC)Table<>::loaded[ENTRY_glVertexAttrib3fv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib3s]++;
+        ((PFNGLVERTEXATTRIB3SPROC)Table<>::loaded[ENTRY_glVertexAttrib3s])(index, x, y, z);
+    }
+    inline void APIENTRY counted_glVertexAttrib3sv(GLuint index, const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib3sv]++;
+        ((PFNGLVERTEXATTRIB3SVPROC)Table<>::loaded[ENTRY_glVertexAttrib3sv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib4Nbv(GLuint index, const GLbyte *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib4Nbv]++;
+        ((PFNGLVERTEXATTRIB4NBVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nbv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib4Niv(GLuint index, const GLint *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib4Niv]++;
+        ((PFNGLVERTEXATTRIB4NIVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Niv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib4Nsv(GLuint index, const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib4Nsv]++;
+        ((PFNGLVERTEXATTRIB4NSVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nsv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib4Nub]++;
+        ((PFNGLVERTEXATTRIB4NUBPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nub])(index, x, y, z, w);
+    }
+    inline void APIENTRY counted_glVertexAttrib4Nubv(GLuint index, const GLubyte *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib4Nubv]++;
+        ((PFNGLVERTEXATTRIB4NUBVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nubv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib4Nuiv(GLuint index, const GLuint *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib4Nuiv]++;
+        ((PFNGLVERTEXATTRIB4NUIVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nuiv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib4Nusv(GLuint index, const GLushort *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib4Nusv]++;
+        ((PFNGLVERTEXATTRIB4NUSVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nusv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib4bv(GLuint index, const GLbyte *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib4bv]++;
+        ((PFNGLVERTEXATTRIB4BVPROC)Table<>::loaded[ENTRY_glVertexAttrib4bv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib4d]++;
+        ((PFNGLVERTEXATTRIB4DPROC)Table<>::loaded[ENTRY_glVertexAttrib4d])(index, x, y, z, w);
+    }
+    inline void APIENTRY counted_glVertexAttrib4dv(GLuint index, const GLdouble *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib4dv]++;
+        ((PFNGLVERTEXATTRIB4DVPROC)Table<>::loaded[ENTRY_glVertexAttrib4dv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib4f]++;
+        ((PFNGLVERTEXATTRIB4FPROC)Table<>::loaded[ENTRY_glVertexAttrib4f])(index, x, y, z, w);
+    }
+    inline void APIENTRY counted_glVertexAttrib4fv(GLuint index, const GLfloat *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib4fv]++;
+        ((PFNGLVERTEXATTRIB4FVPROC)Table<>::loaded[ENTRY_glVertexAttrib4fv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib4iv(GLuint index, const GLint *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib4iv]++;
+        ((PFNGLVERTEXATTRIB4IVPROC)Table<>::loaded[ENTRY_glVertexAttrib4iv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib4s]++;
+        ((PFNGLVERTEXATTRIB4SPROC)Table<>::loaded[ENTRY_glVertexAttrib4s])(index, x, y, z, w);
+    }
+    inline void APIENTRY counted_glVertexAttrib4sv(GLuint index, const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib4sv]++;
+        ((PFNGLVERTEXATTRIB4SVPROC)Table<>::loaded[ENTRY_glVertexAttrib4sv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib4ubv(GLuint index, const GLubyte *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib4ubv]++;
+        ((PFNGLVERTEXATTRIB4UBVPROC)Table<>::loaded[ENTRY_glVertexAttrib4ubv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib4uiv(GLuint index, const GLuint *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib4uiv]++;
+        ((PFNGLVERTEXATTRIB4UIVPROC)Table<>::loaded[ENTRY_glVertexAttrib4uiv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttrib4usv(GLuint index, const GLushort *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttrib4usv]++;
+        ((PFNGLVERTEXATTRIB4USVPROC)Table<>::loaded[ENTRY_glVertexAttrib4usv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
+    {
+        Table<>::counts[ENTRY_glVertexAttribPointer]++;
+        ((PFNGLVERTEXATTRIBPOINTERPROC)Table<>::loaded[ENTRY_glVertexAttribPointer])(index, size, type, normalized, stride, pointer);
+    }
+    inline void APIENTRY counted_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        Table<>::counts[ENTRY_glUniformMatrix2x3fv]++;
+        ((PFNGLUNIFORMMATRIX2X3FVPROC)Table<>::loaded[ENTRY_glUniformMatrix2x3fv])(location, count, transpose, value);
+    }
+    inline void APIENTRY counted_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        Table<>::counts[ENTRY_glUniformMatrix3x2fv]++;
+        ((PFNGLUNIFORMMATRIX3X2FVPROC)Table<>::loaded[ENTRY_glUniformMatrix3x2fv])(location, count, transpose, value);
+    }
+    inline void APIENTRY counted_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        Table<>::counts[ENTRY_glUniformMatrix2x4fv]++;
+        ((PFNGLUNIFORMMATRIX2X4FVPROC)Table<>::loaded[ENTRY_glUniformMatrix2x4fv])(location, count, transpose, value);
+    }
+    inline void APIENTRY counted_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        Table<>::counts[ENTRY_glUniformMatrix4x2fv]++;
+        ((PFNGLUNIFORMMATRIX4X2FVPROC)Table<>::loaded[ENTRY_glUniformMatrix4x2fv])(location, count, transpose, value);
+    }
+    inline void APIENTRY counted_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        Table<>::counts[ENTRY_glUniformMatrix3x4fv]++;
+        ((PFNGLUNIFORMMATRIX3X4FVPROC)Table<>::loaded[ENTRY_glUniformMatrix3x4fv])(location, count, transpose, value);
+    }
+    inline void APIENTRY counted_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        Table<>::counts[ENTRY_glUniformMatrix4x3fv]++;
+        ((PFNGLUNIFORMMATRIX4X3FVPROC)Table<>::loaded[ENTRY_glUniformMatrix4x3fv])(location, count, transpose, value);
+    }
+    inline void APIENTRY counted_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+    {
+        Table<>::counts[ENTRY_glColorMaski]++;
+        ((PFNGLCOLORMASKIPROC)Table<>::loaded[ENTRY_glColorMaski])(index, r, g, b, a);
+    }
+    inline void APIENTRY counted_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data)
+    {
+        Table<>::counts[ENTRY_glGetBooleani_v]++;
+        ((PFNGLGETBOOLEANI_VPROC)Table<>::loaded[ENTRY_glGetBooleani_v])(target, index, data);
+    }
+    inline void APIENTRY counted_glGetIntegeri_v(GLenum target, GLuint index, GLint *data)
+    {
+        Table<>::counts[ENTRY_glGetIntegeri_v]++;
+        ((PFNGLGETINTEGERI_VPROC)Table<>::loaded[ENTRY_glGetIntegeri_v])(target, index, data);
+    }
+    inline void APIENTRY counted_glEnablei(GLenum target, GLuint index)
+    {
+        Table<>::counts[ENTRY_glEnablei]++;
+        ((PFNGLENABLEIPROC)Table<>::loaded[ENTRY_glEnablei])(target, index);
+    }
+    inline void APIENTRY counted_glDisablei(GLenum target, GLuint index)
+    {
+        Table<>::counts[ENTRY_glDisablei]++;
+        ((PFNGLDISABLEIPROC)Table<>::loaded[ENTRY_glDisablei])(target, index);
+    }
+    inline GLboolean APIENTRY counted_glIsEnabledi(GLenum target, GLuint index)
+    {
+        Table<>::counts[ENTRY_glIsEnabledi]++;
+        return ((PFNGLISENABLEDIPROC)Table<>::loaded[ENTRY_glIsEnabledi])(target, index);
+    }
+    inline void APIENTRY counted_glBeginTransformFeedback(GLenum primitiveMode)
+    {
+        Table<>::counts[ENTRY_glBeginTransformFeedback]++;
+        ((PFNGLBEGINTRANSFORMFEEDBACKPROC)Table<>::loaded[ENTRY_glBeginTransformFeedback])(primitiveMode);
+    }
+    inline void APIENTRY counted_glEndTransformFeedback(void)
+    {
+        Table<>::counts[ENTRY_glEndTransformFeedback]++;
+        ((PFNGLENDTRANSFORMFEEDBACKPROC)Table<>::loaded[ENTRY_glEndTransformFeedback])();
+    }
+    inline void APIENTRY counted_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+    {
+        Table<>::counts[ENTRY_glBindBufferRange]++;
+        ((PFNGLBINDBUFFERRANGEPROC)Table<>::loaded[ENTRY_glBindBufferRange])(target, index, buffer, offset, size);
+    }
+    inline void APIENTRY counted_glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+    {
+        Table<>::counts[ENTRY_glBindBufferBase]++;
+        ((PFNGLBINDBUFFERBASEPROC)Table<>::loaded[ENTRY_glBindBufferBase])(target, index, buffer);
+    }
+    inline void APIENTRY counted_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode)
+    {
+        Table<>::counts[ENTRY_glTransformFeedbackVaryings]++;
+        ((PFNGLTRANSFORMFEEDBACKVARYINGSPROC)Table<>::loaded[ENTRY_glTransformFeedbackVaryings])(program, count, varyings, bufferMode);
+    }
+    inline void APIENTRY counted_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name)
+    {
+        Table<>::counts[ENTRY_glGetTransformFeedbackVarying]++;
+        ((PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)Table<>::loaded[ENTRY_glGetTransformFeedbackVarying])(program, index, bufSize, length, size, type, name);
+    }
+    inline void APIENTRY counted_glClampColor(GLenum target, GLenum clamp)
+    {
+        Table<>::counts[ENTRY_glClampColor]++;
+        ((PFNGLCLAMPCOLORPROC)Table<>::loaded[ENTRY_glClampColor])(target, clamp);
+    }
+    inline void APIENTRY counted_glBeginConditionalRender(GLuint id, GLenum mode)
+    {
+        Table<>::counts[ENTRY_glBeginConditionalRender]++;
+        ((PFNGLBEGINCONDITIONALRENDERPROC)Table<>::loaded[ENTRY_glBeginConditionalRender])(id, mode);
+    }
+    inline void APIENTRY counted_glEndConditionalRender(void)
+    {
+        Table<>::counts[ENTRY_glEndConditionalRender]++;
+        ((PFNGLENDCONDITIONALRENDERPROC)Table<>::loaded[ENTRY_glEndConditionalRender])();
+    }
+    inline void APIENTRY counted_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+    {
+        Table<>::counts[ENTRY_glVertexAttribIPointer]++;
+        ((PFNGLVERTEXATTRIBIPOINTERPROC)Table<>::loaded[ENTRY_glVertexAttribIPointer])(index, size, type, stride, pointer);
+    }
+    inline void APIENTRY counted_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetVertexAttribIiv]++;
+        ((PFNGLGETVERTEXATTRIBIIVPROC)Table<>::loaded[ENTRY_glGetVertexAttribIiv])(index, pname, params);
+    }
+    inline void APIENTRY counted_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params)
+    {
+        Table<>::counts[ENTRY_glGetVertexAttribIuiv]++;
+        ((PFNGLGETVERTEXATTRIBIUIVPROC)Table<>::loaded[ENTRY_glGetVertexAttribIuiv])(index, pname, params);
+    }
+    inline void APIENTRY counted_glVertexAttribI1i(GLuint index, GLint x)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI1i]++;
+        ((PFNGLVERTEXATTRIBI1IPROC)Table<>::loaded[ENTRY_glVertexAttribI1i])(index, x);
+    }
+    inline void APIENTRY counted_glVertexAttribI2i(GLuint index, GLint x, GLint y)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI2i]++;
+        ((PFNGLVERTEXATTRIBI2IPROC)Table<>::loaded[ENTRY_glVertexAttribI2i])(index, x, y);
+    }
+    inline void APIENTRY counted_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI3i]++;
+        ((PFNGLVERTEXATTRIBI3IPROC)Table<>::loaded[ENTRY_glVertexAttribI3i])(index, x, y, z);
+    }
+    inline void APIENTRY counted_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI4i]++;
+        ((PFNGLVERTEXATTRIBI4IPROC)Table<>::loaded[ENTRY_glVertexAttribI4i])(index, x, y, z, w);
+    }
+    inline void APIENTRY counted_glVertexAttribI1ui(GLuint index, GLuint x)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI1ui]++;
+        ((PFNGLVERTEXATTRIBI1UIPROC)Table<>::loaded[ENTRY_glVertexAttribI1ui])(index, x);
+    }
+    inline void APIENTRY counted_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI2ui]++;
+        ((PFNGLVERTEXATTRIBI2UIPROC)Table<>::loaded[ENTRY_glVertexAttribI2ui])(index, x, y);
+    }
+    inline void APIENTRY counted_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI3ui]++;
+        ((PFNGLVERTEXATTRIBI3UIPROC)Table<>::loaded[ENTRY_glVertexAttribI3ui])(index, x, y, z);
+    }
+    inline void APIENTRY counted_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI4ui]++;
+        ((PFNGLVERTEXATTRIBI4UIPROC)Table<>::loaded[ENTRY_glVertexAttribI4ui])(index, x, y, z, w);
+    }
+    inline void APIENTRY counted_glVertexAttribI1iv(GLuint index, const GLint *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI1iv]++;
+        ((PFNGLVERTEXATTRIBI1IVPROC)Table<>::loaded[ENTRY_glVertexAttribI1iv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttribI2iv(GLuint index, const GLint *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI2iv]++;
+        ((PFNGLVERTEXATTRIBI2IVPROC)Table<>::loaded[ENTRY_glVertexAttribI2iv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttribI3iv(GLuint index, const GLint *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI3iv]++;
+        ((PFNGLVERTEXATTRIBI3IVPROC)Table<>::loaded[ENTRY_glVertexAttribI3iv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttribI4iv(GLuint index, const GLint *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI4iv]++;
+        ((PFNGLVERTEXATTRIBI4IVPROC)Table<>::loaded[ENTRY_glVertexAttribI4iv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttribI1uiv(GLuint index, const GLuint *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI1uiv]++;
+        ((PFNGLVERTEXATTRIBI1UIVPROC)Table<>::loaded[ENTRY_glVertexAttribI1uiv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttribI2uiv(GLuint index, const GLuint *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI2uiv]++;
+        ((PFNGLVERTEXATTRIBI2UIVPROC)Table<>::loaded[ENTRY_glVertexAttribI2uiv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttribI3uiv(GLuint index, const GLuint *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI3uiv]++;
+        ((PFNGLVERTEXATTRIBI3UIVPROC)Table<>::loaded[ENTRY_glVertexAttribI3uiv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttribI4uiv(GLuint index, const GLuint *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI4uiv]++;
+        ((PFNGLVERTEXATTRIBI4UIVPROC)Table<>::loaded[ENTRY_glVertexAttribI4uiv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttribI4bv(GLuint index, const GLbyte *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI4bv]++;
+        ((PFNGLVERTEXATTRIBI4BVPROC)Table<>::loaded[ENTRY_glVertexAttribI4bv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttribI4sv(GLuint index, const GLshort *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI4sv]++;
+        ((PFNGLVERTEXATTRIBI4SVPROC)Table<>::loaded[ENTRY_glVertexAttribI4sv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttribI4ubv(GLuint index, const GLubyte *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI4ubv]++;
+        ((PFNGLVERTEXATTRIBI4UBVPROC)Table<>::loaded[ENTRY_glVertexAttribI4ubv])(index, v);
+    }
+    inline void APIENTRY counted_glVertexAttribI4usv(GLuint index, const GLushort *v)
+    {
+        Table<>::counts[ENTRY_glVertexAttribI4usv]++;
+        ((PFNGLVERTEXATTRIBI4USVPROC)Table<>::loaded[ENTRY_glVertexAttribI4usv])(index, v);
+    }
+    inline void APIENTRY counted_glGetUniformuiv(GLuint program, GLint location, GLuint *params)
+    {
+        Table<>::counts[ENTRY_glGetUniformuiv]++;
+        ((PFNGLGETUNIFORMUIVPROC)Table<>::loaded[ENTRY_glGetUniformuiv])(program, location, params);
+    }
+    inline void APIENTRY counted_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name)
+    {
+        Table<>::counts[ENTRY_glBindFragDataLocation]++;
+        ((PFNGLBINDFRAGDATALOCATIONPROC)Table<>::loaded[ENTRY_glBindFragDataLocation])(program, color, name);
+    }
+    inline GLint APIENTRY counted_glGetFragDataLocation(GLuint program, const GLchar *name)
+    {
+        Table<>::counts[ENTRY_glGetFragDataLocation]++;
+        return ((PFNGLGETFRAGDATALOCATIONPROC)Table<>::loaded[ENTRY_glGetFragDataLocation])(program, name);
+    }
+    inline void APIENTRY counted_glUniform1ui(GLint location, GLuint v0)
+    {
+        Table<>::counts[ENTRY_glUniform1ui]++;
+        ((PFNGLUNIFORM1UIPROC)Table<>::loaded[ENTRY_glUniform1ui])(location, v0);
+    }
+    inline void APIENTRY counted_glUniform2ui(GLint location, GLuint v0, GLuint v1)
+    {
+        Table<>::counts[ENTRY_glUniform2ui]++;
+        ((PFNGLUNIFORM2UIPROC)Table<>::loaded[ENTRY_glUniform2ui])(location, v0, v1);
+    }
+    inline void APIENTRY counted_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
+    {
+        Table<>::counts[ENTRY_glUniform3ui]++;
+        ((PFNGLUNIFORM3UIPROC)Table<>::loaded[ENTRY_glUniform3ui])(location, v0, v1, v2);
+    }
+    inline void APIENTRY counted_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+    {
+        Table<>::counts[ENTRY_glUniform4ui]++;
+        ((PFNGLUNIFORM4UIPROC)Table<>::loaded[ENTRY_glUniform4ui])(location, v0, v1, v2, v3);
+    }
+    inline void APIENTRY counted_glUniform1uiv(GLint location, GLsizei count, const GLuint *value)
+    {
+        Table<>::counts[ENTRY_glUniform1uiv]++;
+        ((PFNGLUNIFORM1UIVPROC)Table<>::loaded[ENTRY_glUniform1uiv])(location, count, value);
+    }
+    inline void APIENTRY counted_glUniform2uiv(GLint location, GLsizei count, const GLuint *value)
+    {
+        Table<>::counts[ENTRY_glUniform2uiv]++;
+        ((PFNGLUNIFORM2UIVPROC)Table<>::loaded[ENTRY_glUniform2uiv])(location, count, value);
+    }
+    inline void APIENTRY counted_glUniform3uiv(GLint location, GLsizei count, const GLuint *value)
+    {
+        Table<>::counts[ENTRY_glUniform3uiv]++;
+        ((PFNGLUNIFORM3UIVPROC)Table<>::loaded[ENTRY_glUniform3uiv])(location, count, value);
+    }
+    inline void APIENTRY counted_glUniform4uiv(GLint location, GLsizei count, const GLuint *value)
+    {
+        Table<>::counts[ENTRY_glUniform4uiv]++;
+        ((PFNGLUNIFORM4UIVPROC)Table<>::loaded[ENTRY_glUniform4uiv])(location, count, value);
+    }
+    inline void APIENTRY counted_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params)
+    {
+        Table<>::counts[ENTRY_glTexParameterIiv]++;
+        ((PFNGLTEXPARAMETERIIVPROC)Table<>::loaded[ENTRY_glTexParameterIiv])(target, pname, params);
+    }
+    inline void APIENTRY counted_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params)
+    {
+        Table<>::counts[ENTRY_glTexParameterIuiv]++;
+        ((PFNGLTEXPARAMETERIUIVPROC)Table<>::loaded[ENTRY_glTexParameterIuiv])(target, pname, params);
+    }
+    inline void APIENTRY counted_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetTexParameterIiv]++;
+        ((PFNGLGETTEXPARAMETERIIVPROC)Table<>::loaded[ENTRY_glGetTexParameterIiv])(target, pname, params);
+    }
+    inline void APIENTRY counted_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params)
+    {
+        Table<>::counts[ENTRY_glGetTexParameterIuiv]++;
+        ((PFNGLGETTEXPARAMETERIUIVPROC)Table<>::loaded[ENTRY_glGetTexParameterIuiv])(target, pname, params);
+    }
+    inline void APIENTRY counted_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value)
+    {
+        Table<>::counts[ENTRY_glClearBufferiv]++;
+        ((PFNGLCLEARBUFFERIVPROC)Table<>::loaded[ENTRY_glClearBufferiv])(buffer, drawbuffer, value);
+    }
+    inline void APIENTRY counted_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value)
+    {
+        Table<>::counts[ENTRY_glClearBufferuiv]++;
+        ((PFNGLCLEARBUFFERUIVPROC)Table<>::loaded[ENTRY_glClearBufferuiv])(buffer, drawbuffer, value);
+    }
+    inline void APIENTRY counted_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value)
+    {
+        Table<>::counts[ENTRY_glClearBufferfv]++;
+        ((PFNGLCLEARBUFFERFVPROC)Table<>::loaded[ENTRY_glClearBufferfv])(buffer, drawbuffer, value);
+    }
+    inline void APIENTRY counted_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+    {
+        Table<>::counts[ENTRY_glClearBufferfi]++;
+        ((PFNGLCLEARBUFFERFIPROC)Table<>::loaded[ENTRY_glClearBufferfi])(buffer, drawbuffer, depth, stencil);
+    }
+    inline const GLubyte * APIENTRY counted_glGetStringi(GLenum name, GLuint index)
+    {
+        Table<>::counts[ENTRY_glGetStringi]++;
+        return ((PFNGLGETSTRINGIPROC)Table<>::loaded[ENTRY_glGetStringi])(name, index);
+    }
+    inline GLboolean APIENTRY counted_glIsRenderbuffer(GLuint renderbuffer)
+    {
+        Table<>::counts[ENTRY_glIsRenderbuffer]++;
+        return ((PFNGLISRENDERBUFFERPROC)Table<>::loaded[ENTRY_glIsRenderbuffer])(renderbuffer);
+    }
+    inline void APIENTRY counted_glBindRenderbuffer(GLenum target, GLuint renderbuffer)
+    {
+        Table<>::counts[ENTRY_glBindRenderbuffer]++;
+        ((PFNGLBINDRENDERBUFFERPROC)Table<>::loaded[ENTRY_glBindRenderbuffer])(target, renderbuffer);
+    }
+    inline void APIENTRY counted_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
+    {
+        Table<>::counts[ENTRY_glDeleteRenderbuffers]++;
+        ((PFNGLDELETERENDERBUFFERSPROC)Table<>::loaded[ENTRY_glDeleteRenderbuffers])(n, renderbuffers);
+    }
+    inline void APIENTRY counted_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers)
+    {
+        Table<>::counts[ENTRY_glGenRenderbuffers]++;
+        ((PFNGLGENRENDERBUFFERSPROC)Table<>::loaded[ENTRY_glGenRenderbuffers])(n, renderbuffers);
+    }
+    inline void APIENTRY counted_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+    {
+        Table<>::counts[ENTRY_glRenderbufferStorage]++;
+        ((PFNGLRENDERBUFFERSTORAGEPROC)Table<>::loaded[ENTRY_glRenderbufferStorage])(target, internalformat, width, height);
+    }
+    inline void APIENTRY counted_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetRenderbufferParameteriv]++;
+        ((PFNGLGETRENDERBUFFERPARAMETERIVPROC)Table<>::loaded[ENTRY_glGetRenderbufferParameteriv])(target, pname, params);
+    }
+    inline GLboolean APIENTRY counted_glIsFramebuffer(GLuint framebuffer)
+    {
+        Table<>::counts[ENTRY_glIsFramebuffer]++;
+        return ((PFNGLISFRAMEBUFFERPROC)Table<>::loaded[ENTRY_glIsFramebuffer])(framebuffer);
+    }
+    inline void APIENTRY counted_glBindFramebuffer(GLenum target, GLuint framebuffer)
+    {
+        Table<>::counts[ENTRY_glBindFramebuffer]++;
+        ((PFNGLBINDFRAMEBUFFERPROC)Table<>::loaded[ENTRY_glBindFramebuffer])(target, framebuffer);
+    }
+    inline void APIENTRY counted_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+    {
+        Table<>::counts[ENTRY_glDeleteFramebuffers]++;
+        ((PFNGLDELETEFRAMEBUFFERSPROC)Table<>::loaded[ENTRY_glDeleteFramebuffers])(n, framebuffers);
+    }
+    inline void APIENTRY counted_glGenFramebuffers(GLsizei n, GLuint *framebuffers)
+    {
+        Table<>::counts[ENTRY_glGenFramebuffers]++;
+        ((PFNGLGENFRAMEBUFFERSPROC)Table<>::loaded[ENTRY_glGenFramebuffers])(n, framebuffers);
+    }
+    inline GLenum APIENTRY counted_glCheckFramebufferStatus(GLenum target)
+    {
+        Table<>::counts[ENTRY_glCheckFramebufferStatus]++;
+        return ((PFNGLCHECKFRAMEBUFFERSTATUSPROC)Table<>::loaded[ENTRY_glCheckFramebufferStatus])(target);
+    }
+    inline void APIENTRY counted_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+    {
+        Table<>::counts[ENTRY_glFramebufferTexture1D]++;
+        ((PFNGLFRAMEBUFFERTEXTURE1DPROC)Table<>::loaded[ENTRY_glFramebufferTexture1D])(target, attachment, textarget, texture, level);
+    }
+    inline void APIENTRY counted_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+    {
+        Table<>::counts[ENTRY_glFramebufferTexture2D]++;
+        ((PFNGLFRAMEBUFFERTEXTURE2DPROC)Table<>::loaded[ENTRY_glFramebufferTexture2D])(target, attachment, textarget, texture, level);
+    }
+    inline void APIENTRY counted_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+    {
+        Table<>::counts[ENTRY_glFramebufferTexture3D]++;
+        ((PFNGLFRAMEBUFFERTEXTURE3DPROC)Table<>::loaded[ENTRY_glFramebufferTexture3D])(target, attachment, textarget, texture, level, zoffset);
+    }
+    inline void APIENTRY counted_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+    {
+        Table<>::counts[ENTRY_glFramebufferRenderbuffer]++;
+        ((PFNGLFRAMEBUFFERRENDERBUFFERPROC)Table<>::loaded[ENTRY_glFramebufferRenderbuffer])(target, attachment, renderbuffertarget, renderbuffer);
+    }
+    inline void APIENTRY counted_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetFramebufferAttachmentParameteriv]++;
+        ((PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)Table<>::loaded[ENTRY_glGetFramebufferAttachmentParameteriv])(target, attachment, pname, params);
+    }
+    inline void APIENTRY counted_glGenerateMipmap(GLenum target)
+    {
+        Table<>::counts[ENTRY_glGenerateMipmap]++;
+        ((PFNGLGENERATEMIPMAPPROC)Table<>::loaded[ENTRY_glGenerateMipmap])(target);
+    }
+    inline void APIENTRY counted_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+    {
+        Table<>::counts[ENTRY_glBlitFramebuffer]++;
+        ((PFNGLBLITFRAMEBUFFERPROC)Table<>::loaded[ENTRY_glBlitFramebuffer])(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    }
+    inline void APIENTRY counted_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+    {
+        Table<>::counts[ENTRY_glRenderbufferStorageMultisample]++;
+        ((PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)Table<>::loaded[ENTRY_glRenderbufferStorageMultisample])(target, samples, internalformat, width, height);
+    }
+    inline void APIENTRY counted_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+    {
+        Table<>::counts[ENTRY_glFramebufferTextureLayer]++;
+        ((PFNGLFRAMEBUFFERTEXTURELAYERPROC)Table<>::loaded[ENTRY_glFramebufferTextureLayer])(target, attachment, texture, level, layer);
+    }
+    inline void * APIENTRY counted_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+    {
+        Table<>::counts[ENTRY_glMapBufferRange]++;
+        return ((PFNGLMAPBUFFERRANGEPROC)Table<>::loaded[ENTRY_glMapBufferRange])(target, offset, length, access);
+    }
+    inline void APIENTRY counted_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+    {
+        Table<>::counts[ENTRY_glFlushMappedBufferRange]++;
+        ((PFNGLFLUSHMAPPEDBUFFERRANGEPROC)Table<>::loaded[ENTRY_glFlushMappedBufferRange])(target, offset, length);
+    }
+    inline void APIENTRY counted_glBindVertexArray(GLuint array)
+    {
+        Table<>::counts[ENTRY_glBindVertexArray]++;
+        ((PFNGLBINDVERTEXARRAYPROC)Table<>::loaded[ENTRY_glBindVertexArray])(array);
+    }
+    inline void APIENTRY counted_glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
+    {
+        Table<>::counts[ENTRY_glDeleteVertexArrays]++;
+        ((PFNGLDELETEVERTEXARRAYSPROC)Table<>::loaded[ENTRY_glDeleteVertexArrays])(n, arrays);
+    }
+    inline void APIENTRY counted_glGenVertexArrays(GLsizei n, GLuint *arrays)
+    {
+        Table<>::counts[ENTRY_glGenVertexArrays]++;
+        ((PFNGLGENVERTEXARRAYSPROC)Table<>::loaded[ENTRY_glGenVertexArrays])(n, arrays);
+    }
+    inline GLboolean APIENTRY counted_glIsVertexArray(GLuint array)
+    {
+        Table<>::counts[ENTRY_glIsVertexArray]++;
+        return ((PFNGLISVERTEXARRAYPROC)Table<>::loaded[ENTRY_glIsVertexArray])(array);
+    }
+    inline void APIENTRY counted_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+    {
+        Table<>::counts[ENTRY_glDrawArraysInstanced]++;
+        ((PFNGLDRAWARRAYSINSTANCEDPROC)Table<>::loaded[ENTRY_glDrawArraysInstanced])(mode, first, count, instancecount);
+    }
+    inline void APIENTRY counted_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+    {
+        Table<>::counts[ENTRY_glDrawElementsInstanced]++;
+        ((PFNGLDRAWELEMENTSINSTANCEDPROC)Table<>::loaded[ENTRY_glDrawElementsInstanced])(mode, count, type, indices, instancecount);
+    }
+    inline void APIENTRY counted_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
+    {
+        Table<>::counts[ENTRY_glTexBuffer]++;
+        ((PFNGLTEXBUFFERPROC)Table<>::loaded[ENTRY_glTexBuffer])(target, internalformat, buffer);
+    }
+    inline void APIENTRY counted_glPrimitiveRestartIndex(GLuint index)
+    {
+        Table<>::counts[ENTRY_glPrimitiveRestartIndex]++;
+        ((PFNGLPRIMITIVERESTARTINDEXPROC)Table<>::loaded[ENTRY_glPrimitiveRestartIndex])(index);
+    }
+    inline void APIENTRY counted_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+    {
+        Table<>::counts[ENTRY_glCopyBufferSubData]++;
+        ((PFNGLCOPYBUFFERSUBDATAPROC)Table<>::loaded[ENTRY_glCopyBufferSubData])(readTarget, writeTarget, readOffset, writeOffset, size);
+    }
+    inline void APIENTRY counted_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices)
+    {
+        Table<>::counts[ENTRY_glGetUniformIndices]++;
+        ((PFNGLGETUNIFORMINDICESPROC)Table<>::loaded[ENTRY_glGetUniformIndices])(program, uniformCount, uniformNames, uniformIndices);
+    }
+    inline void APIENTRY counted_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetActiveUniformsiv]++;
+        ((PFNGLGETACTIVEUNIFORMSIVPROC)Table<>::loaded[ENTRY_glGetActiveUniformsiv])(program, uniformCount, uniformIndices, pname, params);
+    }
+    inline void APIENTRY counted_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName)
+    {
+        Table<>::counts[ENTRY_glGetActiveUniformName]++;
+        ((PFNGLGETACTIVEUNIFORMNAMEPROC)Table<>::loaded[ENTRY_glGetActiveUniformName])(program, uniformIndex, bufSize, length, uniformName);
+    }
+    inline GLuint APIENTRY counted_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName)
+    {
+        Table<>::counts[ENTRY_glGetUniformBlockIndex]++;
+        return ((PFNGLGETUNIFORMBLOCKINDEXPROC)Table<>::loaded[ENTRY_glGetUniformBlockIndex])(program, uniformBlockName);
+    }
+    inline void APIENTRY counted_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetActiveUniformBlockiv]++;
+        ((PFNGLGETACTIVEUNIFORMBLOCKIVPROC)Table<>::loaded[ENTRY_glGetActiveUniformBlockiv])(program, uniformBlockIndex, pname, params);
+    }
+    inline void APIENTRY counted_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName)
+    {
+        Table<>::counts[ENTRY_glGetActiveUniformBlockName]++;
+        ((PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)Table<>::loaded[ENTRY_glGetActiveUniformBlockName])(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+    }
+    inline void APIENTRY counted_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+    {
+        Table<>::counts[ENTRY_glUniformBlockBinding]++;
+        ((PFNGLUNIFORMBLOCKBINDINGPROC)Table<>::loaded[ENTRY_glUniformBlockBinding])(program, uniformBlockIndex, uniformBlockBinding);
+    }
+    inline void APIENTRY counted_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+    {
+        Table<>::counts[ENTRY_glDrawElementsBaseVertex]++;
+        ((PFNGLDRAWELEMENTSBASEVERTEXPROC)Table<>::loaded[ENTRY_glDrawElementsBaseVertex])(mode, count, type, indices, basevertex);
+    }
+    inline void APIENTRY counted_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+    {
+        Table<>::counts[ENTRY_glDrawRangeElementsBaseVertex]++;
+        ((PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)Table<>::loaded[ENTRY_glDrawRangeElementsBaseVertex])(mode, start, end, count, type, indices, basevertex);
+    }
+    inline void APIENTRY counted_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex)
+    {
+        Table<>::counts[ENTRY_glDrawElementsInstancedBaseVertex]++;
+        ((PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)Table<>::loaded[ENTRY_glDrawElementsInstancedBaseVertex])(mode, count, type, indices, instancecount, basevertex);
+    }
+    inline void APIENTRY counted_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex)
+    {
+        Table<>::counts[ENTRY_glMultiDrawElementsBaseVertex]++;
+        ((PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)Table<>::loaded[ENTRY_glMultiDrawElementsBaseVertex])(mode, count, type, indices, drawcount, basevertex);
+    }
+    inline void APIENTRY counted_glProvokingVertex(GLenum mode)
+    {
+        Table<>::counts[ENTRY_glProvokingVertex]++;
+        ((PFNGLPROVOKINGVERTEXPROC)Table<>::loaded[ENTRY_glProvokingVertex])(mode);
+    }
+    inline GLsync APIENTRY counted_glFenceSync(GLenum condition, GLbitfield flags)
+    {
+        Table<>::counts[ENTRY_glFenceSync]++;
+        return ((PFNGLFENCESYNCPROC)Table<>::loaded[ENTRY_glFenceSync])(condition, flags);
+    }
+    inline GLboolean APIENTRY counted_glIsSync(GLsync sync)
+    {
+        Table<>::counts[ENTRY_glIsSync]++;
+        return ((PFNGLISSYNCPROC)Table<>::loaded[ENTRY_glIsSync])(sync);
+    }
+    inline void APIENTRY counted_glDeleteSync(GLsync sync)
+    {
+        Table<>::counts[ENTRY_glDeleteSync]++;
+        ((PFNGLDELETESYNCPROC)Table<>::loaded[ENTRY_glDeleteSync])(sync);
+    }
+    inline GLenum APIENTRY counted_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+    {
+        Table<>::counts[ENTRY_glClientWaitSync]++;
+        return ((PFNGLCLIENTWAITSYNCPROC)Table<>::loaded[ENTRY_glClientWaitSync])(sync, flags, timeout);
+    }
+    inline void APIENTRY counted_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+    {
+        Table<>::counts[ENTRY_glWaitSync]++;
+        ((PFNGLWAITSYNCPROC)Table<>::loaded[ENTRY_glWaitSync])(sync, flags, timeout);
+    }
+    inline void APIENTRY counted_glGetInteger64v(GLenum pname, GLint64 *data)
+    {
+        Table<>::counts[ENTRY_glGetInteger64v]++;
+        ((PFNGLGETINTEGER64VPROC)Table<>::loaded[ENTRY_glGetInteger64v])(pname, data);
+    }
+    inline void APIENTRY counted_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values)
+    {
+        Table<>::counts[ENTRY_glGetSynciv]++;
+        ((PFNGLGETSYNCIVPROC)Table<>::loaded[ENTRY_glGetSynciv])(sync, pname, count, length, values);
+    }
+    inline void APIENTRY counted_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data)
+    {
+        Table<>::counts[ENTRY_glGetInteger64i_v]++;
+        ((PFNGLGETINTEGER64I_VPROC)Table<>::loaded[ENTRY_glGetInteger64i_v])(target, index, data);
+    }
+    inline void APIENTRY counted_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params)
+    {
+        Table<>::counts[ENTRY_glGetBufferParameteri64v]++;
+        ((PFNGLGETBUFFERPARAMETERI64VPROC)Table<>::loaded[ENTRY_glGetBufferParameteri64v])(target, pname, params);
+    }
+    inline void APIENTRY counted_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level)
+    {
+        Table<>::counts[ENTRY_glFramebufferTexture]++;
+        ((PFNGLFRAMEBUFFERTEXTUREPROC)Table<>::loaded[ENTRY_glFramebufferTexture])(target, attachment, texture, level);
+    }
+    inline void APIENTRY counted_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+    {
+        Table<>::counts[ENTRY_glTexImage2DMultisample]++;
+        ((PFNGLTEXIMAGE2DMULTISAMPLEPROC)Table<>::loaded[ENTRY_glTexImage2DMultisample])(target, samples, internalformat, width, height, fixedsamplelocations);
+    }
+    inline void APIENTRY counted_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+    {
+        Table<>::counts[ENTRY_glTexImage3DMultisample]++;
+        ((PFNGLTEXIMAGE3DMULTISAMPLEPROC)Table<>::loaded[ENTRY_glTexImage3DMultisample])(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    }
+    inline void APIENTRY counted_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val)
+    {
+        Table<>::counts[ENTRY_glGetMultisamplefv]++;
+        ((PFNGLGETMULTISAMPLEFVPROC)Table<>::loaded[ENTRY_glGetMultisamplefv])(pname, index, val);
+    }
+    inline void APIENTRY counted_glSampleMaski(GLuint maskNumber, GLbitfield mask)
+    {
+        Table<>::counts[ENTRY_glSampleMaski]++;
+        ((PFNGLSAMPLEMASKIPROC)Table<>::loaded[ENTRY_glSampleMaski])(maskNumber, mask);
+    }
+    inline void APIENTRY counted_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name)
+    {
+        Table<>::counts[ENTRY_glBindFragDataLocationIndexed]++;
+        ((PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)Table<>::loaded[ENTRY_glBindFragDataLocationIndexed])(program, colorNumber, index, name);
+    }
+    inline GLint APIENTRY counted_glGetFragDataIndex(GLuint program, const GLchar *name)
+    {
+        Table<>::counts[ENTRY_glGetFragDataIndex]++;
+        return ((PFNGLGETFRAGDATAINDEXPROC)Table<>::loaded[ENTRY_glGetFragDataIndex])(program, name);
+    }
+    inline void APIENTRY counted_glGenSamplers(GLsizei count, GLuint *samplers)
+    {
+        Table<>::counts[ENTRY_glGenSamplers]++;
+        ((PFNGLGENSAMPLERSPROC)Table<>::loaded[ENTRY_glGenSamplers])(count, samplers);
+    }
+    inline void APIENTRY counted_glDeleteSamplers(GLsizei count, const GLuint *samplers)
+    {
+        Table<>::counts[ENTRY_glDeleteSamplers]++;
+        ((PFNGLDELETESAMPLERSPROC)Table<>::loaded[ENTRY_glDeleteSamplers])(count, samplers);
+    }
+    inline GLboolean APIENTRY counted_glIsSampler(GLuint sampler)
+    {
+        Table<>::counts[ENTRY_glIsSampler]++;
+        return ((PFNGLISSAMPLERPROC)Table<>::loaded[ENTRY_glIsSampler])(sampler);
+    }
+    inline void APIENTRY counted_glBindSampler(GLuint unit, GLuint sampler)
+    {
+        Table<>::counts[ENTRY_glBindSampler]++;
+        ((PFNGLBINDSAMPLERPROC)Table<>::loaded[ENTRY_glBindSampler])(unit, sampler);
+    }
+    inline void APIENTRY counted_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param)
+    {
+        Table<>::counts[ENTRY_glSamplerParameteri]++;
+        ((PFNGLSAMPLERPARAMETERIPROC)Table<>::loaded[ENTRY_glSamplerParameteri])(sampler, pname, param);
+    }
+    inline void APIENTRY counted_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param)
+    {
+        Table<>::counts[ENTRY_glSamplerParameteriv]++;
+        ((PFNGLSAMPLERPARAMETERIVPROC)Table<>::loaded[ENTRY_glSamplerParameteriv])(sampler, pname, param);
+    }
+    inline void APIENTRY counted_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
+    {
+        Table<>::counts[ENTRY_glSamplerParameterf]++;
+        ((PFNGLSAMPLERPARAMETERFPROC)Table<>::loaded[ENTRY_glSamplerParameterf])(sampler, pname, param);
+    }
+    inline void APIENTRY counted_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param)
+    {
+        Table<>::counts[ENTRY_glSamplerParameterfv]++;
+        ((PFNGLSAMPLERPARAMETERFVPROC)Table<>::loaded[ENTRY_glSamplerParameterfv])(sampler, pname, param);
+    }
+    inline void APIENTRY counted_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param)
+    {
+        Table<>::counts[ENTRY_glSamplerParameterIiv]++;
+        ((PFNGLSAMPLERPARAMETERIIVPROC)Table<>::loaded[ENTRY_glSamplerParameterIiv])(sampler, pname, param);
+    }
+    inline void APIENTRY counted_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param)
+    {
+        Table<>::counts[ENTRY_glSamplerParameterIuiv]++;
+        ((PFNGLSAMPLERPARAMETERIUIVPROC)Table<>::loaded[ENTRY_glSamplerParameterIuiv])(sampler, pname, param);
+    }
+    inline void APIENTRY counted_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetSamplerParameteriv]++;
+        ((PFNGLGETSAMPLERPARAMETERIVPROC)Table<>::loaded[ENTRY_glGetSamplerParameteriv])(sampler, pname, params);
+    }
+    inline void APIENTRY counted_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params)
+    {
+        Table<>::counts[ENTRY_glGetSamplerParameterIiv]++;
+        ((PFNGLGETSAMPLERPARAMETERIIVPROC)Table<>::loaded[ENTRY_glGetSamplerParameterIiv])(sampler, pname, params);
+    }
+    inline void APIENTRY counted_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params)
+    {
+        Table<>::counts[ENTRY_glGetSamplerParameterfv]++;
+        ((PFNGLGETSAMPLERPARAMETERFVPROC)Table<>::loaded[ENTRY_glGetSamplerParameterfv])(sampler, pname, params);
+    }
+    inline void APIENTRY counted_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params)
+    {
+        Table<>::counts[ENTRY_glGetSamplerParameterIuiv]++;
+        ((PFNGLGETSAMPLERPARAMETERIUIVPROC)Table<>::loaded[ENTRY_glGetSamplerParameterIuiv])(sampler, pname, params);
+    }
+    inline void APIENTRY counted_glQueryCounter(GLuint id, GLenum target)
+    {
+        Table<>::counts[ENTRY_glQueryCounter]++;
+        ((PFNGLQUERYCOUNTERPROC)Table<>::loaded[ENTRY_glQueryCounter])(id, target);
+    }
+    inline void APIENTRY counted_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params)
+    {
+        Table<>::counts[ENTRY_glGetQueryObjecti64v]++;
+        ((PFNGLGETQUERYOBJECTI64VPROC)Table<>::loaded[ENTRY_glGetQueryObjecti64v])(id, pname, params);
+    }
+    inline void APIENTRY counted_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params)
+    {
+        Table<>::counts[ENTRY_glGetQueryObjectui64v]++;
+        ((PFNGLGETQUERYOBJECTUI64VPROC)Table<>::loaded[ENTRY_glGetQueryObjectui64v])(id, pname, params);
+    }
+    inline void APIENTRY counted_glVertexAttribDivisor(GLuint index, GLuint divisor)
+    {
+        Table<>::counts[ENTRY_glVertexAttribDivisor]++;
+        ((PFNGLVERTEXATTRIBDIVISORPROC)Table<>::loaded[ENTRY_glVertexAttribDivisor])(index, divisor);
+    }
+    inline void APIENTRY counted_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+    {
+        Table<>::counts[ENTRY_glVertexAttribP1ui]++;
+        ((PFNGLVERTEXATTRIBP1UIPROC)Table<>::loaded[ENTRY_glVertexAttribP1ui])(index, type, normalized, value);
+    }
+    inline void APIENTRY counted_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+    {
+        Table<>::counts[ENTRY_glVertexAttribP1uiv]++;
+        ((PFNGLVERTEXATTRIBP1UIVPROC)Table<>::loaded[ENTRY_glVertexAttribP1uiv])(index, type, normalized, value);
+    }
+    inline void APIENTRY counted_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+    {
+        Table<>::counts[ENTRY_glVertexAttribP2ui]++;
+        ((PFNGLVERTEXATTRIBP2UIPROC)Table<>::loaded[ENTRY_glVertexAttribP2ui])(index, type, normalized, value);
+    }
+    inline void APIENTRY counted_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+    {
+        Table<>::counts[ENTRY_glVertexAttribP2uiv]++;
+        ((PFNGLVERTEXATTRIBP2UIVPROC)Table<>::loaded[ENTRY_glVertexAttribP2uiv])(index, type, normalized, value);
+    }
+    inline void APIENTRY counted_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+    {
+        Table<>::counts[ENTRY_glVertexAttribP3ui]++;
+        ((PFNGLVERTEXATTRIBP3UIPROC)Table<>::loaded[ENTRY_glVertexAttribP3ui])(index, type, normalized, value);
+    }
+    inline void APIENTRY counted_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+    {
+        Table<>::counts[ENTRY_glVertexAttribP3uiv]++;
+        ((PFNGLVERTEXATTRIBP3UIVPROC)Table<>::loaded[ENTRY_glVertexAttribP3uiv])(index, type, normalized, value);
+    }
+    inline void APIENTRY counted_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+    {
+        Table<>::counts[ENTRY_glVertexAttribP4ui]++;
+        ((PFNGLVERTEXATTRIBP4UIPROC)Table<>::loaded[ENTRY_glVertexAttribP4ui])(index, type, normalized, value);
+    }
+    inline void APIENTRY counted_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+    {
+        Table<>::counts[ENTRY_glVertexAttribP4uiv]++;
+        ((PFNGLVERTEXATTRIBP4UIVPROC)Table<>::loaded[ENTRY_glVertexAttribP4uiv])(index, type, normalized, value);
+    }
+    inline void APIENTRY counted_glVertexP2ui(GLenum type, GLuint value)
+    {
+        Table<>::counts[ENTRY_glVertexP2ui]++;
+        ((PFNGLVERTEXP2UIPROC)Table<>::loaded[ENTRY_glVertexP2ui])(type, value);
+    }
+    inline void APIENTRY counted_glVertexP2uiv(GLenum type, const GLuint *value)
+    {
+        Table<>::counts[ENTRY_glVertexP2uiv]++;
+        ((PFNGLVERTEXP2UIVPROC)Table<>::loaded[ENTRY_glVertexP2uiv])(type, value);
+    }
+    inline void APIENTRY counted_glVertexP3ui(GLenum type, GLuint value)
+    {
+        Table<>::counts[ENTRY_glVertexP3ui]++;
+        ((PFNGLVERTEXP3UIPROC)Table<>::loaded[ENTRY_glVertexP3ui])(type, value);
+    }
+    inline void APIENTRY counted_glVertexP3uiv(GLenum type, const GLuint *value)
+    {
+        Table<>::counts[ENTRY_glVertexP3uiv]++;
+        ((PFNGLVERTEXP3UIVPROC)Table<>::loaded[ENTRY_glVertexP3uiv])(type, value);
+    }
+    inline void APIENTRY counted_glVertexP4ui(GLenum type, GLuint value)
+    {
+        Table<>::counts[ENTRY_glVertexP4ui]++;
+        ((PFNGLVERTEXP4UIPROC)Table<>::loaded[ENTRY_glVertexP4ui])(type, value);
+    }
+    inline void APIENTRY counted_glVertexP4uiv(GLenum type, const GLuint *value)
+    {
+        Table<>::counts[ENTRY_glVertexP4uiv]++;
+        ((PFNGLVERTEXP4UIVPROC)Table<>::loaded[ENTRY_glVertexP4uiv])(type, value);
+    }
+    inline void APIENTRY counted_glTexCoordP1ui(GLenum type, GLuint coords)
+    {
+        Table<>::counts[ENTRY_glTexCoordP1ui]++;
+        ((PFNGLTEXCOORDP1UIPROC)Table<>::loaded[ENTRY_glTexCoordP1ui])(type, coords);
+    }
+    inline void APIENTRY counted_glTexCoordP1uiv(GLenum type, const GLuint *coords)
+    {
+        Table<>::counts[ENTRY_glTexCoordP1uiv]++;
+        ((PFNGLTEXCOORDP1UIVPROC)Table<>::loaded[ENTRY_glTexCoordP1uiv])(type, coords);
+    }
+    inline void APIENTRY counted_glTexCoordP2ui(GLenum type, GLuint coords)
+    {
+        Table<>::counts[ENTRY_glTexCoordP2ui]++;
+        ((PFNGLTEXCOORDP2UIPROC)Table<>::loaded[ENTRY_glTexCoordP2ui])(type, coords);
+    }
+    inline void APIENTRY counted_glTexCoordP2uiv(GLenum type, const GLuint *coords)
+    {
+        Table<>::counts[ENTRY_glTexCoordP2uiv]++;
+        ((PFNGLTEXCOORDP2UIVPROC)Table<>::loaded[ENTRY_glTexCoordP2uiv])(type, coords);
+    }
+    inline void APIENTRY counted_glTexCoordP3ui(GLenum type, GLuint coords)
+    {
+        Table<>::counts[ENTRY_glTexCoordP3ui]++;
+        ((PFNGLTEXCOORDP3UIPROC)Table<>::loaded[ENTRY_glTexCoordP3ui])(type, coords);
+    }
+    inline void APIENTRY counted_glTexCoordP3uiv(GLenum type, const GLuint *coords)
+    {
+        Table<>::counts[ENTRY_glTexCoordP3uiv]++;
+        ((PFNGLTEXCOORDP3UIVPROC)Table<>::loaded[ENTRY_glTexCoordP3uiv])(type, coords);
+    }
+    inline void APIENTRY counted_glTexCoordP4ui(GLenum type, GLuint coords)
+    {
+        Table<>::counts[ENTRY_glTexCoordP4ui]++;
+        ((PFNGLTEXCOORDP4UIPROC)Table<>::loaded[ENTRY_glTexCoordP4ui])(type, coords);
+    }
+    inline void APIENTRY counted_glTexCoordP4uiv(GLenum type, const GLuint *coords)
+    {
+        Table<>::counts[ENTRY_glTexCoordP4uiv]++;
+        ((PFNGLTEXCOORDP4UIVPROC)Table<>::loaded[ENTRY_glTexCoordP4uiv])(type, coords);
+    }
+    inline void APIENTRY counted_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoordP1ui]++;
+        ((PFNGLMULTITEXCOORDP1UIPROC)Table<>::loaded[ENTRY_glMultiTexCoordP1ui])(texture, type, coords);
+    }
+    inline void APIENTRY counted_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoordP1uiv]++;
+        ((PFNGLMULTITEXCOORDP1UIVPROC)Table<>::loaded[ENTRY_glMultiTexCoordP1uiv])(texture, type, coords);
+    }
+    inline void APIENTRY counted_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoordP2ui]++;
+        ((PFNGLMULTITEXCOORDP2UIPROC)Table<>::loaded[ENTRY_glMultiTexCoordP2ui])(texture, type, coords);
+    }
+    inline void APIENTRY counted_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoordP2uiv]++;
+        ((PFNGLMULTITEXCOORDP2UIVPROC)Table<>::loaded[ENTRY_glMultiTexCoordP2uiv])(texture, type, coords);
+    }
+    inline void APIENTRY counted_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoordP3ui]++;
+        ((PFNGLMULTITEXCOORDP3UIPROC)Table<>::loaded[ENTRY_glMultiTexCoordP3ui])(texture, type, coords);
+    }
+    inline void APIENTRY counted_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoordP3uiv]++;
+        ((PFNGLMULTITEXCOORDP3UIVPROC)Table<>::loaded[ENTRY_glMultiTexCoordP3uiv])(texture, type, coords);
+    }
+    inline void APIENTRY counted_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoordP4ui]++;
+        ((PFNGLMULTITEXCOORDP4UIPROC)Table<>::loaded[ENTRY_glMultiTexCoordP4ui])(texture, type, coords);
+    }
+    inline void APIENTRY counted_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords)
+    {
+        Table<>::counts[ENTRY_glMultiTexCoordP4uiv]++;
+        ((PFNGLMULTITEXCOORDP4UIVPROC)Table<>::loaded[ENTRY_glMultiTexCoordP4uiv])(texture, type, coords);
+    }
+    inline void APIENTRY counted_glNormalP3ui(GLenum type, GLuint coords)
+    {
+        Table<>::counts[ENTRY_glNormalP3ui]++;
+        ((PFNGLNORMALP3UIPROC)Table<>::loaded[ENTRY_glNormalP3ui])(type, coords);
+    }
+    inline void APIENTRY counted_glNormalP3uiv(GLenum type, const GLuint *coords)
+    {
+        Table<>::counts[ENTRY_glNormalP3uiv]++;
+        ((PFNGLNORMALP3UIVPROC)Table<>::loaded[ENTRY_glNormalP3uiv])(type, coords);
+    }
+    inline void APIENTRY counted_glColorP3ui(GLenum type, GLuint color)
+    {
+        Table<>::counts[ENTRY_glColorP3ui]++;
+        ((PFNGLCOLORP3UIPROC)Table<>::loaded[ENTRY_glColorP3ui])(type, color);
+    }
+    inline void APIENTRY counted_glColorP3uiv(GLenum type, const GLuint *color)
+    {
+        Table<>::counts[ENTRY_glColorP3uiv]++;
+        ((PFNGLCOLORP3UIVPROC)Table<>::loaded[ENTRY_glColorP3uiv])(type, color);
+    }
+    inline void APIENTRY counted_glColorP4ui(GLenum type, GLuint color)
+    {
+        Table<>::counts[ENTRY_glColorP4ui]++;
+        ((PFNGLCOLORP4UIPROC)Table<>::loaded[ENTRY_glColorP4ui])(type, color);
+    }
+    inline void APIENTRY counted_glColorP4uiv(GLenum type, const GLuint *color)
+    {
+        Table<>::counts[ENTRY_glColorP4uiv]++;
+        ((PFNGLCOLORP4UIVPROC)Table<>::loaded[ENTRY_glColorP4uiv])(type, color);
+    }
+    inline void APIENTRY counted_glSecondaryColorP3ui(GLenum type, GLuint color)
+    {
+        Table<>::counts[ENTRY_glSecondaryColorP3ui]++;
+        ((PFNGLSECONDARYCOLORP3UIPROC)Table<>::loaded[ENTRY_glSecondaryColorP3ui])(type, color);
+    }
+    inline void APIENTRY counted_glSecondaryColorP3uiv(GLenum type, const GLuint *color)
+    {
+        Table<>::counts[ENTRY_glSecondaryColorP3uiv]++;
+        ((PFNGLSECONDARYCOLORP3UIVPROC)Table<>::loaded[ENTRY_glSecondaryColorP3uiv])(type, color);
+    }
+
+    // points every loaded glad_gl* at its counting wrapper, or back
+    // ------------------------------------------------------------------------
+    inline void install()
+    {
+        if (glad_glCullFace && glad_glCullFace != counted_glCullFace)
+        {
+            Table<>::loaded[ENTRY_glCullFace] = (void*)glad_glCullFace;
+            glad_glCullFace = counted_glCullFace;
+        }
+        if (glad_glFrontFace && glad_glFrontFace != counted_glFrontFace)
+        {
+            Table<>::loaded[ENTRY_glFrontFace] = (void*)glad_glFrontFace;
+            glad_glFrontFace = counted_glFrontFace;
+        }
+        if (glad_glHint && glad_glHint != counted_glHint)
+        {
+            Table<>::loaded[ENTRY_glHint] = (void*)glad_glHint;
+            glad_glHint = counted_glHint;
+        }
+        if (glad_glLineWidth && glad_glLineWidth != counted_glLineWidth)
+        {
+            Table<>::loaded[ENTRY_glLineWidth] = (void*)glad_glLineWidth;
+            glad_glLineWidth = counted_glLineWidth;
+        }
+        if (glad_glPointSize && glad_glPointSize != counted_glPointSize)
+        {
+            Table<>::loaded[ENTRY_glPointSize] = (void*)glad_glPointSize;
+            glad_glPointSize = counted_glPointSize;
+        }
+        if (glad_glPolygonMode && glad_glPolygonMode != counted_glPolygonMode)
+        {
+            Table<>::loaded[ENTRY_glPolygonMode] = (void*)glad_glPolygonMode;
+            glad_glPolygonMode = counted_glPolygonMode;
+        }
+        if (glad_glScissor && glad_glScissor != counted_glScissor)
+        {
+            Table<>::loaded[ENTRY_glScissor] = (void*)glad_glScissor;
+            glad_glScissor = counted_glScissor;
+        }
+        if (glad_glTexParameterf && glad_glTexParameterf != counted_glTexParameterf)
+        {
+            Table<>::loaded[ENTRY_glTexParameterf] = (void*)glad_glTexParameterf;
+            glad_glTexParameterf = counted_glTexParameterf;
+        }
+        if (glad_glTexParameterfv && glad_glTexParameterfv != counted_glTexParameterfv)
+        {
+            Table<>::loaded[ENTRY_glTexParameterfv] = (void*)glad_glTexParameterfv;
+            glad_glTexParameterfv = counted_glTexParameterfv;
+        }
+        if (glad_glTexParameteri && glad_glTexParameteri != counted_glTexParameteri)
+        {
+            Table<>::loaded[ENTRY_glTexParameteri] = (void*)glad_glTexParameteri;
+            glad_glTexParameteri = counted_glTexParameteri;
+        }
+        if (glad_glTexParameteriv && glad_glTexParameteriv != counted_glTexParameteriv)
+        {
+            Table<>::loaded[ENTRY_glTexParameteriv] = (void*)glad_glTexParameteriv;
+            glad_glTexParameteriv = counted_glTexParameteriv;
+        }
+        if (glad_glTexImage1D && glad_glTexImage1D != counted_glTexImage1D)
+        {
+            Table<>::loaded[ENTRY_glTexImage1D] = (void*)glad_glTexImage1D;
+            glad_glTexImage1D = counted_glTexImage1D;
+        }
+        if (glad_glTexImage2D && glad_glTexImage2D != counted_glTexImage2D)
+        {
+            Table<>::loaded[ENTRY_glTexImage2D] = (void*)glad_glTexImage2D;
+            glad_glTexImage2D = counted_glTexImage2D;
+        }
+        if (glad_glDrawBuffer && glad_glDrawBuffer != counted_glDrawBuffer)
+        {
+            Table<>::loaded[ENTRY_glDrawBuffer] = (void*)glad_glDrawBuffer;
+            glad_glDrawBuffer = counted_glDrawBuffer;
+        }
+        if (glad_glClear && glad_glClear != counted_glClear)
+        {
+            Table<>::loaded[ENTRY_glClear] = (void*)glad_glClear;
+            glad_glClear = counted_glClear;
+        }
+        if (glad_glClearColor && glad_glClearColor != counted_glClearColor)
+        {
+            Table<>::loaded[ENTRY_glClearColor] = (void*)glad_glClearColor;
+            glad_glClearColor = counted_glClearColor;
+        }
+        if (glad_glClearStencil && glad_glClearStencil != counted_glClearStencil)
+        {
+            Table<>::loaded[ENTRY_glClearStencil] = (void*)glad_glClearStencil;
+            glad_glClearStencil = counted_glClearStencil;
+        }
+        if (glad_glClearDepth && glad_glClearDepth != counted_glClearDepth)
+        {
+            Table<>::loaded[ENTRY_glClearDepth] = (void*)glad_glClearDepth;
+            glad_glClearDepth = counted_glClearDepth;
+        }
+        if (glad_glStencilMask && glad_glStencilMask != counted_glStencilMask)
+        {
+            Table<>::loaded[ENTRY_glStencilMask] = (void*)glad_glStencilMask;
+            glad_glStencilMask = counted_glStencilMask;
+        }
+        if (glad_glColorMask && glad_glColorMask != counted_glColorMask)
+        {
+            Table<>::loaded[ENTRY_glColorMask] = (void*)glad_glColorMask;
+            glad_glColorMask = counted_glColorMask;
+        }
+        if (glad_glDepthMask && glad_glDepthMask != counted_glDepthMask)
+        {
+            Table<>::loaded[ENTRY_glDepthMask] = (void*)glad_glDepthMask;
+            glad_glDepthMask = counted_glDepthMask;
+        }
+        if (glad_glDisable && glad_glDisable != counted_glDisable)
+        {
+            Table<>::loaded[ENTRY_glDisable] = (void*)glad_glDisable;
+            glad_glDisable = counted_glDisable;
+        }
+        if (glad_glEnable && glad_glEnable != counted_glEnable)
+        {
+            Table<>::loaded[ENTRY_glEnable] = (void*)glad_glEnable;
+            glad_glEnable = counted_glEnable;
+        }
+        if (glad_glFinish && glad_glFinish != counted_glFinish)
+        {
+            Table<>::loaded[ENTRY_glFinish] = (void*)glad_glFinish;
+            glad_glFinish = counted_glFinish;
+        }
+        if (glad_glFlush && glad_glFlush != counted_glFlush)
+        {
+            Table<>::loaded[ENTRY_glFlush] = (void*)glad_glFlush;
+            glad_glFlush = counted_glFlush;
+        }
+        if (glad_glBlendFunc && glad_glBlendFunc != counted_glBlendFunc)
+        {
+            Table<>::loaded[ENTRY_glBlendFunc] = (void*)glad_glBlendFunc;
+            glad_glBlendFunc = counted_glBlendFunc;
+        }
+        if (glad_glLogicOp && glad_glLogicOp != counted_glLogicOp)
+        {
+            Table<>::loaded[ENTRY_glLogicOp] = (void*)glad_glLogicOp;
+            glad_glLogicOp = counted_glLogicOp;
+        }
+        if (glad_glStencilFunc && glad_glStencilFunc != counted_glStencilFunc)
+        {
+            Table<>::loaded[ENTRY_glStencilFunc] = (void*)glad_glStencilFunc;
+            glad_glStencilFunc = counted_glStencilFunc;
+        }
+        if (glad_glStencilOp && glad_glStencilOp != counted_glStencilOp)
+        {
+            Table<>::loaded[ENTRY_glStencilOp] = (void*)glad_glStencilOp;
+            glad_glStencilOp = counted_glStencilOp;
+        }
+        if (glad_glDepthFunc && glad_glDepthFunc != counted_glDepthFunc)
+        {
+            Table<>::loaded[ENTRY_glDepthFunc] = (void*)glad_glDepthFunc;
+            glad_glDepthFunc = counted_glDepthFunc;
+        }
+        if (glad_glPixelStoref && glad_glPixelStoref != counted_glPixelStoref)
+        {
+            Table<>::loaded[ENTRY_glPixelStoref] = (void*)glad_glPixelStoref;
+            glad_glPixelStoref = counted_glPixelStoref;
+        }
+        if (glad_glPixelStorei && glad_glPixelStorei != counted_glPixelStorei)
+        {
+            Table<>::loaded[ENTRY_glPixelStorei] = (void*)glad_glPixelStorei;
+            glad_glPixelStorei = counted_glPixelStorei;
+        }
+        if (glad_glReadBuffer && glad_glReadBuffer != counted_glReadBuffer)
+        {
+            Table<>::loaded[ENTRY_glReadBuffer] = (void*)glad_glReadBuffer;
+            glad_glReadBuffer = counted_glReadBuffer;
+        }
+        if (glad_glReadPixels && glad_glReadPixels != counted_glReadPixels)
+        {
+            Table<>::loaded[ENTRY_glReadPixels] = (void*)glad_glReadPixels;
+            glad_glReadPixels = counted_glReadPixels;
+        }
+        if (glad_glGetBooleanv && glad_glGetBooleanv != counted_glGetBooleanv)
+        {
+            Table<>::loaded[ENTRY_glGetBooleanv] = (void*)glad_glGetBooleanv;
+            glad_glGetBooleanv = counted_glGetBooleanv;
+        }
+        if (glad_glGetDoublev && glad_glGetDoublev != counted_glGetDoublev)
+        {
+            Table<>::loaded[ENTRY_glGetDoublev] = (void*)glad_glGetDoublev;
+            glad_glGetDoublev = counted_glGetDoublev;
+        }
+        if (glad_glGetError && glad_glGetError != counted_glGetError)
+        {
+            Table<>::loaded[ENTRY_glGetError] = (void*)glad_glGetError;
+            glad_glGetError = counted_glGetError;
+        }
+        if (glad_glGetFloatv && glad_glGetFloatv != counted_glGetFloatv)
+        {
+            Table<>::loaded[ENTRY_glGetFloatv] = (void*)glad_glGetFloatv;
+            glad_glGetFloatv = counted_glGetFloatv;
+        }
+        if (glad_glGetIntegerv && glad_glGetIntegerv != counted_glGetIntegerv)
+        {
+            Table<>::loaded[ENTRY_glGetIntegerv] = (void*)glad_glGetIntegerv;
+            glad_glGetIntegerv = counted_glGetIntegerv;
+        }
+        if (glad_glGetString && glad_glGetString != counted_glGetString)
+        {
+            Table<>::loaded[ENTRY_glGetString] = (void*)glad_glGetString;
+            glad_glGetString = counted_glGetString;
+        }
+        if (glad_glGetTexImage && glad_glGetTexImage != counted_glGetTexImage)
+        {
+            Table<>::loaded[ENTRY_glGetTexImage] = (void*)glad_glGetTexImage;
+            glad_glGetTexImage = counted_glGetTexImage;
+        }
+        if (glad_glGetTexParameterfv && glad_glGetTexParameterfv != counted_glGetTexParameterfv)
+        {
+            Table<>::loaded[ENTRY_glGetTexParameterfv] = (void*)glad_glGetTexParameterfv;
+            glad_glGetTexParameterfv = counted_glGetTexParameterfv;
+        }
+        if (glad_glGetTexParameteriv && glad_glGetTexParameteriv != counted_glGetTexParameteriv)
+        {
+            Table<>::loaded[ENTRY_glGetTexParameteriv] = (void*)glad_glGetTexParameteriv;
+            glad_glGetTexParameteriv = counted_glGetTexParameteriv;
+        }
+        if (glad_glGetTexLevelParameterfv && glad_glGetTexLevelParameterfv != counted_glGetTexLevelParameterfv)
+        {
+            Table<>::loaded[ENTRY_glGetTexLevelParameterfv] = (void*)glad_glGetTexLevelParameterfv;
+            glad_glGetTexLevelParameterfv = counted_glGetTexLevelParameterfv;
+        }
+        if (glad_glGetTexLevelParameteriv && glad_glGetTexLevelParameteriv != counted_glGetTexLevelParameteriv)
+        {
+            Table<>::loaded[ENTRY_glGetTexLevelParameteriv] = (void*)glad_glGetTexLevelParameteriv;
+            glad_glGetTexLevelParameteriv = counted_glGetTexLevelParameteriv;
+        }
+        if (glad_glIsEnabled && glad_glIsEnabled != counted_glIsEnabled)
+        {
+            Table<>::loaded[ENTRY_glIsEnabled] = (void*)glad_glIsEnabled;
+            glad_glIsEnabled = counted_glIsEnabled;
+        }
+        if (glad_glDepthRange && glad_glDepthRange != counted_glDepthRange)
+        {
+            Table<>::loaded[ENTRY_glDepthRange] = (void*)glad_glDepthRange;
+            glad_glDepthRange = counted_glDepthRange;
+        }
+        if (glad_glViewport && glad_glViewport != counted_glViewport)
+        {
+            Table<>::loaded[ENTRY_glViewport] = (void*)glad_glViewport;
+            glad_glViewport = counted_glViewport;
+        }
+        if (glad_glNewList && glad_glNewList != counted_glNewList)
+        {
+            Table<>::loaded[ENTRY_glNewList] = (void*)glad_glNewList;
+            glad_glNewList = counted_glNewList;
+        }
+        if (glad_glEndList && glad_glEndList != counted_glEndList)
+        {
+            Table<>::loaded[ENTRY_glEndList] = (void*)glad_glEndList;
+            glad_glEndList = counted_glEndList;
+        }
+        if (glad_glCallList && glad_glCallList != counted_glCallList)
+        {
+            Table<>::loaded[ENTRY_glCallList] = (void*)glad_glCallList;
+            glad_glCallList = counted_glCallList;
+        }
+        if (glad_glCallLists && glad_glCallLists != counted_glCallLists)
+        {
+            Table<>::loaded[ENTRY_glCallLists] = (void*)glad_glCallLists;
+            glad_glCallLists = counted_glCallLists;
+        }
+        if (glad_glDeleteLists && glad_glDeleteLists != counted_glDeleteLists)
+        {
+            Table<>::loaded[ENTRY_glDeleteLists] = (void*)glad_glDeleteLists;
+            glad_glDeleteLists = counted_glDeleteLists;
+        }
+        if (glad_glGenLists && glad_glGenLists != counted_glGenLists)
+        {
+            Table<>::loaded[ENTRY_glGenLists] = (void*)glad_glGenLists;
+            glad_glGenLists = counted_glGenLists;
+        }
+        if (glad_glListBase && glad_glListBase != counted_glListBase)
+        {
+            Table<>::loaded[ENTRY_glListBase] = (void*)glad_glListBase;
+            glad_glListBase = counted_glListBase;
+        }
+        if (glad_glBegin && glad_glBegin != counted_glBegin)
+        {
+            Table<>::loaded[ENTRY_glBegin] = (void*)glad_glBegin;
+            glad_glBegin = counted_glBegin;
+        }
+        if (glad_glBitmap && glad_glBitmap != counted_glBitmap)
+        {
+            Table<>::loaded[ENTRY_glBitmap] = (void*)glad_glBitmap;
+            glad_glBitmap = counted_glBitmap;
+        }
+        if (glad_glColor3b && glad_glColor3b != counted_glColor3b)
+        {
+            Table<>::loaded[ENTRY_glColor3b] = (void*)glad_glColor3b;
+            glad_glColor3b = counted_glColor3b;
+        }
+        if (glad_glColor3bv && glad_glColor3bv != counted_glColor3bv)
+        {
+            Table<>::loaded[ENTRY_glColor3bv] = (void*)glad_glColor3bv;
+            glad_glColor3bv = counted_glColor3bv;
+        }
+        if (glad_glColor3d && glad_glColor3d != counted_glColor3d)
+        {
+            Table<>::loaded[ENTRY_glColor3d] = (void*)glad_glColor3d;
+            glad_glColor3d = counted_glColor3d;
+        }
+        if (glad_glColor3dv && glad_glColor3dv != counted_glColor3dv)
+        {
+            Table<>::loaded[ENTRY_glColor3dv] = (void*)glad_glColor3dv;
+            glad_glColor3dv = counted_glColor3dv;
+        }
+        if (glad_glColor3f && glad_glColor3f != counted_glColor3f)
+        {
+            Table<>::loaded[ENTRY_glColor3f] = (void*)glad_glColor3f;
+            glad_glColor3f = counted_glColor3f;
+        }
+        if (glad_glColor3fv && glad_glColor3fv != counted_glColor3fv)
+        {
+            Table<>::loaded[ENTRY_glColor3fv] = (void*)glad_glColor3fv;
+            glad_glColor3fv = counted_glColor3fv;
+        }
+        if (glad_glColor3i && glad_glColor3i != counted_glColor3i)
+        {
+            Table<>::loaded[ENTRY_glColor3i] = (void*)glad_glColor3i;
+            glad_glColor3i = counted_glColor3i;
+        }
+        if (glad_glColor3iv && glad_glColor3iv != counted_glColor3iv)
+        {
+            Table<>::loaded[ENTRY_glColor3iv] = (void*)glad_glColor3iv;
+            glad_glColor3iv = counted_glColor3iv;
+        }
+        if (glad_glColor3s && glad_glColor3s != counted_glColor3s)
+        {
+            Table<>::loaded[ENTRY_glColor3s] = (void*)glad_glColor3s;
+            glad_glColor3s = counted_glColor3s;
+        }
+        if (glad_glColor3sv && glad_glColor3sv != counted_glColor3sv)
+        {
+            Table<>::loaded[ENTRY_glColor3sv] = (void*)glad_glColor3sv;
+            glad_glColor3sv = counted_glColor3sv;
+        }
+        if (glad_glColor3ub && glad_glColor3ub != counted_glColor3ub)
+        {
+            Table<>::loaded[ENTRY_glColor3ub] = (void*)glad_glColor3ub;
+            glad_glColor3ub = counted_glColor3ub;
+        }
+        if (glad_glColor3ubv && glad_glColor3ubv != counted_glColor3ubv)
+        {
+            Table<>::loaded[ENTRY_glColor3ubv] = (void*)glad_glColor3ubv;
+            glad_glColor3ubv = counted_glColor3ubv;
+        }
+        if (glad_glColor3ui && glad_glColor3ui != counted_glColor3ui)
+        {
+            Table<>::loaded[ENTRY_glColor3ui] = (void*)glad_glColor3ui;
+            glad_glColor3ui = counted_glColor3ui;
+        }
+        if (glad_glColor3uiv && glad_glColor3uiv != counted_glColor3uiv)
+        {
+            Table<>::loaded[ENTRY_glColor3uiv] = (void*)glad_glColor3uiv;
+            glad_glColor3uiv = counted_glColor3uiv;
+        }
+        if (glad_glColor3us && glad_glColor3us != counted_glColor3us)
+        {
+            Table<>::loaded[ENTRY_glColor3us] = (void*)glad_glColor3us;
+            glad_glColor3us = counted_glColor3us;
+        }
+        if (glad_glColor3usv && glad_glColor3usv != counted_glColor3usv)
+        {
+            Table<>::loaded[ENTRY_glColor3usv] = (void*)glad_glColor3usv;
+            glad_glColor3usv = counted_glColor3usv;
+        }
+        if (glad_glColor4b && glad_glColor4b != counted_glColor4b)
+        {
+            Table<>::loaded[ENTRY_glColor4b] = (void*)glad_glColor4b;
+            glad_glColor4b = counted_glColor4b;
+        }
+        if (glad_glColor4bv && glad_glColor4bv != counted_glColor4bv)
+        {
+            Table<>::loaded[ENTRY_glColor4bv] = (void*)glad_glColor4bv;
+            glad_glColor4bv = counted_glColor4bv;
+        }
+        if (glad_glColor4d && glad_glColor4d != counted_glColor4d)
+        {
+            Table<>::loaded[ENTRY_glColor4d] = (void*)glad_glColor4d;
+            glad_glColor4d = counted_glColor4d;
+        }
+        if (glad_glColor4dv && glad_glColor4dv != counted_glColor4dv)
+        {
+            Table<>::loaded[ENTRY_glColor4dv] = (void*)glad_glColor4dv;
+            glad_glColor4dv = counted_glColor4dv;
+        }
+        if (glad_glColor4f && glad_glColor4f != counted_glColor4f)
+        {
+            Table<>::loaded[ENTRY_glColor4f] = (void*)glad_glColor4f;
+            glad_glColor4f = counted_glColor4f;
+        }
+        if (glad_glColor4fv && glad_glColor4fv != counted_glColor4fv)
+        {
+            Table<>::loaded[ENTRY_glColor4fv] = (void*)glad_glColor4fv;
+            glad_glColor4fv = counted_glColor4fv;
+        }
+        if (glad_glColor4i && glad_glColor4i != counted_glColor4i)
+        {
+            Table<>::loaded[ENTRY_glColor4i] = (void*)glad_glColor4i;
+            glad_glColor4i = counted_glColor4i;
+        }
+        if (glad_glColor4iv && glad_glColor4iv != counted_glColor4iv)
+        {
+            Table<>::loaded[ENTRY_glColor4iv] = (void*)glad_glColor4iv;
+            glad_glColor4iv = counted_glColor4iv;
+        }
+        if (glad_glColor4s && glad_glColor4s != counted_glColor4s)
+        {
+            Table<>::loaded[ENTRY_glColor4s] = (void*)glad_glColor4s;
+            glad_glColor4s = counted_glColor4s;
+        }
+        if (glad_glColor4sv && glad_glColor4sv != counted_glColor4sv)
+        {
+            Table<>::loaded[ENTRY_glColor4sv] = (void*)glad_glColor4sv;
+            glad_glColor4sv = counted_glColor4sv;
+        }
+        if (glad_glColor4ub && glad_glColor4ub != counted_glColor4ub)
+        {
+            Table<>::loaded[ENTRY_glColor4ub] = (void*)glad_glColor4ub;
+            glad_glColor4ub = counted_glColor4ub;
+        }
+        if (glad_glColor4ubv && glad_glColor4ubv != counted_glColor4ubv)
+        {
+            Table<>::loaded[ENTRY_glColor4ubv] = (void*)glad_glColor4ubv;
+            glad_glColor4ubv = counted_glColor4ubv;
+        }
+        if (glad_glColor4ui && glad_glColor4ui != counted_glColor4ui)
+        {
+            Table<>::loaded[ENTRY_glColor4ui] = (void*)glad_glColor4ui;
+            glad_glColor4ui = counted_glColor4ui;
+        }
+        if (glad_glColor4uiv && glad_glColor4uiv != counted_glColor4uiv)
+        {
+            Table<>::loaded[ENTRY_glColor4uiv] = (void*)glad_glColor4uiv;
+            glad_glColor4uiv = counted_glColor4uiv;
+        }
+        if (glad_glColor4us && glad_glColor4us != counted_glColor4us)
+        {
+            Table<>::loaded[ENTRY_glColor4us] = (void*)glad_glColor4us;
+            glad_glColor4us = counted_glColor4us;
+        }
+        if (glad_glColor4usv && glad_glColor4usv != counted_glColor4usv)
+        {
+            Table<>::loaded[ENTRY_glColor4usv] = (void*)glad_glColor4usv;
+            glad_glColor4usv = counted_glColor4usv;
+        }
+        if (glad_glEdgeFlag && glad_glEdgeFlag != counted_glEdgeFlag)
+        {
+            Table<>::loaded[ENTRY_glEdgeFlag] = (void*)glad_glEdgeFlag;
+            glad_glEdgeFlag = counted_glEdgeFlag;
+        }
+        if (glad_glEdgeFlagv && glad_glEdgeFlagv != counted_glEdgeFlagv)
+        {
+            Table<>::loaded[ENTRY_glEdgeFlagv] = (void*)glad_glEdgeFlagv;
+            glad_glEdgeFlagv = counted_glEdgeFlagv;
+        }
+        if (glad_glEnd && glad_glEnd != counted_glEnd)
+        {
+            Table<>::loaded[ENTRY_glEnd] = (void*)glad_glEnd;
+            glad_glEnd = counted_glEnd;
+        }
+        if (glad_glIndexd && glad_glIndexd != counted_glIndexd)
+        {
+            Table<>::loaded[ENTRY_glIndexd] = (void*)glad_glIndexd;
+            glad_glIndexd = counted_glIndexd;
+        }
+        if (glad_glIndexdv && glad_glIndexdv != counted_glIndexdv)
+        {
+            Table<>::loaded[ENTRY_glIndexdv] = (void*)glad_glIndexdv;
+            glad_glIndexdv = counted_glIndexdv;
+        }
+        if (glad_glIndexf && glad_glIndexf != counted_glIndexf)
+        {
+            Table<>::loaded[ENTRY_glIndexf] = (void*)glad_glIndexf;
+            glad_glIndexf = counted_glIndexf;
+        }
+        if (glad_glIndexfv && glad_glIndexfv != counted_glIndexfv)
+        {
+            Table<>::loaded[ENTRY_glIndexfv] = (void*)glad_glIndexfv;
+            glad_glIndexfv = counted_glIndexfv;
+        }
+        if (glad_glIndexi && glad_glIndexi != counted_glIndexi)
+        {
+            Table<>::loaded[ENTRY_glIndexi] = (void*)glad_glIndexi;
+            glad_glIndexi = counted_glIndexi;
+        }
+        if (glad_glIndexiv && glad_glIndexiv != counted_glIndexiv)
+        {
+            Table<>::loaded[ENTRY_glIndexiv] = (void*)glad_glIndexiv;
+            glad_glIndexiv = counted_glIndexiv;
+        }
+        if (glad_glIndexs && glad_glIndexs != counted_glIndexs)
+        {
+            Table<>::loaded[ENTRY_glIndexs] = (void*)glad_glIndexs;
+            glad_glIndexs = counted_glIndexs;
+        }
+        if (glad_glIndexsv && glad_glIndexsv != counted_glIndexsv)
+        {
+            Table<>::loaded[ENTRY_glIndexsv] = (void*)glad_glIndexsv;
+            glad_glIndexsv = counted_glIndexsv;
+        }
+        if (glad_glNormal3b && glad_glNormal3b != counted_glNormal3b)
+        {
+            Table<>::loaded[ENTRY_glNormal3b] = (void*)glad_glNormal3b;
+            glad_glNormal3b = counted_glNormal3b;
+        }
+        if (glad_glNormal3bv && glad_glNormal3bv != counted_glNormal3bv)
+        {
+            Table<>::loaded[ENTRY_glNormal3bv] = (void*)glad_glNormal3bv;
+            glad_glNormal3bv = counted_glNormal3bv;
+        }
+        if (glad_glNormal3d && glad_glNormal3d != counted_glNormal3d)
+        {
+            Table<>::loaded[ENTRY_glNormal3d] = (void*)glad_glNormal3d;
+            glad_glNormal3d = counted_glNormal3d;
+        }
+        if (glad_glNormal3dv && glad_glNormal3dv != counted_glNormal3dv)
+        {
+            Table<>::loaded[ENTRY_glNormal3dv] = (void*)glad_glNormal3dv;
+            glad_glNormal3dv = counted_glNormal3dv;
+        }
+        if (glad_glNormal3f && glad_glNormal3f != counted_glNormal3f)
+        {
+            Table<>::loaded[ENTRY_glNormal3f] = (void*)glad_glNormal3f;
+            glad_glNormal3f = counted_glNormal3f;
+        }
+        if (glad_glNormal3fv && glad_glNormal3fv != counted_glNormal3fv)
+        {
+            Table<>::loaded[ENTRY_glNormal3fv] = (void*)glad_glNormal3fv;
+            glad_glNormal3fv = counted_glNormal3fv;
+        }
+        if (glad_glNormal3i && glad_glNormal3i != counted_glNormal3i)
+        {
+            Table<>::loaded[ENTRY_glNormal3i] = (void*)glad_glNormal3i;
+            glad_glNormal3i = counted_glNormal3i;
+        }
+        if (glad_glNormal3iv && glad_glNormal3iv != counted_glNormal3iv)
+        {
+            Table<>::loaded[ENTRY_glNormal3iv] = (void*)glad_glNormal3iv;
+            glad_glNormal3iv = counted_glNormal3iv;
+        }
+        if (glad_glNormal3s && glad_glNormal3s != counted_glNormal3s)
+        {
+            Table<>::loaded[ENTRY_glNormal3s] = (void*)glad_glNormal3s;
+            glad_glNormal3s = counted_glNormal3s;
+        }
+        if (glad_glNormal3sv && glad_glNormal3sv != counted_glNormal3sv)
+        {
+            Table<>::loaded[ENTRY_glNormal3sv] = (void*)glad_glNormal3sv;
+            glad_glNormal3sv = counted_glNormal3sv;
+        }
+        if (glad_glRasterPos2d && glad_glRasterPos2d != counted_glRasterPos2d)
+        {
+            Table<>::loaded[ENTRY_glRasterPos2d] = (void*)glad_glRasterPos2d;
+            glad_glRasterPos2d = counted_glRasterPos2d;
+        }
+        if (glad_glRasterPos2dv && glad_glRasterPos2dv != counted_glRasterPos2dv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos2dv] = (void*)glad_glRasterPos2dv;
+            glad_glRasterPos2dv = counted_glRasterPos2dv;
+        }
+        if (glad_glRasterPos2f && glad_glRasterPos2f != counted_glRasterPos2f)
+        {
+            Table<>::loaded[ENTRY_glRasterPos2f] = (void*)glad_glRasterPos2f;
+            glad_glRasterPos2f = counted_glRasterPos2f;
+        }
+        if (glad_glRasterPos2fv && glad_glRasterPos2fv != counted_glRasterPos2fv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos2fv] = (void*)glad_glRasterPos2fv;
+            glad_glRasterPos2fv = counted_glRasterPos2fv;
+        }
+        if (glad_glRasterPos2i && glad_glRasterPos2i != counted_glRasterPos2i)
+        {
+            Table<>::loaded[ENTRY_glRasterPos2i] = (void*)glad_glRasterPos2i;
+            glad_glRasterPos2i = counted_glRasterPos2i;
+        }
+        if (glad_glRasterPos2iv && glad_glRasterPos2iv != counted_glRasterPos2iv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos2iv] = (void*)glad_glRasterPos2iv;
+            glad_glRasterPos2iv = counted_glRasterPos2iv;
+        }
+        if (glad_glRasterPos2s && glad_glRasterPos2s != counted_glRasterPos2s)
+        {
+            Table<>::loaded[ENTRY_glRasterPos2s] = (void*)glad_glRasterPos2s;
+            glad_glRasterPos2s = counted_glRasterPos2s;
+        }
+        if (glad_glRasterPos2sv && glad_glRasterPos2sv != counted_glRasterPos2sv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos2sv] = (void*)glad_glRasterPos2sv;
+            glad_glRasterPos2sv = counted_glRasterPos2sv;
+        }
+        if (glad_glRasterPos3d && glad_glRasterPos3d != counted_glRasterPos3d)
+        {
+            Table<>::loaded[ENTRY_glRasterPos3d] = (void*)glad_glRasterPos3d;
+            glad_glRasterPos3d = counted_glRasterPos3d;
+        }
+        if (glad_glRasterPos3dv && glad_glRasterPos3dv != counted_glRasterPos3dv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos3dv] = (void*)glad_glRasterPos3dv;
+            glad_glRasterPos3dv = counted_glRasterPos3dv;
+        }
+        if (glad_glRasterPos3f && glad_glRasterPos3f != counted_glRasterPos3f)
+        {
+            Table<>::loaded[ENTRY_glRasterPos3f] = (void*)glad_glRasterPos3f;
+            glad_glRasterPos3f = counted_glRasterPos3f;
+        }
+        if (glad_glRasterPos3fv && glad_glRasterPos3fv != counted_glRasterPos3fv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos3fv] = (void*)glad_glRasterPos3fv;
+            glad_glRasterPos3fv = counted_glRasterPos3fv;
+        }
+        if (glad_glRasterPos3i && glad_glRasterPos3i != counted_glRasterPos3i)
+        {
+            Table<>::loaded[ENTRY_glRasterPos3i] = (void*)glad_glRasterPos3i;
+            glad_glRasterPos3i = counted_glRasterPos3i;
+        }
+        if (glad_glRasterPos3iv && glad_glRasterPos3iv != counted_glRasterPos3iv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos3iv] = (void*)glad_glRasterPos3iv;
+            glad_glRasterPos3iv = counted_glRasterPos3iv;
+        }
+        if (glad_glRasterPos3s && glad_glRasterPos3s != counted_glRasterPos3s)
+        {
+            Table<>::loaded[ENTRY_glRasterPos3s] = (void*)glad_glRasterPos3s;
+            glad_glRasterPos3s = counted_glRasterPos3s;
+        }
+        if (glad_glRasterPos3sv && glad_glRasterPos3sv != counted_glRasterPos3sv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos3sv] = (void*)glad_glRasterPos3sv;
+            glad_glRasterPos3sv = counted_glRasterPos3sv;
+        }
+        if (glad_glRasterPos4d && glad_glRasterPos4d != counted_glRasterPos4d)
+        {
+            Table<>::loaded[ENTRY_glRasterPos4d] = (void*)glad_glRasterPos4d;
+            glad_glRasterPos4d = counted_glRasterPos4d;
+        }
+        if (glad_glRasterPos4dv && glad_glRasterPos4dv != counted_glRasterPos4dv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos4dv] = (void*)glad_glRasterPos4dv;
+            glad_glRasterPos4dv = counted_glRasterPos4dv;
+        }
+        if (glad_glRasterPos4f && glad_glRasterPos4f != counted_glRasterPos4f)
+        {
+            Table<>::loaded[ENTRY_glRasterPos4f] = (void*)glad_glRasterPos4f;
+            glad_glRasterPos4f = counted_glRasterPos4f;
+        }
+        if (glad_glRasterPos4fv && glad_glRasterPos4fv != counted_glRasterPos4fv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos4fv] = (void*)glad_glRasterPos4fv;
+            glad_glRasterPos4fv = counted_glRasterPos4fv;
+        }
+        if (glad_glRasterPos4i && glad_glRasterPos4i != counted_glRasterPos4i)
+        {
+            Table<>::loaded[ENTRY_glRasterPos4i] = (void*)glad_glRasterPos4i;
+            glad_glRasterPos4i = counted_glRasterPos4i;
+        }
+        if (glad_glRasterPos4iv && glad_glRasterPos4iv != counted_glRasterPos4iv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos4iv] = (void*)glad_glRasterPos4iv;
+            glad_glRasterPos4iv = counted_glRasterPos4iv;
+        }
+        if (glad_glRasterPos4s && glad_glRasterPos4s != counted_glRasterPos4s)
+        {
+            Table<>::loaded[ENTRY_glRasterPos4s] = (void*)glad_glRasterPos4s;
+            glad_glRasterPos4s = counted_glRasterPos4s;
+        }
+        if (glad_glRasterPos4sv && glad_glRasterPos4sv != counted_glRasterPos4sv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos4sv] = (void*)glad_glRasterPos4sv;
+            glad_glRasterPos4sv = counted_glRasterPos4sv;
+        }
+        if (glad_glRectd && glad_glRectd != counted_glRectd)
+        {
+            Table<>::loaded[ENTRY_glRectd] = (void*)glad_glRectd;
+            glad_glRectd = counted_glRectd;
+        }
+        if (glad_glRectdv && glad_glRectdv != counted_glRectdv)
+        {
+            Table<>::loaded[ENTRY_glRectdv] = (void*)glad_glRectdv;
+            glad_glRectdv = counted_glRectdv;
+        }
+        if (glad_glRectf && glad_glRectf != counted_glRectf)
+        {
+            Table<>::loaded[ENTRY_glRectf] = (void*)glad_glRectf;
+            glad_glRectf = counted_glRectf;
+        }
+        if (glad_glRectfv && glad_glRectfv != counted_glRectfv)
+        {
+            Table<>::loaded[ENTRY_glRectfv] = (void*)glad_glRectfv;
+            glad_glRectfv = counted_glRectfv;
+        }
+        if (glad_glRecti && glad_glRecti != counted_glRecti)
+        {
+            Table<>::loaded[ENTRY_glRecti] = (void*)glad_glRecti;
+            glad_glRecti = counted_glRecti;
+        }
+        if (glad_glRectiv && glad_glRectiv != counted_glRectiv)
+        {
+            Table<>::loaded[ENTRY_glRectiv] = (void*)glad_glRectiv;
+            glad_glRectiv = counted_glRectiv;
+        }
+        if (glad_glRects && glad_glRects != counted_glRects)
+        {
+            Table<>::loaded[ENTRY_glRects] = (void*)glad_glRects;
+            glad_glRects = counted_glRects;
+        }
+        if (glad_glRectsv && glad_glRectsv != counted_glRectsv)
+        {
+            Table<>::loaded[ENTRY_glRectsv] = (void*)glad_glRectsv;
+            glad_glRectsv = counted_glRectsv;
+        }
+        if (glad_glTexCoord1d && glad_glTexCoord1d != counted_glTexCoord1d)
+        {
+            Table<>::loaded[ENTRY_glTexCoord1d] = (void*)glad_glTexCoord1d;
+            glad_glTexCoord1d = counted_glTexCoord1d;
+        }
+        if (glad_glTexCoord1dv && glad_glTexCoord1dv != counted_glTexCoord1dv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord1dv] = (void*)glad_glTexCoord1dv;
+            glad_glTexCoord1dv = counted_glTexCoord1dv;
+        }
+        if (glad_glTexCoord1f && glad_glTexCoord1f != counted_glTexCoord1f)
+        {
+            Table<>::loaded[ENTRY_glTexCoord1f] = (void*)glad_glTexCoord1f;
+            glad_glTexCoord1f = counted_glTexCoord1f;
+        }
+        if (glad_glTexCoord1fv && glad_glTexCoord1fv != counted_glTexCoord1fv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord1fv] = (void*)glad_glTexCoord1fv;
+            glad_glTexCoord1fv = counted_glTexCoord1fv;
+        }
+        if (glad_glTexCoord1i && glad_glTexCoord1i != counted_glTexCoord1i)
+        {
+            Table<>::loaded[ENTRY_glTexCoord1i] = (void*)glad_glTexCoord1i;
+            glad_glTexCoord1i = counted_glTexCoord1i;
+        }
+        if (glad_glTexCoord1iv && glad_glTexCoord1iv != counted_glTexCoord1iv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord1iv] = (void*)glad_glTexCoord1iv;
+            glad_glTexCoord1iv = counted_glTexCoord1iv;
+        }
+        if (glad_glTexCoord1s && glad_glTexCoord1s != counted_glTexCoord1s)
+        {
+            Table<>::loaded[ENTRY_glTexCoord1s] = (void*)glad_glTexCoord1s;
+            glad_glTexCoord1s = counted_glTexCoord1s;
+        }
+        if (glad_glTexCoord1sv && glad_glTexCoord1sv != counted_glTexCoord1sv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord1sv] = (void*)glad_glTexCoord1sv;
+            glad_glTexCoord1sv = counted_glTexCoord1sv;
+        }
+        if (glad_glTexCoord2d && glad_glTexCoord2d != counted_glTexCoord2d)
+        {
+            Table<>::loaded[ENTRY_glTexCoord2d] = (void*)glad_glTexCoord2d;
+            glad_glTexCoord2d = counted_glTexCoord2d;
+        }
+        if (glad_glTexCoord2dv && glad_glTexCoord2dv != counted_glTexCoord2dv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord2dv] = (void*)glad_glTexCoord2dv;
+            glad_glTexCoord2dv = counted_glTexCoord2dv;
+        }
+        if (glad_glTexCoord2f && glad_glTexCoord2f != counted_glTexCoord2f)
+        {
+            Table<>::loaded[ENTRY_glTexCoord2f] = (void*)glad_glTexCoord2f;
+            glad_glTexCoord2f = counted_glTexCoord2f;
+        }
+        if (glad_glTexCoord2fv && glad_glTexCoord2fv != counted_glTexCoord2fv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord2fv] = (void*)glad_glTexCoord2fv;
+            glad_glTexCoord2fv = counted_glTexCoord2fv;
+        }
+        if (glad_glTexCoord2i && glad_glTexCoord2i != counted_glTexCoord2i)
+        {
+            Table<>::loaded[ENTRY_glTexCoord2i] = (void*)glad_glTexCoord2i;
+            glad_glTexCoord2i = counted_glTexCoord2i;
+        }
+        if (glad_glTexCoord2iv && glad_glTexCoord2iv != counted_glTexCoord2iv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord2iv] = (void*)glad_glTexCoord2iv;
+            glad_glTexCoord2iv = counted_glTexCoord2iv;
+        }
+        if (glad_glTexCoord2s && glad_glTexCoord2s != counted_glTexCoord2s)
+        {
+            Table<>::loaded[ENTRY_glTexCoord2s] = (void*)glad_glTexCoord2s;
+            glad_glTexCoord2s = counted_glTexCoord2s;
+        }
+        if (glad_glTexCoord2sv && glad_glTexCoord2sv != counted_glTexCoord2sv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord2sv] = (void*)glad_glTexCoord2sv;
+            glad_glTexCoord2sv = counted_glTexCoord2sv;
+        }
+        if (glad_glTexCoord3d && glad_glTexCoord3d != counted_glTexCoord3d)
+        {
+            Table<>::loaded[ENTRY_glTexCoord3d] = (void*)glad_glTexCoord3d;
+            glad_glTexCoord3d = counted_glTexCoord3d;
+        }
+        if (glad_glTexCoord3dv && glad_glTexCoord3dv != counted_glTexCoord3dv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord3dv] = (void*)glad_glTexCoord3dv;
+            glad_glTexCoord3dv = counted_glTexCoord3dv;
+        }
+        if (glad_glTexCoord3f && glad_glTexCoord3f != counted_glTexCoord3f)
+        {
+            Table<>::loaded[ENTRY_glTexCoord3f] = (void*)glad_glTexCoord3f;
+            glad_glTexCoord3f = counted_glTexCoord3f;
+        }
+        if (glad_glTexCoord3fv && glad_glTexCoord3fv != counted_glTexCoord3fv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord3fv] = (void*)glad_glTexCoord3fv;
+            glad_glTexCoord3fv = counted_glTexCoord3fv;
+        }
+        if (glad_glTexCoord3i && glad_glTexCoord3i != counted_glTexCoord3i)
+        {
+            Table<>::loaded[ENTRY_glTexCoord3i] = (void*)glad_glTexCoord3i;
+            glad_glTexCoord3i = counted_glTexCoord3i;
+        }
+        if (glad_glTexCoord3iv && glad_glTexCoord3iv != counted_glTexCoord3iv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord3iv] = (void*)glad_glTexCoord3iv;
+            glad_glTexCoord3iv = counted_glTexCoord3iv;
+        }
+        if (glad_glTexCoord3s && glad_glTexCoord3s != counted_glTexCoord3s)
+        {
+            Table<>::loaded[ENTRY_glTexCoord3s] = (void*)glad_glTexCoord3s;
+            glad_glTexCoord3s = counted_glTexCoord3s;
+        }
+        if (glad_glTexCoord3sv && glad_glTexCoord3sv != counted_glTexCoord3sv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord3sv] = (void*)glad_glTexCoord3sv;
+            glad_glTexCoord3sv = counted_glTexCoord3sv;
+        }
+        if (glad_glTexCoord4d && glad_glTexCoord4d != counted_glTexCoord4d)
+        {
+            Table<>::loaded[ENTRY_glTexCoord4d] = (void*)glad_glTexCoord4d;
+            glad_glTexCoord4d = counted_glTexCoord4d;
+        }
+        if (glad_glTexCoord4dv && glad_glTexCoord4dv != counted_glTexCoord4dv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord4dv] = (void*)glad_glTexCoord4dv;
+            glad_glTexCoord4dv = counted_glTexCoord4dv;
+        }
+        if (glad_glTexCoord4f && glad_glTexCoord4f != counted_glTexCoord4f)
+        {
+            Table<>::loaded[ENTRY_glTexCoord4f] = (void*)glad_glTexCoord4f;
+            glad_glTexCoord4f = counted_glTexCoord4f;
+        }
+        if (glad_glTexCoord4fv && glad_glTexCoord4fv != counted_glTexCoord4fv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord4fv] = (void*)glad_glTexCoord4fv;
+            glad_glTexCoord4fv = counted_glTexCoord4fv;
+        }
+        if (glad_glTexCoord4i && glad_glTexCoord4i != counted_glTexCoord4i)
+        {
+            Table<>::loaded[ENTRY_glTexCoord4i] = (void*)glad_glTexCoord4i;
+            glad_glTexCoord4i = counted_glTexCoord4i;
+        }
+        if (glad_glTexCoord4iv && glad_glTexCoord4iv != counted_glTexCoord4iv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord4iv] = (void*)glad_glTexCoord4iv;
+            glad_glTexCoord4iv = counted_glTexCoord4iv;
+        }
+        if (glad_glTexCoord4s && glad_glTexCoord4s != counted_glTexCoord4s)
+        {
+            Table<>::loaded[ENTRY_glTexCoord4s] = (void*)glad_glTexCoord4s;
+            glad_glTexCoord4s = counted_glTexCoord4s;
+        }
+        if (glad_glTexCoord4sv && glad_glTexCoord4sv != counted_glTexCoord4sv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord4sv] = (void*)glad_glTexCoord4sv;
+            glad_glTexCoord4sv = counted_glTexCoord4sv;
+        }
+        if (glad_glVertex2d && glad_glVertex2d != counted_glVertex2d)
+        {
+            Table<>::loaded[ENTRY_glVertex2d] = (void*)glad_glVertex2d;
+            glad_glVertex2d = counted_glVertex2d;
+        }
+        if (glad_glVertex2dv && glad_glVertex2dv != counted_glVertex2dv)
+        {
+            Table<>::loaded[ENTRY_glVertex2dv] = (void*)glad_glVertex2dv;
+            glad_glVertex2dv = counted_glVertex2dv;
+        }
+        if (glad_glVertex2f && glad_glVertex2f != counted_glVertex2f)
+        {
+            Table<>::loaded[ENTRY_glVertex2f] = (void*)glad_glVertex2f;
+            glad_glVertex2f = counted_glVertex2f;
+        }
+        if (glad_glVertex2fv && glad_glVertex2fv != counted_glVertex2fv)
+        {
+            Table<>::loaded[ENTRY_glVertex2fv] = (void*)glad_glVertex2fv;
+            glad_glVertex2fv = counted_glVertex2fv;
+        }
+        if (glad_glVertex2i && glad_glVertex2i != counted_glVertex2i)
+        {
+            Table<>::loaded[ENTRY_glVertex2i] = (void*)glad_glVertex2i;
+            glad_glVertex2i = counted_glVertex2i;
+        }
+        if (glad_glVertex2iv && glad_glVertex2iv != counted_glVertex2iv)
+        {
+            Table<>::loaded[ENTRY_glVertex2iv] = (void*)glad_glVertex2iv;
+            glad_glVertex2iv = counted_glVertex2iv;
+        }
+        if (glad_glVertex2s && glad_glVertex2s != counted_glVertex2s)
+        {
+            Table<>::loaded[ENTRY_glVertex2s] = (void*)glad_glVertex2s;
+            glad_glVertex2s = counted_glVertex2s;
+        }
+        if (glad_glVertex2sv && glad_glVertex2sv != counted_glVertex2sv)
+        {
+            Table<>::loaded[ENTRY_glVertex2sv] = (void*)glad_glVertex2sv;
+            glad_glVertex2sv = counted_glVertex2sv;
+        }
+        if (glad_glVertex3d && glad_glVertex3d != counted_glVertex3d)
+        {
+            Table<>::loaded[ENTRY_glVertex3d] = (void*)glad_glVertex3d;
+            glad_glVertex3d = counted_glVertex3d;
+        }
+        if (glad_glVertex3dv && glad_glVertex3dv != counted_glVertex3dv)
+        {
+            Table<>::loaded[ENTRY_glVertex3dv] = (void*)glad_glVertex3dv;
+            glad_glVertex3dv = counted_glVertex3dv;
+        }
+        if (glad_glVertex3f && glad_glVertex3f != counted_glVertex3f)
+        {
+            Table<>::loaded[ENTRY_glVertex3f] = (void*)glad_glVertex3f;
+            glad_glVertex3f = counted_glVertex3f;
+        }
+        if (glad_glVertex3fv && glad_glVertex3fv != counted_glVertex3fv)
+        {
+            Table<>::loaded[ENTRY_glVertex3fv] = (void*)glad_glVertex3fv;
+            glad_glVertex3fv = counted_glVertex3fv;
+        }
+        if (glad_glVertex3i && glad_glVertex3i != counted_glVertex3i)
+        {
+            Table<>::loaded[ENTRY_glVertex3i] = (void*)glad_glVertex3i;
+            glad_glVertex3i = counted_glVertex3i;
+        }
+        if (glad_glVertex3iv && glad_glVertex3iv != counted_glVertex3iv)
+        {
+            Table<>::loaded[ENTRY_glVertex3iv] = (void*)glad_glVertex3iv;
+            glad_glVertex3iv = counted_glVertex3iv;
+        }
+        if (glad_glVertex3s && glad_glVertex3s != counted_glVertex3s)
+        {
+            Table<>::loaded[ENTRY_glVertex3s] = (void*)glad_glVertex3s;
+            glad_glVertex3s = counted_glVertex3s;
+        }
+        if (glad_glVertex3sv && glad_glVertex3sv != counted_glVertex3sv)
+        {
+            Table<>::loaded[ENTRY_glVertex3sv] = (void*)glad_glVertex3sv;
+            glad_glVertex3sv = counted_glVertex3sv;
+        }
+        if (glad_glVertex4d && glad_glVertex4d != counted_glVertex4d)
+        {
+            Table<>::loaded[ENTRY_glVertex4d] = (void*)glad_glVertex4d;
+            glad_glVertex4d = counted_glVertex4d;
+        }
+        if (glad_glVertex4dv && glad_glVertex4dv != counted_glVertex4dv)
+        {
+            Table<>::loaded[ENTRY_glVertex4dv] = (void*)glad_glVertex4dv;
+            glad_glVertex4dv = counted_glVertex4dv;
+        }
+        if (glad_glVertex4f && glad_glVertex4f != counted_glVertex4f)
+        {
+            Table<>::loaded[ENTRY_glVertex4f] = (void*)glad_glVertex4f;
+            glad_glVertex4f = counted_glVertex4f;
+        }
+        if (glad_glVertex4fv && glad_glVertex4fv != counted_glVertex4fv)
+        {
+            Table<>::loaded[ENTRY_glVertex4fv] = (void*)glad_glVertex4fv;
+            glad_glVertex4fv = counted_glVertex4fv;
+        }
+        if (glad_glVertex4i && glad_glVertex4i != counted_glVertex4i)
+        {
+            Table<>::loaded[ENTRY_glVertex4i] = (void*)glad_glVertex4i;
+            glad_glVertex4i = counted_glVertex4i;
+        }
+        if (glad_glVertex4iv && glad_glVertex4iv != counted_glVertex4iv)
+        {
+            Table<>::loaded[ENTRY_glVertex4iv] = (void*)glad_glVertex4iv;
+            glad_glVertex4iv = counted_glVertex4iv;
+        }
+        if (glad_glVertex4s && glad_glVertex4s != counted_glVertex4s)
+        {
+            Table<>::loaded[ENTRY_glVertex4s] = (void*)glad_glVertex4s;
+            glad_glVertex4s = counted_glVertex4s;
+        }
+        if (glad_glVertex4sv && glad_glVertex4sv != counted_glVertex4sv)
+        {
+            Table<>::loaded[ENTRY_glVertex4sv] = (void*)glad_glVertex4sv;
+            glad_glVertex4sv = counted_glVertex4sv;
+        }
+        if (glad_glClipPlane && glad_glClipPlane != counted_glClipPlane)
+        {
+            Table<>::loaded[ENTRY_glClipPlane] = (void*)glad_glClipPlane;
+            glad_glClipPlane = counted_glClipPlane;
+        }
+        if (glad_glColorMaterial && glad_glColorMaterial != counted_glColorMaterial)
+        {
+            Table<>::loaded[ENTRY_glColorMaterial] = (void*)glad_glColorMaterial;
+            glad_glColorMaterial = counted_glColorMaterial;
+        }
+        if (glad_glFogf && glad_glFogf != counted_glFogf)
+        {
+            Table<>::loaded[ENTRY_glFogf] = (void*)glad_glFogf;
+            glad_glFogf = counted_glFogf;
+        }
+        if (glad_glFogfv && glad_glFogfv != counted_glFogfv)
+        {
+            Table<>::loaded[ENTRY_glFogfv] = (void*)glad_glFogfv;
+            glad_glFogfv = counted_glFogfv;
+        }
+        if (glad_glFogi && glad_glFogi != counted_glFogi)
+        {
+            Table<>::loaded[ENTRY_glFogi] = (void*)glad_glFogi;
+            glad_glFogi = counted_glFogi;
+        }
+        if (glad_glFogiv && glad_glFogiv != counted_glFogiv)
+        {
+            Table<>::loaded[ENTRY_glFogiv] = (void*)glad_glFogiv;
+            glad_glFogiv = counted_glFogiv;
+        }
+        if (glad_glLightf && glad_glLightf != counted_glLightf)
+        {
+            Table<>::loaded[ENTRY_glLightf] = (void*)glad_glLightf;
+            glad_glLightf = counted_glLightf;
+        }
+        if (glad_glLightfv && glad_glLightfv != counted_glLightfv)
+        {
+            Table<>::loaded[ENTRY_glLightfv] = (void*)glad_glLightfv;
+            glad_glLightfv = counted_glLightfv;
+        }
+        if (glad_glLighti && glad_glLighti != counted_glLighti)
+        {
+            Table<>::loaded[ENTRY_glLighti] = (void*)glad_glLighti;
+            glad_glLighti = counted_glLighti;
+        }
+        if (glad_glLightiv && glad_glLightiv != counted_glLightiv)
+        {
+            Table<>::loaded[ENTRY_glLightiv] = (void*)glad_glLightiv;
+            glad_glLightiv = counted_glLightiv;
+        }
+        if (glad_glLightModelf && glad_glLightModelf != counted_glLightModelf)
+        {
+            Table<>::loaded[ENTRY_glLightModelf] = (void*)glad_glLightModelf;
+            glad_glLightModelf = counted_glLightModelf;
+        }
+        if (glad_glLightModelfv && glad_glLightModelfv != counted_glLightModelfv)
+        {
+            Table<>::loaded[ENTRY_glLightModelfv] = (void*)glad_glLightModelfv;
+            glad_glLightModelfv = counted_glLightModelfv;
+        }
+        if (glad_glLightModeli && glad_glLightModeli != counted_glLightModeli)
+        {
+            Table<>::loaded[ENTRY_glLightModeli] = (void*)glad_glLightModeli;
+            glad_glLightModeli = counted_glLightModeli;
+        }
+        if (glad_glLightModeliv && glad_glLightModeliv != counted_glLightModeliv)
+        {
+            Table<>::loaded[ENTRY_glLightModeliv] = (void*)glad_glLightModeliv;
+            glad_glLightModeliv = counted_glLightModeliv;
+        }
+        if (glad_glLineStipple && glad_glLineStipple != counted_glLineStipple)
+        {
+            Table<>::loaded[ENTRY_glLineStipple] = (void*)glad_glLineStipple;
+            glad_glLineStipple = counted_glLineStipple;
+        }
+        if (glad_glMaterialf && glad_glMaterialf != counted_glMaterialf)
+        {
+            Table<>::loaded[ENTRY_glMaterialf] = (void*)glad_glMaterialf;
+            glad_glMaterialf = counted_glMaterialf;
+        }
+        if (glad_glMaterialfv && glad_glMaterialfv != counted_glMaterialfv)
+        {
+            Table<>::loaded[ENTRY_glMaterialfv] = (void*)glad_glMaterialfv;
+            glad_glMaterialfv = counted_glMaterialfv;
+        }
+        if (glad_glMateriali && glad_glMateriali != counted_glMateriali)
+        {
+            Table<>::loaded[ENTRY_glMateriali] = (void*)glad_glMateriali;
+            glad_glMateriali = counted_glMateriali;
+        }
+        if (glad_glMaterialiv && glad_glMaterialiv != counted_glMaterialiv)
+        {
+            Table<>::loaded[ENTRY_glMaterialiv] = (void*)glad_glMaterialiv;
+            glad_glMaterialiv = counted_glMaterialiv;
+        }
+        if (glad_glPolygonStipple && glad_glPolygonStipple != counted_glPolygonStipple)
+        {
+            Table<>::loaded[ENTRY_glPolygonStipple] = (void*)glad_glPolygonStipple;
+            glad_glPolygonStipple = counted_glPolygonStipple;
+        }
+        if (glad_glShadeModel && glad_glShadeModel != counted_glShadeModel)
+        {
+            Table<>::loaded[ENTRY_glShadeModel] = (void*)glad_glShadeModel;
+            glad_glShadeModel = counted_glShadeModel;
+        }
+        if (glad_glTexEnvf && glad_glTexEnvf != counted_glTexEnvf)
+        {
+            Table<>::loaded[ENTRY_glTexEnvf] = (void*)glad_glTexEnvf;
+            glad_glTexEnvf = counted_glTexEnvf;
+        }
+        if (glad_glTexEnvfv && glad_glTexEnvfv != counted_glTexEnvfv)
+        {
+            Table<>::loaded[ENTRY_glTexEnvfv] = (void*)glad_glTexEnvfv;
+            glad_glTexEnvfv = counted_glTexEnvfv;
+        }
+        if (glad_glTexEnvi && glad_glTexEnvi != counted_glTexEnvi)
+        {
+            Table<>::loaded[ENTRY_glTexEnvi] = (void*)glad_glTexEnvi;
+            glad_glTexEnvi = counted_glTexEnvi;
+        }
+        if (glad_glTexEnviv && glad_glTexEnviv != counted_glTexEnviv)
+        {
+            Table<>::loaded[ENTRY_glTexEnviv] = (void*)glad_glTexEnviv;
+            glad_glTexEnviv = counted_glTexEnviv;
+        }
+        if (glad_glTexGend && glad_glTexGend != counted_glTexGend)
+        {
+            Table<>::loaded[ENTRY_glTexGend] = (void*)glad_glTexGend;
+            glad_glTexGend = counted_glTexGend;
+        }
+        if (glad_glTexGendv && glad_glTexGendv != counted_glTexGendv)
+        {
+            Table<>::loaded[ENTRY_glTexGendv] = (void*)glad_glTexGendv;
+            glad_glTexGendv = counted_glTexGendv;
+        }
+        if (glad_glTexGenf && glad_glTexGenf != counted_glTexGenf)
+        {
+            Table<>::loaded[ENTRY_glTexGenf] = (void*)glad_glTexGenf;
+            glad_glTexGenf = counted_glTexGenf;
+        }
+        if (glad_glTexGenfv && glad_glTexGenfv != counted_glTexGenfv)
+        {
+            Table<>::loaded[ENTRY_glTexGenfv] = (void*)glad_glTexGenfv;
+            glad_glTexGenfv = counted_glTexGenfv;
+        }
+        if (glad_glTexGeni && glad_glTexGeni != counted_glTexGeni)
+        {
+            Table<>::loaded[ENTRY_glTexGeni] = (void*)glad_glTexGeni;
+            glad_glTexGeni = counted_glTexGeni;
+        }
+        if (glad_glTexGeniv && glad_glTexGeniv != counted_glTexGeniv)
+        {
+            Table<>::loaded[ENTRY_glTexGeniv] = (void*)glad_glTexGeniv;
+            glad_glTexGeniv = counted_glTexGeniv;
+        }
+        if (glad_glFeedbackBuffer && glad_glFeedbackBuffer != counted_glFeedbackBuffer)
+        {
+            Table<>::loaded[ENTRY_glFeedbackBuffer] = (void*)glad_glFeedbackBuffer;
+            glad_glFeedbackBuffer = counted_glFeedbackBuffer;
+        }
+        if (glad_glSelectBuffer && glad_glSelectBuffer != counted_glSelectBuffer)
+        {
+            Table<>::loaded[ENTRY_glSelectBuffer] = (void*)glad_glSelectBuffer;
+            glad_glSelectBuffer = counted_glSelectBuffer;
+        }
+        if (glad_glRenderMode && glad_glRenderMode != counted_glRenderMode)
+        {
+            Table<>::loaded[ENTRY_glRenderMode] = (void*)glad_glRenderMode;
+            glad_glRenderMode = counted_glRenderMode;
+        }
+        if (glad_glInitNames && glad_glInitNames != counted_glInitNames)
+        {
+            Table<>::loaded[ENTRY_glInitNames] = (void*)glad_glInitNames;
+            glad_glInitNames = counted_glInitNames;
+        }
+        if (glad_glLoadName && glad_glLoadName != counted_glLoadName)
+        {
+            Table<>::loaded[ENTRY_glLoadName] = (void*)glad_glLoadName;
+            glad_glLoadName = counted_glLoadName;
+        }
+        if (glad_glPassThrough && glad_glPassThrough != counted_glPassThrough)
+        {
+            Table<>::loaded[ENTRY_glPassThrough] = (void*)glad_glPassThrough;
+            glad_glPassThrough = counted_glPassThrough;
+        }
+        if (glad_glPopName && glad_glPopName != counted_glPopName)
+        {
+            Table<>::loaded[ENTRY_glPopName] = (void*)glad_glPopName;
+            glad_glPopName = counted_glPopName;
+        }
+        if (glad_glPushName && glad_glPushName != counted_glPushName)
+        {
+            Table<>::loaded[ENTRY_glPushName] = (void*)glad_glPushName;
+            glad_glPushName = counted_glPushName;
+        }
+        if (glad_glClearAccum && glad_glClearAccum != counted_glClearAccum)
+        {
+            Table<>::loaded[ENTRY_glClearAccum] = (void*)glad_glClearAccum;
+            glad_glClearAccum = counted_glClearAccum;
+        }
+        if (glad_glClearIndex && glad_glClearIndex != counted_glClearIndex)
+        {
+            Table<>::loaded[ENTRY_glClearIndex] = (void*)glad_glClearIndex;
+            glad_glClearIndex = counted_glClearIndex;
+        }
+        if (glad_glIndexMask && glad_glIndexMask != counted_glIndexMask)
+        {
+            Table<>::loaded[ENTRY_glIndexMask] = (void*)glad_glIndexMask;
+            glad_glIndexMask = counted_glIndexMask;
+        }
+        if (glad_glAccum && glad_glAccum != counted_glAccum)
+        {
+            Table<>::loaded[ENTRY_glAccum] = (void*)glad_glAccum;
+            glad_glAccum = counted_glAccum;
+        }
+        if (glad_glPopAttrib && glad_glPopAttrib != counted_glPopAttrib)
+        {
+            Table<>::loaded[ENTRY_glPopAttrib] = (void*)glad_glPopAttrib;
+            glad_glPopAttrib = counted_glPopAttrib;
+        }
+        if (glad_glPushAttrib && glad_glPushAttrib != counted_glPushAttrib)
+        {
+            Table<>::loaded[ENTRY_glPushAttrib] = (void*)glad_glPushAttrib;
+            glad_glPushAttrib = counted_glPushAttrib;
+        }
+        if (glad_glMap1d && glad_glMap1d != counted_glMap1d)
+        {
+            Table<>::loaded[ENTRY_glMap1d] = (void*)glad_glMap1d;
+            glad_glMap1d = counted_glMap1d;
+        }
+        if (glad_glMap1f && glad_glMap1f != counted_glMap1f)
+        {
+            Table<>::loaded[ENTRY_glMap1f] = (void*)glad_glMap1f;
+            glad_glMap1f = counted_glMap1f;
+        }
+        if (glad_glMap2d && glad_glMap2d != counted_glMap2d)
+        {
+            Table<>::loaded[ENTRY_glMap2d] = (void*)glad_glMap2d;
+            glad_glMap2d = counted_glMap2d;
+        }
+        if (glad_glMap2f && glad_glMap2f != counted_glMap2f)
+        {
+            Table<>::loaded[ENTRY_glMap2f] = (void*)glad_glMap2f;
+            glad_glMap2f = counted_glMap2f;
+        }
+        if (glad_glMapGrid1d && glad_glMapGrid1d != counted_glMapGrid1d)
+        {
+            Table<>::loaded[ENTRY_glMapGrid1d] = (void*)glad_glMapGrid1d;
+            glad_glMapGrid1d = counted_glMapGrid1d;
+        }
+        if (glad_glMapGrid1f && glad_glMapGrid1f != counted_glMapGrid1f)
+        {
+            Table<>::loaded[ENTRY_glMapGrid1f] = (void*)glad_glMapGrid1f;
+            glad_glMapGrid1f = counted_glMapGrid1f;
+        }
+        if (glad_glMapGrid2d && glad_glMapGrid2d != counted_glMapGrid2d)
+        {
+            Table<>::loaded[ENTRY_glMapGrid2d] = (void*)glad_glMapGrid2d;
+            glad_glMapGrid2d = counted_glMapGrid2d;
+        }
+        if (glad_glMapGrid2f && glad_glMapGrid2f != counted_glMapGrid2f)
+        {
+            Table<>::loaded[ENTRY_glMapGrid2f] = (void*)glad_glMapGrid2f;
+            glad_glMapGrid2f = counted_glMapGrid2f;
+        }
+        if (glad_glEvalCoord1d && glad_glEvalCoord1d != counted_glEvalCoord1d)
+        {
+            Table<>::loaded[ENTRY_glEvalCoord1d] = (void*)glad_glEvalCoord1d;
+            glad_glEvalCoord1d = counted_glEvalCoord1d;
+        }
+        if (glad_glEvalCoord1dv && glad_glEvalCoord1dv != counted_glEvalCoord1dv)
+        {
+            Table<>::loaded[ENTRY_glEvalCoord1dv] = (void*)glad_glEvalCoord1dv;
+            glad_glEvalCoord1dv = counted_glEvalCoord1dv;
+        }
+        if (glad_glEvalCoord1f && glad_glEvalCoord1f != counted_glEvalCoord1f)
+        {
+            Table<>::loaded[ENTRY_glEvalCoord1f] = (void*)glad_glEvalCoord1f;
+            glad_glEvalCoord1f = counted_glEvalCoord1f;
+        }
+        if (glad_glEvalCoord1fv && glad_glEvalCoord1fv != counted_glEvalCoord1fv)
+        {
+            Table<>::loaded[ENTRY_glEvalCoord1fv] = (void*)glad_glEvalCoord1fv;
+            glad_glEvalCoord1fv = counted_glEvalCoord1fv;
+        }
+        if (glad_glEvalCoord2d && glad_glEvalCoord2d != counted_glEvalCoord2d)
+        {
+            Table<>::loaded[ENTRY_glEvalCoord2d] = (void*)glad_glEvalCoord2d;
+            glad_glEvalCoord2d = counted_glEvalCoord2d;
+        }
+        if (glad_glEvalCoord2dv && glad_glEvalCoord2dv != counted_glEvalCoord2dv)
+        {
+            Table<>::loaded[ENTRY_glEvalCoord2dv] = (void*)glad_glEvalCoord2dv;
+            glad_glEvalCoord2dv = counted_glEvalCoord2dv;
+        }
+        if (glad_glEvalCoord2f && glad_glEvalCoord2f != counted_glEvalCoord2f)
+        {
+            Table<>::loaded[ENTRY_glEvalCoord2f] = (void*)glad_glEvalCoord2f;
+            glad_glEvalCoord2f = counted_glEvalCoord2f;
+        }
+        if (glad_glEvalCoord2fv && glad_glEvalCoord2fv != counted_glEvalCoord2fv)
+        {
+            Table<>::loaded[ENTRY_glEvalCoord2fv] = (void*)glad_glEvalCoord2fv;
+            glad_glEvalCoord2fv = counted_glEvalCoord2fv;
+        }
+        if (glad_glEvalMesh1 && glad_glEvalMesh1 != counted_glEvalMesh1)
+        {
+            Table<>::loaded[ENTRY_glEvalMesh1] = (void*)glad_glEvalMesh1;
+            glad_glEvalMesh1 = counted_glEvalMesh1;
+        }
+        if (glad_glEvalPoint1 && glad_glEvalPoint1 != counted_glEvalPoint1)
+        {
+            Table<>::loaded[ENTRY_glEvalPoint1] = (void*)glad_glEvalPoint1;
+            glad_glEvalPoint1 = counted_glEvalPoint1;
+        }
+        if (glad_glEvalMesh2 && glad_glEvalMesh2 != counted_glEvalMesh2)
+        {
+            Table<>::loaded[ENTRY_glEvalMesh2] = (void*)glad_glEvalMesh2;
+            glad_glEvalMesh2 = counted_glEvalMesh2;
+        }
+        if (glad_glEvalPoint2 && glad_glEvalPoint2 != counted_glEvalPoint2)
+        {
+            Table<>::loaded[ENTRY_glEvalPoint2] = (void*)glad_glEvalPoint2;
+            glad_glEvalPoint2 = counted_glEvalPoint2;
+        }
+        if (glad_glAlphaFunc && glad_glAlphaFunc != counted_glAlphaFunc)
+        {
+            Table<>::loaded[ENTRY_glAlphaFunc] = (void*)glad_glAlphaFunc;
+            glad_glAlphaFunc = counted_glAlphaFunc;
+        }
+        if (glad_glPixelZoom && glad_glPixelZoom != counted_glPixelZoom)
+        {
+            Table<>::loaded[ENTRY_glPixelZoom] = (void*)glad_glPixelZoom;
+            glad_glPixelZoom = counted_glPixelZoom;
+        }
+        if (glad_glPixelTransferf && glad_glPixelTransferf != counted_glPixelTransferf)
+        {
+            Table<>::loaded[ENTRY_glPixelTransferf] = (void*)glad_glPixelTransferf;
+            glad_glPixelTransferf = counted_glPixelTransferf;
+        }
+        if (glad_glPixelTransferi && glad_glPixelTransferi != counted_glPixelTransferi)
+        {
+            Table<>::loaded[ENTRY_glPixelTransferi] = (void*)glad_glPixelTransferi;
+            glad_glPixelTransferi = counted_glPixelTransferi;
+        }
+        if (glad_glPixelMapfv && glad_glPixelMapfv != counted_glPixelMapfv)
+        {
+            Table<>::loaded[ENTRY_glPixelMapfv] = (void*)glad_glPixelMapfv;
+            glad_glPixelMapfv = counted_glPixelMapfv;
+        }
+        if (glad_glPixelMapuiv && glad_glPixelMapuiv != counted_glPixelMapuiv)
+        {
+            Table<>::loaded[ENTRY_glPixelMapuiv] = (void*)glad_glPixelMapuiv;
+            glad_glPixelMapuiv = counted_glPixelMapuiv;
+        }
+        if (glad_glPixelMapusv && glad_glPixelMapusv != counted_glPixelMapusv)
+        {
+            Table<>::loaded[ENTRY_glPixelMapusv] = (void*)glad_glPixelMapusv;
+            glad_glPixelMapusv = counted_glPixelMapusv;
+        }
+        if (glad_glCopyPixels && glad_glCopyPixels != counted_glCopyPixels)
+        {
+            Table<>::loaded[ENTRY_glCopyPixels] = (void*)glad_glCopyPixels;
+            glad_glCopyPixels = counted_glCopyPixels;
+        }
+        if (glad_glDrawPixels && glad_glDrawPixels != counted_glDrawPixels)
+        {
+            Table<>::loaded[ENTRY_glDrawPixels] = (void*)glad_glDrawPixels;
+            glad_glDrawPixels = counted_glDrawPixels;
+        }
+        if (glad_glGetClipPlane && glad_glGetClipPlane != counted_glGetClipPlane)
+        {
+            Table<>::loaded[ENTRY_glGetClipPlane] = (void*)glad_glGetClipPlane;
+            glad_glGetClipPlane = counted_glGetClipPlane;
+        }
+        if (glad_glGetLightfv && glad_glGetLightfv != counted_glGetLightfv)
+        {
+            Table<>::loaded[ENTRY_glGetLightfv] = (void*)glad_glGetLightfv;
+            glad_glGetLightfv = counted_glGetLightfv;
+        }
+        if (glad_glGetLightiv && glad_glGetLightiv != counted_glGetLightiv)
+        {
+            Table<>::loaded[ENTRY_glGetLightiv] = (void*)glad_glGetLightiv;
+            glad_glGetLightiv = counted_glGetLightiv;
+        }
+        if (glad_glGetMapdv && glad_glGetMapdv != counted_glGetMapdv)
+        {
+            Table<>::loaded[ENTRY_glGetMapdv] = (void*)glad_glGetMapdv;
+            glad_glGetMapdv = counted_glGetMapdv;
+        }
+        if (glad_glGetMapfv && glad_glGetMapfv != counted_glGetMapfv)
+        {
+            Table<>::loaded[ENTRY_glGetMapfv] = (void*)glad_glGetMapfv;
+            glad_glGetMapfv = counted_glGetMapfv;
+        }
+        if (glad_glGetMapiv && glad_glGetMapiv != counted_glGetMapiv)
+        {
+            Table<>::loaded[ENTRY_glGetMapiv] = (void*)glad_glGetMapiv;
+            glad_glGetMapiv = counted_glGetMapiv;
+        }
+        if (glad_glGetMaterialfv && glad_glGetMaterialfv != counted_glGetMaterialfv)
+        {
+            Table<>::loaded[ENTRY_glGetMaterialfv] = (void*)glad_glGetMaterialfv;
+            glad_glGetMaterialfv = counted_glGetMaterialfv;
+        }
+        if (glad_glGetMaterialiv && glad_glGetMaterialiv != counted_glGetMaterialiv)
+        {
+            Table<>::loaded[ENTRY_glGetMaterialiv] = (void*)glad_glGetMaterialiv;
+            glad_glGetMaterialiv = counted_glGetMaterialiv;
+        }
+        if (glad_glGetPixelMapfv && glad_glGetPixelMapfv != counted_glGetPixelMapfv)
+        {
+            Table<>::loaded[ENTRY_glGetPixelMapfv] = (void*)glad_glGetPixelMapfv;
+            glad_glGetPixelMapfv = counted_glGetPixelMapfv;
+        }
+        if (glad_glGetPixelMapuiv && glad_glGetPixelMapuiv != counted_glGetPixelMapuiv)
+        {
+            Table<>::loaded[ENTRY_glGetPixelMapuiv] = (void*)glad_glGetPixelMapuiv;
+            glad_glGetPixelMapuiv = counted_glGetPixelMapuiv;
+        }
+        if (glad_glGetPixelMapusv && glad_glGetPixelMapusv != counted_glGetPixelMapusv)
+        {
+            Table<>::loaded[ENTRY_glGetPixelMapusv] = (void*)glad_glGetPixelMapusv;
+            glad_glGetPixelMapusv = counted_glGetPixelMapusv;
+        }
+        if (glad_glGetPolygonStipple && glad_glGetPolygonStipple != counted_glGetPolygonStipple)
+        {
+            Table<>::loaded[ENTRY_glGetPolygonStipple] = (void*)glad_glGetPolygonStipple;
+            glad_glGetPolygonStipple = counted_glGetPolygonStipple;
+        }
+        if (glad_glGetTexEnvfv && glad_glGetTexEnvfv != counted_glGetTexEnvfv)
+        {
+            Table<>::loaded[ENTRY_glGetTexEnvfv] = (void*)glad_glGetTexEnvfv;
+            glad_glGetTexEnvfv = counted_glGetTexEnvfv;
+        }
+        if (glad_glGetTexEnviv && glad_glGetTexEnviv != counted_glGetTexEnviv)
+        {
+            Table<>::loaded[ENTRY_glGetTexEnviv] = (void*)glad_glGetTexEnviv;
+            glad_glGetTexEnviv = counted_glGetTexEnviv;
+        }
+        if (glad_glGetTexGendv && glad_glGetTexGendv != counted_glGetTexGendv)
+        {
+            Table<>::loaded[ENTRY_glGetTexGendv] = (void*)glad_glGetTexGendv;
+            glad_glGetTexGendv = counted_glGetTexGendv;
+        }
+        if (glad_glGetTexGenfv && glad_glGetTexGenfv != counted_glGetTexGenfv)
+        {
+            Table<>::loaded[ENTRY_glGetTexGenfv] = (void*)glad_glGetTexGenfv;
+            glad_glGetTexGenfv = counted_glGetTexGenfv;
+        }
+        if (glad_glGetTexGeniv && glad_glGetTexGeniv != counted_glGetTexGeniv)
+        {
+            Table<>::loaded[ENTRY_glGetTexGeniv] = (void*)glad_glGetTexGeniv;
+            glad_glGetTexGeniv = counted_glGetTexGeniv;
+        }
+        if (glad_glIsList && glad_glIsList != counted_glIsList)
+        {
+            Table<>::loaded[ENTRY_glIsList] = (void*)glad_glIsList;
+            glad_glIsList = counted_glIsList;
+        }
+        if (glad_glFrustum && glad_glFrustum != counted_glFrustum)
+        {
+            Table<>::loaded[ENTRY_glFrustum] = (void*)glad_glFrustum;
+            glad_glFrustum = counted_glFrustum;
+        }
+        if (glad_glLoadIdentity && glad_glLoadIdentity != counted_glLoadIdentity)
+        {
+            Table<>::loaded[ENTRY_glLoadIdentity] = (void*)glad_glLoadIdentity;
+            glad_glLoadIdentity = counted_glLoadIdentity;
+        }
+        if (glad_glLoadMatrixf && glad_glLoadMatrixf != counted_glLoadMatrixf)
+        {
+            Table<>::loaded[ENTRY_glLoadMatrixf] = (void*)glad_glLoadMatrixf;
+            glad_glLoadMatrixf = counted_glLoadMatrixf;
+        }
+        if (glad_glLoadMatrixd && glad_glLoadMatrixd != counted_glLoadMatrixd)
+        {
+            Table<>::loaded[ENTRY_glLoadMatrixd] = (void*)glad_glLoadMatrixd;
+            glad_glLoadMatrixd = counted_glLoadMatrixd;
+        }
+        if (glad_glMatrixMode && glad_glMatrixMode != counted_glMatrixMode)
+        {
+            Table<>::loaded[ENTRY_glMatrixMode] = (void*)glad_glMatrixMode;
+            glad_glMatrixMode = counted_glMatrixMode;
+        }
+        if (glad_glMultMatrixf && glad_glMultMatrixf != counted_glMultMatrixf)
+        {
+            Table<>::loaded[ENTRY_glMultMatrixf] = (void*)glad_glMultMatrixf;
+            glad_glMultMatrixf = counted_glMultMatrixf;
+        }
+        if (glad_glMultMatrixd && glad_glMultMatrixd != counted_glMultMatrixd)
+        {
+            Table<>::loaded[ENTRY_glMultMatrixd] = (void*)glad_glMultMatrixd;
+            glad_glMultMatrixd = counted_glMultMatrixd;
+        }
+        if (glad_glOrtho && glad_glOrtho != counted_glOrtho)
+        {
+            Table<>::loaded[ENTRY_glOrtho] = (void*)glad_glOrtho;
+            glad_glOrtho = counted_glOrtho;
+        }
+        if (glad_glPopMatrix && glad_glPopMatrix != counted_glPopMatrix)
+        {
+            Table<>::loaded[ENTRY_glPopMatrix] = (void*)glad_glPopMatrix;
+            glad_glPopMatrix = counted_glPopMatrix;
+        }
+        if (glad_glPushMatrix && glad_glPushMatrix != counted_glPushMatrix)
+        {
+            Table<>::loaded[ENTRY_glPushMatrix] = (void*)glad_glPushMatrix;
+            glad_glPushMatrix = counted_glPushMatrix;
+        }
+        if (glad_glRotated && glad_glRotated != counted_glRotated)
+        {
+            Table<>::loaded[ENTRY_glRotated] = (void*)glad_glRotated;
+            glad_glRotated = counted_glRotated;
+        }
+        if (glad_glRotatef && glad_glRotatef != counted_glRotatef)
+        {
+            Table<>::loaded[ENTRY_glRotatef] = (void*)glad_glRotatef;
+            glad_glRotatef = counted_glRotatef;
+        }
+        if (glad_glScaled && glad_glScaled != counted_glScaled)
+        {
+            Table<>::loaded[ENTRY_glScaled] = (void*)glad_glScaled;
+            glad_glScaled = counted_glScaled;
+        }
+        if (glad_glScalef && glad_glScalef != counted_glScalef)
+        {
+            Table<>::loaded[ENTRY_glScalef] = (void*)glad_glScalef;
+            glad_glScalef = counted_glScalef;
+        }
+        if (glad_glTranslated && glad_glTranslated != counted_glTranslated)
+        {
+            Table<>::loaded[ENTRY_glTranslated] = (void*)glad_glTranslated;
+            glad_glTranslated = counted_glTranslated;
+        }
+        if (glad_glTranslatef && glad_glTranslatef != counted_glTranslatef)
+        {
+            Table<>::loaded[ENTRY_glTranslatef] = (void*)glad_glTranslatef;
+            glad_glTranslatef = counted_glTranslatef;
+        }
+        if (glad_glDrawArrays && glad_glDrawArrays != counted_glDrawArrays)
+        {
+            Table<>::loaded[ENTRY_glDrawArrays] = (void*)glad_glDrawArrays;
+            glad_glDrawArrays = counted_glDrawArrays;
+        }
+        if (glad_glDrawElements && glad_glDrawElements != counted_glDrawElements)
+        {
+            Table<>::loaded[ENTRY_glDrawElements] = (void*)glad_glDrawElements;
+            glad_glDrawElements = counted_glDrawElements;
+        }
+        if (glad_glGetPointerv && glad_glGetPointerv != counted_glGetPointerv)
+        {
+            Table<>::loaded[ENTRY_glGetPointerv] = (void*)glad_glGetPointerv;
+            glad_glGetPointerv = counted_glGetPointerv;
+        }
+        if (glad_glPolygonOffset && glad_glPolygonOffset != counted_glPolygonOffset)
+        {
+            Table<>::loaded[ENTRY_glPolygonOffset] = (void*)glad_glPolygonOffset;
+            glad_glPolygonOffset = counted_glPolygonOffset;
+        }
+        if (glad_glCopyTexImage1D && glad_glCopyTexImage1D != counted_glCopyTexImage1D)
+        {
+            Table<>::loaded[ENTRY_glCopyTexImage1D] = (void*)glad_glCopyTexImage1D;
+            glad_glCopyTexImage1D = counted_glCopyTexImage1D;
+        }
+        if (glad_glCopyTexImage2D && glad_glCopyTexImage2D != counted_glCopyTexImage2D)
+        {
+            Table<>::loaded[ENTRY_glCopyTexImage2D] = (void*)glad_glCopyTexImage2D;
+            glad_glCopyTexImage2D = counted_glCopyTexImage2D;
+        }
+        if (glad_glCopyTexSubImage1D && glad_glCopyTexSubImage1D != counted_glCopyTexSubImage1D)
+        {
+            Table<>::loaded[ENTRY_glCopyTexSubImage1D] = (void*)glad_glCopyTexSubImage1D;
+            glad_glCopyTexSubImage1D = counted_glCopyTexSubImage1D;
+        }
+        if (glad_glCopyTexSubImage2D && glad_glCopyTexSubImage2D != counted_glCopyTexSubImage2D)
+        {
+            Table<>::loaded[ENTRY_glCopyTexSubImage2D] = (void*)glad_glCopyTexSubImage2D;
+            glad_glCopyTexSubImage2D = counted_glCopyTexSubImage2D;
+        }
+        if (glad_glTexSubImage1D && glad_glTexSubImage1D != counted_glTexSubImage1D)
+        {
+            Table<>::loaded[ENTRY_glTexSubImage1D] = (void*)glad_glTexSubImage1D;
+            glad_glTexSubImage1D = counted_glTexSubImage1D;
+        }
+        if (glad_glTexSubImage2D && glad_glTexSubImage2D != counted_glTexSubImage2D)
+        {
+            Table<>::loaded[ENTRY_glTexSubImage2D] = (void*)glad_glTexSubImage2D;
+            glad_glTexSubImage2D = counted_glTexSubImage2D;
+        }
+        if (glad_glBindTexture && glad_glBindTexture != counted_glBindTexture)
+        {
+            Table<>::loaded[ENTRY_glBindTexture] = (void*)glad_glBindTexture;
+            glad_glBindTexture = counted_glBindTexture;
+        }
+        if (glad_glDeleteTextures && glad_glDeleteTextures != counted_glDeleteTextures)
+        {
+            Table<>::loaded[ENTRY_glDeleteTextures] = (void*)glad_glDeleteTextures;
+            glad_glDeleteTextures = counted_glDeleteTextures;
+        }
+        if (glad_glGenTextures && glad_glGenTextures != counted_glGenTextures)
+        {
+            Table<>::loaded[ENTRY_glGenTextures] = (void*)glad_glGenTextures;
+            glad_glGenTextures = counted_glGenTextures;
+        }
+        if (glad_glIsTexture && glad_glIsTexture != counted_glIsTexture)
+        {
+            Table<>::loaded[ENTRY_glIsTexture] = (void*)glad_glIsTexture;
+            glad_glIsTexture = counted_glIsTexture;
+        }
+        if (glad_glArrayElement && glad_glArrayElement != counted_glArrayElement)
+        {
+            Table<>::loaded[ENTRY_glArrayElement] = (void*)glad_glArrayElement;
+            glad_glArrayElement = counted_glArrayElement;
+        }
+        if (glad_glColorPointer && glad_glColorPointer != counted_glColorPointer)
+        {
+            Table<>::loaded[ENTRY_glColorPointer] = (void*)glad_glColorPointer;
+            glad_glColorPointer = counted_glColorPointer;
+        }
+        if (glad_glDisableClientState && glad_glDisableClientState != counted_glDisableClientState)
+        {
+            Table<>::loaded[ENTRY_glDisableClientState] = (void*)glad_glDisableClientState;
+            glad_glDisableClientState = counted_glDisableClientState;
+        }
+        if (glad_glEdgeFlagPointer && glad_glEdgeFlagPointer != counted_glEdgeFlagPointer)
+        {
+            Table<>::loaded[ENTRY_glEdgeFlagPointer] = (void*)glad_glEdgeFlagPointer;
+            glad_glEdgeFlagPointer = counted_glEdgeFlagPointer;
+        }
+        if (glad_glEnableClientState && glad_glEnableClientState != counted_glEnableClientState)
+        {
+            Table<>::loaded[ENTRY_glEnableClientState] = (void*)glad_glEnableClientState;
+            glad_glEnableClientState = counted_glEnableClientState;
+        }
+        if (glad_glIndexPointer && glad_glIndexPointer != counted_glIndexPointer)
+        {
+            Table<>::loaded[ENTRY_glIndexPointer] = (void*)glad_glIndexPointer;
+            glad_glIndexPointer = counted_glIndexPointer;
+        }
+        if (glad_glInterleavedArrays && glad_glInterleavedArrays != counted_glInterleavedArrays)
+        {
+            Table<>::loaded[ENTRY_glInterleavedArrays] = (void*)glad_glInterleavedArrays;
+            glad_glInterleavedArrays = counted_glInterleavedArrays;
+        }
+        if (glad_glNormalPointer && glad_glNormalPointer != counted_glNormalPointer)
+        {
+            Table<>::loaded[ENTRY_glNormalPointer] = (void*)glad_glNormalPointer;
+            glad_glNormalPointer = counted_glNormalPointer;
+        }
+        if (glad_glTexCoordPointer && glad_glTexCoordPointer != counted_glTexCoordPointer)
+        {
+            Table<>::loaded[ENTRY_glTexCoordPointer] = (void*)glad_glTexCoordPointer;
+            glad_glTexCoordPointer = counted_glTexCoordPointer;
+        }
+        if (glad_glVertexPointer && glad_glVertexPointer != counted_glVertexPointer)
+        {
+            Table<>::loaded[ENTRY_glVertexPointer] = (void*)glad_glVertexPointer;
+            glad_glVertexPointer = counted_glVertexPointer;
+        }
+        if (glad_glAreTexturesResident && glad_glAreTexturesResident != counted_glAreTexturesResident)
+        {
+            Table<>::loaded[ENTRY_glAreTexturesResident] = (void*)glad_glAreTexturesResident;
+            glad_glAreTexturesResident = counted_glAreTexturesResident;
+        }
+        if (glad_glPrioritizeTextures && glad_glPrioritizeTextures != counted_glPrioritizeTextures)
+        {
+            Table<>::loaded[ENTRY_glPrioritizeTextures] = (void*)glad_glPrioritizeTextures;
+            glad_glPrioritizeTextures = counted_glPrioritizeTextures;
+        }
+        if (glad_glIndexub && glad_glIndexub != counted_glIndexub)
+        {
+            Table<>::loaded[ENTRY_glIndexub] = (void*)glad_glIndexub;
+            glad_glIndexub = counted_glIndexub;
+        }
+        if (glad_glIndexubv && glad_glIndexubv != counted_glIndexubv)
+        {
+            Table<>::loaded[ENTRY_glIndexubv] = (void*)glad_glIndexubv;
+            glad_glIndexubv = counted_glIndexubv;
+        }
+        if (glad_glPopClientAttrib && glad_glPopClientAttrib != counted_glPopClientAttrib)
+        {
+            Table<>::loaded[ENTRY_glPopClientAttrib] = (void*)glad_glPopClientAttrib;
+            glad_glPopClientAttrib = counted_glPopClientAttrib;
+        }
+        if (glad_glPushClientAttrib && glad_glPushClientAttrib != counted_glPushClientAttrib)
+        {
+            Table<>::loaded[ENTRY_glPushClientAttrib] = (void*)glad_glPushClientAttrib;
+            glad_glPushClientAttrib = counted_glPushClientAttrib;
+        }
+        if (glad_glDrawRangeElements && glad_glDrawRangeElements != counted_glDrawRangeElements)
+        {
+            Table<>::loaded[ENTRY_glDrawRangeElements] = (void*)glad_glDrawRangeElements;
+            glad_glDrawRangeElements = counted_glDrawRangeElements;
+        }
+        if (glad_glTexImage3D && glad_glTexImage3D != counted_glTexImage3D)
+        {
+            Table<>::loaded[ENTRY_glTexImage3D] = (void*)glad_glTexImage3D;
+            glad_glTexImage3D = counted_glTexImage3D;
+        }
+        if (glad_glTexSubImage3D && glad_glTexSubImage3D != counted_glTexSubImage3D)
+        {
+            Table<>::loaded[ENTRY_glTexSubImage3D] = (void*)glad_glTexSubImage3D;
+            glad_glTexSubImage3D = counted_glTexSubImage3D;
+        }
+        if (glad_glCopyTexSubImage3D && glad_glCopyTexSubImage3D != counted_glCopyTexSubImage3D)
+        {
+            Table<>::loaded[ENTRY_glCopyTexSubImage3D] = (void*)glad_glCopyTexSubImage3D;
+            glad_glCopyTexSubImage3D = counted_glCopyTexSubImage3D;
+        }
+        if (glad_glActiveTexture && glad_glActiveTexture != counted_glActiveTexture)
+        {
+            Table<>::loaded[ENTRY_glActiveTexture] = (void*)glad_glActiveTexture;
+            glad_glActiveTexture = counted_glActiveTexture;
+        }
+        if (glad_glSampleCoverage && glad_glSampleCoverage != counted_glSampleCoverage)
+        {
+            Table<>::loaded[ENTRY_glSampleCoverage] = (void*)glad_glSampleCoverage;
+            glad_glSampleCoverage = counted_glSampleCoverage;
+        }
+        if (glad_glCompressedTexImage3D && glad_glCompressedTexImage3D != counted_glCompressedTexImage3D)
+        {
+            Table<>::loaded[ENTRY_glCompressedTexImage3D] = (void*)glad_glCompressedTexImage3D;
+            glad_glCompressedTexImage3D = counted_glCompressedTexImage3D;
+        }
+        if (glad_glCompressedTexImage2D && glad_glCompressedTexImage2D != counted_glCompressedTexImage2D)
+        {
+            Table<>::loaded[ENTRY_glCompressedTexImage2D] = (void*)glad_glCompressedTexImage2D;
+            glad_glCompressedTexImage2D = counted_glCompressedTexImage2D;
+        }
+        if (glad_glCompressedTexImage1D && glad_glCompressedTexImage1D != counted_glCompressedTexImage1D)
+        {
+            Table<>::loaded[ENTRY_glCompressedTexImage1D] = (void*)glad_glCompressedTexImage1D;
+            glad_glCompressedTexImage1D = counted_glCompressedTexImage1D;
+        }
+        if (glad_glCompressedTexSubImage3D && glad_glCompressedTexSubImage3D != counted_glCompressedTexSubImage3D)
+        {
+            Table<>::loaded[ENTRY_glCompressedTexSubImage3D] = (void*)glad_glCompressedTexSubImage3D;
+            glad_glCompressedTexSubImage3D = counted_glCompressedTexSubImage3D;
+        }
+        if (glad_glCompressedTexSubImage2D && glad_glCompressedTexSubImage2D != counted_glCompressedTexSubImage2D)
+        {
+            Table<>::loaded[ENTRY_glCompressedTexSubImage2D] = (void*)glad_glCompressedTexSubImage2D;
+            glad_glCompressedTexSubImage2D = counted_glCompressedTexSubImage2D;
+        }
+        if (glad_glCompressedTexSubImage1D && glad_glCompressedTexSubImage1D != counted_glCompressedTexSubImage1D)
+        {
+            Table<>::loaded[ENTRY_glCompressedTexSubImage1D] = (void*)glad_glCompressedTexSubImage1D;
+            glad_glCompressedTexSubImage1D = counted_glCompressedTexSubImage1D;
+        }
+        if (glad_glGetCompressedTexImage && glad_glGetCompressedTexImage != counted_glGetCompressedTexImage)
+        {
+            Table<>::loaded[ENTRY_glGetCompressedTexImage] = (void*)glad_glGetCompressedTexImage;
+            glad_glGetCompressedTexImage = counted_glGetCompressedTexImage;
+        }
+        if (glad_glClientActiveTexture && glad_glClientActiveTexture != counted_glClientActiveTexture)
+        {
+            Table<>::loaded[ENTRY_glClientActiveTexture] = (void*)glad_glClientActiveTexture;
+            glad_glClientActiveTexture = counted_glClientActiveTexture;
+        }
+        if (glad_glMultiTexCoord1d && glad_glMultiTexCoord1d != counted_glMultiTexCoord1d)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord1d] = (void*)glad_glMultiTexCoord1d;
+            glad_glMultiTexCoord1d = counted_glMultiTexCoord1d;
+        }
+        if (glad_glMultiTexCoord1dv && glad_glMultiTexCoord1dv != counted_glMultiTexCoord1dv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord1dv] = (void*)glad_glMultiTexCoord1dv;
+            glad_glMultiTexCoord1dv = counted_glMultiTexCoord1dv;
+        }
+        if (glad_glMultiTexCoord1f && glad_glMultiTexCoord1f != counted_glMultiTexCoord1f)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord1f] = (void*)glad_glMultiTexCoord1f;
+            glad_glMultiTexCoord1f = counted_glMultiTexCoord1f;
+        }
+        if (glad_glMultiTexCoord1fv && glad_glMultiTexCoord1fv != counted_glMultiTexCoord1fv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord1fv] = (void*)glad_glMultiTexCoord1fv;
+            glad_glMultiTexCoord1fv = counted_glMultiTexCoord1fv;
+        }
+        if (glad_glMultiTexCoord1i && glad_glMultiTexCoord1i != counted_glMultiTexCoord1i)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord1i] = (void*)glad_glMultiTexCoord1i;
+            glad_glMultiTexCoord1i = counted_glMultiTexCoord1i;
+        }
+        if (glad_glMultiTexCoord1iv && glad_glMultiTexCoord1iv != counted_glMultiTexCoord1iv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord1iv] = (void*)glad_glMultiTexCoord1iv;
+            glad_glMultiTexCoord1iv = counted_glMultiTexCoord1iv;
+        }
+        if (glad_glMultiTexCoord1s && glad_glMultiTexCoord1s != counted_glMultiTexCoord1s)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord1s] = (void*)glad_glMultiTexCoord1s;
+            glad_glMultiTexCoord1s = counted_glMultiTexCoord1s;
+        }
+        if (glad_glMultiTexCoord1sv && glad_glMultiTexCoord1sv != counted_glMultiTexCoord1sv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord1sv] = (void*)glad_glMultiTexCoord1sv;
+            glad_glMultiTexCoord1sv = counted_glMultiTexCoord1sv;
+        }
+        if (glad_glMultiTexCoord2d && glad_glMultiTexCoord2d != counted_glMultiTexCoord2d)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord2d] = (void*)glad_glMultiTexCoord2d;
+            glad_glMultiTexCoord2d = counted_glMultiTexCoord2d;
+        }
+        if (glad_glMultiTexCoord2dv && glad_glMultiTexCoord2dv != counted_glMultiTexCoord2dv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord2dv] = (void*)glad_glMultiTexCoord2dv;
+            glad_glMultiTexCoord2dv = counted_glMultiTexCoord2dv;
+        }
+        if (glad_glMultiTexCoord2f && glad_glMultiTexCoord2f != counted_glMultiTexCoord2f)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord2f] = (void*)glad_glMultiTexCoord2f;
+            glad_glMultiTexCoord2f = counted_glMultiTexCoord2f;
+        }
+        if (glad_glMultiTexCoord2fv && glad_glMultiTexCoord2fv != counted_glMultiTexCoord2fv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord2fv] = (void*)glad_glMultiTexCoord2fv;
+            glad_glMultiTexCoord2fv = counted_glMultiTexCoord2fv;
+        }
+        if (glad_glMultiTexCoord2i && glad_glMultiTexCoord2i != counted_glMultiTexCoord2i)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord2i] = (void*)glad_glMultiTexCoord2i;
+            glad_glMultiTexCoord2i = counted_glMultiTexCoord2i;
+        }
+        if (glad_glMultiTexCoord2iv && glad_glMultiTexCoord2iv != counted_glMultiTexCoord2iv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord2iv] = (void*)glad_glMultiTexCoord2iv;
+            glad_glMultiTexCoord2iv = counted_glMultiTexCoord2iv;
+        }
+        if (glad_glMultiTexCoord2s && glad_glMultiTexCoord2s != counted_glMultiTexCoord2s)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord2s] = (void*)glad_glMultiTexCoord2s;
+            glad_glMultiTexCoord2s = counted_glMultiTexCoord2s;
+        }
+        if (glad_glMultiTexCoord2sv && glad_glMultiTexCoord2sv != counted_glMultiTexCoord2sv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord2sv] = (void*)glad_glMultiTexCoord2sv;
+            glad_glMultiTexCoord2sv = counted_glMultiTexCoord2sv;
+        }
+        if (glad_glMultiTexCoord3d && glad_glMultiTexCoord3d != counted_glMultiTexCoord3d)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord3d] = (void*)glad_glMultiTexCoord3d;
+            glad_glMultiTexCoord3d = counted_glMultiTexCoord3d;
+        }
+        if (glad_glMultiTexCoord3dv && glad_glMultiTexCoord3dv != counted_glMultiTexCoord3dv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord3dv] = (void*)glad_glMultiTexCoord3dv;
+            glad_glMultiTexCoord3dv = counted_glMultiTexCoord3dv;
+        }
+        if (glad_glMultiTexCoord3f && glad_glMultiTexCoord3f != counted_glMultiTexCoord3f)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord3f] = (void*)glad_glMultiTexCoord3f;
+            glad_glMultiTexCoord3f = counted_glMultiTexCoord3f;
+        }
+        if (glad_glMultiTexCoord3fv && glad_glMultiTexCoord3fv != counted_glMultiTexCoord3fv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord3fv] = (void*)glad_glMultiTexCoord3fv;
+            glad_glMultiTexCoord3fv = counted_glMultiTexCoord3fv;
+        }
+        if (glad_glMultiTexCoord3i && glad_glMultiTexCoord3i != counted_glMultiTexCoord3i)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord3i] = (void*)glad_glMultiTexCoord3i;
+            glad_glMultiTexCoord3i = counted_glMultiTexCoord3i;
+        }
+        if (glad_glMultiTexCoord3iv && glad_glMultiTexCoord3iv != counted_glMultiTexCoord3iv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord3iv] = (void*)glad_glMultiTexCoord3iv;
+            glad_glMultiTexCoord3iv = counted_glMultiTexCoord3iv;
+        }
+        if (glad_glMultiTexCoord3s && glad_glMultiTexCoord3s != counted_glMultiTexCoord3s)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord3s] = (void*)glad_glMultiTexCoord3s;
+            glad_glMultiTexCoord3s = counted_glMultiTexCoord3s;
+        }
+        if (glad_glMultiTexCoord3sv && glad_glMultiTexCoord3sv != counted_glMultiTexCoord3sv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord3sv] = (void*)glad_glMultiTexCoord3sv;
+            glad_glMultiTexCoord3sv = counted_glMultiTexCoord3sv;
+        }
+        if (glad_glMultiTexCoord4d && glad_glMultiTexCoord4d != counted_glMultiTexCoord4d)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord4d] = (void*)glad_glMultiTexCoord4d;
+            glad_glMultiTexCoord4d = counted_glMultiTexCoord4d;
+        }
+        if (glad_glMultiTexCoord4dv && glad_glMultiTexCoord4dv != counted_glMultiTexCoord4dv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord4dv] = (void*)glad_glMultiTexCoord4dv;
+            glad_glMultiTexCoord4dv = counted_glMultiTexCoord4dv;
+        }
+        if (glad_glMultiTexCoord4f && glad_glMultiTexCoord4f != counted_glMultiTexCoord4f)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord4f] = (void*)glad_glMultiTexCoord4f;
+            glad_glMultiTexCoord4f = counted_glMultiTexCoord4f;
+        }
+        if (glad_glMultiTexCoord4fv && glad_glMultiTexCoord4fv != counted_glMultiTexCoord4fv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord4fv] = (void*)glad_glMultiTexCoord4fv;
+            glad_glMultiTexCoord4fv = counted_glMultiTexCoord4fv;
+        }
+        if (glad_glMultiTexCoord4i && glad_glMultiTexCoord4i != counted_glMultiTexCoord4i)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord4i] = (void*)glad_glMultiTexCoord4i;
+            glad_glMultiTexCoord4i = counted_glMultiTexCoord4i;
+        }
+        if (glad_glMultiTexCoord4iv && glad_glMultiTexCoord4iv != counted_glMultiTexCoord4iv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord4iv] = (void*)glad_glMultiTexCoord4iv;
+            glad_glMultiTexCoord4iv = counted_glMultiTexCoord4iv;
+        }
+        if (glad_glMultiTexCoord4s && glad_glMultiTexCoord4s != counted_glMultiTexCoord4s)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord4s] = (void*)glad_glMultiTexCoord4s;
+            glad_glMultiTexCoord4s = counted_glMultiTexCoord4s;
+        }
+        if (glad_glMultiTexCoord4sv && glad_glMultiTexCoord4sv != counted_glMultiTexCoord4sv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord4sv] = (void*)glad_glMultiTexCoord4sv;
+            glad_glMultiTexCoord4sv = counted_glMultiTexCoord4sv;
+        }
+        if (glad_glLoadTransposeMatrixf && glad_glLoadTransposeMatrixf != counted_glLoadTransposeMatrixf)
+        {
+            Table<>::loaded[ENTRY_glLoadTransposeMatrixf] = (void*)glad_glLoadTransposeMatrixf;
+            glad_glLoadTransposeMatrixf = counted_glLoadTransposeMatrixf;
+        }
+        if (glad_glLoadTransposeMatrixd && glad_glLoadTransposeMatrixd != counted_glLoadTransposeMatrixd)
+        {
+            Table<>::loaded[ENTRY_glLoadTransposeMatrixd] = (void*)glad_glLoadTransposeMatrixd;
+            glad_glLoadTransposeMatrixd = counted_glLoadTransposeMatrixd;
+        }
+        if (glad_glMultTransposeMatrixf && glad_glMultTransposeMatrixf != counted_glMultTransposeMatrixf)
+        {
+            Table<>::loaded[ENTRY_glMultTransposeMatrixf] = (void*)glad_glMultTransposeMatrixf;
+            glad_glMultTransposeMatrixf = counted_glMultTransposeMatrixf;
+        }
+        if (glad_glMultTransposeMatrixd && glad_glMultTransposeMatrixd != counted_glMultTransposeMatrixd)
+        {
+            Table<>::loaded[ENTRY_glMultTransposeMatrixd] = (void*)glad_glMultTransposeMatrixd;
+            glad_glMultTransposeMatrixd = counted_glMultTransposeMatrixd;
+        }
+        if (glad_glBlendFuncSeparate && glad_glBlendFuncSeparate != counted_glBlendFuncSeparate)
+        {
+            Table<>::loaded[ENTRY_glBlendFuncSeparate] = (void*)glad_glBlendFuncSeparate;
+            glad_glBlendFuncSeparate = counted_glBlendFuncSeparate;
+        }
+        if (glad_glMultiDrawArrays && glad_glMultiDrawArrays != counted_glMultiDrawArrays)
+        {
+            Table<>::loaded[ENTRY_glMultiDrawArrays] = (void*)glad_glMultiDrawArrays;
+            glad_glMultiDrawArrays = counted_glMultiDrawArrays;
+        }
+        if (glad_glMultiDrawElements && glad_glMultiDrawElements != counted_glMultiDrawElements)
+        {
+            Table<>::loaded[ENTRY_glMultiDrawElements] = (void*)glad_glMultiDrawElements;
+            glad_glMultiDrawElements = counted_glMultiDrawElements;
+        }
+        if (glad_glPointParameterf && glad_glPointParameterf != counted_glPointParameterf)
+        {
+            Table<>::loaded[ENTRY_glPointParameterf] = (void*)glad_glPointParameterf;
+            glad_glPointParameterf = counted_glPointParameterf;
+        }
+        if (glad_glPointParameterfv && glad_glPointParameterfv != counted_glPointParameterfv)
+        {
+            Table<>::loaded[ENTRY_glPointParameterfv] = (void*)glad_glPointParameterfv;
+            glad_glPointParameterfv = counted_glPointParameterfv;
+        }
+        if (glad_glPointParameteri && glad_glPointParameteri != counted_glPointParameteri)
+        {
+            Table<>::loaded[ENTRY_glPointParameteri] = (void*)glad_glPointParameteri;
+            glad_glPointParameteri = counted_glPointParameteri;
+        }
+        if (glad_glPointParameteriv && glad_glPointParameteriv != counted_glPointParameteriv)
+        {
+            Table<>::loaded[ENTRY_glPointParameteriv] = (void*)glad_glPointParameteriv;
+            glad_glPointParameteriv = counted_glPointParameteriv;
+        }
+        if (glad_glFogCoordf && glad_glFogCoordf != counted_glFogCoordf)
+        {
+            Table<>::loaded[ENTRY_glFogCoordf] = (void*)glad_glFogCoordf;
+            glad_glFogCoordf = counted_glFogCoordf;
+        }
+        if (glad_glFogCoordfv && glad_glFogCoordfv != counted_glFogCoordfv)
+        {
+            Table<>::loaded[ENTRY_glFogCoordfv] = (void*)glad_glFogCoordfv;
+            glad_glFogCoordfv = counted_glFogCoordfv;
+        }
+        if (glad_glFogCoordd && glad_glFogCoordd != counted_glFogCoordd)
+        {
+            Table<>::loaded[ENTRY_glFogCoordd] = (void*)glad_glFogCoordd;
+            glad_glFogCoordd = counted_glFogCoordd;
+        }
+        if (glad_glFogCoorddv && glad_glFogCoorddv != counted_glFogCoorddv)
+        {
+            Table<>::loaded[ENTRY_glFogCoorddv] = (void*)glad_glFogCoorddv;
+            glad_glFogCoorddv = counted_glFogCoorddv;
+        }
+        if (glad_glFogCoordPointer && glad_glFogCoordPointer != counted_glFogCoordPointer)
+        {
+            Table<>::loaded[ENTRY_glFogCoordPointer] = (void*)glad_glFogCoordPointer;
+            glad_glFogCoordPointer = counted_glFogCoordPointer;
+        }
+        if (glad_glSecondaryColor3b && glad_glSecondaryColor3b != counted_glSecondaryColor3b)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3b] = (void*)glad_glSecondaryColor3b;
+            glad_glSecondaryColor3b = counted_glSecondaryColor3b;
+        }
+        if (glad_glSecondaryColor3bv && glad_glSecondaryColor3bv != counted_glSecondaryColor3bv)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3bv] = (void*)glad_glSecondaryColor3bv;
+            glad_glSecondaryColor3bv = counted_glSecondaryColor3bv;
+        }
+        if (glad_glSecondaryColor3d && glad_glSecondaryColor3d != counted_glSecondaryColor3d)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3d] = (void*)glad_glSecondaryColor3d;
+            glad_glSecondaryColor3d = counted_glSecondaryColor3d;
+        }
+        if (glad_glSecondaryColor3dv && glad_glSecondaryColor3dv != counted_glSecondaryColor3dv)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3dv] = (void*)glad_glSecondaryColor3dv;
+            glad_glSecondaryColor3dv = counted_glSecondaryColor3dv;
+        }
+        if (glad_glSecondaryColor3f && glad_glSecondaryColor3f != counted_glSecondaryColor3f)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3f] = (void*)glad_glSecondaryColor3f;
+            glad_glSecondaryColor3f = counted_glSecondaryColor3f;
+        }
+        if (glad_glSecondaryColor3fv && glad_glSecondaryColor3fv != counted_glSecondaryColor3fv)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3fv] = (void*)glad_glSecondaryColor3fv;
+            glad_glSecondaryColor3fv = counted_glSecondaryColor3fv;
+        }
+        if (glad_glSecondaryColor3i && glad_glSecondaryColor3i != counted_glSecondaryColor3i)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3i] = (void*)glad_glSecondaryColor3i;
+            glad_glSecondaryColor3i = counted_glSecondaryColor3i;
+        }
+        if (glad_glSecondaryColor3iv && glad_glSecondaryColor3iv != counted_glSecondaryColor3iv)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3iv] = (void*)glad_glSecondaryColor3iv;
+            glad_glSecondaryColor3iv = counted_glSecondaryColor3iv;
+        }
+        if (glad_glSecondaryColor3s && glad_glSecondaryColor3s != counted_glSecondaryColor3s)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3s] = (void*)glad_glSecondaryColor3s;
+            glad_glSecondaryColor3s = counted_glSecondaryColor3s;
+        }
+        if (glad_glSecondaryColor3sv && glad_glSecondaryColor3sv != counted_glSecondaryColor3sv)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3sv] = (void*)glad_glSecondaryColor3sv;
+            glad_glSecondaryColor3sv = counted_glSecondaryColor3sv;
+        }
+        if (glad_glSecondaryColor3ub && glad_glSecondaryColor3ub != counted_glSecondaryColor3ub)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3ub] = (void*)glad_glSecondaryColor3ub;
+            glad_glSecondaryColor3ub = counted_glSecondaryColor3ub;
+        }
+        if (glad_glSecondaryColor3ubv && glad_glSecondaryColor3ubv != counted_glSecondaryColor3ubv)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3ubv] = (void*)glad_glSecondaryColor3ubv;
+            glad_glSecondaryColor3ubv = counted_glSecondaryColor3ubv;
+        }
+        if (glad_glSecondaryColor3ui && glad_glSecondaryColor3ui != counted_glSecondaryColor3ui)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3ui] = (void*)glad_glSecondaryColor3ui;
+            glad_glSecondaryColor3ui = counted_glSecondaryColor3ui;
+        }
+        if (glad_glSecondaryColor3uiv && glad_glSecondaryColor3uiv != counted_glSecondaryColor3uiv)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3uiv] = (void*)glad_glSecondaryColor3uiv;
+            glad_glSecondaryColor3uiv = counted_glSecondaryColor3uiv;
+        }
+        if (glad_glSecondaryColor3us && glad_glSecondaryColor3us != counted_glSecondaryColor3us)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3us] = (void*)glad_glSecondaryColor3us;
+            glad_glSecondaryColor3us = counted_glSecondaryColor3us;
+        }
+        if (glad_glSecondaryColor3usv && glad_glSecondaryColor3usv != counted_glSecondaryColor3usv)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3usv] = (void*)glad_glSecondaryColor3usv;
+            glad_glSecondaryColor3usv = counted_glSecondaryColor3usv;
+        }
+        if (glad_glSecondaryColorPointer && glad_glSecondaryColorPointer != counted_glSecondaryColorPointer)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColorPointer] = (void*)glad_glSecondaryColorPointer;
+            glad_glSecondaryColorPointer = counted_glSecondaryColorPointer;
+        }
+        if (glad_glWindowPos2d && glad_glWindowPos2d != counted_glWindowPos2d)
+        {
+            Table<>::loaded[ENTRY_glWindowPos2d] = (void*)glad_glWindowPos2d;
+            glad_glWindowPos2d = counted_glWindowPos2d;
+        }
+        if (glad_glWindowPos2dv && glad_glWindowPos2dv != counted_glWindowPos2dv)
+        {
+            Table<>::loaded[ENTRY_glWindowPos2dv] = (void*)glad_glWindowPos2dv;
+            glad_glWindowPos2dv = counted_glWindowPos2dv;
+        }
+        if (glad_glWindowPos2f && glad_glWindowPos2f != counted_glWindowPos2f)
+        {
+            Table<>::loaded[ENTRY_glWindowPos2f] = (void*)glad_glWindowPos2f;
+            glad_glWindowPos2f = counted_glWindowPos2f;
+        }
+        if (glad_glWindowPos2fv && glad_glWindowPos2fv != counted_glWindowPos2fv)
+        {
+            Table<>::loaded[ENTRY_glWindowPos2fv] = (void*)glad_glWindowPos2fv;
+            glad_glWindowPos2fv = counted_glWindowPos2fv;
+        }
+        if (glad_glWindowPos2i && glad_glWindowPos2i != counted_glWindowPos2i)
+        {
+            Table<>::loaded[ENTRY_glWindowPos2i] = (void*)glad_glWindowPos2i;
+            glad_glWindowPos2i = counted_glWindowPos2i;
+        }
+        if (glad_glWindowPos2iv && glad_glWindowPos2iv != counted_glWindowPos2iv)
+        {
+            Table<>::loaded[ENTRY_glWindowPos2iv] = (void*)glad_glWindowPos2iv;
+            glad_glWindowPos2iv = counted_glWindowPos2iv;
+        }
+        if (glad_glWindowPos2s && glad_glWindowPos2s != counted_glWindowPos2s)
+        {
+            Table<>::loaded[ENTRY_glWindowPos2s] = (void*)glad_glWindowPos2s;
+            glad_glWindowPos2s = counted_glWindowPos2s;
+        }
+        if (glad_glWindowPos2sv && glad_glWindowPos2sv != counted_glWindowPos2sv)
+        {
+            Table<>::loaded[ENTRY_glWindowPos2sv] = (void*)glad_glWindowPos2sv;
+            glad_glWindowPos2sv = counted_glWindowPos2sv;
+        }
+        if (glad_glWindowPos3d && glad_glWindowPos3d != counted_glWindowPos3d)
+        {
+            Table<>::loaded[ENTRY_glWindowPos3d] = (void*)glad_glWindowPos3d;
+            glad_glWindowPos3d = counted_glWindowPos3d;
+        }
+        if (glad_glWindowPos3dv && glad_glWindowPos3dv != counted_glWindowPos3dv)
+        {
+            Table<>::loaded[ENTRY_glWindowPos3dv] = (void*)glad_glWindowPos3dv;
+            glad_glWindowPos3dv = counted_glWindowPos3dv;
+        }
+        if (glad_glWindowPos3f && glad_glWindowPos3f != counted_glWindowPos3f)
+        {
+            Table<>::loaded[ENTRY_glWindowPos3f] = (void*)glad_glWindowPos3f;
+            glad_glWindowPos3f = counted_glWindowPos3f;
+        }
+        if (glad_glWindowPos3fv && glad_glWindowPos3fv != counted_glWindowPos3fv)
+        {
+            Table<>::loaded[ENTRY_glWindowPos3fv] = (void*)glad_glWindowPos3fv;
+            glad_glWindowPos3fv = counted_glWindowPos3fv;
+        }
+        if (glad_glWindowPos3i && glad_glWindowPos3i != counted_glWindowPos3i)
+        {
+            Table<>::loaded[ENTRY_glWindowPos3i] = (void*)glad_glWindowPos3i;
+            glad_glWindowPos3i = counted_glWindowPos3i;
+        }
+        if (glad_glWindowPos3iv && glad_glWindowPos3iv != counted_glWindowPos3iv)
+        {
+            Table<>::loaded[ENTRY_glWindowPos3iv] = (void*)glad_glWindowPos3iv;
+            glad_glWindowPos3iv = counted_glWindowPos3iv;
+        }
+        if (glad_glWindowPos3s && glad_glWindowPos3s != counted_glWindowPos3s)
+        {
+            Table<>::loaded[ENTRY_glWindowPos3s] = (void*)glad_glWindowPos3s;
+            glad_glWindowPos3s = counted_glWindowPos3s;
+        }
+        if (glad_glWindowPos3sv && glad_glWindowPos3sv != counted_glWindowPos3sv)
+        {
+            Table<>::loaded[ENTRY_glWindowPos3sv] = (void*)glad_glWindowPos3sv;
+            glad_glWindowPos3sv = counted_glWindowPos3sv;
+        }
+        if (glad_glBlendColor && glad_glBlendColor != counted_glBlendColor)
+        {
+            Table<>::loaded[ENTRY_glBlendColor] = (void*)glad_glBlendColor;
+            glad_glBlendColor = counted_glBlendColor;
+        }
+        if (glad_glBlendEquation && glad_glBlendEquation != counted_glBlendEquation)
+        {
+            Table<>::loaded[ENTRY_glBlendEquation] = (void*)glad_glBlendEquation;
+            glad_glBlendEquation = counted_glBlendEquation;
+        }
+        if (glad_glGenQueries && glad_glGenQueries != counted_glGenQueries)
+        {
+            Table<>::loaded[ENTRY_glGenQueries] = (void*)glad_glGenQueries;
+            glad_glGenQueries = counted_glGenQueries;
+        }
+        if (glad_glDeleteQueries && glad_glDeleteQueries != counted_glDeleteQueries)
+        {
+            Table<>::loaded[ENTRY_glDeleteQueries] = (void*)glad_glDeleteQueries;
+            glad_glDeleteQueries = counted_glDeleteQueries;
+        }
+        if (glad_glIsQuery && glad_glIsQuery != counted_glIsQuery)
+        {
+            Table<>::loaded[ENTRY_glIsQuery] = (void*)glad_glIsQuery;
+            glad_glIsQuery = counted_glIsQuery;
+        }
+        if (glad_glBeginQuery && glad_glBeginQuery != counted_glBeginQuery)
+        {
+            Table<>::loaded[ENTRY_glBeginQuery] = (void*)glad_glBeginQuery;
+            glad_glBeginQuery = counted_glBeginQuery;
+        }
+        if (glad_glEndQuery && glad_glEndQuery != counted_glEndQuery)
+        {
+            Table<>::loaded[ENTRY_glEndQuery] = (void*)glad_glEndQuery;
+            glad_glEndQuery = counted_glEndQuery;
+        }
+        if (glad_glGetQueryiv && glad_glGetQueryiv != counted_glGetQueryiv)
+        {
+            Table<>::loaded[ENTRY_glGetQueryiv] = (void*)glad_glGetQueryiv;
+            glad_glGetQueryiv = counted_glGetQueryiv;
+        }
+        if (glad_glGetQueryObjectiv && glad_glGetQueryObjectiv != counted_glGetQueryObjectiv)
+        {
+            Table<>::loaded[ENTRY_glGetQueryObjectiv] = (void*)glad_glGetQueryObjectiv;
+            glad_glGetQueryObjectiv = counted_glGetQueryObjectiv;
+        }
+        if (glad_glGetQueryObjectuiv && glad_glGetQueryObjectuiv != counted_glGetQueryObjectuiv)
+        {
+            Table<>::loaded[ENTRY_glGetQueryObjectuiv] = (void*)glad_glGetQueryObjectuiv;
+            glad_glGetQueryObjectuiv = counted_glGetQueryObjectuiv;
+        }
+        if (glad_glBindBuffer && glad_glBindBuffer != counted_glBindBuffer)
+        {
+            Table<>::loaded[ENTRY_glBindBuffer] = (void*)glad_glBindBuffer;
+            glad_glBindBuffer = counted_glBindBuffer;
+        }
+        if (glad_glDeleteBuffers && glad_glDeleteBuffers != counted_glDeleteBuffers)
+        {
+            Table<>::loaded[ENTRY_glDeleteBuffers] = (void*)glad_glDeleteBuffers;
+            glad_glDeleteBuffers = counted_glDeleteBuffers;
+        }
+        if (glad_glGenBuffers && glad_glGenBuffers != counted_glGenBuffers)
+        {
+            Table<>::loaded[ENTRY_glGenBuffers] = (void*)glad_glGenBuffers;
+            glad_glGenBuffers = counted_glGenBuffers;
+        }
+        if (glad_glIsBuffer && glad_glIsBuffer != counted_glIsBuffer)
+        {
+            Table<>::loaded[ENTRY_glIsBuffer] = (void*)glad_glIsBuffer;
+            glad_glIsBuffer = counted_glIsBuffer;
+        }
+        if (glad_glBufferData && glad_glBufferData != counted_glBufferData)
+        {
+            Table<>::loaded[ENTRY_glBufferData] = (void*)glad_glBufferData;
+            glad_glBufferData = counted_glBufferData;
+        }
+        if (glad_glBufferSubData && glad_glBufferSubData != counted_glBufferSubData)
+        {
+            Table<>::loaded[ENTRY_glBufferSubData] = (void*)glad_glBufferSubData;
+            glad_glBufferSubData = counted_glBufferSubData;
+        }
+        if (glad_glGetBufferSubData && glad_glGetBufferSubData != counted_glGetBufferSubData)
+        {
+            Table<>::loaded[ENTRY_glGetBufferSubData] = (void*)glad_glGetBufferSubData;
+            glad_glGetBufferSubData = counted_glGetBufferSubData;
+        }
+        if (glad_glMapBuffer && glad_glMapBuffer != counted_glMapBuffer)
+        {
+            Table<>::loaded[ENTRY_glMapBuffer] = (void*)glad_glMapBuffer;
+            glad_glMapBuffer = counted_glMapBuffer;
+        }
+        if (glad_glUnmapBuffer && glad_glUnmapBuffer != counted_glUnmapBuffer)
+        {
+            Table<>::loaded[ENTRY_glUnmapBuffer] = (void*)glad_glUnmapBuffer;
+            glad_glUnmapBuffer = counted_glUnmapBuffer;
+        }
+        if (glad_glGetBufferParameteriv && glad_glGetBufferParameteriv != counted_glGetBufferParameteriv)
+        {
+            Table<>::loaded[ENTRY_glGetBufferParameteriv] = (void*)glad_glGetBufferParameteriv;
+            glad_glGetBufferParameteriv = counted_glGetBufferParameteriv;
+        }
+        if (glad_glGetBufferPointerv && glad_glGetBufferPointerv != counted_glGetBufferPointerv)
+        {
+            Table<>::loaded[ENTRY_glGetBufferPointerv] = (void*)glad_glGetBufferPointerv;
+            glad_glGetBufferPointerv = counted_glGetBufferPointerv;
+        }
+        if (glad_glBlendEquationSeparate && glad_glBlendEquationSeparate != counted_glBlendEquationSeparate)
+        {
+            Table<>::loaded[ENTRY_glBlendEquationSeparate] = (void*)glad_glBlendEquationSeparate;
+            glad_glBlendEquationSeparate = counted_glBlendEquationSeparate;
+        }
+        if (glad_glDrawBuffers && glad_glDrawBuffers != counted_glDrawBuffers)
+        {
+            Table<>::loaded[ENTRY_glDrawBuffers] = (void*)glad_glDrawBuffers;
+            glad_glDrawBuffers = counted_glDrawBuffers;
+        }
+        if (glad_glStencilOpSeparate && glad_glStencilOpSeparate != counted_glStencilOpSeparate)
+        {
+            Table<>::loaded[ENTRY_glStencilOpSeparate] = (void*)glad_glStencilOpSeparate;
+            glad_glStencilOpSeparate = counted_glStencilOpSeparate;
+        }
+        if (glad_glStencilFuncSeparate && glad_glStencilFuncSeparate != counted_glStencilFuncSeparate)
+        {
+            Table<>::loaded[ENTRY_glStencilFuncSeparate] = (void*)glad_glStencilFuncSeparate;
+            glad_glStencilFuncSeparate = counted_glStencilFuncSeparate;
+        }
+        if (glad_glStencilMaskSeparate && glad_glStencilMaskSeparate != counted_glStencilMaskSeparate)
+        {
+            Table<>::loaded[ENTRY_glStencilMaskSeparate] = (void*)glad_glStencilMaskSeparate;
+            glad_glStencilMaskSeparate = counted_glStencilMaskSeparate;
+        }
+        if (glad_glAttachShader && glad_glAttachShader != counted_glAttachShader)
+        {
+            Table<>::loaded[ENTRY_glAttachShader] = (void*)glad_glAttachShader;
+            glad_glAttachShader = counted_glAttachShader;
+        }
+        if (glad_glBindAttribLocation && glad_glBindAttribLocation != counted_glBindAttribLocation)
+        {
+            Table<>::loaded[ENTRY_glBindAttribLocation] = (void*)glad_glBindAttribLocation;
+            glad_glBindAttribLocation = counted_glBindAttribLocation;
+        }
+        if (glad_glCompileShader && glad_glCompileShader != counted_glCompileShader)
+        {
+            Table<>::loaded[ENTRY_glCompileShader] = (void*)glad_glCompileShader;
+            glad_glCompileShader = counted_glCompileShader;
+        }
+        if (glad_glCreateProgram && glad_glCreateProgram != counted_glCreateProgram)
+        {
+            Table<>::loaded[ENTRY_glCreateProgram] = (void*)glad_glCreateProgram;
+            glad_glCreateProgram = counted_glCreateProgram;
+        }
+        if (glad_glCreateShader && glad_glCreateShader != counted_glCreateShader)
+        {
+            Table<>::loaded[ENTRY_glCreateShader] = (void*)glad_glCreateShader;
+            glad_glCreateShader = counted_glCreateShader;
+        }
+        if (glad_glDeleteProgram && glad_glDeleteProgram != counted_glDeleteProgram)
+        {
+            Table<>::loaded[ENTRY_glDeleteProgram] = (void*)glad_glDeleteProgram;
+            glad_glDeleteProgram = counted_glDeleteProgram;
+        }
+        if (glad_glDeleteShader && glad_glDeleteShader != counted_glDeleteShader)
+        {
+            Table<>::loaded[ENTRY_glDeleteShader] = (void*)glad_glDeleteShader;
+            glad_glDeleteShader = counted_glDeleteShader;
+        }
+        if (glad_glDetachShader && glad_glDetachShader != counted_glDetachShader)
+        {
+            Table<>::loaded[ENTRY_glDetachShader] = (void*)glad_glDetachShader;
+            glad_glDetachShader = counted_glDetachShader;
+        }
+        if (glad_glDisableVertexAttribArray && glad_glDisableVertexAttribArray != counted_glDisableVertexAttribArray)
+        {
+            Table<>::loaded[ENTRY_glDisableVertexAttribArray] = (void*)glad_glDisableVertexAttribArray;
+            glad_glDisableVertexAttribArray = counted_glDisableVertexAttribArray;
+        }
+        if (glad_glEnableVertexAttribArray && glad_glEnableVertexAttribArray != counted_glEnableVertexAttribArray)
+        {
+            Table<>::loaded[ENTRY_glEnableVertexAttribArray] = (void*)glad_glEnableVertexAttribArray;
+            glad_glEnableVertexAttribArray = counted_glEnableVertexAttribArray;
+        }
+        if (glad_glGetActiveAttrib && glad_glGetActiveAttrib != counted_glGetActiveAttrib)
+        {
+            Table<>::loaded[ENTRY_glGetActiveAttrib] = (void*)glad_glGetActiveAttrib;
+            glad_glGetActiveAttrib = counted_glGetActiveAttrib;
+        }
+        if (glad_glGetActiveUniform && glad_glGetActiveUniform != counted_glGetActiveUniform)
+        {
+            Table<>::loaded[ENTRY_glGetActiveUniform] = (void*)glad_glGetActiveUniform;
+            glad_glGetActiveUniform = counted_glGetActiveUniform;
+        }
+        if (glad_glGetAttachedShaders && glad_glGetAttachedShaders != counted_glGetAttachedShaders)
+        {
+            Table<>::loaded[ENTRY_glGetAttachedShaders] = (void*)glad_glGetAttachedShaders;
+            glad_glGetAttachedShaders = counted_glGetAttachedShaders;
+        }
+        if (glad_glGetAttribLocation && glad_glGetAttribLocation != counted_glGetAttribLocation)
+        {
+            Table<>::loaded[ENTRY_glGetAttribLocation] = (void*)glad_glGetAttribLocation;
+            glad_glGetAttribLocation = counted_glGetAttribLocation;
+        }
+        if (glad_glGetProgramiv && glad_glGetProgramiv != counted_glGetProgramiv)
+        {
+            Table<>::loaded[ENTRY_glGetProgramiv] = (void*)glad_glGetProgramiv;
+            glad_glGetProgramiv = counted_glGetProgramiv;
+        }
+        if (glad_glGetProgramInfoLog && glad_glGetProgramInfoLog != counted_glGetProgramInfoLog)
+        {
+            Table<>::loaded[ENTRY_glGetProgramInfoLog] = (void*)glad_glGetProgramInfoLog;
+            glad_glGetProgramInfoLog = counted_glGetProgramInfoLog;
+        }
+        if (glad_glGetShaderiv && glad_glGetShaderiv != counted_glGetShaderiv)
+        {
+            Table<>::loaded[ENTRY_glGetShaderiv] = (void*)glad_glGetShaderiv;
+            glad_glGetShaderiv = counted_glGetShaderiv;
+        }
+        if (glad_glGetShaderInfoLog && glad_glGetShaderInfoLog != counted_glGetShaderInfoLog)
+        {
+            Table<>::loaded[ENTRY_glGetShaderInfoLog] = (void*)glad_glGetShaderInfoLog;
+            glad_glGetShaderInfoLog = counted_glGetShaderInfoLog;
+        }
+        if (glad_glGetShaderSource && glad_glGetShaderSource != counted_glGetShaderSource)
+        {
+            Table<>::loaded[ENTRY_glGetShaderSource] = (void*)glad_glGetShaderSource;
+            glad_glGetShaderSource = counted_glGetShaderSource;
+        }
+        if (glad_glGetUniformLocation && glad_glGetUniformLocation != counted_glGetUniformLocation)
+        {
+            Table<>::loaded[ENTRY_glGetUniformLocation] = (void*)glad_glGetUniformLocation;
+            glad_glGetUniformLocation = counted_glGetUniformLocation;
+        }
+        if (glad_glGetUniformfv && glad_glGetUniformfv != counted_glGetUniformfv)
+        {
+            Table<>::loaded[ENTRY_glGetUniformfv] = (void*)glad_glGetUniformfv;
+            glad_glGetUniformfv = counted_glGetUniformfv;
+        }
+        if (glad_glGetUniformiv && glad_glGetUniformiv != counted_glGetUniformiv)
+        {
+            Table<>::loaded[ENTRY_glGetUniformiv] = (void*)glad_glGetUniformiv;
+            glad_glGetUniformiv = counted_glGetUniformiv;
+        }
+        if (glad_glGetVertexAttribdv && glad_glGetVertexAttribdv != counted_glGetVertexAttribdv)
+        {
+            Table<>::loaded[ENTRY_glGetVertexAttribdv] = (void*)glad_glGetVertexAttribdv;
+            glad_glGetVertexAttribdv = counted_glGetVertexAttribdv;
+        }
+        if (glad_glGetVertexAttribfv && glad_glGetVertexAttribfv != counted_glGetVertexAttribfv)
+        {
+            Table<>::loaded[ENTRY_glGetVertexAttribfv] = (void*)glad_glGetVertexAttribfv;
+            glad_glGetVertexAttribfv = counted_glGetVertexAttribfv;
+        }
+        if (glad_glGetVertexAttribiv && glad_glGetVertexAttribiv != counted_glGetVertexAttribiv)
+        {
+            Table<>::loaded[ENTRY_glGetVertexAttribiv] = (void*)glad_glGetVertexAttribiv;
+            glad_glGetVertexAttribiv = counted_glGetVertexAttribiv;
+        }
+        if (glad_glGetVertexAttribPointerv && glad_glGetVertexAttribPointerv != counted_glGetVertexAttribPointerv)
+        {
+            Table<>::loaded[ENTRY_glGetVertexAttribPointerv] = (void*)glad_glGetVertexAttribPointerv;
+            glad_glGetVertexAttribPointerv = counted_glGetVertexAttribPointerv;
+        }
+        if (glad_glIsProgram && glad_glIsProgram != counted_glIsProgram)
+        {
+            Table<>::loaded[ENTRY_glIsProgram] = (void*)glad_glIsProgram;
+            glad_glIsProgram = counted_glIsProgram;
+        }
+        if (glad_glIsShader && glad_glIsShader != counted_glIsShader)
+        {
+            Table<>::loaded[ENTRY_glIsShader] = (void*)glad_glIsShader;
+            glad_glIsShader = counted_glIsShader;
+        }
+        if (glad_glLinkProgram && glad_glLinkProgram != counted_glLinkProgram)
+        {
+            Table<>::loaded[ENTRY_glLinkProgram] = (void*)glad_glLinkProgram;
+            glad_glLinkProgram = counted_glLinkProgram;
+        }
+        if (glad_glShaderSource && glad_glShaderSource != counted_glShaderSource)
+        {
+            Table<>::loaded[ENTRY_glShaderSource] = (void*)glad_glShaderSource;
+            glad_glShaderSource = counted_glShaderSource;
+        }
+        if (glad_glUseProgram && glad_glUseProgram != counted_glUseProgram)
+        {
+            Table<>::loaded[ENTRY_glUseProgram] = (void*)glad_glUseProgram;
+            glad_glUseProgram = counted_glUseProgram;
+        }
+        if (glad_glUniform1f && glad_glUniform1f != counted_glUniform1f)
+        {
+            Table<>::loaded[ENTRY_glUniform1f] = (void*)glad_glUniform1f;
+            glad_glUniform1f = counted_glUniform1f;
+        }
+        if (glad_glUniform2f && glad_glUniform2f != counted_glUniform2f)
+        {
+            Table<>::loaded[ENTRY_glUniform2f] = (void*)glad_glUniform2f;
+            glad_glUniform2f = counted_glUniform2f;
+        }
+        if (glad_glUniform3f && glad_glUniform3f != counted_glUniform3f)
+        {
+            Table<>::loaded[ENTRY_glUniform3f] = (void*)glad_glUniform3f;
+            glad_glUniform3f = counted_glUniform3f;
+        }
+        if (glad_glUniform4f && glad_glUniform4f != counted_glUniform4f)
+        {
+            Table<>::loaded[ENTRY_glUniform4f] = (void*)glad_glUniform4f;
+            glad_glUniform4f = counted_glUniform4f;
+        }
+        if (glad_glUniform1i && glad_glUniform1i != counted_glUniform1i)
+        {
+            Table<>::loaded[ENTRY_glUniform1i] = (void*)glad_glUniform1i;
+            glad_glUniform1i = counted_glUniform1i;
+        }
+        if (glad_glUniform2i && glad_glUniform2i != counted_glUniform2i)
+        {
+            Table<>::loaded[ENTRY_glUniform2i] = (void*)glad_glUniform2i;
+            glad_glUniform2i = counted_glUniform2i;
+        }
+        if (glad_glUniform3i && glad_glUniform3i != counted_glUniform3i)
+        {
+            Table<>::loaded[ENTRY_glUniform3i] = (void*)glad_glUniform3i;
+            glad_glUniform3i = counted_glUniform3i;
+        }
+        if (glad_glUniform4i && glad_glUniform4i != counted_glUniform4i)
+        {
+            Table<>::loaded[ENTRY_glUniform4i] = (void*)glad_glUniform4i;
+            glad_glUniform4i = counted_glUniform4i;
+        }
+        if (glad_glUniform1fv && glad_glUniform1fv != counted_glUniform1fv)
+        {
+            Table<>::loaded[ENTRY_glUniform1fv] = (void*)glad_glUniform1fv;
+            glad_glUniform1fv = counted_glUniform1fv;
+        }
+        if (glad_glUniform2fv && glad_glUniform2fv != counted_glUniform2fv)
+        {
+            Table<>::loaded[ENTRY_glUniform2fv] = (void*)glad_glUniform2fv;
+            glad_glUniform2fv = counted_glUniform2fv;
+        }
+        if (glad_glUniform3fv && glad_glUniform3fv != counted_glUniform3fv)
+        {
+            Table<>::loaded[ENTRY_glUniform3fv] = (void*)glad_glUniform3fv;
+            glad_glUniform3fv = counted_glUniform3fv;
+        }
+        if (glad_glUniform4fv && glad_glUniform4fv != counted_glUniform4fv)
+        {
+            Table<>::loaded[ENTRY_glUniform4fv] = (void*)glad_glUniform4fv;
+            glad_glUniform4fv = counted_glUniform4fv;
+        }
+        if (glad_glUniform1iv && glad_glUniform1iv != counted_glUniform1iv)
+        {
+            Table<>::loaded[ENTRY_glUniform1iv] = (void*)glad_glUniform1iv;
+            glad_glUniform1iv = counted_glUniform1iv;
+        }
+        if (glad_glUniform2iv && glad_glUniform2iv != counted_glUniform2iv)
+        {
+            Table<>::loaded[ENTRY_glUniform2iv] = (void*)glad_glUniform2iv;
+            glad_glUniform2iv = counted_glUniform2iv;
+        }
+        if (glad_glUniform3iv && glad_glUniform3iv != counted_glUniform3iv)
+        {
+            Table<>::loaded[ENTRY_glUniform3iv] = (void*)glad_glUniform3iv;
+            glad_glUniform3iv = counted_glUniform3iv;
+        }
+        if (glad_glUniform4iv && glad_glUniform4iv != counted_glUniform4iv)
+        {
+            Table<>::loaded[ENTRY_glUniform4iv] = (void*)glad_glUniform4iv;
+            glad_glUniform4iv = counted_glUniform4iv;
+        }
+        if (glad_glUniformMatrix2fv && glad_glUniformMatrix2fv != counted_glUniformMatrix2fv)
+        {
+            Table<>::loaded[ENTRY_glUniformMatrix2fv] = (void*)glad_glUniformMatrix2fv;
+            glad_glUniformMatrix2fv = counted_glUniformMatrix2fv;
+        }
+        if (glad_glUniformMatrix3fv && glad_glUniformMatrix3fv != counted_glUniformMatrix3fv)
+        {
+            Table<>::loaded[ENTRY_glUniformMatrix3fv] = (void*)glad_glUniformMatrix3fv;
+            glad_glUniformMatrix3fv = counted_glUniformMatrix3fv;
+        }
+        if (glad_glUniformMatrix4fv && glad_glUniformMatrix4fv != counted_glUniformMatrix4fv)
+        {
+            Table<>::loaded[ENTRY_glUniformMatrix4fv] = (void*)glad_glUniformMatrix4fv;
+            glad_glUniformMatrix4fv = counted_glUniformMatrix4fv;
+        }
+        if (glad_glValidateProgram && glad_glValidateProgram != counted_glValidateProgram)
+        {
+            Table<>::loaded[ENTRY_glValidateProgram] = (void*)glad_glValidateProgram;
+            glad_glValidateProgram = counted_glValidateProgram;
+        }
+        if (glad_glVertexAttrib1d && glad_glVertexAttrib1d != counted_glVertexAttrib1d)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib1d] = (void*)glad_glVertexAttrib1d;
+            glad_glVertexAttrib1d = counted_glVertexAttrib1d;
+        }
+        if (glad_glVertexAttrib1dv && glad_glVertexAttrib1dv != counted_glVertexAttrib1dv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib1dv] = (void*)glad_glVertexAttrib1dv;
+            glad_glVertexAttrib1dv = counted_glVertexAttrib1dv;
+        }
+        if (glad_glVertexAttrib1f && glad_glVertexAttrib1f != counted_glVertexAttrib1f)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib1f] = (void*)glad_glVertexAttrib1f;
+            glad_glVertexAttrib1f = counted_glVertexAttrib1f;
+        }
+        if (glad_glVertexAttrib1fv && glad_glVertexAttrib1fv != counted_glVertexAttrib1fv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib1fv] = (void*)glad_glVertexAttrib1fv;
+            glad_glVertexAttrib1fv = counted_glVertexAttrib1fv;
+        }
+        if (glad_glVertexAttrib1s && glad_glVertexAttrib1s != counted_glVertexAttrib1s)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib1s] = (void*)glad_glVertexAttrib1s;
+            glad_glVertexAttrib1s = counted_glVertexAttrib1s;
+        }
+        if (glad_glVertexAttrib1sv && glad_glVertexAttrib1sv != counted_glVertexAttrib1sv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib1sv] = (void*)glad_glVertexAttrib1sv;
+            glad_glVertexAttrib1sv = counted_glVertexAttrib1sv;
+        }
+        if (glad_glVertexAttrib2d && glad_glVertexAttrib2d != counted_glVertexAttrib2d)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib2d] = (void*)glad_glVertexAttrib2d;
+            glad_glVertexAttrib2d = counted_glVertexAttrib2d;
+        }
+        if (glad_glVertexAttrib2dv && glad_glVertexAttrib2dv != counted_glVertexAttrib2dv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib2dv] = (void*)glad_glVertexAttrib2dv;
+            glad_glVertexAttrib2dv = counted_glVertexAttrib2dv;
+        }
+        if (glad_glVertexAttrib2f && glad_glVertexAttrib2f != counted_glVertexAttrib2f)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib2f] = (void*)glad_glVertexAttrib2f;
+            glad_glVertexAttrib2f = counted_glVertexAttrib2f;
+        }
+        if (glad_glVertexAttrib2fv && glad_glVertexAttrib2fv != counted_glVertexAttrib2fv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib2fv] = (void*)glad_glVertexAttrib2fv;
+            glad_glVertexAttrib2fv = counted_glVertexAttrib2fv;
+        }
+        if (glad_glVertexAttrib2s && glad_glVertexAttrib2s != counted_glVertexAttrib2s)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib2s] = (void*)glad_glVertexAttrib2s;
+            glad_glVertexAttrib2s = counted_glVertexAttrib2s;
+        }
+        if (glad_glVertexAttrib2sv && glad_glVertexAttrib2sv != counted_glVertexAttrib2sv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib2sv] = (void*)glad_glVertexAttrib2sv;
+            glad_glVertexAttrib2sv = counted_glVertexAttrib2sv;
+        }
+        if (glad_glVertexAttrib3d && glad_glVertexAttrib3d != counted_glVertexAttrib3d)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib3d] = (void*)glad_glVertexAttrib3d;
+            glad_glVertexAttrib3d = counted_glVertexAttrib3d;
+        }
+        if (glad_glVertexAttrib3dv && glad_glVertexAttrib3dv != counted_glVertexAttrib3dv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib3dv] = (void*)glad_glVertexAttrib3dv;
+            glad_glVertexAttrib3dv = counted_glVertexAttrib3dv;
+        }
+        if (glad_glVertexAttrib3f && glad_glVertexAttrib3f != counted_glVertexAttrib3f)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib3f] = (void*)glad_glVertexAttrib3f;
+            glad_glVertexAttrib3f = counted_glVertexAttrib3f;
+        }
+        if (glad_glVertexAttrib3fv && glad_glVertexAttrib3fv != counted_glVertexAttrib3fv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib3fv] = (void*)glad_glVertexAttrib3fv;
+            glad_glVertexAttrib3fv = counted_glVertexAttrib3fv;
+        }
+        if (glad_glVertexAttrib3s && glad_glVertexAttrib3s != counted_glVertexAttrib3s)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib3s] = (void*)glad_glVertexAttrib3s;
+            glad_glVertexAttrib3s = counted_glVertexAttrib3s;
+        }
+        if (glad_glVertexAttrib3sv && glad_glVertexAttrib3sv != counted_glVertexAttrib3sv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib3sv] = (void*)glad_glVertexAttrib3sv;
+            glad_glVertexAttrib3sv = counted_glVertexAttrib3sv;
+        }
+        if (glad_glVertexAttrib4Nbv && glad_glVertexAttrib4Nbv != counted_glVertexAttrib4Nbv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4Nbv] = (void*)glad_glVertexAttrib4Nbv;
+            glad_glVertexAttrib4Nbv = counted_glVertexAttrib4Nbv;
+        }
+        if (glad_glVertexAttrib4Niv && glad_glVertexAttrib4Niv != counted_glVertexAttrib4Niv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4Niv] = (void*)glad_glVertexAttrib4Niv;
+            glad_glVertexAttrib4Niv = counted_glVertexAttrib4Niv;
+        }
+        if (glad_glVertexAttrib4Nsv && glad_glVertexAttrib4Nsv != counted_glVertexAttrib4Nsv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4Nsv] = (void*)glad_glVertexAttrib4Nsv;
+            glad_glVertexAttrib4Nsv = counted_glVertexAttrib4Nsv;
+        }
+        if (glad_glVertexAttrib4Nub && glad_glVertexAttrib4Nub != counted_glVertexAttrib4Nub)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4Nub] = (void*)glad_glVertexAttrib4Nub;
+            glad_glVertexAttrib4Nub = counted_glVertexAttrib4Nub;
+        }
+        if (glad_glVertexAttrib4Nubv && glad_glVertexAttrib4Nubv != counted_glVertexAttrib4Nubv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4Nubv] = (void*)glad_glVertexAttrib4Nubv;
+            glad_glVertexAttrib4Nubv = counted_glVertexAttrib4Nubv;
+        }
+        if (glad_glVertexAttrib4Nuiv && glad_glVertexAttrib4Nuiv != counted_glVertexAttrib4Nuiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4Nuiv] = (void*)glad_glVertexAttrib4Nuiv;
+            glad_glVertexAttrib4Nuiv = counted_glVertexAttrib4Nuiv;
+        }
+        if (glad_glVertexAttrib4Nusv && glad_glVertexAttrib4Nusv != counted_glVertexAttrib4Nusv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4Nusv] = (void*)glad_glVertexAttrib4Nusv;
+            glad_glVertexAttrib4Nusv = counted_glVertexAttrib4Nusv;
+        }
+        if (glad_glVertexAttrib4bv && glad_glVertexAttrib4bv != counted_glVertexAttrib4bv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4bv] = (void*)glad_glVertexAttrib4bv;
+            glad_glVertexAttrib4bv = counted_glVertexAttrib4bv;
+        }
+        if (glad_glVertexAttrib4d && glad_glVertexAttrib4d != counted_glVertexAttrib4d)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4d] = (void*)glad_glVertexAttrib4d;
+            glad_glVertexAttrib4d = counted_glVertexAttrib4d;
+        }
+        if (glad_glVertexAttrib4dv && glad_glVertexAttrib4dv != counted_glVertexAttrib4dv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4dv] = (void*)glad_glVertexAttrib4dv;
+            glad_glVertexAttrib4dv = counted_glVertexAttrib4dv;
+        }
+        if (glad_glVertexAttrib4f && glad_glVertexAttrib4f != counted_glVertexAttrib4f)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4f] = (void*)glad_glVertexAttrib4f;
+            glad_glVertexAttrib4f = counted_glVertexAttrib4f;
+        }
+        if (glad_glVertexAttrib4fv && glad_glVertexAttrib4fv != counted_glVertexAttrib4fv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4fv] = (void*)glad_glVertexAttrib4fv;
+            glad_glVertexAttrib4fv = counted_glVertexAttrib4fv;
+        }
+        if (glad_glVertexAttrib4iv && glad_glVertexAttrib4iv != counted_glVertexAttrib4iv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4iv] = (void*)glad_glVertexAttrib4iv;
+            glad_glVertexAttrib4iv = counted_glVertexAttrib4iv;
+        }
+        if (glad_glVertexAttrib4s && glad_glVertexAttrib4s != counted_glVertexAttrib4s)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4s] = (void*)glad_glVertexAttrib4s;
+            glad_glVertexAttrib4s = counted_glVertexAttrib4s;
+        }
+        if (glad_glVertexAttrib4sv && glad_glVertexAttrib4sv != counted_glVertexAttrib4sv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4sv] = (void*)glad_glVertexAttrib4sv;
+            glad_glVertexAttrib4sv = counted_glVertexAttrib4sv;
+        }
+        if (glad_glVertexAttrib4ubv && glad_glVertexAttrib4ubv != counted_glVertexAttrib4ubv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4ubv] = (void*)glad_glVertexAttrib4ubv;
+            glad_glVertexAttrib4ubv = counted_glVertexAttrib4ubv;
+        }
+        if (glad_glVertexAttrib4uiv && glad_glVertexAttrib4uiv != counted_glVertexAttrib4uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4uiv] = (void*)glad_glVertexAttrib4uiv;
+            glad_glVertexAttrib4uiv = counted_glVertexAttrib4uiv;
+        }
+        if (glad_glVertexAttrib4usv && glad_glVertexAttrib4usv != counted_glVertexAttrib4usv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4usv] = (void*)glad_glVertexAttrib4usv;
+            glad_glVertexAttrib4usv = counted_glVertexAttrib4usv;
+        }
+        if (glad_glVertexAttribPointer && glad_glVertexAttribPointer != counted_glVertexAttribPointer)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribPointer] = (void*)glad_glVertexAttribPointer;
+            glad_glVertexAttribPointer = counted_glVertexAttribPointer;
+        }
+        if (glad_glUniformMatrix2x3fv && glad_glUniformMatrix2x3fv != counted_glUniformMatrix2x3fv)
+        {
+            Table<>::loaded[ENTRY_glUniformMatrix2x3fv] = (void*)glad_glUniformMatrix2x3fv;
+            glad_glUniformMatrix2x3fv = counted_glUniformMatrix2x3fv;
+        }
+        if (glad_glUniformMatrix3x2fv && glad_glUniformMatrix3x2fv != counted_glUniformMatrix3x2fv)
+        {
+            Table<>::loaded[ENTRY_glUniformMatrix3x2fv] = (void*)glad_glUniformMatrix3x2fv;
+            glad_glUniformMatrix3x2fv = counted_glUniformMatrix3x2fv;
+        }
+        if (glad_glUniformMatrix2x4fv && glad_glUniformMatrix2x4fv != counted_glUniformMatrix2x4fv)
+        {
+            Table<>::loaded[ENTRY_glUniformMatrix2x4fv] = (void*)glad_glUniformMatrix2x4fv;
+            glad_glUniformMatrix2x4fv = counted_glUniformMatrix2x4fv;
+        }
+        if (glad_glUniformMatrix4x2fv && glad_glUniformMatrix4x2fv != counted_glUniformMatrix4x2fv)
+        {
+            Table<>::loaded[ENTRY_glUniformMatrix4x2fv] = (void*)glad_glUniformMatrix4x2fv;
+            glad_glUniformMatrix4x2fv = counted_glUniformMatrix4x2fv;
+        }
+        if (glad_glUniformMatrix3x4fv && glad_glUniformMatrix3x4fv != counted_glUniformMatrix3x4fv)
+        {
+            Table<>::loaded[ENTRY_glUniformMatrix3x4fv] = (void*)glad_glUniformMatrix3x4fv;
+            glad_glUniformMatrix3x4fv = counted_glUniformMatrix3x4fv;
+        }
+        if (glad_glUniformMatrix4x3fv && glad_glUniformMatrix4x3fv != counted_glUniformMatrix4x3fv)
+        {
+            Table<>::loaded[ENTRY_glUniformMatrix4x3fv] = (void*)glad_glUniformMatrix4x3fv;
+            glad_glUniformMatrix4x3fv = counted_glUniformMatrix4x3fv;
+        }
+        if (glad_glColorMaski && glad_glColorMaski != counted_glColorMaski)
+        {
+            Table<>::loaded[ENTRY_glColorMaski] = (void*)glad_glColorMaski;
+            glad_glColorMaski = counted_glColorMaski;
+        }
+        if (glad_glGetBooleani_v && glad_glGetBooleani_v != counted_glGetBooleani_v)
+        {
+            Table<>::loaded[ENTRY_glGetBooleani_v] = (void*)glad_glGetBooleani_v;
+            glad_glGetBooleani_v = counted_glGetBooleani_v;
+        }
+        if (glad_glGetIntegeri_v && glad_glGetIntegeri_v != counted_glGetIntegeri_v)
+        {
+            Table<>::loaded[ENTRY_glGetIntegeri_v] = (void*)glad_glGetIntegeri_v;
+            glad_glGetIntegeri_v = counted_glGetIntegeri_v;
+        }
+        if (glad_glEnablei && glad_glEnablei != counted_glEnablei)
+        {
+            Table<>::loaded[ENTRY_glEnablei] = (void*)glad_glEnablei;
+            glad_glEnablei = counted_glEnablei;
+        }
+        if (glad_glDisablei && glad_glDisablei != counted_glDisablei)
+        {
+            Table<>::loaded[ENTRY_glDisablei] = (void*)glad_glDisablei;
+            glad_glDisablei = counted_glDisablei;
+        }
+        if (glad_glIsEnabledi && glad_glIsEnabledi != counted_glIsEnabledi)
+        {
+            Table<>::loaded[ENTRY_glIsEnabledi] = (void*)glad_glIsEnabledi;
+            glad_glIsEnabledi = counted_glIsEnabledi;
+        }
+        if (glad_glBeginTransformFeedback && glad_glBeginTransformFeedback != counted_glBeginTransformFeedback)
+        {
+            Table<>::loaded[ENTRY_glBeginTransformFeedback] = (void*)glad_glBeginTransformFeedback;
+            glad_glBeginTransformFeedback = counted_glBeginTransformFeedback;
+        }
+        if (glad_glEndTransformFeedback && glad_glEndTransformFeedback != counted_glEndTransformFeedback)
+        {
+            Table<>::loaded[ENTRY_glEndTransformFeedback] = (void*)glad_glEndTransformFeedback;
+            glad_glEndTransformFeedback = counted_glEndTransformFeedback;
+        }
+        if (glad_glBindBufferRange && glad_glBindBufferRange != counted_glBindBufferRange)
+        {
+            Table<>::loaded[ENTRY_glBindBufferRange] = (void*)glad_glBindBufferRange;
+            glad_glBindBufferRange = counted_glBindBufferRange;
+        }
+        if (glad_glBindBufferBase && glad_glBindBufferBase != counted_glBindBufferBase)
+        {
+            Table<>::loaded[ENTRY_glBindBufferBase] = (void*)glad_glBindBufferBase;
+            glad_glBindBufferBase = counted_glBindBufferBase;
+        }
+        if (glad_glTransformFeedbackVaryings && glad_glTransformFeedbackVaryings != counted_glTransformFeedbackVaryings)
+        {
+            Table<>::loaded[ENTRY_glTransformFeedbackVaryings] = (void*)glad_glTransformFeedbackVaryings;
+            glad_glTransformFeedbackVaryings = counted_glTransformFeedbackVaryings;
+        }
+        if (glad_glGetTransformFeedbackVarying && glad_glGetTransformFeedbackVarying != counted_glGetTransformFeedbackVarying)
+        {
+            Table<>::loaded[ENTRY_glGetTransformFeedbackVarying] = (void*)glad_glGetTransformFeedbackVarying;
+            glad_glGetTransformFeedbackVarying = counted_glGetTransformFeedbackVarying;
+        }
+        if (glad_glClampColor && glad_glClampColor != counted_glClampColor)
+        {
+            Table<>::loaded[ENTRY_glClampColor] = (void*)glad_glClampColor;
+            glad_glClampColor = counted_glClampColor;
+        }
+        if (glad_glBeginConditionalRender && glad_glBeginConditionalRender != counted_glBeginConditionalRender)
+        {
+            Table<>::loaded[ENTRY_glBeginConditionalRender] = (void*)glad_glBeginConditionalRender;
+            glad_glBeginConditionalRender = counted_glBeginConditionalRender;
+        }
+        if (glad_glEndConditionalRender && glad_glEndConditionalRender != counted_glEndConditionalRender)
+        {
+            Table<>::loaded[ENTRY_glEndConditionalRender] = (void*)glad_glEndConditionalRender;
+            glad_glEndConditionalRender = counted_glEndConditionalRender;
+        }
+        if (glad_glVertexAttribIPointer && glad_glVertexAttribIPointer != counted_glVertexAttribIPointer)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribIPointer] = (void*)glad_glVertexAttribIPointer;
+            glad_glVertexAttribIPointer = counted_glVertexAttribIPointer;
+        }
+        if (glad_glGetVertexAttribIiv && glad_glGetVertexAttribIiv != counted_glGetVertexAttribIiv)
+        {
+            Table<>::loaded[ENTRY_glGetVertexAttribIiv] = (void*)glad_glGetVertexAttribIiv;
+            glad_glGetVertexAttribIiv = counted_glGetVertexAttribIiv;
+        }
+        if (glad_glGetVertexAttribIuiv && glad_glGetVertexAttribIuiv != counted_glGetVertexAttribIuiv)
+        {
+            Table<>::loaded[ENTRY_glGetVertexAttribIuiv] = (void*)glad_glGetVertexAttribIuiv;
+            glad_glGetVertexAttribIuiv = counted_glGetVertexAttribIuiv;
+        }
+        if (glad_glVertexAttribI1i && glad_glVertexAttribI1i != counted_glVertexAttribI1i)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI1i] = (void*)glad_glVertexAttribI1i;
+            glad_glVertexAttribI1i = counted_glVertexAttribI1i;
+        }
+        if (glad_glVertexAttribI2i && glad_glVertexAttribI2i != counted_glVertexAttribI2i)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI2i] = (void*)glad_glVertexAttribI2i;
+            glad_glVertexAttribI2i = counted_glVertexAttribI2i;
+        }
+        if (glad_glVertexAttribI3i && glad_glVertexAttribI3i != counted_glVertexAttribI3i)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI3i] = (void*)glad_glVertexAttribI3i;
+            glad_glVertexAttribI3i = counted_glVertexAttribI3i;
+        }
+        if (glad_glVertexAttribI4i && glad_glVertexAttribI4i != counted_glVertexAttribI4i)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI4i] = (void*)glad_glVertexAttribI4i;
+            glad_glVertexAttribI4i = counted_glVertexAttribI4i;
+        }
+        if (glad_glVertexAttribI1ui && glad_glVertexAttribI1ui != counted_glVertexAttribI1ui)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI1ui] = (void*)glad_glVertexAttribI1ui;
+            glad_glVertexAttribI1ui = counted_glVertexAttribI1ui;
+        }
+        if (glad_glVertexAttribI2ui && glad_glVertexAttribI2ui != counted_glVertexAttribI2ui)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI2ui] = (void*)glad_glVertexAttribI2ui;
+            glad_glVertexAttribI2ui = counted_glVertexAttribI2ui;
+        }
+        if (glad_glVertexAttribI3ui && glad_glVertexAttribI3ui != counted_glVertexAttribI3ui)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI3ui] = (void*)glad_glVertexAttribI3ui;
+            glad_glVertexAttribI3ui = counted_glVertexAttribI3ui;
+        }
+        if (glad_glVertexAttribI4ui && glad_glVertexAttribI4ui != counted_glVertexAttribI4ui)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI4ui] = (void*)glad_glVertexAttribI4ui;
+            glad_glVertexAttribI4ui = counted_glVertexAttribI4ui;
+        }
+        if (glad_glVertexAttribI1iv && glad_glVertexAttribI1iv != counted_glVertexAttribI1iv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI1iv] = (void*)glad_glVertexAttribI1iv;
+            glad_glVertexAttribI1iv = counted_glVertexAttribI1iv;
+        }
+        if (glad_glVertexAttribI2iv && glad_glVertexAttribI2iv != counted_glVertexAttribI2iv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI2iv] = (void*)glad_glVertexAttribI2iv;
+            glad_glVertexAttribI2iv = counted_glVertexAttribI2iv;
+        }
+        if (glad_glVertexAttribI3iv && glad_glVertexAttribI3iv != counted_glVertexAttribI3iv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI3iv] = (void*)glad_glVertexAttribI3iv;
+            glad_glVertexAttribI3iv = counted_glVertexAttribI3iv;
+        }
+        if (glad_glVertexAttribI4iv && glad_glVertexAttribI4iv != counted_glVertexAttribI4iv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI4iv] = (void*)glad_glVertexAttribI4iv;
+            glad_glVertexAttribI4iv = counted_glVertexAttribI4iv;
+        }
+        if (glad_glVertexAttribI1uiv && glad_glVertexAttribI1uiv != counted_glVertexAttribI1uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI1uiv] = (void*)glad_glVertexAttribI1uiv;
+            glad_glVertexAttribI1uiv = counted_glVertexAttribI1uiv;
+        }
+        if (glad_glVertexAttribI2uiv && glad_glVertexAttribI2uiv != counted_glVertexAttribI2uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI2uiv] = (void*)glad_glVertexAttribI2uiv;
+            glad_glVertexAttribI2uiv = counted_glVertexAttribI2uiv;
+        }
+        if (glad_glVertexAttribI3uiv && glad_glVertexAttribI3uiv != counted_glVertexAttribI3uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI3uiv] = (void*)glad_glVertexAttribI3uiv;
+            glad_glVertexAttribI3uiv = counted_glVertexAttribI3uiv;
+        }
+        if (glad_glVertexAttribI4uiv && glad_glVertexAttribI4uiv != counted_glVertexAttribI4uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI4uiv] = (void*)glad_glVertexAttribI4uiv;
+            glad_glVertexAttribI4uiv = counted_glVertexAttribI4uiv;
+        }
+        if (glad_glVertexAttribI4bv && glad_glVertexAttribI4bv != counted_glVertexAttribI4bv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI4bv] = (void*)glad_glVertexAttribI4bv;
+            glad_glVertexAttribI4bv = counted_glVertexAttribI4bv;
+        }
+        if (glad_glVertexAttribI4sv && glad_glVertexAttribI4sv != counted_glVertexAttribI4sv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI4sv] = (void*)glad_glVertexAttribI4sv;
+            glad_glVertexAttribI4sv = counted_glVertexAttribI4sv;
+        }
+        if (glad_glVertexAttribI4ubv && glad_glVertexAttribI4ubv != counted_glVertexAttribI4ubv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI4ubv] = (void*)glad_glVertexAttribI4ubv;
+            glad_glVertexAttribI4ubv = counted_glVertexAttribI4ubv;
+        }
+        if (glad_glVertexAttribI4usv && glad_glVertexAttribI4usv != counted_glVertexAttribI4usv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI4usv] = (void*)glad_glVertexAttribI4usv;
+            glad_glVertexAttribI4usv = counted_glVertexAttribI4usv;
+        }
+        if (glad_glGetUniformuiv && glad_glGetUniformuiv != counted_glGetUniformuiv)
+        {
+            Table<>::loaded[ENTRY_glGetUniformuiv] = (void*)glad_glGetUniformuiv;
+            glad_glGetUniformuiv = counted_glGetUniformuiv;
+        }
+        if (glad_glBindFragDataLocation && glad_glBindFragDataLocation != counted_glBindFragDataLocation)
+        {
+            Table<>::loaded[ENTRY_glBindFragDataLocation] = (void*)glad_glBindFragDataLocation;
+            glad_glBindFragDataLocation = counted_glBindFragDataLocation;
+        }
+        if (glad_glGetFragDataLocation && glad_glGetFragDataLocation != counted_glGetFragDataLocation)
+        {
+            Table<>::loaded[ENTRY_glGetFragDataLocation] = (void*)glad_glGetFragDataLocation;
+            glad_glGetFragDataLocation = counted_glGetFragDataLocation;
+        }
+        if (glad_glUniform1ui && glad_glUniform1ui != counted_glUniform1ui)
+        {
+            Table<>::loaded[ENTRY_glUniform1ui] = (void*)glad_glUniform1ui;
+            glad_glUniform1ui = counted_glUniform1ui;
+        }
+        if (glad_glUniform2ui && glad_glUniform2ui != counted_glUniform2ui)
+        {
+            Table<>::loaded[ENTRY_glUniform2ui] = (void*)glad_glUniform2ui;
+            glad_glUniform2ui = counted_glUniform2ui;
+        }
+        if (glad_glUniform3ui && glad_glUniform3ui != counted_glUniform3ui)
+        {
+            Table<>::loaded[ENTRY_glUniform3ui] = (void*)glad_glUniform3ui;
+            glad_glUniform3ui = counted_glUniform3ui;
+        }
+        if (glad_glUniform4ui && glad_glUniform4ui != counted_glUniform4ui)
+        {
+            Table<>::loaded[ENTRY_glUniform4ui] = (void*)glad_glUniform4ui;
+            glad_glUniform4ui = counted_glUniform4ui;
+        }
+        if (glad_glUniform1uiv && glad_glUniform1uiv != counted_glUniform1uiv)
+        {
+            Table<>::loaded[ENTRY_glUniform1uiv] = (void*)glad_glUniform1uiv;
+            glad_glUniform1uiv = counted_glUniform1uiv;
+        }
+        if (glad_glUniform2uiv && glad_glUniform2uiv != counted_glUniform2uiv)
+        {
+            Table<>::loaded[ENTRY_glUniform2uiv] = (void*)glad_glUniform2uiv;
+            glad_glUniform2uiv = counted_glUniform2uiv;
+        }
+        if (glad_glUniform3uiv && glad_glUniform3uiv != counted_glUniform3uiv)
+        {
+            Table<>::loaded[ENTRY_glUniform3uiv] = (void*)glad_glUniform3uiv;
+            glad_glUniform3uiv = counted_glUniform3uiv;
+        }
+        if (glad_glUniform4uiv && glad_glUniform4uiv != counted_glUniform4uiv)
+        {
+            Table<>::loaded[ENTRY_glUniform4uiv] = (void*)glad_glUniform4uiv;
+            glad_glUniform4uiv = counted_glUniform4uiv;
+        }
+        if (glad_glTexParameterIiv && glad_glTexParameterIiv != counted_glTexParameterIiv)
+        {
+            Table<>::loaded[ENTRY_glTexParameterIiv] = (void*)glad_glTexParameterIiv;
+            glad_glTexParameterIiv = counted_glTexParameterIiv;
+        }
+        if (glad_glTexParameterIuiv && glad_glTexParameterIuiv != counted_glTexParameterIuiv)
+        {
+            Table<>::loaded[ENTRY_glTexParameterIuiv] = (void*)glad_glTexParameterIuiv;
+            glad_glTexParameterIuiv = counted_glTexParameterIuiv;
+        }
+        if (glad_glGetTexParameterIiv && glad_glGetTexParameterIiv != counted_glGetTexParameterIiv)
+        {
+            Table<>::loaded[ENTRY_glGetTexParameterIiv] = (void*)glad_glGetTexParameterIiv;
+            glad_glGetTexParameterIiv = counted_glGetTexParameterIiv;
+        }
+        if (glad_glGetTexParameterIuiv && glad_glGetTexParameterIuiv != counted_glGetTexParameterIuiv)
+        {
+            Table<>::loaded[ENTRY_glGetTexParameterIuiv] = (void*)glad_glGetTexParameterIuiv;
+            glad_glGetTexParameterIuiv = counted_glGetTexParameterIuiv;
+        }
+        if (glad_glClearBufferiv && glad_glClearBufferiv != counted_glClearBufferiv)
+        {
+            Table<>::loaded[ENTRY_glClearBufferiv] = (void*)glad_glClearBufferiv;
+            glad_glClearBufferiv = counted_glClearBufferiv;
+        }
+        if (glad_glClearBufferuiv && glad_glClearBufferuiv != counted_glClearBufferuiv)
+        {
+            Table<>::loaded[ENTRY_glClearBufferuiv] = (void*)glad_glClearBufferuiv;
+            glad_glClearBufferuiv = counted_glClearBufferuiv;
+        }
+        if (glad_glClearBufferfv && glad_glClearBufferfv != counted_glClearBufferfv)
+        {
+            Table<>::loaded[ENTRY_glClearBufferfv] = (void*)glad_glClearBufferfv;
+            glad_glClearBufferfv = counted_glClearBufferfv;
+        }
+        if (glad_glClearBufferfi && glad_glClearBufferfi != counted_glClearBufferfi)
+        {
+            Table<>::loaded[ENTRY_glClearBufferfi] = (void*)glad_glClearBufferfi;
+            glad_glClearBufferfi = counted_glClearBufferfi;
+        }
+        if (glad_glGetStringi && glad_glGetStringi != counted_glGetStringi)
+        {
+            Table<>::loaded[ENTRY_glGetStringi] = (void*)glad_glGetStringi;
+            glad_glGetStringi = counted_glGetStringi;
+        }
+        if (glad_glIsRenderbuffer && glad_glIsRenderbuffer != counted_glIsRenderbuffer)
+        {
+            Table<>::loaded[ENTRY_glIsRenderbuffer] = (void*)glad_glIsRenderbuffer;
+            glad_glIsRenderbuffer = counted_glIsRenderbuffer;
+        }
+        if (glad_glBindRenderbuffer && glad_glBindRenderbuffer != counted_glBindRenderbuffer)
+        {
+            Table<>::loaded[ENTRY_glBindRenderbuffer] = (void*)glad_glBindRenderbuffer;
+            glad_glBindRenderbuffer = counted_glBindRenderbuffer;
+        }
+        if (glad_glDeleteRenderbuffers && glad_glDeleteRenderbuffers != counted_glDeleteRenderbuffers)
+        {
+            Table<>::loaded[ENTRY_glDeleteRenderbuffers] = (void*)glad_glDeleteRenderbuffers;
+            glad_glDeleteRenderbuffers = counted_glDeleteRenderbuffers;
+        }
+        if (glad_glGenRenderbuffers && glad_glGenRenderbuffers != counted_glGenRenderbuffers)
+        {
+            Table<>::loaded[ENTRY_glGenRenderbuffers] = (void*)glad_glGenRenderbuffers;
+            glad_glGenRenderbuffers = counted_glGenRenderbuffers;
+        }
+        if (glad_glRenderbufferStorage && glad_glRenderbufferStorage != counted_glRenderbufferStorage)
+        {
+            Table<>::loaded[ENTRY_glRenderbufferStorage] = (void*)glad_glRenderbufferStorage;
+            glad_glRenderbufferStorage = counted_glRenderbufferStorage;
+        }
+        if (glad_glGetRenderbufferParameteriv && glad_glGetRenderbufferParameteriv != counted_glGetRenderbufferParameteriv)
+        {
+            Table<>::loaded[ENTRY_glGetRenderbufferParameteriv] = (void*)glad_glGetRenderbufferParameteriv;
+            glad_glGetRenderbufferParameteriv = counted_glGetRenderbufferParameteriv;
+        }
+        if (glad_glIsFramebuffer && glad_glIsFramebuffer != counted_glIsFramebuffer)
+        {
+            Table<>::loaded[ENTRY_glIsFramebuffer] = (void*)glad_glIsFramebuffer;
+            glad_glIsFramebuffer = counted_glIsFramebuffer;
+        }
+        if (glad_glBindFramebuffer && glad_glBindFramebuffer != counted_glBindFramebuffer)
+        {
+            Table<>::loaded[ENTRY_glBindFramebuffer] = (void*)glad_glBindFramebuffer;
+            glad_glBindFramebuffer = counted_glBindFramebuffer;
+        }
+        if (glad_glDeleteFramebuffers && glad_glDeleteFramebuffers != counted_glDeleteFramebuffers)
+        {
+            Table<>::loaded[ENTRY_glDeleteFramebuffers] = (void*)glad_glDeleteFramebuffers;
+            glad_glDeleteFramebuffers = counted_glDeleteFramebuffers;
+        }
+        if (glad_glGenFramebuffers && glad_glGenFramebuffers != counted_glGenFramebuffers)
+        {
+            Table<>::loaded[ENTRY_glGenFramebuffers] = (void*)glad_glGenFramebuffers;
+            glad_glGenFramebuffers = counted_glGenFramebuffers;
+        }
+        if (glad_glCheckFramebufferStatus && glad_glCheckFramebufferStatus != counted_glCheckFramebufferStatus)
+        {
+            Table<>::loaded[ENTRY_glCheckFramebufferStatus] = (void*)glad_glCheckFramebufferStatus;
+            glad_glCheckFramebufferStatus = counted_glCheckFramebufferStatus;
+        }
+        if (glad_glFramebufferTexture1D && glad_glFramebufferTexture1D != counted_glFramebufferTexture1D)
+        {
+            Table<>::loaded[ENTRY_glFramebufferTexture1D] = (void*)glad_glFramebufferTexture1D;
+            glad_glFramebufferTexture1D = counted_glFramebufferTexture1D;
+        }
+        if (glad_glFramebufferTexture2D && glad_glFramebufferTexture2D != counted_glFramebufferTexture2D)
+        {
+            Table<>::loaded[ENTRY_glFramebufferTexture2D] = (void*)glad_glFramebufferTexture2D;
+            glad_glFramebufferTexture2D = counted_glFramebufferTexture2D;
+        }
+        if (glad_glFramebufferTexture3D && glad_glFramebufferTexture3D != counted_glFramebufferTexture3D)
+        {
+            Table<>::loaded[ENTRY_glFramebufferTexture3D] = (void*)glad_glFramebufferTexture3D;
+            glad_glFramebufferTexture3D = counted_glFramebufferTexture3D;
+        }
+        if (glad_glFramebufferRenderbuffer && glad_glFramebufferRenderbuffer != counted_glFramebufferRenderbuffer)
+        {
+            Table<>::loaded[ENTRY_glFramebufferRenderbuffer] = (void*)glad_glFramebufferRenderbuffer;
+            glad_glFramebufferRenderbuffer = counted_glFramebufferRenderbuffer;
+        }
+        if (glad_glGetFramebufferAttachmentParameteriv && glad_glGetFramebufferAttachmentParameteriv != counted_glGetFramebufferAttachmentParameteriv)
+        {
+            Table<>::loaded[ENTRY_glGetFramebufferAttachmentParameteriv] = (void*)glad_glGetFramebufferAttachmentParameteriv;
+            glad_glGetFramebufferAttachmentParameteriv = counted_glGetFramebufferAttachmentParameteriv;
+        }
+        if (glad_glGenerateMipmap && glad_glGenerateMipmap != counted_glGenerateMipmap)
+        {
+            Table<>::loaded[ENTRY_glGenerateMipmap] = (void*)glad_glGenerateMipmap;
+            glad_glGenerateMipmap = counted_glGenerateMipmap;
+        }
+        if (glad_glBlitFramebuffer && glad_glBlitFramebuffer != counted_glBlitFramebuffer)
+        {
+            Table<>::loaded[ENTRY_glBlitFramebuffer] = (void*)glad_glBlitFramebuffer;
+            glad_glBlitFramebuffer = counted_glBlitFramebuffer;
+        }
+        if (glad_glRenderbufferStorageMultisample && glad_glRenderbufferStorageMultisample != counted_glRenderbufferStorageMultisample)
+        {
+            Table<>::loaded[ENTRY_glRenderbufferStorageMultisample] = (void*)glad_glRenderbufferStorageMultisample;
+            glad_glRenderbufferStorageMultisample = counted_glRenderbufferStorageMultisample;
+        }
+        if (glad_glFramebufferTextureLayer && glad_glFramebufferTextureLayer != counted_glFramebufferTextureLayer)
+        {
+            Table<>::loaded[ENTRY_glFramebufferTextureLayer] = (void*)glad_glFramebufferTextureLayer;
+            glad_glFramebufferTextureLayer = counted_glFramebufferTextureLayer;
+        }
+        if (glad_glMapBufferRange && glad_glMapBufferRange != counted_glMapBufferRange)
+        {
+            Table<>::loaded[ENTRY_glMapBufferRange] = (void*)glad_glMapBufferRange;
+            glad_glMapBufferRange = counted_glMapBufferRange;
+        }
+        if (glad_glFlushMappedBufferRange && glad_glFlushMappedBufferRange != counted_glFlushMappedBufferRange)
+        {
+            Table<>::loaded[ENTRY_glFlushMappedBufferRange] = (void*)glad_glFlushMappedBufferRange;
+            glad_glFlushMappedBufferRange = counted_glFlushMappedBufferRange;
+        }
+        if (glad_glBindVertexArray && glad_glBindVertexArray != counted_glBindVertexArray)
+        {
+            Table<>::loaded[ENTRY_glBindVertexArray] = (void*)glad_glBindVertexArray;
+            glad_glBindVertexArray = counted_glBindVertexArray;
+        }
+        if (glad_glDeleteVertexArrays && glad_glDeleteVertexArrays != counted_glDeleteVertexArrays)
+        {
+            Table<>::loaded[ENTRY_glDeleteVertexArrays] = (void*)glad_glDeleteVertexArrays;
+            glad_glDeleteVertexArrays = counted_glDeleteVertexArrays;
+        }
+        if (glad_glGenVertexArrays && glad_glGenVertexArrays != counted_glGenVertexArrays)
+        {
+            Table<>::loaded[ENTRY_glGenVertexArrays] = (void*)glad_glGenVertexArrays;
+            glad_glGenVertexArrays = counted_glGenVertexArrays;
+        }
+        if (glad_glIsVertexArray && glad_glIsVertexArray != counted_glIsVertexArray)
+        {
+            Table<>::loaded[ENTRY_glIsVertexArray] = (void*)glad_glIsVertexArray;
+            glad_glIsVertexArray = counted_glIsVertexArray;
+        }
+        if (glad_glDrawArraysInstanced && glad_glDrawArraysInstanced != counted_glDrawArraysInstanced)
+        {
+            Table<>::loaded[ENTRY_glDrawArraysInstanced] = (void*)glad_glDrawArraysInstanced;
+            glad_glDrawArraysInstanced = counted_glDrawArraysInstanced;
+        }
+        if (glad_glDrawElementsInstanced && glad_glDrawElementsInstanced != counted_glDrawElementsInstanced)
+        {
+            Table<>::loaded[ENTRY_glDrawElementsInstanced] = (void*)glad_glDrawElementsInstanced;
+            glad_glDrawElementsInstanced = counted_glDrawElementsInstanced;
+        }
+        if (glad_glTexBuffer && glad_glTexBuffer != counted_glTexBuffer)
+        {
+            Table<>::loaded[ENTRY_glTexBuffer] = (void*)glad_glTexBuffer;
+            glad_glTexBuffer = counted_glTexBuffer;
+        }
+        if (glad_glPrimitiveRestartIndex && glad_glPrimitiveRestartIndex != counted_glPrimitiveRestartIndex)
+        {
+            Table<>::loaded[ENTRY_glPrimitiveRestartIndex] = (void*)glad_glPrimitiveRestartIndex;
+            glad_glPrimitiveRestartIndex = counted_glPrimitiveRestartIndex;
+        }
+        if (glad_glCopyBufferSubData && glad_glCopyBufferSubData != counted_glCopyBufferSubData)
+        {
+            Table<>::loaded[ENTRY_glCopyBufferSubData] = (void*)glad_glCopyBufferSubData;
+            glad_glCopyBufferSubData = counted_glCopyBufferSubData;
+        }
+        if (glad_glGetUniformIndices && glad_glGetUniformIndices != counted_glGetUniformIndices)
+        {
+            Table<>::loaded[ENTRY_glGetUniformIndices] = (void*)glad_glGetUniformIndices;
+            glad_glGetUniformIndices = counted_glGetUniformIndices;
+        }
+        if (glad_glGetActiveUniformsiv && glad_glGetActiveUniformsiv != counted_glGetActiveUniformsiv)
+        {
+            Table<>::loaded[ENTRY_glGetActiveUniformsiv] = (void*)glad_glGetActiveUniformsiv;
+            glad_glGetActiveUniformsiv = counted_glGetActiveUniformsiv;
+        }
+        if (glad_glGetActiveUniformName && glad_glGetActiveUniformName != counted_glGetActiveUniformName)
+        {
+            Table<>::loaded[ENTRY_glGetActiveUniformName] = (void*)glad_glGetActiveUniformName;
+            glad_glGetActiveUniformName = counted_glGetActiveUniformName;
+        }
+        if (glad_glGetUniformBlockIndex && glad_glGetUniformBlockIndex != counted_glGetUniformBlockIndex)
+        {
+            Table<>::loaded[ENTRY_glGetUniformBlockIndex] = (void*)glad_glGetUniformBlockIndex;
+            glad_glGetUniformBlockIndex = counted_glGetUniformBlockIndex;
+        }
+        if (glad_glGetActiveUniformBlockiv && glad_glGetActiveUniformBlockiv != counted_glGetActiveUniformBlockiv)
+        {
+            Table<>::loaded[ENTRY_glGetActiveUniformBlockiv] = (void*)glad_glGetActiveUniformBlockiv;
+            glad_glGetActiveUniformBlockiv = counted_glGetActiveUniformBlockiv;
+        }
+        if (glad_glGetActiveUniformBlockName && glad_glGetActiveUniformBlockName != counted_glGetActiveUniformBlockName)
+        {
+            Table<>::loaded[ENTRY_glGetActiveUniformBlockName] = (void*)glad_glGetActiveUniformBlockName;
+            glad_glGetActiveUniformBlockName = counted_glGetActiveUniformBlockName;
+        }
+        if (glad_glUniformBlockBinding && glad_glUniformBlockBinding != counted_glUniformBlockBinding)
+        {
+            Table<>::loaded[ENTRY_glUniformBlockBinding] = (void*)glad_glUniformBlockBinding;
+            glad_glUniformBlockBinding = counted_glUniformBlockBinding;
+        }
+        if (glad_glDrawElementsBaseVertex && glad_glDrawElementsBaseVertex != counted_glDrawElementsBaseVertex)
+        {
+            Table<>::loaded[ENTRY_glDrawElementsBaseVertex] = (void*)glad_glDrawElementsBaseVertex;
+            glad_glDrawElementsBaseVertex = counted_glDrawElementsBaseVertex;
+        }
+        if (glad_glDrawRangeElementsBaseVertex && glad_glDrawRangeElementsBaseVertex != counted_glDrawRangeElementsBaseVertex)
+        {
+            Table<>::loaded[ENTRY_glDrawRangeElementsBaseVertex] = (void*)glad_glDrawRangeElementsBaseVertex;
+            glad_glDrawRangeElementsBaseVertex = counted_glDrawRangeElementsBaseVertex;
+        }
+        if (glad_glDrawElementsInstancedBaseVertex && glad_glDrawElementsInstancedBaseVertex != counted_glDrawElementsInstancedBaseVertex)
+        {
+            Table<>::loaded[ENTRY_glDrawElementsInstancedBaseVertex] = (void*)glad_glDrawElementsInstancedBaseVertex;
+            glad_glDrawElementsInstancedBaseVertex = counted_glDrawElementsInstancedBaseVertex;
+        }
+        if (glad_glMultiDrawElementsBaseVertex && glad_glMultiDrawElementsBaseVertex != counted_glMultiDrawElementsBaseVertex)
+        {
+            Table<>::loaded[ENTRY_glMultiDrawElementsBaseVertex] = (void*)glad_glMultiDrawElementsBaseVertex;
+            glad_glMultiDrawElementsBaseVertex = counted_glMultiDrawElementsBaseVertex;
+        }
+        if (glad_glProvokingVertex && glad_glProvokingVertex != counted_glProvokingVertex)
+        {
+            Table<>::loaded[ENTRY_glProvokingVertex] = (void*)glad_glProvokingVertex;
+            glad_glProvokingVertex = counted_glProvokingVertex;
+        }
+        if (glad_glFenceSync && glad_glFenceSync != counted_glFenceSync)
+        {
+            Table<>::loaded[ENTRY_glFenceSync] = (void*)glad_glFenceSync;
+            glad_glFenceSync = counted_glFenceSync;
+        }
+        if (glad_glIsSync && glad_glIsSync != counted_glIsSync)
+        {
+            Table<>::loaded[ENTRY_glIsSync] = (void*)glad_glIsSync;
+            glad_glIsSync = counted_glIsSync;
+        }
+        if (glad_glDeleteSync && glad_glDeleteSync != counted_glDeleteSync)
+        {
+            Table<>::loaded[ENTRY_glDeleteSync] = (void*)glad_glDeleteSync;
+            glad_glDeleteSync = counted_glDeleteSync;
+        }
+        if (glad_glClientWaitSync && glad_glClientWaitSync != counted_glClientWaitSync)
+        {
+            Table<>::loaded[ENTRY_glClientWaitSync] = (void*)glad_glClientWaitSync;
+            glad_glClientWaitSync = counted_glClientWaitSync;
+        }
+        if (glad_glWaitSync && glad_glWaitSync != counted_glWaitSync)
+        {
+            Table<>::loaded[ENTRY_glWaitSync] = (void*)glad_glWaitSync;
+            glad_glWaitSync = counted_glWaitSync;
+        }
+        if (glad_glGetInteger64v && glad_glGetInteger64v != counted_glGetInteger64v)
+        {
+            Table<>::loaded[ENTRY_glGetInteger64v] = (void*)glad_glGetInteger64v;
+            glad_glGetInteger64v = counted_glGetInteger64v;
+        }
+        if (glad_glGetSynciv && glad_glGetSynciv != counted_glGetSynciv)
+        {
+            Table<>::loaded[ENTRY_glGetSynciv] = (void*)glad_glGetSynciv;
+            glad_glGetSynciv = counted_glGetSynciv;
+        }
+        if (glad_glGetInteger64i_v && glad_glGetInteger64i_v != counted_glGetInteger64i_v)
+        {
+            Table<>::loaded[ENTRY_glGetInteger64i_v] = (void*)glad_glGetInteger64i_v;
+            glad_glGetInteger64i_v = counted_glGetInteger64i_v;
+        }
+        if (glad_glGetBufferParameteri64v && glad_glGetBufferParameteri64v != counted_glGetBufferParameteri64v)
+        {
+            Table<>::loaded[ENTRY_glGetBufferParameteri64v] = (void*)glad_glGetBufferParameteri64v;
+            glad_glGetBufferParameteri64v = counted_glGetBufferParameteri64v;
+        }
+        if (glad_glFramebufferTexture && glad_glFramebufferTexture != counted_glFramebufferTexture)
+        {
+            Table<>::loaded[ENTRY_glFramebufferTexture] = (void*)glad_glFramebufferTexture;
+            glad_glFramebufferTexture = counted_glFramebufferTexture;
+        }
+        if (glad_glTexImage2DMultisample && glad_glTexImage2DMultisample != counted_glTexImage2DMultisample)
+        {
+            Table<>::loaded[ENTRY_glTexImage2DMultisample] = (void*)glad_glTexImage2DMultisample;
+            glad_glTexImage2DMultisample = counted_glTexImage2DMultisample;
+        }
+        if (glad_glTexImage3DMultisample && glad_glTexImage3DMultisample != counted_glTexImage3DMultisample)
+        {
+            Table<>::loaded[ENTRY_glTexImage3DMultisample] = (void*)glad_glTexImage3DMultisample;
+            glad_glTexImage3DMultisample = counted_glTexImage3DMultisample;
+        }
+        if (glad_glGetMultisamplefv && glad_glGetMultisamplefv != counted_glGetMultisamplefv)
+        {
+            Table<>::loaded[ENTRY_glGetMultisamplefv] = (void*)glad_glGetMultisamplefv;
+            glad_glGetMultisamplefv = counted_glGetMultisamplefv;
+        }
+        if (glad_glSampleMaski && glad_glSampleMaski != counted_glSampleMaski)
+        {
+            Table<>::loaded[ENTRY_glSampleMaski] = (void*)glad_glSampleMaski;
+            glad_glSampleMaski = counted_glSampleMaski;
+        }
+        if (glad_glBindFragDataLocationIndexed && glad_glBindFragDataLocationIndexed != counted_glBindFragDataLocationIndexed)
+        {
+            Table<>::loaded[ENTRY_glBindFragDataLocationIndexed] = (void*)glad_glBindFragDataLocationIndexed;
+            glad_glBindFragDataLocationIndexed = counted_glBindFragDataLocationIndexed;
+        }
+        if (glad_glGetFragDataIndex && glad_glGetFragDataIndex != counted_glGetFragDataIndex)
+        {
+            Table<>::loaded[ENTRY_glGetFragDataIndex] = (void*)glad_glGetFragDataIndex;
+            glad_glGetFragDataIndex = counted_glGetFragDataIndex;
+        }
+        if (glad_glGenSamplers && glad_glGenSamplers != counted_glGenSamplers)
+        {
+            Table<>::loaded[ENTRY_glGenSamplers] = (void*)glad_glGenSamplers;
+            glad_glGenSamplers = counted_glGenSamplers;
+        }
+        if (glad_glDeleteSamplers && glad_glDeleteSamplers != counted_glDeleteSamplers)
+        {
+            Table<>::loaded[ENTRY_glDeleteSamplers] = (void*)glad_glDeleteSamplers;
+            glad_glDeleteSamplers = counted_glDeleteSamplers;
+        }
+        if (glad_glIsSampler && glad_glIsSampler != counted_glIsSampler)
+        {
+            Table<>::loaded[ENTRY_glIsSampler] = (void*)glad_glIsSampler;
+            glad_glIsSampler = counted_glIsSampler;
+        }
+        if (glad_glBindSampler && glad_glBindSampler != counted_glBindSampler)
+        {
+            Table<>::loaded[ENTRY_glBindSampler] = (void*)glad_glBindSampler;
+            glad_glBindSampler = counted_glBindSampler;
+        }
+        if (glad_glSamplerParameteri && glad_glSamplerParameteri != counted_glSamplerParameteri)
+        {
+            Table<>::loaded[ENTRY_glSamplerParameteri] = (void*)glad_glSamplerParameteri;
+            glad_glSamplerParameteri = counted_glSamplerParameteri;
+        }
+        if (glad_glSamplerParameteriv && glad_glSamplerParameteriv != counted_glSamplerParameteriv)
+        {
+            Table<>::loaded[ENTRY_glSamplerParameteriv] = (void*)glad_glSamplerParameteriv;
+            glad_glSamplerParameteriv = counted_glSamplerParameteriv;
+        }
+        if (glad_glSamplerParameterf && glad_glSamplerParameterf != counted_glSamplerParameterf)
+        {
+            Table<>::loaded[ENTRY_glSamplerParameterf] = (void*)glad_glSamplerParameterf;
+            glad_glSamplerParameterf = counted_glSamplerParameterf;
+        }
+        if (glad_glSamplerParameterfv && glad_glSamplerParameterfv != counted_glSamplerParameterfv)
+        {
+            Table<>::loaded[ENTRY_glSamplerParameterfv] = (void*)glad_glSamplerParameterfv;
+            glad_glSamplerParameterfv = counted_glSamplerParameterfv;
+        }
+        if (glad_glSamplerParameterIiv && glad_glSamplerParameterIiv != counted_glSamplerParameterIiv)
+        {
+            Table<>::loaded[ENTRY_glSamplerParameterIiv] = (void*)glad_glSamplerParameterIiv;
+            glad_glSamplerParameterIiv = counted_glSamplerParameterIiv;
+        }
+        if (glad_glSamplerParameterIuiv && glad_glSamplerParameterIuiv != counted_glSamplerParameterIuiv)
+        {
+            Table<>::loaded[ENTRY_glSamplerParameterIuiv] = (void*)glad_glSamplerParameterIuiv;
+            glad_glSamplerParameterIuiv = counted_glSamplerParameterIuiv;
+        }
+        if (glad_glGetSamplerParameteriv && glad_glGetSamplerParameteriv != counted_glGetSamplerParameteriv)
+        {
+            Table<>::loaded[ENTRY_glGetSamplerParameteriv] = (void*)glad_glGetSamplerParameteriv;
+            glad_glGetSamplerParameteriv = counted_glGetSamplerParameteriv;
+        }
+        if (glad_glGetSamplerParameterIiv && glad_glGetSamplerParameterIiv != counted_glGetSamplerParameterIiv)
+        {
+            Table<>::loaded[ENTRY_glGetSamplerParameterIiv] = (void*)glad_glGetSamplerParameterIiv;
+            glad_glGetSamplerParameterIiv = counted_glGetSamplerParameterIiv;
+        }
+        if (glad_glGetSamplerParameterfv && glad_glGetSamplerParameterfv != counted_glGetSamplerParameterfv)
+        {
+            Table<>::loaded[ENTRY_glGetSamplerParameterfv] = (void*)glad_glGetSamplerParameterfv;
+            glad_glGetSamplerParameterfv = counted_glGetSamplerParameterfv;
+        }
+        if (glad_glGetSamplerParameterIuiv && glad_glGetSamplerParameterIuiv != counted_glGetSamplerParameterIuiv)
+        {
+            Table<>::loaded[ENTRY_glGetSamplerParameterIuiv] = (void*)glad_glGetSamplerParameterIuiv;
+            glad_glGetSamplerParameterIuiv = counted_glGetSamplerParameterIuiv;
+        }
+        if (glad_glQueryCounter && glad_glQueryCounter != counted_glQueryCounter)
+        {
+            Table<>::loaded[ENTRY_glQueryCounter] = (void*)glad_glQueryCounter;
+            glad_glQueryCounter = counted_glQueryCounter;
+        }
+        if (glad_glGetQueryObjecti64v && glad_glGetQueryObjecti64v != counted_glGetQueryObjecti64v)
+        {
+            Table<>::loaded[ENTRY_glGetQueryObjecti64v] = (void*)glad_glGetQueryObjecti64v;
+            glad_glGetQueryObjecti64v = counted_glGetQueryObjecti64v;
+        }
+        if (glad_glGetQueryObjectui64v && glad_glGetQueryObjectui64v != counted_glGetQueryObjectui64v)
+        {
+            Table<>::loaded[ENTRY_glGetQueryObjectui64v] = (void*)glad_glGetQueryObjectui64v;
+            glad_glGetQueryObjectui64v = counted_glGetQueryObjectui64v;
+        }
+        if (glad_glVertexAttribDivisor && glad_glVertexAttribDivisor != counted_glVertexAttribDivisor)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribDivisor] = (void*)glad_glVertexAttribDivisor;
+            glad_glVertexAttribDivisor = counted_glVertexAttribDivisor;
+        }
+        if (glad_glVertexAttribP1ui && glad_glVertexAttribP1ui != counted_glVertexAttribP1ui)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribP1ui] = (void*)glad_glVertexAttribP1ui;
+            glad_glVertexAttribP1ui = counted_glVertexAttribP1ui;
+        }
+        if (glad_glVertexAttribP1uiv && glad_glVertexAttribP1uiv != counted_glVertexAttribP1uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribP1uiv] = (void*)glad_glVertexAttribP1uiv;
+            glad_glVertexAttribP1uiv = counted_glVertexAttribP1uiv;
+        }
+        if (glad_glVertexAttribP2ui && glad_glVertexAttribP2ui != counted_glVertexAttribP2ui)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribP2ui] = (void*)glad_glVertexAttribP2ui;
+            glad_glVertexAttribP2ui = counted_glVertexAttribP2ui;
+        }
+        if (glad_glVertexAttribP2uiv && glad_glVertexAttribP2uiv != counted_glVertexAttribP2uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribP2uiv] = (void*)glad_glVertexAttribP2uiv;
+            glad_glVertexAttribP2uiv = counted_glVertexAttribP2uiv;
+        }
+        if (glad_glVertexAttribP3ui && glad_glVertexAttribP3ui != counted_glVertexAttribP3ui)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribP3ui] = (void*)glad_glVertexAttribP3ui;
+            glad_glVertexAttribP3ui = counted_glVertexAttribP3ui;
+        }
+        if (glad_glVertexAttribP3uiv && glad_glVertexAttribP3uiv != counted_glVertexAttribP3uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribP3uiv] = (void*)glad_glVertexAttribP3uiv;
+            glad_glVertexAttribP3uiv = counted_glVertexAttribP3uiv;
+        }
+        if (glad_glVertexAttribP4ui && glad_glVertexAttribP4ui != counted_glVertexAttribP4ui)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribP4ui] = (void*)glad_glVertexAttribP4ui;
+            glad_glVertexAttribP4ui = counted_glVertexAttribP4ui;
+        }
+        if (glad_glVertexAttribP4uiv && glad_glVertexAttribP4uiv != counted_glVertexAttribP4uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribP4uiv] = (void*)glad_glVertexAttribP4uiv;
+            glad_glVertexAttribP4uiv = counted_glVertexAttribP4uiv;
+        }
+        if (glad_glVertexP2ui && glad_glVertexP2ui != counted_glVertexP2ui)
+        {
+            Table<>::loaded[ENTRY_glVertexP2ui] = (void*)glad_glVertexP2ui;
+            glad_glVertexP2ui = counted_glVertexP2ui;
+        }
+        if (glad_glVertexP2uiv && glad_glVertexP2uiv != counted_glVertexP2uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexP2uiv] = (void*)glad_glVertexP2uiv;
+            glad_glVertexP2uiv = counted_glVertexP2uiv;
+        }
+        if (glad_glVertexP3ui && glad_glVertexP3ui != counted_glVertexP3ui)
+        {
+            Table<>::loaded[ENTRY_glVertexP3ui] = (void*)glad_glVertexP3ui;
+            glad_glVertexP3ui = counted_glVertexP3ui;
+        }
+        if (glad_glVertexP3uiv && glad_glVertexP3uiv != counted_glVertexP3uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexP3uiv] = (void*)glad_glVertexP3uiv;
+            glad_glVertexP3uiv = counted_glVertexP3uiv;
+        }
+        if (glad_glVertexP4ui && glad_glVertexP4ui != counted_glVertexP4ui)
+        {
+            Table<>::loaded[ENTRY_glVertexP4ui] = (void*)glad_glVertexP4ui;
+            glad_glVertexP4ui = counted_glVertexP4ui;
+        }
+        if (glad_glVertexP4uiv && glad_glVertexP4uiv != counted_glVertexP4uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexP4uiv] = (void*)glad_glVertexP4uiv;
+            glad_glVertexP4uiv = counted_glVertexP4uiv;
+        }
+        if (glad_glTexCoordP1ui && glad_glTexCoordP1ui != counted_glTexCoordP1ui)
+        {
+            Table<>::loaded[ENTRY_glTexCoordP1ui] = (void*)glad_glTexCoordP1ui;
+            glad_glTexCoordP1ui = counted_glTexCoordP1ui;
+        }
+        if (glad_glTexCoordP1uiv && glad_glTexCoordP1uiv != counted_glTexCoordP1uiv)
+        {
+            Table<>::loaded[ENTRY_glTexCoordP1uiv] = (void*)glad_glTexCoordP1uiv;
+            glad_glTexCoordP1uiv = counted_glTexCoordP1uiv;
+        }
+        if (glad_glTexCoordP2ui && glad_glTexCoordP2ui != counted_glTexCoordP2ui)
+        {
+            Table<>::loaded[ENTRY_glTexCoordP2ui] = (void*)glad_glTexCoordP2ui;
+            glad_glTexCoordP2ui = counted_glTexCoordP2ui;
+        }
+        if (glad_glTexCoordP2uiv && glad_glTexCoordP2uiv != counted_glTexCoordP2uiv)
+        {
+            Table<>::loaded[ENTRY_glTexCoordP2uiv] = (void*)glad_glTexCoordP2uiv;
+            glad_glTexCoordP2uiv = counted_glTexCoordP2uiv;
+        }
+        if (glad_glTexCoordP3ui && glad_glTexCoordP3ui != counted_glTexCoordP3ui)
+        {
+            Table<>::loaded[ENTRY_glTexCoordP3ui] = (void*)glad_glTexCoordP3ui;
+            glad_glTexCoordP3ui = counted_glTexCoordP3ui;
+        }
+        if (glad_glTexCoordP3uiv && glad_glTexCoordP3uiv != counted_glTexCoordP3uiv)
+        {
+            Table<>::loaded[ENTRY_glTexCoordP3uiv] = (void*)glad_glTexCoordP3uiv;
+            glad_glTexCoordP3uiv = counted_glTexCoordP3uiv;
+        }
+        if (glad_glTexCoordP4ui && glad_glTexCoordP4ui != counted_glTexCoordP4ui)
+        {
+            Table<>::loaded[ENTRY_glTexCoordP4ui] = (void*)glad_glTexCoordP4ui;
+            glad_glTexCoordP4ui = counted_glTexCoordP4ui;
+        }
+        if (glad_glTexCoordP4uiv && glad_glTexCoordP4uiv != counted_glTexCoordP4uiv)
+        {
+            Table<>::loaded[ENTRY_glTexCoordP4uiv] = (void*)glad_glTexCoordP4uiv;
+            glad_glTexCoordP4uiv = counted_glTexCoordP4uiv;
+        }
+        if (glad_glMultiTexCoordP1ui && glad_glMultiTexCoordP1ui != counted_glMultiTexCoordP1ui)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoordP1ui] = (void*)glad_glMultiTexCoordP1ui;
+            glad_glMultiTexCoordP1ui = counted_glMultiTexCoordP1ui;
+        }
+        if (glad_glMultiTexCoordP1uiv && glad_glMultiTexCoordP1uiv != counted_glMultiTexCoordP1uiv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoordP1uiv] = (void*)glad_glMultiTexCoordP1uiv;
+            glad_glMultiTexCoordP1uiv = counted_glMultiTexCoordP1uiv;
+        }
+        if (glad_glMultiTexCoordP2ui && glad_glMultiTexCoordP2ui != counted_glMultiTexCoordP2ui)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoordP2ui] = (void*)glad_glMultiTexCoordP2ui;
+            glad_glMultiTexCoordP2ui = counted_glMultiTexCoordP2ui;
+        }
+        if (glad_glMultiTexCoordP2uiv && glad_glMultiTexCoordP2uiv != counted_glMultiTexCoordP2uiv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoordP2uiv] = (void*)glad_glMultiTexCoordP2uiv;
+            glad_glMultiTexCoordP2uiv = counted_glMultiTexCoordP2uiv;
+        }
+        if (glad_glMultiTexCoordP3ui && glad_glMultiTexCoordP3ui != counted_glMultiTexCoordP3ui)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoordP3ui] = (void*)glad_glMultiTexCoordP3ui;
+            glad_glMultiTexCoordP3ui = counted_glMultiTexCoordP3ui;
+        }
+        if (glad_glMultiTexCoordP3uiv && glad_glMultiTexCoordP3uiv != counted_glMultiTexCoordP3uiv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoordP3uiv] = (void*)glad_glMultiTexCoordP3uiv;
+            glad_glMultiTexCoordP3uiv = counted_glMultiTexCoordP3uiv;
+        }
+        if (glad_glMultiTexCoordP4ui && glad_glMultiTexCoordP4ui != counted_glMultiTexCoordP4ui)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoordP4ui] = (void*)glad_glMultiTexCoordP4ui;
+            glad_glMultiTexCoordP4ui = counted_glMultiTexCoordP4ui;
+        }
+        if (glad_glMultiTexCoordP4uiv && glad_glMultiTexCoordP4uiv != counted_glMultiTexCoordP4uiv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoordP4uiv] = (void*)glad_glMultiTexCoordP4uiv;
+            glad_glMultiTexCoordP4uiv = counted_glMultiTexCoordP4uiv;
+        }
+        if (glad_glNormalP3ui && glad_glNormalP3ui != counted_glNormalP3ui)
+        {
+            Table<>::loaded[ENTRY_glNormalP3ui] = (void*)glad_glNormalP3ui;
+            glad_glNormalP3ui = counted_glNormalP3ui;
+        }
+        if (glad_glNormalP3uiv && glad_glNormalP3uiv != counted_glNormalP3uiv)
+        {
+            Table<>::loaded[ENTRY_glNormalP3uiv] = (void*)glad_glNormalP3uiv;
+            glad_glNormalP3uiv = counted_glNormalP3uiv;
+        }
+        if (glad_glColorP3ui && glad_glColorP3ui != counted_glColorP3ui)
+        {
+            Table<>::loaded[ENTRY_glColorP3ui] = (void*)glad_glColorP3ui;
+            glad_glColorP3ui = counted_glColorP3ui;
+        }
+        if (glad_glColorP3uiv && glad_glColorP3uiv != counted_glColorP3uiv)
+        {
+            Table<>::loaded[ENTRY_glColorP3uiv] = (void*)glad_glColorP3uiv;
+            glad_glColorP3uiv = counted_glColorP3uiv;
+        }
+        if (glad_glColorP4ui && glad_glColorP4ui != counted_glColorP4ui)
+        {
+            Table<>::loaded[ENTRY_glColorP4ui] = (void*)glad_glColorP4ui;
+            glad_glColorP4ui = counted_glColorP4ui;
+        }
+        if (glad_glColorP4uiv && glad_glColorP4uiv != counted_glColorP4uiv)
+        {
+            Table<>::loaded[ENTRY_glColorP4uiv] = (void*)glad_glColorP4uiv;
+            glad_glColorP4uiv = counted_glColorP4uiv;
+        }
+        if (glad_glSecondaryColorP3ui && glad_glSecondaryColorP3ui != counted_glSecondaryColorP3ui)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColorP3ui] = (void*)glad_glSecondaryColorP3ui;
+            glad_glSecondaryColorP3ui = counted_glSecondaryColorP3ui;
+        }
+        if (glad_glSecondaryColorP3uiv && glad_glSecondaryColorP3uiv != counted_glSecondaryColorP3uiv)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColorP3uiv] = (void*)glad_glSecondaryColorP3uiv;
+            glad_glSecondaryColorP3uiv = counted_glSecondaryColorP3uiv;
+        }
+    }
+    inline void uninstall()
+    {
+        if (glad_glCullFace == counted_glCullFace)
+            glad_glCullFace = (PFNGLCULLFACEPROC)Table<>::loaded[ENTRY_glCullFace];
+        if (glad_glFrontFace == counted_glFrontFace)
+            glad_glFrontFace = (PFNGLFRONTFACEPROC)Table<>::loaded[ENTRY_glFrontFace];
+        if (glad_glHint == counted_glHint)
+            glad_glHint = (PFNGLHINTPROC)Table<>::loaded[ENTRY_glHint];
+        if (glad_glLineWidth == counted_glLineWidth)
+            glad_glLineWidth = (PFNGLLINEWIDTHPROC)Table<>::loaded[ENTRY_glLineWidth];
+        if (glad_glPointSize == counted_glPointSize)
+            glad_glPointSize = (PFNGLPOINTSIZEPROC)Table<>::loaded[ENTRY_glPointSize];
+        if (glad_glPolygonMode == counted_glPolygonMode)
+            glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)Table<>::loaded[ENTRY_glPolygonMode];
+        if (glad_glScissor == counted_glScissor)
+            glad_glScissor = (PFNGLSCISSORPROC)Table<>::loaded[ENTRY_glScissor];
+        if (glad_glTexParameterf == counted_glTexParameterf)
+            glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)Table<>::loaded[ENTRY_glTexParameterf];
+        if (glad_glTexParameterfv == counted_glTexParameterfv)
+            glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)Table<>::loaded[ENTRY_glTexParameterfv];
+        if (glad_glTexParameteri == counted_glTexParameteri)
+            glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)Table<>::loaded[ENTRY_glTexParameteri];
+        if (glad_glTexParameteriv == counted_glTexParameteriv)
+            glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)Table<>::loaded[ENTRY_glTexParameteriv];
+        if (glad_glTexImage1D == counted_glTexImage1D)
+            glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)Table<>::loaded[ENTRY_glTexImage1D];
+        if (glad_glTexImage2D == counted_glTexImage2D)
+            glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)Table<>::loaded[ENTRY_glTexImage2D];
+        if (glad_glDrawBuffer == counted_glDrawBuffer)
+            glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)Table<>::loaded[ENTRY_glDrawBuffer];
+        if (glad_glClear == counted_glClear)
+            glad_glClear = (PFNGLCLEARPROC)Table<>::loaded[ENTRY_glClear];
+        if (glad_glClearColor == counted_glClearColor)
+            glad_glClearColor = (PFNGLCLEARCOLORPROC)Table<>::loaded[ENTRY_glClearColor];
+        if (glad_glClearStencil == counted_glClearStencil)
+            glad_glClearStencil = (PFNGLCLEARSTENCILPROC)Table<>::loaded[ENTRY_glClearStencil];
+        if (glad_glClearDepth == counted_glClearDepth)
+            glad_glClearDepth = (PFNGLCLEARDEPTHPROC)Table<>::loaded[ENTRY_glClearDepth];
+        if (glad_glStencilMask == counted_glStencilMask)
+            glad_glStencilMask = (PFNGLSTENCILMASKPROC)Table<>::loaded[ENTRY_glStencilMask];
+        if (glad_glColorMask == counted_glColorMask)
+            glad_glColorMask = (PFNGLCOLORMASKPROC)Table<>::loaded[ENTRY_glColorMask];
+        if (glad_glDepthMask == counted_glDepthMask)
+            glad_glDepthMask = (PFNGLDEPTHMASKPROC)Table<>::loaded[ENTRY_glDepthMask];
+        if (glad_glDisable == counted_glDisable)
+            glad_glDisable = (PFNGLDISABLEPROC)Table<>::loaded[ENTRY_glDisable];
+        if (glad_glEnable == counted_glEnable)
+            glad_glEnable = (PFNGLENABLEPROC)Table<>::loaded[ENTRY_glEnable];
+        if (glad_glFinish == counted_glFinish)
+            glad_glFinish = (PFNGLFINISHPROC)Table<>::loaded[ENTRY_glFinish];
+        if (glad_glFlush == counted_glFlush)
+            glad_glFlush = (PFNGLFLUSHPROC)Table<>::loaded[ENTRY_glFlush];
+        if (glad_glBlendFunc == counted_glBlendFunc)
+            glad_glBlendFunc = (PFNGLBLENDFUNCPROC)Table<>::loaded[ENTRY_glBlendFunc];
+        if (glad_glLogicOp == counted_glLogicOp)
+            glad_glLogicOp = (PFNGLLOGICOPPROC)Table<>::loaded[ENTRY_glLogicOp];
+        if (glad_glStencilFunc == counted_glStencilFunc)
+            glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)Table<>::loaded[ENTRY_glStencilFunc];
+        if (glad_glStencilOp == counted_glStencilOp)
+            glad_glStencilOp = (PFNGLSTENCILOPPROC)Table<>::loaded[ENTRY_glStencilOp];
+        if (glad_glDepthFunc == counted_glDepthFunc)
+            glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)Table<>::loaded[ENTRY_glDepthFunc];
+        if (glad_glPixelStoref == counted_glPixelStoref)
+            glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)Table<>::loaded[ENTRY_glPixelStoref];
+        if (glad_glPixelStorei == counted_glPixelStorei)
+            glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)Table<>::loaded[ENTRY_glPixelStorei];
+        if (glad_glReadBuffer == counted_glReadBuffer)
+            glad_glReadBuffer = (PFNGLREADBUFFERPROC)Table<>::loaded[ENTRY_glReadBuffer];
+        if (glad_glReadPixels == counted_glReadPixels)
+            glad_glReadPixels = (PFNGLREADPIXELSPROC)Table<>::loaded[ENTRY_glReadPixels];
+        if (glad_glGetBooleanv == counted_glGetBooleanv)
+            glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)Table<>::loaded[ENTRY_glGetBooleanv];
+        if (glad_glGetDoublev == counted_glGetDoublev)
+            glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)Table<>::loaded[ENTRY_glGetDoublev];
+        if (glad_glGetError == counted_glGetError)
+            glad_glGetError = (PFNGLGETERRORPROC)Table<>::loaded[ENTRY_glGetError];
+        if (glad_glGetFloatv == counted_glGetFloatv)
+            glad_glGetFloatv = (PFNGLGETFLOATVPROC)Table<>::loaded[ENTRY_glGetFloatv];
+        if (glad_glGetIntegerv == counted_glGetIntegerv)
+            glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)Table<>::loaded[ENTRY_glGetIntegerv];
+        if (glad_glGetString == counted_glGetString)
+            glad_glGetString = (PFNGLGETSTRINGPROC)Table<>::loaded[ENTRY_glGetString];
+        if (glad_glGetTexImage == counted_glGetTexImage)
+            glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)Table<>::loaded[ENTRY_glGetTexImage];
+        if (glad_glGetTexParameterfv == counted_glGetTexParameterfv)
+            glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)Table<>::loaded[ENTRY_glGetTexParameterfv];
+        if (glad_glGetTexParameteriv == counted_glGetTexParameteriv)
+            glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)Table<>::loaded[ENTRY_glGetTexParameteriv];
+        if (glad_glGetTexLevelParameterfv == counted_glGetTexLevelParameterfv)
+            glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)Table<>::loaded[ENTRY_glGetTexLevelParameterfv];
+        if (glad_glGetTexLevelParameteriv == counted_glGetTexLevelParameteriv)
+            glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)Table<>::loaded[ENTRY_glGetTexLevelParameteriv];
+        if (glad_glIsEnabled == counted_glIsEnabled)
+            glad_glIsEnabled = (PFNGLISENABLEDPROC)Table<>::loaded[ENTRY_glIsEnabled];
+        if (glad_glDepthRange == counted_glDepthRange)
+            glad_glDepthRange = (PFNGLDEPTHRANGEPROC)Table<>::loaded[ENTRY_glDepthRange];
+        if (glad_glViewport == counted_glViewport)
+            glad_glViewport = (PFNGLVIEWPORTPROC)Table<>::loaded[ENTRY_glViewport];
+        if (glad_glNewList == counted_glNewList)
+            glad_glNewList = (PFNGLNEWLISTPROC)Table<>::loaded[ENTRY_glNewList];
+        if (glad_glEndList == counted_glEndList)
+            glad_glEndList = (PFNGLENDLISTPROC)Table<>::loaded[ENTRY_glEndList];
+        if (glad_glCallList == counted_glCallList)
+            glad_glCallList = (PFNGLCALLLISTPROC)Table<>::loaded[ENTRY_glCallList];
+        if (glad_glCallLists == counted_glCallLists)
+            glad_glCallLists = (PFNGLCALLLISTSPROC)Table<>::loaded[ENTRY_glCallLists];
+        if (glad_glDeleteLists == counted_glDeleteLists)
+            glad_glDeleteLists = (PFNGLDELETELISTSPROC)Table<>::loaded[ENTRY_glDeleteLists];
+        if (glad_glGenLists == counted_glGenLists)
+            glad_glGenLists = (PFNGLGENLISTSPROC)Table<>::loaded[ENTRY_glGenLists];
+        if (glad_glListBase == counted_glListBase)
+            glad_glListBase = (PFNGLLISTBASEPROC)Table<>::loaded[ENTRY_glListBase];
+        if (glad_glBegin == counted_glBegin)
+            glad_glBegin = (PFNGLBEGINPROC)Table<>::loaded[ENTRY_glBegin];
+        if (glad_glBitmap == counted_glBitmap)
+            glad_glBitmap = (PFNGLBITMAPPROC)Table<>::loaded[ENTRY_glBitmap];
+        if (glad_glColor3b == counted_glColor3b)
+            glad_glColor3b = (PFNGLCOLOR3BPROC)Table<>::loaded[ENTRY_glColor3b];
+        if (glad_glColor3bv == counted_glColor3bv)
+            glad_glColor3bv = (PFNGLCOLOR3BVPROC)Table<>::loaded[ENTRY_glColor3bv];
+        if (glad_glColor3d == counted_glColor3d)
+            glad_glColor3d = (PFNGLCOLOR3DPROC)Table<>::loaded[ENTRY_glColor3d];
+        if (glad_glColor3dv == counted_glColor3dv)
+            glad_glColor3dv = (PFNGLCOLOR3DVPROC)Table<>::loaded[ENTRY_glColor3dv];
+        if (glad_glColor3f == counted_glColor3f)
+            glad_glColor3f = (PFNGLCOLOR3FPROC)Table<>::loaded[ENTRY_glColor3f];
+        if (glad_glColor3fv == counted_glColor3fv)
+            glad_glColor3fv = (PFNGLCOLOR3FVPROC)Table<>::loaded[ENTRY_glColor3fv];
+        if (glad_glColor3i == counted_glColor3i)
+            glad_glColor3i = (PFNGLCOLOR3IPROC)Table<>::loaded[ENTRY_glColor3i];
+        if (glad_glColor3iv == counted_glColor3iv)
+            glad_glColor3iv = (PFNGLCOLOR3IVPROC)Table<>::loaded[ENTRY_glColor3iv];
+        if (glad_glColor3s == counted_glColor3s)
+            glad_glColor3s = (PFNGLCOLOR3SPROC)Table<>::loaded[ENTRY_glColor3s];
+        if (glad_glColor3sv == counted_glColor3sv)
+            glad_glColor3sv = (PFNGLCOLOR3SVPROC)Table<>::loaded[ENTRY_glColor3sv];
+        if (glad_glColor3ub == counted_glColor3ub)
+            glad_glColor3ub = (PFNGLCOLOR3UBPROC)Table<>::loaded[ENTRY_glColor3ub];
+        if (glad_glColor3ubv == counted_glColor3ubv)
+            glad_glColor3ubv = (PFNGLCOLOR3UBVPROC)Table<>::loaded[ENTRY_glColor3ubv];
+        if (glad_glColor3ui == counted_glColor3ui)
+            glad_glColor3ui = (PFNGLCOLOR3UIPROC)Table<>::loaded[ENTRY_glColor3ui];
+        if (glad_glColor3uiv == counted_glColor3uiv)
+            glad_glColor3uiv = (PFNGLCOLOR3UIVPROC)Table<>::loaded[ENTRY_glColor3uiv];
+        if (glad_glColor3us == counted_glColor3us)
+            glad_glColor3us = (PFNGLCOLOR3USPROC)Table<>::loaded[ENTRY_glColor3us];
+        if (glad_glColor3usv == counted_glColor3usv)
+            glad_glColor3usv = (PFNGLCOLOR3USVPROC)Table<>::loaded[ENTRY_glColor3usv];
+        if (glad_glColor4b == counted_glColor4b)
+            glad_glColor4b = (PFNGLCOLOR4BPROC)Table<>::loaded[ENTRY_glColor4b];
+        if (glad_glColor4bv == counted_glColor4bv)
+            glad_glColor4bv = (PFNGLCOLOR4BVPROC)Table<>::loaded[ENTRY_glColor4bv];
+        if (glad_glColor4d == counted_glColor4d)
+            glad_glColor4d = (PFNGLCOLOR4DPROC)Table<>::loaded[ENTRY_glColor4d];
+        if (glad_glColor4dv == counted_glColor4dv)
+            glad_glColor4dv = (PFNGLCOLOR4DVPROC)Table<>::loaded[ENTRY_glColor4dv];
+        if (glad_glColor4f == counted_glColor4f)
+            glad_glColor4f = (PFNGLCOLOR4FPROC)Table<>::loaded[ENTRY_glColor4f];
+        if (glad_glColor4fv == counted_glColor4fv)
+            glad_glColor4fv = (PFNGLCOLOR4FVPROC)Table<>::loaded[ENTRY_glColor4fv];
+        if (glad_glColor4i == counted_glColor4i)
+            glad_glColor4i = (PFNGLCOLOR4IPROC)Table<>::loaded[ENTRY_glColor4i];
+        if (glad_glColor4iv == counted_glColor4iv)
+            glad_glColor4iv = (PFNGLCOLOR4IVPROC)Table<>::loaded[ENTRY_glColor4iv];
+        if (glad_glColor4s == counted_glColor4s)
+            glad_glColor4s = (PFNGLCOLOR4SPROC)Table<>::loaded[ENTRY_glColor4s];
+        if (glad_glColor4sv == counted_glColor4sv)
+            glad_glColor4sv = (PFNGLCOLOR4SVPROC)Table<>::loaded[ENTRY_glColor4sv];
+        if (glad_glColor4ub == counted_glColor4ub)
+            glad_glColor4ub = (PFNGLCOLOR4UBPROC)Table<>::loaded[ENTRY_glColor4ub];
+        if (glad_glColor4ubv == counted_glColor4ubv)
+            glad_glColor4ubv = (PFNGLCOLOR4UBVPROC)Table<>::loaded[ENTRY_glColor4ubv];
+        if (glad_glColor4ui == counted_glColor4ui)
+            glad_glColor4ui = (PFNGLCOLOR4UIPROC)Table<>::loaded[ENTRY_glColor4ui];
+        if (glad_glColor4uiv == counted_glColor4uiv)
+            glad_glColor4uiv = (PFNGLCOLOR4UIVPROC)Table<>::loaded[ENTRY_glColor4uiv];
+        if (glad_glColor4us == counted_glColor4us)
+            glad_glColor4us = (PFNGLCOLOR4USPROC)Table<>::loaded[ENTRY_glColor4us];
+        if (glad_glColor4usv == counted_glColor4usv)
+            glad_glColor4usv = (PFNGLCOLOR4USVPROC)Table<>::loaded[ENTRY_glColor4usv];
+        if (glad_glEdgeFlag == counted_glEdgeFlag)
+            glad_glEdgeFlag = (PFNGLEDGEFLAGPROC)Table<>::loaded[ENTRY_glEdgeFlag];
+        if (glad_glEdgeFlagv == counted_glEdgeFlagv)
+            glad_glEdgeFlagv = (PFNGLEDGEFLAGVPROC)Table<>::loaded[ENTRY_glEdgeFlagv];
+        if (glad_glEnd == counted_glEnd)
+            glad_glEnd = (PFNGLENDPROC)Table<>::loaded[ENTRY_glEnd];
+        if (glad_glIndexd == counted_glIndexd)
+            glad_glIndexd = (PFNGLINDEXDPROC)Table<>::loaded[ENTRY_glIndexd];
+        if (glad_glIndexdv == counted_glIndexdv)
+            glad_glIndexdv = (PFNGLINDEXDVPROC)Table<>::loaded[ENTRY_glIndexdv];
+        if (glad_glIndexf == counted_glIndexf)
+            glad_glIndexf = (PFNGLINDEXFPROC)Table<>::loaded[ENTRY_glIndexf];
+        if (glad_glIndexfv == counted_glIndexfv)
+            glad_glIndexfv = (PFNGLINDEXFVPROC)Table<>::loaded[ENTRY_glIndexfv];
+        if (glad_glIndexi == counted_glIndexi)
+            glad_glIndexi = (PFNGLINDEXIPROC)Table<>::loaded[ENTRY_glIndexi];
+        if (glad_glIndexiv == counted_glIndexiv)
+            glad_glIndexiv = (PFNGLINDEXIVPROC)Table<>::loaded[ENTRY_glIndexiv];
+        if (glad_glIndexs == counted_glIndexs)
+            glad_glIndexs = (PFNGLINDEXSPROC)Table<>::loaded[ENTRY_glIndexs];
+        if (glad_glIndexsv == counted_glIndexsv)
+            glad_glIndexsv = (PFNGLINDEXSVPROC)Table<>::loaded[ENTRY_glIndexsv];
+        if (glad_glNormal3b == counted_glNormal3b)
+            glad_glNormal3b = (PFNGLNORMAL3BPROC)Table<>::loaded[ENTRY_glNormal3b];
+        if (glad_glNormal3bv == counted_glNormal3bv)
+            glad_glNormal3bv = (PFNGLNORMAL3BVPROC)Table<>::loaded[ENTRY_glNormal3bv];
+        if (glad_glNormal3d == counted_glNormal3d)
+            glad_glNormal3d = (PFNGLNORMAL3DPROC)Table<>::loaded[ENTRY_glNormal3d];
+        if (glad_glNormal3dv == counted_glNormal3dv)
+            glad_glNormal3dv = (PFNGLNORMAL3DVPROC)Table<>::loaded[ENTRY_glNormal3dv];
+        if (glad_glNormal3f == counted_glNormal3f)
+            glad_glNormal3f = (PFNGLNORMAL3FPROC)Table<>::loaded[ENTRY_glNormal3f];
+        if (glad_glNormal3fv == counted_glNormal3fv)
+            glad_glNormal3fv = (PFNGLNORMAL3FVPROC)Table<>::loaded[ENTRY_glNormal3fv];
+        if (glad_glNormal3i == counted_glNormal3i)
+            glad_glNormal3i = (PFNGLNORMAL3IPROC)Table<>::loaded[ENTRY_glNormal3i];
+        if (glad_glNormal3iv == counted_glNormal3iv)
+            glad_glNormal3iv = (PFNGLNORMAL3IVPROC)Table<>::loaded[ENTRY_glNormal3iv];
+        if (glad_glNormal3s == counted_glNormal3s)
+            glad_glNormal3s = (PFNGLNORMAL3SPROC)Table<>::loaded[ENTRY_glNormal3s];
+        if (glad_glNormal3sv == counted_glNormal3sv)
+            glad_glNormal3sv = (PFNGLNORMAL3SVPROC)Table<>::loaded[ENTRY_glNormal3sv];
+        if (glad_glRasterPos2d == counted_glRasterPos2d)
+            glad_glRasterPos2d = (PFNGLRASTERPOS2DPROC)Table<>::loaded[ENTRY_glRasterPos2d];
+        if (glad_glRasterPos2dv == counted_glRasterPos2dv)
+            glad_glRasterPos2dv = (PFNGLRASTERPOS2DVPROC)Table<>::loaded[ENTRY_glRasterPos2dv];
+        if (glad_glRasterPos2f == counted_glRasterPos2f)
+            glad_glRasterPos2f = (PFNGLRASTERPOS2FPROC)Table<>::loaded[ENTRY_glRasterPos2f];
+        if (glad_glRasterPos2fv == counted_glRasterPos2fv)
+            glad_glRasterPos2fv = (PFNGLRASTERPOS2FVPROC)Table<>::loaded[ENTRY_glRasterPos2fv];
+        if (glad_glRasterPos2i == counted_glRasterPos2i)
+            glad_glRasterPos2i = (PFNGLRASTERPOS2IPROC)Table<>::loaded[ENTRY_glRasterPos2i];
+        if (glad_glRasterPos2iv == counted_glRasterPos2iv)
+            glad_glRasterPos2iv = (PFNGLRASTERPOS2IVPROC)Table<>::loaded[ENTRY_glRasterPos2iv];
+        if (glad_glRasterPos2s == counted_glRasterPos2s)
+            glad_glRasterPos2s = (PFNGLRASTERPOS2SPROC)Table<>::loaded[ENTRY_glRasterPos2s];
+        if (glad_glRasterPos2sv == counted_glRasterPos2sv)
+            glad_glRasterPos2sv = (PFNGLRASTERPOS2SVPROC)Table<>::loaded[ENTRY_glRasterPos2sv];
+        if (glad_glRasterPos3d == counted_glRasterPos3d)
+            glad_glRasterPos3d = (PFNGLRASTERPOS3DPROC)Table<>::loaded[ENTRY_glRasterPos3d];
+        if (glad_glRasterPos3dv == counted_glRasterPos3dv)
+            glad_glRasterPos3dv = (PFNGLRASTERPOS3DVPROC)Table<>::loaded[ENTRY_glRasterPos3dv];
+        if (glad_glRasterPos3f == counted_glRasterPos3f)
+            glad_glRasterPos3f = (PFNGLRASTERPOS3FPROC)Table<>::loaded[ENTRY_glRasterPos3f];
+        if (glad_glRasterPos3fv == counted_glRasterPos3fv)
+            glad_glRasterPos3fv = (PFNGLRASTERPOS3FVPROC)Table<>::loaded[ENTRY_glRasterPos3fv];
+        if (glad_glRasterPos3i == counted_glRasterPos3i)
+            glad_glRasterPos3i = (PFNGLRASTERPOS3IPROC)Table<>::loaded[ENTRY_glRasterPos3i];
+        if (glad_glRasterPos3iv == counted_glRasterPos3iv)
+            glad_glRasterPos3iv = (PFNGLRASTERPOS3IVPROC)Table<>::loaded[ENTRY_glRasterPos3iv];
+        if (glad_glRasterPos3s == counted_glRasterPos3s)
+            glad_glRasterPos3s = (PFNGLRASTERPOS3SPROC)Table<>::loaded[ENTRY_glRasterPos3s];
+        if (glad_glRasterPos3sv == counted_glRasterPos3sv)
+            glad_glRasterPos3sv = (PFNGLRASTERPOS3SVPROC)Table<>::loaded[ENTRY_glRasterPos3sv];
+        if (glad_glRasterPos4d == counted_glRasterPos4d)
+            glad_glRasterPos4d = (PFNGLRASTERPOS4DPROC)Table<>::loaded[ENTRY_glRasterPos4d];
+        if (glad_glRasterPos4dv == counted_glRasterPos4dv)
+            glad_glRasterPos4dv = (PFNGLRASTERPOS4DVPROC)Table<>::loaded[ENTRY_glRasterPos4dv];
+        if (glad_glRasterPos4f == counted_glRasterPos4f)
+            glad_glRasterPos4f = (PFNGLRASTERPOS4FPROC)Table<>::loaded[ENTRY_glRasterPos4f];
+        if (glad_glRasterPos4fv == counted_glRasterPos4fv)
+            glad_glRasterPos4fv = (PFNGLRASTERPOS4FVPROC)Table<>::loaded[ENTRY_glRasterPos4fv];
+        if (glad_glRasterPos4i == counted_glRasterPos4i)
+            glad_glRasterPos4i = (PFNGLRASTERPOS4IPROC)Table<>::loaded[ENTRY_glRasterPos4i];
+        if (glad_glRasterPos4iv == counted_glRasterPos4iv)
+            glad_glRasterPos4iv = (PFNGLRASTERPOS4IVPROC)Table<>::loaded[ENTRY_glRasterPos4iv];
+        if (glad_glRasterPos4s == counted_glRasterPos4s)
+            glad_glRasterPos4s = (PFNGLRASTERPOS4SPROC)Table<>::loaded[ENTRY_glRasterPos4s];
+        if (glad_glRasterPos4sv == counted_glRasterPos4sv)
+            glad_glRasterPos4sv = (PFNGLRASTERPOS4SVPROC)Table<>::loaded[ENTRY_glRasterPos4sv];
+        if (glad_glRectd == counted_glRectd)
+            glad_glRectd = (PFNGLRECTDPROC)Table<>::loaded[ENTRY_glRectd];
+        if (glad_glRectdv == counted_glRectdv)
+            glad_glRectdv = (PFNGLRECTDVPROC)Table<>::loaded[ENTRY_glRectdv];
+        if (glad_glRectf == counted_glRectf)
+            glad_glRectf = (PFNGLRECTFPROC)Table<>::loaded[ENTRY_glRectf];
+        if (glad_glRectfv == counted_glRectfv)
+            glad_glRectfv = (PFNGLRECTFVPROC)Table<>::loaded[ENTRY_glRectfv];
+        if (glad_glRecti == counted_glRecti)
+            glad_glRecti = (PFNGLRECTIPROC)Table<>::loaded[ENTRY_glRecti];
+        if (glad_glRectiv == counted_glRectiv)
+            glad_glRectiv = (PFNGLRECTIVPROC)Table<>::loaded[ENTRY_glRectiv];
+        if (glad_glRects == counted_glRects)
+            glad_glRects = (PFNGLRECTSPROC)Table<>::loaded[ENTRY_glRects];
+        if (glad_glRectsv == counted_glRectsv)
+            glad_glRectsv = (PFNGLRECTSVPROC)Table<>::loaded[ENTRY_glRectsv];
+        if (glad_glTexCoord1d == counted_glTexCoord1d)
+            glad_glTexCoord1d = (PFNGLTEXCOORD1DPROC)Table<>::loaded[ENTRY_glTexCoord1d];
+        if (glad_glTexCoord1dv == counted_glTexCoord1dv)
+            glad_glTexCoord1dv = (PFNGLTEXCOORD1DVPROC)Table<>::loaded[ENTRY_glTexCoord1dv];
+        if (glad_glTexCoord1f == counted_glTexCoord1f)
+            glad_glTexCoord1f = (PFNGLTEXCOORD1FPROC)Table<>::loaded[ENTRY_glTexCoord1f];
+        if (glad_glTexCoord1fv == counted_glTexCoord1fv)
+            glad_glTexCoord1fv = (PFNGLTEXCOORD1FVPROC)Table<>::loaded[ENTRY_glTexCoord1fv];
+        if (glad_glTexCoord1i == counted_glTexCoord1i)
+            glad_glTexCoord1i = (PFNGLTEXCOORD1IPROC)Table<>::loaded[ENTRY_glTexCoord1i];
+        if (glad_glTexCoord1iv == counted_glTexCoord1iv)
+            glad_glTexCoord1iv = (PFNGLTEXCOORD1IVPROC)Table<>::loaded[ENTRY_glTexCoord1iv];
+        if (glad_glTexCoord1s == counted_glTexCoord1s)
+            glad_glTexCoord1s = (PFNGLTEXCOORD1SPROC)Table<>::loaded[ENTRY_glTexCoord1s];
+        if (glad_glTexCoord1sv == counted_glTexCoord1sv)
+            glad_glTexCoord1sv = (PFNGLTEXCOORD1SVPROC)Table<>::loaded[ENTRY_glTexCoord1sv];
+        if (glad_glTexCoord2d == counted_glTexCoord2d)
+            glad_glTexCoord2d = (PFNGLTEXCOORD2DPROC)Table<>::loaded[ENTRY_glTexCoord2d];
+        if (glad_glTexCoord2dv == counted_glTexCoord2dv)
+            glad_glTexCoord2dv = (PFNGLTEXCOORD2DVPROC)Table<>::loaded[ENTRY_glTexCoord2dv];
+        if (glad_glTexCoord2f == counted_glTexCoord2f)
+            glad_glTexCoord2f = (PFNGLTEXCOORD2FPROC)Table<>::loaded[ENTRY_glTexCoord2f];
+        if (glad_glTexCoord2fv == counted_glTexCoord2fv)
+            glad_glTexCoord2fv = (PFNGLTEXCOORD2FVPROC)Table<>::loaded[ENTRY_glTexCoord2fv];
+        if (glad_glTexCoord2i == counted_glTexCoord2i)
+            glad_glTexCoord2i = (PFNGLTEXCOORD2IPROC)Table<>::loaded[ENTRY_glTexCoord2i];
+        if (glad_glTexCoord2iv == counted_glTexCoord2iv)
+            glad_glTexCoord2iv = (PFNGLTEXCOORD2IVPROC)Table<>::loaded[ENTRY_glTexCoord2iv];
+        if (glad_glTexCoord2s == counted_glTexCoord2s)
+            glad_glTexCoord2s = (PFNGLTEXCOORD2SPROC)Table<>::loaded[ENTRY_glTexCoord2s];
+        if (glad_glTexCoord2sv == counted_glTexCoord2sv)
+            glad_glTexCoord2sv = (PFNGLTEXCOORD2SVPROC)Table<>::loaded[ENTRY_glTexCoord2sv];
+        if (glad_glTexCoord3d == counted_glTexCoord3d)
+            glad_glTexCoord3d = (PFNGLTEXCOORD3DPROC)Table<>::loaded[ENTRY_glTexCoord3d];
+        if (glad_glTexCoord3dv == counted_glTexCoord3dv)
+            glad_glTexCoord3dv = (PFNGLTEXCOORD3DVPROC)Table<>::loaded[ENTRY_glTexCoord3dv];
+        if (glad_glTexCoord3f == counted_glTexCoord3f)
+            glad_glTexCoord3f = (PFNGLTEXCOORD3FPROC)Table<>::loaded[ENTRY_glTexCoord3f];
+        if (glad_glTexCoord3fv == counted_glTexCoord3fv)
+            glad_glTexCoord3fv = (PFNGLTEXCOORD3FVPROC)Table<>::loaded[ENTRY_glTexCoord3fv];
+        if (glad_glTexCoord3i == counted_glTexCoord3i)
+            glad_glTexCoord3i = (PFNGLTEXCOORD3IPROC)Table<>::loaded[ENTRY_glTexCoord3i];
+        if (glad_glTexCoord3iv == counted_glTexCoord3iv)
+            glad_glTexCoord3iv = (PFNGLTEXCOORD3IVPROC)Table<>::loaded[ENTRY_glTexCoord3iv];
+        if (glad_glTexCoord3s == counted_glTexCoord3s)
+            glad_glTexCoord3s = (PFNGLTEXCOORD3SPROC)Table<>::loaded[ENTRY_glTexCoord3s];
+        if (glad_glTexCoord3sv == counted_glTexCoord3sv)
+            glad_glTexCoord3sv = (PFNGLTEXCOORD3SVPROC)Table<>::loaded[ENTRY_glTexCoord3sv];
+        if (glad_glTexCoord4d == counted_glTexCoord4d)
+            glad_glTexCoord4d = (PFNGLTEXCOORD4DPROC)Table<>::loaded[ENTRY_glTexCoord4d];
+        if (glad_glTexCoord4dv == counted_glTexCoord4dv)
+            glad_glTexCoord4dv = (PFNGLTEXCOORD4DVPROC)Table<>::loaded[ENTRY_glTexCoord4dv];
+        if (glad_glTexCoord4f == counted_glTexCoord4f)
+            glad_glTexCoord4f = (PFNGLTEXCOORD4FPROC)Table<>::loaded[ENTRY_glTexCoord4f];
+        if (glad_glTexCoord4fv == counted_glTexCoord4fv)
+            glad_glTexCoord4fv = (PFNGLTEXCOORD4FVPROC)Table<>::loaded[ENTRY_glTexCoord4fv];
+        if (glad_glTexCoord4i == counted_glTexCoord4i)
+            glad_glTexCoord4i = (PFNGLTEXCOORD4IPROC)Table<>::loaded[ENTRY_glTexCoord4i];
+        if (glad_glTexCoord4iv == counted_glTexCoord4iv)
+            glad_glTexCoord4iv = (PFNGLTEXCOORD4IVPROC)Table<>::loaded[ENTRY_glTexCoord4iv];
+        if (glad_glTexCoord4s == counted_glTexCoord4s)
+            glad_glTexCoord4s = (PFNGLTEXCOORD4SPROC)Table<>::loaded[ENTRY_glTexCoord4s];
+        if (glad_glTexCoord4sv == counted_glTexCoord4sv)
+            glad_glTexCoord4sv = (PFNGLTEXCOORD4SVPROC)Table<>::loaded[ENTRY_glTexCoord4sv];
+        if (glad_glVertex2d == counted_glVertex2d)
+            glad_glVertex2d = (PFNGLVERTEX2DPROC)Table<>::loaded[ENTRY_glVertex2d];
+        if (glad_glVertex2dv == counted_glVertex2dv)
+            glad_glVertex2dv = (PFNGLVERTEX2DVPROC)Table<>::loaded[ENTRY_glVertex2dv];
+        if (glad_glVertex2f == counted_glVertex2f)
+            glad_glVertex2f = (PFNGLVERTEX2FPROC)Table<>::loaded[ENTRY_glVertex2f];
+        if (glad_glVertex2fv == counted_glVertex2fv)
+            glad_glVertex2fv = (PFNGLVERTEX2FVPROC)Table<>::loaded[ENTRY_glVertex2fv];
+        if (glad_glVertex2i == counted_glVertex2i)
+            glad_glVertex2i = (PFNGLVERTEX2IPROC)Table<>::loaded[ENTRY_glVertex2i];
+        if (glad_glVertex2iv == counted_glVertex2iv)
+            glad_glVertex2iv = (PFNGLVERTEX2IVPROC)Table<>::loaded[ENTRY_glVertex2iv];
+        if (glad_glVertex2s == counted_glVertex2s)
+            glad_glVertex2s = (PFNGLVERTEX2SPROC)Table<>::loaded[ENTRY_glVertex2s];
+        if (glad_glVertex2sv == counted_glVertex2sv)
+            glad_glVertex2sv = (PFNGLVERTEX2SVPROC)Table<>::loaded[ENTRY_glVertex2sv];
+        if (glad_glVertex3d == counted_glVertex3d)
+            glad_glVertex3d = (PFNGLVERTEX3DPROC)Table<>::loaded[ENTRY_glVertex3d];
+        if (glad_glVertex3dv == counted_glVertex3dv)
+            glad_glVertex3dv = (PFNGLVERTEX3DVPROC)Table<>::loaded[ENTRY_glVertex3dv];
+        if (glad_glVertex3f == counted_glVertex3f)
+            glad_glVertex3f = (PFNGLVERTEX3FPROC)Table<>::loaded[ENTRY_glVertex3f];
+        if (glad_glVertex3fv == counted_glVertex3fv)
+            glad_glVertex3fv = (PFNGLVERTEX3FVPROC)Table<>::loaded[ENTRY_glVertex3fv];
+        if (glad_glVertex3i == counted_glVertex3i)
+            glad_glVertex3i = (PFNGLVERTEX3IPROC)Table<>::loaded[ENTRY_glVertex3i];
+        if (glad_glVertex3iv == counted_glVertex3iv)
+            glad_glVertex3iv = (PFNGLVERTEX3IVPROC)Table<>::loaded[ENTRY_glVertex3iv];
+        if (glad_glVertex3s == counted_glVertex3s)
+            glad_glVertex3s = (PFNGLVERTEX3SPROC)Table<>::loaded[ENTRY_glVertex3s];
+        if (glad_glVertex3sv == counted_glVertex3sv)
+            glad_glVertex3sv = (PFNGLVERTEX3SVPROC)Table<>::loaded[ENTRY_glVertex3sv];
+        if (glad_glVertex4d == counted_glVertex4d)
+            glad_glVertex4d = (PFNGLVERTEX4DPROC)Table<>::loaded[ENTRY_glVertex4d];
+        if (glad_glVertex4dv == counted_glVertex4dv)
+            glad_glVertex4dv = (PFNGLVERTEX4DVPROC)Table<>::loaded[ENTRY_glVertex4dv];
+        if (glad_glVertex4f == counted_glVertex4f)
+            glad_glVertex4f = (PFNGLVERTEX4FPROC)Table<>::loaded[ENTRY_glVertex4f];
+        if (glad_glVertex4fv == counted_glVertex4fv)
+            glad_glVertex4fv = (PFNGLVERTEX4FVPROC)Table<>::loaded[ENTRY_glVertex4fv];
+        if (glad_glVertex4i == counted_glVertex4i)
+            glad_glVertex4i = (PFNGLVERTEX4IPROC)Table<>::loaded[ENTRY_glVertex4i];
+        if (glad_glVertex4iv == counted_glVertex4iv)
+            glad_glVertex4iv = (PFNGLVERTEX4IVPROC)Table<>::loaded[ENTRY_glVertex4iv];
+        if (glad_glVertex4s == counted_glVertex4s)
+            glad_glVertex4s = (PFNGLVERTEX4SPROC)Table<>::loaded[ENTRY_glVertex4s];
+        if (glad_glVertex4sv == counted_glVertex4sv)
+            glad_glVertex4sv = (PFNGLVERTEX4SVPROC)Table<>::loaded[ENTRY_glVertex4sv];
+        if (glad_glClipPlane == counted_glClipPlane)
+            glad_glClipPlane = (PFNGLCLIPPLANEPROC)Table<>::loaded[ENTRY_glClipPlane];
+        if (glad_glColorMaterial == counted_glColorMaterial)
+            glad_glColorMaterial = (PFNGLCOLORMATERIALPROC)Table<>::loaded[ENTRY_glColorMaterial];
+        if (glad_glFogf == counted_glFogf)
+            glad_glFogf = (PFNGLFOGFPROC)Table<>::loaded[ENTRY_glFogf];
+        if (glad_glFogfv == counted_glFogfv)
+            glad_glFogfv = (PFNGLFOGFVPROC)Table<>::loaded[ENTRY_glFogfv];
+        if (glad_glFogi == counted_glFogi)
+            glad_glFogi = (PFNGLFOGIPROC)Table<>::loaded[ENTRY_glFogi];
+        if (glad_glFogiv == counted_glFogiv)
+            glad_glFogiv = (PFNGLFOGIVPROC)Table<>::loaded[ENTRY_glFogiv];
+        if (glad_glLightf == counted_glLightf)
+            glad_glLightf = (PFNGLLIGHTFPROC)Table<>::loaded[ENTRY_glLightf];
+        if (glad_glLightfv == counted_glLightfv)
+            glad_glLightfv = (PFNGLLIGHTFVPROC)Table<>::loaded[ENTRY_glLightfv];
+        if (glad_glLighti == counted_glLighti)
+            glad_glLighti = (PFNGLLIGHTIPROC)Table<>::loaded[ENTRY_glLighti];
+        if (glad_glLightiv == counted_glLightiv)
+            glad_glLightiv = (PFNGLLIGHTIVPROC)Table<>::loaded[ENTRY_glLightiv];
+        if (glad_glLightModelf == counted_glLightModelf)
+            glad_glLightModelf = (PFNGLLIGHTMODELFPROC)Table<>::loaded[ENTRY_glLightModelf];
+        if (glad_glLightModelfv == counted_glLightModelfv)
+            glad_glLightModelfv = (PFNGLLIGHTMODELFVPROC)Table<>::loaded[ENTRY_glLightModelfv];
+        if (glad_glLightModeli == counted_glLightModeli)
+            glad_glLightModeli = (PFNGLLIGHTMODELIPROC)Table<>::loaded[ENTRY_glLightModeli];
+        if (glad_glLightModeliv == counted_glLightModeliv)
+            glad_glLightModeliv = (PFNGLLIGHTMODELIVPROC)Table<>::loaded[ENTRY_glLightModeliv];
+        if (glad_glLineStipple == counted_glLineStipple)
+            glad_glLineStipple = (PFNGLLINESTIPPLEPROC)Table<>::loaded[ENTRY_glLineStipple];
+        if (glad_glMaterialf == counted_glMaterialf)
+            glad_glMaterialf = (PFNGLMATERIALFPROC)Table<>::loaded[ENTRY_glMaterialf];
+        if (glad_glMaterialfv == counted_glMaterialfv)
+            glad_glMaterialfv = (PFNGLMATERIALFVPROC)Table<>::loaded[ENTRY_glMaterialfv];
+        if (glad_glMateriali == counted_glMateriali)
+            glad_glMateriali = (PFNGLMATERIALIPROC)Table<>::loaded[ENTRY_glMateriali];
+        if (glad_glMaterialiv == counted_glMaterialiv)
+            glad_glMaterialiv = (PFNGLMATERIALIVPROC)Table<>::loaded[ENTRY_glMaterialiv];
+        if (glad_glPolygonStipple == counted_glPolygonStipple)
+            glad_glPolygonStipple = (PFNGLPOLYGONSTIPPLEPROC)Table<>::loaded[ENTRY_glPolygonStipple];
+        if (glad_glShadeModel == counted_glShadeModel)
+            glad_glShadeModel = (PFNGLSHADEMODELPROC)Table<>::loaded[ENTRY_glShadeModel];
+        if (glad_glTexEnvf == counted_glTexEnvf)
+            glad_glTexEnvf = (PFNGLTEXENVFPROC)Table<>::loaded[ENTRY_glTexEnvf];
+        if (glad_glTexEnvfv == counted_glTexEnvfv)
+            glad_glTexEnvfv = (PFNGLTEXENVFVPROC)Table<>::loaded[ENTRY_glTexEnvfv];
+        if (glad_glTexEnvi == counted_glTexEnvi)
+            glad_glTexEnvi = (PFNGLTEXENVIPROC)Table<>::loaded[ENTRY_glTexEnvi];
+        if (glad_glTexEnviv == counted_glTexEnviv)
+            glad_glTexEnviv = (PFNGLTEXENVIVPROC)Table<>::loaded[ENTRY_glTexEnviv];
+        if (glad_glTexGend == counted_glTexGend)
+            glad_glTexGend = (PFNGLTEXGENDPROC)Table<>::loaded[ENTRY_glTexGend];
+        if (glad_glTexGendv == counted_glTexGendv)
+            glad_glTexGendv = (PFNGLTEXGENDVPROC)Table<>::loaded[ENTRY_glTexGendv];
+        if (glad_glTexGenf == counted_glTexGenf)
+            glad_glTexGenf = (PFNGLTEXGENFPROC)Table<>::loaded[ENTRY_glTexGenf];
+        if (glad_glTexGenfv == counted_glTexGenfv)
+            glad_glTexGenfv = (PFNGLTEXGENFVPROC)Table<>::loaded[ENTRY_glTexGenfv];
+        if (glad_glTexGeni == counted_glTexGeni)
+            glad_glTexGeni = (PFNGLTEXGENIPROC)Table<>::loaded[ENTRY_glTexGeni];
+        if (glad_glTexGeniv == counted_glTexGeniv)
+            glad_glTexGeniv = (PFNGLTEXGENIVPROC)Table<>::loaded[ENTRY_glTexGeniv];
+        if (glad_glFeedbackBuffer == counted_glFeedbackBuffer)
+            glad_glFeedbackBuffer = (PFNGLFEEDBACKBUFFERPROC)Table<>::loaded[ENTRY_glFeedbackBuffer];
+        if (glad_glSelectBuffer == counted_glSelectBuffer)
+            glad_glSelectBuffer = (PFNGLSELECTBUFFERPROC)Table<>::loaded[ENTRY_glSelectBuffer];
+        if (glad_glRenderMode == counted_glRenderMode)
+            glad_glRenderMode = (PFNGLRENDERMODEPROC)Table<>::loaded[ENTRY_glRenderMode];
+        if (glad_glInitNames == counted_glInitNames)
+            glad_glInitNames = (PFNGLINITNAMESPROC)Table<>::loaded[ENTRY_glInitNames];
+        if (glad_glLoadName == counted_glLoadName)
+            glad_glLoadName = (PFNGLLOADNAMEPROC)Table<>::loaded[ENTRY_glLoadName];
+        if (glad_glPassThrough == counted_glPassThrough)
+            glad_glPassThrough = (PFNGLPASSTHROUGHPROC)Table<>::loaded[ENTRY_glPassThrough];
+        if (glad_glPopName == counted_glPopName)
+            glad_glPopName = (PFNGLPOPNAMEPROC)Table<>::loaded[ENTRY_glPopName];
+        if (glad_glPushName == counted_glPushName)
+            glad_glPushName = (PFNGLPUSHNAMEPROC)Table<>::loaded[ENTRY_glPushName];
+        if (glad_glClearAccum == counted_glClearAccum)
+            glad_glClearAccum = (PFNGLCLEARACCUMPROC)Table<>::loaded[ENTRY_glClearAccum];
+        if (glad_glClearIndex == counted_glClearIndex)
+            glad_glClearIndex = (PFNGLCLEARINDEXPROC)Table<>::loaded[ENTRY_glClearIndex];
+        if (glad_glIndexMask == counted_glIndexMask)
+            glad_glIndexMask = (PFNGLINDEXMASKPROC)Table<>::loaded[ENTRY_glIndexMask];
+        if (glad_glAccum == counted_glAccum)
+            glad_glAccum = (PFNGLACCUMPROC)Table<>::loaded[ENTRY_glAccum];
+        if (glad_glPopAttrib == counted_glPopAttrib)
+            glad_glPopAttrib = (PFNGLPOPATTRIBPROC)Table<>::loaded[ENTRY_glPopAttrib];
+        if (glad_glPushAttrib == counted_glPushAttrib)
+            glad_glPushAttrib = (PFNGLPUSHATTRIBPROC)Table<>::loaded[ENTRY_glPushAttrib];
+        if (glad_glMap1d == counted_glMap1d)
+            glad_glMap1d = (PFNGLMAP1DPROC)Table<>::loaded[ENTRY_glMap1d];
+        if (glad_glMap1f == counted_glMap1f)
+            glad_glMap1f = (PFNGLMAP1FPROC)Table<>::loaded[ENTRY_glMap1f];
+        if (glad_glMap2d == counted_glMap2d)
+            glad_glMap2d = (PFNGLMAP2DPROC)Table<>::loaded[ENTRY_glMap2d];
+        if (glad_glMap2f == counted_glMap2f)
+            glad_glMap2f = (PFNGLMAP2FPROC)Table<>::loaded[ENTRY_glMap2f];
+        if (glad_glMapGrid1d == counted_glMapGrid1d)
+            glad_glMapGrid1d = (PFNGLMAPGRID1DPROC)Table<>::loaded[ENTRY_glMapGrid1d];
+        if (glad_glMapGrid1f == counted_glMapGrid1f)
+            glad_glMapGrid1f = (PFNGLMAPGRID1FPROC)Table<>::loaded[ENTRY_glMapGrid1f];
+        if (glad_glMapGrid2d == counted_glMapGrid2d)
+            glad_glMapGrid2d = (PFNGLMAPGRID2DPROC)Table<>::loaded[ENTRY_glMapGrid2d];
+        if (glad_glMapGrid2f == counted_glMapGrid2f)
+            glad_glMapGrid2f = (PFNGLMAPGRID2FPROC)Table<>::loaded[ENTRY_glMapGrid2f];
+        if (glad_glEvalCoord1d == counted_glEvalCoord1d)
+            glad_glEvalCoord1d = (PFNGLEVALCOORD1DPROC)Table<>::loaded[ENTRY_glEvalCoord1d];
+        if (glad_glEvalCoord1dv == counted_glEvalCoord1dv)
+            glad_glEvalCoord1dv = (PFNGLEVALCOORD1DVPROC)Table<>::loaded[ENTRY_glEvalCoord1dv];
+        if (glad_glEvalCoord1f == counted_glEvalCoord1f)
+            glad_glEvalCoord1f = (PFNGLEVALCOORD1FPROC)Table<>::loaded[ENTRY_glEvalCoord1f];
+        if (glad_glEvalCoord1fv == counted_glEvalCoord1fv)
+            glad_glEvalCoord1fv = (PFNGLEVALCOORD1FVPROC)Table<>::loaded[ENTRY_glEvalCoord1fv];
+        if (glad_glEvalCoord2d == counted_glEvalCoord2d)
+            glad_glEvalCoord2d = (PFNGLEVALCOORD2DPROC)Table<>::loaded[ENTRY_glEvalCoord2d];
+        if (glad_glEvalCoord2dv == counted_glEvalCoord2dv)
+            glad_glEvalCoord2dv = (PFNGLEVALCOORD2DVPROC)Table<>::loaded[ENTRY_glEvalCoord2dv];
+        if (glad_glEvalCoord2f == counted_glEvalCoord2f)
+            glad_glEvalCoord2f = (PFNGLEVALCOORD2FPROC)Table<>::loaded[ENTRY_glEvalCoord2f];
+        if (glad_glEvalCoord2fv == counted_glEvalCoord2fv)
+            glad_glEvalCoord2fv = (PFNGLEVALCOORD2FVPROC)Table<>::loaded[ENTRY_glEvalCoord2fv];
+        if (glad_glEvalMesh1 == counted_glEvalMesh1)
+            glad_glEvalMesh1 = (PFNGLEVALMESH1PROC)Table<>::loaded[ENTRY_glEvalMesh1];
+        if (glad_glEvalPoint1 == counted_glEvalPoint1)
+            glad_glEvalPoint1 = (PFNGLEVALPOINT1PROC)Table<>::loaded[ENTRY_glEvalPoint1];
+        if (glad_glEvalMesh2 == counted_glEvalMesh2)
+            glad_glEvalMesh2 = (PFNGLEVALMESH2PROC)Table<>::loaded[ENTRY_glEvalMesh2];
+        if (glad_glEvalPoint2 == counted_glEvalPoint2)
+            glad_glEvalPoint2 = (PFNGLEVALPOINT2PROC)Table<>::loaded[ENTRY_glEvalPoint2];
+        if (glad_glAlphaFunc == counted_glAlphaFunc)
+            glad_glAlphaFunc = (PFNGLALPHAFUNCPROC)Table<>::loaded[ENTRY_glAlphaFunc];
+        if (glad_glPixelZoom == counted_glPixelZoom)
+            glad_glPixelZoom = (PFNGLPIXELZOOMPROC)Table<>::loaded[ENTRY_glPixelZoom];
+        if (glad_glPixelTransferf == counted_glPixelTransferf)
+            glad_glPixelTransferf = (PFNGLPIXELTRANSFERFPROC)Table<>::loaded[ENTRY_glPixelTransferf];
+        if (glad_glPixelTransferi == counted_glPixelTransferi)
+            glad_glPixelTransferi = (PFNGLPIXELTRANSFERIPROC)Table<>::loaded[ENTRY_glPixelTransferi];
+        if (glad_glPixelMapfv == counted_glPixelMapfv)
+            glad_glPixelMapfv = (PFNGLPIXELMAPFVPROC)Table<>::loaded[ENTRY_glPixelMapfv];
+        if (glad_glPixelMapuiv == counted_glPixelMapuiv)
+            glad_glPixelMapuiv = (PFNGLPIXELMAPUIVPROC)Table<>::loaded[ENTRY_glPixelMapuiv];
+        if (glad_glPixelMapusv == counted_glPixelMapusv)
+            glad_glPixelMapusv = (PFNGLPIXELMAPUSVPROC)Table<>::loaded[ENTRY_glPixelMapusv];
+        if (glad_glCopyPixels == counted_glCopyPixels)
+            glad_glCopyPixels = (PFNGLCOPYPIXELSPROC)Table<>::loaded[ENTRY_glCopyPixels];
+        if (glad_glDrawPixels == counted_glDrawPixels)
+            glad_glDrawPixels = (PFNGLDRAWPIXELSPROC)Table<>::loaded[ENTRY_glDrawPixels];
+        if (glad_glGetClipPlane == counted_glGetClipPlane)
+            glad_glGetClipPlane = (PFNGLGETCLIPPLANEPROC)Table<>::loaded[ENTRY_glGetClipPlane];
+        if (glad_glGetLightfv == counted_glGetLightfv)
+            glad_glGetLightfv = (PFNGLGETLIGHTFVPROC)Table<>::loaded[ENTRY_glGetLightfv];
+        if (glad_glGetLightiv == counted_glGetLightiv)
+            glad_glGetLightiv = (PFNGLGETLIGHTIVPROC)Table<>::loaded[ENTRY_glGetLightiv];
+        if (glad_glGetMapdv == counted_glGetMapdv)
+            glad_glGetMapdv = (PFNGLGETMAPDVPROC)Table<>::loaded[ENTRY_glGetMapdv];
+        if (glad_glGetMapfv == counted_glGetMapfv)
+            glad_glGetMapfv = (PFNGLGETMAPFVPROC)Table<>::loaded[ENTRY_glGetMapfv];
+        if (glad_glGetMapiv == counted_glGetMapiv)
+            glad_glGetMapiv = (PFNGLGETMAPIVPROC)Table<>::loaded[ENTRY_glGetMapiv];
+        if (glad_glGetMaterialfv == counted_glGetMaterialfv)
+            glad_glGetMaterialfv = (PFNGLGETMATERIALFVPROC)Table<>::loaded[ENTRY_glGetMaterialfv];
+        if (glad_glGetMaterialiv == counted_glGetMaterialiv)
+            glad_glGetMaterialiv = (PFNGLGETMATERIALIVPROC)Table<>::loaded[ENTRY_glGetMaterialiv];
+        if (glad_glGetPixelMapfv == counted_glGetPixelMapfv)
+            glad_glGetPixelMapfv = (PFNGLGETPIXELMAPFVPROC)Table<>::loaded[ENTRY_glGetPixelMapfv];
+        if (glad_glGetPixelMapuiv == counted_glGetPixelMapuiv)
+            glad_glGetPixelMapuiv = (PFNGLGETPIXELMAPUIVPROC)Table<>::loaded[ENTRY_glGetPixelMapuiv];
+        if (glad_glGetPixelMapusv == counted_glGetPixelMapusv)
+            glad_glGetPixelMapusv = (PFNGLGETPIXELMAPUSVPROC)Table<>::loaded[ENTRY_glGetPixelMapusv];
+        if (glad_glGetPolygonStipple == counted_glGetPolygonStipple)
+            glad_glGetPolygonStipple = (PFNGLGETPOLYGONSTIPPLEPROC)Table<>::loaded[ENTRY_glGetPolygonStipple];
+        if (glad_glGetTexEnvfv == counted_glGetTexEnvfv)
+            glad_glGetTexEnvfv = (PFNGLGETTEXENVFVPROC)Table<>::loaded[ENTRY_glGetTexEnvfv];
+        if (glad_glGetTexEnviv == counted_glGetTexEnviv)
+            glad_glGetTexEnviv = (PFNGLGETTEXENVIVPROC)Table<>::loaded[ENTRY_glGetTexEnviv];
+        if (glad_glGetTexGendv == counted_glGetTexGendv)
+            glad_glGetTexGendv = (PFNGLGETTEXGENDVPROC)Table<>::loaded[ENTRY_glGetTexGendv];
+        if (glad_glGetTexGenfv == counted_glGetTexGenfv)
+            glad_glGetTexGenfv = (PFNGLGETTEXGENFVPROC)Table<>::loaded[ENTRY_glGetTexGenfv];
+        if (glad_glGetTexGeniv == counted_glGetTexGeniv)
+            glad_glGetTexGeniv = (PFNGLGETTEXGENIVPROC)Table<>::loaded[ENTRY_glGetTexGeniv];
+        if (glad_glIsList == counted_glIsList)
+            glad_glIsList = (PFNGLISLISTPROC)Table<>::loaded[ENTRY_glIsList];
+        if (glad_glFrustum == counted_glFrustum)
+            glad_glFrustum = (PFNGLFRUSTUMPROC)Table<>::loaded[ENTRY_glFrustum];
+        if (glad_glLoadIdentity == counted_glLoadIdentity)
+            glad_glLoadIdentity = (PFNGLLOADIDENTITYPROC)Table<>::loaded[ENTRY_glLoadIdentity];
+        if (glad_glLoadMatrixf == counted_glLoadMatrixf)
+            glad_glLoadMatrixf = (PFNGLLOADMATRIXFPROC)Table<>::loaded[ENTRY_glLoadMatrixf];
+        if (glad_glLoadMatrixd == counted_glLoadMatrixd)
+            glad_glLoadMatrixd = (PFNGLLOADMATRIXDPROC)Table<>::loaded[ENTRY_glLoadMatrixd];
+        if (glad_glMatrixMode == counted_glMatrixMode)
+            glad_glMatrixMode = (PFNGLMATRIXMODEPROC)Table<>::loaded[ENTRY_glMatrixMode];
+        if (glad_glMultMatrixf == counted_glMultMatrixf)
+            glad_glMultMatrixf = (PFNGLMULTMATRIXFPROC)Table<>::loaded[ENTRY_glMultMatrixf];
+        if (glad_glMultMatrixd == counted_glMultMatrixd)
+            glad_glMultMatrixd = (PFNGLMULTMATRIXDPROC)Table<>::loaded[ENTRY_glMultMatrixd];
+        if (glad_glOrtho == counted_glOrtho)
+            glad_glOrtho = (PFNGLORTHOPROC)Table<>::loaded[ENTRY_glOrtho];
+        if (glad_glPopMatrix == counted_glPopMatrix)
+            glad_glPopMatrix = (PFNGLPOPMATRIXPROC)Table<>::loaded[ENTRY_glPopMatrix];
+        if (glad_glPushMatrix == counted_glPushMatrix)
+            glad_glPushMatrix = (PFNGLPUSHMATRIXPROC)Table<>::loaded[ENTRY_glPushMatrix];
+        if (glad_glRotated == counted_glRotated)
+            glad_glRotated = (PFNGLROTATEDPROC)Table<>::loaded[ENTRY_glRotated];
+        if (glad_glRotatef == counted_glRotatef)
+            glad_glRotatef = (PFNGLROTATEFPROC)Table<>::loaded[ENTRY_glRotatef];
+        if (glad_glScaled == counted_glScaled)
+            glad_glScaled = (PFNGLSCALEDPROC)Table<>::loaded[ENTRY_glScaled];
+        if (glad_glScalef == counted_glScalef)
+            glad_glScalef = (PFNGLSCALEFPROC)Table<>::loaded[ENTRY_glScalef];
+        if (glad_glTranslated == counted_glTranslated)
+            glad_glTranslated = (PFNGLTRANSLATEDPROC)Table<>::loaded[ENTRY_glTranslated];
+        if (glad_glTranslatef == counted_glTranslatef)
+            glad_glTranslatef = (PFNGLTRANSLATEFPROC)Table<>::loaded[ENTRY_glTranslatef];
+        if (glad_glDrawArrays == counted_glDrawArrays)
+            glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)Table<>::loaded[ENTRY_glDrawArrays];
+        if (glad_glDrawElements == counted_glDrawElements)
+            glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)Table<>::loaded[ENTRY_glDrawElements];
+        if (glad_glGetPointerv == counted_glGetPointerv)
+            glad_glGetPointerv = (PFNGLGETPOINTERVPROC)Table<>::loaded[ENTRY_glGetPointerv];
+        if (glad_glPolygonOffset == counted_glPolygonOffset)
+            glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)Table<>::loaded[ENTRY_glPolygonOffset];
+        if (glad_glCopyTexImage1D == counted_glCopyTexImage1D)
+            glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)Table<>::loaded[ENTRY_glCopyTexImage1D];
+        if (glad_glCopyTexImage2D == counted_glCopyTexImage2D)
+            glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)Table<>::loaded[ENTRY_glCopyTexImage2D];
+        if (glad_glCopyTexSubImage1D == counted_glCopyTexSubImage1D)
+            glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)Table<>::loaded[ENTRY_glCopyTexSubImage1D];
+        if (glad_glCopyTexSubImage2D == counted_glCopyTexSubImage2D)
+            glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)Table<>::loaded[ENTRY_glCopyTexSubImage2D];
+        if (glad_glTexSubImage1D == counted_glTexSubImage1D)
+            glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)Table<>::loaded[ENTRY_glTexSubImage1D];
+        if (glad_glTexSubImage2D == counted_glTexSubImage2D)
+            glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)Table<>::loaded[ENTRY_glTexSubImage2D];
+        if (glad_glBindTexture == counted_glBindTexture)
+            glad_glBindTexture = (PFNGLBINDTEXTUREPROC)Table<>::loaded[ENTRY_glBindTexture];
+        if (glad_glDeleteTextures == counted_glDeleteTextures)
+            glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)Table<>::loaded[ENTRY_glDeleteTextures];
+        if (glad_glGenTextures == counted_glGenTextures)
+            glad_glGenTextures = (PFNGLGENTEXTURESPROC)Table<>::loaded[ENTRY_glGenTextures];
+        if (glad_glIsTexture == counted_glIsTexture)
+            glad_glIsTexture = (PFNGLISTEXTUREPROC)Table<>::loaded[ENTRY_glIsTexture];
+        if (glad_glArrayElement == counted_glArrayElement)
+            glad_glArrayElement = (PFNGLARRAYELEMENTPROC)Table<>::loaded[ENTRY_glArrayElement];
+        if (glad_glColorPointer == counted_glColorPointer)
+            glad_glColorPointer = (PFNGLCOLORPOINTERPROC)Table<>::loaded[ENTRY_glColorPointer];
+        if (glad_glDisableClientState == counted_glDisableClientState)
+            glad_glDisableClientState = (PFNGLDISABLECLIENTSTATEPROC)Table<>::loaded[ENTRY_glDisableClientState];
+        if (glad_glEdgeFlagPointer == counted_glEdgeFlagPointer)
+            glad_glEdgeFlagPointer = (PFNGLEDGEFLAGPOINTERPROC)Table<>::loaded[ENTRY_glEdgeFlagPointer];
+        if (glad_glEnableClientState == counted_glEnableClientState)
+            glad_glEnableClientState = (PFNGLENABLECLIENTSTATEPROC)Table<>::loaded[ENTRY_glEnableClientState];
+        if (glad_glIndexPointer == counted_glIndexPointer)
+            glad_glIndexPointer = (PFNGLINDEXPOINTERPROC)Table<>::loaded[ENTRY_glIndexPointer];
+        if (glad_glInterleavedArrays == counted_glInterleavedArrays)
+            glad_glInterleavedArrays = (PFNGLINTERLEAVEDARRAYSPROC)Table<>::loaded[ENTRY_glInterleavedArrays];
+        if (glad_glNormalPointer == counted_glNormalPointer)
+            glad_glNormalPointer = (PFNGLNORMALPOINTERPROC)Table<>::loaded[ENTRY_glNormalPointer];
+        if (glad_glTexCoordPointer == counted_glTexCoordPointer)
+            glad_glTexCoordPointer = (PFNGLTEXCOORDPOINTERPROC)Table<>::loaded[ENTRY_glTexCoordPointer];
+        if (glad_glVertexPointer == counted_glVertexPointer)
+            glad_glVertexPointer = (PFNGLVERTEXPOINTERPROC)Table<>::loaded[ENTRY_glVertexPointer];
+        if (glad_glAreTexturesResident == counted_glAreTexturesResident)
+            glad_glAreTexturesResident = (PFNGLARETEXTURESRESIDENTPROC)Table<>::loaded[ENTRY_glAreTexturesResident];
+        if (glad_glPrioritizeTextures == counted_glPrioritizeTextures)
+            glad_glPrioritizeTextures = (PFNGLPRIORITIZETEXTURESPROC)Table<>::loaded[ENTRY_glPrioritizeTextures];
+        if (glad_glIndexub == counted_glIndexub)
+            glad_glIndexub = (PFNGLINDEXUBPROC)Table<>::loaded[ENTRY_glIndexub];
+        if (glad_glIndexubv == counted_glIndexubv)
+            glad_glIndexubv = (PFNGLINDEXUBVPROC)Table<>::loaded[ENTRY_glIndexubv];
+        if (glad_glPopClientAttrib == counted_glPopClientAttrib)
+            glad_glPopClientAttrib = (PFNGLPOPCLIENTATTRIBPROC)Table<>::loaded[ENTRY_glPopClientAttrib];
+        if (glad_glPushClientAttrib == counted_glPushClientAttrib)
+            glad_glPushClientAttrib = (PFNGLPUSHCLIENTATTRIBPROC)Table<>::loaded[ENTRY_glPushClientAttrib];
+        if (glad_glDrawRangeElements == counted_glDrawRangeElements)
+            glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)Table<>::loaded[ENTRY_glDrawRangeElements];
+        if (glad_glTexImage3D == counted_glTexImage3D)
+            glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)Table<>::loaded[ENTRY_glTexImage3D];
+        if (glad_glTexSubImage3D == counted_glTexSubImage3D)
+            glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)Table<>::loaded[ENTRY_glTexSubImage3D];
+        if (glad_glCopyTexSubImage3D == counted_glCopyTexSubImage3D)
+            glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)Table<>::loaded[ENTRY_glCopyTexSubImage3D];
+        if (glad_glActiveTexture == counted_glActiveTexture)
+            glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)Table<>::loaded[ENTRY_glActiveTexture];
+        if (glad_glSampleCoverage == counted_glSampleCoverage)
+            glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)Table<>::loaded[ENTRY_glSampleCoverage];
+        if (glad_glCompressedTexImage3D == counted_glCompressedTexImage3D)
+            glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)Table<>::loaded[ENTRY_glCompressedTexImage3D];
+        if (glad_glCompressedTexImage2D == counted_glCompressedTexImage2D)
+            glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)Table<>::loaded[ENTRY_glCompressedTexImage2D];
+        if (glad_glCompressedTexImage1D == counted_glCompressedTexImage1D)
+            glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)Table<>::loaded[ENTRY_glCompressedTexImage1D];
+        if (glad_glCompressedTexSubImage3D == counted_glCompressedTexSubImage3D)
+            glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)Table<>::loaded[ENTRY_glCompressedTexSubImage3D];
+        if (glad_glCompressedTexSubImage2D == counted_glCompressedTexSubImage2D)
+            glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)Table<>::loaded[ENTRY_glCompressedTexSubImage2D];
+        if (glad_glCompressedTexSubImage1D == counted_glCompressedTexSubImage1D)
+            glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)Table<>::loaded[ENTRY_glCompressedTexSubImage1D];
+        if (glad_glGetCompressedTexImage == counted_glGetCompressedTexImage)
+            glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)Table<>::loaded[ENTRY_glGetCompressedTexImage];
+        if (glad_glClientActiveTexture == counted_glClientActiveTexture)
+            glad_glClientActiveTexture = (PFNGLCLIENTACTIVETEXTUREPROC)Table<>::loaded[ENTRY_glClientActiveTexture];
+        if (glad_glMultiTexCoord1d == counted_glMultiTexCoord1d)
+            glad_glMultiTexCoord1d = (PFNGLMULTITEXCOORD1DPROC)Table<>::loaded[ENTRY_glMultiTexCoord1d];
+        if (glad_glMultiTexCoord1dv == counted_glMultiTexCoord1dv)
+            glad_glMultiTexCoord1dv = (PFNGLMULTITEXCOORD1DVPROC)Table<>::loaded[ENTRY_glMultiTexCoord1dv];
+        if (glad_glMultiTexCoord1f == counted_glMultiTexCoord1f)
+            glad_glMultiTexCoord1f = (PFNGLMULTITEXCOORD1FPROC)Table<>::loaded[ENTRY_glMultiTexCoord1f];
+        if (glad_glMultiTexCoord1fv == counted_glMultiTexCoord1fv)
+            glad_glMultiTexCoord1fv = (PFNGLMULTITEXCOORD1FVPROC)Table<>::loaded[ENTRY_glMultiTexCoord1fv];
+        if (glad_glMultiTexCoord1i == counted_glMultiTexCoord1i)
+            glad_glMultiTexCoord1i = (PFNGLMULTITEXCOORD1IPROC)Table<>::loaded[ENTRY_glMultiTexCoord1i];
+        if (glad_glMultiTexCoord1iv == counted_glMultiTexCoord1iv)
+            glad_glMultiTexCoord1iv = (PFNGLMULTITEXCOORD1IVPROC)Table<>::loaded[ENTRY_glMultiTexCoord1iv];
+        if (glad_glMultiTexCoord1s == counted_glMultiTexCoord1s)
+            glad_glMultiTexCoord1s = (PFNGLMULTITEXCOORD1SPROC)Table<>::loaded[ENTRY_glMultiTexCoord1s];
+        if (glad_glMultiTexCoord1sv == counted_glMultiTexCoord1sv)
+            glad_glMultiTexCoord1sv = (PFNGLMULTITEXCOORD1SVPROC)Table<>::loaded[ENTRY_glMultiTexCoord1sv];
+        if (glad_glMultiTexCoord2d == counted_glMultiTexCoord2d)
+            glad_glMultiTexCoord2d = (PFNGLMULTITEXCOORD2DPROC)Table<>::loaded[ENTRY_glMultiTexCoord2d];
+        if (glad_glMultiTexCoord2dv == counted_glMultiTexCoord2dv)
+            glad_glMultiTexCoord2dv = (PFNGLMULTITEXCOORD2DVPROC)Table<>::loaded[ENTRY_glMultiTexCoord2dv];
+        if (glad_glMultiTexCoord2f == counted_glMultiTexCoord2f)
+            glad_glMultiTexCoord2f = (PFNGLMULTITEXCOORD2FPROC)Table<>::loaded[ENTRY_glMultiTexCoord2f];
+        if (glad_glMultiTexCoord2fv == counted_glMultiTexCoord2fv)
+            glad_glMultiTexCoord2fv = (PFNGLMULTITEXCOORD2FVPROC)Table<>::loaded[ENTRY_glMultiTexCoord2fv];
+        if (glad_glMultiTexCoord2i == counted_glMultiTexCoord2i)
+            glad_glMultiTexCoord2i = (PFNGLMULTITEXCOORD2IPROC)Table<>::loaded[ENTRY_glMultiTexCoord2i];
+        if (glad_glMultiTexCoord2iv == counted_glMultiTexCoord2iv)
+            glad_glMultiTexCoord2iv = (PFNGLMULTITEXCOORD2IVPROC)Table<>::loaded[ENTRY_glMultiTexCoord2iv];
+        if (glad_glMultiTexCoord2s == counted_glMultiTexCoord2s)
+            glad_glMultiTexCoord2s = (PFNGLMULTITEXCOORD2SPROC)Table<>::loaded[ENTRY_glMultiTexCoord2s];
+        if (glad_glMultiTexCoord2sv == counted_glMultiTexCoord2sv)
+            glad_glMultiTexCoord2sv = (PFNGLMULTITEXCOORD2SVPROC)Table<>::loaded[ENTRY_glMultiTexCoord2sv];
+        if (glad_glMultiTexCoord3d == counted_glMultiTexCoord3d)
+            glad_glMultiTexCoord3d = (PFNGLMULTITEXCOORD3DPROC)Table<>::loaded[ENTRY_glMultiTexCoord3d];
+        if (glad_glMultiTexCoord3dv == counted_glMultiTexCoord3dv)
+            glad_glMultiTexCoord3dv = (PFNGLMULTITEXCOORD3DVPROC)Table<>::loaded[ENTRY_glMultiTexCoord3dv];
+        if (glad_glMultiTexCoord3f == counted_glMultiTexCoord3f)
+            glad_glMultiTexCoord3f = (PFNGLMULTITEXCOORD3FPROC)Table<>::loaded[ENTRY_glMultiTexCoord3f];
+        if (glad_glMultiTexCoord3fv == counted_glMultiTexCoord3fv)
+            glad_glMultiTexCoord3fv = (PFNGLMULTITEXCOORD3FVPROC)Table<>::loaded[ENTRY_glMultiTexCoord3fv];
+        if (glad_glMultiTexCoord3i == counted_glMultiTexCoord3i)
+            glad_glMultiTexCoord3i = (PFNGLMULTITEXCOORD3IPROC)Table<>::loaded[ENTRY_glMultiTexCoord3i];
+        if (glad_glMultiTexCoord3iv == counted_glMultiTexCoord3iv)
+            glad_glMultiTexCoord3iv = (PFNGLMULTITEXCOORD3IVPROC)Table<>::loaded[ENTRY_glMultiTexCoord3iv];
+        if (glad_glMultiTexCoord3s == counted_glMultiTexCoord3s)
+            glad_glMultiTexCoord3s = (PFNGLMULTITEXCOORD3SPROC)Table<>::loaded[ENTRY_glMultiTexCoord3s];
+        if (glad_glMultiTexCoord3sv == counted_glMultiTexCoord3sv)
+            glad_glMultiTexCoord3sv = (PFNGLMULTITEXCOORD3SVPROC)Table<>::loaded[ENTRY_glMultiTexCoord3sv];
+        if (glad_glMultiTexCoord4d == counted_glMultiTexCoord4d)
+            glad_glMultiTexCoord4d = (PFNGLMULTITEXCOORD4DPROC)Table<>::loaded[ENTRY_glMultiTexCoord4d];
+        if (glad_glMultiTexCoord4dv == counted_glMultiTexCoord4dv)
+            glad_glMultiTexCoord4dv = (PFNGLMULTITEXCOORD4DVPROC)Table<>::loaded[ENTRY_glMultiTexCoord4dv];
+        if (glad_glMultiTexCoord4f == counted_glMultiTexCoord4f)
+            glad_glMultiTexCoord4f = (PFNGLMULTITEXCOORD4FPROC)Table<>::loaded[ENTRY_glMultiTexCoord4f];
+        if (glad_glMultiTexCoord4fv == counted_glMultiTexCoord4fv)
+            glad_glMultiTexCoord4fv = (PFNGLMULTITEXCOORD4FVPROC)Table<>::loaded[ENTRY_glMultiTexCoord4fv];
+        if (glad_glMultiTexCoord4i == counted_glMultiTexCoord4i)
+            glad_glMultiTexCoord4i = (PFNGLMULTITEXCOORD4IPROC)Table<>::loaded[ENTRY_glMultiTexCoord4i];
+        if (glad_glMultiTexCoord4iv == counted_glMultiTexCoord4iv)
+            glad_glMultiTexCoord4iv = (PFNGLMULTITEXCOORD4IVPROC)Table<>::loaded[ENTRY_glMultiTexCoord4iv];
+        if (glad_glMultiTexCoord4s == counted_glMultiTexCoord4s)
+            glad_glMultiTexCoord4s = (PFNGLMULTITEXCOORD4SPROC)Table<>::loaded[ENTRY_glMultiTexCoord4s];
+        if (glad_glMultiTexCoord4sv == counted_glMultiTexCoord4sv)
+            glad_glMultiTexCoord4sv = (PFNGLMULTITEXCOORD4SVPROC)Table<>::loaded[ENTRY_glMultiTexCoord4sv];
+        if (glad_glLoadTransposeMatrixf == counted_glLoadTransposeMatrixf)
+            glad_glLoadTransposeMatrixf = (PFNGLLOADTRANSPOSEMATRIXFPROC)Table<>::loaded[ENTRY_glLoadTransposeMatrixf];
+        if (glad_glLoadTransposeMatrixd == counted_glLoadTransposeMatrixd)
+            glad_glLoadTransposeMatrixd = (PFNGLLOADTRANSPOSEMATRIXDPROC)Table<>::loaded[ENTRY_glLoadTransposeMatrixd];
+        if (glad_glMultTransposeMatrixf == counted_glMultTransposeMatrixf)
+            glad_glMultTransposeMatrixf = (PFNGLMULTTRANSPOSEMATRIXFPROC)Table<>::loaded[ENTRY_glMultTransposeMatrixf];
+        if (glad_glMultTransposeMatrixd == counted_glMultTransposeMatrixd)
+            glad_glMultTransposeMatrixd = (PFNGLMULTTRANSPOSEMATRIXDPROC)Table<>::loaded[ENTRY_glMultTransposeMatrixd];
+        if (glad_glBlendFuncSeparate == counted_glBlendFuncSeparate)
+            glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)Table<>::loaded[ENTRY_glBlendFuncSeparate];
+        if (glad_glMultiDrawArrays == counted_glMultiDrawArrays)
+            glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)Table<>::loaded[ENTRY_glMultiDrawArrays];
+        if (glad_glMultiDrawElements == counted_glMultiDrawElements)
+            glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)Table<>::loaded[ENTRY_glMultiDrawElements];
+        if (glad_glPointParameterf == counted_glPointParameterf)
+            glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)Table<>::loaded[ENTRY_glPointParameterf];
+        if (glad_glPointParameterfv == counted_glPointParameterfv)
+            glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)Table<>::loaded[ENTRY_glPointParameterfv];
+        if (glad_glPointParameteri == counted_glPointParameteri)
+            glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)Table<>::loaded[ENTRY_glPointParameteri];
+        if (glad_glPointParameteriv == counted_glPointParameteriv)
+            glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)Table<>::loaded[ENTRY_glPointParameteriv];
+        if (glad_glFogCoordf == counted_glFogCoordf)
+            glad_glFogCoordf = (PFNGLFOGCOORDFPROC)Table<>::loaded[ENTRY_glFogCoordf];
+        if (glad_glFogCoordfv == counted_glFogCoordfv)
+            glad_glFogCoordfv = (PFNGLFOGCOORDFVPROC)Table<>::loaded[ENTRY_glFogCoordfv];
+        if (glad_glFogCoordd == counted_glFogCoordd)
+            glad_glFogCoordd = (PFNGLFOGCOORDDPROC)Table<>::loaded[ENTRY_glFogCoordd];
+        if (glad_glFogCoorddv == counted_glFogCoorddv)
+            glad_glFogCoorddv = (PFNGLFOGCOORDDVPROC)Table<>::loaded[ENTRY_glFogCoorddv];
+        if (glad_glFogCoordPointer == counted_glFogCoordPointer)
+            glad_glFogCoordPointer = (PFNGLFOGCOORDPOINTERPROC)Table<>::loaded[ENTRY_glFogCoordPointer];
+        if (glad_glSecondaryColor3b == counted_glSecondaryColor3b)
+            glad_glSecondaryColor3b = (PFNGLSECONDARYCOLOR3BPROC)Table<>::loaded[ENTRY_glSecondaryColor3b];
+        if (glad_glSecondaryColor3bv == counted_glSecondaryColor3bv)
+            glad_glSecondaryColor3bv = (PFNGLSECONDARYCOLOR3BVPROC)Table<>::loaded[ENTRY_glSecondaryColor3bv];
+        if (glad_glSecondaryColor3d == counted_glSecondaryColor3d)
+            glad_glSecondaryColor3d = (PFNGLSECONDARYCOLOR3DPROC)Table<>::loaded[ENTRY_glSecondaryColor3d];
+        if (glad_glSecondaryColor3dv == counted_glSecondaryColor3dv)
+            glad_glSecondaryColor3dv = (PFNGLSECONDARYCOLOR3DVPROC)Table<>::loaded[ENTRY_glSecondaryColor3dv];
+        if (glad_glSecondaryColor3f == counted_glSecondaryColor3f)
+            glad_glSecondaryColor3f = (PFNGLSECONDARYCOLOR3FPROC)Table<>::loaded[ENTRY_glSecondaryColor3f];
+        if (glad_glSecondaryColor3fv == counted_glSecondaryColor3fv)
+            glad_glSecondaryColor3fv = (PFNGLSECONDARYCOLOR3FVPROC)Table<>::loaded[ENTRY_glSecondaryColor3fv];
+        if (glad_glSecondaryColor3i == counted_glSecondaryColor3i)
+            glad_glSecondaryColor3i = (PFNGLSECONDARYCOLOR3IPROC)Table<>::loaded[ENTRY_glSecondaryColor3i];
+        if (glad_glSecondaryColor3iv == counted_glSecondaryColor3iv)
+            glad_glSecondaryColor3iv = (PFNGLSECONDARYCOLOR3IVPROC)Table<>::loaded[ENTRY_glSecondaryColor3iv];
+        if (glad_glSecondaryColor3s == counted_glSecondaryColor3s)
+            glad_glSecondaryColor3s = (PFNGLSECONDARYCOLOR3SPROC)Table<>::loaded[ENTRY_glSecondaryColor3s];
+        if (glad_glSecondaryColor3sv == counted_glSecondaryColor3sv)
+            glad_glSecondaryColor3sv = (PFNGLSECONDARYCOLOR3SVPROC)Table<>::loaded[ENTRY_glSecondaryColor3sv];
+        if (glad_glSecondaryColor3ub == counted_glSecondaryColor3ub)
+            glad_glSecondaryColor3ub = (PFNGLSECONDARYCOLOR3UBPROC)Table<>::loaded[ENTRY_glSecondaryColor3ub];
+        if (glad_glSecondaryColor3ubv == counted_glSecondaryColor3ubv)
+            glad_glSecondaryColor3ubv = (PFNGLSECONDARYCOLOR3UBVPROC)Table<>::loaded[ENTRY_glSecondaryColor3ubv];
+        if (glad_glSecondaryColor3ui == counted_glSecondaryColor3ui)
+            glad_glSecondaryColor3ui = (PFNGLSECONDARYCOLOR3UIPROC)Table<>::loaded[ENTRY_glSecondaryColor3ui];
+        if (glad_glSecondaryColor3uiv == counted_glSecondaryColor3uiv)
+            glad_glSecondaryColor3uiv = (PFNGLSECONDARYCOLOR3UIVPROC)Table<>::loaded[ENTRY_glSecondaryColor3uiv];
+        if (glad_glSecondaryColor3us == counted_glSecondaryColor3us)
+            glad_glSecondaryColor3us = (PFNGLSECONDARYCOLOR3USPROC)Table<>::loaded[ENTRY_glSecondaryColor3us];
+        if (glad_glSecondaryColor3usv == counted_glSecondaryColor3usv)
+            glad_glSecondaryColor3usv = (PFNGLSECONDARYCOLOR3USVPROC)Table<>::loaded[ENTRY_glSecondaryColor3usv];
+        if (glad_glSecondaryColorPointer == counted_glSecondaryColorPointer)
+            glad_glSecondaryColorPointer = (PFNGLSECONDARYCOLORPOINTERPROC)Table<>::loaded[ENTRY_glSecondaryColorPointer];
+        if (glad_glWindowPos2d == counted_glWindowPos2d)
+            glad_glWindowPos2d = (PFNGLWINDOWPOS2DPROC)Table<>::loaded[ENTRY_glWindowPos2d];
+        if (glad_glWindowPos2dv == counted_glWindowPos2dv)
+            glad_glWindowPos2dv = (PFNGLWINDOWPOS2DVPROC)Table<>::loaded[ENTRY_glWindowPos2dv];
+        if (glad_glWindowPos2f == counted_glWindowPos2f)
+            glad_glWindowPos2f = (PFNGLWINDOWPOS2FPROC)Table<>::loaded[ENTRY_glWindowPos2f];
+        if (glad_glWindowPos2fv == counted_glWindowPos2fv)
+            glad_glWindowPos2fv = (PFNGLWINDOWPOS2FVPROC)Table<>::loaded[ENTRY_glWindowPos2fv];
+        if (glad_glWindowPos2i == counted_glWindowPos2i)
+            glad_glWindowPos2i = (PFNGLWINDOWPOS2IPROC)Table<>::loaded[ENTRY_glWindowPos2i];
+        if (glad_glWindowPos2iv == counted_glWindowPos2iv)
+            glad_glWindowPos2iv = (PFNGLWINDOWPOS2IVPROC)Table<>::loaded[ENTRY_glWindowPos2iv];
+        if (glad_glWindowPos2s == counted_glWindowPos2s)
+            glad_glWindowPos2s = (PFNGLWINDOWPOS2SPROC)Table<>::loaded[ENTRY_glWindowPos2s];
+        if (glad_glWindowPos2sv == counted_glWindowPos2sv)
+            glad_glWindowPos2sv = (PFNGLWINDOWPOS2SVPROC)Table<>::loaded[ENTRY_glWindowPos2sv];
+        if (glad_glWindowPos3d == counted_glWindowPos3d)
+            glad_glWindowPos3d = (PFNGLWINDOWPOS3DPROC)Table<>::loaded[ENTRY_glWindowPos3d];
+        if (glad_glWindowPos3dv == counted_glWindowPos3dv)
+            glad_glWindowPos3dv = (PFNGLWINDOWPOS3DVPROC)Table<>::loaded[ENTRY_glWindowPos3dv];
+        if (glad_glWindowPos3f == counted_glWindowPos3f)
+            glad_glWindowPos3f = (PFNGLWINDOWPOS3FPROC)Table<>::loaded[ENTRY_glWindowPos3f];
+        if (glad_glWindowPos3fv == counted_glWindowPos3fv)
+            glad_glWindowPos3fv = (PFNGLWINDOWPOS3FVPROC)Table<>::loaded[ENTRY_glWindowPos3fv];
+        if (glad_glWindowPos3i == counted_glWindowPos3i)
+            glad_glWindowPos3i = (PFNGLWINDOWPOS3IPROC)Table<>::loaded[ENTRY_glWindowPos3i];
+        if (glad_glWindowPos3iv == counted_glWindowPos3iv)
+            glad_glWindowPos3iv = (PFNGLWINDOWPOS3IVPROC)Table<>::loaded[ENTRY_glWindowPos3iv];
+        if (glad_glWindowPos3s == counted_glWindowPos3s)
+            glad_glWindowPos3s = (PFNGLWINDOWPOS3SPROC)Table<>::loaded[ENTRY_glWindowPos3s];
+        if (glad_glWindowPos3sv == counted_glWindowPos3sv)
+            glad_glWindowPos3sv = (PFNGLWINDOWPOS3SVPROC)Table<>::loaded[ENTRY_glWindowPos3sv];
+        if (glad_glBlendColor == counted_glBlendColor)
+            glad_glBlendColor = (PFNGLBLENDCOLORPROC)Table<>::loaded[ENTRY_glBlendColor];
+        if (glad_glBlendEquation == counted_glBlendEquation)
+            glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)Table<>::loaded[ENTRY_glBlendEquation];
+        if (glad_glGenQueries == counted_glGenQueries)
+            glad_glGenQueries = (PFNGLGENQUERIESPROC)Table<>::loaded[ENTRY_glGenQueries];
+        if (glad_glDeleteQueries == counted_glDeleteQueries)
+            glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)Table<>::loaded[ENTRY_glDeleteQueries];
+        if (glad_glIsQuery == counted_glIsQuery)
+            glad_glIsQuery = (PFNGLISQUERYPROC)Table<>::loaded[ENTRY_glIsQuery];
+        if (glad_glBeginQuery == counted_glBeginQuery)
+            glad_glBeginQuery = (PFNGLBEGINQUERYPROC)Table<>::loaded[ENTRY_glBeginQuery];
+        if (glad_glEndQuery == counted_glEndQuery)
+            glad_glEndQuery = (PFNGLENDQUERYPROC)Table<>::loaded[ENTRY_glEndQuery];
+        if (glad_glGetQueryiv == counted_glGetQueryiv)
+            glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)Table<>::loaded[ENTRY_glGetQueryiv];
+        if (glad_glGetQueryObjectiv == counted_glGetQueryObjectiv)
+            glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)Table<>::loaded[ENTRY_glGetQueryObjectiv];
+        if (glad_glGetQueryObjectuiv == counted_glGetQueryObjectuiv)
+            glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)Table<>::loaded[ENTRY_glGetQueryObjectuiv];
+        if (glad_glBindBuffer == counted_glBindBuffer)
+            glad_glBindBuffer = (PFNGLBINDBUFFERPROC)Table<>::loaded[ENTRY_glBindBuffer];
+        if (glad_glDeleteBuffers == counted_glDeleteBuffers)
+            glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)Table<>::loaded[ENTRY_glDeleteBuffers];
+        if (glad_glGenBuffers == counted_glGenBuffers)
+            glad_glGenBuffers = (PFNGLGENBUFFERSPROC)Table<>::loaded[ENTRY_glGenBuffers];
+        if (glad_glIsBuffer == counted_glIsBuffer)
+            glad_glIsBuffer = (PFNGLISBUFFERPROC)Table<>::loaded[ENTRY_glIsBuffer];
+        if (glad_glBufferData == counted_glBufferData)
+            glad_glBufferData = (PFNGLBUFFERDATAPROC)Table<>::loaded[ENTRY_glBufferData];
+        if (glad_glBufferSubData == counted_glBufferSubData)
+            glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)Table<>::loaded[ENTRY_glBufferSubData];
+        if (glad_glGetBufferSubData == counted_glGetBufferSubData)
+            glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)Table<>::loaded[ENTRY_glGetBufferSubData];
+        if (glad_glMapBuffer == counted_glMapBuffer)
+            glad_glMapBuffer = (PFNGLMAPBUFFERPROC)Table<>::loaded[ENTRY_glMapBuffer];
+        if (glad_glUnmapBuffer == counted_glUnmapBuffer)
+            glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)Table<>::loaded[ENTRY_glUnmapBuffer];
+        if (glad_glGetBufferParameteriv == counted_glGetBufferParameteriv)
+            glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)Table<>::loaded[ENTRY_glGetBufferParameteriv];
+        if (glad_glGetBufferPointerv == counted_glGetBufferPointerv)
+            glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)Table<>::loaded[ENTRY_glGetBufferPointerv];
+        if (glad_glBlendEquationSeparate == counted_glBlendEquationSeparate)
+            glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)Table<>::loaded[ENTRY_glBlendEquationSeparate];
+        if (glad_glDrawBuffers == counted_glDrawBuffers)
+            glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)Table<>::loaded[ENTRY_glDrawBuffers];
+        if (glad_glStencilOpSeparate == counted_glStencilOpSeparate)
+            glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)Table<>::loaded[ENTRY_glStencilOpSeparate];
+        if (glad_glStencilFuncSeparate == counted_glStencilFuncSeparate)
+            glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)Table<>::loaded[ENTRY_glStencilFuncSeparate];
+        if (glad_glStencilMaskSeparate == counted_glStencilMaskSeparate)
+            glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)Table<>::loaded[ENTRY_glStencilMaskSeparate];
+        if (glad_glAttachShader == counted_glAttachShader)
+            glad_glAttachShader = (PFNGLATTACHSHADERPROC)Table<>::loaded[ENTRY_glAttachShader];
+        if (glad_glBindAttribLocation == counted_glBindAttribLocation)
+            glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)Table<>::loaded[ENTRY_glBindAttribLocation];
+        if (glad_glCompileShader == counted_glCompileShader)
+            glad_glCompileShader = (PFNGLCOMPILESHADERPROC)Table<>::loaded[ENTRY_glCompileShader];
+        if (glad_glCreateProgram == counted_glCreateProgram)
+            glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)Table<>::loaded[ENTRY_glCreateProgram];
+        if (glad_glCreateShader == counted_glCreateShader)
+            glad_glCreateShader = (PFNGLCREATESHADERPROC)Table<>::loaded[ENTRY_glCreateShader];
+        if (glad_glDeleteProgram == counted_glDeleteProgram)
+            glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)Table<>::loaded[ENTRY_glDeleteProgram];
+        if (glad_glDeleteShader == counted_glDeleteShader)
+            glad_glDeleteShader = (PFNGLDELETESHADERPROC)Table<>::loaded[ENTRY_glDeleteShader];
+        if (glad_glDetachShader == counted_glDetachShader)
+            glad_glDetachShader = (PFNGLDETACHSHADERPROC)Table<>::loaded[ENTRY_glDetachShader];
+        if (glad_glDisableVertexAttribArray == counted_glDisableVertexAttribArray)
+            glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)Table<>::loaded[ENTRY_glDisableVertexAttribArray];
+        if (glad_glEnableVertexAttribArray == counted_glEnableVertexAttribArray)
+            glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)Table<>::loaded[ENTRY_glEnableVertexAttribArray];
+        if (glad_glGetActiveAttrib == counted_glGetActiveAttrib)
+            glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)Table<>::loaded[ENTRY_glGetActiveAttrib];
+        if (glad_glGetActiveUniform == counted_glGetActiveUniform)
+            glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)Table<>::loaded[ENTRY_glGetActiveUniform];
+        if (glad_glGetAttachedShaders == counted_glGetAttachedShaders)
+            glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)Table<>::loaded[ENTRY_glGetAttachedShaders];
+        if (glad_glGetAttribLocation == counted_glGetAttribLocation)
+            glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)Table<>::loaded[ENTRY_glGetAttribLocation];
+        if (glad_glGetProgramiv == counted_glGetProgramiv)
+            glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)Table<>::loaded[ENTRY_glGetProgramiv];
+        if (glad_glGetProgramInfoLog == counted_glGetProgramInfoLog)
+            glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)Table<>::loaded[ENTRY_glGetProgramInfoLog];
+        if (glad_glGetShaderiv == counted_glGetShaderiv)
+            glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)Table<>::loaded[ENTRY_glGetShaderiv];
+        if (glad_glGetShaderInfoLog == counted_glGetShaderInfoLog)
+            glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)Table<>::loaded[ENTRY_glGetShaderInfoLog];
+        if (glad_glGetShaderSource == counted_glGetShaderSource)
+            glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)Table<>::loaded[ENTRY_glGetShaderSource];
+        if (glad_glGetUniformLocation == counted_glGetUniformLocation)
+            glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)Table<>::loaded[ENTRY_glGetUniformLocation];
+        if (glad_glGetUniformfv == counted_glGetUniformfv)
+            glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)Table<>::loaded[ENTRY_glGetUniformfv];
+        if (glad_glGetUniformiv == counted_glGetUniformiv)
+            glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)Table<>::loaded[ENTRY_glGetUniformiv];
+        if (glad_glGetVertexAttribdv == counted_glGetVertexAttribdv)
+            glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)Table<>::loaded[ENTRY_glGetVertexAttribdv];
+        if (glad_glGetVertexAttribfv == counted_glGetVertexAttribfv)
+            glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)Table<>::loaded[ENTRY_glGetVertexAttribfv];
+        if (glad_glGetVertexAttribiv == counted_glGetVertexAttribiv)
+            glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)Table<>::loaded[ENTRY_glGetVertexAttribiv];
+        if (glad_glGetVertexAttribPointerv == counted_glGetVertexAttribPointerv)
+            glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)Table<>::loaded[ENTRY_glGetVertexAttribPointerv];
+        if (glad_glIsProgram == counted_glIsProgram)
+            glad_glIsProgram = (PFNGLISPROGRAMPROC)Table<>::loaded[ENTRY_glIsProgram];
+        if (glad_glIsShader == counted_glIsShader)
+            glad_glIsShader = (PFNGLISSHADERPROC)Table<>::loaded[ENTRY_glIsShader];
+        if (glad_glLinkProgram == counted_glLinkProgram)
+            glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)Table<>::loaded[ENTRY_glLinkProgram];
+        if (glad_glShaderSource == counted_glShaderSource)
+            glad_glShaderSource = (PFNGLSHADERSOURCEPROC)Table<>::loaded[ENTRY_glShaderSource];
+        if (glad_glUseProgram == counted_glUseProgram)
+            glad_glUseProgram = (PFNGLUSEPROGRAMPROC)Table<>::loaded[ENTRY_glUseProgram];
+        if (glad_glUniform1f == counted_glUniform1f)
+            glad_glUniform1f = (PFNGLUNIFORM1FPROC)Table<>::loaded[ENTRY_glUniform1f];
+        if (glad_glUniform2f == counted_glUniform2f)
+            glad_glUniform2f = (PFNGLUNIFORM2FPROC)Table<>::loaded[ENTRY_glUniform2f];
+        if (glad_glUniform3f == counted_glUniform3f)
+            glad_glUniform3f = (PFNGLUNIFORM3FPROC)Table<>::loaded[ENTRY_glUniform3f];
+        if (glad_glUniform4f == counted_glUniform4f)
+            glad_glUniform4f = (PFNGLUNIFORM4FPROC)Table<>::loaded[ENTRY_glUniform4f];
+        if (glad_glUniform1i == counted_glUniform1i)
+            glad_glUniform1i = (PFNGLUNIFORM1IPROC)Table<>::loaded[ENTRY_glUniform1i];
+        if (glad_glUniform2i == counted_glUniform2i)
+            glad_glUniform2i = (PFNGLUNIFORM2IPROC)Table<>::loaded[ENTRY_glUniform2i];
+        if (glad_glUniform3i == counted_glUniform3i)
+            glad_glUniform3i = (PFNGLUNIFORM3IPROC)Table<>::loaded[ENTRY_glUniform3i];
+        if (glad_glUniform4i == counted_glUniform4i)
+            glad_glUniform4i = (PFNGLUNIFORM4IPROC)Table<>::loaded[ENTRY_glUniform4i];
+        if (glad_glUniform1fv == counted_glUniform1fv)
+            glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)Table<>::loaded[ENTRY_glUniform1fv];
+        if (glad_glUniform2fv == counted_glUniform2fv)
+            glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)Table<>::loaded[ENTRY_glUniform2fv];
+        if (glad_glUniform3fv == counted_glUniform3fv)
+            glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)Table<>::loaded[ENTRY_glUniform3fv];
+        if (glad_glUniform4fv == counted_glUniform4fv)
+            glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)Table<>::loaded[ENTRY_glUniform4fv];
+        if (glad_glUniform1iv == counted_glUniform1iv)
+            glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)Table<>::loaded[ENTRY_glUniform1iv];
+        if (glad_glUniform2iv == counted_glUniform2iv)
+            glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)Table<>::loaded[ENTRY_glUniform2iv];
+        if (glad_glUniform3iv == counted_glUniform3iv)
+            glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)Table<>::loaded[ENTRY_glUniform3iv];
+        if (glad_glUniform4iv == counted_glUniform4iv)
+            glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)Table<>::loaded[ENTRY_glUniform4iv];
+        if (glad_glUniformMatrix2fv == counted_glUniformMatrix2fv)
+            glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)Table<>::loaded[ENTRY_glUniformMatrix2fv];
+        if (glad_glUniformMatrix3fv == counted_glUniformMatrix3fv)
+            glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)Table<>::loaded[ENTRY_glUniformMatrix3fv];
+        if (glad_glUniformMatrix4fv == counted_glUniformMatrix4fv)
+            glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)Table<>::loaded[ENTRY_glUniformMatrix4fv];
+        if (glad_glValidateProgram == counted_glValidateProgram)
+            glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)Table<>::loaded[ENTRY_glValidateProgram];
+        if (glad_glVertexAttrib1d == counted_glVertexAttrib1d)
+            glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)Table<>::loaded[ENTRY_glVertexAttrib1d];
+        if (glad_glVertexAttrib1dv == counted_glVertexAttrib1dv)
+            glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)Table<>::loaded[ENTRY_glVertexAttrib1dv];
+        if (glad_glVertexAttrib1f == counted_glVertexAttrib1f)
+            glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)Table<>::loaded[ENTRY_glVertexAttrib1f];
+        if (glad_glVertexAttrib1fv == counted_glVertexAttrib1fv)
+            glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)Table<>::loaded[ENTRY_glVertexAttrib1fv];
+        if (glad_glVertexAttrib1s == counted_glVertexAttrib1s)
+            glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)Table<>::loaded[ENTRY_glVertexAttrib1s];
+        if (glad_glVertexAttrib1sv == counted_glVertexAttrib1sv)
+            glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)Table<>::loaded[ENTRY_glVertexAttrib1sv];
+        if (glad_glVertexAttrib2d == counted_glVertexAttrib2d)
+            glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)Table<>::loaded[ENTRY_glVertexAttrib2d];
+        if (glad_glVertexAttrib2dv == counted_glVertexAttrib2dv)
+            glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)Table<>::loaded[ENTRY_glVertexAttrib2dv];
+        if (glad_glVertexAttrib2f == counted_glVertexAttrib2f)
+            glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)Table<>::loaded[ENTRY_glVertexAttrib2f];
+        if (glad_glVertexAttrib2fv == counted_glVertexAttrib2fv)
+            glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)Table<>::loaded[ENTRY_glVertexAttrib2fv];
+        if (glad_glVertexAttrib2s == counted_glVertexAttrib2s)
+            glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)Table<>::loaded[ENTRY_glVertexAttrib2s];
+        if (glad_glVertexAttrib2sv == counted_glVertexAttrib2sv)
+            glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)Table<>::loaded[ENTRY_glVertexAttrib2sv];
+        if (glad_glVertexAttrib3d == counted_glVertexAttrib3d)
+            glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)Table<>::loaded[ENTRY_glVertexAttrib3d];
+        if (glad_glVertexAttrib3dv == counted_glVertexAttrib3dv)
+            glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)Table<>::loaded[ENTRY_glVertexAttrib3dv];
+        if (glad_glVertexAttrib3f == counted_glVertexAttrib3f)
+            glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)Table<>::loaded[ENTRY_glVertexAttrib3f];
+        if (glad_glVertexAttrib3fv == counted_glVertexAttrib3fv)
+            glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)Table<>::loaded[ENTRY_glVertexAttrib3fv];
+        if (glad_glVertexAttrib3s == counted_glVertexAttrib3s)
+            glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)Table<>::loaded[ENTRY_glVertexAttrib3s];
+        if (glad_glVertexAttrib3sv == counted_glVertexAttrib3sv)
+            glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)Table<>::loaded[ENTRY_glVertexAttrib3sv];
+        if (glad_glVertexAttrib4Nbv == counted_glVertexAttrib4Nbv)
+            glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nbv];
+        if (glad_glVertexAttrib4Niv == counted_glVertexAttrib4Niv)
+            glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Niv];
+        if (glad_glVertexAttrib4Nsv == counted_glVertexAttrib4Nsv)
+            glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nsv];
+        if (glad_glVertexAttrib4Nub == counted_glVertexAttrib4Nub)
+            glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nub];
+        if (glad_glVertexAttrib4Nubv == counted_glVertexAttrib4Nubv)
+            glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nubv];
+        if (glad_glVertexAttrib4Nuiv == counted_glVertexAttrib4Nuiv)
+            glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nuiv];
+        if (glad_glVertexAttrib4Nusv == counted_glVertexAttrib4Nusv)
+            glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nusv];
+        if (glad_glVertexAttrib4bv == counted_glVertexAttrib4bv)
+            glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)Table<>::loaded[ENTRY_glVertexAttrib4bv];
+        if (glad_glVertexAttrib4d == counted_glVertexAttrib4d)
+            glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)Table<>::loaded[ENTRY_glVertexAttrib4d];
+        if (glad_glVertexAttrib4dv == counted_glVertexAttrib4dv)
+            glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)Table<>::loaded[ENTRY_glVertexAttrib4dv];
+        if (glad_glVertexAttrib4f == counted_glVertexAttrib4f)
+            glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)Table<>::loaded[ENTRY_glVertexAttrib4f];
+        if (glad_glVertexAttrib4fv == counted_glVertexAttrib4fv)
+            glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)Table<>::loaded[ENTRY_glVertexAttrib4fv];
+        if (glad_glVertexAttrib4iv == counted_glVertexAttrib4iv)
+            glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)Table<>::loaded[ENTRY_glVertexAttrib4iv];
+        if (glad_glVertexAttrib4s == counted_glVertexAttrib4s)
+            glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)Table<>::loaded[ENTRY_glVertexAttrib4s];
+        if (glad_glVertexAttrib4sv == counted_glVertexAttrib4sv)
+            glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)Table<>::loaded[ENTRY_glVertexAttrib4sv];
+        if (glad_glVertexAttrib4ubv == counted_glVertexAttrib4ubv)
+            glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)Table<>::loaded[ENTRY_glVertexAttrib4ubv];
+        if (glad_glVertexAttrib4uiv == counted_glVertexAttrib4uiv)
+            glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)Table<>::loaded[ENTRY_glVertexAttrib4uiv];
+        if (glad_glVertexAttrib4usv == counted_glVertexAttrib4usv)
+            glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)Table<>::loaded[ENTRY_glVertexAttrib4usv];
+        if (glad_glVertexAttribPointer == counted_glVertexAttribPointer)
+            glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)Table<>::loaded[ENTRY_glVertexAttribPointer];
+        if (glad_glUniformMatrix2x3fv == counted_glUniformMatrix2x3fv)
+            glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)Table<>::loaded[ENTRY_glUniformMatrix2x3fv];
+        if (glad_glUniformMatrix3x2fv == counted_glUniformMatrix3x2fv)
+            glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)Table<>::loaded[ENTRY_glUniformMatrix3x2fv];
+        if (glad_glUniformMatrix2x4fv == counted_glUniformMatrix2x4fv)
+            glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)Table<>::loaded[ENTRY_glUniformMatrix2x4fv];
+        if (glad_glUniformMatrix4x2fv == counted_glUniformMatrix4x2fv)
+            glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)Table<>::loaded[ENTRY_glUniformMatrix4x2fv];
+        if (glad_glUniformMatrix3x4fv == counted_glUniformMatrix3x4fv)
+            glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)Table<>::loaded[ENTRY_glUniformMatrix3x4fv];
+        if (glad_glUniformMatrix4x3fv == counted_glUniformMatrix4x3fv)
+            glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)Table<>::loaded[ENTRY_glUniformMatrix4x3fv];
+        if (glad_glColorMaski == counted_glColorMaski)
+            glad_glColorMaski = (PFNGLCOLORMASKIPROC)Table<>::loaded[ENTRY_glColorMaski];
+        if (glad_glGetBooleani_v == counted_glGetBooleani_v)
+            glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)Table<>::loaded[ENTRY_glGetBooleani_v];
+        if (glad_glGetIntegeri_v == counted_glGetIntegeri_v)
+            glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)Table<>::loaded[ENTRY_glGetIntegeri_v];
+        if (glad_glEnablei == counted_glEnablei)
+            glad_glEnablei = (PFNGLENABLEIPROC)Table<>::loaded[ENTRY_glEnablei];
+        if (glad_glDisablei == counted_glDisablei)
+            glad_glDisablei = (PFNGLDISABLEIPROC)Table<>::loaded[ENTRY_glDisablei];
+        if (glad_glIsEnabledi == counted_glIsEnabledi)
+            glad_glIsEnabledi = (PFNGLISENABLEDIPROC)Table<>::loaded[ENTRY_glIsEnabledi];
+        if (glad_glBeginTransformFeedback == counted_glBeginTransformFeedback)
+            glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)Table<>::loaded[ENTRY_glBeginTransformFeedback];
+        if (glad_glEndTransformFeedback == counted_glEndTransformFeedback)
+            glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)Table<>::loaded[ENTRY_glEndTransformFeedback];
+        if (glad_glBindBufferRange == counted_glBindBufferRange)
+            glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)Table<>::loaded[ENTRY_glBindBufferRange];
+        if (glad_glBindBufferBase == counted_glBindBufferBase)
+            glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)Table<>::loaded[ENTRY_glBindBufferBase];
+        if (glad_glTransformFeedbackVaryings == counted_glTransformFeedbackVaryings)
+            glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)Table<>::loaded[ENTRY_glTransformFeedbackVaryings];
+        if (glad_glGetTransformFeedbackVarying == counted_glGetTransformFeedbackVarying)
+            glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)Table<>::loaded[ENTRY_glGetTransformFeedbackVarying];
+        if (glad_glClampColor == counted_glClampColor)
+            glad_glClampColor = (PFNGLCLAMPCOLORPROC)Table<>::loaded[ENTRY_glClampColor];
+        if (glad_glBeginConditionalRender == counted_glBeginConditionalRender)
+            glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)Table<>::loaded[ENTRY_glBeginConditionalRender];
+        if (glad_glEndConditionalRender == counted_glEndConditionalRender)
+            glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)Table<>::loaded[ENTRY_glEndConditionalRender];
+        if (glad_glVertexAttribIPointer == counted_glVertexAttribIPointer)
+            glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)Table<>::loaded[ENTRY_glVertexAttribIPointer];
+        if (glad_glGetVertexAttribIiv == counted_glGetVertexAttribIiv)
+            glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)Table<>::loaded[ENTRY_glGetVertexAttribIiv];
+        if (glad_glGetVertexAttribIuiv == counted_glGetVertexAttribIuiv)
+            glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)Table<>::loaded[ENTRY_glGetVertexAttribIuiv];
+        if (glad_glVertexAttribI1i == counted_glVertexAttribI1i)
+            glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)Table<>::loaded[ENTRY_glVertexAttribI1i];
+        if (glad_glVertexAttribI2i == counted_glVertexAttribI2i)
+            glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)Table<>::loaded[ENTRY_glVertexAttribI2i];
+        if (glad_glVertexAttribI3i == counted_glVertexAttribI3i)
+            glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)Table<>::loaded[ENTRY_glVertexAttribI3i];
+        if (glad_glVertexAttribI4i == counted_glVertexAttribI4i)
+            glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)Table<>::loaded[ENTRY_glVertexAttribI4i];
+        if (glad_glVertexAttribI1ui == counted_glVertexAttribI1ui)
+            glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)Table<>::loaded[ENTRY_glVertexAttribI1ui];
+        if (glad_glVertexAttribI2ui == counted_glVertexAttribI2ui)
+            glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)Table<>::loaded[ENTRY_glVertexAttribI2ui];
+        if (glad_glVertexAttribI3ui == counted_glVertexAttribI3ui)
+            glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)Table<>::loaded[ENTRY_glVertexAttribI3ui];
+        if (glad_glVertexAttribI4ui == counted_glVertexAttribI4ui)
+            glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)Table<>::loaded[ENTRY_glVertexAttribI4ui];
+        if (glad_glVertexAttribI1iv == counted_glVertexAttribI1iv)
+            glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)Table<>::loaded[ENTRY_glVertexAttribI1iv];
+        if (glad_glVertexAttribI2iv == counted_glVertexAttribI2iv)
+            glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)Table<>::loaded[ENTRY_glVertexAttribI2iv];
+        if (glad_glVertexAttribI3iv == counted_glVertexAttribI3iv)
+            glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)Table<>::loaded[ENTRY_glVertexAttribI3iv];
+        if (glad_glVertexAttribI4iv == counted_glVertexAttribI4iv)
+            glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)Table<>::loaded[ENTRY_glVertexAttribI4iv];
+        if (glad_glVertexAttribI1uiv == counted_glVertexAttribI1uiv)
+            glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)Table<>::loaded[ENTRY_glVertexAttribI1uiv];
+        if (glad_glVertexAttribI2uiv == counted_glVertexAttribI2uiv)
+            glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)Table<>::loaded[ENTRY_glVertexAttribI2uiv];
+        if (glad_glVertexAttribI3uiv == counted_glVertexAttribI3uiv)
+            glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)Table<>::loaded[ENTRY_glVertexAttribI3uiv];
+        if (glad_glVertexAttribI4uiv == counted_glVertexAttribI4uiv)
+            glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)Table<>::loaded[ENTRY_glVertexAttribI4uiv];
+        if (glad_glVertexAttribI4bv == counted_glVertexAttribI4bv)
+            glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)Table<>::loaded[ENTRY_glVertexAttribI4bv];
+        if (glad_glVertexAttribI4sv == counted_glVertexAttribI4sv)
+            glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)Table<>::loaded[ENTRY_glVertexAttribI4sv];
+        if (glad_glVertexAttribI4ubv == counted_glVertexAttribI4ubv)
+            glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)Table<>::loaded[ENTRY_glVertexAttribI4ubv];
+        if (glad_glVertexAttribI4usv == counted_glVertexAttribI4usv)
+            glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)Table<>::loaded[ENTRY_glVertexAttribI4usv];
+        if (glad_glGetUniformuiv == counted_glGetUniformuiv)
+            glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)Table<>::loaded[ENTRY_glGetUniformuiv];
+        if (glad_glBindFragDataLocation == counted_glBindFragDataLocation)
+            glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)Table<>::loaded[ENTRY_glBindFragDataLocation];
+        if (glad_glGetFragDataLocation == counted_glGetFragDataLocation)
+            glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)Table<>::loaded[ENTRY_glGetFragDataLocation];
+        if (glad_glUniform1ui == counted_glUniform1ui)
+            glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)Table<>::loaded[ENTRY_glUniform1ui];
+        if (glad_glUniform2ui == counted_glUniform2ui)
+            glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)Table<>::loaded[ENTRY_glUniform2ui];
+        if (glad_glUniform3ui == counted_glUniform3ui)
+            glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)Table<>::loaded[ENTRY_glUniform3ui];
+        if (glad_glUniform4ui == counted_glUniform4ui)
+            glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)Table<>::loaded[ENTRY_glUniform4ui];
+        if (glad_glUniform1uiv == counted_glUniform1uiv)
+            glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)Table<>::loaded[ENTRY_glUniform1uiv];
+        if (glad_glUniform2uiv == counted_glUniform2uiv)
+            glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)Table<>::loaded[ENTRY_glUniform2uiv];
+        if (glad_glUniform3uiv == counted_glUniform3uiv)
+            glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)Table<>::loaded[ENTRY_glUniform3uiv];
+        if (glad_glUniform4uiv == counted_glUniform4uiv)
+            glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)Table<>::loaded[ENTRY_glUniform4uiv];
+        if (glad_glTexParameterIiv == counted_glTexParameterIiv)
+            glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)Table<>::loaded[ENTRY_glTexParameterIiv];
+        if (glad_glTexParameterIuiv == counted_glTexParameterIuiv)
+            glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)Table<>::loaded[ENTRY_glTexParameterIuiv];
+        if (glad_glGetTexParameterIiv == counted_glGetTexParameterIiv)
+            glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)Table<>::loaded[ENTRY_glGetTexParameterIiv];
+        if (glad_glGetTexParameterIuiv == counted_glGetTexParameterIuiv)
+            glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)Table<>::loaded[ENTRY_glGetTexParameterIuiv];
+        if (glad_glClearBufferiv == counted_glClearBufferiv)
+            glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)Table<>::loaded[ENTRY_glClearBufferiv];
+        if (glad_glClearBufferuiv == counted_glClearBufferuiv)
+            glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)Table<>::loaded[ENTRY_glClearBufferuiv];
+        if (glad_glClearBufferfv == counted_glClearBufferfv)
+            glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)Table<>::loaded[ENTRY_glClearBufferfv];
+        if (glad_glClearBufferfi == counted_glClearBufferfi)
+            glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)Table<>::loaded[ENTRY_glClearBufferfi];
+        if (glad_glGetStringi == counted_glGetStringi)
+            glad_glGetStringi = (PFNGLGETSTRINGIPROC)Table<>::loaded[ENTRY_glGetStringi];
+        if (glad_glIsRenderbuffer == counted_glIsRenderbuffer)
+            glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)Table<>::loaded[ENTRY_glIsRenderbuffer];
+        if (glad_glBindRenderbuffer == counted_glBindRenderbuffer)
+            glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)Table<>::loaded[ENTRY_glBindRenderbuffer];
+        if (glad_glDeleteRenderbuffers == counted_glDeleteRenderbuffers)
+            glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)Table<>::loaded[ENTRY_glDeleteRenderbuffers];
+        if (glad_glGenRenderbuffers == counted_glGenRenderbuffers)
+            glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)Table<>::loaded[ENTRY_glGenRenderbuffers];
+        if (glad_glRenderbufferStorage == counted_glRenderbufferStorage)
+            glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)Table<>::loaded[ENTRY_glRenderbufferStorage];
+        if (glad_glGetRenderbufferParameteriv == counted_glGetRenderbufferParameteriv)
+            glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)Table<>::loaded[ENTRY_glGetRenderbufferParameteriv];
+        if (glad_glIsFramebuffer == counted_glIsFramebuffer)
+            glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)Table<>::loaded[ENTRY_glIsFramebuffer];
+        if (glad_glBindFramebuffer == counted_glBindFramebuffer)
+            glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)Table<>::loaded[ENTRY_glBindFramebuffer];
+        if (glad_glDeleteFramebuffers == counted_glDeleteFramebuffers)
+            glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)Table<>::loaded[ENTRY_glDeleteFramebuffers];
+        if (glad_glGenFramebuffers == counted_glGenFramebuffers)
+            glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)Table<>::loaded[ENTRY_glGenFramebuffers];
+        if (glad_glCheckFramebufferStatus == counted_glCheckFramebufferStatus)
+            glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)Table<>::loaded[ENTRY_glCheckFramebufferStatus];
+        if (glad_glFramebufferTexture1D == counted_glFramebufferTexture1D)
+            glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)Table<>::loaded[ENTRY_glFramebufferTexture1D];
+        if (glad_glFramebufferTexture2D == counted_glFramebufferTexture2D)
+            glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)Table<>::loaded[ENTRY_glFramebufferTexture2D];
+        if (glad_glFramebufferTexture3D == counted_glFramebufferTexture3D)
+            glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)Table<>::loaded[ENTRY_glFramebufferTexture3D];
+        if (glad_glFramebufferRenderbuffer == counted_glFramebufferRenderbuffer)
+            glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)Table<>::loaded[ENTRY_glFramebufferRenderbuffer];
+        if (glad_glGetFramebufferAttachmentParameteriv == counted_glGetFramebufferAttachmentParameteriv)
+            glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)Table<>::loaded[ENTRY_glGetFramebufferAttachmentParameteriv];
+        if (glad_glGenerateMipmap == counted_glGenerateMipmap)
+            glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)Table<>::loaded[ENTRY_glGenerateMipmap];
+        if (glad_glBlitFramebuffer == counted_glBlitFramebuffer)
+            glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)Table<>::loaded[ENTRY_glBlitFramebuffer];
+        if (glad_glRenderbufferStorageMultisample == counted_glRenderbufferStorageMultisample)
+            glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)Table<>::loaded[ENTRY_glRenderbufferStorageMultisample];
+        if (glad_glFramebufferTextureLayer == counted_glFramebufferTextureLayer)
+            glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)Table<>::loaded[ENTRY_glFramebufferTextureLayer];
+        if (glad_glMapBufferRange == counted_glMapBufferRange)
+            glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)Table<>::loaded[ENTRY_glMapBufferRange];
+        if (glad_glFlushMappedBufferRange == counted_glFlushMappedBufferRange)
+            glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)Table<>::loaded[ENTRY_glFlushMappedBufferRange];
+        if (glad_glBindVertexArray == counted_glBindVertexArray)
+            glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)Table<>::loaded[ENTRY_glBindVertexArray];
+        if (glad_glDeleteVertexArrays == counted_glDeleteVertexArrays)
+            glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)Table<>::loaded[ENTRY_glDeleteVertexArrays];
+        if (glad_glGenVertexArrays == counted_glGenVertexArrays)
+            glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)Table<>::loaded[ENTRY_glGenVertexArrays];
+        if (glad_glIsVertexArray == counted_glIsVertexArray)
+            glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)Table<>::loaded[ENTRY_glIsVertexArray];
+        if (glad_glDrawArraysInstanced == counted_glDrawArraysInstanced)
+            glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)Table<>::loaded[ENTRY_glDrawArraysInstanced];
+        if (glad_glDrawElementsInstanced == counted_glDrawElementsInstanced)
+            glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)Table<>::loaded[ENTRY_glDrawElementsInstanced];
+        if (glad_glTexBuffer == counted_glTexBuffer)
+            glad_glTexBuffer = (PFNGLTEXBUFFERPROC)Table<>::loaded[ENTRY_glTexBuffer];
+        if (glad_glPrimitiveRestartIndex == counted_glPrimitiveRestartIndex)
+            glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)Table<>::loaded[ENTRY_glPrimitiveRestartIndex];
+        if (glad_glCopyBufferSubData == counted_glCopyBufferSubData)
+            glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)Table<>::loaded[ENTRY_glCopyBufferSubData];
+        if (glad_glGetUniformIndices == counted_glGetUniformIndices)
+            glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)Table<>::loaded[ENTRY_glGetUniformIndices];
+        if (glad_glGetActiveUniformsiv == counted_glGetActiveUniformsiv)
+            glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)Table<>::loaded[ENTRY_glGetActiveUniformsiv];
+        if (glad_glGetActiveUniformName == counted_glGetActiveUniformName)
+            glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)Table<>::loaded[ENTRY_glGetActiveUniformName];
+        if (glad_glGetUniformBlockIndex == counted_glGetUniformBlockIndex)
+            glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)Table<>::loaded[ENTRY_glGetUniformBlockIndex];
+        if (glad_glGetActiveUniformBlockiv == counted_glGetActiveUniformBlockiv)
+            glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)Table<>::loaded[ENTRY_glGetActiveUniformBlockiv];
+        if (glad_glGetActiveUniformBlockName == counted_glGetActiveUniformBlockName)
+            glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)Table<>::loaded[ENTRY_glGetActiveUniformBlockName];
+        if (glad_glUniformBlockBinding == counted_glUniformBlockBinding)
+            glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)Table<>::loaded[ENTRY_glUniformBlockBinding];
+        if (glad_glDrawElementsBaseVertex == counted_glDrawElementsBaseVertex)
+            glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)Table<>::loaded[ENTRY_glDrawElementsBaseVertex];
+        if (glad_glDrawRangeElementsBaseVertex == counted_glDrawRangeElementsBaseVertex)
+            glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)Table<>::loaded[ENTRY_glDrawRangeElementsBaseVertex];
+        if (glad_glDrawElementsInstancedBaseVertex == counted_glDrawElementsInstancedBaseVertex)
+            glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)Table<>::loaded[ENTRY_glDrawElementsInstancedBaseVertex];
+        if (glad_glMultiDrawElementsBaseVertex == counted_glMultiDrawElementsBaseVertex)
+            glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)Table<>::loaded[ENTRY_glMultiDrawElementsBaseVertex];
+        if (glad_glProvokingVertex == counted_glProvokingVertex)
+            glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)Table<>::loaded[ENTRY_glProvokingVertex];
+        if (glad_glFenceSync == counted_glFenceSync)
+            glad_glFenceSync = (PFNGLFENCESYNCPROC)Table<>::loaded[ENTRY_glFenceSync];
+        if (glad_glIsSync == counted_glIsSync)
+            glad_glIsSync = (PFNGLISSYNCPROC)Table<>::loaded[ENTRY_glIsSync];
+        if (glad_glDeleteSync == counted_glDeleteSync)
+            glad_glDeleteSync = (PFNGLDELETESYNCPROC)Table<>::loaded[ENTRY_glDeleteSync];
+        if (glad_glClientWaitSync == counted_glClientWaitSync)
+            glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)Table<>::loaded[ENTRY_glClientWaitSync];
+        if (glad_glWaitSync == counted_glWaitSync)
+            glad_glWaitSync = (PFNGLWAITSYNCPROC)Table<>::loaded[ENTRY_glWaitSync];
+        if (glad_glGetInteger64v == counted_glGetInteger64v)
+            glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)Table<>::loaded[ENTRY_glGetInteger64v];
+        if (glad_glGetSynciv == counted_glGetSynciv)
+            glad_glGetSynciv = (PFNGLGETSYNCIVPROC)Table<>::loaded[ENTRY_glGetSynciv];
+        if (glad_glGetInteger64i_v == counted_glGetInteger64i_v)
+            glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)Table<>::loaded[ENTRY_glGetInteger64i_v];
+        if (glad_glGetBufferParameteri64v == counted_glGetBufferParameteri64v)
+            glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)Table<>::loaded[ENTRY_glGetBufferParameteri64v];
+        if (glad_glFramebufferTexture == counted_glFramebufferTexture)
+            glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)Table<>::loaded[ENTRY_glFramebufferTexture];
+        if (glad_glTexImage2DMultisample == counted_glTexImage2DMultisample)
+            glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)Table<>::loaded[ENTRY_glTexImage2DMultisample];
+        if (glad_glTexImage3DMultisample == counted_glTexImage3DMultisample)
+            glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)Table<>::loaded[ENTRY_glTexImage3DMultisample];
+        if (glad_glGetMultisamplefv == counted_glGetMultisamplefv)
+            glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)Table<>::loaded[ENTRY_glGetMultisamplefv];
+        if (glad_glSampleMaski == counted_glSampleMaski)
+            glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)Table<>::loaded[ENTRY_glSampleMaski];
+        if (glad_glBindFragDataLocationIndexed == counted_glBindFragDataLocationIndexed)
+            glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)Table<>::loaded[ENTRY_glBindFragDataLocationIndexed];
+        if (glad_glGetFragDataIndex == counted_glGetFragDataIndex)
+            glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)Table<>::loaded[ENTRY_glGetFragDataIndex];
+        if (glad_glGenSamplers == counted_glGenSamplers)
+            glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)Table<>::loaded[ENTRY_glGenSamplers];
+        if (glad_glDeleteSamplers == counted_glDeleteSamplers)
+            glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)Table<>::loaded[ENTRY_glDeleteSamplers];
+        if (glad_glIsSampler == counted_glIsSampler)
+            glad_glIsSampler = (PFNGLISSAMPLERPROC)Table<>::loaded[ENTRY_glIsSampler];
+        if (glad_glBindSampler == counted_glBindSampler)
+            glad_glBindSampler = (PFNGLBINDSAMPLERPROC)Table<>::loaded[ENTRY_glBindSampler];
+        if (glad_glSamplerParameteri == counted_glSamplerParameteri)
+            glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)Table<>::loaded[ENTRY_glSamplerParameteri];
+        if (glad_glSamplerParameteriv == counted_glSamplerParameteriv)
+            glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)Table<>::loaded[ENTRY_glSamplerParameteriv];
+        if (glad_glSamplerParameterf == counted_glSamplerParameterf)
+            glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)Table<>::loaded[ENTRY_glSamplerParameterf];
+        if (glad_glSamplerParameterfv == counted_glSamplerParameterfv)
+            glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)Table<>::loaded[ENTRY_glSamplerParameterfv];
+        if (glad_glSamplerParameterIiv == counted_glSamplerParameterIiv)
+            glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)Table<>::loaded[ENTRY_glSamplerParameterIiv];
+        if (glad_glSamplerParameterIuiv == counted_glSamplerParameterIuiv)
+            glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)Table<>::loaded[ENTRY_glSamplerParameterIuiv];
+        if (glad_glGetSamplerParameteriv == counted_glGetSamplerParameteriv)
+            glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)Table<>::loaded[ENTRY_glGetSamplerParameteriv];
+        if (glad_glGetSamplerParameterIiv == counted_glGetSamplerParameterIiv)
+            glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)Table<>::loaded[ENTRY_glGetSamplerParameterIiv];
+        if (glad_glGetSamplerParameterfv == counted_glGetSamplerParameterfv)
+            glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)Table<>::loaded[ENTRY_glGetSamplerParameterfv];
+        if (glad_glGetSamplerParameterIuiv == counted_glGetSamplerParameterIuiv)
+            glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)Table<>::loaded[ENTRY_glGetSamplerParameterIuiv];
+        if (glad_glQueryCounter == counted_glQueryCounter)
+            glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)Table<>::loaded[ENTRY_glQueryCounter];
+        if (glad_glGetQueryObjecti64v == counted_glGetQueryObjecti64v)
+            glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)Table<>::loaded[ENTRY_glGetQueryObjecti64v];
+        if (glad_glGetQueryObjectui64v == counted_glGetQueryObjectui64v)
+            glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)Table<>::loaded[ENTRY_glGetQueryObjectui64v];
+        if (glad_glVertexAttribDivisor == counted_glVertexAttribDivisor)
+            glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)Table<>::loaded[ENTRY_glVertexAttribDivisor];
+        if (glad_glVertexAttribP1ui == counted_glVertexAttribP1ui)
+            glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)Table<>::loaded[ENTRY_glVertexAttribP1ui];
+        if (glad_glVertexAttribP1uiv == counted_glVertexAttribP1uiv)
+            glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)Table<>::loaded[ENTRY_glVertexAttribP1uiv];
+        if (glad_glVertexAttribP2ui == counted_glVertexAttribP2ui)
+            glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)Table<>::loaded[ENTRY_glVertexAttribP2ui];
+        if (glad_glVertexAttribP2uiv == counted_glVertexAttribP2uiv)
+            glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)Table<>::loaded[ENTRY_glVertexAttribP2uiv];
+        if (glad_glVertexAttribP3ui == counted_glVertexAttribP3ui)
+            glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)Table<>::loaded[ENTRY_glVertexAttribP3ui];
+        if (glad_glVertexAttribP3uiv == counted_glVertexAttribP3uiv)
+            glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)Table<>::loaded[ENTRY_glVertexAttribP3uiv];
+        if (glad_glVertexAttribP4ui == counted_glVertexAttribP4ui)
+            glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)Table<>::loaded[ENTRY_glVertexAttribP4ui];
+        if (glad_glVertexAttribP4uiv == counted_glVertexAttribP4uiv)
+            glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)Table<>::loaded[ENTRY_glVertexAttribP4uiv];
+        if (glad_glVertexP2ui == counted_glVertexP2ui)
+            glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)Table<>::loaded[ENTRY_glVertexP2ui];
+        if (glad_glVertexP2uiv == counted_glVertexP2uiv)
+            glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)Table<>::loaded[ENTRY_glVertexP2uiv];
+        if (glad_glVertexP3ui == counted_glVertexP3ui)
+            glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)Table<>::loaded[ENTRY_glVertexP3ui];
+        if (glad_glVertexP3uiv == counted_glVertexP3uiv)
+            glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)Table<>::loaded[ENTRY_glVertexP3uiv];
+        if (glad_glVertexP4ui == counted_glVertexP4ui)
+            glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)Table<>::loaded[ENTRY_glVertexP4ui];
+        if (glad_glVertexP4uiv == counted_glVertexP4uiv)
+            glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)Table<>::loaded[ENTRY_glVertexP4uiv];
+        if (glad_glTexCoordP1ui == counted_glTexCoordP1ui)
+            glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)Table<>::loaded[ENTRY_glTexCoordP1ui];
+        if (glad_glTexCoordP1uiv == counted_glTexCoordP1uiv)
+            glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)Table<>::loaded[ENTRY_glTexCoordP1uiv];
+        if (glad_glTexCoordP2ui == counted_glTexCoordP2ui)
+            glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)Table<>::loaded[ENTRY_glTexCoordP2ui];
+        if (glad_glTexCoordP2uiv == counted_glTexCoordP2uiv)
+            glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)Table<>::loaded[ENTRY_glTexCoordP2uiv];
+        if (glad_glTexCoordP3ui == counted_glTexCoordP3ui)
+            glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)Table<>::loaded[ENTRY_glTexCoordP3ui];
+        if (glad_glTexCoordP3uiv == counted_glTexCoordP3uiv)
+            glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)Table<>::loaded[ENTRY_glTexCoordP3uiv];
+        if (glad_glTexCoordP4ui == counted_glTexCoordP4ui)
+            glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)Table<>::loaded[ENTRY_glTexCoordP4ui];
+        if (glad_glTexCoordP4uiv == counted_glTexCoordP4uiv)
+            glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)Table<>::loaded[ENTRY_glTexCoordP4uiv];
+        if (glad_glMultiTexCoordP1ui == counted_glMultiTexCoordP1ui)
+            glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)Table<>::loaded[ENTRY_glMultiTexCoordP1ui];
+        if (glad_glMultiTexCoordP1uiv == counted_glMultiTexCoordP1uiv)
+            glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)Table<>::loaded[ENTRY_glMultiTexCoordP1uiv];
+        if (glad_glMultiTexCoordP2ui == counted_glMultiTexCoordP2ui)
+            glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)Table<>::loaded[ENTRY_glMultiTexCoordP2ui];
+        if (glad_glMultiTexCoordP2uiv == counted_glMultiTexCoordP2uiv)
+            glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)Table<>::loaded[ENTRY_glMultiTexCoordP2uiv];
+        if (glad_glMultiTexCoordP3ui == counted_glMultiTexCoordP3ui)
+            glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)Table<>::loaded[ENTRY_glMultiTexCoordP3ui];
+        if (glad_glMultiTexCoordP3uiv == counted_glMultiTexCoordP3uiv)
+            glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)Table<>::loaded[ENTRY_glMultiTexCoordP3uiv];
+        if (glad_glMultiTexCoordP4ui == counted_glMultiTexCoordP4ui)
+            glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)Table<>::loaded[ENTRY_glMultiTexCoordP4ui];
+        if (glad_glMultiTexCoordP4uiv == counted_glMultiTexCoordP4uiv)
+            glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)Table<>::loaded[ENTRY_glMultiTexCoordP4uiv];
+        if (glad_glNormalP3ui == counted_glNormalP3ui)
+            glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)Table<>::loaded[ENTRY_glNormalP3ui];
+        if (glad_glNormalP3uiv == counted_glNormalP3uiv)
+            glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)Table<>::loaded[ENTRY_glNormalP3uiv];
+        if (glad_glColorP3ui == counted_glColorP3ui)
+            glad_glColorP3ui = (PFNGLCOLORP3UIPROC)Table<>::loaded[ENTRY_glColorP3ui];
+        if (glad_glColorP3uiv == counted_glColorP3uiv)
+            glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)Table<>::loaded[ENTRY_glColorP3uiv];
+        if (glad_glColorP4ui == counted_glColorP4ui)
+            glad_glColorP4ui = (PFNGLCOLORP4UIPROC)Table<>::loaded[ENTRY_glColorP4ui];
+        if (glad_glColorP4uiv == counted_glColorP4uiv)
+            glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)Table<>::loaded[ENTRY_glColorP4uiv];
+        if (glad_glSecondaryColorP3ui == counted_glSecondaryColorP3ui)
+            glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)Table<>::loaded[ENTRY_glSecondaryColorP3ui];
+        if (glad_glSecondaryColorP3uiv == counted_glSecondaryColorP3uiv)
+            glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)Table<>::loaded[ENTRY_glSecondaryColorP3uiv];
+    }
+}
+
+#endif
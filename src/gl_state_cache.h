@@ -0,0 +1,133 @@
+#ifndef GL_STATE_CACHE_H
+#define GL_STATE_CACHE_H
+
+#include <glad/glad.h>
+
+#include <cstdint>
+
+#include "gl_verify.h"
+
+// Shadows the bits of GL binding state we change every frame and drops
+// redundant calls. Code that binds behind its back must call invalidate()
+// (or invalidateTextures()) afterwards.
+class GLStateCache
+{
+public:
+    static const int MAX_UNITS = 32;
+
+    struct Stats
+    {
+        uint32_t issued = 0;  // calls that reached GL
+        uint32_t skipped = 0; // redundant calls dropped
+    };
+
+    GLStateCache()
+    {
+        invalidate();
+    }
+
+    // ------------------------------------------------------------------------
+    void useProgram(GLuint program)
+    {
+        if (m_program == program)
+        {
+            m_stats.skipped++;
+            return;
+        }
+        GL_VERIFY(glUseProgram(program));
+        m_program = program;
+        m_stats.issued++;
+    }
+    // ------------------------------------------------------------------------
+    void bindVertexArray(GLuint vertexArray)
+    {
+        if (m_vertexArray == vertexArray)
+        {
+            m_stats.skipped++;
+            return;
+        }
+        GL_VERIFY(glBindVertexArray(vertexArray));
+        m_vertexArray = vertexArray;
+        m_stats.issued++;
+    }
+    // switches the active unit only when the binding actually changes
+    // ------------------------------------------------------------------------
+    void bindTexture(GLuint unit, GLenum target, GLuint texture)
+    {
+        Unit& state = m_units[unit];
+        if (state.target == target && state.texture == texture)
+        {
+            m_stats.skipped++;
+            return;
+        }
+        activeTexture(unit);
+        GL_VERIFY(glBindTexture(target, texture));
+        state.target = target;
+        state.texture = texture;
+        m_stats.issued++;
+    }
+    // ------------------------------------------------------------------------
+    void bindSampler(GLuint unit, GLuint sampler)
+    {
+        Unit& state = m_units[unit];
+        if (state.sampler == sampler)
+        {
+            m_stats.skipped++;
+            return;
+        }
+        GL_VERIFY(glBindSampler(unit, sampler));
+        state.sampler = sampler;
+        m_stats.issued++;
+    }
+    // ------------------------------------------------------------------------
+    void activeTexture(GLuint unit)
+    {
+        if (m_activeUnit == unit)
+            return;
+        GL_VERIFY(glActiveTexture(GL_TEXTURE0 + unit));
+        m_activeUnit = unit;
+        m_stats.issued++;
+    }
+
+    // forget texture bindings, e.g. after a loader bound textures on its own
+    // ------------------------------------------------------------------------
+    void invalidateTextures()
+    {
+        m_activeUnit = UNKNOWN;
+        for (Unit& unit : m_units)
+        {
+            unit.target = 0;
+            unit.texture = UNKNOWN;
+        }
+    }
+    // ------------------------------------------------------------------------
+    void invalidate()
+    {
+        m_program = UNKNOWN;
+        m_vertexArray = UNKNOWN;
+        invalidateTextures();
+        for (Unit& unit : m_units)
+            unit.sampler = UNKNOWN;
+    }
+
+    const Stats& stats() const { return m_stats; }
+    void resetStats() { m_stats = Stats(); }
+
+private:
+    static const GLuint UNKNOWN = 0xffffffff;
+
+    struct Unit
+    {
+        GLenum target;
+        GLuint texture;
+        GLuint sampler;
+    };
+
+    GLuint m_program;
+    GLuint m_vertexArray;
+    GLuint m_activeUnit;
+    Unit m_units[MAX_UNITS];
+    Stats m_stats;
+};
+
+#endif
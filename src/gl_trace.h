@@ -0,0 +1,632 @@
+#ifndef GL_TRACE_H
+#define GL_TRACE_H
+
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <vector>
+#include <string>
+#include <utility>
+#include <algorithm>
+#include <unordered_map>
+
+#include "cpu_profiler.h"
+
+// A GL trace is the command stream of the first N frames of a run: every
+// call that went through glad with its arguments and the client memory it
+// reads (buffer and texture data, uniforms, shader sources, the bytes
+// written to mapped buffers). The generated src/gl_trace_table.h holds a
+// recording wrapper and a replay case per entry point; gl_trace.h has the
+// state both sides need and GLTraceCapture, the part the app uses.
+//
+// File: "GLTR", version byte, glad signature (u32), width and height of the
+// default framebuffer (u32), then varints: frame count, the names of the
+// entry points used (a record's id indexes this table), the names and
+// counts of calls that could not be recorded, and the byte stream. A record
+// is id + 1 followed by its arguments in declaration order, scalars as raw
+// bytes and pointers as a tag (null, buffer offset, payload, scratch); id 0
+// ends a frame. Gets and glIs* are left out, they change no state.
+namespace gltrace
+{
+    enum : uint8_t { FORMAT_VERSION = 1 };
+
+    enum ObjectType : uint8_t
+    {
+        Buffer,
+        Texture,
+        VertexArray,
+        Sampler,
+        Query,
+        Framebuffer,
+        Renderbuffer,
+        Shader,
+        Program,
+        Sync,
+        ObjectTypeCount
+    };
+
+    enum PointerTag : uint8_t
+    {
+        NullPointer = 0,
+        Offset = 1,  // into the bound buffer, the pointer value itself
+        Payload = 2, // client memory, copied into the trace
+        Scratch = 3, // client memory written by GL, replay hands it a scratch buffer
+    };
+
+    // ------------------------------------------------------------------------
+    inline uint32_t formatComponents(GLenum format)
+    {
+        switch (format)
+        {
+        case GL_RED: case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX: return 1;
+        case GL_RG: case GL_RG_INTEGER: case GL_DEPTH_STENCIL: return 2;
+        case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER: return 3;
+        default: return 4;
+        }
+    }
+    // bytes of one pixel
+    inline uint32_t pixelBytes(GLenum format, GLenum type)
+    {
+        switch (type)
+        {
+        case GL_UNSIGNED_BYTE: case GL_BYTE: return formatComponents(format);
+        case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: return 2 * formatComponents(format);
+        case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT: return 4 * formatComponents(format);
+        case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV: return 1;
+        case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV: case GL_UNSIGNED_SHORT_4_4_4_4:
+        case GL_UNSIGNED_SHORT_4_4_4_4_REV: case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV: return 2;
+        case GL_FLOAT_32_UNSIGNED_INT_24_8_REV: return 8;
+        default: return 4; // the packed 32 bit types
+        }
+    }
+    // values a glTexParameter*v / glSamplerParameter*v call reads
+    inline uint32_t parameterCount(GLenum pname)
+    {
+        return pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1;
+    }
+
+    // pixel rows as glPixelStore lays them out
+    struct PixelStore
+    {
+        GLint alignment = 4;
+        GLint rowLength = 0;
+        GLint imageHeight = 0;
+        GLint skipPixels = 0;
+        GLint skipRows = 0;
+        GLint skipImages = 0;
+
+        size_t bytes(GLenum format, GLenum type, GLsizei width, GLsizei height, GLsizei depth) const
+        {
+            if (width <= 0 || height <= 0 || depth <= 0)
+                return 0;
+            size_t pixel = pixelBytes(format, type);
+            size_t rowPixels = rowLength > 0 ? (size_t)rowLength : (size_t)width;
+            size_t row = (rowPixels * pixel + alignment - 1) / alignment * alignment;
+            size_t rows = imageHeight > 0 ? (size_t)imageHeight : (size_t)height;
+            size_t skip = (size_t)skipImages * rows * row + (size_t)skipRows * row + (size_t)skipPixels * pixel;
+            return skip + ((size_t)depth - 1) * rows * row + ((size_t)height - 1) * row + (size_t)width * pixel;
+        }
+        void set(GLenum pname, GLint value, bool pack)
+        {
+            switch (pname - (pack ? GL_PACK_SWAP_BYTES - GL_UNPACK_SWAP_BYTES : 0))
+            {
+            case GL_UNPACK_ALIGNMENT: alignment = std::max(value, 1); break;
+            case GL_UNPACK_ROW_LENGTH: rowLength = value; break;
+            case GL_UNPACK_IMAGE_HEIGHT: imageHeight = value; break;
+            case GL_UNPACK_SKIP_PIXELS: skipPixels = value; break;
+            case GL_UNPACK_SKIP_ROWS: skipRows = value; break;
+            case GL_UNPACK_SKIP_IMAGES: skipImages = value; break;
+            }
+        }
+    };
+
+    // The buffer bound to each target, so a glMapBuffer*/glUnmapBuffer on a
+    // target can be told apart from one on the same target with another
+    // buffer bound in between. The element array binding is per vertex array.
+    class BufferBindings
+    {
+    public:
+        // ------------------------------------------------------------------------
+        void clear()
+        {
+            m_targets.clear();
+            m_elementBuffers.clear();
+            m_vertexArray = 0;
+        }
+        void bind(GLenum target, GLuint buffer)
+        {
+            if (target == GL_ELEMENT_ARRAY_BUFFER)
+                m_elementBuffers[m_vertexArray] = buffer;
+            else
+                m_targets[target] = buffer;
+        }
+        void bindVertexArray(GLuint vertexArray) { m_vertexArray = vertexArray; }
+        GLuint bound(GLenum target) const
+        {
+            const std::unordered_map<GLuint, GLuint>& map = target == GL_ELEMENT_ARRAY_BUFFER ? m_elementBuffers : m_targets;
+            auto it = map.find(target == GL_ELEMENT_ARRAY_BUFFER ? m_vertexArray : target);
+            return it != map.end() ? it->second : 0;
+        }
+        // deleted buffers are unbound from every target and the bound vertex array
+        // ------------------------------------------------------------------------
+        void deleteBuffers(GLsizei count, const GLuint* buffers)
+        {
+            for (GLsizei i = 0; buffers && i < count; i++)
+            {
+                for (auto& binding : m_targets)
+                {
+                    if (binding.second == buffers[i])
+                        binding.second = 0;
+                }
+                if (bound(GL_ELEMENT_ARRAY_BUFFER) == buffers[i])
+                    m_elementBuffers[m_vertexArray] = 0;
+            }
+        }
+        void deleteVertexArrays(GLsizei count, const GLuint* vertexArrays)
+        {
+            for (GLsizei i = 0; vertexArrays && i < count; i++)
+            {
+                m_elementBuffers.erase(vertexArrays[i]);
+                if (vertexArrays[i] == m_vertexArray)
+                    m_vertexArray = 0;
+            }
+        }
+
+    private:
+        std::unordered_map<GLuint, GLuint> m_targets;        // by target
+        std::unordered_map<GLuint, GLuint> m_elementBuffers; // by vertex array
+        GLuint m_vertexArray = 0;
+    };
+
+    // ------------------------------------------------------------------------
+    inline void writeVarint(std::vector<uint8_t>& out, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back((uint8_t)(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back((uint8_t)value);
+    }
+
+    // The capture side, one per process since glad's pointers are too. The
+    // generated wrappers write through it; it also follows the little GL
+    // state that decides how much client memory a call reads and which
+    // buffer a mapping belongs to.
+    class Recorder
+    {
+    public:
+        std::vector<uint8_t> stream;
+        std::vector<uint32_t> fileEntries;     // file id to entry
+        std::vector<uint64_t> unsupportedCalls; // per entry, calls that could not be recorded
+        uint32_t frames = 0;
+
+        // ------------------------------------------------------------------------
+        void reset(uint32_t entryCount)
+        {
+            stream.clear();
+            fileEntries.clear();
+            m_fileIds.assign(entryCount, 0);
+            unsupportedCalls.assign(entryCount, 0);
+            frames = 0;
+            m_unpack = m_pack = PixelStore();
+            m_buffers.clear();
+            m_mappings.clear();
+        }
+
+        // ------------------------------------------------------------------------
+        void begin(uint32_t entry)
+        {
+            if (!m_fileIds[entry])
+            {
+                fileEntries.push_back(entry);
+                m_fileIds[entry] = (uint32_t)fileEntries.size();
+            }
+            writeVarint(stream, m_fileIds[entry]);
+        }
+        void endFrame()
+        {
+            stream.push_back(0);
+            frames++;
+        }
+        void unsupported(uint32_t entry) { unsupportedCalls[entry]++; }
+
+        template<typename T>
+        void value(T v)
+        {
+            const uint8_t* bytes = (const uint8_t*)&v;
+            stream.insert(stream.end(), bytes, bytes + sizeof(T));
+        }
+        void sync(GLsync handle) { value((uint64_t)(uintptr_t)handle); }
+        // ------------------------------------------------------------------------
+        void pointer(const void* data, size_t bytes)
+        {
+            if (!data)
+            {
+                stream.push_back(NullPointer);
+                return;
+            }
+            stream.push_back(Payload);
+            writeVarint(stream, bytes);
+            stream.insert(stream.end(), (const uint8_t*)data, (const uint8_t*)data + bytes);
+        }
+        void offset(const void* data)
+        {
+            stream.push_back(Offset);
+            value((uint64_t)(uintptr_t)data);
+        }
+        void string(const GLchar* text) { pointer(text, text ? strlen(text) + 1 : 0); }
+        // pixels read from client memory, or from the bound unpack buffer
+        void unpackPixels(const void* pixels, GLenum format, GLenum type, GLsizei width, GLsizei height, GLsizei depth)
+        {
+            if (m_buffers.bound(GL_PIXEL_UNPACK_BUFFER))
+                offset(pixels);
+            else
+                pointer(pixels, m_unpack.bytes(format, type, width, height, depth));
+        }
+        void compressedPixels(const void* data, GLsizei imageSize)
+        {
+            if (m_buffers.bound(GL_PIXEL_UNPACK_BUFFER))
+                offset(data);
+            else
+                pointer(data, (size_t)std::max(imageSize, 0));
+        }
+        // pixels GL writes to client memory, or to the bound pack buffer
+        void packPixels(const void* pixels, GLenum format, GLenum type, GLsizei width, GLsizei height)
+        {
+            if (m_buffers.bound(GL_PIXEL_PACK_BUFFER))
+            {
+                offset(pixels);
+                return;
+            }
+            stream.push_back(Scratch);
+            writeVarint(stream, m_pack.bytes(format, type, width, height, 1));
+        }
+        // all strings as one
+        void shaderSource(GLsizei count, const GLchar* const* strings, const GLint* lengths)
+        {
+            std::string source;
+            for (GLsizei i = 0; i < count; i++)
+                source.append(strings[i], lengths && lengths[i] >= 0 ? (size_t)lengths[i] : strlen(strings[i]));
+            pointer(source.c_str(), source.size() + 1);
+        }
+
+        // ------------------------------------------------------------------------
+        void bindBuffer(GLenum target, GLuint buffer) { m_buffers.bind(target, buffer); }
+        void bindVertexArray(GLuint vertexArray) { m_buffers.bindVertexArray(vertexArray); }
+        void deleteBuffers(GLsizei count, const GLuint* buffers)
+        {
+            m_buffers.deleteBuffers(count, buffers);
+            for (GLsizei i = 0; buffers && i < count; i++)
+                m_mappings.erase(buffers[i]); // deleting unmaps
+        }
+        void deleteVertexArrays(GLsizei count, const GLuint* vertexArrays) { m_buffers.deleteVertexArrays(count, vertexArrays); }
+        void pixelStore(GLenum pname, GLint value)
+        {
+            bool pack = pname >= GL_PACK_SWAP_BYTES && pname <= GL_PACK_ALIGNMENT;
+            (pack ? m_pack : m_unpack).set(pname, value, pack);
+        }
+        void mapped(GLenum target, void* data, GLsizeiptr length, GLbitfield access)
+        {
+            if (data && (access & GL_MAP_WRITE_BIT))
+                m_mappings[m_buffers.bound(target)] = std::make_pair((uint8_t*)data, (size_t)length);
+        }
+        // what the app wrote to the mapping, recorded before the unmap
+        void unmapped(GLenum target)
+        {
+            auto it = m_mappings.find(m_buffers.bound(target));
+            if (it == m_mappings.end())
+            {
+                stream.push_back(NullPointer);
+                return;
+            }
+            pointer(it->second.first, it->second.second);
+            m_mappings.erase(it);
+        }
+
+    private:
+        std::vector<uint32_t> m_fileIds; // per entry, 0 before its first call
+        PixelStore m_unpack;
+        PixelStore m_pack;
+        BufferBindings m_buffers;
+        std::unordered_map<GLuint, std::pair<uint8_t*, size_t>> m_mappings; // by buffer
+    };
+
+    // ------------------------------------------------------------------------
+    inline Recorder& recorder()
+    {
+        static Recorder instance;
+        return instance;
+    }
+
+    // Reads one frame's records back. Out of data, every read returns zeros
+    // and failed() says so.
+    class Reader
+    {
+    public:
+        Reader(const uint8_t* data, size_t size) : m_cursor(data), m_end(data + size) {}
+
+        // ------------------------------------------------------------------------
+        uint64_t varint()
+        {
+            uint64_t value = 0;
+            for (int shift = 0; shift < 64; shift += 7)
+            {
+                if (m_cursor == m_end)
+                    break;
+                uint8_t byte = *m_cursor++;
+                value |= (uint64_t)(byte & 0x7f) << shift;
+                if (!(byte & 0x80))
+                    return value;
+            }
+            m_failed = true;
+            return 0;
+        }
+        template<typename T>
+        T value()
+        {
+            T v;
+            if ((size_t)(m_end - m_cursor) < sizeof(T))
+            {
+                m_failed = true;
+                memset(&v, 0, sizeof(T));
+                return v;
+            }
+            memcpy(&v, m_cursor, sizeof(T));
+            m_cursor += sizeof(T);
+            return v;
+        }
+        // a recorded pointer as something to pass to GL, lastSize() bytes
+        // ------------------------------------------------------------------------
+        const void* pointer()
+        {
+            m_lastSize = 0;
+            uint8_t tag = value<uint8_t>();
+            if (tag == Offset)
+                return (const void*)(uintptr_t)value<uint64_t>();
+            if (tag != Payload && tag != Scratch)
+                return nullptr;
+            uint64_t size = varint();
+            if (tag == Scratch)
+            {
+                m_scratch.resize((size_t)size);
+                m_lastSize = (size_t)size;
+                return m_scratch.data();
+            }
+            if ((uint64_t)(m_end - m_cursor) < size)
+            {
+                m_failed = true;
+                return nullptr;
+            }
+            const uint8_t* data = m_cursor;
+            m_cursor += size;
+            m_lastSize = (size_t)size;
+            return data;
+        }
+        size_t lastSize() const { return m_lastSize; }
+
+        bool atEnd() const { return m_cursor == m_end; }
+        size_t remaining() const { return (size_t)(m_end - m_cursor); }
+        bool failed() const { return m_failed; }
+
+    private:
+        const uint8_t* m_cursor;
+        const uint8_t* m_end;
+        std::vector<uint8_t> m_scratch;
+        size_t m_lastSize = 0;
+        bool m_failed = false;
+    };
+
+    // The replay side: object names of the capture to the ones GL gave this
+    // run, the mappings, and the time spent in each entry point.
+    class Replayer
+    {
+    public:
+        std::vector<uint64_t> calls;       // per entry
+        std::vector<uint64_t> nanoseconds; // per entry, inside the GL call
+        uint64_t missingCalls = 0;         // entry points this context does not have
+
+        explicit Replayer(uint32_t entryCount, GLuint defaultFramebuffer = 0)
+            : calls(entryCount, 0), nanoseconds(entryCount, 0), m_defaultFramebuffer(defaultFramebuffer)
+        {
+        }
+
+        // ------------------------------------------------------------------------
+        void beginCall() { m_callStart = profilerNanoseconds(); }
+        void endCall(uint32_t entry)
+        {
+            nanoseconds[entry] += profilerNanoseconds() - m_callStart;
+            calls[entry]++;
+        }
+        void missing() { missingCalls++; }
+
+        // 0 stays 0, except the default framebuffer, which is an FBO here
+        // ------------------------------------------------------------------------
+        GLuint object(ObjectType type, GLuint captured) const
+        {
+            if (captured == 0)
+                return type == Framebuffer ? m_defaultFramebuffer : 0;
+            auto it = m_objects[type].find(captured);
+            return it != m_objects[type].end() ? it->second : captured;
+        }
+        void bindObject(ObjectType type, GLuint captured, GLuint replayed) { m_objects[type][captured] = replayed; }
+        // GLuint arrays of glGen* and glDelete*
+        GLuint* objects(ObjectType type, const GLuint* captured, GLsizei count)
+        {
+            m_names.resize((size_t)std::max(count, 0));
+            for (GLsizei i = 0; i < count; i++)
+                m_names[i] = captured ? object(type, captured[i]) : 0;
+            return m_names.data();
+        }
+        GLuint* names(GLsizei count)
+        {
+            m_names.assign((size_t)std::max(count, 0), 0);
+            return m_names.data();
+        }
+        void bindObjects(ObjectType type, const GLuint* captured, const GLuint* replayed, GLsizei count)
+        {
+            for (GLsizei i = 0; captured && i < count; i++)
+                bindObject(type, captured[i], replayed[i]);
+        }
+
+        // ------------------------------------------------------------------------
+        GLsync sync(uint64_t captured) const
+        {
+            auto it = m_syncs.find(captured);
+            return it != m_syncs.end() ? it->second : nullptr;
+        }
+        void bindSync(uint64_t captured, GLsync replayed) { m_syncs[captured] = replayed; }
+
+        // uniform locations are per program, glUseProgram picks the table
+        // ------------------------------------------------------------------------
+        void useProgram(GLuint captured) { m_program = captured; }
+        GLint location(GLint captured) const
+        {
+            auto it = m_locations.find(((uint64_t)m_program << 32) | (uint32_t)captured);
+            return it != m_locations.end() ? it->second : captured;
+        }
+        void bindLocation(GLuint program, GLint captured, GLint replayed)
+        {
+            m_locations[((uint64_t)program << 32) | (uint32_t)captured] = replayed;
+        }
+
+        // mappings by buffer like the recorder, in the names of this run
+        // ------------------------------------------------------------------------
+        void bindBuffer(GLenum target, GLuint buffer) { m_buffers.bind(target, buffer); }
+        void bindVertexArray(GLuint vertexArray) { m_buffers.bindVertexArray(vertexArray); }
+        void deleteBuffers(GLsizei count, const GLuint* buffers)
+        {
+            m_buffers.deleteBuffers(count, buffers);
+            for (GLsizei i = 0; buffers && i < count; i++)
+                m_mappings.erase(buffers[i]);
+        }
+        void deleteVertexArrays(GLsizei count, const GLuint* vertexArrays) { m_buffers.deleteVertexArrays(count, vertexArrays); }
+        void mapped(GLenum target, void* data) { m_mappings[m_buffers.bound(target)] = (uint8_t*)data; }
+        void unmapped(GLenum target, const void* data, size_t size)
+        {
+            auto it = m_mappings.find(m_buffers.bound(target));
+            if (it == m_mappings.end())
+                return;
+            if (it->second && data)
+                memcpy(it->second, data, size);
+            m_mappings.erase(it);
+        }
+
+    private:
+        GLuint m_defaultFramebuffer;
+        std::unordered_map<GLuint, GLuint> m_objects[ObjectTypeCount];
+        std::unordered_map<uint64_t, GLsync> m_syncs;
+        std::unordered_map<uint64_t, GLint> m_locations;
+        BufferBindings m_buffers;
+        std::unordered_map<GLuint, uint8_t*> m_mappings; // by buffer
+        std::vector<GLuint> m_names;
+        GLuint m_program = 0;
+        uint64_t m_callStart = 0;
+    };
+}
+
+#include "gl_trace_table.h"
+
+// Records the GL calls of the next `frames` frames into a trace file. Start
+// it right after gladLoadGL*(), before any other GL call, so the objects
+// later frames use are created inside the trace; replay with
+// tools/gl_replay. Calls to functions loaded past glad are not seen, so
+// anything like TextureStorageSupport should stay off while capturing.
+class GLTraceCapture
+{
+public:
+    GLTraceCapture() {}
+    ~GLTraceCapture()
+    {
+        if (m_capturing)
+            gltrace::uninstall();
+    }
+    GLTraceCapture(const GLTraceCapture&) = delete;
+    GLTraceCapture& operator=(const GLTraceCapture&) = delete;
+
+    // ------------------------------------------------------------------------
+    void start(const char* path, uint32_t frames)
+    {
+        if (m_capturing || frames == 0)
+            return;
+        GLint viewport[4] = { 0, 0, 0, 0 };
+        glGetIntegerv(GL_VIEWPORT, viewport);
+        m_width = (uint32_t)viewport[2];
+        m_height = (uint32_t)viewport[3];
+        m_path = path;
+        m_frames = frames;
+        gltrace::recorder().reset(gltrace::ENTRY_COUNT);
+        gltrace::install();
+        m_capturing = true;
+    }
+    // after each frame's last GL call; true once the file was written
+    // ------------------------------------------------------------------------
+    bool endFrame()
+    {
+        if (!m_capturing)
+            return false;
+        gltrace::Recorder& recorder = gltrace::recorder();
+        recorder.endFrame();
+        if (recorder.frames < m_frames)
+            return false;
+        gltrace::uninstall();
+        m_capturing = false;
+        m_written = write(recorder);
+        recorder.reset(0);
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    bool capturing() const { return m_capturing; }
+    bool written() const { return m_written; }
+
+private:
+    std::string m_path;
+    uint32_t m_frames = 0;
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;
+    bool m_capturing = false;
+    bool m_written = false;
+
+    // ------------------------------------------------------------------------
+    bool write(const gltrace::Recorder& recorder) const
+    {
+        std::vector<uint8_t> header = { 'G', 'L', 'T', 'R', gltrace::FORMAT_VERSION };
+        uint32_t words[3] = { gltrace::GLAD_SIGNATURE, m_width, m_height };
+        header.insert(header.end(), (const uint8_t*)words, (const uint8_t*)words + sizeof(words));
+        gltrace::writeVarint(header, recorder.frames);
+        gltrace::writeVarint(header, recorder.fileEntries.size());
+        for (uint32_t entry : recorder.fileEntries)
+            writeName(header, gltrace::entryName(entry));
+        std::vector<uint32_t> unsupported;
+        for (uint32_t entry = 0; entry < recorder.unsupportedCalls.size(); entry++)
+        {
+            if (recorder.unsupportedCalls[entry])
+                unsupported.push_back(entry);
+        }
+        gltrace::writeVarint(header, unsupported.size());
+        for (uint32_t entry : unsupported)
+        {
+            writeName(header, gltrace::entryName(entry));
+            gltrace::writeVarint(header, recorder.unsupportedCalls[entry]);
+        }
+        gltrace::writeVarint(header, recorder.stream.size());
+
+        FILE* file = fopen(m_path.c_str(), "wb");
+        if (!file)
+            return false;
+        bool ok = fwrite(header.data(), 1, header.size(), file) == header.size() &&
+            fwrite(recorder.stream.data(), 1, recorder.stream.size(), file) == recorder.stream.size();
+        return fclose(file) == 0 && ok;
+    }
+    static void writeName(std::vector<uint8_t>& out, const char* name)
+    {
+        size_t length = strlen(name);
+        gltrace::writeVarint(out, length);
+        out.insert(out.end(), name, name + length);
+    }
+};
+
+#endif
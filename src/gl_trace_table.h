@@ -0,0 +1,17630 @@
+// Generated by tools/gen_gl_trace_table.py from GLAD/include/glad/glad.h,
+// do not edit. Included by gl_trace.h.
+#ifndef GL_TRACE_TABLE_H
+#define GL_TRACE_TABLE_H
+
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <algorithm>
+
+namespace gltrace
+{
+    enum : uint32_t { GLAD_SIGNATURE = 0x4aa24ed5u };
+
+    enum Entry : uint32_t
+    {
+        ENTRY_glCullFace,
+        ENTRY_glFrontFace,
+        ENTRY_glHint,
+        ENTRY_glLineWidth,
+        ENTRY_glPointSize,
+        ENTRY_glPolygonMode,
+        ENTRY_glScissor,
+        ENTRY_glTexParameterf,
+        ENTRY_glTexParameterfv,
+        ENTRY_glTexParameteri,
+        ENTRY_glTexParameteriv,
+        ENTRY_glTexImage1D,
+        ENTRY_glTexImage2D,
+        ENTRY_glDrawBuffer,
+        ENTRY_glClear,
+        ENTRY_glClearColor,
+        ENTRY_glClearStencil,
+        ENTRY_glClearDepth,
+        ENTRY_glStencilMask,
+        ENTRY_glColorMask,
+        ENTRY_glDepthMask,
+        ENTRY_glDisable,
+        ENTRY_glEnable,
+        ENTRY_glFinish,
+        ENTRY_glFlush,
+        ENTRY_glBlendFunc,
+        ENTRY_glLogicOp,
+        ENTRY_glStencilFunc,
+        ENTRY_glStencilOp,
+        ENTRY_glDepthFunc,
+        ENTRY_glPixelStoref,
+        ENTRY_glPixelStorei,
+        ENTRY_glReadBuffer,
+        ENTRY_glReadPixels,
+        ENTRY_glGetBooleanv,
+        ENTRY_glGetDoublev,
+        ENTRY_glGetError,
+        ENTRY_glGetFloatv,
+        ENTRY_glGetIntegerv,
+        ENTRY_glGetString,
+        ENTRY_glGetTexImage,
+        ENTRY_glGetTexParameterfv,
+        ENTRY_glGetTexParameteriv,
+        ENTRY_glGetTexLevelParameterfv,
+        ENTRY_glGetTexLevelParameteriv,
+        ENTRY_glIsEnabled,
+        ENTRY_glDepthRange,
+        ENTRY_glViewport,
+        ENTRY_glNewList,
+        ENTRY_glEndList,
+        ENTRY_glCallList,
+        ENTRY_glCallLists,
+        ENTRY_glDeleteLists,
+        ENTRY_glGenLists,
+        ENTRY_glListBase,
+        ENTRY_glBegin,
+        ENTRY_glBitmap,
+        ENTRY_glColor3b,
+        ENTRY_glColor3bv,
+        ENTRY_glColor3d,
+        ENTRY_glColor3dv,
+        ENTRY_glColor3f,
+        ENTRY_glColor3fv,
+        ENTRY_glColor3i,
+        ENTRY_glColor3iv,
+        ENTRY_glColor3s,
+        ENTRY_glColor3sv,
+        ENTRY_glColor3ub,
+        ENTRY_glColor3ubv,
+        ENTRY_glColor3ui,
+        ENTRY_glColor3uiv,
+        ENTRY_glColor3us,
+        ENTRY_glColor3usv,
+        ENTRY_glColor4b,
+        ENTRY_glColor4bv,
+        ENTRY_glColor4d,
+        ENTRY_glColor4dv,
+        ENTRY_glColor4f,
+        ENTRY_glColor4fv,
+        ENTRY_glColor4i,
+        ENTRY_glColor4iv,
+        ENTRY_glColor4s,
+        ENTRY_glColor4sv,
+        ENTRY_glColor4ub,
+        ENTRY_glColor4ubv,
+        ENTRY_glColor4ui,
+        ENTRY_glColor4uiv,
+        ENTRY_glColor4us,
+        ENTRY_glColor4usv,
+        ENTRY_glEdgeFlag,
+        ENTRY_glEdgeFlagv,
+        ENTRY_glEnd,
+        ENTRY_glIndexd,
+        ENTRY_glIndexdv,
+        ENTRY_glIndexf,
+        ENTRY_glIndexfv,
+        ENTRY_glIndexi,
+        ENTRY_glIndexiv,
+        ENTRY_glIndexs,
+        ENTRY_glIndexsv,
+        ENTRY_glNormal3b,
+        ENTRY_glNormal3bv,
+        ENTRY_glNormal3d,
+        ENTRY_glNormal3dv,
+        ENTRY_glNormal3f,
+        ENTRY_glNormal3fv,
+        ENTRY_glNormal3i,
+        ENTRY_glNormal3iv,
+        ENTRY_glNormal3s,
+        ENTRY_glNormal3sv,
+        ENTRY_glRasterPos2d,
+        ENTRY_glRasterPos2dv,
+        ENTRY_glRasterPos2f,
+        ENTRY_glRasterPos2fv,
+        ENTRY_glRasterPos2i,
+        ENTRY_glRasterPos2iv,
+        ENTRY_glRasterPos2s,
+        ENTRY_glRasterPos2sv,
+        ENTRY_glRasterPos3d,
+        ENTRY_glRasterPos3dv,
+        ENTRY_glRasterPos3f,
+        ENTRY_glRasterPos3fv,
+        ENTRY_glRasterPos3i,
+        ENTRY_glRasterPos3iv,
+        ENTRY_glRasterPos3s,
+        ENTRY_glRasterPos3sv,
+        ENTRY_glRasterPos4d,
+        ENTRY_glRasterPos4dv,
+        ENTRY_glRasterPos4f,
+        ENTRY_glRasterPos4fv,
+        ENTRY_glRasterPos4i,
+        ENTRY_glRasterPos4iv,
+        ENTRY_glRasterPos4s,
+        ENTRY_glRasterPos4sv,
+        ENTRY_glRectd,
+        ENTRY_glRectdv,
+        ENTRY_glRectf,
+        ENTRY_glRectfv,
+        ENTRY_glRecti,
+        ENTRY_glRectiv,
+        ENTRY_glRects,
+        ENTRY_glRectsv,
+        ENTRY_glTexCoord1d,
+        ENTRY_glTexCoord1dv,
+        ENTRY_glTexCoord1f,
+        ENTRY_glTexCoord1fv,
+        ENTRY_glTexCoord1i,
+        ENTRY_glTexCoord1iv,
+        ENTRY_glTexCoord1s,
+        ENTRY_glTexCoord1sv,
+        ENTRY_glTexCoord2d,
+        ENTRY_glTexCoord2dv,
+        ENTRY_glTexCoord2f,
+        ENTRY_glTexCoord2fv,
+        ENTRY_glTexCoord2i,
+        ENTRY_glTexCoord2iv,
+        ENTRY_glTexCoord2s,
+        ENTRY_glTexCoord2sv,
+        ENTRY_glTexCoord3d,
+        ENTRY_glTexCoord3dv,
+        ENTRY_glTexCoord3f,
+        ENTRY_glTexCoord3fv,
+        ENTRY_glTexCoord3i,
+        ENTRY_glTexCoord3iv,
+        ENTRY_glTexCoord3s,
+        ENTRY_glTexCoord3sv,
+        ENTRY_glTexCoord4d,
+        ENTRY_glTexCoord4dv,
+        ENTRY_glTexCoord4f,
+        ENTRY_glTexCoord4fv,
+        ENTRY_glTexCoord4i,
+        ENTRY_glTexCoord4iv,
+        ENTRY_glTexCoord4s,
+        ENTRY_glTexCoord4sv,
+        ENTRY_glVertex2d,
+        ENTRY_glVertex2dv,
+        ENTRY_glVertex2f,
+        ENTRY_glVertex2fv,
+        ENTRY_glVertex2i,
+        ENTRY_glVertex2iv,
+        ENTRY_glVertex2s,
+        ENTRY_glVertex2sv,
+        ENTRY_glVertex3d,
+        ENTRY_glVertex3dv,
+        ENTRY_glVertex3f,
+        ENTRY_glVertex3fv,
+        ENTRY_glVertex3i,
+        ENTRY_glVertex3iv,
+        ENTRY_glVertex3s,
+        ENTRY_glVertex3sv,
+        ENTRY_glVertex4d,
+        ENTRY_glVertex4dv,
+        ENTRY_glVertex4f,
+        ENTRY_glVertex4fv,
+        ENTRY_glVertex4i,
+        ENTRY_glVertex4iv,
+        ENTRY_glVertex4s,
+        ENTRY_glVertex4sv,
+        ENTRY_glClipPlane,
+        ENTRY_glColorMaterial,
+        ENTRY_glFogf,
+        ENTRY_glFogfv,
+        ENTRY_glFogi,
+        ENTRY_glFogiv,
+        ENTRY_glLightf,
+        ENTRY_glLightfv,
+        ENTRY_glLighti,
+        ENTRY_glLightiv,
+        ENTRY_glLightModelf,
+        ENTRY_glLightModelfv,
+        ENTRY_glLightModeli,
+        ENTRY_glLightModeliv,
+        ENTRY_glLineStipple,
+        ENTRY_glMaterialf,
+        ENTRY_glMaterialfv,
+        ENTRY_glMateriali,
+        ENTRY_glMaterialiv,
+        ENTRY_glPolygonStipple,
+        ENTRY_glShadeModel,
+        ENTRY_glTexEnvf,
+        ENTRY_glTexEnvfv,
+        ENTRY_glTexEnvi,
+        ENTRY_glTexEnviv,
+        ENTRY_glTexGend,
+        ENTRY_glTexGendv,
+        ENTRY_glTexGenf,
+        ENTRY_glTexGenfv,
+        ENTRY_glTexGeni,
+        ENTRY_glTexGeniv,
+        ENTRY_glFeedbackBuffer,
+        ENTRY_glSelectBuffer,
+        ENTRY_glRenderMode,
+        ENTRY_glInitNames,
+        ENTRY_glLoadName,
+        ENTRY_glPassThrough,
+        ENTRY_glPopName,
+        ENTRY_glPushName,
+        ENTRY_glClearAccum,
+        ENTRY_glClearIndex,
+        ENTRY_glIndexMask,
+        ENTRY_glAccum,
+        ENTRY_glPopAttrib,
+        ENTRY_glPushAttrib,
+        ENTRY_glMap1d,
+        ENTRY_glMap1f,
+        ENTRY_glMap2d,
+        ENTRY_glMap2f,
+        ENTRY_glMapGrid1d,
+        ENTRY_glMapGrid1f,
+        ENTRY_glMapGrid2d,
+        ENTRY_glMapGrid2f,
+        ENTRY_glEvalCoord1d,
+        ENTRY_glEvalCoord1dv,
+        ENTRY_glEvalCoord1f,
+        ENTRY_glEvalCoord1fv,
+        ENTRY_glEvalCoord2d,
+        ENTRY_glEvalCoord2dv,
+        ENTRY_glEvalCoord2f,
+        ENTRY_glEvalCoord2fv,
+        ENTRY_glEvalMesh1,
+        ENTRY_glEvalPoint1,
+        ENTRY_glEvalMesh2,
+        ENTRY_glEvalPoint2,
+        ENTRY_glAlphaFunc,
+        ENTRY_glPixelZoom,
+        ENTRY_glPixelTransferf,
+        ENTRY_glPixelTransferi,
+        ENTRY_glPixelMapfv,
+        ENTRY_glPixelMapuiv,
+        ENTRY_glPixelMapusv,
+        ENTRY_glCopyPixels,
+        ENTRY_glDrawPixels,
+        ENTRY_glGetClipPlane,
+        ENTRY_glGetLightfv,
+        ENTRY_glGetLightiv,
+        ENTRY_glGetMapdv,
+        ENTRY_glGetMapfv,
+        ENTRY_glGetMapiv,
+        ENTRY_glGetMaterialfv,
+        ENTRY_glGetMaterialiv,
+        ENTRY_glGetPixelMapfv,
+        ENTRY_glGetPixelMapuiv,
+        ENTRY_glGetPixelMapusv,
+        ENTRY_glGetPolygonStipple,
+        ENTRY_glGetTexEnvfv,
+        ENTRY_glGetTexEnviv,
+        ENTRY_glGetTexGendv,
+        ENTRY_glGetTexGenfv,
+        ENTRY_glGetTexGeniv,
+        ENTRY_glIsList,
+        ENTRY_glFrustum,
+        ENTRY_glLoadIdentity,
+        ENTRY_glLoadMatrixf,
+        ENTRY_glLoadMatrixd,
+        ENTRY_glMatrixMode,
+        ENTRY_glMultMatrixf,
+        ENTRY_glMultMatrixd,
+        ENTRY_glOrtho,
+        ENTRY_glPopMatrix,
+        ENTRY_glPushMatrix,
+        ENTRY_glRotated,
+        ENTRY_glRotatef,
+        ENTRY_glScaled,
+        ENTRY_glScalef,
+        ENTRY_glTranslated,
+        ENTRY_glTranslatef,
+        ENTRY_glDrawArrays,
+        ENTRY_glDrawElements,
+        ENTRY_glGetPointerv,
+        ENTRY_glPolygonOffset,
+        ENTRY_glCopyTexImage1D,
+        ENTRY_glCopyTexImage2D,
+        ENTRY_glCopyTexSubImage1D,
+        ENTRY_glCopyTexSubImage2D,
+        ENTRY_glTexSubImage1D,
+        ENTRY_glTexSubImage2D,
+        ENTRY_glBindTexture,
+        ENTRY_glDeleteTextures,
+        ENTRY_glGenTextures,
+        ENTRY_glIsTexture,
+        ENTRY_glArrayElement,
+        ENTRY_glColorPointer,
+        ENTRY_glDisableClientState,
+        ENTRY_glEdgeFlagPointer,
+        ENTRY_glEnableClientState,
+        ENTRY_glIndexPointer,
+        ENTRY_glInterleavedArrays,
+        ENTRY_glNormalPointer,
+        ENTRY_glTexCoordPointer,
+        ENTRY_glVertexPointer,
+        ENTRY_glAreTexturesResident,
+        ENTRY_glPrioritizeTextures,
+        ENTRY_glIndexub,
+        ENTRY_glIndexubv,
+        ENTRY_glPopClientAttrib,
+        ENTRY_glPushClientAttrib,
+        ENTRY_glDrawRangeElements,
+        ENTRY_glTexImage3D,
+        ENTRY_glTexSubImage3D,
+        ENTRY_glCopyTexSubImage3D,
+        ENTRY_glActiveTexture,
+        ENTRY_glSampleCoverage,
+        ENTRY_glCompressedTexImage3D,
+        ENTRY_glCompressedTexImage2D,
+        ENTRY_glCompressedTexImage1D,
+        ENTRY_glCompressedTexSubImage3D,
+        ENTRY_glCompressedTexSubImage2D,
+        ENTRY_glCompressedTexSubImage1D,
+        ENTRY_glGetCompressedTexImage,
+        ENTRY_glClientActiveTexture,
+        ENTRY_glMultiTexCoord1d,
+        ENTRY_glMultiTexCoord1dv,
+        ENTRY_glMultiTexCoord1f,
+        ENTRY_glMultiTexCoord1fv,
+        ENTRY_glMultiTexCoord1i,
+        ENTRY_glMultiTexCoord1iv,
+        ENTRY_glMultiTexCoord1s,
+        ENTRY_glMultiTexCoord1sv,
+        ENTRY_glMultiTexCoord2d,
+        ENTRY_glMultiTexCoord2dv,
+        ENTRY_glMultiTexCoord2f,
+        ENTRY_glMultiTexCoord2fv,
+        ENTRY_glMultiTexCoord2i,
+        ENTRY_glMultiTexCoord2iv,
+        ENTRY_glMultiTexCoord2s,
+        ENTRY_glMultiTexCoord2sv,
+        ENTRY_glMultiTexCoord3d,
+        ENTRY_glMultiTexCoord3dv,
+        ENTRY_glMultiTexCoord3f,
+        ENTRY_glMultiTexCoord3fv,
+        ENTRY_glMultiTexCoord3i,
+        ENTRY_glMultiTexCoord3iv,
+        ENTRY_glMultiTexCoord3s,
+        ENTRY_glMultiTexCoord3sv,
+        ENTRY_glMultiTexCoord4d,
+        ENTRY_glMultiTexCoord4dv,
+        ENTRY_glMultiTexCoord4f,
+        ENTRY_glMultiTexCoord4fv,
+        ENTRY_glMultiTexCoord4i,
+        ENTRY_glMultiTexCoord4iv,
+        ENTRY_glMultiTexCoord4s,
+        ENTRY_glMultiTexCoord4sv,
+        ENTRY_glLoadTransposeMatrixf,
+        ENTRY_glLoadTransposeMatrixd,
+        ENTRY_glMultTransposeMatrixf,
+        ENTRY_glMultTransposeMatrixd,
+        ENTRY_glBlendFuncSeparate,
+        ENTRY_glMultiDrawArrays,
+        ENTRY_glMultiDrawElements,
+        ENTRY_glPointParameterf,
+        ENTRY_glPointParameterfv,
+        ENTRY_glPointParameteri,
+        ENTRY_glPointParameteriv,
+        ENTRY_glFogCoordf,
+        ENTRY_glFogCoordfv,
+        ENTRY_glFogCoordd,
+        ENTRY_glFogCoorddv,
+        ENTRY_glFogCoordPointer,
+        ENTRY_glSecondaryColor3b,
+        ENTRY_glSecondaryColor3bv,
+        ENTRY_glSecondaryColor3d,
+        ENTRY_glSecondaryColor3dv,
+        ENTRY_glSecondaryColor3f,
+        ENTRY_glSecondaryColor3fv,
+        ENTRY_glSecondaryColor3i,
+        ENTRY_glSecondaryColor3iv,
+        ENTRY_glSecondaryColor3s,
+        ENTRY_glSecondaryColor3sv,
+        ENTRY_glSecondaryColor3ub,
+        ENTRY_glSecondaryColor3ubv,
+        ENTRY_glSecondaryColor3ui,
+        ENTRY_glSecondaryColor3uiv,
+        ENTRY_glSecondaryColor3us,
+        ENTRY_glSecondaryColor3usv,
+        ENTRY_glSecondaryColorPointer,
+        ENTRY_glWindowPos2d,
+        ENTRY_glWindowPos2dv,
+        ENTRY_glWindowPos2f,
+        ENTRY_glWindowPos2fv,
+        ENTRY_glWindowPos2i,
+        ENTRY_glWindowPos2iv,
+        ENTRY_glWindowPos2s,
+        ENTRY_glWindowPos2sv,
+        ENTRY_glWindowPos3d,
+        ENTRY_glWindowPos3dv,
+        ENTRY_glWindowPos3f,
+        ENTRY_glWindowPos3fv,
+        ENTRY_glWindowPos3i,
+        ENTRY_glWindowPos3iv,
+        ENTRY_glWindowPos3s,
+        ENTRY_glWindowPos3sv,
+        ENTRY_glBlendColor,
+        ENTRY_glBlendEquation,
+        ENTRY_glGenQueries,
+        ENTRY_glDeleteQueries,
+        ENTRY_glIsQuery,
+        ENTRY_glBeginQuery,
+        ENTRY_glEndQuery,
+        ENTRY_glGetQueryiv,
+        ENTRY_glGetQueryObjectiv,
+        ENTRY_glGetQueryObjectuiv,
+        ENTRY_glBindBuffer,
+        ENTRY_glDeleteBuffers,
+        ENTRY_glGenBuffers,
+        ENTRY_glIsBuffer,
+        ENTRY_glBufferData,
+        ENTRY_glBufferSubData,
+        ENTRY_glGetBufferSubData,
+        ENTRY_glMapBuffer,
+        ENTRY_glUnmapBuffer,
+        ENTRY_glGetBufferParameteriv,
+        ENTRY_glGetBufferPointerv,
+        ENTRY_glBlendEquationSeparate,
+        ENTRY_glDrawBuffers,
+        ENTRY_glStencilOpSeparate,
+        ENTRY_glStencilFuncSeparate,
+        ENTRY_glStencilMaskSeparate,
+        ENTRY_glAttachShader,
+        ENTRY_glBindAttribLocation,
+        ENTRY_glCompileShader,
+        ENTRY_glCreateProgram,
+        ENTRY_glCreateShader,
+        ENTRY_glDeleteProgram,
+        ENTRY_glDeleteShader,
+        ENTRY_glDetachShader,
+        ENTRY_glDisableVertexAttribArray,
+        ENTRY_glEnableVertexAttribArray,
+        ENTRY_glGetActiveAttrib,
+        ENTRY_glGetActiveUniform,
+        ENTRY_glGetAttachedShaders,
+        ENTRY_glGetAttribLocation,
+        ENTRY_glGetProgramiv,
+        ENTRY_glGetProgramInfoLog,
+        ENTRY_glGetShaderiv,
+        ENTRY_glGetShaderInfoLog,
+        ENTRY_glGetShaderSource,
+        ENTRY_glGetUniformLocation,
+        ENTRY_glGetUniformfv,
+        ENTRY_glGetUniformiv,
+        ENTRY_glGetVertexAttribdv,
+        ENTRY_glGetVertexAttribfv,
+        ENTRY_glGetVertexAttribiv,
+        ENTRY_glGetVertexAttribPointerv,
+        ENTRY_glIsProgram,
+        ENTRY_glIsShader,
+        ENTRY_glLinkProgram,
+        ENTRY_glShaderSource,
+        ENTRY_glUseProgram,
+        ENTRY_glUniform1f,
+        ENTRY_glUniform2f,
+        ENTRY_glUniform3f,
+        ENTRY_glUniform4f,
+        ENTRY_glUniform1i,
+        ENTRY_glUniform2i,
+        ENTRY_glUniform3i,
+        ENTRY_glUniform4i,
+        ENTRY_glUniform1fv,
+        ENTRY_glUniform2fv,
+        ENTRY_glUniform3fv,
+        ENTRY_glUniform4fv,
+        ENTRY_glUniform1iv,
+        ENTRY_glUniform2iv,
+        ENTRY_glUniform3iv,
+        ENTRY_glUniform4iv,
+        ENTRY_glUniformMatrix2fv,
+        ENTRY_glUniformMatrix3fv,
+        ENTRY_glUniformMatrix4fv,
+        ENTRY_glValidateProgram,
+        ENTRY_glVertexAttrib1d,
+        ENTRY_glVertexAttrib1dv,
+        ENTRY_glVertexAttrib1f,
+        ENTRY_glVertexAttrib1fv,
+        ENTRY_glVertexAttrib1s,
+        ENTRY_glVertexAttrib1sv,
+        ENTRY_glVertexAttrib2d,
+        ENTRY_glVertexAttrib2dv,
+        ENTRY_glVertexAttrib2f,
+        ENTRY_glVertexAttrib2fv,
+        ENTRY_glVertexAttrib2s,
+        ENTRY_glVertexAttrib2sv,
+        ENTRY_glVertexAttrib3d,
+        ENTRY_glVertexAttrib3dv,
+        ENTRY_glVertexAttrib3f,
+        ENTRY_glVertexAttrib3fv,
+        ENTRY_glVertexAttrib3s,
+        ENTRY_glVertexAttrib3sv,
+        ENTRY_glVertexAttrib4Nbv,
+        ENTRY_glVertexAttrib4Niv,
+        ENTRY_glVertexAttrib4Nsv,
+        ENTRY_glVertexAttrib4Nub,
+        ENTRY_glVertexAttrib4Nubv,
+        ENTRY_glVertexAttrib4Nuiv,
+        ENTRY_glVertexAttrib4Nusv,
+        ENTRY_glVertexAttrib4bv,
+        ENTRY_glVertexAttrib4d,
+        ENTRY_glVertexAttrib4dv,
+        ENTRY_glVertexAttrib4f,
+        ENTRY_glVertexAttrib4fv,
+        ENTRY_glVertexAttrib4iv,
+        ENTRY_glVertexAttrib4s,
+        ENTRY_glVertexAttrib4sv,
+        ENTRY_glVertexAttrib4ubv,
+        ENTRY_glVertexAttrib4uiv,
+        ENTRY_glVertexAttrib4usv,
+        ENTRY_glVertexAttribPointer,
+        ENTRY_glUniformMatrix2x3fv,
+        ENTRY_glUniformMatrix3x2fv,
+        ENTRY_glUniformMatrix2x4fv,
+        ENTRY_glUniformMatrix4x2fv,
+        ENTRY_glUniformMatrix3x4fv,
+        ENTRY_glUniformMatrix4x3fv,
+        ENTRY_glColorMaski,
+        ENTRY_glGetBooleani_v,
+        ENTRY_glGetIntegeri_v,
+        ENTRY_glEnablei,
+        ENTRY_glDisablei,
+        ENTRY_glIsEnabledi,
+        ENTRY_glBeginTransformFeedback,
+        ENTRY_glEndTransformFeedback,
+        ENTRY_glBindBufferRange,
+        ENTRY_glBindBufferBase,
+        ENTRY_glTransformFeedbackVaryings,
+        ENTRY_glGetTransformFeedbackVarying,
+        ENTRY_glClampColor,
+        ENTRY_glBeginConditionalRender,
+        ENTRY_glEndConditionalRender,
+        ENTRY_glVertexAttribIPointer,
+        ENTRY_glGetVertexAttribIiv,
+        ENTRY_glGetVertexAttribIuiv,
+        ENTRY_glVertexAttribI1i,
+        ENTRY_glVertexAttribI2i,
+        ENTRY_glVertexAttribI3i,
+        ENTRY_glVertexAttribI4i,
+        ENTRY_glVertexAttribI1ui,
+        ENTRY_glVertexAttribI2ui,
+        ENTRY_glVertexAttribI3ui,
+        ENTRY_glVertexAttribI4ui,
+        ENTRY_glVertexAttribI1iv,
+        ENTRY_glVertexAttribI2iv,
+        ENTRY_glVertexAttribI3iv,
+        ENTRY_glVertexAttribI4iv,
+        ENTRY_glVertexAttribI1uiv,
+        ENTRY_glVertexAttribI2uiv,
+        ENTRY_glVertexAttribI3uiv,
+        ENTRY_glVertexAttribI4uiv,
+        ENTRY_glVertexAttribI4bv,
+        ENTRY_glVertexAttribI4sv,
+        ENTRY_glVertexAttribI4ubv,
+        ENTRY_glVertexAttribI4usv,
+        ENTRY_glGetUniformuiv,
+        ENTRY_glBindFragDataLocation,
+        ENTRY_glGetFragDataLocation,
+        ENTRY_glUniform1ui,
+        ENTRY_glUniform2ui,
+        ENTRY_glUniform3ui,
+        ENTRY_glUniform4ui,
+        ENTRY_glUniform1uiv,
+        ENTRY_glUniform2uiv,
+        ENTRY_glUniform3uiv,
+        ENTRY_glUniform4uiv,
+        ENTRY_glTexParameterIiv,
+        ENTRY_glTexParameterIuiv,
+        ENTRY_glGetTexParameterIiv,
+        ENTRY_glGetTexParameterIuiv,
+        ENTRY_glClearBufferiv,
+        ENTRY_glClearBufferuiv,
+        ENTRY_glClearBufferfv,
+        ENTRY_glClearBufferfi,
+        ENTRY_glGetStringi,
+        ENTRY_glIsRenderbuffer,
+        ENTRY_glBindRenderbuffer,
+        ENTRY_glDeleteRenderbuffers,
+        ENTRY_glGenRenderbuffers,
+        ENTRY_glRenderbufferStorage,
+        ENTRY_glGetRenderbufferParameteriv,
+        ENTRY_glIsFramebuffer,
+        ENTRY_glBindFramebuffer,
+        ENTRY_glDeleteFramebuffers,
+        ENTRY_glGenFramebuffers,
+        ENTRY_glCheckFramebufferStatus,
+        ENTRY_glFramebufferTexture1D,
+        ENTRY_glFramebufferTexture2D,
+        ENTRY_glFramebufferTexture3D,
+        ENTRY_glFramebufferRenderbuffer,
+        ENTRY_glGetFramebufferAttachmentParameteriv,
+        ENTRY_glGenerateMipmap,
+        ENTRY_glBlitFramebuffer,
+        ENTRY_glRenderbufferStorageMultisample,
+        ENTRY_glFramebufferTextureLayer,
+        ENTRY_glMapBufferRange,
+        ENTRY_glFlushMappedBufferRange,
+        ENTRY_glBindVertexArray,
+        ENTRY_glDeleteVertexArrays,
+        ENTRY_glGenVertexArrays,
+        ENTRY_glIsVertexArray,
+        ENTRY_glDrawArraysInstanced,
+        ENTRY_glDrawElementsInstanced,
+        ENTRY_glTexBuffer,
+        ENTRY_glPrimitiveRestartIndex,
+        ENTRY_glCopyBufferSubData,
+        ENTRY_glGetUniformIndices,
+        ENTRY_glGetActiveUniformsiv,
+        ENTRY_glGetActiveUniformName,
+        ENTRY_glGetUniformBlockIndex,
+        ENTRY_glGetActiveUniformBlockiv,
+        ENTRY_glGetActiveUniformBlockName,
+        ENTRY_glUniformBlockBinding,
+        ENTRY_glDrawElementsBaseVertex,
+        ENTRY_glDrawRangeElementsBaseVertex,
+        ENTRY_glDrawElementsInstancedBaseVertex,
+        ENTRY_glMultiDrawElementsBaseVertex,
+        ENTRY_glProvokingVertex,
+        ENTRY_glFenceSync,
+        ENTRY_glIsSync,
+        ENTRY_glDeleteSync,
+        ENTRY_glClientWaitSync,
+        ENTRY_glWaitSync,
+        ENTRY_glGetInteger64v,
+        ENTRY_glGetSynciv,
+        ENTRY_glGetInteger64i_v,
+        ENTRY_glGetBufferParameteri64v,
+        ENTRY_glFramebufferTexture,
+        ENTRY_glTexImage2DMultisample,
+        ENTRY_glTexImage3DMultisample,
+        ENTRY_glGetMultisamplefv,
+        ENTRY_glSampleMaski,
+        ENTRY_glBindFragDataLocationIndexed,
+        ENTRY_glGetFragDataIndex,
+        ENTRY_glGenSamplers,
+        ENTRY_glDeleteSamplers,
+        ENTRY_glIsSampler,
+        ENTRY_glBindSampler,
+        ENTRY_glSamplerParameteri,
+        ENTRY_glSamplerParameteriv,
+        ENTRY_glSamplerParameterf,
+        ENTRY_glSamplerParameterfv,
+        ENTRY_glSamplerParameterIiv,
+        ENTRY_glSamplerParameterIuiv,
+        ENTRY_glGetSamplerParameteriv,
+        ENTRY_glGetSamplerParameterIiv,
+        ENTRY_glGetSamplerParameterfv,
+        ENTRY_glGetSamplerParameterIuiv,
+        ENTRY_glQueryCounter,
+        ENTRY_glGetQueryObjecti64v,
+        ENTRY_glGetQueryObjectui64v,
+        ENTRY_glVertexAttribDivisor,
+        ENTRY_glVertexAttribP1ui,
+        ENTRY_glVertexAttribP1uiv,
+        ENTRY_glVertexAttribP2ui,
+        ENTRY_glVertexAttribP2uiv,
+        ENTRY_glVertexAttribP3ui,
+        ENTRY_glVertexAttribP3uiv,
+        ENTRY_glVertexAttribP4ui,
+        ENTRY_glVertexAttribP4uiv,
+        ENTRY_glVertexP2ui,
+        ENTRY_glVertexP2uiv,
+        ENTRY_glVertexP3ui,
+        ENTRY_glVertexP3uiv,
+        ENTRY_glVertexP4ui,
+        ENTRY_glVertexP4uiv,
+        ENTRY_glTexCoordP1ui,
+        ENTRY_glTexCoordP1uiv,
+        ENTRY_glTexCoordP2ui,
+        ENTRY_glTexCoordP2uiv,
+        ENTRY_glTexCoordP3ui,
+        ENTRY_glTexCoordP3uiv,
+        ENTRY_glTexCoordP4ui,
+        ENTRY_glTexCoordP4uiv,
+        ENTRY_glMultiTexCoordP1ui,
+        ENTRY_glMultiTexCoordP1uiv,
+        ENTRY_glMultiTexCoordP2ui,
+        ENTRY_glMultiTexCoordP2uiv,
+        ENTRY_glMultiTexCoordP3ui,
+        ENTRY_glMultiTexCoordP3uiv,
+        ENTRY_glMultiTexCoordP4ui,
+        ENTRY_glMultiTexCoordP4uiv,
+        ENTRY_glNormalP3ui,
+        ENTRY_glNormalP3uiv,
+        ENTRY_glColorP3ui,
+        ENTRY_glColorP3uiv,
+        ENTRY_glColorP4ui,
+        ENTRY_glColorP4uiv,
+        ENTRY_glSecondaryColorP3ui,
+        ENTRY_glSecondaryColorP3uiv,
+        ENTRY_COUNT
+    };
+
+    // ------------------------------------------------------------------------
+    inline const char* entryName(uint32_t entry)
+    {
+        static const char* const names[ENTRY_COUNT] = {
+            "glCullFace",
+            "glFrontFace",
+            "glHint",
+            "glLineWidth",
+            "glPointSize",
+            "glPolygonMode",
+            "glScissor",
+            "glTexParameterf",
+            "glTexParameterfv",
+            "glTexParameteri",
+            "glTexParameteriv",
+            "glTexImage1D",
+            "glTexImage2D",
+            "glDrawBuffer",
+            "glClear",
+            "glClearColor",
+            "glClearStencil",
+            "glClearDepth",
+            "glStencilMask",
+            "glColorMask",
+            "glDepthMask",
+            "glDisable",
+            "glEnable",
+            "glFinish",
+            "glFlush",
+            "glBlendFunc",
+            "glLogicOp",
+            "glStencilFunc",
+            "glStencilOp",
+            "glDepthFunc",
+            "glPixelStoref",
+            "glPixelStorei",
+            "glReadBuffer",
+            "glReadPixels",
+            "glGetBooleanv",
+            "glGetDoublev",
+            "glGetError",
+            "glGetFloatv",
+            "glGetIntegerv",
+            "glGetString",
+            "glGetTexImage",
+            "glGetTexParameterfv",
+            "glGetTexParameteriv",
+            "glGetTexLevelParameterfv",
+            "glGetTexLevelParameteriv",
+            "glIsEnabled",
+            "glDepthRange",
+            "glViewport",
+            "glNewList",
+            "glEndList",
+            "glCallList",
+            "glCallLists",
+            "glDeleteLists",
+            "glGenLists",
+            "glListBase",
+            "glBegin",
+            "glBitmap",
+            "glColor3b",
+            "glColor3bv",
+            "glColor3d",
+            "glColor3dv",
+            "glColor3f",
+            "glColor3fv",
+            "glColor3i",
+            "glColor3iv",
+            "glColor3s",
+            "glColor3sv",
+            "glColor3ub",
+            "glColor3ubv",
+            "glColor3ui",
+            "glColor3uiv",
+            "glColor3us",
+            "glColor3usv",
+            "glColor4b",
+            "glColor4bv",
+            "glColor4d",
+            "glColor4dv",
+            "glColor4f",
+            "glColor4fv",
+            "glColor4i",
+            "glColor4iv",
+            "glColor4s",
+            "glColor4sv",
+            "glColor4ub",
+            "glColor4ubv",
+            "glColor4ui",
+            "glColor4uiv",
+            "glColor4us",
+            "glColor4usv",
+            "glEdgeFlag",
+            "glEdgeFlagv",
+            "glEnd",
+            "glIndexd",
+            "glIndexdv",
+            "glIndexf",
+            "glIndexfv",
+            "glIndexi",
+            "glIndexiv",
+            "glIndexs",
+            "glIndexsv",
+            "glNormal3b",
+            "glNormal3bv",
+            "glNormal3d",
+            "glNormal3dv",
+            "glNormal3f",
+            "glNormal3fv",
+            "glNormal3i",
+            "glNormal3iv",
+            "glNormal3s",
+            "glNormal3sv",
+            "glRasterPos2d",
+            "glRasterPos2dv",
+            "glRasterPos2f",
+            "glRasterPos2fv",
+            "glRasterPos2i",
+            "glRasterPos2iv",
+            "glRasterPos2s",
+            "glRasterPos2sv",
+            "glRasterPos3d",
+            "glRasterPos3dv",
+            "glRasterPos3f",
+            "glRasterPos3fv",
+            "glRasterPos3i",
+            "glRasterPos3iv",
+            "glRasterPos3s",
+            "glRasterPos3sv",
+            "glRasterPos4d",
+            "glRasterPos4dv",
+            "glRasterPos4f",
+            "glRasterPos4fv",
+            "glRasterPos4i",
+            "glRasterPos4iv",
+            "glRasterPos4s",
+            "glRasterPos4sv",
+            "glRectd",
+            "glRectdv",
+            "glRectf",
+            "glRectfv",
+            "glRecti",
+            "glRectiv",
+            "glRects",
+            "glRectsv",
+            "glTexCoord1d",
+            "glTexCoord1dv",
+            "glTexCoord1f",
+            "glTexCoord1fv",
+            "glTexCoord1i",
+            "glTexCoord1iv",
+            "glTexCoord1s",
+            "glTexCoord1sv",
+            "glTexCoord2d",
+            "glTexCoord2dv",
+            "glTexCoord2f",
+            "glTexCoord2fv",
+            "glTexCoord2i",
+            "glTexCoord2iv",
+            "glTexCoord2s",
+            "glTexCoord2sv",
+            "glTexCoord3d",
+            "glTexCoord3dv",
+            "glTexCoord3f",
+            "glTexCoord3fv",
+            "glTexCoord3i",
+            "glTexCoord3iv",
+            "glTexCoord3s",
+            "glTexCoord3sv",
+            "glTexCoord4d",
+            "glTexCoord4dv",
+            "glTexCoord4f",
+            "glTexCoord4fv",
+            "glTexCoord4i",
+            "glTexCoord4iv",
+            "glTexCoord4s",
+            "glTexCoord4sv",
+            "glVertex2d",
+            "glVertex2dv",
+            "glVertex2f",
+            "glVertex2fv",
+            "glVertex2i",
+            "glVertex2iv",
+            "glVertex2s",
+            "glVertex2sv",
+            "glVertex3d",
+            "glVertex3dv",
+            "glVertex3f",
+            "glVertex3fv",
+            "glVertex3i",
+            "glVertex3iv",
+            "glVertex3s",
+            "glVertex3sv",
+            "glVertex4d",
+            "glVertex4dv",
+            "glVertex4f",
+            "glVertex4fv",
+            "glVertex4i",
+            "glVertex4iv",
+            "glVertex4s",
+            "glVertex4sv",
+            "glClipPlane",
+            "glColorMaterial",
+            "glFogf",
+            "glFogfv",
+            "glFogi",
+            "glFogiv",
+            "glLightf",
+            "glLightfv",
+            "glLighti",
+            "glLightiv",
+            "glLightModelf",
+            "glLightModelfv",
+            "glLightModeli",
+            "glLightModeliv",
+            "glLineStipple",
+            "glMaterialf",
+            "glMaterialfv",
+            "glMateriali",
+            "glMaterialiv",
+            "glPolygonStipple",
+            "glShadeModel",
+            "glTexEnvf",
+            "glTexEnvfv",
+            "glTexEnvi",
+            "glTexEnviv",
+            "glTexGend",
+            "glTexGendv",
+            "glTexGenf",
+            "glTexGenfv",
+            "glTexGeni",
+            "glTexGeniv",
+            "glFeedbackBuffer",
+            "glSelectBuffer",
+            "glRenderMode",
+            "glInitNames",
+            "glLoadName",
+            "glPassThrough",
+            "glPopName",
+            "glPushName",
+            "glClearAccum",
+            "glClearIndex",
+            "glIndexMask",
+            "glAccum",
+            "glPopAttrib",
+            "glPushAttrib",
+            "glMap1d",
+            "glMap1f",
+            "glMap2d",
+            "glMap2f",
+            "glMapGrid1d",
+            "glMapGrid1f",
+            "glMapGrid2d",
+            "glMapGrid2f",
+            "glEvalCoord1d",
+            "glEvalCoord1dv",
+            "glEvalCoord1f",
+            "glEvalCoord1fv",
+            "glEvalCoord2d",
+            "glEvalCoord2dv",
+            "glEvalCoord2f",
+            "glEvalCoord2fv",
+            "glEvalMesh1",
+            "glEvalPoint1",
+            "glEvalMesh2",
+            "glEvalPoint2",
+            "glAlphaFunc",
+            "glPixelZoom",
+            "glPixelTransferf",
+            "glPixelTransferi",
+            "glPixelMapfv",
+            "glPixelMapuiv",
+            "glPixelMapusv",
+            "glCopyPixels",
+            "glDrawPixels",
+            "glGetClipPlane",
+            "glGetLightfv",
+            "glGetLightiv",
+            "glGetMapdv",
+            "glGetMapfv",
+            "glGetMapiv",
+            "glGetMaterialfv",
+            "glGetMaterialiv",
+            "glGetPixelMapfv",
+            "glGetPixelMapuiv",
+            "glGetPixelMapusv",
+            "glGetPolygonStipple",
+            "glGetTexEnvfv",
+            "glGetTexEnviv",
+            "glGetTexGendv",
+            "glGetTexGenfv",
+            "glGetTexGeniv",
+            "glIsList",
+            "glFrustum",
+            "glLoadIdentity",
+            "glLoadMatrixf",
+            "glLoadMatrixd",
+            "glMatrixMode",
+            "glMultMatrixf",
+            "glMultMatrixd",
+            "glOrtho",
+            "glPopMatrix",
+            "glPushMatrix",
+            "glRotated",
+            "glRotatef",
+            "glScaled",
+            "glScalef",
+            "glTranslated",
+            "glTranslatef",
+            "glDrawArrays",
+            "glDrawElements",
+            "glGetPointerv",
+            "glPolygonOffset",
+            "glCopyTexImage1D",
+            "glCopyTexImage2D",
+            "glCopyTexSubImage1D",
+            "glCopyTexSubImage2D",
+            "glTexSubImage1D",
+            "glTexSubImage2D",
+            "glBindTexture",
+            "glDeleteTextures",
+            "glGenTextures",
+            "glIsTexture",
+            "glArrayElement",
+            "glColorPointer",
+            "glDisableClientState",
+            "glEdgeFlagPointer",
+            "glEnableClientState",
+            "glIndexPointer",
+            "glInterleavedArrays",
+            "glNormalPointer",
+            "glTexCoordPointer",
+            "glVertexPointer",
+            "glAreTexturesResident",
+            "glPrioritizeTextures",
+            "glIndexub",
+            "glIndexubv",
+            "glPopClientAttrib",
+            "glPushClientAttrib",
+            "glDrawRangeElements",
+            "glTexImage3D",
+            "glTexSubImage3D",
+            "glCopyTexSubImage3D",
+            "glActiveTexture",
+            "glSampleCoverage",
+            "glCompressedTexImage3D",
+            "glCompressedTexImage2D",
+            "glCompressedTexImage1D",
+            "glCompressedTexSubImage3D",
+            "glCompressedTexSubImage2D",
+            "glCompressedTexSubImage1D",
+            "glGetCompressedTexImage",
+            "glClientActiveTexture",
+            "glMultiTexCoord1d",
+            "glMultiTexCoord1dv",
+            "glMultiTexCoord1f",
+            "glMultiTexCoord1fv",
+            "glMultiTexCoord1i",
+            "glMultiTexCoord1iv",
+            "glMultiTexCoord1s",
+            "glMultiTexCoord1sv",
+            "glMultiTexCoord2d",
+            "glMultiTexCoord2dv",
+            "glMultiTexCoord2f",
+            "glMultiTexCoord2fv",
+            "glMultiTexCoord2i",
+            "glMultiTexCoord2iv",
+            "glMultiTexCoord2s",
+            "glMultiTexCoord2sv",
+            "glMultiTexCoord3d",
+            "glMultiTexCoord3dv",
+            "glMultiTexCoord3f",
+            "glMultiTexCoord3fv",
+            "glMultiTexCoord3i",
+            "glMultiTexCoord3iv",
+            "glMultiTexCoord3s",
+            "glMultiTexCoord3sv",
+            "glMultiTexCoord4d",
+            "glMultiTexCoord4dv",
+            "glMultiTexCoord4f",
+            "glMultiTexCoord4fv",
+            "glMultiTexCoord4i",
+            "glMultiTexCoord4iv",
+            "glMultiTexCoord4s",
+            "glMultiTexCoord4sv",
+            "glLoadTransposeMatrixf",
+            "glLoadTransposeMatrixd",
+            "glMultTransposeMatrixf",
+            "glMultTransposeMatrixd",
+            "glBlendFuncSeparate",
+            "glMultiDrawArrays",
+            "glMultiDrawElements",
+            "glPointParameterf",
+            "glPointParameterfv",
+            "glPointParameteri",
+            "glPointParameteriv",
+            "glFogCoordf",
+            "glFogCoordfv",
+            "glFogCoordd",
+            "glFogCoorddv",
+            "glFogCoordPointer",
+            "glSecondaryColor3b",
+            "glSecondaryColor3bv",
+            "glSecondaryColor3d",
+            "glSecondaryColor3dv",
+            "glSecondaryColor3f",
+            "glSecondaryColor3fv",
+            "glSecondaryColor3i",
+            "glSecondaryColor3iv",
+            "glSecondaryColor3s",
+            "glSecondaryColor3sv",
+            "glSecondaryColor3ub",
+            "glSecondaryColor3ubv",
+            "glSecondaryColor3ui",
+            "glSecondaryColor3uiv",
+            "glSecondaryColor3us",
+            "glSecondaryColor3usv",
+            "glSecondaryColorPointer",
+            "glWindowPos2d",
+            "glWindowPos2dv",
+            "glWindowPos2f",
+            "glWindowPos2fv",
+            "glWindowPos2i",
+            "glWindowPos2iv",
+            "glWindowPos2s",
+            "glWindowPos2sv",
+            "glWindowPos3d",
+            "glWindowPos3dv",
+            "glWindowPos3f",
+            "glWindowPos3fv",
+            "glWindowPos3i",
+            "glWindowPos3iv",
+            "glWindowPos3s",
+            "glWindowPos3sv",
+            "glBlendColor",
+            "glBlendEquation",
+            "glGenQueries",
+            "glDeleteQueries",
+            "glIsQuery",
+            "glBeginQuery",
+            "glEndQuery",
+            "glGetQueryiv",
+            "glGetQueryObjectiv",
+            "glGetQueryObjectuiv",
+            "glBindBuffer",
+            "glDeleteBuffers",
+            "glGenBuffers",
+            "glIsBuffer",
+            "glBufferData",
+            "glBufferSubData",
+            "glGetBufferSubData",
+            "glMapBuffer",
+            "glUnmapBuffer",
+            "glGetBufferParameteriv",
+            "glGetBufferPointerv",
+            "glBlendEquationSeparate",
+            "glDrawBuffers",
+            "glStencilOpSeparate",
+            "glStencilFuncSeparate",
+            "glStencilMaskSeparate",
+            "glAttachShader",
+            "glBindAttribLocation",
+            "glCompileShader",
+            "glCreateProgram",
+            "glCreateShader",
+            "glDeleteProgram",
+            "glDeleteShader",
+            "glDetachShader",
+            "glDisableVertexAttribArray",
+            "glEnableVertexAttribArray",
+            "glGetActiveAttrib",
+            "glGetActiveUniform",
+            "glGetAttachedShaders",
+            "glGetAttribLocation",
+            "glGetProgramiv",
+            "glGetProgramInfoLog",
+            "glGetShaderiv",
+            "glGetShaderInfoLog",
+            "glGetShaderSource",
+            "glGetUniformLocation",
+            "glGetUniformfv",
+            "glGetUniformiv",
+            "glGetVertexAttribdv",
+            "glGetVertexAttribfv",
+            "glGetVertexAttribiv",
+            "glGetVertexAttribPointerv",
+            "glIsProgram",
+            "glIsShader",
+            "glLinkProgram",
+            "glShaderSource",
+            "glUseProgram",
+            "glUniform1f",
+            "glUniform2f",
+            "glUniform3f",
+            "glUniform4f",
+            "glUniform1i",
+            "glUniform2i",
+            "glUniform3i",
+            "glUniform4i",
+            "glUniform1fv",
+            "glUniform2fv",
+            "glUniform3fv",
+            "glUniform4fv",
+            "glUniform1iv",
+            "glUniform2iv",
+            "glUniform3iv",
+            "glUniform4iv",
+            "glUniformMatrix2fv",
+            "glUniformMatrix3fv",
+            "glUniformMatrix4fv",
+            "glValidateProgram",
+            "glVertexAttrib1d",
+            "glVertexAttrib1dv",
+            "glVertexAttrib1f",
+            "glVertexAttrib1fv",
+            "glVertexAttrib1s",
+            "glVertexAttrib1sv",
+            "glVertexAttrib2d",
+            "glVertexAttrib2dv",
+            "glVertexAttrib2f",
+            "glVertexAttrib2fv",
+            "glVertexAttrib2s",
+            "glVertexAttrib2sv",
+            "glVertexAttrib3d",
+            "glVertexAttrib3dv",
+            "glVertexAttrib3f",
+            "glVertexAttrib3fv",
+            "glVertexAttrib3s",
+            "glVertexAttrib3sv",
+            "glVertexAttrib4Nbv",
+            "glVertexAttrib4Niv",
+            "glVertexAttrib4Nsv",
+            "glVertexAttrib4Nub",
+            "glVertexAttrib4Nubv",
+            "glVertexAttrib4Nuiv",
+            "glVertexAttrib4Nusv",
+            "glVertexAttrib4bv",
+            "glVertexAttrib4d",
+            "glVertexAttrib4dv",
+            "glVertexAttrib4f",
+            "glVertexAttrib4fv",
+            "glVertexAttrib4iv",
+            "glVertexAttrib4s",
+            "glVertexAttrib4sv",
+            "glVertexAttrib4ubv",
+            "glVertexAttrib4uiv",
+            "glVertexAttrib4usv",
+            "glVertexAttribPointer",
+            "glUniformMatrix2x3fv",
+            "glUniformMatrix3x2fv",
+            "glUniformMatrix2x4fv",
+            "glUniformMatrix4x2fv",
+            "glUniformMatrix3x4fv",
+            "glUniformMatrix4x3fv",
+            "glColorMaski",
+            "glGetBooleani_v",
+            "glGetIntegeri_v",
+            "glEnablei",
+            "glDisablei",
+            "glIsEnabledi",
+            "glBeginTransformFeedback",
+            "glEndTransformFeedback",
+            "glBindBufferRange",
+            "glBindBufferBase",
+            "glTransformFeedbackVaryings",
+            "glGetTransformFeedbackVarying",
+            "glClampColor",
+            "glBeginConditionalRender",
+            "glEndConditionalRender",
+            "glVertexAttribIPointer",
+            "glGetVertexAttribIiv",
+            "glGetVertexAttribIuiv",
+            "glVertexAttribI1i",
+            "glVertexAttribI2i",
+            "glVertexAttribI3i",
+            "glVertexAttribI4i",
+            "glVertexAttribI1ui",
+            "glVertexAttribI2ui",
+            "glVertexAttribI3ui",
+            "glVertexAttribI4ui",
+            "glVertexAttribI1iv",
+            "glVertexAttribI2iv",
+            "glVertexAttribI3iv",
+            "glVertexAttribI4iv",
+            "glVertexAttribI1uiv",
+            "glVertexAttribI2uiv",
+            "glVertexAttribI3uiv",
+            "glVertexAttribI4uiv",
+            "glVertexAttribI4bv",
+            "glVertexAttribI4sv",
+            "glVertexAttribI4ubv",
+            "glVertexAttribI4usv",
+            "glGetUniformuiv",
+            "glBindFragDataLocation",
+            "glGetFragDataLocation",
+            "glUniform1ui",
+            "glUniform2ui",
+            "glUniform3ui",
+            "glUniform4ui",
+            "glUniform1uiv",
+            "glUniform2uiv",
+            "glUniform3uiv",
+            "glUniform4uiv",
+            "glTexParameterIiv",
+            "glTexParameterIuiv",
+            "glGetTexParameterIiv",
+            "glGetTexParameterIuiv",
+            "glClearBufferiv",
+            "glClearBufferuiv",
+            "glClearBufferfv",
+            "glClearBufferfi",
+            "glGetStringi",
+            "glIsRenderbuffer",
+            "glBindRenderbuffer",
+            "glDeleteRenderbuffers",
+            "glGenRenderbuffers",
+            "glRenderbufferStorage",
+            "glGetRenderbufferParameteriv",
+            "glIsFramebuffer",
+            "glBindFramebuffer",
+            "glDeleteFramebuffers",
+            "glGenFramebuffers",
+            "glCheckFramebufferStatus",
+            "glFramebufferTexture1D",
+            "glFramebufferTexture2D",
+            "glFramebufferTexture3D",
+            "glFramebufferRenderbuffer",
+            "glGetFramebufferAttachmentParameteriv",
+            "glGenerateMipmap",
+            "glBlitFramebuffer",
+            "glRenderbufferStorageMultisample",
+            "glFramebufferTextureLayer",
+            "glMapBufferRange",
+            "glFlushMappedBufferRange",
+            "glBindVertexArray",
+            "glDeleteVertexArrays",
+            "glGenVertexArrays",
+            "glIsVertexArray",
+            "glDrawArraysInstanced",
+            "glDrawElementsInstanced",
+            "glTexBuffer",
+            "glPrimitiveRestartIndex",
+            "glCopyBufferSubData",
+            "glGetUniformIndices",
+            "glGetActiveUniformsiv",
+            "glGetActiveUniformName",
+            "glGetUniformBlockIndex",
+            "glGetActiveUniformBlockiv",
+            "glGetActiveUniformBlockName",
+            "glUniformBlockBinding",
+            "glDrawElementsBaseVertex",
+            "glDrawRangeElementsBaseVertex",
+            "glDrawElementsInstancedBaseVertex",
+            "glMultiDrawElementsBaseVertex",
+            "glProvokingVertex",
+            "glFenceSync",
+            "glIsSync",
+            "glDeleteSync",
+            "glClientWaitSync",
+            "glWaitSync",
+            "glGetInteger64v",
+            "glGetSynciv",
+            "glGetInteger64i_v",
+            "glGetBufferParameteri64v",
+            "glFramebufferTexture",
+            "glTexImage2DMultisample",
+            "glTexImage3DMultisample",
+            "glGetMultisamplefv",
+            "glSampleMaski",
+            "glBindFragDataLocationIndexed",
+            "glGetFragDataIndex",
+            "glGenSamplers",
+            "glDeleteSamplers",
+            "glIsSampler",
+            "glBindSampler",
+            "glSamplerParameteri",
+            "glSamplerParameteriv",
+            "glSamplerParameterf",
+            "glSamplerParameterfv",
+            "glSamplerParameterIiv",
+            "glSamplerParameterIuiv",
+            "glGetSamplerParameteriv",
+            "glGetSamplerParameterIiv",
+            "glGetSamplerParameterfv",
+            "glGetSamplerParameterIuiv",
+            "glQueryCounter",
+            "glGetQueryObjecti64v",
+            "glGetQueryObjectui64v",
+            "glVertexAttribDivisor",
+            "glVertexAttribP1ui",
+            "glVertexAttribP1uiv",
+            "glVertexAttribP2ui",
+            "glVertexAttribP2uiv",
+            "glVertexAttribP3ui",
+            "glVertexAttribP3uiv",
+            "glVertexAttribP4ui",
+            "glVertexAttribP4uiv",
+            "glVertexP2ui",
+            "glVertexP2uiv",
+            "glVertexP3ui",
+            "glVertexP3uiv",
+            "glVertexP4ui",
+            "glVertexP4uiv",
+            "glTexCoordP1ui",
+            "glTexCoordP1uiv",
+            "glTexCoordP2ui",
+            "glTexCoordP2uiv",
+            "glTexCoordP3ui",
+            "glTexCoordP3uiv",
+            "glTexCoordP4ui",
+            "glTexCoordP4uiv",
+            "glMultiTexCoordP1ui",
+            "glMultiTexCoordP1uiv",
+            "glMultiTexCoordP2ui",
+            "glMultiTexCoordP2uiv",
+            "glMultiTexCoordP3ui",
+            "glMultiTexCoordP3uiv",
+            "glMultiTexCoordP4ui",
+            "glMultiTexCoordP4uiv",
+            "glNormalP3ui",
+            "glNormalP3uiv",
+            "glColorP3ui",
+            "glColorP3uiv",
+            "glColorP4ui",
+            "glColorP4uiv",
+            "glSecondaryColorP3ui",
+            "glSecondaryColorP3uiv",
+        };
+        return entry < ENTRY_COUNT ? names[entry] : "";
+    }
+
+    // the pointers glad had before install(), a template so the header can
+    // define them
+    template<typename Unused = void>
+    struct Table
+    {
+        static void* loaded[ENTRY_COUNT];
+    };
+    template<typename Unused> void* Table<Unused>::loaded[ENTRY_COUNT] = {};
+
+    inline void APIENTRY record_glCullFace(GLenum mode)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glCullFace);
+        trace.value(mode);
+        ((PFNGLCULLFACEPROC)Table<>::loaded[ENTRY_glCullFace])(mode);
+    }
+    inline void APIENTRY record_glFrontFace(GLenum mode)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glFrontFace);
+        trace.value(mode);
+        ((PFNGLFRONTFACEPROC)Table<>::loaded[ENTRY_glFrontFace])(mode);
+    }
+    inline void APIENTRY record_glHint(GLenum target, GLenum mode)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glHint);
+        trace.value(target);
+        trace.value(mode);
+        ((PFNGLHINTPROC)Table<>::loaded[ENTRY_glHint])(target, mode);
+    }
+    inline void APIENTRY record_glLineWidth(GLfloat width)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glLineWidth);
+        trace.value(width);
+        ((PFNGLLINEWIDTHPROC)Table<>::loaded[ENTRY_glLineWidth])(width);
+    }
+    inline void APIENTRY record_glPointSize(GLfloat size)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPointSize);
+        trace.value(size);
+        ((PFNGLPOINTSIZEPROC)Table<>::loaded[ENTRY_glPointSize])(size);
+    }
+    inline void APIENTRY record_glPolygonMode(GLenum face, GLenum mode)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPolygonMode);
+        trace.value(face);
+        trace.value(mode);
+        ((PFNGLPOLYGONMODEPROC)Table<>::loaded[ENTRY_glPolygonMode])(face, mode);
+    }
+    inline void APIENTRY record_glScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glScissor);
+        trace.value(x);
+        trace.value(y);
+        trace.value(width);
+        trace.value(height);
+        ((PFNGLSCISSORPROC)Table<>::loaded[ENTRY_glScissor])(x, y, width, height);
+    }
+    inline void APIENTRY record_glTexParameterf(GLenum target, GLenum pname, GLfloat param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexParameterf);
+        trace.value(target);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLTEXPARAMETERFPROC)Table<>::loaded[ENTRY_glTexParameterf])(target, pname, param);
+    }
+    inline void APIENTRY record_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexParameterfv);
+        trace.value(target);
+        trace.value(pname);
+        trace.pointer(params, gltrace::parameterCount(pname) * 4);
+        ((PFNGLTEXPARAMETERFVPROC)Table<>::loaded[ENTRY_glTexParameterfv])(target, pname, params);
+    }
+    inline void APIENTRY record_glTexParameteri(GLenum target, GLenum pname, GLint param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexParameteri);
+        trace.value(target);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLTEXPARAMETERIPROC)Table<>::loaded[ENTRY_glTexParameteri])(target, pname, param);
+    }
+    inline void APIENTRY record_glTexParameteriv(GLenum target, GLenum pname, const GLint *params)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexParameteriv);
+        trace.value(target);
+        trace.value(pname);
+        trace.pointer(params, gltrace::parameterCount(pname) * 4);
+        ((PFNGLTEXPARAMETERIVPROC)Table<>::loaded[ENTRY_glTexParameteriv])(target, pname, params);
+    }
+    inline void APIENTRY record_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexImage1D);
+        trace.value(target);
+        trace.value(level);
+        trace.value(internalformat);
+        trace.value(width);
+        trace.value(border);
+        trace.value(format);
+        trace.value(type);
+        trace.unpackPixels(pixels, format, type, width, 1, 1);
+        ((PFNGLTEXIMAGE1DPROC)Table<>::loaded[ENTRY_glTexImage1D])(target, level, internalformat, width, border, format, type, pixels);
+    }
+    inline void APIENTRY record_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexImage2D);
+        trace.value(target);
+        trace.value(level);
+        trace.value(internalformat);
+        trace.value(width);
+        trace.value(height);
+        trace.value(border);
+        trace.value(format);
+        trace.value(type);
+        trace.unpackPixels(pixels, format, type, width, height, 1);
+        ((PFNGLTEXIMAGE2DPROC)Table<>::loaded[ENTRY_glTexImage2D])(target, level, internalformat, width, height, border, format, type, pixels);
+    }
+    inline void APIENTRY record_glDrawBuffer(GLenum buf)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDrawBuffer);
+        trace.value(buf);
+        ((PFNGLDRAWBUFFERPROC)Table<>::loaded[ENTRY_glDrawBuffer])(buf);
+    }
+    inline void APIENTRY record_glClear(GLbitfield mask)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glClear);
+        trace.value(mask);
+        ((PFNGLCLEARPROC)Table<>::loaded[ENTRY_glClear])(mask);
+    }
+    inline void APIENTRY record_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glClearColor);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        trace.value(alpha);
+        ((PFNGLCLEARCOLORPROC)Table<>::loaded[ENTRY_glClearColor])(red, green, blue, alpha);
+    }
+    inline void APIENTRY record_glClearStencil(GLint s)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glClearStencil);
+        trace.value(s);
+        ((PFNGLCLEARSTENCILPROC)Table<>::loaded[ENTRY_glClearStencil])(s);
+    }
+    inline void APIENTRY record_glClearDepth(GLdouble depth)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glClearDepth);
+        trace.value(depth);
+        ((PFNGLCLEARDEPTHPROC)Table<>::loaded[ENTRY_glClearDepth])(depth);
+    }
+    inline void APIENTRY record_glStencilMask(GLuint mask)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glStencilMask);
+        trace.value(mask);
+        ((PFNGLSTENCILMASKPROC)Table<>::loaded[ENTRY_glStencilMask])(mask);
+    }
+    inline void APIENTRY record_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColorMask);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        trace.value(alpha);
+        ((PFNGLCOLORMASKPROC)Table<>::loaded[ENTRY_glColorMask])(red, green, blue, alpha);
+    }
+    inline void APIENTRY record_glDepthMask(GLboolean flag)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDepthMask);
+        trace.value(flag);
+        ((PFNGLDEPTHMASKPROC)Table<>::loaded[ENTRY_glDepthMask])(flag);
+    }
+    inline void APIENTRY record_glDisable(GLenum cap)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDisable);
+        trace.value(cap);
+        ((PFNGLDISABLEPROC)Table<>::loaded[ENTRY_glDisable])(cap);
+    }
+    inline void APIENTRY record_glEnable(GLenum cap)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glEnable);
+        trace.value(cap);
+        ((PFNGLENABLEPROC)Table<>::loaded[ENTRY_glEnable])(cap);
+    }
+    inline void APIENTRY record_glFinish(void)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glFinish);
+        ((PFNGLFINISHPROC)Table<>::loaded[ENTRY_glFinish])();
+    }
+    inline void APIENTRY record_glFlush(void)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glFlush);
+        ((PFNGLFLUSHPROC)Table<>::loaded[ENTRY_glFlush])();
+    }
+    inline void APIENTRY record_glBlendFunc(GLenum sfactor, GLenum dfactor)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBlendFunc);
+        trace.value(sfactor);
+        trace.value(dfactor);
+        ((PFNGLBLENDFUNCPROC)Table<>::loaded[ENTRY_glBlendFunc])(sfactor, dfactor);
+    }
+    inline void APIENTRY record_glLogicOp(GLenum opcode)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glLogicOp);
+        trace.value(opcode);
+        ((PFNGLLOGICOPPROC)Table<>::loaded[ENTRY_glLogicOp])(opcode);
+    }
+    inline void APIENTRY record_glStencilFunc(GLenum func, GLint ref, GLuint mask)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glStencilFunc);
+        trace.value(func);
+        trace.value(ref);
+        trace.value(mask);
+        ((PFNGLSTENCILFUNCPROC)Table<>::loaded[ENTRY_glStencilFunc])(func, ref, mask);
+    }
+    inline void APIENTRY record_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glStencilOp);
+        trace.value(fail);
+        trace.value(zfail);
+        trace.value(zpass);
+        ((PFNGLSTENCILOPPROC)Table<>::loaded[ENTRY_glStencilOp])(fail, zfail, zpass);
+    }
+    inline void APIENTRY record_glDepthFunc(GLenum func)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDepthFunc);
+        trace.value(func);
+        ((PFNGLDEPTHFUNCPROC)Table<>::loaded[ENTRY_glDepthFunc])(func);
+    }
+    inline void APIENTRY record_glPixelStoref(GLenum pname, GLfloat param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPixelStoref);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLPIXELSTOREFPROC)Table<>::loaded[ENTRY_glPixelStoref])(pname, param);
+        trace.pixelStore(pname, (GLint)param);
+    }
+    inline void APIENTRY record_glPixelStorei(GLenum pname, GLint param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPixelStorei);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLPIXELSTOREIPROC)Table<>::loaded[ENTRY_glPixelStorei])(pname, param);
+        trace.pixelStore(pname, (GLint)param);
+    }
+    inline void APIENTRY record_glReadBuffer(GLenum src)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glReadBuffer);
+        trace.value(src);
+        ((PFNGLREADBUFFERPROC)Table<>::loaded[ENTRY_glReadBuffer])(src);
+    }
+    inline void APIENTRY record_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glReadPixels);
+        trace.value(x);
+        trace.value(y);
+        trace.value(width);
+        trace.value(height);
+        trace.value(format);
+        trace.value(type);
+        trace.packPixels(pixels, format, type, width, height);
+        ((PFNGLREADPIXELSPROC)Table<>::loaded[ENTRY_glReadPixels])(x, y, width, height, format, type, pixels);
+    }
+    inline void APIENTRY record_glDepthRange(GLdouble n, GLdouble f)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDepthRange);
+        trace.value(n);
+        trace.value(f);
+        ((PFNGLDEPTHRANGEPROC)Table<>::loaded[ENTRY_glDepthRange])(n, f);
+    }
+    inline void APIENTRY record_glViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glViewport);
+        trace.value(x);
+        trace.value(y);
+        trace.value(width);
+        trace.value(height);
+        ((PFNGLVIEWPORTPROC)Table<>::loaded[ENTRY_glViewport])(x, y, width, height);
+    }
+    inline void APIENTRY record_glNewList(GLuint list, GLenum mode)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glNewList);
+        trace.value(list);
+        trace.value(mode);
+        ((PFNGLNEWLISTPROC)Table<>::loaded[ENTRY_glNewList])(list, mode);
+    }
+    inline void APIENTRY record_glEndList(void)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glEndList);
+        ((PFNGLENDLISTPROC)Table<>::loaded[ENTRY_glEndList])();
+    }
+    inline void APIENTRY record_glCallList(GLuint list)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glCallList);
+        trace.value(list);
+        ((PFNGLCALLLISTPROC)Table<>::loaded[ENTRY_glCallList])(list);
+    }
+    inline void APIENTRY record_glCallLists(GLsizei n, GLenum type, const void *lists)
+    {
+        recorder().unsupported(ENTRY_glCallLists);
+        ((PFNGLCALLLISTSPROC)Table<>::loaded[ENTRY_glCallLists])(n, type, lists);
+    }
+    inline void APIENTRY record_glDeleteLists(GLuint list, GLsizei range)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDeleteLists);
+        trace.value(list);
+        trace.value(range);
+        ((PFNGLDELETELISTSPROC)Table<>::loaded[ENTRY_glDeleteLists])(list, range);
+    }
+    inline GLuint APIENTRY record_glGenLists(GLsizei range)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glGenLists);
+        trace.value(range);
+        GLuint result = ((PFNGLGENLISTSPROC)Table<>::loaded[ENTRY_glGenLists])(range);
+        return result;
+    }
+    inline void APIENTRY record_glListBase(GLuint base)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glListBase);
+        trace.value(base);
+        ((PFNGLLISTBASEPROC)Table<>::loaded[ENTRY_glListBase])(base);
+    }
+    inline void APIENTRY record_glBegin(GLenum mode)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBegin);
+        trace.value(mode);
+        ((PFNGLBEGINPROC)Table<>::loaded[ENTRY_glBegin])(mode);
+    }
+    inline void APIENTRY record_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap)
+    {
+        recorder().unsupported(ENTRY_glBitmap);
+        ((PFNGLBITMAPPROC)Table<>::loaded[ENTRY_glBitmap])(width, height, xorig, yorig, xmove, ymove, bitmap);
+    }
+    inline void APIENTRY record_glColor3b(GLbyte red, GLbyte green, GLbyte blue)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColor3b);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        ((PFNGLCOLOR3BPROC)Table<>::loaded[ENTRY_glColor3b])(red, green, blue);
+    }
+    inline void APIENTRY record_glColor3bv(const GLbyte *v)
+    {
+        recorder().unsupported(ENTRY_glColor3bv);
+        ((PFNGLCOLOR3BVPROC)Table<>::loaded[ENTRY_glColor3bv])(v);
+    }
+    inline void APIENTRY record_glColor3d(GLdouble red, GLdouble green, GLdouble blue)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColor3d);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        ((PFNGLCOLOR3DPROC)Table<>::loaded[ENTRY_glColor3d])(red, green, blue);
+    }
+    inline void APIENTRY record_glColor3dv(const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glColor3dv);
+        ((PFNGLCOLOR3DVPROC)Table<>::loaded[ENTRY_glColor3dv])(v);
+    }
+    inline void APIENTRY record_glColor3f(GLfloat red, GLfloat green, GLfloat blue)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColor3f);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        ((PFNGLCOLOR3FPROC)Table<>::loaded[ENTRY_glColor3f])(red, green, blue);
+    }
+    inline void APIENTRY record_glColor3fv(const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glColor3fv);
+        ((PFNGLCOLOR3FVPROC)Table<>::loaded[ENTRY_glColor3fv])(v);
+    }
+    inline void APIENTRY record_glColor3i(GLint red, GLint green, GLint blue)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColor3i);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        ((PFNGLCOLOR3IPROC)Table<>::loaded[ENTRY_glColor3i])(red, green, blue);
+    }
+    inline void APIENTRY record_glColor3iv(const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glColor3iv);
+        ((PFNGLCOLOR3IVPROC)Table<>::loaded[ENTRY_glColor3iv])(v);
+    }
+    inline void APIENTRY record_glColor3s(GLshort red, GLshort green, GLshort blue)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColor3s);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        ((PFNGLCOLOR3SPROC)Table<>::loaded[ENTRY_glColor3s])(red, green, blue);
+    }
+    inline void APIENTRY record_glColor3sv(const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glColor3sv);
+        ((PFNGLCOLOR3SVPROC)Table<>::loaded[ENTRY_glColor3sv])(v);
+    }
+    inline void APIENTRY record_glColor3ub(GLubyte red, GLubyte green, GLubyte blue)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColor3ub);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        ((PFNGLCOLOR3UBPROC)Table<>::loaded[ENTRY_glColor3ub])(red, green, blue);
+    }
+    inline void APIENTRY record_glColor3ubv(const GLubyte *v)
+    {
+        recorder().unsupported(ENTRY_glColor3ubv);
+        ((PFNGLCOLOR3UBVPROC)Table<>::loaded[ENTRY_glColor3ubv])(v);
+    }
+    inline void APIENTRY record_glColor3ui(GLuint red, GLuint green, GLuint blue)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColor3ui);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        ((PFNGLCOLOR3UIPROC)Table<>::loaded[ENTRY_glColor3ui])(red, green, blue);
+    }
+    inline void APIENTRY record_glColor3uiv(const GLuint *v)
+    {
+        recorder().unsupported(ENTRY_glColor3uiv);
+        ((PFNGLCOLOR3UIVPROC)Table<>::loaded[ENTRY_glColor3uiv])(v);
+    }
+    inline void APIENTRY record_glColor3us(GLushort red, GLushort green, GLushort blue)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColor3us);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        ((PFNGLCOLOR3USPROC)Table<>::loaded[ENTRY_glColor3us])(red, green, blue);
+    }
+    inline void APIENTRY record_glColor3usv(const GLushort *v)
+    {
+        recorder().unsupported(ENTRY_glColor3usv);
+        ((PFNGLCOLOR3USVPROC)Table<>::loaded[ENTRY_glColor3usv])(v);
+    }
+    inline void APIENTRY record_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColor4b);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        trace.value(alpha);
+        ((PFNGLCOLOR4BPROC)Table<>::loaded[ENTRY_glColor4b])(red, green, blue, alpha);
+    }
+    inline void APIENTRY record_glColor4bv(const GLbyte *v)
+    {
+        recorder().unsupported(ENTRY_glColor4bv);
+        ((PFNGLCOLOR4BVPROC)Table<>::loaded[ENTRY_glColor4bv])(v);
+    }
+    inline void APIENTRY record_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColor4d);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        trace.value(alpha);
+        ((PFNGLCOLOR4DPROC)Table<>::loaded[ENTRY_glColor4d])(red, green, blue, alpha);
+    }
+    inline void APIENTRY record_glColor4dv(const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glColor4dv);
+        ((PFNGLCOLOR4DVPROC)Table<>::loaded[ENTRY_glColor4dv])(v);
+    }
+    inline void APIENTRY record_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColor4f);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        trace.value(alpha);
+        ((PFNGLCOLOR4FPROC)Table<>::loaded[ENTRY_glColor4f])(red, green, blue, alpha);
+    }
+    inline void APIENTRY record_glColor4fv(const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glColor4fv);
+        ((PFNGLCOLOR4FVPROC)Table<>::loaded[ENTRY_glColor4fv])(v);
+    }
+    inline void APIENTRY record_glColor4i(GLint red, GLint green, GLint blue, GLint alpha)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColor4i);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        trace.value(alpha);
+        ((PFNGLCOLOR4IPROC)Table<>::loaded[ENTRY_glColor4i])(red, green, blue, alpha);
+    }
+    inline void APIENTRY record_glColor4iv(const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glColor4iv);
+        ((PFNGLCOLOR4IVPROC)Table<>::loaded[ENTRY_glColor4iv])(v);
+    }
+    inline void APIENTRY record_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColor4s);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        trace.value(alpha);
+        ((PFNGLCOLOR4SPROC)Table<>::loaded[ENTRY_glColor4s])(red, green, blue, alpha);
+    }
+    inline void APIENTRY record_glColor4sv(const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glColor4sv);
+        ((PFNGLCOLOR4SVPROC)Table<>::loaded[ENTRY_glColor4sv])(v);
+    }
+    inline void APIENTRY record_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColor4ub);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        trace.value(alpha);
+        ((PFNGLCOLOR4UBPROC)Table<>::loaded[ENTRY_glColor4ub])(red, green, blue, alpha);
+    }
+    inline void APIENTRY record_glColor4ubv(const GLubyte *v)
+    {
+        recorder().unsupported(ENTRY_glColor4ubv);
+        ((PFNGLCOLOR4UBVPROC)Table<>::loaded[ENTRY_glColor4ubv])(v);
+    }
+    inline void APIENTRY record_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColor4ui);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        trace.value(alpha);
+        ((PFNGLCOLOR4UIPROC)Table<>::loaded[ENTRY_glColor4ui])(red, green, blue, alpha);
+    }
+    inline void APIENTRY record_glColor4uiv(const GLuint *v)
+    {
+        recorder().unsupported(ENTRY_glColor4uiv);
+        ((PFNGLCOLOR4UIVPROC)Table<>::loaded[ENTRY_glColor4uiv])(v);
+    }
+    inline void APIENTRY record_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColor4us);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        trace.value(alpha);
+        ((PFNGLCOLOR4USPROC)Table<>::loaded[ENTRY_glColor4us])(red, green, blue, alpha);
+    }
+    inline void APIENTRY record_glColor4usv(const GLushort *v)
+    {
+        recorder().unsupported(ENTRY_glColor4usv);
+        ((PFNGLCOLOR4USVPROC)Table<>::loaded[ENTRY_glColor4usv])(v);
+    }
+    inline void APIENTRY record_glEdgeFlag(GLboolean flag)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glEdgeFlag);
+        trace.value(flag);
+        ((PFNGLEDGEFLAGPROC)Table<>::loaded[ENTRY_glEdgeFlag])(flag);
+    }
+    inline void APIENTRY record_glEdgeFlagv(const GLboolean *flag)
+    {
+        recorder().unsupported(ENTRY_glEdgeFlagv);
+        ((PFNGLEDGEFLAGVPROC)Table<>::loaded[ENTRY_glEdgeFlagv])(flag);
+    }
+    inline void APIENTRY record_glEnd(void)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glEnd);
+        ((PFNGLENDPROC)Table<>::loaded[ENTRY_glEnd])();
+    }
+    inline void APIENTRY record_glIndexd(GLdouble c)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glIndexd);
+        trace.value(c);
+        ((PFNGLINDEXDPROC)Table<>::loaded[ENTRY_glIndexd])(c);
+    }
+    inline void APIENTRY record_glIndexdv(const GLdouble *c)
+    {
+        recorder().unsupported(ENTRY_glIndexdv);
+        ((PFNGLINDEXDVPROC)Table<>::loaded[ENTRY_glIndexdv])(c);
+    }
+    inline void APIENTRY record_glIndexf(GLfloat c)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glIndexf);
+        trace.value(c);
+        ((PFNGLINDEXFPROC)Table<>::loaded[ENTRY_glIndexf])(c);
+    }
+    inline void APIENTRY record_glIndexfv(const GLfloat *c)
+    {
+        recorder().unsupported(ENTRY_glIndexfv);
+        ((PFNGLINDEXFVPROC)Table<>::loaded[ENTRY_glIndexfv])(c);
+    }
+    inline void APIENTRY record_glIndexi(GLint c)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glIndexi);
+        trace.value(c);
+        ((PFNGLINDEXIPROC)Table<>::loaded[ENTRY_glIndexi])(c);
+    }
+    inline void APIENTRY record_glIndexiv(const GLint *c)
+    {
+        recorder().unsupported(ENTRY_glIndexiv);
+        ((PFNGLINDEXIVPROC)Table<>::loaded[ENTRY_glIndexiv])(c);
+    }
+    inline void APIENTRY record_glIndexs(GLshort c)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glIndexs);
+        trace.value(c);
+        ((PFNGLINDEXSPROC)Table<>::loaded[ENTRY_glIndexs])(c);
+    }
+    inline void APIENTRY record_glIndexsv(const GLshort *c)
+    {
+        recorder().unsupported(ENTRY_glIndexsv);
+        ((PFNGLINDEXSVPROC)Table<>::loaded[ENTRY_glIndexsv])(c);
+    }
+    inline void APIENTRY record_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glNormal3b);
+        trace.value(nx);
+        trace.value(ny);
+        trace.value(nz);
+        ((PFNGLNORMAL3BPROC)Table<>::loaded[ENTRY_glNormal3b])(nx, ny, nz);
+    }
+    inline void APIENTRY record_glNormal3bv(const GLbyte *v)
+    {
+        recorder().unsupported(ENTRY_glNormal3bv);
+        ((PFNGLNORMAL3BVPROC)Table<>::loaded[ENTRY_glNormal3bv])(v);
+    }
+    inline void APIENTRY record_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glNormal3d);
+        trace.value(nx);
+        trace.value(ny);
+        trace.value(nz);
+        ((PFNGLNORMAL3DPROC)Table<>::loaded[ENTRY_glNormal3d])(nx, ny, nz);
+    }
+    inline void APIENTRY record_glNormal3dv(const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glNormal3dv);
+        ((PFNGLNORMAL3DVPROC)Table<>::loaded[ENTRY_glNormal3dv])(v);
+    }
+    inline void APIENTRY record_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glNormal3f);
+        trace.value(nx);
+        trace.value(ny);
+        trace.value(nz);
+        ((PFNGLNORMAL3FPROC)Table<>::loaded[ENTRY_glNormal3f])(nx, ny, nz);
+    }
+    inline void APIENTRY record_glNormal3fv(const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glNormal3fv);
+        ((PFNGLNORMAL3FVPROC)Table<>::loaded[ENTRY_glNormal3fv])(v);
+    }
+    inline void APIENTRY record_glNormal3i(GLint nx, GLint ny, GLint nz)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glNormal3i);
+        trace.value(nx);
+        trace.value(ny);
+        trace.value(nz);
+        ((PFNGLNORMAL3IPROC)Table<>::loaded[ENTRY_glNormal3i])(nx, ny, nz);
+    }
+    inline void APIENTRY record_glNormal3iv(const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glNormal3iv);
+        ((PFNGLNORMAL3IVPROC)Table<>::loaded[ENTRY_glNormal3iv])(v);
+    }
+    inline void APIENTRY record_glNormal3s(GLshort nx, GLshort ny, GLshort nz)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glNormal3s);
+        trace.value(nx);
+        trace.value(ny);
+        trace.value(nz);
+        ((PFNGLNORMAL3SPROC)Table<>::loaded[ENTRY_glNormal3s])(nx, ny, nz);
+    }
+    inline void APIENTRY record_glNormal3sv(const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glNormal3sv);
+        ((PFNGLNORMAL3SVPROC)Table<>::loaded[ENTRY_glNormal3sv])(v);
+    }
+    inline void APIENTRY record_glRasterPos2d(GLdouble x, GLdouble y)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRasterPos2d);
+        trace.value(x);
+        trace.value(y);
+        ((PFNGLRASTERPOS2DPROC)Table<>::loaded[ENTRY_glRasterPos2d])(x, y);
+    }
+    inline void APIENTRY record_glRasterPos2dv(const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glRasterPos2dv);
+        ((PFNGLRASTERPOS2DVPROC)Table<>::loaded[ENTRY_glRasterPos2dv])(v);
+    }
+    inline void APIENTRY record_glRasterPos2f(GLfloat x, GLfloat y)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRasterPos2f);
+        trace.value(x);
+        trace.value(y);
+        ((PFNGLRASTERPOS2FPROC)Table<>::loaded[ENTRY_glRasterPos2f])(x, y);
+    }
+    inline void APIENTRY record_glRasterPos2fv(const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glRasterPos2fv);
+        ((PFNGLRASTERPOS2FVPROC)Table<>::loaded[ENTRY_glRasterPos2fv])(v);
+    }
+    inline void APIENTRY record_glRasterPos2i(GLint x, GLint y)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRasterPos2i);
+        trace.value(x);
+        trace.value(y);
+        ((PFNGLRASTERPOS2IPROC)Table<>::loaded[ENTRY_glRasterPos2i])(x, y);
+    }
+    inline void APIENTRY record_glRasterPos2iv(const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glRasterPos2iv);
+        ((PFNGLRASTERPOS2IVPROC)Table<>::loaded[ENTRY_glRasterPos2iv])(v);
+    }
+    inline void APIENTRY record_glRasterPos2s(GLshort x, GLshort y)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRasterPos2s);
+        trace.value(x);
+        trace.value(y);
+        ((PFNGLRASTERPOS2SPROC)Table<>::loaded[ENTRY_glRasterPos2s])(x, y);
+    }
+    inline void APIENTRY record_glRasterPos2sv(const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glRasterPos2sv);
+        ((PFNGLRASTERPOS2SVPROC)Table<>::loaded[ENTRY_glRasterPos2sv])(v);
+    }
+    inline void APIENTRY record_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRasterPos3d);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLRASTERPOS3DPROC)Table<>::loaded[ENTRY_glRasterPos3d])(x, y, z);
+    }
+    inline void APIENTRY record_glRasterPos3dv(const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glRasterPos3dv);
+        ((PFNGLRASTERPOS3DVPROC)Table<>::loaded[ENTRY_glRasterPos3dv])(v);
+    }
+    inline void APIENTRY record_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRasterPos3f);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLRASTERPOS3FPROC)Table<>::loaded[ENTRY_glRasterPos3f])(x, y, z);
+    }
+    inline void APIENTRY record_glRasterPos3fv(const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glRasterPos3fv);
+        ((PFNGLRASTERPOS3FVPROC)Table<>::loaded[ENTRY_glRasterPos3fv])(v);
+    }
+    inline void APIENTRY record_glRasterPos3i(GLint x, GLint y, GLint z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRasterPos3i);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLRASTERPOS3IPROC)Table<>::loaded[ENTRY_glRasterPos3i])(x, y, z);
+    }
+    inline void APIENTRY record_glRasterPos3iv(const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glRasterPos3iv);
+        ((PFNGLRASTERPOS3IVPROC)Table<>::loaded[ENTRY_glRasterPos3iv])(v);
+    }
+    inline void APIENTRY record_glRasterPos3s(GLshort x, GLshort y, GLshort z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRasterPos3s);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLRASTERPOS3SPROC)Table<>::loaded[ENTRY_glRasterPos3s])(x, y, z);
+    }
+    inline void APIENTRY record_glRasterPos3sv(const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glRasterPos3sv);
+        ((PFNGLRASTERPOS3SVPROC)Table<>::loaded[ENTRY_glRasterPos3sv])(v);
+    }
+    inline void APIENTRY record_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRasterPos4d);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        trace.value(w);
+        ((PFNGLRASTERPOS4DPROC)Table<>::loaded[ENTRY_glRasterPos4d])(x, y, z, w);
+    }
+    inline void APIENTRY record_glRasterPos4dv(const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glRasterPos4dv);
+        ((PFNGLRASTERPOS4DVPROC)Table<>::loaded[ENTRY_glRasterPos4dv])(v);
+    }
+    inline void APIENTRY record_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRasterPos4f);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        trace.value(w);
+        ((PFNGLRASTERPOS4FPROC)Table<>::loaded[ENTRY_glRasterPos4f])(x, y, z, w);
+    }
+    inline void APIENTRY record_glRasterPos4fv(const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glRasterPos4fv);
+        ((PFNGLRASTERPOS4FVPROC)Table<>::loaded[ENTRY_glRasterPos4fv])(v);
+    }
+    inline void APIENTRY record_glRasterPos4i(GLint x, GLint y, GLint z, GLint w)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRasterPos4i);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        trace.value(w);
+        ((PFNGLRASTERPOS4IPROC)Table<>::loaded[ENTRY_glRasterPos4i])(x, y, z, w);
+    }
+    inline void APIENTRY record_glRasterPos4iv(const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glRasterPos4iv);
+        ((PFNGLRASTERPOS4IVPROC)Table<>::loaded[ENTRY_glRasterPos4iv])(v);
+    }
+    inline void APIENTRY record_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRasterPos4s);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        trace.value(w);
+        ((PFNGLRASTERPOS4SPROC)Table<>::loaded[ENTRY_glRasterPos4s])(x, y, z, w);
+    }
+    inline void APIENTRY record_glRasterPos4sv(const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glRasterPos4sv);
+        ((PFNGLRASTERPOS4SVPROC)Table<>::loaded[ENTRY_glRasterPos4sv])(v);
+    }
+    inline void APIENTRY record_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRectd);
+        trace.value(x1);
+        trace.value(y1);
+        trace.value(x2);
+        trace.value(y2);
+        ((PFNGLRECTDPROC)Table<>::loaded[ENTRY_glRectd])(x1, y1, x2, y2);
+    }
+    inline void APIENTRY record_glRectdv(const GLdouble *v1, const GLdouble *v2)
+    {
+        recorder().unsupported(ENTRY_glRectdv);
+        ((PFNGLRECTDVPROC)Table<>::loaded[ENTRY_glRectdv])(v1, v2);
+    }
+    inline void APIENTRY record_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRectf);
+        trace.value(x1);
+        trace.value(y1);
+        trace.value(x2);
+        trace.value(y2);
+        ((PFNGLRECTFPROC)Table<>::loaded[ENTRY_glRectf])(x1, y1, x2, y2);
+    }
+    inline void APIENTRY record_glRectfv(const GLfloat *v1, const GLfloat *v2)
+    {
+        recorder().unsupported(ENTRY_glRectfv);
+        ((PFNGLRECTFVPROC)Table<>::loaded[ENTRY_glRectfv])(v1, v2);
+    }
+    inline void APIENTRY record_glRecti(GLint x1, GLint y1, GLint x2, GLint y2)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRecti);
+        trace.value(x1);
+        trace.value(y1);
+        trace.value(x2);
+        trace.value(y2);
+        ((PFNGLRECTIPROC)Table<>::loaded[ENTRY_glRecti])(x1, y1, x2, y2);
+    }
+    inline void APIENTRY record_glRectiv(const GLint *v1, const GLint *v2)
+    {
+        recorder().unsupported(ENTRY_glRectiv);
+        ((PFNGLRECTIVPROC)Table<>::loaded[ENTRY_glRectiv])(v1, v2);
+    }
+    inline void APIENTRY record_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRects);
+        trace.value(x1);
+        trace.value(y1);
+        trace.value(x2);
+        trace.value(y2);
+        ((PFNGLRECTSPROC)Table<>::loaded[ENTRY_glRects])(x1, y1, x2, y2);
+    }
+    inline void APIENTRY record_glRectsv(const GLshort *v1, const GLshort *v2)
+    {
+        recorder().unsupported(ENTRY_glRectsv);
+        ((PFNGLRECTSVPROC)Table<>::loaded[ENTRY_glRectsv])(v1, v2);
+    }
+    inline void APIENTRY record_glTexCoord1d(GLdouble s)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoord1d);
+        trace.value(s);
+        ((PFNGLTEXCOORD1DPROC)Table<>::loaded[ENTRY_glTexCoord1d])(s);
+    }
+    inline void APIENTRY record_glTexCoord1dv(const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glTexCoord1dv);
+        ((PFNGLTEXCOORD1DVPROC)Table<>::loaded[ENTRY_glTexCoord1dv])(v);
+    }
+    inline void APIENTRY record_glTexCoord1f(GLfloat s)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoord1f);
+        trace.value(s);
+        ((PFNGLTEXCOORD1FPROC)Table<>::loaded[ENTRY_glTexCoord1f])(s);
+    }
+    inline void APIENTRY record_glTexCoord1fv(const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glTexCoord1fv);
+        ((PFNGLTEXCOORD1FVPROC)Table<>::loaded[ENTRY_glTexCoord1fv])(v);
+    }
+    inline void APIENTRY record_glTexCoord1i(GLint s)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoord1i);
+        trace.value(s);
+        ((PFNGLTEXCOORD1IPROC)Table<>::loaded[ENTRY_glTexCoord1i])(s);
+    }
+    inline void APIENTRY record_glTexCoord1iv(const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glTexCoord1iv);
+        ((PFNGLTEXCOORD1IVPROC)Table<>::loaded[ENTRY_glTexCoord1iv])(v);
+    }
+    inline void APIENTRY record_glTexCoord1s(GLshort s)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoord1s);
+        trace.value(s);
+        ((PFNGLTEXCOORD1SPROC)Table<>::loaded[ENTRY_glTexCoord1s])(s);
+    }
+    inline void APIENTRY record_glTexCoord1sv(const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glTexCoord1sv);
+        ((PFNGLTEXCOORD1SVPROC)Table<>::loaded[ENTRY_glTexCoord1sv])(v);
+    }
+    inline void APIENTRY record_glTexCoord2d(GLdouble s, GLdouble t)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoord2d);
+        trace.value(s);
+        trace.value(t);
+        ((PFNGLTEXCOORD2DPROC)Table<>::loaded[ENTRY_glTexCoord2d])(s, t);
+    }
+    inline void APIENTRY record_glTexCoord2dv(const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glTexCoord2dv);
+        ((PFNGLTEXCOORD2DVPROC)Table<>::loaded[ENTRY_glTexCoord2dv])(v);
+    }
+    inline void APIENTRY record_glTexCoord2f(GLfloat s, GLfloat t)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoord2f);
+        trace.value(s);
+        trace.value(t);
+        ((PFNGLTEXCOORD2FPROC)Table<>::loaded[ENTRY_glTexCoord2f])(s, t);
+    }
+    inline void APIENTRY record_glTexCoord2fv(const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glTexCoord2fv);
+        ((PFNGLTEXCOORD2FVPROC)Table<>::loaded[ENTRY_glTexCoord2fv])(v);
+    }
+    inline void APIENTRY record_glTexCoord2i(GLint s, GLint t)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoord2i);
+        trace.value(s);
+        trace.value(t);
+        ((PFNGLTEXCOORD2IPROC)Table<>::loaded[ENTRY_glTexCoord2i])(s, t);
+    }
+    inline void APIENTRY record_glTexCoord2iv(const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glTexCoord2iv);
+        ((PFNGLTEXCOORD2IVPROC)Table<>::loaded[ENTRY_glTexCoord2iv])(v);
+    }
+    inline void APIENTRY record_glTexCoord2s(GLshort s, GLshort t)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoord2s);
+        trace.value(s);
+        trace.value(t);
+        ((PFNGLTEXCOORD2SPROC)Table<>::loaded[ENTRY_glTexCoord2s])(s, t);
+    }
+    inline void APIENTRY record_glTexCoord2sv(const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glTexCoord2sv);
+        ((PFNGLTEXCOORD2SVPROC)Table<>::loaded[ENTRY_glTexCoord2sv])(v);
+    }
+    inline void APIENTRY record_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoord3d);
+        trace.value(s);
+        trace.value(t);
+        trace.value(r);
+        ((PFNGLTEXCOORD3DPROC)Table<>::loaded[ENTRY_glTexCoord3d])(s, t, r);
+    }
+    inline void APIENTRY record_glTexCoord3dv(const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glTexCoord3dv);
+        ((PFNGLTEXCOORD3DVPROC)Table<>::loaded[ENTRY_glTexCoord3dv])(v);
+    }
+    inline void APIENTRY record_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoord3f);
+        trace.value(s);
+        trace.value(t);
+        trace.value(r);
+        ((PFNGLTEXCOORD3FPROC)Table<>::loaded[ENTRY_glTexCoord3f])(s, t, r);
+    }
+    inline void APIENTRY record_glTexCoord3fv(const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glTexCoord3fv);
+        ((PFNGLTEXCOORD3FVPROC)Table<>::loaded[ENTRY_glTexCoord3fv])(v);
+    }
+    inline void APIENTRY record_glTexCoord3i(GLint s, GLint t, GLint r)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoord3i);
+        trace.value(s);
+        trace.value(t);
+        trace.value(r);
+        ((PFNGLTEXCOORD3IPROC)Table<>::loaded[ENTRY_glTexCoord3i])(s, t, r);
+    }
+    inline void APIENTRY record_glTexCoord3iv(const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glTexCoord3iv);
+        ((PFNGLTEXCOORD3IVPROC)Table<>::loaded[ENTRY_glTexCoord3iv])(v);
+    }
+    inline void APIENTRY record_glTexCoord3s(GLshort s, GLshort t, GLshort r)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoord3s);
+        trace.value(s);
+        trace.value(t);
+        trace.value(r);
+        ((PFNGLTEXCOORD3SPROC)Table<>::loaded[ENTRY_glTexCoord3s])(s, t, r);
+    }
+    inline void APIENTRY record_glTexCoord3sv(const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glTexCoord3sv);
+        ((PFNGLTEXCOORD3SVPROC)Table<>::loaded[ENTRY_glTexCoord3sv])(v);
+    }
+    inline void APIENTRY record_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoord4d);
+        trace.value(s);
+        trace.value(t);
+        trace.value(r);
+        trace.value(q);
+        ((PFNGLTEXCOORD4DPROC)Table<>::loaded[ENTRY_glTexCoord4d])(s, t, r, q);
+    }
+    inline void APIENTRY record_glTexCoord4dv(const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glTexCoord4dv);
+        ((PFNGLTEXCOORD4DVPROC)Table<>::loaded[ENTRY_glTexCoord4dv])(v);
+    }
+    inline void APIENTRY record_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoord4f);
+        trace.value(s);
+        trace.value(t);
+        trace.value(r);
+        trace.value(q);
+        ((PFNGLTEXCOORD4FPROC)Table<>::loaded[ENTRY_glTexCoord4f])(s, t, r, q);
+    }
+    inline void APIENTRY record_glTexCoord4fv(const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glTexCoord4fv);
+        ((PFNGLTEXCOORD4FVPROC)Table<>::loaded[ENTRY_glTexCoord4fv])(v);
+    }
+    inline void APIENTRY record_glTexCoord4i(GLint s, GLint t, GLint r, GLint q)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoord4i);
+        trace.value(s);
+        trace.value(t);
+        trace.value(r);
+        trace.value(q);
+        ((PFNGLTEXCOORD4IPROC)Table<>::loaded[ENTRY_glTexCoord4i])(s, t, r, q);
+    }
+    inline void APIENTRY record_glTexCoord4iv(const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glTexCoord4iv);
+        ((PFNGLTEXCOORD4IVPROC)Table<>::loaded[ENTRY_glTexCoord4iv])(v);
+    }
+    inline void APIENTRY record_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoord4s);
+        trace.value(s);
+        trace.value(t);
+        trace.value(r);
+        trace.value(q);
+        ((PFNGLTEXCOORD4SPROC)Table<>::loaded[ENTRY_glTexCoord4s])(s, t, r, q);
+    }
+    inline void APIENTRY record_glTexCoord4sv(const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glTexCoord4sv);
+        ((PFNGLTEXCOORD4SVPROC)Table<>::loaded[ENTRY_glTexCoord4sv])(v);
+    }
+    inline void APIENTRY record_glVertex2d(GLdouble x, GLdouble y)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertex2d);
+        trace.value(x);
+        trace.value(y);
+        ((PFNGLVERTEX2DPROC)Table<>::loaded[ENTRY_glVertex2d])(x, y);
+    }
+    inline void APIENTRY record_glVertex2dv(const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glVertex2dv);
+        ((PFNGLVERTEX2DVPROC)Table<>::loaded[ENTRY_glVertex2dv])(v);
+    }
+    inline void APIENTRY record_glVertex2f(GLfloat x, GLfloat y)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertex2f);
+        trace.value(x);
+        trace.value(y);
+        ((PFNGLVERTEX2FPROC)Table<>::loaded[ENTRY_glVertex2f])(x, y);
+    }
+    inline void APIENTRY record_glVertex2fv(const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glVertex2fv);
+        ((PFNGLVERTEX2FVPROC)Table<>::loaded[ENTRY_glVertex2fv])(v);
+    }
+    inline void APIENTRY record_glVertex2i(GLint x, GLint y)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertex2i);
+        trace.value(x);
+        trace.value(y);
+        ((PFNGLVERTEX2IPROC)Table<>::loaded[ENTRY_glVertex2i])(x, y);
+    }
+    inline void APIENTRY record_glVertex2iv(const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glVertex2iv);
+        ((PFNGLVERTEX2IVPROC)Table<>::loaded[ENTRY_glVertex2iv])(v);
+    }
+    inline void APIENTRY record_glVertex2s(GLshort x, GLshort y)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertex2s);
+        trace.value(x);
+        trace.value(y);
+        ((PFNGLVERTEX2SPROC)Table<>::loaded[ENTRY_glVertex2s])(x, y);
+    }
+    inline void APIENTRY record_glVertex2sv(const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glVertex2sv);
+        ((PFNGLVERTEX2SVPROC)Table<>::loaded[ENTRY_glVertex2sv])(v);
+    }
+    inline void APIENTRY record_glVertex3d(GLdouble x, GLdouble y, GLdouble z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertex3d);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLVERTEX3DPROC)Table<>::loaded[ENTRY_glVertex3d])(x, y, z);
+    }
+    inline void APIENTRY record_glVertex3dv(const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glVertex3dv);
+        ((PFNGLVERTEX3DVPROC)Table<>::loaded[ENTRY_glVertex3dv])(v);
+    }
+    inline void APIENTRY record_glVertex3f(GLfloat x, GLfloat y, GLfloat z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertex3f);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLVERTEX3FPROC)Table<>::loaded[ENTRY_glVertex3f])(x, y, z);
+    }
+    inline void APIENTRY record_glVertex3fv(const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glVertex3fv);
+        ((PFNGLVERTEX3FVPROC)Table<>::loaded[ENTRY_glVertex3fv])(v);
+    }
+    inline void APIENTRY record_glVertex3i(GLint x, GLint y, GLint z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertex3i);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLVERTEX3IPROC)Table<>::loaded[ENTRY_glVertex3i])(x, y, z);
+    }
+    inline void APIENTRY record_glVertex3iv(const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glVertex3iv);
+        ((PFNGLVERTEX3IVPROC)Table<>::loaded[ENTRY_glVertex3iv])(v);
+    }
+    inline void APIENTRY record_glVertex3s(GLshort x, GLshort y, GLshort z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertex3s);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLVERTEX3SPROC)Table<>::loaded[ENTRY_glVertex3s])(x, y, z);
+    }
+    inline void APIENTRY record_glVertex3sv(const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glVertex3sv);
+        ((PFNGLVERTEX3SVPROC)Table<>::loaded[ENTRY_glVertex3sv])(v);
+    }
+    inline void APIENTRY record_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertex4d);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        trace.value(w);
+        ((PFNGLVERTEX4DPROC)Table<>::loaded[ENTRY_glVertex4d])(x, y, z, w);
+    }
+    inline void APIENTRY record_glVertex4dv(const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glVertex4dv);
+        ((PFNGLVERTEX4DVPROC)Table<>::loaded[ENTRY_glVertex4dv])(v);
+    }
+    inline void APIENTRY record_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertex4f);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        trace.value(w);
+        ((PFNGLVERTEX4FPROC)Table<>::loaded[ENTRY_glVertex4f])(x, y, z, w);
+    }
+    inline void APIENTRY record_glVertex4fv(const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glVertex4fv);
+        ((PFNGLVERTEX4FVPROC)Table<>::loaded[ENTRY_glVertex4fv])(v);
+    }
+    inline void APIENTRY record_glVertex4i(GLint x, GLint y, GLint z, GLint w)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertex4i);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        trace.value(w);
+        ((PFNGLVERTEX4IPROC)Table<>::loaded[ENTRY_glVertex4i])(x, y, z, w);
+    }
+    inline void APIENTRY record_glVertex4iv(const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glVertex4iv);
+        ((PFNGLVERTEX4IVPROC)Table<>::loaded[ENTRY_glVertex4iv])(v);
+    }
+    inline void APIENTRY record_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertex4s);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        trace.value(w);
+        ((PFNGLVERTEX4SPROC)Table<>::loaded[ENTRY_glVertex4s])(x, y, z, w);
+    }
+    inline void APIENTRY record_glVertex4sv(const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glVertex4sv);
+        ((PFNGLVERTEX4SVPROC)Table<>::loaded[ENTRY_glVertex4sv])(v);
+    }
+    inline void APIENTRY record_glClipPlane(GLenum plane, const GLdouble *equation)
+    {
+        recorder().unsupported(ENTRY_glClipPlane);
+        ((PFNGLCLIPPLANEPROC)Table<>::loaded[ENTRY_glClipPlane])(plane, equation);
+    }
+    inline void APIENTRY record_glColorMaterial(GLenum face, GLenum mode)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColorMaterial);
+        trace.value(face);
+        trace.value(mode);
+        ((PFNGLCOLORMATERIALPROC)Table<>::loaded[ENTRY_glColorMaterial])(face, mode);
+    }
+    inline void APIENTRY record_glFogf(GLenum pname, GLfloat param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glFogf);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLFOGFPROC)Table<>::loaded[ENTRY_glFogf])(pname, param);
+    }
+    inline void APIENTRY record_glFogfv(GLenum pname, const GLfloat *params)
+    {
+        recorder().unsupported(ENTRY_glFogfv);
+        ((PFNGLFOGFVPROC)Table<>::loaded[ENTRY_glFogfv])(pname, params);
+    }
+    inline void APIENTRY record_glFogi(GLenum pname, GLint param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glFogi);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLFOGIPROC)Table<>::loaded[ENTRY_glFogi])(pname, param);
+    }
+    inline void APIENTRY record_glFogiv(GLenum pname, const GLint *params)
+    {
+        recorder().unsupported(ENTRY_glFogiv);
+        ((PFNGLFOGIVPROC)Table<>::loaded[ENTRY_glFogiv])(pname, params);
+    }
+    inline void APIENTRY record_glLightf(GLenum light, GLenum pname, GLfloat param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glLightf);
+        trace.value(light);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLLIGHTFPROC)Table<>::loaded[ENTRY_glLightf])(light, pname, param);
+    }
+    inline void APIENTRY record_glLightfv(GLenum light, GLenum pname, const GLfloat *params)
+    {
+        recorder().unsupported(ENTRY_glLightfv);
+        ((PFNGLLIGHTFVPROC)Table<>::loaded[ENTRY_glLightfv])(light, pname, params);
+    }
+    inline void APIENTRY record_glLighti(GLenum light, GLenum pname, GLint param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glLighti);
+        trace.value(light);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLLIGHTIPROC)Table<>::loaded[ENTRY_glLighti])(light, pname, param);
+    }
+    inline void APIENTRY record_glLightiv(GLenum light, GLenum pname, const GLint *params)
+    {
+        recorder().unsupported(ENTRY_glLightiv);
+        ((PFNGLLIGHTIVPROC)Table<>::loaded[ENTRY_glLightiv])(light, pname, params);
+    }
+    inline void APIENTRY record_glLightModelf(GLenum pname, GLfloat param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glLightModelf);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLLIGHTMODELFPROC)Table<>::loaded[ENTRY_glLightModelf])(pname, param);
+    }
+    inline void APIENTRY record_glLightModelfv(GLenum pname, const GLfloat *params)
+    {
+        recorder().unsupported(ENTRY_glLightModelfv);
+        ((PFNGLLIGHTMODELFVPROC)Table<>::loaded[ENTRY_glLightModelfv])(pname, params);
+    }
+    inline void APIENTRY record_glLightModeli(GLenum pname, GLint param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glLightModeli);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLLIGHTMODELIPROC)Table<>::loaded[ENTRY_glLightModeli])(pname, param);
+    }
+    inline void APIENTRY record_glLightModeliv(GLenum pname, const GLint *params)
+    {
+        recorder().unsupported(ENTRY_glLightModeliv);
+        ((PFNGLLIGHTMODELIVPROC)Table<>::loaded[ENTRY_glLightModeliv])(pname, params);
+    }
+    inline void APIENTRY record_glLineStipple(GLint factor, GLushort pattern)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glLineStipple);
+        trace.value(factor);
+        trace.value(pattern);
+        ((PFNGLLINESTIPPLEPROC)Table<>::loaded[ENTRY_glLineStipple])(factor, pattern);
+    }
+    inline void APIENTRY record_glMaterialf(GLenum face, GLenum pname, GLfloat param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMaterialf);
+        trace.value(face);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLMATERIALFPROC)Table<>::loaded[ENTRY_glMaterialf])(face, pname, param);
+    }
+    inline void APIENTRY record_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params)
+    {
+        recorder().unsupported(ENTRY_glMaterialfv);
+        ((PFNGLMATERIALFVPROC)Table<>::loaded[ENTRY_glMaterialfv])(face, pname, params);
+    }
+    inline void APIENTRY record_glMateriali(GLenum face, GLenum pname, GLint param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMateriali);
+        trace.value(face);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLMATERIALIPROC)Table<>::loaded[ENTRY_glMateriali])(face, pname, param);
+    }
+    inline void APIENTRY record_glMaterialiv(GLenum face, GLenum pname, const GLint *params)
+    {
+        recorder().unsupported(ENTRY_glMaterialiv);
+        ((PFNGLMATERIALIVPROC)Table<>::loaded[ENTRY_glMaterialiv])(face, pname, params);
+    }
+    inline void APIENTRY record_glPolygonStipple(const GLubyte *mask)
+    {
+        recorder().unsupported(ENTRY_glPolygonStipple);
+        ((PFNGLPOLYGONSTIPPLEPROC)Table<>::loaded[ENTRY_glPolygonStipple])(mask);
+    }
+    inline void APIENTRY record_glShadeModel(GLenum mode)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glShadeModel);
+        trace.value(mode);
+        ((PFNGLSHADEMODELPROC)Table<>::loaded[ENTRY_glShadeModel])(mode);
+    }
+    inline void APIENTRY record_glTexEnvf(GLenum target, GLenum pname, GLfloat param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexEnvf);
+        trace.value(target);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLTEXENVFPROC)Table<>::loaded[ENTRY_glTexEnvf])(target, pname, param);
+    }
+    inline void APIENTRY record_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params)
+    {
+        recorder().unsupported(ENTRY_glTexEnvfv);
+        ((PFNGLTEXENVFVPROC)Table<>::loaded[ENTRY_glTexEnvfv])(target, pname, params);
+    }
+    inline void APIENTRY record_glTexEnvi(GLenum target, GLenum pname, GLint param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexEnvi);
+        trace.value(target);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLTEXENVIPROC)Table<>::loaded[ENTRY_glTexEnvi])(target, pname, param);
+    }
+    inline void APIENTRY record_glTexEnviv(GLenum target, GLenum pname, const GLint *params)
+    {
+        recorder().unsupported(ENTRY_glTexEnviv);
+        ((PFNGLTEXENVIVPROC)Table<>::loaded[ENTRY_glTexEnviv])(target, pname, params);
+    }
+    inline void APIENTRY record_glTexGend(GLenum coord, GLenum pname, GLdouble param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexGend);
+        trace.value(coord);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLTEXGENDPROC)Table<>::loaded[ENTRY_glTexGend])(coord, pname, param);
+    }
+    inline void APIENTRY record_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params)
+    {
+        recorder().unsupported(ENTRY_glTexGendv);
+        ((PFNGLTEXGENDVPROC)Table<>::loaded[ENTRY_glTexGendv])(coord, pname, params);
+    }
+    inline void APIENTRY record_glTexGenf(GLenum coord, GLenum pname, GLfloat param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexGenf);
+        trace.value(coord);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLTEXGENFPROC)Table<>::loaded[ENTRY_glTexGenf])(coord, pname, param);
+    }
+    inline void APIENTRY record_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params)
+    {
+        recorder().unsupported(ENTRY_glTexGenfv);
+        ((PFNGLTEXGENFVPROC)Table<>::loaded[ENTRY_glTexGenfv])(coord, pname, params);
+    }
+    inline void APIENTRY record_glTexGeni(GLenum coord, GLenum pname, GLint param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexGeni);
+        trace.value(coord);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLTEXGENIPROC)Table<>::loaded[ENTRY_glTexGeni])(coord, pname, param);
+    }
+    inline void APIENTRY record_glTexGeniv(GLenum coord, GLenum pname, const GLint *params)
+    {
+        recorder().unsupported(ENTRY_glTexGeniv);
+        ((PFNGLTEXGENIVPROC)Table<>::loaded[ENTRY_glTexGeniv])(coord, pname, params);
+    }
+    inline void APIENTRY record_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer)
+    {
+        recorder().unsupported(ENTRY_glFeedbackBuffer);
+        ((PFNGLFEEDBACKBUFFERPROC)Table<>::loaded[ENTRY_glFeedbackBuffer])(size, type, buffer);
+    }
+    inline void APIENTRY record_glSelectBuffer(GLsizei size, GLuint *buffer)
+    {
+        recorder().unsupported(ENTRY_glSelectBuffer);
+        ((PFNGLSELECTBUFFERPROC)Table<>::loaded[ENTRY_glSelectBuffer])(size, buffer);
+    }
+    inline void APIENTRY record_glInitNames(void)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glInitNames);
+        ((PFNGLINITNAMESPROC)Table<>::loaded[ENTRY_glInitNames])();
+    }
+    inline void APIENTRY record_glLoadName(GLuint name)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glLoadName);
+        trace.value(name);
+        ((PFNGLLOADNAMEPROC)Table<>::loaded[ENTRY_glLoadName])(name);
+    }
+    inline void APIENTRY record_glPassThrough(GLfloat token)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPassThrough);
+        trace.value(token);
+        ((PFNGLPASSTHROUGHPROC)Table<>::loaded[ENTRY_glPassThrough])(token);
+    }
+    inline void APIENTRY record_glPopName(void)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPopName);
+        ((PFNGLPOPNAMEPROC)Table<>::loaded[ENTRY_glPopName])();
+    }
+    inline void APIENTRY record_glPushName(GLuint name)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPushName);
+        trace.value(name);
+        ((PFNGLPUSHNAMEPROC)Table<>::loaded[ENTRY_glPushName])(name);
+    }
+    inline void APIENTRY record_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glClearAccum);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        trace.value(alpha);
+        ((PFNGLCLEARACCUMPROC)Table<>::loaded[ENTRY_glClearAccum])(red, green, blue, alpha);
+    }
+    inline void APIENTRY record_glClearIndex(GLfloat c)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glClearIndex);
+        trace.value(c);
+        ((PFNGLCLEARINDEXPROC)Table<>::loaded[ENTRY_glClearIndex])(c);
+    }
+    inline void APIENTRY record_glIndexMask(GLuint mask)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glIndexMask);
+        trace.value(mask);
+        ((PFNGLINDEXMASKPROC)Table<>::loaded[ENTRY_glIndexMask])(mask);
+    }
+    inline void APIENTRY record_glAccum(GLenum op, GLfloat value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glAccum);
+        trace.value(op);
+        trace.value(value);
+        ((PFNGLACCUMPROC)Table<>::loaded[ENTRY_glAccum])(op, value);
+    }
+    inline void APIENTRY record_glPopAttrib(void)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPopAttrib);
+        ((PFNGLPOPATTRIBPROC)Table<>::loaded[ENTRY_glPopAttrib])();
+    }
+    inline void APIENTRY record_glPushAttrib(GLbitfield mask)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPushAttrib);
+        trace.value(mask);
+        ((PFNGLPUSHATTRIBPROC)Table<>::loaded[ENTRY_glPushAttrib])(mask);
+    }
+    inline void APIENTRY record_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points)
+    {
+        recorder().unsupported(ENTRY_glMap1d);
+        ((PFNGLMAP1DPROC)Table<>::loaded[ENTRY_glMap1d])(target, u1, u2, stride, order, points);
+    }
+    inline void APIENTRY record_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points)
+    {
+        recorder().unsupported(ENTRY_glMap1f);
+        ((PFNGLMAP1FPROC)Table<>::loaded[ENTRY_glMap1f])(target, u1, u2, stride, order, points);
+    }
+    inline void APIENTRY record_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points)
+    {
+        recorder().unsupported(ENTRY_glMap2d);
+        ((PFNGLMAP2DPROC)Table<>::loaded[ENTRY_glMap2d])(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+    }
+    inline void APIENTRY record_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points)
+    {
+        recorder().unsupported(ENTRY_glMap2f);
+        ((PFNGLMAP2FPROC)Table<>::loaded[ENTRY_glMap2f])(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+    }
+    inline void APIENTRY record_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMapGrid1d);
+        trace.value(un);
+        trace.value(u1);
+        trace.value(u2);
+        ((PFNGLMAPGRID1DPROC)Table<>::loaded[ENTRY_glMapGrid1d])(un, u1, u2);
+    }
+    inline void APIENTRY record_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMapGrid1f);
+        trace.value(un);
+        trace.value(u1);
+        trace.value(u2);
+        ((PFNGLMAPGRID1FPROC)Table<>::loaded[ENTRY_glMapGrid1f])(un, u1, u2);
+    }
+    inline void APIENTRY record_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMapGrid2d);
+        trace.value(un);
+        trace.value(u1);
+        trace.value(u2);
+        trace.value(vn);
+        trace.value(v1);
+        trace.value(v2);
+        ((PFNGLMAPGRID2DPROC)Table<>::loaded[ENTRY_glMapGrid2d])(un, u1, u2, vn, v1, v2);
+    }
+    inline void APIENTRY record_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMapGrid2f);
+        trace.value(un);
+        trace.value(u1);
+        trace.value(u2);
+        trace.value(vn);
+        trace.value(v1);
+        trace.value(v2);
+        ((PFNGLMAPGRID2FPROC)Table<>::loaded[ENTRY_glMapGrid2f])(un, u1, u2, vn, v1, v2);
+    }
+    inline void APIENTRY record_glEvalCoord1d(GLdouble u)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glEvalCoord1d);
+        trace.value(u);
+        ((PFNGLEVALCOORD1DPROC)Table<>::loaded[ENTRY_glEvalCoord1d])(u);
+    }
+    inline void APIENTRY record_glEvalCoord1dv(const GLdouble *u)
+    {
+        recorder().unsupported(ENTRY_glEvalCoord1dv);
+        ((PFNGLEVALCOORD1DVPROC)Table<>::loaded[ENTRY_glEvalCoord1dv])(u);
+    }
+    inline void APIENTRY record_glEvalCoord1f(GLfloat u)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glEvalCoord1f);
+        trace.value(u);
+        ((PFNGLEVALCOORD1FPROC)Table<>::loaded[ENTRY_glEvalCoord1f])(u);
+    }
+    inline void APIENTRY record_glEvalCoord1fv(const GLfloat *u)
+    {
+        recorder().unsupported(ENTRY_glEvalCoord1fv);
+        ((PFNGLEVALCOORD1FVPROC)Table<>::loaded[ENTRY_glEvalCoord1fv])(u);
+    }
+    inline void APIENTRY record_glEvalCoord2d(GLdouble u, GLdouble v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glEvalCoord2d);
+        trace.value(u);
+        trace.value(v);
+        ((PFNGLEVALCOORD2DPROC)Table<>::loaded[ENTRY_glEvalCoord2d])(u, v);
+    }
+    inline void APIENTRY record_glEvalCoord2dv(const GLdouble *u)
+    {
+        recorder().unsupported(ENTRY_glEvalCoord2dv);
+        ((PFNGLEVALCOORD2DVPROC)Table<>::loaded[ENTRY_glEvalCoord2dv])(u);
+    }
+    inline void APIENTRY record_glEvalCoord2f(GLfloat u, GLfloat v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glEvalCoord2f);
+        trace.value(u);
+        trace.value(v);
+        ((PFNGLEVALCOORD2FPROC)Table<>::loaded[ENTRY_glEvalCoord2f])(u, v);
+    }
+    inline void APIENTRY record_glEvalCoord2fv(const GLfloat *u)
+    {
+        recorder().unsupported(ENTRY_glEvalCoord2fv);
+        ((PFNGLEVALCOORD2FVPROC)Table<>::loaded[ENTRY_glEvalCoord2fv])(u);
+    }
+    inline void APIENTRY record_glEvalMesh1(GLenum mode, GLint i1, GLint i2)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glEvalMesh1);
+        trace.value(mode);
+        trace.value(i1);
+        trace.value(i2);
+        ((PFNGLEVALMESH1PROC)Table<>::loaded[ENTRY_glEvalMesh1])(mode, i1, i2);
+    }
+    inline void APIENTRY record_glEvalPoint1(GLint i)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glEvalPoint1);
+        trace.value(i);
+        ((PFNGLEVALPOINT1PROC)Table<>::loaded[ENTRY_glEvalPoint1])(i);
+    }
+    inline void APIENTRY record_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glEvalMesh2);
+        trace.value(mode);
+        trace.value(i1);
+        trace.value(i2);
+        trace.value(j1);
+        trace.value(j2);
+        ((PFNGLEVALMESH2PROC)Table<>::loaded[ENTRY_glEvalMesh2])(mode, i1, i2, j1, j2);
+    }
+    inline void APIENTRY record_glEvalPoint2(GLint i, GLint j)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glEvalPoint2);
+        trace.value(i);
+        trace.value(j);
+        ((PFNGLEVALPOINT2PROC)Table<>::loaded[ENTRY_glEvalPoint2])(i, j);
+    }
+    inline void APIENTRY record_glAlphaFunc(GLenum func, GLfloat ref)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glAlphaFunc);
+        trace.value(func);
+        trace.value(ref);
+        ((PFNGLALPHAFUNCPROC)Table<>::loaded[ENTRY_glAlphaFunc])(func, ref);
+    }
+    inline void APIENTRY record_glPixelZoom(GLfloat xfactor, GLfloat yfactor)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPixelZoom);
+        trace.value(xfactor);
+        trace.value(yfactor);
+        ((PFNGLPIXELZOOMPROC)Table<>::loaded[ENTRY_glPixelZoom])(xfactor, yfactor);
+    }
+    inline void APIENTRY record_glPixelTransferf(GLenum pname, GLfloat param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPixelTransferf);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLPIXELTRANSFERFPROC)Table<>::loaded[ENTRY_glPixelTransferf])(pname, param);
+    }
+    inline void APIENTRY record_glPixelTransferi(GLenum pname, GLint param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPixelTransferi);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLPIXELTRANSFERIPROC)Table<>::loaded[ENTRY_glPixelTransferi])(pname, param);
+    }
+    inline void APIENTRY record_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values)
+    {
+        recorder().unsupported(ENTRY_glPixelMapfv);
+        ((PFNGLPIXELMAPFVPROC)Table<>::loaded[ENTRY_glPixelMapfv])(map, mapsize, values);
+    }
+    inline void APIENTRY record_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values)
+    {
+        recorder().unsupported(ENTRY_glPixelMapuiv);
+        ((PFNGLPIXELMAPUIVPROC)Table<>::loaded[ENTRY_glPixelMapuiv])(map, mapsize, values);
+    }
+    inline void APIENTRY record_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values)
+    {
+        recorder().unsupported(ENTRY_glPixelMapusv);
+        ((PFNGLPIXELMAPUSVPROC)Table<>::loaded[ENTRY_glPixelMapusv])(map, mapsize, values);
+    }
+    inline void APIENTRY record_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glCopyPixels);
+        trace.value(x);
+        trace.value(y);
+        trace.value(width);
+        trace.value(height);
+        trace.value(type);
+        ((PFNGLCOPYPIXELSPROC)Table<>::loaded[ENTRY_glCopyPixels])(x, y, width, height, type);
+    }
+    inline void APIENTRY record_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+    {
+        recorder().unsupported(ENTRY_glDrawPixels);
+        ((PFNGLDRAWPIXELSPROC)Table<>::loaded[ENTRY_glDrawPixels])(width, height, format, type, pixels);
+    }
+    inline void APIENTRY record_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glFrustum);
+        trace.value(left);
+        trace.value(right);
+        trace.value(bottom);
+        trace.value(top);
+        trace.value(zNear);
+        trace.value(zFar);
+        ((PFNGLFRUSTUMPROC)Table<>::loaded[ENTRY_glFrustum])(left, right, bottom, top, zNear, zFar);
+    }
+    inline void APIENTRY record_glLoadIdentity(void)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glLoadIdentity);
+        ((PFNGLLOADIDENTITYPROC)Table<>::loaded[ENTRY_glLoadIdentity])();
+    }
+    inline void APIENTRY record_glLoadMatrixf(const GLfloat *m)
+    {
+        recorder().unsupported(ENTRY_glLoadMatrixf);
+        ((PFNGLLOADMATRIXFPROC)Table<>::loaded[ENTRY_glLoadMatrixf])(m);
+    }
+    inline void APIENTRY record_glLoadMatrixd(const GLdouble *m)
+    {
+        recorder().unsupported(ENTRY_glLoadMatrixd);
+        ((PFNGLLOADMATRIXDPROC)Table<>::loaded[ENTRY_glLoadMatrixd])(m);
+    }
+    inline void APIENTRY record_glMatrixMode(GLenum mode)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMatrixMode);
+        trace.value(mode);
+        ((PFNGLMATRIXMODEPROC)Table<>::loaded[ENTRY_glMatrixMode])(mode);
+    }
+    inline void APIENTRY record_glMultMatrixf(const GLfloat *m)
+    {
+        recorder().unsupported(ENTRY_glMultMatrixf);
+        ((PFNGLMULTMATRIXFPROC)Table<>::loaded[ENTRY_glMultMatrixf])(m);
+    }
+    inline void APIENTRY record_glMultMatrixd(const GLdouble *m)
+    {
+        recorder().unsupported(ENTRY_glMultMatrixd);
+        ((PFNGLMULTMATRIXDPROC)Table<>::loaded[ENTRY_glMultMatrixd])(m);
+    }
+    inline void APIENTRY record_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glOrtho);
+        trace.value(left);
+        trace.value(right);
+        trace.value(bottom);
+        trace.value(top);
+        trace.value(zNear);
+        trace.value(zFar);
+        ((PFNGLORTHOPROC)Table<>::loaded[ENTRY_glOrtho])(left, right, bottom, top, zNear, zFar);
+    }
+    inline void APIENTRY record_glPopMatrix(void)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPopMatrix);
+        ((PFNGLPOPMATRIXPROC)Table<>::loaded[ENTRY_glPopMatrix])();
+    }
+    inline void APIENTRY record_glPushMatrix(void)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPushMatrix);
+        ((PFNGLPUSHMATRIXPROC)Table<>::loaded[ENTRY_glPushMatrix])();
+    }
+    inline void APIENTRY record_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRotated);
+        trace.value(angle);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLROTATEDPROC)Table<>::loaded[ENTRY_glRotated])(angle, x, y, z);
+    }
+    inline void APIENTRY record_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRotatef);
+        trace.value(angle);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLROTATEFPROC)Table<>::loaded[ENTRY_glRotatef])(angle, x, y, z);
+    }
+    inline void APIENTRY record_glScaled(GLdouble x, GLdouble y, GLdouble z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glScaled);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLSCALEDPROC)Table<>::loaded[ENTRY_glScaled])(x, y, z);
+    }
+    inline void APIENTRY record_glScalef(GLfloat x, GLfloat y, GLfloat z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glScalef);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLSCALEFPROC)Table<>::loaded[ENTRY_glScalef])(x, y, z);
+    }
+    inline void APIENTRY record_glTranslated(GLdouble x, GLdouble y, GLdouble z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTranslated);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLTRANSLATEDPROC)Table<>::loaded[ENTRY_glTranslated])(x, y, z);
+    }
+    inline void APIENTRY record_glTranslatef(GLfloat x, GLfloat y, GLfloat z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTranslatef);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLTRANSLATEFPROC)Table<>::loaded[ENTRY_glTranslatef])(x, y, z);
+    }
+    inline void APIENTRY record_glDrawArrays(GLenum mode, GLint first, GLsizei count)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDrawArrays);
+        trace.value(mode);
+        trace.value(first);
+        trace.value(count);
+        ((PFNGLDRAWARRAYSPROC)Table<>::loaded[ENTRY_glDrawArrays])(mode, first, count);
+    }
+    inline void APIENTRY record_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDrawElements);
+        trace.value(mode);
+        trace.value(count);
+        trace.value(type);
+        trace.offset(indices);
+        ((PFNGLDRAWELEMENTSPROC)Table<>::loaded[ENTRY_glDrawElements])(mode, count, type, indices);
+    }
+    inline void APIENTRY record_glPolygonOffset(GLfloat factor, GLfloat units)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPolygonOffset);
+        trace.value(factor);
+        trace.value(units);
+        ((PFNGLPOLYGONOFFSETPROC)Table<>::loaded[ENTRY_glPolygonOffset])(factor, units);
+    }
+    inline void APIENTRY record_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glCopyTexImage1D);
+        trace.value(target);
+        trace.value(level);
+        trace.value(internalformat);
+        trace.value(x);
+        trace.value(y);
+        trace.value(width);
+        trace.value(border);
+        ((PFNGLCOPYTEXIMAGE1DPROC)Table<>::loaded[ENTRY_glCopyTexImage1D])(target, level, internalformat, x, y, width, border);
+    }
+    inline void APIENTRY record_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glCopyTexImage2D);
+        trace.value(target);
+        trace.value(level);
+        trace.value(internalformat);
+        trace.value(x);
+        trace.value(y);
+        trace.value(width);
+        trace.value(height);
+        trace.value(border);
+        ((PFNGLCOPYTEXIMAGE2DPROC)Table<>::loaded[ENTRY_glCopyTexImage2D])(target, level, internalformat, x, y, width, height, border);
+    }
+    inline void APIENTRY record_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glCopyTexSubImage1D);
+        trace.value(target);
+        trace.value(level);
+        trace.value(xoffset);
+        trace.value(x);
+        trace.value(y);
+        trace.value(width);
+        ((PFNGLCOPYTEXSUBIMAGE1DPROC)Table<>::loaded[ENTRY_glCopyTexSubImage1D])(target, level, xoffset, x, y, width);
+    }
+    inline void APIENTRY record_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glCopyTexSubImage2D);
+        trace.value(target);
+        trace.value(level);
+        trace.value(xoffset);
+        trace.value(yoffset);
+        trace.value(x);
+        trace.value(y);
+        trace.value(width);
+        trace.value(height);
+        ((PFNGLCOPYTEXSUBIMAGE2DPROC)Table<>::loaded[ENTRY_glCopyTexSubImage2D])(target, level, xoffset, yoffset, x, y, width, height);
+    }
+    inline void APIENTRY record_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexSubImage1D);
+        trace.value(target);
+        trace.value(level);
+        trace.value(xoffset);
+        trace.value(width);
+        trace.value(format);
+        trace.value(type);
+        trace.unpackPixels(pixels, format, type, width, 1, 1);
+        ((PFNGLTEXSUBIMAGE1DPROC)Table<>::loaded[ENTRY_glTexSubImage1D])(target, level, xoffset, width, format, type, pixels);
+    }
+    inline void APIENTRY record_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexSubImage2D);
+        trace.value(target);
+        trace.value(level);
+        trace.value(xoffset);
+        trace.value(yoffset);
+        trace.value(width);
+        trace.value(height);
+        trace.value(format);
+        trace.value(type);
+        trace.unpackPixels(pixels, format, type, width, height, 1);
+        ((PFNGLTEXSUBIMAGE2DPROC)Table<>::loaded[ENTRY_glTexSubImage2D])(target, level, xoffset, yoffset, width, height, format, type, pixels);
+    }
+    inline void APIENTRY record_glBindTexture(GLenum target, GLuint texture)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBindTexture);
+        trace.value(target);
+        trace.value(texture);
+        ((PFNGLBINDTEXTUREPROC)Table<>::loaded[ENTRY_glBindTexture])(target, texture);
+    }
+    inline void APIENTRY record_glDeleteTextures(GLsizei n, const GLuint *textures)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDeleteTextures);
+        trace.value(n);
+        trace.pointer(textures, (size_t)std::max(n, 0) * sizeof(GLuint));
+        ((PFNGLDELETETEXTURESPROC)Table<>::loaded[ENTRY_glDeleteTextures])(n, textures);
+    }
+    inline void APIENTRY record_glGenTextures(GLsizei n, GLuint *textures)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glGenTextures);
+        trace.value(n);
+        ((PFNGLGENTEXTURESPROC)Table<>::loaded[ENTRY_glGenTextures])(n, textures);
+        trace.pointer(textures, (size_t)std::max(n, 0) * sizeof(GLuint));
+    }
+    inline void APIENTRY record_glArrayElement(GLint i)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glArrayElement);
+        trace.value(i);
+        ((PFNGLARRAYELEMENTPROC)Table<>::loaded[ENTRY_glArrayElement])(i);
+    }
+    inline void APIENTRY record_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer)
+    {
+        recorder().unsupported(ENTRY_glColorPointer);
+        ((PFNGLCOLORPOINTERPROC)Table<>::loaded[ENTRY_glColorPointer])(size, type, stride, pointer);
+    }
+    inline void APIENTRY record_glDisableClientState(GLenum array)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDisableClientState);
+        trace.value(array);
+        ((PFNGLDISABLECLIENTSTATEPROC)Table<>::loaded[ENTRY_glDisableClientState])(array);
+    }
+    inline void APIENTRY record_glEdgeFlagPointer(GLsizei stride, const void *pointer)
+    {
+        recorder().unsupported(ENTRY_glEdgeFlagPointer);
+        ((PFNGLEDGEFLAGPOINTERPROC)Table<>::loaded[ENTRY_glEdgeFlagPointer])(stride, pointer);
+    }
+    inline void APIENTRY record_glEnableClientState(GLenum array)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glEnableClientState);
+        trace.value(array);
+        ((PFNGLENABLECLIENTSTATEPROC)Table<>::loaded[ENTRY_glEnableClientState])(array);
+    }
+    inline void APIENTRY record_glIndexPointer(GLenum type, GLsizei stride, const void *pointer)
+    {
+        recorder().unsupported(ENTRY_glIndexPointer);
+        ((PFNGLINDEXPOINTERPROC)Table<>::loaded[ENTRY_glIndexPointer])(type, stride, pointer);
+    }
+    inline void APIENTRY record_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer)
+    {
+        recorder().unsupported(ENTRY_glInterleavedArrays);
+        ((PFNGLINTERLEAVEDARRAYSPROC)Table<>::loaded[ENTRY_glInterleavedArrays])(format, stride, pointer);
+    }
+    inline void APIENTRY record_glNormalPointer(GLenum type, GLsizei stride, const void *pointer)
+    {
+        recorder().unsupported(ENTRY_glNormalPointer);
+        ((PFNGLNORMALPOINTERPROC)Table<>::loaded[ENTRY_glNormalPointer])(type, stride, pointer);
+    }
+    inline void APIENTRY record_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer)
+    {
+        recorder().unsupported(ENTRY_glTexCoordPointer);
+        ((PFNGLTEXCOORDPOINTERPROC)Table<>::loaded[ENTRY_glTexCoordPointer])(size, type, stride, pointer);
+    }
+    inline void APIENTRY record_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer)
+    {
+        recorder().unsupported(ENTRY_glVertexPointer);
+        ((PFNGLVERTEXPOINTERPROC)Table<>::loaded[ENTRY_glVertexPointer])(size, type, stride, pointer);
+    }
+    inline void APIENTRY record_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities)
+    {
+        recorder().unsupported(ENTRY_glPrioritizeTextures);
+        ((PFNGLPRIORITIZETEXTURESPROC)Table<>::loaded[ENTRY_glPrioritizeTextures])(n, textures, priorities);
+    }
+    inline void APIENTRY record_glIndexub(GLubyte c)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glIndexub);
+        trace.value(c);
+        ((PFNGLINDEXUBPROC)Table<>::loaded[ENTRY_glIndexub])(c);
+    }
+    inline void APIENTRY record_glIndexubv(const GLubyte *c)
+    {
+        recorder().unsupported(ENTRY_glIndexubv);
+        ((PFNGLINDEXUBVPROC)Table<>::loaded[ENTRY_glIndexubv])(c);
+    }
+    inline void APIENTRY record_glPopClientAttrib(void)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPopClientAttrib);
+        ((PFNGLPOPCLIENTATTRIBPROC)Table<>::loaded[ENTRY_glPopClientAttrib])();
+    }
+    inline void APIENTRY record_glPushClientAttrib(GLbitfield mask)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPushClientAttrib);
+        trace.value(mask);
+        ((PFNGLPUSHCLIENTATTRIBPROC)Table<>::loaded[ENTRY_glPushClientAttrib])(mask);
+    }
+    inline void APIENTRY record_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDrawRangeElements);
+        trace.value(mode);
+        trace.value(start);
+        trace.value(end);
+        trace.value(count);
+        trace.value(type);
+        trace.offset(indices);
+        ((PFNGLDRAWRANGEELEMENTSPROC)Table<>::loaded[ENTRY_glDrawRangeElements])(mode, start, end, count, type, indices);
+    }
+    inline void APIENTRY record_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexImage3D);
+        trace.value(target);
+        trace.value(level);
+        trace.value(internalformat);
+        trace.value(width);
+        trace.value(height);
+        trace.value(depth);
+        trace.value(border);
+        trace.value(format);
+        trace.value(type);
+        trace.unpackPixels(pixels, format, type, width, height, depth);
+        ((PFNGLTEXIMAGE3DPROC)Table<>::loaded[ENTRY_glTexImage3D])(target, level, internalformat, width, height, depth, border, format, type, pixels);
+    }
+    inline void APIENTRY record_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexSubImage3D);
+        trace.value(target);
+        trace.value(level);
+        trace.value(xoffset);
+        trace.value(yoffset);
+        trace.value(zoffset);
+        trace.value(width);
+        trace.value(height);
+        trace.value(depth);
+        trace.value(format);
+        trace.value(type);
+        trace.unpackPixels(pixels, format, type, width, height, depth);
+        ((PFNGLTEXSUBIMAGE3DPROC)Table<>::loaded[ENTRY_glTexSubImage3D])(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    }
+    inline void APIENTRY record_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glCopyTexSubImage3D);
+        trace.value(target);
+        trace.value(level);
+        trace.value(xoffset);
+        trace.value(yoffset);
+        trace.value(zoffset);
+        trace.value(x);
+        trace.value(y);
+        trace.value(width);
+        trace.value(height);
+        ((PFNGLCOPYTEXSUBIMAGE3DPROC)Table<>::loaded[ENTRY_glCopyTexSubImage3D])(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+    }
+    inline void APIENTRY record_glActiveTexture(GLenum texture)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glActiveTexture);
+        trace.value(texture);
+        ((PFNGLACTIVETEXTUREPROC)Table<>::loaded[ENTRY_glActiveTexture])(texture);
+    }
+    inline void APIENTRY record_glSampleCoverage(GLfloat value, GLboolean invert)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glSampleCoverage);
+        trace.value(value);
+        trace.value(invert);
+        ((PFNGLSAMPLECOVERAGEPROC)Table<>::loaded[ENTRY_glSampleCoverage])(value, invert);
+    }
+    inline void APIENTRY record_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glCompressedTexImage3D);
+        trace.value(target);
+        trace.value(level);
+        trace.value(internalformat);
+        trace.value(width);
+        trace.value(height);
+        trace.value(depth);
+        trace.value(border);
+        trace.value(imageSize);
+        trace.compressedPixels(data, imageSize);
+        ((PFNGLCOMPRESSEDTEXIMAGE3DPROC)Table<>::loaded[ENTRY_glCompressedTexImage3D])(target, level, internalformat, width, height, depth, border, imageSize, data);
+    }
+    inline void APIENTRY record_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glCompressedTexImage2D);
+        trace.value(target);
+        trace.value(level);
+        trace.value(internalformat);
+        trace.value(width);
+        trace.value(height);
+        trace.value(border);
+        trace.value(imageSize);
+        trace.compressedPixels(data, imageSize);
+        ((PFNGLCOMPRESSEDTEXIMAGE2DPROC)Table<>::loaded[ENTRY_glCompressedTexImage2D])(target, level, internalformat, width, height, border, imageSize, data);
+    }
+    inline void APIENTRY record_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glCompressedTexImage1D);
+        trace.value(target);
+        trace.value(level);
+        trace.value(internalformat);
+        trace.value(width);
+        trace.value(border);
+        trace.value(imageSize);
+        trace.compressedPixels(data, imageSize);
+        ((PFNGLCOMPRESSEDTEXIMAGE1DPROC)Table<>::loaded[ENTRY_glCompressedTexImage1D])(target, level, internalformat, width, border, imageSize, data);
+    }
+    inline void APIENTRY record_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glCompressedTexSubImage3D);
+        trace.value(target);
+        trace.value(level);
+        trace.value(xoffset);
+        trace.value(yoffset);
+        trace.value(zoffset);
+        trace.value(width);
+        trace.value(height);
+        trace.value(depth);
+        trace.value(format);
+        trace.value(imageSize);
+        trace.compressedPixels(data, imageSize);
+        ((PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)Table<>::loaded[ENTRY_glCompressedTexSubImage3D])(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    }
+    inline void APIENTRY record_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glCompressedTexSubImage2D);
+        trace.value(target);
+        trace.value(level);
+        trace.value(xoffset);
+        trace.value(yoffset);
+        trace.value(width);
+        trace.value(height);
+        trace.value(format);
+        trace.value(imageSize);
+        trace.compressedPixels(data, imageSize);
+        ((PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)Table<>::loaded[ENTRY_glCompressedTexSubImage2D])(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+    }
+    inline void APIENTRY record_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glCompressedTexSubImage1D);
+        trace.value(target);
+        trace.value(level);
+        trace.value(xoffset);
+        trace.value(width);
+        trace.value(format);
+        trace.value(imageSize);
+        trace.compressedPixels(data, imageSize);
+        ((PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)Table<>::loaded[ENTRY_glCompressedTexSubImage1D])(target, level, xoffset, width, format, imageSize, data);
+    }
+    inline void APIENTRY record_glClientActiveTexture(GLenum texture)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glClientActiveTexture);
+        trace.value(texture);
+        ((PFNGLCLIENTACTIVETEXTUREPROC)Table<>::loaded[ENTRY_glClientActiveTexture])(texture);
+    }
+    inline void APIENTRY record_glMultiTexCoord1d(GLenum target, GLdouble s)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoord1d);
+        trace.value(target);
+        trace.value(s);
+        ((PFNGLMULTITEXCOORD1DPROC)Table<>::loaded[ENTRY_glMultiTexCoord1d])(target, s);
+    }
+    inline void APIENTRY record_glMultiTexCoord1dv(GLenum target, const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoord1dv);
+        ((PFNGLMULTITEXCOORD1DVPROC)Table<>::loaded[ENTRY_glMultiTexCoord1dv])(target, v);
+    }
+    inline void APIENTRY record_glMultiTexCoord1f(GLenum target, GLfloat s)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoord1f);
+        trace.value(target);
+        trace.value(s);
+        ((PFNGLMULTITEXCOORD1FPROC)Table<>::loaded[ENTRY_glMultiTexCoord1f])(target, s);
+    }
+    inline void APIENTRY record_glMultiTexCoord1fv(GLenum target, const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoord1fv);
+        ((PFNGLMULTITEXCOORD1FVPROC)Table<>::loaded[ENTRY_glMultiTexCoord1fv])(target, v);
+    }
+    inline void APIENTRY record_glMultiTexCoord1i(GLenum target, GLint s)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoord1i);
+        trace.value(target);
+        trace.value(s);
+        ((PFNGLMULTITEXCOORD1IPROC)Table<>::loaded[ENTRY_glMultiTexCoord1i])(target, s);
+    }
+    inline void APIENTRY record_glMultiTexCoord1iv(GLenum target, const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoord1iv);
+        ((PFNGLMULTITEXCOORD1IVPROC)Table<>::loaded[ENTRY_glMultiTexCoord1iv])(target, v);
+    }
+    inline void APIENTRY record_glMultiTexCoord1s(GLenum target, GLshort s)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoord1s);
+        trace.value(target);
+        trace.value(s);
+        ((PFNGLMULTITEXCOORD1SPROC)Table<>::loaded[ENTRY_glMultiTexCoord1s])(target, s);
+    }
+    inline void APIENTRY record_glMultiTexCoord1sv(GLenum target, const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoord1sv);
+        ((PFNGLMULTITEXCOORD1SVPROC)Table<>::loaded[ENTRY_glMultiTexCoord1sv])(target, v);
+    }
+    inline void APIENTRY record_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoord2d);
+        trace.value(target);
+        trace.value(s);
+        trace.value(t);
+        ((PFNGLMULTITEXCOORD2DPROC)Table<>::loaded[ENTRY_glMultiTexCoord2d])(target, s, t);
+    }
+    inline void APIENTRY record_glMultiTexCoord2dv(GLenum target, const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoord2dv);
+        ((PFNGLMULTITEXCOORD2DVPROC)Table<>::loaded[ENTRY_glMultiTexCoord2dv])(target, v);
+    }
+    inline void APIENTRY record_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoord2f);
+        trace.value(target);
+        trace.value(s);
+        trace.value(t);
+        ((PFNGLMULTITEXCOORD2FPROC)Table<>::loaded[ENTRY_glMultiTexCoord2f])(target, s, t);
+    }
+    inline void APIENTRY record_glMultiTexCoord2fv(GLenum target, const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoord2fv);
+        ((PFNGLMULTITEXCOORD2FVPROC)Table<>::loaded[ENTRY_glMultiTexCoord2fv])(target, v);
+    }
+    inline void APIENTRY record_glMultiTexCoord2i(GLenum target, GLint s, GLint t)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoord2i);
+        trace.value(target);
+        trace.value(s);
+        trace.value(t);
+        ((PFNGLMULTITEXCOORD2IPROC)Table<>::loaded[ENTRY_glMultiTexCoord2i])(target, s, t);
+    }
+    inline void APIENTRY record_glMultiTexCoord2iv(GLenum target, const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoord2iv);
+        ((PFNGLMULTITEXCOORD2IVPROC)Table<>::loaded[ENTRY_glMultiTexCoord2iv])(target, v);
+    }
+    inline void APIENTRY record_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoord2s);
+        trace.value(target);
+        trace.value(s);
+        trace.value(t);
+        ((PFNGLMULTITEXCOORD2SPROC)Table<>::loaded[ENTRY_glMultiTexCoord2s])(target, s, t);
+    }
+    inline void APIENTRY record_glMultiTexCoord2sv(GLenum target, const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoord2sv);
+        ((PFNGLMULTITEXCOORD2SVPROC)Table<>::loaded[ENTRY_glMultiTexCoord2sv])(target, v);
+    }
+    inline void APIENTRY record_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoord3d);
+        trace.value(target);
+        trace.value(s);
+        trace.value(t);
+        trace.value(r);
+        ((PFNGLMULTITEXCOORD3DPROC)Table<>::loaded[ENTRY_glMultiTexCoord3d])(target, s, t, r);
+    }
+    inline void APIENTRY record_glMultiTexCoord3dv(GLenum target, const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoord3dv);
+        ((PFNGLMULTITEXCOORD3DVPROC)Table<>::loaded[ENTRY_glMultiTexCoord3dv])(target, v);
+    }
+    inline void APIENTRY record_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoord3f);
+        trace.value(target);
+        trace.value(s);
+        trace.value(t);
+        trace.value(r);
+        ((PFNGLMULTITEXCOORD3FPROC)Table<>::loaded[ENTRY_glMultiTexCoord3f])(target, s, t, r);
+    }
+    inline void APIENTRY record_glMultiTexCoord3fv(GLenum target, const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoord3fv);
+        ((PFNGLMULTITEXCOORD3FVPROC)Table<>::loaded[ENTRY_glMultiTexCoord3fv])(target, v);
+    }
+    inline void APIENTRY record_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoord3i);
+        trace.value(target);
+        trace.value(s);
+        trace.value(t);
+        trace.value(r);
+        ((PFNGLMULTITEXCOORD3IPROC)Table<>::loaded[ENTRY_glMultiTexCoord3i])(target, s, t, r);
+    }
+    inline void APIENTRY record_glMultiTexCoord3iv(GLenum target, const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoord3iv);
+        ((PFNGLMULTITEXCOORD3IVPROC)Table<>::loaded[ENTRY_glMultiTexCoord3iv])(target, v);
+    }
+    inline void APIENTRY record_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoord3s);
+        trace.value(target);
+        trace.value(s);
+        trace.value(t);
+        trace.value(r);
+        ((PFNGLMULTITEXCOORD3SPROC)Table<>::loaded[ENTRY_glMultiTexCoord3s])(target, s, t, r);
+    }
+    inline void APIENTRY record_glMultiTexCoord3sv(GLenum target, const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoord3sv);
+        ((PFNGLMULTITEXCOORD3SVPROC)Table<>::loaded[ENTRY_glMultiTexCoord3sv])(target, v);
+    }
+    inline void APIENTRY record_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoord4d);
+        trace.value(target);
+        trace.value(s);
+        trace.value(t);
+        trace.value(r);
+        trace.value(q);
+        ((PFNGLMULTITEXCOORD4DPROC)Table<>::loaded[ENTRY_glMultiTexCoord4d])(target, s, t, r, q);
+    }
+    inline void APIENTRY record_glMultiTexCoord4dv(GLenum target, const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoord4dv);
+        ((PFNGLMULTITEXCOORD4DVPROC)Table<>::loaded[ENTRY_glMultiTexCoord4dv])(target, v);
+    }
+    inline void APIENTRY record_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoord4f);
+        trace.value(target);
+        trace.value(s);
+        trace.value(t);
+        trace.value(r);
+        trace.value(q);
+        ((PFNGLMULTITEXCOORD4FPROC)Table<>::loaded[ENTRY_glMultiTexCoord4f])(target, s, t, r, q);
+    }
+    inline void APIENTRY record_glMultiTexCoord4fv(GLenum target, const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoord4fv);
+        ((PFNGLMULTITEXCOORD4FVPROC)Table<>::loaded[ENTRY_glMultiTexCoord4fv])(target, v);
+    }
+    inline void APIENTRY record_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoord4i);
+        trace.value(target);
+        trace.value(s);
+        trace.value(t);
+        trace.value(r);
+        trace.value(q);
+        ((PFNGLMULTITEXCOORD4IPROC)Table<>::loaded[ENTRY_glMultiTexCoord4i])(target, s, t, r, q);
+    }
+    inline void APIENTRY record_glMultiTexCoord4iv(GLenum target, const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoord4iv);
+        ((PFNGLMULTITEXCOORD4IVPROC)Table<>::loaded[ENTRY_glMultiTexCoord4iv])(target, v);
+    }
+    inline void APIENTRY record_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoord4s);
+        trace.value(target);
+        trace.value(s);
+        trace.value(t);
+        trace.value(r);
+        trace.value(q);
+        ((PFNGLMULTITEXCOORD4SPROC)Table<>::loaded[ENTRY_glMultiTexCoord4s])(target, s, t, r, q);
+    }
+    inline void APIENTRY record_glMultiTexCoord4sv(GLenum target, const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoord4sv);
+        ((PFNGLMULTITEXCOORD4SVPROC)Table<>::loaded[ENTRY_glMultiTexCoord4sv])(target, v);
+    }
+    inline void APIENTRY record_glLoadTransposeMatrixf(const GLfloat *m)
+    {
+        recorder().unsupported(ENTRY_glLoadTransposeMatrixf);
+        ((PFNGLLOADTRANSPOSEMATRIXFPROC)Table<>::loaded[ENTRY_glLoadTransposeMatrixf])(m);
+    }
+    inline void APIENTRY record_glLoadTransposeMatrixd(const GLdouble *m)
+    {
+        recorder().unsupported(ENTRY_glLoadTransposeMatrixd);
+        ((PFNGLLOADTRANSPOSEMATRIXDPROC)Table<>::loaded[ENTRY_glLoadTransposeMatrixd])(m);
+    }
+    inline void APIENTRY record_glMultTransposeMatrixf(const GLfloat *m)
+    {
+        recorder().unsupported(ENTRY_glMultTransposeMatrixf);
+        ((PFNGLMULTTRANSPOSEMATRIXFPROC)Table<>::loaded[ENTRY_glMultTransposeMatrixf])(m);
+    }
+    inline void APIENTRY record_glMultTransposeMatrixd(const GLdouble *m)
+    {
+        recorder().unsupported(ENTRY_glMultTransposeMatrixd);
+        ((PFNGLMULTTRANSPOSEMATRIXDPROC)Table<>::loaded[ENTRY_glMultTransposeMatrixd])(m);
+    }
+    inline void APIENTRY record_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBlendFuncSeparate);
+        trace.value(sfactorRGB);
+        trace.value(dfactorRGB);
+        trace.value(sfactorAlpha);
+        trace.value(dfactorAlpha);
+        ((PFNGLBLENDFUNCSEPARATEPROC)Table<>::loaded[ENTRY_glBlendFuncSeparate])(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+    }
+    inline void APIENTRY record_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount)
+    {
+        recorder().unsupported(ENTRY_glMultiDrawArrays);
+        ((PFNGLMULTIDRAWARRAYSPROC)Table<>::loaded[ENTRY_glMultiDrawArrays])(mode, first, count, drawcount);
+    }
+    inline void APIENTRY record_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount)
+    {
+        recorder().unsupported(ENTRY_glMultiDrawElements);
+        ((PFNGLMULTIDRAWELEMENTSPROC)Table<>::loaded[ENTRY_glMultiDrawElements])(mode, count, type, indices, drawcount);
+    }
+    inline void APIENTRY record_glPointParameterf(GLenum pname, GLfloat param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPointParameterf);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLPOINTPARAMETERFPROC)Table<>::loaded[ENTRY_glPointParameterf])(pname, param);
+    }
+    inline void APIENTRY record_glPointParameterfv(GLenum pname, const GLfloat *params)
+    {
+        recorder().unsupported(ENTRY_glPointParameterfv);
+        ((PFNGLPOINTPARAMETERFVPROC)Table<>::loaded[ENTRY_glPointParameterfv])(pname, params);
+    }
+    inline void APIENTRY record_glPointParameteri(GLenum pname, GLint param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPointParameteri);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLPOINTPARAMETERIPROC)Table<>::loaded[ENTRY_glPointParameteri])(pname, param);
+    }
+    inline void APIENTRY record_glPointParameteriv(GLenum pname, const GLint *params)
+    {
+        recorder().unsupported(ENTRY_glPointParameteriv);
+        ((PFNGLPOINTPARAMETERIVPROC)Table<>::loaded[ENTRY_glPointParameteriv])(pname, params);
+    }
+    inline void APIENTRY record_glFogCoordf(GLfloat coord)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glFogCoordf);
+        trace.value(coord);
+        ((PFNGLFOGCOORDFPROC)Table<>::loaded[ENTRY_glFogCoordf])(coord);
+    }
+    inline void APIENTRY record_glFogCoordfv(const GLfloat *coord)
+    {
+        recorder().unsupported(ENTRY_glFogCoordfv);
+        ((PFNGLFOGCOORDFVPROC)Table<>::loaded[ENTRY_glFogCoordfv])(coord);
+    }
+    inline void APIENTRY record_glFogCoordd(GLdouble coord)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glFogCoordd);
+        trace.value(coord);
+        ((PFNGLFOGCOORDDPROC)Table<>::loaded[ENTRY_glFogCoordd])(coord);
+    }
+    inline void APIENTRY record_glFogCoorddv(const GLdouble *coord)
+    {
+        recorder().unsupported(ENTRY_glFogCoorddv);
+        ((PFNGLFOGCOORDDVPROC)Table<>::loaded[ENTRY_glFogCoorddv])(coord);
+    }
+    inline void APIENTRY record_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer)
+    {
+        recorder().unsupported(ENTRY_glFogCoordPointer);
+        ((PFNGLFOGCOORDPOINTERPROC)Table<>::loaded[ENTRY_glFogCoordPointer])(type, stride, pointer);
+    }
+    inline void APIENTRY record_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glSecondaryColor3b);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        ((PFNGLSECONDARYCOLOR3BPROC)Table<>::loaded[ENTRY_glSecondaryColor3b])(red, green, blue);
+    }
+    inline void APIENTRY record_glSecondaryColor3bv(const GLbyte *v)
+    {
+        recorder().unsupported(ENTRY_glSecondaryColor3bv);
+        ((PFNGLSECONDARYCOLOR3BVPROC)Table<>::loaded[ENTRY_glSecondaryColor3bv])(v);
+    }
+    inline void APIENTRY record_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glSecondaryColor3d);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        ((PFNGLSECONDARYCOLOR3DPROC)Table<>::loaded[ENTRY_glSecondaryColor3d])(red, green, blue);
+    }
+    inline void APIENTRY record_glSecondaryColor3dv(const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glSecondaryColor3dv);
+        ((PFNGLSECONDARYCOLOR3DVPROC)Table<>::loaded[ENTRY_glSecondaryColor3dv])(v);
+    }
+    inline void APIENTRY record_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glSecondaryColor3f);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        ((PFNGLSECONDARYCOLOR3FPROC)Table<>::loaded[ENTRY_glSecondaryColor3f])(red, green, blue);
+    }
+    inline void APIENTRY record_glSecondaryColor3fv(const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glSecondaryColor3fv);
+        ((PFNGLSECONDARYCOLOR3FVPROC)Table<>::loaded[ENTRY_glSecondaryColor3fv])(v);
+    }
+    inline void APIENTRY record_glSecondaryColor3i(GLint red, GLint green, GLint blue)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glSecondaryColor3i);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        ((PFNGLSECONDARYCOLOR3IPROC)Table<>::loaded[ENTRY_glSecondaryColor3i])(red, green, blue);
+    }
+    inline void APIENTRY record_glSecondaryColor3iv(const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glSecondaryColor3iv);
+        ((PFNGLSECONDARYCOLOR3IVPROC)Table<>::loaded[ENTRY_glSecondaryColor3iv])(v);
+    }
+    inline void APIENTRY record_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glSecondaryColor3s);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        ((PFNGLSECONDARYCOLOR3SPROC)Table<>::loaded[ENTRY_glSecondaryColor3s])(red, green, blue);
+    }
+    inline void APIENTRY record_glSecondaryColor3sv(const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glSecondaryColor3sv);
+        ((PFNGLSECONDARYCOLOR3SVPROC)Table<>::loaded[ENTRY_glSecondaryColor3sv])(v);
+    }
+    inline void APIENTRY record_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glSecondaryColor3ub);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        ((PFNGLSECONDARYCOLOR3UBPROC)Table<>::loaded[ENTRY_glSecondaryColor3ub])(red, green, blue);
+    }
+    inline void APIENTRY record_glSecondaryColor3ubv(const GLubyte *v)
+    {
+        recorder().unsupported(ENTRY_glSecondaryColor3ubv);
+        ((PFNGLSECONDARYCOLOR3UBVPROC)Table<>::loaded[ENTRY_glSecondaryColor3ubv])(v);
+    }
+    inline void APIENTRY record_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glSecondaryColor3ui);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        ((PFNGLSECONDARYCOLOR3UIPROC)Table<>::loaded[ENTRY_glSecondaryColor3ui])(red, green, blue);
+    }
+    inline void APIENTRY record_glSecondaryColor3uiv(const GLuint *v)
+    {
+        recorder().unsupported(ENTRY_glSecondaryColor3uiv);
+        ((PFNGLSECONDARYCOLOR3UIVPROC)Table<>::loaded[ENTRY_glSecondaryColor3uiv])(v);
+    }
+    inline void APIENTRY record_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glSecondaryColor3us);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        ((PFNGLSECONDARYCOLOR3USPROC)Table<>::loaded[ENTRY_glSecondaryColor3us])(red, green, blue);
+    }
+    inline void APIENTRY record_glSecondaryColor3usv(const GLushort *v)
+    {
+        recorder().unsupported(ENTRY_glSecondaryColor3usv);
+        ((PFNGLSECONDARYCOLOR3USVPROC)Table<>::loaded[ENTRY_glSecondaryColor3usv])(v);
+    }
+    inline void APIENTRY record_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer)
+    {
+        recorder().unsupported(ENTRY_glSecondaryColorPointer);
+        ((PFNGLSECONDARYCOLORPOINTERPROC)Table<>::loaded[ENTRY_glSecondaryColorPointer])(size, type, stride, pointer);
+    }
+    inline void APIENTRY record_glWindowPos2d(GLdouble x, GLdouble y)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glWindowPos2d);
+        trace.value(x);
+        trace.value(y);
+        ((PFNGLWINDOWPOS2DPROC)Table<>::loaded[ENTRY_glWindowPos2d])(x, y);
+    }
+    inline void APIENTRY record_glWindowPos2dv(const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glWindowPos2dv);
+        ((PFNGLWINDOWPOS2DVPROC)Table<>::loaded[ENTRY_glWindowPos2dv])(v);
+    }
+    inline void APIENTRY record_glWindowPos2f(GLfloat x, GLfloat y)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glWindowPos2f);
+        trace.value(x);
+        trace.value(y);
+        ((PFNGLWINDOWPOS2FPROC)Table<>::loaded[ENTRY_glWindowPos2f])(x, y);
+    }
+    inline void APIENTRY record_glWindowPos2fv(const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glWindowPos2fv);
+        ((PFNGLWINDOWPOS2FVPROC)Table<>::loaded[ENTRY_glWindowPos2fv])(v);
+    }
+    inline void APIENTRY record_glWindowPos2i(GLint x, GLint y)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glWindowPos2i);
+        trace.value(x);
+        trace.value(y);
+        ((PFNGLWINDOWPOS2IPROC)Table<>::loaded[ENTRY_glWindowPos2i])(x, y);
+    }
+    inline void APIENTRY record_glWindowPos2iv(const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glWindowPos2iv);
+        ((PFNGLWINDOWPOS2IVPROC)Table<>::loaded[ENTRY_glWindowPos2iv])(v);
+    }
+    inline void APIENTRY record_glWindowPos2s(GLshort x, GLshort y)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glWindowPos2s);
+        trace.value(x);
+        trace.value(y);
+        ((PFNGLWINDOWPOS2SPROC)Table<>::loaded[ENTRY_glWindowPos2s])(x, y);
+    }
+    inline void APIENTRY record_glWindowPos2sv(const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glWindowPos2sv);
+        ((PFNGLWINDOWPOS2SVPROC)Table<>::loaded[ENTRY_glWindowPos2sv])(v);
+    }
+    inline void APIENTRY record_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glWindowPos3d);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLWINDOWPOS3DPROC)Table<>::loaded[ENTRY_glWindowPos3d])(x, y, z);
+    }
+    inline void APIENTRY record_glWindowPos3dv(const GLdouble *v)
+    {
+        recorder().unsupported(ENTRY_glWindowPos3dv);
+        ((PFNGLWINDOWPOS3DVPROC)Table<>::loaded[ENTRY_glWindowPos3dv])(v);
+    }
+    inline void APIENTRY record_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glWindowPos3f);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLWINDOWPOS3FPROC)Table<>::loaded[ENTRY_glWindowPos3f])(x, y, z);
+    }
+    inline void APIENTRY record_glWindowPos3fv(const GLfloat *v)
+    {
+        recorder().unsupported(ENTRY_glWindowPos3fv);
+        ((PFNGLWINDOWPOS3FVPROC)Table<>::loaded[ENTRY_glWindowPos3fv])(v);
+    }
+    inline void APIENTRY record_glWindowPos3i(GLint x, GLint y, GLint z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glWindowPos3i);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLWINDOWPOS3IPROC)Table<>::loaded[ENTRY_glWindowPos3i])(x, y, z);
+    }
+    inline void APIENTRY record_glWindowPos3iv(const GLint *v)
+    {
+        recorder().unsupported(ENTRY_glWindowPos3iv);
+        ((PFNGLWINDOWPOS3IVPROC)Table<>::loaded[ENTRY_glWindowPos3iv])(v);
+    }
+    inline void APIENTRY record_glWindowPos3s(GLshort x, GLshort y, GLshort z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glWindowPos3s);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLWINDOWPOS3SPROC)Table<>::loaded[ENTRY_glWindowPos3s])(x, y, z);
+    }
+    inline void APIENTRY record_glWindowPos3sv(const GLshort *v)
+    {
+        recorder().unsupported(ENTRY_glWindowPos3sv);
+        ((PFNGLWINDOWPOS3SVPROC)Table<>::loaded[ENTRY_glWindowPos3sv])(v);
+    }
+    inline void APIENTRY record_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBlendColor);
+        trace.value(red);
+        trace.value(green);
+        trace.value(blue);
+        trace.value(alpha);
+        ((PFNGLBLENDCOLORPROC)Table<>::loaded[ENTRY_glBlendColor])(red, green, blue, alpha);
+    }
+    inline void APIENTRY record_glBlendEquation(GLenum mode)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBlendEquation);
+        trace.value(mode);
+        ((PFNGLBLENDEQUATIONPROC)Table<>::loaded[ENTRY_glBlendEquation])(mode);
+    }
+    inline void APIENTRY record_glGenQueries(GLsizei n, GLuint *ids)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glGenQueries);
+        trace.value(n);
+        ((PFNGLGENQUERIESPROC)Table<>::loaded[ENTRY_glGenQueries])(n, ids);
+        trace.pointer(ids, (size_t)std::max(n, 0) * sizeof(GLuint));
+    }
+    inline void APIENTRY record_glDeleteQueries(GLsizei n, const GLuint *ids)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDeleteQueries);
+        trace.value(n);
+        trace.pointer(ids, (size_t)std::max(n, 0) * sizeof(GLuint));
+        ((PFNGLDELETEQUERIESPROC)Table<>::loaded[ENTRY_glDeleteQueries])(n, ids);
+    }
+    inline void APIENTRY record_glBeginQuery(GLenum target, GLuint id)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBeginQuery);
+        trace.value(target);
+        trace.value(id);
+        ((PFNGLBEGINQUERYPROC)Table<>::loaded[ENTRY_glBeginQuery])(target, id);
+    }
+    inline void APIENTRY record_glEndQuery(GLenum target)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glEndQuery);
+        trace.value(target);
+        ((PFNGLENDQUERYPROC)Table<>::loaded[ENTRY_glEndQuery])(target);
+    }
+    inline void APIENTRY record_glBindBuffer(GLenum target, GLuint buffer)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBindBuffer);
+        trace.value(target);
+        trace.value(buffer);
+        ((PFNGLBINDBUFFERPROC)Table<>::loaded[ENTRY_glBindBuffer])(target, buffer);
+        trace.bindBuffer(target, buffer);
+    }
+    inline void APIENTRY record_glDeleteBuffers(GLsizei n, const GLuint *buffers)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDeleteBuffers);
+        trace.value(n);
+        trace.pointer(buffers, (size_t)std::max(n, 0) * sizeof(GLuint));
+        ((PFNGLDELETEBUFFERSPROC)Table<>::loaded[ENTRY_glDeleteBuffers])(n, buffers);
+        trace.deleteBuffers(n, buffers);
+    }
+    inline void APIENTRY record_glGenBuffers(GLsizei n, GLuint *buffers)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glGenBuffers);
+        trace.value(n);
+        ((PFNGLGENBUFFERSPROC)Table<>::loaded[ENTRY_glGenBuffers])(n, buffers);
+        trace.pointer(buffers, (size_t)std::max(n, 0) * sizeof(GLuint));
+    }
+    inline void APIENTRY record_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBufferData);
+        trace.value(target);
+        trace.value(size);
+        trace.pointer(data, (size_t)size);
+        trace.value(usage);
+        ((PFNGLBUFFERDATAPROC)Table<>::loaded[ENTRY_glBufferData])(target, size, data, usage);
+    }
+    inline void APIENTRY record_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBufferSubData);
+        trace.value(target);
+        trace.value(offset);
+        trace.value(size);
+        trace.pointer(data, (size_t)size);
+        ((PFNGLBUFFERSUBDATAPROC)Table<>::loaded[ENTRY_glBufferSubData])(target, offset, size, data);
+    }
+    inline void * APIENTRY record_glMapBuffer(GLenum target, GLenum access)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMapBuffer);
+        trace.value(target);
+        trace.value(access);
+        void * result = ((PFNGLMAPBUFFERPROC)Table<>::loaded[ENTRY_glMapBuffer])(target, access);
+        GLint size = 0;
+        glGetBufferParameteriv(target, GL_BUFFER_SIZE, &size);
+        trace.mapped(target, result, size, access == GL_READ_ONLY ? 0 : GL_MAP_WRITE_BIT);
+        return result;
+    }
+    inline GLboolean APIENTRY record_glUnmapBuffer(GLenum target)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUnmapBuffer);
+        trace.value(target);
+        trace.unmapped(target);
+        GLboolean result = ((PFNGLUNMAPBUFFERPROC)Table<>::loaded[ENTRY_glUnmapBuffer])(target);
+        return result;
+    }
+    inline void APIENTRY record_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBlendEquationSeparate);
+        trace.value(modeRGB);
+        trace.value(modeAlpha);
+        ((PFNGLBLENDEQUATIONSEPARATEPROC)Table<>::loaded[ENTRY_glBlendEquationSeparate])(modeRGB, modeAlpha);
+    }
+    inline void APIENTRY record_glDrawBuffers(GLsizei n, const GLenum *bufs)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDrawBuffers);
+        trace.value(n);
+        trace.pointer(bufs, (size_t)std::max(n, 0) * sizeof(GLenum));
+        ((PFNGLDRAWBUFFERSPROC)Table<>::loaded[ENTRY_glDrawBuffers])(n, bufs);
+    }
+    inline void APIENTRY record_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glStencilOpSeparate);
+        trace.value(face);
+        trace.value(sfail);
+        trace.value(dpfail);
+        trace.value(dppass);
+        ((PFNGLSTENCILOPSEPARATEPROC)Table<>::loaded[ENTRY_glStencilOpSeparate])(face, sfail, dpfail, dppass);
+    }
+    inline void APIENTRY record_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glStencilFuncSeparate);
+        trace.value(face);
+        trace.value(func);
+        trace.value(ref);
+        trace.value(mask);
+        ((PFNGLSTENCILFUNCSEPARATEPROC)Table<>::loaded[ENTRY_glStencilFuncSeparate])(face, func, ref, mask);
+    }
+    inline void APIENTRY record_glStencilMaskSeparate(GLenum face, GLuint mask)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glStencilMaskSeparate);
+        trace.value(face);
+        trace.value(mask);
+        ((PFNGLSTENCILMASKSEPARATEPROC)Table<>::loaded[ENTRY_glStencilMaskSeparate])(face, mask);
+    }
+    inline void APIENTRY record_glAttachShader(GLuint program, GLuint shader)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glAttachShader);
+        trace.value(program);
+        trace.value(shader);
+        ((PFNGLATTACHSHADERPROC)Table<>::loaded[ENTRY_glAttachShader])(program, shader);
+    }
+    inline void APIENTRY record_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBindAttribLocation);
+        trace.value(program);
+        trace.value(index);
+        trace.string(name);
+        ((PFNGLBINDATTRIBLOCATIONPROC)Table<>::loaded[ENTRY_glBindAttribLocation])(program, index, name);
+    }
+    inline void APIENTRY record_glCompileShader(GLuint shader)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glCompileShader);
+        trace.value(shader);
+        ((PFNGLCOMPILESHADERPROC)Table<>::loaded[ENTRY_glCompileShader])(shader);
+    }
+    inline GLuint APIENTRY record_glCreateProgram(void)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glCreateProgram);
+        GLuint result = ((PFNGLCREATEPROGRAMPROC)Table<>::loaded[ENTRY_glCreateProgram])();
+        trace.value(result);
+        return result;
+    }
+    inline GLuint APIENTRY record_glCreateShader(GLenum type)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glCreateShader);
+        trace.value(type);
+        GLuint result = ((PFNGLCREATESHADERPROC)Table<>::loaded[ENTRY_glCreateShader])(type);
+        trace.value(result);
+        return result;
+    }
+    inline void APIENTRY record_glDeleteProgram(GLuint program)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDeleteProgram);
+        trace.value(program);
+        ((PFNGLDELETEPROGRAMPROC)Table<>::loaded[ENTRY_glDeleteProgram])(program);
+    }
+    inline void APIENTRY record_glDeleteShader(GLuint shader)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDeleteShader);
+        trace.value(shader);
+        ((PFNGLDELETESHADERPROC)Table<>::loaded[ENTRY_glDeleteShader])(shader);
+    }
+    inline void APIENTRY record_glDetachShader(GLuint program, GLuint shader)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDetachShader);
+        trace.value(program);
+        trace.value(shader);
+        ((PFNGLDETACHSHADERPROC)Table<>::loaded[ENTRY_glDetachShader])(program, shader);
+    }
+    inline void APIENTRY record_glDisableVertexAttribArray(GLuint index)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDisableVertexAttribArray);
+        trace.value(index);
+        ((PFNGLDISABLEVERTEXATTRIBARRAYPROC)Table<>::loaded[ENTRY_glDisableVertexAttribArray])(index);
+    }
+    inline void APIENTRY record_glEnableVertexAttribArray(GLuint index)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glEnableVertexAttribArray);
+        trace.value(index);
+        ((PFNGLENABLEVERTEXATTRIBARRAYPROC)Table<>::loaded[ENTRY_glEnableVertexAttribArray])(index);
+    }
+    inline GLint APIENTRY record_glGetUniformLocation(GLuint program, const GLchar *name)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glGetUniformLocation);
+        trace.value(program);
+        trace.string(name);
+        GLint result = ((PFNGLGETUNIFORMLOCATIONPROC)Table<>::loaded[ENTRY_glGetUniformLocation])(program, name);
+        trace.value(result);
+        return result;
+    }
+    inline void APIENTRY record_glLinkProgram(GLuint program)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glLinkProgram);
+        trace.value(program);
+        ((PFNGLLINKPROGRAMPROC)Table<>::loaded[ENTRY_glLinkProgram])(program);
+    }
+    inline void APIENTRY record_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glShaderSource);
+        trace.value(shader);
+        trace.value(count);
+        trace.shaderSource(count, string, length);
+        ((PFNGLSHADERSOURCEPROC)Table<>::loaded[ENTRY_glShaderSource])(shader, count, string, length);
+    }
+    inline void APIENTRY record_glUseProgram(GLuint program)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUseProgram);
+        trace.value(program);
+        ((PFNGLUSEPROGRAMPROC)Table<>::loaded[ENTRY_glUseProgram])(program);
+    }
+    inline void APIENTRY record_glUniform1f(GLint location, GLfloat v0)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform1f);
+        trace.value(location);
+        trace.value(v0);
+        ((PFNGLUNIFORM1FPROC)Table<>::loaded[ENTRY_glUniform1f])(location, v0);
+    }
+    inline void APIENTRY record_glUniform2f(GLint location, GLfloat v0, GLfloat v1)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform2f);
+        trace.value(location);
+        trace.value(v0);
+        trace.value(v1);
+        ((PFNGLUNIFORM2FPROC)Table<>::loaded[ENTRY_glUniform2f])(location, v0, v1);
+    }
+    inline void APIENTRY record_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform3f);
+        trace.value(location);
+        trace.value(v0);
+        trace.value(v1);
+        trace.value(v2);
+        ((PFNGLUNIFORM3FPROC)Table<>::loaded[ENTRY_glUniform3f])(location, v0, v1, v2);
+    }
+    inline void APIENTRY record_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform4f);
+        trace.value(location);
+        trace.value(v0);
+        trace.value(v1);
+        trace.value(v2);
+        trace.value(v3);
+        ((PFNGLUNIFORM4FPROC)Table<>::loaded[ENTRY_glUniform4f])(location, v0, v1, v2, v3);
+    }
+    inline void APIENTRY record_glUniform1i(GLint location, GLint v0)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform1i);
+        trace.value(location);
+        trace.value(v0);
+        ((PFNGLUNIFORM1IPROC)Table<>::loaded[ENTRY_glUniform1i])(location, v0);
+    }
+    inline void APIENTRY record_glUniform2i(GLint location, GLint v0, GLint v1)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform2i);
+        trace.value(location);
+        trace.value(v0);
+        trace.value(v1);
+        ((PFNGLUNIFORM2IPROC)Table<>::loaded[ENTRY_glUniform2i])(location, v0, v1);
+    }
+    inline void APIENTRY record_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform3i);
+        trace.value(location);
+        trace.value(v0);
+        trace.value(v1);
+        trace.value(v2);
+        ((PFNGLUNIFORM3IPROC)Table<>::loaded[ENTRY_glUniform3i])(location, v0, v1, v2);
+    }
+    inline void APIENTRY record_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform4i);
+        trace.value(location);
+        trace.value(v0);
+        trace.value(v1);
+        trace.value(v2);
+        trace.value(v3);
+        ((PFNGLUNIFORM4IPROC)Table<>::loaded[ENTRY_glUniform4i])(location, v0, v1, v2, v3);
+    }
+    inline void APIENTRY record_glUniform1fv(GLint location, GLsizei count, const GLfloat *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform1fv);
+        trace.value(location);
+        trace.value(count);
+        trace.pointer(value, (size_t)std::max(count, 0) * 1 * 4);
+        ((PFNGLUNIFORM1FVPROC)Table<>::loaded[ENTRY_glUniform1fv])(location, count, value);
+    }
+    inline void APIENTRY record_glUniform2fv(GLint location, GLsizei count, const GLfloat *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform2fv);
+        trace.value(location);
+        trace.value(count);
+        trace.pointer(value, (size_t)std::max(count, 0) * 2 * 4);
+        ((PFNGLUNIFORM2FVPROC)Table<>::loaded[ENTRY_glUniform2fv])(location, count, value);
+    }
+    inline void APIENTRY record_glUniform3fv(GLint location, GLsizei count, const GLfloat *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform3fv);
+        trace.value(location);
+        trace.value(count);
+        trace.pointer(value, (size_t)std::max(count, 0) * 3 * 4);
+        ((PFNGLUNIFORM3FVPROC)Table<>::loaded[ENTRY_glUniform3fv])(location, count, value);
+    }
+    inline void APIENTRY record_glUniform4fv(GLint location, GLsizei count, const GLfloat *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform4fv);
+        trace.value(location);
+        trace.value(count);
+        trace.pointer(value, (size_t)std::max(count, 0) * 4 * 4);
+        ((PFNGLUNIFORM4FVPROC)Table<>::loaded[ENTRY_glUniform4fv])(location, count, value);
+    }
+    inline void APIENTRY record_glUniform1iv(GLint location, GLsizei count, const GLint *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform1iv);
+        trace.value(location);
+        trace.value(count);
+        trace.pointer(value, (size_t)std::max(count, 0) * 1 * 4);
+        ((PFNGLUNIFORM1IVPROC)Table<>::loaded[ENTRY_glUniform1iv])(location, count, value);
+    }
+    inline void APIENTRY record_glUniform2iv(GLint location, GLsizei count, const GLint *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform2iv);
+        trace.value(location);
+        trace.value(count);
+        trace.pointer(value, (size_t)std::max(count, 0) * 2 * 4);
+        ((PFNGLUNIFORM2IVPROC)Table<>::loaded[ENTRY_glUniform2iv])(location, count, value);
+    }
+    inline void APIENTRY record_glUniform3iv(GLint location, GLsizei count, const GLint *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform3iv);
+        trace.value(location);
+        trace.value(count);
+        trace.pointer(value, (size_t)std::max(count, 0) * 3 * 4);
+        ((PFNGLUNIFORM3IVPROC)Table<>::loaded[ENTRY_glUniform3iv])(location, count, value);
+    }
+    inline void APIENTRY record_glUniform4iv(GLint location, GLsizei count, const GLint *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform4iv);
+        trace.value(location);
+        trace.value(count);
+        trace.pointer(value, (size_t)std::max(count, 0) * 4 * 4);
+        ((PFNGLUNIFORM4IVPROC)Table<>::loaded[ENTRY_glUniform4iv])(location, count, value);
+    }
+    inline void APIENTRY record_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniformMatrix2fv);
+        trace.value(location);
+        trace.value(count);
+        trace.value(transpose);
+        trace.pointer(value, (size_t)std::max(count, 0) * 2 * 2 * 4);
+        ((PFNGLUNIFORMMATRIX2FVPROC)Table<>::loaded[ENTRY_glUniformMatrix2fv])(location, count, transpose, value);
+    }
+    inline void APIENTRY record_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniformMatrix3fv);
+        trace.value(location);
+        trace.value(count);
+        trace.value(transpose);
+        trace.pointer(value, (size_t)std::max(count, 0) * 3 * 3 * 4);
+        ((PFNGLUNIFORMMATRIX3FVPROC)Table<>::loaded[ENTRY_glUniformMatrix3fv])(location, count, transpose, value);
+    }
+    inline void APIENTRY record_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniformMatrix4fv);
+        trace.value(location);
+        trace.value(count);
+        trace.value(transpose);
+        trace.pointer(value, (size_t)std::max(count, 0) * 4 * 4 * 4);
+        ((PFNGLUNIFORMMATRIX4FVPROC)Table<>::loaded[ENTRY_glUniformMatrix4fv])(location, count, transpose, value);
+    }
+    inline void APIENTRY record_glValidateProgram(GLuint program)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glValidateProgram);
+        trace.value(program);
+        ((PFNGLVALIDATEPROGRAMPROC)Table<>::loaded[ENTRY_glValidateProgram])(program);
+    }
+    inline void APIENTRY record_glVertexAttrib1d(GLuint index, GLdouble x)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib1d);
+        trace.value(index);
+        trace.value(x);
+        ((PFNGLVERTEXATTRIB1DPROC)Table<>::loaded[ENTRY_glVertexAttrib1d])(index, x);
+    }
+    inline void APIENTRY record_glVertexAttrib1dv(GLuint index, const GLdouble *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib1dv);
+        trace.value(index);
+        trace.pointer(v, 8);
+        ((PFNGLVERTEXATTRIB1DVPROC)Table<>::loaded[ENTRY_glVertexAttrib1dv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib1f(GLuint index, GLfloat x)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib1f);
+        trace.value(index);
+        trace.value(x);
+        ((PFNGLVERTEXATTRIB1FPROC)Table<>::loaded[ENTRY_glVertexAttrib1f])(index, x);
+    }
+    inline void APIENTRY record_glVertexAttrib1fv(GLuint index, const GLfloat *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib1fv);
+        trace.value(index);
+        trace.pointer(v, 4);
+        ((PFNGLVERTEXATTRIB1FVPROC)Table<>::loaded[ENTRY_glVertexAttrib1fv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib1s(GLuint index, GLshort x)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib1s);
+        trace.value(index);
+        trace.value(x);
+        ((PFNGLVERTEXATTRIB1SPROC)Table<>::loaded[ENTRY_glVertexAttrib1s])(index, x);
+    }
+    inline void APIENTRY record_glVertexAttrib1sv(GLuint index, const GLshort *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib1sv);
+        trace.value(index);
+        trace.pointer(v, 2);
+        ((PFNGLVERTEXATTRIB1SVPROC)Table<>::loaded[ENTRY_glVertexAttrib1sv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib2d);
+        trace.value(index);
+        trace.value(x);
+        trace.value(y);
+        ((PFNGLVERTEXATTRIB2DPROC)Table<>::loaded[ENTRY_glVertexAttrib2d])(index, x, y);
+    }
+    inline void APIENTRY record_glVertexAttrib2dv(GLuint index, const GLdouble *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib2dv);
+        trace.value(index);
+        trace.pointer(v, 16);
+        ((PFNGLVERTEXATTRIB2DVPROC)Table<>::loaded[ENTRY_glVertexAttrib2dv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib2f);
+        trace.value(index);
+        trace.value(x);
+        trace.value(y);
+        ((PFNGLVERTEXATTRIB2FPROC)Table<>::loaded[ENTRY_glVertexAttrib2f])(index, x, y);
+    }
+    inline void APIENTRY record_glVertexAttrib2fv(GLuint index, const GLfloat *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib2fv);
+        trace.value(index);
+        trace.pointer(v, 8);
+        ((PFNGLVERTEXATTRIB2FVPROC)Table<>::loaded[ENTRY_glVertexAttrib2fv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib2s(GLuint index, GLshort x, GLshort y)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib2s);
+        trace.value(index);
+        trace.value(x);
+        trace.value(y);
+        ((PFNGLVERTEXATTRIB2SPROC)Table<>::loaded[ENTRY_glVertexAttrib2s])(index, x, y);
+    }
+    inline void APIENTRY record_glVertexAttrib2sv(GLuint index, const GLshort *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib2sv);
+        trace.value(index);
+        trace.pointer(v, 4);
+        ((PFNGLVERTEXATTRIB2SVPROC)Table<>::loaded[ENTRY_glVertexAttrib2sv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib3d);
+        trace.value(index);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLVERTEXATTRIB3DPROC)Table<>::loaded[ENTRY_glVertexAttrib3d])(index, x, y, z);
+    }
+    inline void APIENTRY record_glVertexAttrib3dv(GLuint index, const GLdouble *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib3dv);
+        trace.value(index);
+        trace.pointer(v, 24);
+        ((PFNGLVERTEXATTRIB3DVPROC)Table<>::loaded[ENTRY_glVertexAttrib3dv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib3f);
+        trace.value(index);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLVERTEXATTRIB3FPROC)Table<>::loaded[ENTRY_glVertexAttrib3f])(index, x, y, z);
+    }
+    inline void APIENTRY record_glVertexAttrib3fv(GLuint index, const GLfloat *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib3fv);
+        trace.value(index);
+        trace.pointer(v, 12);
+        ((PFNGLVERTEXATTRIB3FVPROC)Table<>::loaded[ENTRY_glVertexAttrib3fv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib3s);
+        trace.value(index);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLVERTEXATTRIB3SPROC)Table<>::loaded[ENTRY_glVertexAttrib3s])(index, x, y, z);
+    }
+    inline void APIENTRY record_glVertexAttrib3sv(GLuint index, const GLshort *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib3sv);
+        trace.value(index);
+        trace.pointer(v, 6);
+        ((PFNGLVERTEXATTRIB3SVPROC)Table<>::loaded[ENTRY_glVertexAttrib3sv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib4Nbv(GLuint index, const GLbyte *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib4Nbv);
+        trace.value(index);
+        trace.pointer(v, 4);
+        ((PFNGLVERTEXATTRIB4NBVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nbv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib4Niv(GLuint index, const GLint *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib4Niv);
+        trace.value(index);
+        trace.pointer(v, 16);
+        ((PFNGLVERTEXATTRIB4NIVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Niv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib4Nsv(GLuint index, const GLshort *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib4Nsv);
+        trace.value(index);
+        trace.pointer(v, 8);
+        ((PFNGLVERTEXATTRIB4NSVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nsv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib4Nub);
+        trace.value(index);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        trace.value(w);
+        ((PFNGLVERTEXATTRIB4NUBPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nub])(index, x, y, z, w);
+    }
+    inline void APIENTRY record_glVertexAttrib4Nubv(GLuint index, const GLubyte *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib4Nubv);
+        trace.value(index);
+        trace.pointer(v, 4);
+        ((PFNGLVERTEXATTRIB4NUBVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nubv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib4Nuiv(GLuint index, const GLuint *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib4Nuiv);
+        trace.value(index);
+        trace.pointer(v, 16);
+        ((PFNGLVERTEXATTRIB4NUIVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nuiv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib4Nusv(GLuint index, const GLushort *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib4Nusv);
+        trace.value(index);
+        trace.pointer(v, 8);
+        ((PFNGLVERTEXATTRIB4NUSVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nusv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib4bv(GLuint index, const GLbyte *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib4bv);
+        trace.value(index);
+        trace.pointer(v, 4);
+        ((PFNGLVERTEXATTRIB4BVPROC)Table<>::loaded[ENTRY_glVertexAttrib4bv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib4d);
+        trace.value(index);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        trace.value(w);
+        ((PFNGLVERTEXATTRIB4DPROC)Table<>::loaded[ENTRY_glVertexAttrib4d])(index, x, y, z, w);
+    }
+    inline void APIENTRY record_glVertexAttrib4dv(GLuint index, const GLdouble *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib4dv);
+        trace.value(index);
+        trace.pointer(v, 32);
+        ((PFNGLVERTEXATTRIB4DVPROC)Table<>::loaded[ENTRY_glVertexAttrib4dv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib4f);
+        trace.value(index);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        trace.value(w);
+        ((PFNGLVERTEXATTRIB4FPROC)Table<>::loaded[ENTRY_glVertexAttrib4f])(index, x, y, z, w);
+    }
+    inline void APIENTRY record_glVertexAttrib4fv(GLuint index, const GLfloat *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib4fv);
+        trace.value(index);
+        trace.pointer(v, 16);
+        ((PFNGLVERTEXATTRIB4FVPROC)Table<>::loaded[ENTRY_glVertexAttrib4fv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib4iv(GLuint index, const GLint *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib4iv);
+        trace.value(index);
+        trace.pointer(v, 16);
+        ((PFNGLVERTEXATTRIB4IVPROC)Table<>::loaded[ENTRY_glVertexAttrib4iv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib4s);
+        trace.value(index);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        trace.value(w);
+        ((PFNGLVERTEXATTRIB4SPROC)Table<>::loaded[ENTRY_glVertexAttrib4s])(index, x, y, z, w);
+    }
+    inline void APIENTRY record_glVertexAttrib4sv(GLuint index, const GLshort *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib4sv);
+        trace.value(index);
+        trace.pointer(v, 8);
+        ((PFNGLVERTEXATTRIB4SVPROC)Table<>::loaded[ENTRY_glVertexAttrib4sv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib4ubv(GLuint index, const GLubyte *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib4ubv);
+        trace.value(index);
+        trace.pointer(v, 4);
+        ((PFNGLVERTEXATTRIB4UBVPROC)Table<>::loaded[ENTRY_glVertexAttrib4ubv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib4uiv(GLuint index, const GLuint *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib4uiv);
+        trace.value(index);
+        trace.pointer(v, 16);
+        ((PFNGLVERTEXATTRIB4UIVPROC)Table<>::loaded[ENTRY_glVertexAttrib4uiv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttrib4usv(GLuint index, const GLushort *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttrib4usv);
+        trace.value(index);
+        trace.pointer(v, 8);
+        ((PFNGLVERTEXATTRIB4USVPROC)Table<>::loaded[ENTRY_glVertexAttrib4usv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribPointer);
+        trace.value(index);
+        trace.value(size);
+        trace.value(type);
+        trace.value(normalized);
+        trace.value(stride);
+        trace.offset(pointer);
+        ((PFNGLVERTEXATTRIBPOINTERPROC)Table<>::loaded[ENTRY_glVertexAttribPointer])(index, size, type, normalized, stride, pointer);
+    }
+    inline void APIENTRY record_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniformMatrix2x3fv);
+        trace.value(location);
+        trace.value(count);
+        trace.value(transpose);
+        trace.pointer(value, (size_t)std::max(count, 0) * 2 * 3 * 4);
+        ((PFNGLUNIFORMMATRIX2X3FVPROC)Table<>::loaded[ENTRY_glUniformMatrix2x3fv])(location, count, transpose, value);
+    }
+    inline void APIENTRY record_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniformMatrix3x2fv);
+        trace.value(location);
+        trace.value(count);
+        trace.value(transpose);
+        trace.pointer(value, (size_t)std::max(count, 0) * 3 * 2 * 4);
+        ((PFNGLUNIFORMMATRIX3X2FVPROC)Table<>::loaded[ENTRY_glUniformMatrix3x2fv])(location, count, transpose, value);
+    }
+    inline void APIENTRY record_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniformMatrix2x4fv);
+        trace.value(location);
+        trace.value(count);
+        trace.value(transpose);
+        trace.pointer(value, (size_t)std::max(count, 0) * 2 * 4 * 4);
+        ((PFNGLUNIFORMMATRIX2X4FVPROC)Table<>::loaded[ENTRY_glUniformMatrix2x4fv])(location, count, transpose, value);
+    }
+    inline void APIENTRY record_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniformMatrix4x2fv);
+        trace.value(location);
+        trace.value(count);
+        trace.value(transpose);
+        trace.pointer(value, (size_t)std::max(count, 0) * 4 * 2 * 4);
+        ((PFNGLUNIFORMMATRIX4X2FVPROC)Table<>::loaded[ENTRY_glUniformMatrix4x2fv])(location, count, transpose, value);
+    }
+    inline void APIENTRY record_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniformMatrix3x4fv);
+        trace.value(location);
+        trace.value(count);
+        trace.value(transpose);
+        trace.pointer(value, (size_t)std::max(count, 0) * 3 * 4 * 4);
+        ((PFNGLUNIFORMMATRIX3X4FVPROC)Table<>::loaded[ENTRY_glUniformMatrix3x4fv])(location, count, transpose, value);
+    }
+    inline void APIENTRY record_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniformMatrix4x3fv);
+        trace.value(location);
+        trace.value(count);
+        trace.value(transpose);
+        trace.pointer(value, (size_t)std::max(count, 0) * 4 * 3 * 4);
+        ((PFNGLUNIFORMMATRIX4X3FVPROC)Table<>::loaded[ENTRY_glUniformMatrix4x3fv])(location, count, transpose, value);
+    }
+    inline void APIENTRY record_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColorMaski);
+        trace.value(index);
+        trace.value(r);
+        trace.value(g);
+        trace.value(b);
+        trace.value(a);
+        ((PFNGLCOLORMASKIPROC)Table<>::loaded[ENTRY_glColorMaski])(index, r, g, b, a);
+    }
+    inline void APIENTRY record_glEnablei(GLenum target, GLuint index)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glEnablei);
+        trace.value(target);
+        trace.value(index);
+        ((PFNGLENABLEIPROC)Table<>::loaded[ENTRY_glEnablei])(target, index);
+    }
+    inline void APIENTRY record_glDisablei(GLenum target, GLuint index)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDisablei);
+        trace.value(target);
+        trace.value(index);
+        ((PFNGLDISABLEIPROC)Table<>::loaded[ENTRY_glDisablei])(target, index);
+    }
+    inline void APIENTRY record_glBeginTransformFeedback(GLenum primitiveMode)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBeginTransformFeedback);
+        trace.value(primitiveMode);
+        ((PFNGLBEGINTRANSFORMFEEDBACKPROC)Table<>::loaded[ENTRY_glBeginTransformFeedback])(primitiveMode);
+    }
+    inline void APIENTRY record_glEndTransformFeedback(void)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glEndTransformFeedback);
+        ((PFNGLENDTRANSFORMFEEDBACKPROC)Table<>::loaded[ENTRY_glEndTransformFeedback])();
+    }
+    inline void APIENTRY record_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBindBufferRange);
+        trace.value(target);
+        trace.value(index);
+        trace.value(buffer);
+        trace.value(offset);
+        trace.value(size);
+        ((PFNGLBINDBUFFERRANGEPROC)Table<>::loaded[ENTRY_glBindBufferRange])(target, index, buffer, offset, size);
+        trace.bindBuffer(target, buffer);
+    }
+    inline void APIENTRY record_glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBindBufferBase);
+        trace.value(target);
+        trace.value(index);
+        trace.value(buffer);
+        ((PFNGLBINDBUFFERBASEPROC)Table<>::loaded[ENTRY_glBindBufferBase])(target, index, buffer);
+        trace.bindBuffer(target, buffer);
+    }
+    inline void APIENTRY record_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode)
+    {
+        recorder().unsupported(ENTRY_glTransformFeedbackVaryings);
+        ((PFNGLTRANSFORMFEEDBACKVARYINGSPROC)Table<>::loaded[ENTRY_glTransformFeedbackVaryings])(program, count, varyings, bufferMode);
+    }
+    inline void APIENTRY record_glClampColor(GLenum target, GLenum clamp)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glClampColor);
+        trace.value(target);
+        trace.value(clamp);
+        ((PFNGLCLAMPCOLORPROC)Table<>::loaded[ENTRY_glClampColor])(target, clamp);
+    }
+    inline void APIENTRY record_glBeginConditionalRender(GLuint id, GLenum mode)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBeginConditionalRender);
+        trace.value(id);
+        trace.value(mode);
+        ((PFNGLBEGINCONDITIONALRENDERPROC)Table<>::loaded[ENTRY_glBeginConditionalRender])(id, mode);
+    }
+    inline void APIENTRY record_glEndConditionalRender(void)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glEndConditionalRender);
+        ((PFNGLENDCONDITIONALRENDERPROC)Table<>::loaded[ENTRY_glEndConditionalRender])();
+    }
+    inline void APIENTRY record_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribIPointer);
+        trace.value(index);
+        trace.value(size);
+        trace.value(type);
+        trace.value(stride);
+        trace.offset(pointer);
+        ((PFNGLVERTEXATTRIBIPOINTERPROC)Table<>::loaded[ENTRY_glVertexAttribIPointer])(index, size, type, stride, pointer);
+    }
+    inline void APIENTRY record_glVertexAttribI1i(GLuint index, GLint x)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI1i);
+        trace.value(index);
+        trace.value(x);
+        ((PFNGLVERTEXATTRIBI1IPROC)Table<>::loaded[ENTRY_glVertexAttribI1i])(index, x);
+    }
+    inline void APIENTRY record_glVertexAttribI2i(GLuint index, GLint x, GLint y)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI2i);
+        trace.value(index);
+        trace.value(x);
+        trace.value(y);
+        ((PFNGLVERTEXATTRIBI2IPROC)Table<>::loaded[ENTRY_glVertexAttribI2i])(index, x, y);
+    }
+    inline void APIENTRY record_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI3i);
+        trace.value(index);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLVERTEXATTRIBI3IPROC)Table<>::loaded[ENTRY_glVertexAttribI3i])(index, x, y, z);
+    }
+    inline void APIENTRY record_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI4i);
+        trace.value(index);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        trace.value(w);
+        ((PFNGLVERTEXATTRIBI4IPROC)Table<>::loaded[ENTRY_glVertexAttribI4i])(index, x, y, z, w);
+    }
+    inline void APIENTRY record_glVertexAttribI1ui(GLuint index, GLuint x)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI1ui);
+        trace.value(index);
+        trace.value(x);
+        ((PFNGLVERTEXATTRIBI1UIPROC)Table<>::loaded[ENTRY_glVertexAttribI1ui])(index, x);
+    }
+    inline void APIENTRY record_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI2ui);
+        trace.value(index);
+        trace.value(x);
+        trace.value(y);
+        ((PFNGLVERTEXATTRIBI2UIPROC)Table<>::loaded[ENTRY_glVertexAttribI2ui])(index, x, y);
+    }
+    inline void APIENTRY record_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI3ui);
+        trace.value(index);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        ((PFNGLVERTEXATTRIBI3UIPROC)Table<>::loaded[ENTRY_glVertexAttribI3ui])(index, x, y, z);
+    }
+    inline void APIENTRY record_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI4ui);
+        trace.value(index);
+        trace.value(x);
+        trace.value(y);
+        trace.value(z);
+        trace.value(w);
+        ((PFNGLVERTEXATTRIBI4UIPROC)Table<>::loaded[ENTRY_glVertexAttribI4ui])(index, x, y, z, w);
+    }
+    inline void APIENTRY record_glVertexAttribI1iv(GLuint index, const GLint *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI1iv);
+        trace.value(index);
+        trace.pointer(v, 4);
+        ((PFNGLVERTEXATTRIBI1IVPROC)Table<>::loaded[ENTRY_glVertexAttribI1iv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttribI2iv(GLuint index, const GLint *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI2iv);
+        trace.value(index);
+        trace.pointer(v, 8);
+        ((PFNGLVERTEXATTRIBI2IVPROC)Table<>::loaded[ENTRY_glVertexAttribI2iv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttribI3iv(GLuint index, const GLint *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI3iv);
+        trace.value(index);
+        trace.pointer(v, 12);
+        ((PFNGLVERTEXATTRIBI3IVPROC)Table<>::loaded[ENTRY_glVertexAttribI3iv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttribI4iv(GLuint index, const GLint *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI4iv);
+        trace.value(index);
+        trace.pointer(v, 16);
+        ((PFNGLVERTEXATTRIBI4IVPROC)Table<>::loaded[ENTRY_glVertexAttribI4iv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttribI1uiv(GLuint index, const GLuint *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI1uiv);
+        trace.value(index);
+        trace.pointer(v, 4);
+        ((PFNGLVERTEXATTRIBI1UIVPROC)Table<>::loaded[ENTRY_glVertexAttribI1uiv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttribI2uiv(GLuint index, const GLuint *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI2uiv);
+        trace.value(index);
+        trace.pointer(v, 8);
+        ((PFNGLVERTEXATTRIBI2UIVPROC)Table<>::loaded[ENTRY_glVertexAttribI2uiv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttribI3uiv(GLuint index, const GLuint *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI3uiv);
+        trace.value(index);
+        trace.pointer(v, 12);
+        ((PFNGLVERTEXATTRIBI3UIVPROC)Table<>::loaded[ENTRY_glVertexAttribI3uiv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttribI4uiv(GLuint index, const GLuint *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI4uiv);
+        trace.value(index);
+        trace.pointer(v, 16);
+        ((PFNGLVERTEXATTRIBI4UIVPROC)Table<>::loaded[ENTRY_glVertexAttribI4uiv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttribI4bv(GLuint index, const GLbyte *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI4bv);
+        trace.value(index);
+        trace.pointer(v, 4);
+        ((PFNGLVERTEXATTRIBI4BVPROC)Table<>::loaded[ENTRY_glVertexAttribI4bv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttribI4sv(GLuint index, const GLshort *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI4sv);
+        trace.value(index);
+        trace.pointer(v, 8);
+        ((PFNGLVERTEXATTRIBI4SVPROC)Table<>::loaded[ENTRY_glVertexAttribI4sv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttribI4ubv(GLuint index, const GLubyte *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI4ubv);
+        trace.value(index);
+        trace.pointer(v, 4);
+        ((PFNGLVERTEXATTRIBI4UBVPROC)Table<>::loaded[ENTRY_glVertexAttribI4ubv])(index, v);
+    }
+    inline void APIENTRY record_glVertexAttribI4usv(GLuint index, const GLushort *v)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribI4usv);
+        trace.value(index);
+        trace.pointer(v, 8);
+        ((PFNGLVERTEXATTRIBI4USVPROC)Table<>::loaded[ENTRY_glVertexAttribI4usv])(index, v);
+    }
+    inline void APIENTRY record_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBindFragDataLocation);
+        trace.value(program);
+        trace.value(color);
+        trace.string(name);
+        ((PFNGLBINDFRAGDATALOCATIONPROC)Table<>::loaded[ENTRY_glBindFragDataLocation])(program, color, name);
+    }
+    inline void APIENTRY record_glUniform1ui(GLint location, GLuint v0)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform1ui);
+        trace.value(location);
+        trace.value(v0);
+        ((PFNGLUNIFORM1UIPROC)Table<>::loaded[ENTRY_glUniform1ui])(location, v0);
+    }
+    inline void APIENTRY record_glUniform2ui(GLint location, GLuint v0, GLuint v1)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform2ui);
+        trace.value(location);
+        trace.value(v0);
+        trace.value(v1);
+        ((PFNGLUNIFORM2UIPROC)Table<>::loaded[ENTRY_glUniform2ui])(location, v0, v1);
+    }
+    inline void APIENTRY record_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform3ui);
+        trace.value(location);
+        trace.value(v0);
+        trace.value(v1);
+        trace.value(v2);
+        ((PFNGLUNIFORM3UIPROC)Table<>::loaded[ENTRY_glUniform3ui])(location, v0, v1, v2);
+    }
+    inline void APIENTRY record_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform4ui);
+        trace.value(location);
+        trace.value(v0);
+        trace.value(v1);
+        trace.value(v2);
+        trace.value(v3);
+        ((PFNGLUNIFORM4UIPROC)Table<>::loaded[ENTRY_glUniform4ui])(location, v0, v1, v2, v3);
+    }
+    inline void APIENTRY record_glUniform1uiv(GLint location, GLsizei count, const GLuint *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform1uiv);
+        trace.value(location);
+        trace.value(count);
+        trace.pointer(value, (size_t)std::max(count, 0) * 1 * 4);
+        ((PFNGLUNIFORM1UIVPROC)Table<>::loaded[ENTRY_glUniform1uiv])(location, count, value);
+    }
+    inline void APIENTRY record_glUniform2uiv(GLint location, GLsizei count, const GLuint *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform2uiv);
+        trace.value(location);
+        trace.value(count);
+        trace.pointer(value, (size_t)std::max(count, 0) * 2 * 4);
+        ((PFNGLUNIFORM2UIVPROC)Table<>::loaded[ENTRY_glUniform2uiv])(location, count, value);
+    }
+    inline void APIENTRY record_glUniform3uiv(GLint location, GLsizei count, const GLuint *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform3uiv);
+        trace.value(location);
+        trace.value(count);
+        trace.pointer(value, (size_t)std::max(count, 0) * 3 * 4);
+        ((PFNGLUNIFORM3UIVPROC)Table<>::loaded[ENTRY_glUniform3uiv])(location, count, value);
+    }
+    inline void APIENTRY record_glUniform4uiv(GLint location, GLsizei count, const GLuint *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniform4uiv);
+        trace.value(location);
+        trace.value(count);
+        trace.pointer(value, (size_t)std::max(count, 0) * 4 * 4);
+        ((PFNGLUNIFORM4UIVPROC)Table<>::loaded[ENTRY_glUniform4uiv])(location, count, value);
+    }
+    inline void APIENTRY record_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexParameterIiv);
+        trace.value(target);
+        trace.value(pname);
+        trace.pointer(params, gltrace::parameterCount(pname) * 4);
+        ((PFNGLTEXPARAMETERIIVPROC)Table<>::loaded[ENTRY_glTexParameterIiv])(target, pname, params);
+    }
+    inline void APIENTRY record_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexParameterIuiv);
+        trace.value(target);
+        trace.value(pname);
+        trace.pointer(params, gltrace::parameterCount(pname) * 4);
+        ((PFNGLTEXPARAMETERIUIVPROC)Table<>::loaded[ENTRY_glTexParameterIuiv])(target, pname, params);
+    }
+    inline void APIENTRY record_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glClearBufferiv);
+        trace.value(buffer);
+        trace.value(drawbuffer);
+        trace.pointer(value, (buffer == GL_COLOR ? 4 : 1) * 4);
+        ((PFNGLCLEARBUFFERIVPROC)Table<>::loaded[ENTRY_glClearBufferiv])(buffer, drawbuffer, value);
+    }
+    inline void APIENTRY record_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glClearBufferuiv);
+        trace.value(buffer);
+        trace.value(drawbuffer);
+        trace.pointer(value, (buffer == GL_COLOR ? 4 : 1) * 4);
+        ((PFNGLCLEARBUFFERUIVPROC)Table<>::loaded[ENTRY_glClearBufferuiv])(buffer, drawbuffer, value);
+    }
+    inline void APIENTRY record_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glClearBufferfv);
+        trace.value(buffer);
+        trace.value(drawbuffer);
+        trace.pointer(value, (buffer == GL_COLOR ? 4 : 1) * 4);
+        ((PFNGLCLEARBUFFERFVPROC)Table<>::loaded[ENTRY_glClearBufferfv])(buffer, drawbuffer, value);
+    }
+    inline void APIENTRY record_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glClearBufferfi);
+        trace.value(buffer);
+        trace.value(drawbuffer);
+        trace.value(depth);
+        trace.value(stencil);
+        ((PFNGLCLEARBUFFERFIPROC)Table<>::loaded[ENTRY_glClearBufferfi])(buffer, drawbuffer, depth, stencil);
+    }
+    inline void APIENTRY record_glBindRenderbuffer(GLenum target, GLuint renderbuffer)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBindRenderbuffer);
+        trace.value(target);
+        trace.value(renderbuffer);
+        ((PFNGLBINDRENDERBUFFERPROC)Table<>::loaded[ENTRY_glBindRenderbuffer])(target, renderbuffer);
+    }
+    inline void APIENTRY record_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDeleteRenderbuffers);
+        trace.value(n);
+        trace.pointer(renderbuffers, (size_t)std::max(n, 0) * sizeof(GLuint));
+        ((PFNGLDELETERENDERBUFFERSPROC)Table<>::loaded[ENTRY_glDeleteRenderbuffers])(n, renderbuffers);
+    }
+    inline void APIENTRY record_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glGenRenderbuffers);
+        trace.value(n);
+        ((PFNGLGENRENDERBUFFERSPROC)Table<>::loaded[ENTRY_glGenRenderbuffers])(n, renderbuffers);
+        trace.pointer(renderbuffers, (size_t)std::max(n, 0) * sizeof(GLuint));
+    }
+    inline void APIENTRY record_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRenderbufferStorage);
+        trace.value(target);
+        trace.value(internalformat);
+        trace.value(width);
+        trace.value(height);
+        ((PFNGLRENDERBUFFERSTORAGEPROC)Table<>::loaded[ENTRY_glRenderbufferStorage])(target, internalformat, width, height);
+    }
+    inline void APIENTRY record_glBindFramebuffer(GLenum target, GLuint framebuffer)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBindFramebuffer);
+        trace.value(target);
+        trace.value(framebuffer);
+        ((PFNGLBINDFRAMEBUFFERPROC)Table<>::loaded[ENTRY_glBindFramebuffer])(target, framebuffer);
+    }
+    inline void APIENTRY record_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDeleteFramebuffers);
+        trace.value(n);
+        trace.pointer(framebuffers, (size_t)std::max(n, 0) * sizeof(GLuint));
+        ((PFNGLDELETEFRAMEBUFFERSPROC)Table<>::loaded[ENTRY_glDeleteFramebuffers])(n, framebuffers);
+    }
+    inline void APIENTRY record_glGenFramebuffers(GLsizei n, GLuint *framebuffers)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glGenFramebuffers);
+        trace.value(n);
+        ((PFNGLGENFRAMEBUFFERSPROC)Table<>::loaded[ENTRY_glGenFramebuffers])(n, framebuffers);
+        trace.pointer(framebuffers, (size_t)std::max(n, 0) * sizeof(GLuint));
+    }
+    inline void APIENTRY record_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glFramebufferTexture1D);
+        trace.value(target);
+        trace.value(attachment);
+        trace.value(textarget);
+        trace.value(texture);
+        trace.value(level);
+        ((PFNGLFRAMEBUFFERTEXTURE1DPROC)Table<>::loaded[ENTRY_glFramebufferTexture1D])(target, attachment, textarget, texture, level);
+    }
+    inline void APIENTRY record_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glFramebufferTexture2D);
+        trace.value(target);
+        trace.value(attachment);
+        trace.value(textarget);
+        trace.value(texture);
+        trace.value(level);
+        ((PFNGLFRAMEBUFFERTEXTURE2DPROC)Table<>::loaded[ENTRY_glFramebufferTexture2D])(target, attachment, textarget, texture, level);
+    }
+    inline void APIENTRY record_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glFramebufferTexture3D);
+        trace.value(target);
+        trace.value(attachment);
+        trace.value(textarget);
+        trace.value(texture);
+        trace.value(level);
+        trace.value(zoffset);
+        ((PFNGLFRAMEBUFFERTEXTURE3DPROC)Table<>::loaded[ENTRY_glFramebufferTexture3D])(target, attachment, textarget, texture, level, zoffset);
+    }
+    inline void APIENTRY record_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glFramebufferRenderbuffer);
+        trace.value(target);
+        trace.value(attachment);
+        trace.value(renderbuffertarget);
+        trace.value(renderbuffer);
+        ((PFNGLFRAMEBUFFERRENDERBUFFERPROC)Table<>::loaded[ENTRY_glFramebufferRenderbuffer])(target, attachment, renderbuffertarget, renderbuffer);
+    }
+    inline void APIENTRY record_glGenerateMipmap(GLenum target)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glGenerateMipmap);
+        trace.value(target);
+        ((PFNGLGENERATEMIPMAPPROC)Table<>::loaded[ENTRY_glGenerateMipmap])(target);
+    }
+    inline void APIENTRY record_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBlitFramebuffer);
+        trace.value(srcX0);
+        trace.value(srcY0);
+        trace.value(srcX1);
+        trace.value(srcY1);
+        trace.value(dstX0);
+        trace.value(dstY0);
+        trace.value(dstX1);
+        trace.value(dstY1);
+        trace.value(mask);
+        trace.value(filter);
+        ((PFNGLBLITFRAMEBUFFERPROC)Table<>::loaded[ENTRY_glBlitFramebuffer])(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    }
+    inline void APIENTRY record_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glRenderbufferStorageMultisample);
+        trace.value(target);
+        trace.value(samples);
+        trace.value(internalformat);
+        trace.value(width);
+        trace.value(height);
+        ((PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)Table<>::loaded[ENTRY_glRenderbufferStorageMultisample])(target, samples, internalformat, width, height);
+    }
+    inline void APIENTRY record_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glFramebufferTextureLayer);
+        trace.value(target);
+        trace.value(attachment);
+        trace.value(texture);
+        trace.value(level);
+        trace.value(layer);
+        ((PFNGLFRAMEBUFFERTEXTURELAYERPROC)Table<>::loaded[ENTRY_glFramebufferTextureLayer])(target, attachment, texture, level, layer);
+    }
+    inline void * APIENTRY record_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMapBufferRange);
+        trace.value(target);
+        trace.value(offset);
+        trace.value(length);
+        trace.value(access);
+        void * result = ((PFNGLMAPBUFFERRANGEPROC)Table<>::loaded[ENTRY_glMapBufferRange])(target, offset, length, access);
+        trace.mapped(target, result, length, access);
+        return result;
+    }
+    inline void APIENTRY record_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glFlushMappedBufferRange);
+        trace.value(target);
+        trace.value(offset);
+        trace.value(length);
+        ((PFNGLFLUSHMAPPEDBUFFERRANGEPROC)Table<>::loaded[ENTRY_glFlushMappedBufferRange])(target, offset, length);
+    }
+    inline void APIENTRY record_glBindVertexArray(GLuint array)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBindVertexArray);
+        trace.value(array);
+        ((PFNGLBINDVERTEXARRAYPROC)Table<>::loaded[ENTRY_glBindVertexArray])(array);
+        trace.bindVertexArray(array);
+    }
+    inline void APIENTRY record_glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDeleteVertexArrays);
+        trace.value(n);
+        trace.pointer(arrays, (size_t)std::max(n, 0) * sizeof(GLuint));
+        ((PFNGLDELETEVERTEXARRAYSPROC)Table<>::loaded[ENTRY_glDeleteVertexArrays])(n, arrays);
+        trace.deleteVertexArrays(n, arrays);
+    }
+    inline void APIENTRY record_glGenVertexArrays(GLsizei n, GLuint *arrays)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glGenVertexArrays);
+        trace.value(n);
+        ((PFNGLGENVERTEXARRAYSPROC)Table<>::loaded[ENTRY_glGenVertexArrays])(n, arrays);
+        trace.pointer(arrays, (size_t)std::max(n, 0) * sizeof(GLuint));
+    }
+    inline void APIENTRY record_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDrawArraysInstanced);
+        trace.value(mode);
+        trace.value(first);
+        trace.value(count);
+        trace.value(instancecount);
+        ((PFNGLDRAWARRAYSINSTANCEDPROC)Table<>::loaded[ENTRY_glDrawArraysInstanced])(mode, first, count, instancecount);
+    }
+    inline void APIENTRY record_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDrawElementsInstanced);
+        trace.value(mode);
+        trace.value(count);
+        trace.value(type);
+        trace.offset(indices);
+        trace.value(instancecount);
+        ((PFNGLDRAWELEMENTSINSTANCEDPROC)Table<>::loaded[ENTRY_glDrawElementsInstanced])(mode, count, type, indices, instancecount);
+    }
+    inline void APIENTRY record_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexBuffer);
+        trace.value(target);
+        trace.value(internalformat);
+        trace.value(buffer);
+        ((PFNGLTEXBUFFERPROC)Table<>::loaded[ENTRY_glTexBuffer])(target, internalformat, buffer);
+    }
+    inline void APIENTRY record_glPrimitiveRestartIndex(GLuint index)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glPrimitiveRestartIndex);
+        trace.value(index);
+        ((PFNGLPRIMITIVERESTARTINDEXPROC)Table<>::loaded[ENTRY_glPrimitiveRestartIndex])(index);
+    }
+    inline void APIENTRY record_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glCopyBufferSubData);
+        trace.value(readTarget);
+        trace.value(writeTarget);
+        trace.value(readOffset);
+        trace.value(writeOffset);
+        trace.value(size);
+        ((PFNGLCOPYBUFFERSUBDATAPROC)Table<>::loaded[ENTRY_glCopyBufferSubData])(readTarget, writeTarget, readOffset, writeOffset, size);
+    }
+    inline void APIENTRY record_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glUniformBlockBinding);
+        trace.value(program);
+        trace.value(uniformBlockIndex);
+        trace.value(uniformBlockBinding);
+        ((PFNGLUNIFORMBLOCKBINDINGPROC)Table<>::loaded[ENTRY_glUniformBlockBinding])(program, uniformBlockIndex, uniformBlockBinding);
+    }
+    inline void APIENTRY record_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDrawElementsBaseVertex);
+        trace.value(mode);
+        trace.value(count);
+        trace.value(type);
+        trace.offset(indices);
+        trace.value(basevertex);
+        ((PFNGLDRAWELEMENTSBASEVERTEXPROC)Table<>::loaded[ENTRY_glDrawElementsBaseVertex])(mode, count, type, indices, basevertex);
+    }
+    inline void APIENTRY record_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDrawRangeElementsBaseVertex);
+        trace.value(mode);
+        trace.value(start);
+        trace.value(end);
+        trace.value(count);
+        trace.value(type);
+        trace.offset(indices);
+        trace.value(basevertex);
+        ((PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)Table<>::loaded[ENTRY_glDrawRangeElementsBaseVertex])(mode, start, end, count, type, indices, basevertex);
+    }
+    inline void APIENTRY record_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDrawElementsInstancedBaseVertex);
+        trace.value(mode);
+        trace.value(count);
+        trace.value(type);
+        trace.offset(indices);
+        trace.value(instancecount);
+        trace.value(basevertex);
+        ((PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)Table<>::loaded[ENTRY_glDrawElementsInstancedBaseVertex])(mode, count, type, indices, instancecount, basevertex);
+    }
+    inline void APIENTRY record_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex)
+    {
+        recorder().unsupported(ENTRY_glMultiDrawElementsBaseVertex);
+        ((PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)Table<>::loaded[ENTRY_glMultiDrawElementsBaseVertex])(mode, count, type, indices, drawcount, basevertex);
+    }
+    inline void APIENTRY record_glProvokingVertex(GLenum mode)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glProvokingVertex);
+        trace.value(mode);
+        ((PFNGLPROVOKINGVERTEXPROC)Table<>::loaded[ENTRY_glProvokingVertex])(mode);
+    }
+    inline GLsync APIENTRY record_glFenceSync(GLenum condition, GLbitfield flags)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glFenceSync);
+        trace.value(condition);
+        trace.value(flags);
+        GLsync result = ((PFNGLFENCESYNCPROC)Table<>::loaded[ENTRY_glFenceSync])(condition, flags);
+        trace.sync(result);
+        return result;
+    }
+    inline void APIENTRY record_glDeleteSync(GLsync sync)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDeleteSync);
+        trace.sync(sync);
+        ((PFNGLDELETESYNCPROC)Table<>::loaded[ENTRY_glDeleteSync])(sync);
+    }
+    inline GLenum APIENTRY record_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glClientWaitSync);
+        trace.sync(sync);
+        trace.value(flags);
+        trace.value(timeout);
+        GLenum result = ((PFNGLCLIENTWAITSYNCPROC)Table<>::loaded[ENTRY_glClientWaitSync])(sync, flags, timeout);
+        return result;
+    }
+    inline void APIENTRY record_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glWaitSync);
+        trace.sync(sync);
+        trace.value(flags);
+        trace.value(timeout);
+        ((PFNGLWAITSYNCPROC)Table<>::loaded[ENTRY_glWaitSync])(sync, flags, timeout);
+    }
+    inline void APIENTRY record_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glFramebufferTexture);
+        trace.value(target);
+        trace.value(attachment);
+        trace.value(texture);
+        trace.value(level);
+        ((PFNGLFRAMEBUFFERTEXTUREPROC)Table<>::loaded[ENTRY_glFramebufferTexture])(target, attachment, texture, level);
+    }
+    inline void APIENTRY record_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexImage2DMultisample);
+        trace.value(target);
+        trace.value(samples);
+        trace.value(internalformat);
+        trace.value(width);
+        trace.value(height);
+        trace.value(fixedsamplelocations);
+        ((PFNGLTEXIMAGE2DMULTISAMPLEPROC)Table<>::loaded[ENTRY_glTexImage2DMultisample])(target, samples, internalformat, width, height, fixedsamplelocations);
+    }
+    inline void APIENTRY record_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexImage3DMultisample);
+        trace.value(target);
+        trace.value(samples);
+        trace.value(internalformat);
+        trace.value(width);
+        trace.value(height);
+        trace.value(depth);
+        trace.value(fixedsamplelocations);
+        ((PFNGLTEXIMAGE3DMULTISAMPLEPROC)Table<>::loaded[ENTRY_glTexImage3DMultisample])(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    }
+    inline void APIENTRY record_glSampleMaski(GLuint maskNumber, GLbitfield mask)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glSampleMaski);
+        trace.value(maskNumber);
+        trace.value(mask);
+        ((PFNGLSAMPLEMASKIPROC)Table<>::loaded[ENTRY_glSampleMaski])(maskNumber, mask);
+    }
+    inline void APIENTRY record_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBindFragDataLocationIndexed);
+        trace.value(program);
+        trace.value(colorNumber);
+        trace.value(index);
+        trace.string(name);
+        ((PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)Table<>::loaded[ENTRY_glBindFragDataLocationIndexed])(program, colorNumber, index, name);
+    }
+    inline void APIENTRY record_glGenSamplers(GLsizei count, GLuint *samplers)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glGenSamplers);
+        trace.value(count);
+        ((PFNGLGENSAMPLERSPROC)Table<>::loaded[ENTRY_glGenSamplers])(count, samplers);
+        trace.pointer(samplers, (size_t)std::max(count, 0) * sizeof(GLuint));
+    }
+    inline void APIENTRY record_glDeleteSamplers(GLsizei count, const GLuint *samplers)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glDeleteSamplers);
+        trace.value(count);
+        trace.pointer(samplers, (size_t)std::max(count, 0) * sizeof(GLuint));
+        ((PFNGLDELETESAMPLERSPROC)Table<>::loaded[ENTRY_glDeleteSamplers])(count, samplers);
+    }
+    inline void APIENTRY record_glBindSampler(GLuint unit, GLuint sampler)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glBindSampler);
+        trace.value(unit);
+        trace.value(sampler);
+        ((PFNGLBINDSAMPLERPROC)Table<>::loaded[ENTRY_glBindSampler])(unit, sampler);
+    }
+    inline void APIENTRY record_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glSamplerParameteri);
+        trace.value(sampler);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLSAMPLERPARAMETERIPROC)Table<>::loaded[ENTRY_glSamplerParameteri])(sampler, pname, param);
+    }
+    inline void APIENTRY record_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glSamplerParameteriv);
+        trace.value(sampler);
+        trace.value(pname);
+        trace.pointer(param, gltrace::parameterCount(pname) * 4);
+        ((PFNGLSAMPLERPARAMETERIVPROC)Table<>::loaded[ENTRY_glSamplerParameteriv])(sampler, pname, param);
+    }
+    inline void APIENTRY record_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glSamplerParameterf);
+        trace.value(sampler);
+        trace.value(pname);
+        trace.value(param);
+        ((PFNGLSAMPLERPARAMETERFPROC)Table<>::loaded[ENTRY_glSamplerParameterf])(sampler, pname, param);
+    }
+    inline void APIENTRY record_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glSamplerParameterfv);
+        trace.value(sampler);
+        trace.value(pname);
+        trace.pointer(param, gltrace::parameterCount(pname) * 4);
+        ((PFNGLSAMPLERPARAMETERFVPROC)Table<>::loaded[ENTRY_glSamplerParameterfv])(sampler, pname, param);
+    }
+    inline void APIENTRY record_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glSamplerParameterIiv);
+        trace.value(sampler);
+        trace.value(pname);
+        trace.pointer(param, gltrace::parameterCount(pname) * 4);
+        ((PFNGLSAMPLERPARAMETERIIVPROC)Table<>::loaded[ENTRY_glSamplerParameterIiv])(sampler, pname, param);
+    }
+    inline void APIENTRY record_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glSamplerParameterIuiv);
+        trace.value(sampler);
+        trace.value(pname);
+        trace.pointer(param, gltrace::parameterCount(pname) * 4);
+        ((PFNGLSAMPLERPARAMETERIUIVPROC)Table<>::loaded[ENTRY_glSamplerParameterIuiv])(sampler, pname, param);
+    }
+    inline void APIENTRY record_glQueryCounter(GLuint id, GLenum target)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glQueryCounter);
+        trace.value(id);
+        trace.value(target);
+        ((PFNGLQUERYCOUNTERPROC)Table<>::loaded[ENTRY_glQueryCounter])(id, target);
+    }
+    inline void APIENTRY record_glVertexAttribDivisor(GLuint index, GLuint divisor)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribDivisor);
+        trace.value(index);
+        trace.value(divisor);
+        ((PFNGLVERTEXATTRIBDIVISORPROC)Table<>::loaded[ENTRY_glVertexAttribDivisor])(index, divisor);
+    }
+    inline void APIENTRY record_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribP1ui);
+        trace.value(index);
+        trace.value(type);
+        trace.value(normalized);
+        trace.value(value);
+        ((PFNGLVERTEXATTRIBP1UIPROC)Table<>::loaded[ENTRY_glVertexAttribP1ui])(index, type, normalized, value);
+    }
+    inline void APIENTRY record_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribP1uiv);
+        trace.value(index);
+        trace.value(type);
+        trace.value(normalized);
+        trace.pointer(value, 4);
+        ((PFNGLVERTEXATTRIBP1UIVPROC)Table<>::loaded[ENTRY_glVertexAttribP1uiv])(index, type, normalized, value);
+    }
+    inline void APIENTRY record_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribP2ui);
+        trace.value(index);
+        trace.value(type);
+        trace.value(normalized);
+        trace.value(value);
+        ((PFNGLVERTEXATTRIBP2UIPROC)Table<>::loaded[ENTRY_glVertexAttribP2ui])(index, type, normalized, value);
+    }
+    inline void APIENTRY record_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribP2uiv);
+        trace.value(index);
+        trace.value(type);
+        trace.value(normalized);
+        trace.pointer(value, 4);
+        ((PFNGLVERTEXATTRIBP2UIVPROC)Table<>::loaded[ENTRY_glVertexAttribP2uiv])(index, type, normalized, value);
+    }
+    inline void APIENTRY record_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribP3ui);
+        trace.value(index);
+        trace.value(type);
+        trace.value(normalized);
+        trace.value(value);
+        ((PFNGLVERTEXATTRIBP3UIPROC)Table<>::loaded[ENTRY_glVertexAttribP3ui])(index, type, normalized, value);
+    }
+    inline void APIENTRY record_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribP3uiv);
+        trace.value(index);
+        trace.value(type);
+        trace.value(normalized);
+        trace.pointer(value, 4);
+        ((PFNGLVERTEXATTRIBP3UIVPROC)Table<>::loaded[ENTRY_glVertexAttribP3uiv])(index, type, normalized, value);
+    }
+    inline void APIENTRY record_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribP4ui);
+        trace.value(index);
+        trace.value(type);
+        trace.value(normalized);
+        trace.value(value);
+        ((PFNGLVERTEXATTRIBP4UIPROC)Table<>::loaded[ENTRY_glVertexAttribP4ui])(index, type, normalized, value);
+    }
+    inline void APIENTRY record_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexAttribP4uiv);
+        trace.value(index);
+        trace.value(type);
+        trace.value(normalized);
+        trace.pointer(value, 4);
+        ((PFNGLVERTEXATTRIBP4UIVPROC)Table<>::loaded[ENTRY_glVertexAttribP4uiv])(index, type, normalized, value);
+    }
+    inline void APIENTRY record_glVertexP2ui(GLenum type, GLuint value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexP2ui);
+        trace.value(type);
+        trace.value(value);
+        ((PFNGLVERTEXP2UIPROC)Table<>::loaded[ENTRY_glVertexP2ui])(type, value);
+    }
+    inline void APIENTRY record_glVertexP2uiv(GLenum type, const GLuint *value)
+    {
+        recorder().unsupported(ENTRY_glVertexP2uiv);
+        ((PFNGLVERTEXP2UIVPROC)Table<>::loaded[ENTRY_glVertexP2uiv])(type, value);
+    }
+    inline void APIENTRY record_glVertexP3ui(GLenum type, GLuint value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexP3ui);
+        trace.value(type);
+        trace.value(value);
+        ((PFNGLVERTEXP3UIPROC)Table<>::loaded[ENTRY_glVertexP3ui])(type, value);
+    }
+    inline void APIENTRY record_glVertexP3uiv(GLenum type, const GLuint *value)
+    {
+        recorder().unsupported(ENTRY_glVertexP3uiv);
+        ((PFNGLVERTEXP3UIVPROC)Table<>::loaded[ENTRY_glVertexP3uiv])(type, value);
+    }
+    inline void APIENTRY record_glVertexP4ui(GLenum type, GLuint value)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glVertexP4ui);
+        trace.value(type);
+        trace.value(value);
+        ((PFNGLVERTEXP4UIPROC)Table<>::loaded[ENTRY_glVertexP4ui])(type, value);
+    }
+    inline void APIENTRY record_glVertexP4uiv(GLenum type, const GLuint *value)
+    {
+        recorder().unsupported(ENTRY_glVertexP4uiv);
+        ((PFNGLVERTEXP4UIVPROC)Table<>::loaded[ENTRY_glVertexP4uiv])(type, value);
+    }
+    inline void APIENTRY record_glTexCoordP1ui(GLenum type, GLuint coords)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoordP1ui);
+        trace.value(type);
+        trace.value(coords);
+        ((PFNGLTEXCOORDP1UIPROC)Table<>::loaded[ENTRY_glTexCoordP1ui])(type, coords);
+    }
+    inline void APIENTRY record_glTexCoordP1uiv(GLenum type, const GLuint *coords)
+    {
+        recorder().unsupported(ENTRY_glTexCoordP1uiv);
+        ((PFNGLTEXCOORDP1UIVPROC)Table<>::loaded[ENTRY_glTexCoordP1uiv])(type, coords);
+    }
+    inline void APIENTRY record_glTexCoordP2ui(GLenum type, GLuint coords)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoordP2ui);
+        trace.value(type);
+        trace.value(coords);
+        ((PFNGLTEXCOORDP2UIPROC)Table<>::loaded[ENTRY_glTexCoordP2ui])(type, coords);
+    }
+    inline void APIENTRY record_glTexCoordP2uiv(GLenum type, const GLuint *coords)
+    {
+        recorder().unsupported(ENTRY_glTexCoordP2uiv);
+        ((PFNGLTEXCOORDP2UIVPROC)Table<>::loaded[ENTRY_glTexCoordP2uiv])(type, coords);
+    }
+    inline void APIENTRY record_glTexCoordP3ui(GLenum type, GLuint coords)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoordP3ui);
+        trace.value(type);
+        trace.value(coords);
+        ((PFNGLTEXCOORDP3UIPROC)Table<>::loaded[ENTRY_glTexCoordP3ui])(type, coords);
+    }
+    inline void APIENTRY record_glTexCoordP3uiv(GLenum type, const GLuint *coords)
+    {
+        recorder().unsupported(ENTRY_glTexCoordP3uiv);
+        ((PFNGLTEXCOORDP3UIVPROC)Table<>::loaded[ENTRY_glTexCoordP3uiv])(type, coords);
+    }
+    inline void APIENTRY record_glTexCoordP4ui(GLenum type, GLuint coords)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glTexCoordP4ui);
+        trace.value(type);
+        trace.value(coords);
+        ((PFNGLTEXCOORDP4UIPROC)Table<>::loaded[ENTRY_glTexCoordP4ui])(type, coords);
+    }
+    inline void APIENTRY record_glTexCoordP4uiv(GLenum type, const GLuint *coords)
+    {
+        recorder().unsupported(ENTRY_glTexCoordP4uiv);
+        ((PFNGLTEXCOORDP4UIVPROC)Table<>::loaded[ENTRY_glTexCoordP4uiv])(type, coords);
+    }
+    inline void APIENTRY record_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoordP1ui);
+        trace.value(texture);
+        trace.value(type);
+        trace.value(coords);
+        ((PFNGLMULTITEXCOORDP1UIPROC)Table<>::loaded[ENTRY_glMultiTexCoordP1ui])(texture, type, coords);
+    }
+    inline void APIENTRY record_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoordP1uiv);
+        ((PFNGLMULTITEXCOORDP1UIVPROC)Table<>::loaded[ENTRY_glMultiTexCoordP1uiv])(texture, type, coords);
+    }
+    inline void APIENTRY record_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoordP2ui);
+        trace.value(texture);
+        trace.value(type);
+        trace.value(coords);
+        ((PFNGLMULTITEXCOORDP2UIPROC)Table<>::loaded[ENTRY_glMultiTexCoordP2ui])(texture, type, coords);
+    }
+    inline void APIENTRY record_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoordP2uiv);
+        ((PFNGLMULTITEXCOORDP2UIVPROC)Table<>::loaded[ENTRY_glMultiTexCoordP2uiv])(texture, type, coords);
+    }
+    inline void APIENTRY record_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoordP3ui);
+        trace.value(texture);
+        trace.value(type);
+        trace.value(coords);
+        ((PFNGLMULTITEXCOORDP3UIPROC)Table<>::loaded[ENTRY_glMultiTexCoordP3ui])(texture, type, coords);
+    }
+    inline void APIENTRY record_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoordP3uiv);
+        ((PFNGLMULTITEXCOORDP3UIVPROC)Table<>::loaded[ENTRY_glMultiTexCoordP3uiv])(texture, type, coords);
+    }
+    inline void APIENTRY record_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glMultiTexCoordP4ui);
+        trace.value(texture);
+        trace.value(type);
+        trace.value(coords);
+        ((PFNGLMULTITEXCOORDP4UIPROC)Table<>::loaded[ENTRY_glMultiTexCoordP4ui])(texture, type, coords);
+    }
+    inline void APIENTRY record_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords)
+    {
+        recorder().unsupported(ENTRY_glMultiTexCoordP4uiv);
+        ((PFNGLMULTITEXCOORDP4UIVPROC)Table<>::loaded[ENTRY_glMultiTexCoordP4uiv])(texture, type, coords);
+    }
+    inline void APIENTRY record_glNormalP3ui(GLenum type, GLuint coords)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glNormalP3ui);
+        trace.value(type);
+        trace.value(coords);
+        ((PFNGLNORMALP3UIPROC)Table<>::loaded[ENTRY_glNormalP3ui])(type, coords);
+    }
+    inline void APIENTRY record_glNormalP3uiv(GLenum type, const GLuint *coords)
+    {
+        recorder().unsupported(ENTRY_glNormalP3uiv);
+        ((PFNGLNORMALP3UIVPROC)Table<>::loaded[ENTRY_glNormalP3uiv])(type, coords);
+    }
+    inline void APIENTRY record_glColorP3ui(GLenum type, GLuint color)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColorP3ui);
+        trace.value(type);
+        trace.value(color);
+        ((PFNGLCOLORP3UIPROC)Table<>::loaded[ENTRY_glColorP3ui])(type, color);
+    }
+    inline void APIENTRY record_glColorP3uiv(GLenum type, const GLuint *color)
+    {
+        recorder().unsupported(ENTRY_glColorP3uiv);
+        ((PFNGLCOLORP3UIVPROC)Table<>::loaded[ENTRY_glColorP3uiv])(type, color);
+    }
+    inline void APIENTRY record_glColorP4ui(GLenum type, GLuint color)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glColorP4ui);
+        trace.value(type);
+        trace.value(color);
+        ((PFNGLCOLORP4UIPROC)Table<>::loaded[ENTRY_glColorP4ui])(type, color);
+    }
+    inline void APIENTRY record_glColorP4uiv(GLenum type, const GLuint *color)
+    {
+        recorder().unsupported(ENTRY_glColorP4uiv);
+        ((PFNGLCOLORP4UIVPROC)Table<>::loaded[ENTRY_glColorP4uiv])(type, color);
+    }
+    inline void APIENTRY record_glSecondaryColorP3ui(GLenum type, GLuint color)
+    {
+        Recorder& trace = recorder();
+        trace.begin(ENTRY_glSecondaryColorP3ui);
+        trace.value(type);
+        trace.value(color);
+        ((PFNGLSECONDARYCOLORP3UIPROC)Table<>::loaded[ENTRY_glSecondaryColorP3ui])(type, color);
+    }
+    inline void APIENTRY record_glSecondaryColorP3uiv(GLenum type, const GLuint *color)
+    {
+        recorder().unsupported(ENTRY_glSecondaryColorP3uiv);
+        ((PFNGLSECONDARYCOLORP3UIVPROC)Table<>::loaded[ENTRY_glSecondaryColorP3uiv])(type, color);
+    }
+
+    // points every loaded glad_gl* that changes state at its recording
+    // wrapper, or back
+    // ------------------------------------------------------------------------
+    inline void install()
+    {
+        if (glad_glCullFace && glad_glCullFace != record_glCullFace)
+        {
+            Table<>::loaded[ENTRY_glCullFace] = (void*)glad_glCullFace;
+            glad_glCullFace = record_glCullFace;
+        }
+        if (glad_glFrontFace && glad_glFrontFace != record_glFrontFace)
+        {
+            Table<>::loaded[ENTRY_glFrontFace] = (void*)glad_glFrontFace;
+            glad_glFrontFace = record_glFrontFace;
+        }
+        if (glad_glHint && glad_glHint != record_glHint)
+        {
+            Table<>::loaded[ENTRY_glHint] = (void*)glad_glHint;
+            glad_glHint = record_glHint;
+        }
+        if (glad_glLineWidth && glad_glLineWidth != record_glLineWidth)
+        {
+            Table<>::loaded[ENTRY_glLineWidth] = (void*)glad_glLineWidth;
+            glad_glLineWidth = record_glLineWidth;
+        }
+        if (glad_glPointSize && glad_glPointSize != record_glPointSize)
+        {
+            Table<>::loaded[ENTRY_glPointSize] = (void*)glad_glPointSize;
+            glad_glPointSize = record_glPointSize;
+        }
+        if (glad_glPolygonMode && glad_glPolygonMode != record_glPolygonMode)
+        {
+            Table<>::loaded[ENTRY_glPolygonMode] = (void*)glad_glPolygonMode;
+            glad_glPolygonMode = record_glPolygonMode;
+        }
+        if (glad_glScissor && glad_glScissor != record_glScissor)
+        {
+            Table<>::loaded[ENTRY_glScissor] = (void*)glad_glScissor;
+            glad_glScissor = record_glScissor;
+        }
+        if (glad_glTexParameterf && glad_glTexParameterf != record_glTexParameterf)
+        {
+            Table<>::loaded[ENTRY_glTexParameterf] = (void*)glad_glTexParameterf;
+            glad_glTexParameterf = record_glTexParameterf;
+        }
+        if (glad_glTexParameterfv && glad_glTexParameterfv != record_glTexParameterfv)
+        {
+            Table<>::loaded[ENTRY_glTexParameterfv] = (void*)glad_glTexParameterfv;
+            glad_glTexParameterfv = record_glTexParameterfv;
+        }
+        if (glad_glTexParameteri && glad_glTexParameteri != record_glTexParameteri)
+        {
+            Table<>::loaded[ENTRY_glTexParameteri] = (void*)glad_glTexParameteri;
+            glad_glTexParameteri = record_glTexParameteri;
+        }
+        if (glad_glTexParameteriv && glad_glTexParameteriv != record_glTexParameteriv)
+        {
+            Table<>::loaded[ENTRY_glTexParameteriv] = (void*)glad_glTexParameteriv;
+            glad_glTexParameteriv = record_glTexParameteriv;
+        }
+        if (glad_glTexImage1D && glad_glTexImage1D != record_glTexImage1D)
+        {
+            Table<>::loaded[ENTRY_glTexImage1D] = (void*)glad_glTexImage1D;
+            glad_glTexImage1D = record_glTexImage1D;
+        }
+        if (glad_glTexImage2D && glad_glTexImage2D != record_glTexImage2D)
+        {
+            Table<>::loaded[ENTRY_glTexImage2D] = (void*)glad_glTexImage2D;
+            glad_glTexImage2D = record_glTexImage2D;
+        }
+        if (glad_glDrawBuffer && glad_glDrawBuffer != record_glDrawBuffer)
+        {
+            Table<>::loaded[ENTRY_glDrawBuffer] = (void*)glad_glDrawBuffer;
+            glad_glDrawBuffer = record_glDrawBuffer;
+        }
+        if (glad_glClear && glad_glClear != record_glClear)
+        {
+            Table<>::loaded[ENTRY_glClear] = (void*)glad_glClear;
+            glad_glClear = record_glClear;
+        }
+        if (glad_glClearColor && glad_glClearColor != record_glClearColor)
+        {
+            Table<>::loaded[ENTRY_glClearColor] = (void*)glad_glClearColor;
+            glad_glClearColor = record_glClearColor;
+        }
+        if (glad_glClearStencil && glad_glClearStencil != record_glClearStencil)
+        {
+            Table<>::loaded[ENTRY_glClearStencil] = (void*)glad_glClearStencil;
+            glad_glClearStencil = record_glClearStencil;
+        }
+        if (glad_glClearDepth && glad_glClearDepth != record_glClearDepth)
+        {
+            Table<>::loaded[ENTRY_glClearDepth] = (void*)glad_glClearDepth;
+            glad_glClearDepth = record_glClearDepth;
+        }
+        if (glad_glStencilMask && glad_glStencilMask != record_glStencilMask)
+        {
+            Table<>::loaded[ENTRY_glStencilMask] = (void*)glad_glStencilMask;
+            glad_glStencilMask = record_glStencilMask;
+        }
+        if (glad_glColorMask && glad_glColorMask != record_glColorMask)
+        {
+            Table<>::loaded[ENTRY_glColorMask] = (void*)glad_glColorMask;
+            glad_glColorMask = record_glColorMask;
+        }
+        if (glad_glDepthMask && glad_glDepthMask != record_glDepthMask)
+        {
+            Table<>::loaded[ENTRY_glDepthMask] = (void*)glad_glDepthMask;
+            glad_glDepthMask = record_glDepthMask;
+        }
+        if (glad_glDisable && glad_glDisable != record_glDisable)
+        {
+            Table<>::loaded[ENTRY_glDisable] = (void*)glad_glDisable;
+            glad_glDisable = record_glDisable;
+        }
+        if (glad_glEnable && glad_glEnable != record_glEnable)
+        {
+            Table<>::loaded[ENTRY_glEnable] = (void*)glad_glEnable;
+            glad_glEnable = record_glEnable;
+        }
+        if (glad_glFinish && glad_glFinish != record_glFinish)
+        {
+            Table<>::loaded[ENTRY_glFinish] = (void*)glad_glFinish;
+            glad_glFinish = record_glFinish;
+        }
+        if (glad_glFlush && glad_glFlush != record_glFlush)
+        {
+            Table<>::loaded[ENTRY_glFlush] = (void*)glad_glFlush;
+            glad_glFlush = record_glFlush;
+        }
+        if (glad_glBlendFunc && glad_glBlendFunc != record_glBlendFunc)
+        {
+            Table<>::loaded[ENTRY_glBlendFunc] = (void*)glad_glBlendFunc;
+            glad_glBlendFunc = record_glBlendFunc;
+        }
+        if (glad_glLogicOp && glad_glLogicOp != record_glLogicOp)
+        {
+            Table<>::loaded[ENTRY_glLogicOp] = (void*)glad_glLogicOp;
+            glad_glLogicOp = record_glLogicOp;
+        }
+        if (glad_glStencilFunc && glad_glStencilFunc != record_glStencilFunc)
+        {
+            Table<>::loaded[ENTRY_glStencilFunc] = (void*)glad_glStencilFunc;
+            glad_glStencilFunc = record_glStencilFunc;
+        }
+        if (glad_glStencilOp && glad_glStencilOp != record_glStencilOp)
+        {
+            Table<>::loaded[ENTRY_glStencilOp] = (void*)glad_glStencilOp;
+            glad_glStencilOp = record_glStencilOp;
+        }
+        if (glad_glDepthFunc && glad_glDepthFunc != record_glDepthFunc)
+        {
+            Table<>::loaded[ENTRY_glDepthFunc] = (void*)glad_glDepthFunc;
+            glad_glDepthFunc = record_glDepthFunc;
+        }
+        if (glad_glPixelStoref && glad_glPixelStoref != record_glPixelStoref)
+        {
+            Table<>::loaded[ENTRY_glPixelStoref] = (void*)glad_glPixelStoref;
+            glad_glPixelStoref = record_glPixelStoref;
+        }
+        if (glad_glPixelStorei && glad_glPixelStorei != record_glPixelStorei)
+        {
+            Table<>::loaded[ENTRY_glPixelStorei] = (void*)glad_glPixelStorei;
+            glad_glPixelStorei = record_glPixelStorei;
+        }
+        if (glad_glReadBuffer && glad_glReadBuffer != record_glReadBuffer)
+        {
+            Table<>::loaded[ENTRY_glReadBuffer] = (void*)glad_glReadBuffer;
+            glad_glReadBuffer = record_glReadBuffer;
+        }
+        if (glad_glReadPixels && glad_glReadPixels != record_glReadPixels)
+        {
+            Table<>::loaded[ENTRY_glReadPixels] = (void*)glad_glReadPixels;
+            glad_glReadPixels = record_glReadPixels;
+        }
+        if (glad_glDepthRange && glad_glDepthRange != record_glDepthRange)
+        {
+            Table<>::loaded[ENTRY_glDepthRange] = (void*)glad_glDepthRange;
+            glad_glDepthRange = record_glDepthRange;
+        }
+        if (glad_glViewport && glad_glViewport != record_glViewport)
+        {
+            Table<>::loaded[ENTRY_glViewport] = (void*)glad_glViewport;
+            glad_glViewport = record_glViewport;
+        }
+        if (glad_glNewList && glad_glNewList != record_glNewList)
+        {
+            Table<>::loaded[ENTRY_glNewList] = (void*)glad_glNewList;
+            glad_glNewList = record_glNewList;
+        }
+        if (glad_glEndList && glad_glEndList != record_glEndList)
+        {
+            Table<>::loaded[ENTRY_glEndList] = (void*)glad_glEndList;
+            glad_glEndList = record_glEndList;
+        }
+        if (glad_glCallList && glad_glCallList != record_glCallList)
+        {
+            Table<>::loaded[ENTRY_glCallList] = (void*)glad_glCallList;
+            glad_glCallList = record_glCallList;
+        }
+        if (glad_glCallLists && glad_glCallLists != record_glCallLists)
+        {
+            Table<>::loaded[ENTRY_glCallLists] = (void*)glad_glCallLists;
+            glad_glCallLists = record_glCallLists;
+        }
+        if (glad_glDeleteLists && glad_glDeleteLists != record_glDeleteLists)
+        {
+            Table<>::loaded[ENTRY_glDeleteLists] = (void*)glad_glDeleteLists;
+            glad_glDeleteLists = record_glDeleteLists;
+        }
+        if (glad_glGenLists && glad_glGenLists != record_glGenLists)
+        {
+            Table<>::loaded[ENTRY_glGenLists] = (void*)glad_glGenLists;
+            glad_glGenLists = record_glGenLists;
+        }
+        if (glad_glListBase && glad_glListBase != record_glListBase)
+        {
+            Table<>::loaded[ENTRY_glListBase] = (void*)glad_glListBase;
+            glad_glListBase = record_glListBase;
+        }
+        if (glad_glBegin && glad_glBegin != record_glBegin)
+        {
+            Table<>::loaded[ENTRY_glBegin] = (void*)glad_glBegin;
+            glad_glBegin = record_glBegin;
+        }
+        if (glad_glBitmap && glad_glBitmap != record_glBitmap)
+        {
+            Table<>::loaded[ENTRY_glBitmap] = (void*)glad_glBitmap;
+            glad_glBitmap = record_glBitmap;
+        }
+        if (glad_glColor3b && glad_glColor3b != record_glColor3b)
+        {
+            Table<>::loaded[ENTRY_glColor3b] = (void*)glad_glColor3b;
+            glad_glColor3b = record_glColor3b;
+        }
+        if (glad_glColor3bv && glad_glColor3bv != record_glColor3bv)
+        {
+            Table<>::loaded[ENTRY_glColor3bv] = (void*)glad_glColor3bv;
+            glad_glColor3bv = record_glColor3bv;
+        }
+        if (glad_glColor3d && glad_glColor3d != record_glColor3d)
+        {
+            Table<>::loaded[ENTRY_glColor3d] = (void*)glad_glColor3d;
+            glad_glColor3d = record_glColor3d;
+        }
+        if (glad_glColor3dv && glad_glColor3dv != record_glColor3dv)
+        {
+            Table<>::loaded[ENTRY_glColor3dv] = (void*)glad_glColor3dv;
+            glad_glColor3dv = record_glColor3dv;
+        }
+        if (glad_glColor3f && glad_glColor3f != record_glColor3f)
+        {
+            Table<>::loaded[ENTRY_glColor3f] = (void*)glad_glColor3f;
+            glad_glColor3f = record_glColor3f;
+        }
+        if (glad_glColor3fv && glad_glColor3fv != record_glColor3fv)
+        {
+            Table<>::loaded[ENTRY_glColor3fv] = (void*)glad_glColor3fv;
+            glad_glColor3fv = record_glColor3fv;
+        }
+        if (glad_glColor3i && glad_glColor3i != record_glColor3i)
+        {
+            Table<>::loaded[ENTRY_glColor3i] = (void*)glad_glColor3i;
+            glad_glColor3i = record_glColor3i;
+        }
+        if (glad_glColor3iv && glad_glColor3iv != record_glColor3iv)
+        {
+            Table<>::loaded[ENTRY_glColor3iv] = (void*)glad_glColor3iv;
+            glad_glColor3iv = record_glColor3iv;
+        }
+        if (glad_glColor3s && glad_glColor3s != record_glColor3s)
+        {
+            Table<>::loaded[ENTRY_glColor3s] = (void*)glad_glColor3s;
+            glad_glColor3s = record_glColor3s;
+        }
+        if (glad_glColor3sv && glad_glColor3sv != record_glColor3sv)
+        {
+            Table<>::loaded[ENTRY_glColor3sv] = (void*)glad_glColor3sv;
+            glad_glColor3sv = record_glColor3sv;
+        }
+        if (glad_glColor3ub && glad_glColor3ub != record_glColor3ub)
+        {
+            Table<>::loaded[ENTRY_glColor3ub] = (void*)glad_glColor3ub;
+            glad_glColor3ub = record_glColor3ub;
+        }
+        if (glad_glColor3ubv && glad_glColor3ubv != record_glColor3ubv)
+        {
+            Table<>::loaded[ENTRY_glColor3ubv] = (void*)glad_glColor3ubv;
+            glad_glColor3ubv = record_glColor3ubv;
+        }
+        if (glad_glColor3ui && glad_glColor3ui != record_glColor3ui)
+        {
+            Table<>::loaded[ENTRY_glColor3ui] = (void*)glad_glColor3ui;
+            glad_glColor3ui = record_glColor3ui;
+        }
+        if (glad_glColor3uiv && glad_glColor3uiv != record_glColor3uiv)
+        {
+            Table<>::loaded[ENTRY_glColor3uiv] = (void*)glad_glColor3uiv;
+            glad_glColor3uiv = record_glColor3uiv;
+        }
+        if (glad_glColor3us && glad_glColor3us != record_glColor3us)
+        {
+            Table<>::loaded[ENTRY_glColor3us] = (void*)glad_glColor3us;
+            glad_glColor3us = record_glColor3us;
+        }
+        if (glad_glColor3usv && glad_glColor3usv != record_glColor3usv)
+        {
+            Table<>::loaded[ENTRY_glColor3usv] = (void*)glad_glColor3usv;
+            glad_glColor3usv = record_glColor3usv;
+        }
+        if (glad_glColor4b && glad_glColor4b != record_glColor4b)
+        {
+            Table<>::loaded[ENTRY_glColor4b] = (void*)glad_glColor4b;
+            glad_glColor4b = record_glColor4b;
+        }
+        if (glad_glColor4bv && glad_glColor4bv != record_glColor4bv)
+        {
+            Table<>::loaded[ENTRY_glColor4bv] = (void*)glad_glColor4bv;
+            glad_glColor4bv = record_glColor4bv;
+        }
+        if (glad_glColor4d && glad_glColor4d != record_glColor4d)
+        {
+            Table<>::loaded[ENTRY_glColor4d] = (void*)glad_glColor4d;
+            glad_glColor4d = record_glColor4d;
+        }
+        if (glad_glColor4dv && glad_glColor4dv != record_glColor4dv)
+        {
+            Table<>::loaded[ENTRY_glColor4dv] = (void*)glad_glColor4dv;
+            glad_glColor4dv = record_glColor4dv;
+        }
+        if (glad_glColor4f && glad_glColor4f != record_glColor4f)
+        {
+            Table<>::loaded[ENTRY_glColor4f] = (void*)glad_glColor4f;
+            glad_glColor4f = record_glColor4f;
+        }
+        if (glad_glColor4fv && glad_glColor4fv != record_glColor4fv)
+        {
+            Table<>::loaded[ENTRY_glColor4fv] = (void*)glad_glColor4fv;
+            glad_glColor4fv = record_glColor4fv;
+        }
+        if (glad_glColor4i && glad_glColor4i != record_glColor4i)
+        {
+            Table<>::loaded[ENTRY_glColor4i] = (void*)glad_glColor4i;
+            glad_glColor4i = record_glColor4i;
+        }
+        if (glad_glColor4iv && glad_glColor4iv != record_glColor4iv)
+        {
+            Table<>::loaded[ENTRY_glColor4iv] = (void*)glad_glColor4iv;
+            glad_glColor4iv = record_glColor4iv;
+        }
+        if (glad_glColor4s && glad_glColor4s != record_glColor4s)
+        {
+            Table<>::loaded[ENTRY_glColor4s] = (void*)glad_glColor4s;
+            glad_glColor4s = record_glColor4s;
+        }
+        if (glad_glColor4sv && glad_glColor4sv != record_glColor4sv)
+        {
+            Table<>::loaded[ENTRY_glColor4sv] = (void*)glad_glColor4sv;
+            glad_glColor4sv = record_glColor4sv;
+        }
+        if (glad_glColor4ub && glad_glColor4ub != record_glColor4ub)
+        {
+            Table<>::loaded[ENTRY_glColor4ub] = (void*)glad_glColor4ub;
+            glad_glColor4ub = record_glColor4ub;
+        }
+        if (glad_glColor4ubv && glad_glColor4ubv != record_glColor4ubv)
+        {
+            Table<>::loaded[ENTRY_glColor4ubv] = (void*)glad_glColor4ubv;
+            glad_glColor4ubv = record_glColor4ubv;
+        }
+        if (glad_glColor4ui && glad_glColor4ui != record_glColor4ui)
+        {
+            Table<>::loaded[ENTRY_glColor4ui] = (void*)glad_glColor4ui;
+            glad_glColor4ui = record_glColor4ui;
+        }
+        if (glad_glColor4uiv && glad_glColor4uiv != record_glColor4uiv)
+        {
+            Table<>::loaded[ENTRY_glColor4uiv] = (void*)glad_glColor4uiv;
+            glad_glColor4uiv = record_glColor4uiv;
+        }
+        if (glad_glColor4us && glad_glColor4us != record_glColor4us)
+        {
+            Table<>::loaded[ENTRY_glColor4us] = (void*)glad_glColor4us;
+            glad_glColor4us = record_glColor4us;
+        }
+        if (glad_glColor4usv && glad_glColor4usv != record_glColor4usv)
+        {
+            Table<>::loaded[ENTRY_glColor4usv] = (void*)glad_glColor4usv;
+            glad_glColor4usv = record_glColor4usv;
+        }
+        if (glad_glEdgeFlag && glad_glEdgeFlag != record_glEdgeFlag)
+        {
+            Table<>::loaded[ENTRY_glEdgeFlag] = (void*)glad_glEdgeFlag;
+            glad_glEdgeFlag = record_glEdgeFlag;
+        }
+        if (glad_glEdgeFlagv && glad_glEdgeFlagv != record_glEdgeFlagv)
+        {
+            Table<>::loaded[ENTRY_glEdgeFlagv] = (void*)glad_glEdgeFlagv;
+            glad_glEdgeFlagv = record_glEdgeFlagv;
+        }
+        if (glad_glEnd && glad_glEnd != record_glEnd)
+        {
+            Table<>::loaded[ENTRY_glEnd] = (void*)glad_glEnd;
+            glad_glEnd = record_glEnd;
+        }
+        if (glad_glIndexd && glad_glIndexd != record_glIndexd)
+        {
+            Table<>::loaded[ENTRY_glIndexd] = (void*)glad_glIndexd;
+            glad_glIndexd = record_glIndexd;
+        }
+        if (glad_glIndexdv && glad_glIndexdv != record_glIndexdv)
+        {
+            Table<>::loaded[ENTRY_glIndexdv] = (void*)glad_glIndexdv;
+            glad_glIndexdv = record_glIndexdv;
+        }
+        if (glad_glIndexf && glad_glIndexf != record_glIndexf)
+        {
+            Table<>::loaded[ENTRY_glIndexf] = (void*)glad_glIndexf;
+            glad_glIndexf = record_glIndexf;
+        }
+        if (glad_glIndexfv && glad_glIndexfv != record_glIndexfv)
+        {
+            Table<>::loaded[ENTRY_glIndexfv] = (void*)glad_glIndexfv;
+            glad_glIndexfv = record_glIndexfv;
+        }
+        if (glad_glIndexi && glad_glIndexi != record_glIndexi)
+        {
+            Table<>::loaded[ENTRY_glIndexi] = (void*)glad_glIndexi;
+            glad_glIndexi = record_glIndexi;
+        }
+        if (glad_glIndexiv && glad_glIndexiv != record_glIndexiv)
+        {
+            Table<>::loaded[ENTRY_glIndexiv] = (void*)glad_glIndexiv;
+            glad_glIndexiv = record_glIndexiv;
+        }
+        if (glad_glIndexs && glad_glIndexs != record_glIndexs)
+        {
+            Table<>::loaded[ENTRY_glIndexs] = (void*)glad_glIndexs;
+            glad_glIndexs = record_glIndexs;
+        }
+        if (glad_glIndexsv && glad_glIndexsv != record_glIndexsv)
+        {
+            Table<>::loaded[ENTRY_glIndexsv] = (void*)glad_glIndexsv;
+            glad_glIndexsv = record_glIndexsv;
+        }
+        if (glad_glNormal3b && glad_glNormal3b != record_glNormal3b)
+        {
+            Table<>::loaded[ENTRY_glNormal3b] = (void*)glad_glNormal3b;
+            glad_glNormal3b = record_glNormal3b;
+        }
+        if (glad_glNormal3bv && glad_glNormal3bv != record_glNormal3bv)
+        {
+            Table<>::loaded[ENTRY_glNormal3bv] = (void*)glad_glNormal3bv;
+            glad_glNormal3bv = record_glNormal3bv;
+        }
+        if (glad_glNormal3d && glad_glNormal3d != record_glNormal3d)
+        {
+            Table<>::loaded[ENTRY_glNormal3d] = (void*)glad_glNormal3d;
+            glad_glNormal3d = record_glNormal3d;
+        }
+        if (glad_glNormal3dv && glad_glNormal3dv != record_glNormal3dv)
+        {
+            Table<>::loaded[ENTRY_glNormal3dv] = (void*)glad_glNormal3dv;
+            glad_glNormal3dv = record_glNormal3dv;
+        }
+        if (glad_glNormal3f && glad_glNormal3f != record_glNormal3f)
+        {
+            Table<>::loaded[ENTRY_glNormal3f] = (void*)glad_glNormal3f;
+            glad_glNormal3f = record_glNormal3f;
+        }
+        if (glad_glNormal3fv && glad_glNormal3fv != record_glNormal3fv)
+        {
+            Table<>::loaded[ENTRY_glNormal3fv] = (void*)glad_glNormal3fv;
+            glad_glNormal3fv = record_glNormal3fv;
+        }
+        if (glad_glNormal3i && glad_glNormal3i != record_glNormal3i)
+        {
+            Table<>::loaded[ENTRY_glNormal3i] = (void*)glad_glNormal3i;
+            glad_glNormal3i = record_glNormal3i;
+        }
+        if (glad_glNormal3iv && glad_glNormal3iv != record_glNormal3iv)
+        {
+            Table<>::loaded[ENTRY_glNormal3iv] = (void*)glad_glNormal3iv;
+            glad_glNormal3iv = record_glNormal3iv;
+        }
+        if (glad_glNormal3s && glad_glNormal3s != record_glNormal3s)
+        {
+            Table<>::loaded[ENTRY_glNormal3s] = (void*)glad_glNormal3s;
+            glad_glNormal3s = record_glNormal3s;
+        }
+        if (glad_glNormal3sv && glad_glNormal3sv != record_glNormal3sv)
+        {
+            Table<>::loaded[ENTRY_glNormal3sv] = (void*)glad_glNormal3sv;
+            glad_glNormal3sv = record_glNormal3sv;
+        }
+        if (glad_glRasterPos2d && glad_glRasterPos2d != record_glRasterPos2d)
+        {
+            Table<>::loaded[ENTRY_glRasterPos2d] = (void*)glad_glRasterPos2d;
+            glad_glRasterPos2d = record_glRasterPos2d;
+        }
+        if (glad_glRasterPos2dv && glad_glRasterPos2dv != record_glRasterPos2dv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos2dv] = (void*)glad_glRasterPos2dv;
+            glad_glRasterPos2dv = record_glRasterPos2dv;
+        }
+        if (glad_glRasterPos2f && glad_glRasterPos2f != record_glRasterPos2f)
+        {
+            Table<>::loaded[ENTRY_glRasterPos2f] = (void*)glad_glRasterPos2f;
+            glad_glRasterPos2f = record_glRasterPos2f;
+        }
+        if (glad_glRasterPos2fv && glad_glRasterPos2fv != record_glRasterPos2fv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos2fv] = (void*)glad_glRasterPos2fv;
+            glad_glRasterPos2fv = record_glRasterPos2fv;
+        }
+        if (glad_glRasterPos2i && glad_glRasterPos2i != record_glRasterPos2i)
+        {
+            Table<>::loaded[ENTRY_glRasterPos2i] = (void*)glad_glRasterPos2i;
+            glad_glRasterPos2i = record_glRasterPos2i;
+        }
+        if (glad_glRasterPos2iv && glad_glRasterPos2iv != record_glRasterPos2iv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos2iv] = (void*)glad_glRasterPos2iv;
+            glad_glRasterPos2iv = record_glRasterPos2iv;
+        }
+        if (glad_glRasterPos2s && glad_glRasterPos2s != record_glRasterPos2s)
+        {
+            Table<>::loaded[ENTRY_glRasterPos2s] = (void*)glad_glRasterPos2s;
+            glad_glRasterPos2s = record_glRasterPos2s;
+        }
+        if (glad_glRasterPos2sv && glad_glRasterPos2sv != record_glRasterPos2sv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos2sv] = (void*)glad_glRasterPos2sv;
+            glad_glRasterPos2sv = record_glRasterPos2sv;
+        }
+        if (glad_glRasterPos3d && glad_glRasterPos3d != record_glRasterPos3d)
+        {
+            Table<>::loaded[ENTRY_glRasterPos3d] = (void*)glad_glRasterPos3d;
+            glad_glRasterPos3d = record_glRasterPos3d;
+        }
+        if (glad_glRasterPos3dv && glad_glRasterPos3dv != record_glRasterPos3dv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos3dv] = (void*)glad_glRasterPos3dv;
+            glad_glRasterPos3dv = record_glRasterPos3dv;
+        }
+        if (glad_glRasterPos3f && glad_glRasterPos3f != record_glRasterPos3f)
+        {
+            Table<>::loaded[ENTRY_glRasterPos3f] = (void*)glad_glRasterPos3f;
+            glad_glRasterPos3f = record_glRasterPos3f;
+        }
+        if (glad_glRasterPos3fv && glad_glRasterPos3fv != record_glRasterPos3fv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos3fv] = (void*)glad_glRasterPos3fv;
+            glad_glRasterPos3fv = record_glRasterPos3fv;
+        }
+        if (glad_glRasterPos3i && glad_glRasterPos3i != record_glRasterPos3i)
+        {
+            Table<>::loaded[ENTRY_glRasterPos3i] = (void*)glad_glRasterPos3i;
+            glad_glRasterPos3i = record_glRasterPos3i;
+        }
+        if (glad_glRasterPos3iv && glad_glRasterPos3iv != record_glRasterPos3iv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos3iv] = (void*)glad_glRasterPos3iv;
+            glad_glRasterPos3iv = record_glRasterPos3iv;
+        }
+        if (glad_glRasterPos3s && glad_glRasterPos3s != record_glRasterPos3s)
+        {
+            Table<>::loaded[ENTRY_glRasterPos3s] = (void*)glad_glRasterPos3s;
+            glad_glRasterPos3s = record_glRasterPos3s;
+        }
+        if (glad_glRasterPos3sv && glad_glRasterPos3sv != record_glRasterPos3sv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos3sv] = (void*)glad_glRasterPos3sv;
+            glad_glRasterPos3sv = record_glRasterPos3sv;
+        }
+        if (glad_glRasterPos4d && glad_glRasterPos4d != record_glRasterPos4d)
+        {
+            Table<>::loaded[ENTRY_glRasterPos4d] = (void*)glad_glRasterPos4d;
+            glad_glRasterPos4d = record_glRasterPos4d;
+        }
+        if (glad_glRasterPos4dv && glad_glRasterPos4dv != record_glRasterPos4dv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos4dv] = (void*)glad_glRasterPos4dv;
+            glad_glRasterPos4dv = record_glRasterPos4dv;
+        }
+        if (glad_glRasterPos4f && glad_glRasterPos4f != record_glRasterPos4f)
+        {
+            Table<>::loaded[ENTRY_glRasterPos4f] = (void*)glad_glRasterPos4f;
+            glad_glRasterPos4f = record_glRasterPos4f;
+        }
+        if (glad_glRasterPos4fv && glad_glRasterPos4fv != record_glRasterPos4fv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos4fv] = (void*)glad_glRasterPos4fv;
+            glad_glRasterPos4fv = record_glRasterPos4fv;
+        }
+        if (glad_glRasterPos4i && glad_glRasterPos4i != record_glRasterPos4i)
+        {
+            Table<>::loaded[ENTRY_glRasterPos4i] = (void*)glad_glRasterPos4i;
+            glad_glRasterPos4i = record_glRasterPos4i;
+        }
+        if (glad_glRasterPos4iv && glad_glRasterPos4iv != record_glRasterPos4iv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos4iv] = (void*)glad_glRasterPos4iv;
+            glad_glRasterPos4iv = record_glRasterPos4iv;
+        }
+        if (glad_glRasterPos4s && glad_glRasterPos4s != record_glRasterPos4s)
+        {
+            Table<>::loaded[ENTRY_glRasterPos4s] = (void*)glad_glRasterPos4s;
+            glad_glRasterPos4s = record_glRasterPos4s;
+        }
+        if (glad_glRasterPos4sv && glad_glRasterPos4sv != record_glRasterPos4sv)
+        {
+            Table<>::loaded[ENTRY_glRasterPos4sv] = (void*)glad_glRasterPos4sv;
+            glad_glRasterPos4sv = record_glRasterPos4sv;
+        }
+        if (glad_glRectd && glad_glRectd != record_glRectd)
+        {
+            Table<>::loaded[ENTRY_glRectd] = (void*)glad_glRectd;
+            glad_glRectd = record_glRectd;
+        }
+        if (glad_glRectdv && glad_glRectdv != record_glRectdv)
+        {
+            Table<>::loaded[ENTRY_glRectdv] = (void*)glad_glRectdv;
+            glad_glRectdv = record_glRectdv;
+        }
+        if (glad_glRectf && glad_glRectf != record_glRectf)
+        {
+            Table<>::loaded[ENTRY_glRectf] = (void*)glad_glRectf;
+            glad_glRectf = record_glRectf;
+        }
+        if (glad_glRectfv && glad_glRectfv != record_glRectfv)
+        {
+            Table<>::loaded[ENTRY_glRectfv] = (void*)glad_glRectfv;
+            glad_glRectfv = record_glRectfv;
+        }
+        if (glad_glRecti && glad_glRecti != record_glRecti)
+        {
+            Table<>::loaded[ENTRY_glRecti] = (void*)glad_glRecti;
+            glad_glRecti = record_glRecti;
+        }
+        if (glad_glRectiv && glad_glRectiv != record_glRectiv)
+        {
+            Table<>::loaded[ENTRY_glRectiv] = (void*)glad_glRectiv;
+            glad_glRectiv = record_glRectiv;
+        }
+        if (glad_glRects && glad_glRects != record_glRects)
+        {
+            Table<>::loaded[ENTRY_glRects] = (void*)glad_glRects;
+            glad_glRects = record_glRects;
+        }
+        if (glad_glRectsv && glad_glRectsv != record_glRectsv)
+        {
+            Table<>::loaded[ENTRY_glRectsv] = (void*)glad_glRectsv;
+            glad_glRectsv = record_glRectsv;
+        }
+        if (glad_glTexCoord1d && glad_glTexCoord1d != record_glTexCoord1d)
+        {
+            Table<>::loaded[ENTRY_glTexCoord1d] = (void*)glad_glTexCoord1d;
+            glad_glTexCoord1d = record_glTexCoord1d;
+        }
+        if (glad_glTexCoord1dv && glad_glTexCoord1dv != record_glTexCoord1dv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord1dv] = (void*)glad_glTexCoord1dv;
+            glad_glTexCoord1dv = record_glTexCoord1dv;
+        }
+        if (glad_glTexCoord1f && glad_glTexCoord1f != record_glTexCoord1f)
+        {
+            Table<>::loaded[ENTRY_glTexCoord1f] = (void*)glad_glTexCoord1f;
+            glad_glTexCoord1f = record_glTexCoord1f;
+        }
+        if (glad_glTexCoord1fv && glad_glTexCoord1fv != record_glTexCoord1fv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord1fv] = (void*)glad_glTexCoord1fv;
+            glad_glTexCoord1fv = record_glTexCoord1fv;
+        }
+        if (glad_glTexCoord1i && glad_glTexCoord1i != record_glTexCoord1i)
+        {
+            Table<>::loaded[ENTRY_glTexCoord1i] = (void*)glad_glTexCoord1i;
+            glad_glTexCoord1i = record_glTexCoord1i;
+        }
+        if (glad_glTexCoord1iv && glad_glTexCoord1iv != record_glTexCoord1iv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord1iv] = (void*)glad_glTexCoord1iv;
+            glad_glTexCoord1iv = record_glTexCoord1iv;
+        }
+        if (glad_glTexCoord1s && glad_glTexCoord1s != record_glTexCoord1s)
+        {
+            Table<>::loaded[ENTRY_glTexCoord1s] = (void*)glad_glTexCoord1s;
+            glad_glTexCoord1s = record_glTexCoord1s;
+        }
+        if (glad_glTexCoord1sv && glad_glTexCoord1sv != record_glTexCoord1sv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord1sv] = (void*)glad_glTexCoord1sv;
+            glad_glTexCoord1sv = record_glTexCoord1sv;
+        }
+        if (glad_glTexCoord2d && glad_glTexCoord2d != record_glTexCoord2d)
+        {
+            Table<>::loaded[ENTRY_glTexCoord2d] = (void*)glad_glTexCoord2d;
+            glad_glTexCoord2d = record_glTexCoord2d;
+        }
+        if (glad_glTexCoord2dv && glad_glTexCoord2dv != record_glTexCoord2dv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord2dv] = (void*)glad_glTexCoord2dv;
+            glad_glTexCoord2dv = record_glTexCoord2dv;
+        }
+        if (glad_glTexCoord2f && glad_glTexCoord2f != record_glTexCoord2f)
+        {
+            Table<>::loaded[ENTRY_glTexCoord2f] = (void*)glad_glTexCoord2f;
+            glad_glTexCoord2f = record_glTexCoord2f;
+        }
+        if (glad_glTexCoord2fv && glad_glTexCoord2fv != record_glTexCoord2fv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord2fv] = (void*)glad_glTexCoord2fv;
+            glad_glTexCoord2fv = record_glTexCoord2fv;
+        }
+        if (glad_glTexCoord2i && glad_glTexCoord2i != record_glTexCoord2i)
+        {
+            Table<>::loaded[ENTRY_glTexCoord2i] = (void*)glad_glTexCoord2i;
+            glad_glTexCoord2i = record_glTexCoord2i;
+        }
+        if (glad_glTexCoord2iv && glad_glTexCoord2iv != record_glTexCoord2iv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord2iv] = (void*)glad_glTexCoord2iv;
+            glad_glTexCoord2iv = record_glTexCoord2iv;
+        }
+        if (glad_glTexCoord2s && glad_glTexCoord2s != record_glTexCoord2s)
+        {
+            Table<>::loaded[ENTRY_glTexCoord2s] = (void*)glad_glTexCoord2s;
+            glad_glTexCoord2s = record_glTexCoord2s;
+        }
+        if (glad_glTexCoord2sv && glad_glTexCoord2sv != record_glTexCoord2sv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord2sv] = (void*)glad_glTexCoord2sv;
+            glad_glTexCoord2sv = record_glTexCoord2sv;
+        }
+        if (glad_glTexCoord3d && glad_glTexCoord3d != record_glTexCoord3d)
+        {
+            Table<>::loaded[ENTRY_glTexCoord3d] = (void*)glad_glTexCoord3d;
+            glad_glTexCoord3d = record_glTexCoord3d;
+        }
+        if (glad_glTexCoord3dv && glad_glTexCoord3dv != record_glTexCoord3dv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord3dv] = (void*)glad_glTexCoord3dv;
+            glad_glTexCoord3dv = record_glTexCoord3dv;
+        }
+        if (glad_glTexCoord3f && glad_glTexCoord3f != record_glTexCoord3f)
+        {
+            Table<>::loaded[ENTRY_glTexCoord3f] = (void*)glad_glTexCoord3f;
+            glad_glTexCoord3f = record_glTexCoord3f;
+        }
+        if (glad_glTexCoord3fv && glad_glTexCoord3fv != record_glTexCoord3fv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord3fv] = (void*)glad_glTexCoord3fv;
+            glad_glTexCoord3fv = record_glTexCoord3fv;
+        }
+        if (glad_glTexCoord3i && glad_glTexCoord3i != record_glTexCoord3i)
+        {
+            Table<>::loaded[ENTRY_glTexCoord3i] = (void*)glad_glTexCoord3i;
+            glad_glTexCoord3i = record_glTexCoord3i;
+        }
+        if (glad_glTexCoord3iv && glad_glTexCoord3iv != record_glTexCoord3iv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord3iv] = (void*)glad_glTexCoord3iv;
+            glad_glTexCoord3iv = record_glTexCoord3iv;
+        }
+        if (glad_glTexCoord3s && glad_glTexCoord3s != record_glTexCoord3s)
+        {
+            Table<>::loaded[ENTRY_glTexCoord3s] = (void*)glad_glTexCoord3s;
+            glad_glTexCoord3s = record_glTexCoord3s;
+        }
+        if (glad_glTexCoord3sv && glad_glTexCoord3sv != record_glTexCoord3sv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord3sv] = (void*)glad_glTexCoord3sv;
+            glad_glTexCoord3sv = record_glTexCoord3sv;
+        }
+        if (glad_glTexCoord4d && glad_glTexCoord4d != record_glTexCoord4d)
+        {
+            Table<>::loaded[ENTRY_glTexCoord4d] = (void*)glad_glTexCoord4d;
+            glad_glTexCoord4d = record_glTexCoord4d;
+        }
+        if (glad_glTexCoord4dv && glad_glTexCoord4dv != record_glTexCoord4dv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord4dv] = (void*)glad_glTexCoord4dv;
+            glad_glTexCoord4dv = record_glTexCoord4dv;
+        }
+        if (glad_glTexCoord4f && glad_glTexCoord4f != record_glTexCoord4f)
+        {
+            Table<>::loaded[ENTRY_glTexCoord4f] = (void*)glad_glTexCoord4f;
+            glad_glTexCoord4f = record_glTexCoord4f;
+        }
+        if (glad_glTexCoord4fv && glad_glTexCoord4fv != record_glTexCoord4fv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord4fv] = (void*)glad_glTexCoord4fv;
+            glad_glTexCoord4fv = record_glTexCoord4fv;
+        }
+        if (glad_glTexCoord4i && glad_glTexCoord4i != record_glTexCoord4i)
+        {
+            Table<>::loaded[ENTRY_glTexCoord4i] = (void*)glad_glTexCoord4i;
+            glad_glTexCoord4i = record_glTexCoord4i;
+        }
+        if (glad_glTexCoord4iv && glad_glTexCoord4iv != record_glTexCoord4iv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord4iv] = (void*)glad_glTexCoord4iv;
+            glad_glTexCoord4iv = record_glTexCoord4iv;
+        }
+        if (glad_glTexCoord4s && glad_glTexCoord4s != record_glTexCoord4s)
+        {
+            Table<>::loaded[ENTRY_glTexCoord4s] = (void*)glad_glTexCoord4s;
+            glad_glTexCoord4s = record_glTexCoord4s;
+        }
+        if (glad_glTexCoord4sv && glad_glTexCoord4sv != record_glTexCoord4sv)
+        {
+            Table<>::loaded[ENTRY_glTexCoord4sv] = (void*)glad_glTexCoord4sv;
+            glad_glTexCoord4sv = record_glTexCoord4sv;
+        }
+        if (glad_glVertex2d && glad_glVertex2d != record_glVertex2d)
+        {
+            Table<>::loaded[ENTRY_glVertex2d] = (void*)glad_glVertex2d;
+            glad_glVertex2d = record_glVertex2d;
+        }
+        if (glad_glVertex2dv && glad_glVertex2dv != record_glVertex2dv)
+        {
+            Table<>::loaded[ENTRY_glVertex2dv] = (void*)glad_glVertex2dv;
+            glad_glVertex2dv = record_glVertex2dv;
+        }
+        if (glad_glVertex2f && glad_glVertex2f != record_glVertex2f)
+        {
+            Table<>::loaded[ENTRY_glVertex2f] = (void*)glad_glVertex2f;
+            glad_glVertex2f = record_glVertex2f;
+        }
+        if (glad_glVertex2fv && glad_glVertex2fv != record_glVertex2fv)
+        {
+            Table<>::loaded[ENTRY_glVertex2fv] = (void*)glad_glVertex2fv;
+            glad_glVertex2fv = record_glVertex2fv;
+        }
+        if (glad_glVertex2i && glad_glVertex2i != record_glVertex2i)
+        {
+            Table<>::loaded[ENTRY_glVertex2i] = (void*)glad_glVertex2i;
+            glad_glVertex2i = record_glVertex2i;
+        }
+        if (glad_glVertex2iv && glad_glVertex2iv != record_glVertex2iv)
+        {
+            Table<>::loaded[ENTRY_glVertex2iv] = (void*)glad_glVertex2iv;
+            glad_glVertex2iv = record_glVertex2iv;
+        }
+        if (glad_glVertex2s && glad_glVertex2s != record_glVertex2s)
+        {
+            Table<>::loaded[ENTRY_glVertex2s] = (void*)glad_glVertex2s;
+            glad_glVertex2s = record_glVertex2s;
+        }
+        if (glad_glVertex2sv && glad_glVertex2sv != record_glVertex2sv)
+        {
+            Table<>::loaded[ENTRY_glVertex2sv] = (void*)glad_glVertex2sv;
+            glad_glVertex2sv = record_glVertex2sv;
+        }
+        if (glad_glVertex3d && glad_glVertex3d != record_glVertex3d)
+        {
+            Table<>::loaded[ENTRY_glVertex3d] = (void*)glad_glVertex3d;
+            glad_glVertex3d = record_glVertex3d;
+        }
+        if (glad_glVertex3dv && glad_glVertex3dv != record_glVertex3dv)
+        {
+            Table<>::loaded[ENTRY_glVertex3dv] = (void*)glad_glVertex3dv;
+            glad_glVertex3dv = record_glVertex3dv;
+        }
+        if (glad_glVertex3f && glad_glVertex3f != record_glVertex3f)
+        {
+            Table<>::loaded[ENTRY_glVertex3f] = (void*)glad_glVertex3f;
+            glad_glVertex3f = record_glVertex3f;
+        }
+        if (glad_glVertex3fv && glad_glVertex3fv != record_glVertex3fv)
+        {
+            Table<>::loaded[ENTRY_glVertex3fv] = (void*)glad_glVertex3fv;
+            glad_glVertex3fv = record_glVertex3fv;
+        }
+        if (glad_glVertex3i && glad_glVertex3i != record_glVertex3i)
+        {
+            Table<>::loaded[ENTRY_glVertex3i] = (void*)glad_glVertex3i;
+            glad_glVertex3i = record_glVertex3i;
+        }
+        if (glad_glVertex3iv && glad_glVertex3iv != record_glVertex3iv)
+        {
+            Table<>::loaded[ENTRY_glVertex3iv] = (void*)glad_glVertex3iv;
+            glad_glVertex3iv = record_glVertex3iv;
+        }
+        if (glad_glVertex3s && glad_glVertex3s != record_glVertex3s)
+        {
+            Table<>::loaded[ENTRY_glVertex3s] = (void*)glad_glVertex3s;
+            glad_glVertex3s = record_glVertex3s;
+        }
+        if (glad_glVertex3sv && glad_glVertex3sv != record_glVertex3sv)
+        {
+            Table<>::loaded[ENTRY_glVertex3sv] = (void*)glad_glVertex3sv;
+            glad_glVertex3sv = record_glVertex3sv;
+        }
+        if (glad_glVertex4d && glad_glVertex4d != record_glVertex4d)
+        {
+            Table<>::loaded[ENTRY_glVertex4d] = (void*)glad_glVertex4d;
+            glad_glVertex4d = record_glVertex4d;
+        }
+        if (glad_glVertex4dv && glad_glVertex4dv != record_glVertex4dv)
+        {
+            Table<>::loaded[ENTRY_glVertex4dv] = (void*)glad_glVertex4dv;
+            glad_glVertex4dv = record_glVertex4dv;
+        }
+        if (glad_glVertex4f && glad_glVertex4f != record_glVertex4f)
+        {
+            Table<>::loaded[ENTRY_glVertex4f] = (void*)glad_glVertex4f;
+            glad_glVertex4f = record_glVertex4f;
+        }
+        if (glad_glVertex4fv && glad_glVertex4fv != record_glVertex4fv)
+        {
+            Table<>::loaded[ENTRY_glVertex4fv] = (void*)glad_glVertex4fv;
+            glad_glVertex4fv = record_glVertex4fv;
+        }
+        if (glad_glVertex4i && glad_glVertex4i != record_glVertex4i)
+        {
+            Table<>::loaded[ENTRY_glVertex4i] = (void*)glad_glVertex4i;
+            glad_glVertex4i = record_glVertex4i;
+        }
+        if (glad_glVertex4iv && glad_glVertex4iv != record_glVertex4iv)
+        {
+            Table<>::loaded[ENTRY_glVertex4iv] = (void*)glad_glVertex4iv;
+            glad_glVertex4iv = record_glVertex4iv;
+        }
+        if (glad_glVertex4s && glad_glVertex4s != record_glVertex4s)
+        {
+            Table<>::loaded[ENTRY_glVertex4s] = (void*)glad_glVertex4s;
+            glad_glVertex4s = record_glVertex4s;
+        }
+        if (glad_glVertex4sv && glad_glVertex4sv != record_glVertex4sv)
+        {
+            Table<>::loaded[ENTRY_glVertex4sv] = (void*)glad_glVertex4sv;
+            glad_glVertex4sv = record_glVertex4sv;
+        }
+        if (glad_glClipPlane && glad_glClipPlane != record_glClipPlane)
+        {
+            Table<>::loaded[ENTRY_glClipPlane] = (void*)glad_glClipPlane;
+            glad_glClipPlane = record_glClipPlane;
+        }
+        if (glad_glColorMaterial && glad_glColorMaterial != record_glColorMaterial)
+        {
+            Table<>::loaded[ENTRY_glColorMaterial] = (void*)glad_glColorMaterial;
+            glad_glColorMaterial = record_glColorMaterial;
+        }
+        if (glad_glFogf && glad_glFogf != record_glFogf)
+        {
+            Table<>::loaded[ENTRY_glFogf] = (void*)glad_glFogf;
+            glad_glFogf = record_glFogf;
+        }
+        if (glad_glFogfv && glad_glFogfv != record_glFogfv)
+        {
+            Table<>::loaded[ENTRY_glFogfv] = (void*)glad_glFogfv;
+            glad_glFogfv = record_glFogfv;
+        }
+        if (glad_glFogi && glad_glFogi != record_glFogi)
+        {
+            Table<>::loaded[ENTRY_glFogi] = (void*)glad_glFogi;
+            glad_glFogi = record_glFogi;
+        }
+        if (glad_glFogiv && glad_glFogiv != record_glFogiv)
+        {
+            Table<>::loaded[ENTRY_glFogiv] = (void*)glad_glFogiv;
+            glad_glFogiv = record_glFogiv;
+        }
+        if (glad_glLightf && glad_glLightf != record_glLightf)
+        {
+            Table<>::loaded[ENTRY_glLightf] = (void*)glad_glLightf;
+            glad_glLightf = record_glLightf;
+        }
+        if (glad_glLightfv && glad_glLightfv != record_glLightfv)
+        {
+            Table<>::loaded[ENTRY_glLightfv] = (void*)glad_glLightfv;
+            glad_glLightfv = record_glLightfv;
+        }
+        if (glad_glLighti && glad_glLighti != record_glLighti)
+        {
+            Table<>::loaded[ENTRY_glLighti] = (void*)glad_glLighti;
+            glad_glLighti = record_glLighti;
+        }
+        if (glad_glLightiv && glad_glLightiv != record_glLightiv)
+        {
+            Table<>::loaded[ENTRY_glLightiv] = (void*)glad_glLightiv;
+            glad_glLightiv = record_glLightiv;
+        }
+        if (glad_glLightModelf && glad_glLightModelf != record_glLightModelf)
+        {
+            Table<>::loaded[ENTRY_glLightModelf] = (void*)glad_glLightModelf;
+            glad_glLightModelf = record_glLightModelf;
+        }
+        if (glad_glLightModelfv && glad_glLightModelfv != record_glLightModelfv)
+        {
+            Table<>::loaded[ENTRY_glLightModelfv] = (void*)glad_glLightModelfv;
+            glad_glLightModelfv = record_glLightModelfv;
+        }
+        if (glad_glLightModeli && glad_glLightModeli != record_glLightModeli)
+        {
+            Table<>::loaded[ENTRY_glLightModeli] = (void*)glad_glLightModeli;
+            glad_glLightModeli = record_glLightModeli;
+        }
+        if (glad_glLightModeliv && glad_glLightModeliv != record_glLightModeliv)
+        {
+            Table<>::loaded[ENTRY_glLightModeliv] = (void*)glad_glLightModeliv;
+            glad_glLightModeliv = record_glLightModeliv;
+        }
+        if (glad_glLineStipple && glad_glLineStipple != record_glLineStipple)
+        {
+            Table<>::loaded[ENTRY_glLineStipple] = (void*)glad_glLineStipple;
+            glad_glLineStipple = record_glLineStipple;
+        }
+        if (glad_glMaterialf && glad_glMaterialf != record_glMaterialf)
+        {
+            Table<>::loaded[ENTRY_glMaterialf] = (void*)glad_glMaterialf;
+            glad_glMaterialf = record_glMaterialf;
+        }
+        if (glad_glMaterialfv && glad_glMaterialfv != record_glMaterialfv)
+        {
+            Table<>::loaded[ENTRY_glMaterialfv] = (void*)glad_glMaterialfv;
+            glad_glMaterialfv = record_glMaterialfv;
+        }
+        if (glad_glMateriali && glad_glMateriali != record_glMateriali)
+        {
+            Table<>::loaded[ENTRY_glMateriali] = (void*)glad_glMateriali;
+            glad_glMateriali = record_glMateriali;
+        }
+        if (glad_glMaterialiv && glad_glMaterialiv != record_glMaterialiv)
+        {
+            Table<>::loaded[ENTRY_glMaterialiv] = (void*)glad_glMaterialiv;
+            glad_glMaterialiv = record_glMaterialiv;
+        }
+        if (glad_glPolygonStipple && glad_glPolygonStipple != record_glPolygonStipple)
+        {
+            Table<>::loaded[ENTRY_glPolygonStipple] = (void*)glad_glPolygonStipple;
+            glad_glPolygonStipple = record_glPolygonStipple;
+        }
+        if (glad_glShadeModel && glad_glShadeModel != record_glShadeModel)
+        {
+            Table<>::loaded[ENTRY_glShadeModel] = (void*)glad_glShadeModel;
+            glad_glShadeModel = record_glShadeModel;
+        }
+        if (glad_glTexEnvf && glad_glTexEnvf != record_glTexEnvf)
+        {
+            Table<>::loaded[ENTRY_glTexEnvf] = (void*)glad_glTexEnvf;
+            glad_glTexEnvf = record_glTexEnvf;
+        }
+        if (glad_glTexEnvfv && glad_glTexEnvfv != record_glTexEnvfv)
+        {
+            Table<>::loaded[ENTRY_glTexEnvfv] = (void*)glad_glTexEnvfv;
+            glad_glTexEnvfv = record_glTexEnvfv;
+        }
+        if (glad_glTexEnvi && glad_glTexEnvi != record_glTexEnvi)
+        {
+            Table<>::loaded[ENTRY_glTexEnvi] = (void*)glad_glTexEnvi;
+            glad_glTexEnvi = record_glTexEnvi;
+        }
+        if (glad_glTexEnviv && glad_glTexEnviv != record_glTexEnviv)
+        {
+            Table<>::loaded[ENTRY_glTexEnviv] = (void*)glad_glTexEnviv;
+            glad_glTexEnviv = record_glTexEnviv;
+        }
+        if (glad_glTexGend && glad_glTexGend != record_glTexGend)
+        {
+            Table<>::loaded[ENTRY_glTexGend] = (void*)glad_glTexGend;
+            glad_glTexGend = record_glTexGend;
+        }
+        if (glad_glTexGendv && glad_glTexGendv != record_glTexGendv)
+        {
+            Table<>::loaded[ENTRY_glTexGendv] = (void*)glad_glTexGendv;
+            glad_glTexGendv = record_glTexGendv;
+        }
+        if (glad_glTexGenf && glad_glTexGenf != record_glTexGenf)
+        {
+            Table<>::loaded[ENTRY_glTexGenf] = (void*)glad_glTexGenf;
+            glad_glTexGenf = record_glTexGenf;
+        }
+        if (glad_glTexGenfv && glad_glTexGenfv != record_glTexGenfv)
+        {
+            Table<>::loaded[ENTRY_glTexGenfv] = (void*)glad_glTexGenfv;
+            glad_glTexGenfv = record_glTexGenfv;
+        }
+        if (glad_glTexGeni && glad_glTexGeni != record_glTexGeni)
+        {
+            Table<>::loaded[ENTRY_glTexGeni] = (void*)glad_glTexGeni;
+            glad_glTexGeni = record_glTexGeni;
+        }
+        if (glad_glTexGeniv && glad_glTexGeniv != record_glTexGeniv)
+        {
+            Table<>::loaded[ENTRY_glTexGeniv] = (void*)glad_glTexGeniv;
+            glad_glTexGeniv = record_glTexGeniv;
+        }
+        if (glad_glFeedbackBuffer && glad_glFeedbackBuffer != record_glFeedbackBuffer)
+        {
+            Table<>::loaded[ENTRY_glFeedbackBuffer] = (void*)glad_glFeedbackBuffer;
+            glad_glFeedbackBuffer = record_glFeedbackBuffer;
+        }
+        if (glad_glSelectBuffer && glad_glSelectBuffer != record_glSelectBuffer)
+        {
+            Table<>::loaded[ENTRY_glSelectBuffer] = (void*)glad_glSelectBuffer;
+            glad_glSelectBuffer = record_glSelectBuffer;
+        }
+        if (glad_glInitNames && glad_glInitNames != record_glInitNames)
+        {
+            Table<>::loaded[ENTRY_glInitNames] = (void*)glad_glInitNames;
+            glad_glInitNames = record_glInitNames;
+        }
+        if (glad_glLoadName && glad_glLoadName != record_glLoadName)
+        {
+            Table<>::loaded[ENTRY_glLoadName] = (void*)glad_glLoadName;
+            glad_glLoadName = record_glLoadName;
+        }
+        if (glad_glPassThrough && glad_glPassThrough != record_glPassThrough)
+        {
+            Table<>::loaded[ENTRY_glPassThrough] = (void*)glad_glPassThrough;
+            glad_glPassThrough = record_glPassThrough;
+        }
+        if (glad_glPopName && glad_glPopName != record_glPopName)
+        {
+            Table<>::loaded[ENTRY_glPopName] = (void*)glad_glPopName;
+            glad_glPopName = record_glPopName;
+        }
+        if (glad_glPushName && glad_glPushName != record_glPushName)
+        {
+            Table<>::loaded[ENTRY_glPushName] = (void*)glad_glPushName;
+            glad_glPushName = record_glPushName;
+        }
+        if (glad_glClearAccum && glad_glClearAccum != record_glClearAccum)
+        {
+            Table<>::loaded[ENTRY_glClearAccum] = (void*)glad_glClearAccum;
+            glad_glClearAccum = record_glClearAccum;
+        }
+        if (glad_glClearIndex && glad_glClearIndex != record_glClearIndex)
+        {
+            Table<>::loaded[ENTRY_glClearIndex] = (void*)glad_glClearIndex;
+            glad_glClearIndex = record_glClearIndex;
+        }
+        if (glad_glIndexMask && glad_glIndexMask != record_glIndexMask)
+        {
+            Table<>::loaded[ENTRY_glIndexMask] = (void*)glad_glIndexMask;
+            glad_glIndexMask = record_glIndexMask;
+        }
+        if (glad_glAccum && glad_glAccum != record_glAccum)
+        {
+            Table<>::loaded[ENTRY_glAccum] = (void*)glad_glAccum;
+            glad_glAccum = record_glAccum;
+        }
+        if (glad_glPopAttrib && glad_glPopAttrib != record_glPopAttrib)
+        {
+            Table<>::loaded[ENTRY_glPopAttrib] = (void*)glad_glPopAttrib;
+            glad_glPopAttrib = record_glPopAttrib;
+        }
+        if (glad_glPushAttrib && glad_glPushAttrib != record_glPushAttrib)
+        {
+            Table<>::loaded[ENTRY_glPushAttrib] = (void*)glad_glPushAttrib;
+            glad_glPushAttrib = record_glPushAttrib;
+        }
+        if (glad_glMap1d && glad_glMap1d != record_glMap1d)
+        {
+            Table<>::loaded[ENTRY_glMap1d] = (void*)glad_glMap1d;
+            glad_glMap1d = record_glMap1d;
+        }
+        if (glad_glMap1f && glad_glMap1f != record_glMap1f)
+        {
+            Table<>::loaded[ENTRY_glMap1f] = (void*)glad_glMap1f;
+            glad_glMap1f = record_glMap1f;
+        }
+        if (glad_glMap2d && glad_glMap2d != record_glMap2d)
+        {
+            Table<>::loaded[ENTRY_glMap2d] = (void*)glad_glMap2d;
+            glad_glMap2d = record_glMap2d;
+        }
+        if (glad_glMap2f && glad_glMap2f != record_glMap2f)
+        {
+            Table<>::loaded[ENTRY_glMap2f] = (void*)glad_glMap2f;
+            glad_glMap2f = record_glMap2f;
+        }
+        if (glad_glMapGrid1d && glad_glMapGrid1d != record_glMapGrid1d)
+        {
+            Table<>::loaded[ENTRY_glMapGrid1d] = (void*)glad_glMapGrid1d;
+            glad_glMapGrid1d = record_glMapGrid1d;
+        }
+        if (glad_glMapGrid1f && glad_glMapGrid1f != record_glMapGrid1f)
+        {
+            Table<>::loaded[ENTRY_glMapGrid1f] = (void*)glad_glMapGrid1f;
+            glad_glMapGrid1f = record_glMapGrid1f;
+        }
+        if (glad_glMapGrid2d && glad_glMapGrid2d != record_glMapGrid2d)
+        {
+            Table<>::loaded[ENTRY_glMapGrid2d] = (void*)glad_glMapGrid2d;
+            glad_glMapGrid2d = record_glMapGrid2d;
+        }
+        if (glad_glMapGrid2f && glad_glMapGrid2f != record_glMapGrid2f)
+        {
+            Table<>::loaded[ENTRY_glMapGrid2f] = (void*)glad_glMapGrid2f;
+            glad_glMapGrid2f = record_glMapGrid2f;
+        }
+        if (glad_glEvalCoord1d && glad_glEvalCoord1d != record_glEvalCoord1d)
+        {
+            Table<>::loaded[ENTRY_glEvalCoord1d] = (void*)glad_glEvalCoord1d;
+            glad_glEvalCoord1d = record_glEvalCoord1d;
+        }
+        if (glad_glEvalCoord1dv && glad_glEvalCoord1dv != record_glEvalCoord1dv)
+        {
+            Table<>::loaded[ENTRY_glEvalCoord1dv] = (void*)glad_glEvalCoord1dv;
+            glad_glEvalCoord1dv = record_glEvalCoord1dv;
+        }
+        if (glad_glEvalCoord1f && glad_glEvalCoord1f != record_glEvalCoord1f)
+        {
+            Table<>::loaded[ENTRY_glEvalCoord1f] = (void*)glad_glEvalCoord1f;
+            glad_glEvalCoord1f = record_glEvalCoord1f;
+        }
+        if (glad_glEvalCoord1fv && glad_glEvalCoord1fv != record_glEvalCoord1fv)
+        {
+            Table<>::loaded[ENTRY_glEvalCoord1fv] = (void*)glad_glEvalCoord1fv;
+            glad_glEvalCoord1fv = record_glEvalCoord1fv;
+        }
+        if (glad_glEvalCoord2d && glad_glEvalCoord2d != record_glEvalCoord2d)
+        {
+            Table<>::loaded[ENTRY_glEvalCoord2d] = (void*)glad_glEvalCoord2d;
+            glad_glEvalCoord2d = record_glEvalCoord2d;
+        }
+        if (glad_glEvalCoord2dv && glad_glEvalCoord2dv != record_glEvalCoord2dv)
+        {
+            Table<>::loaded[ENTRY_glEvalCoord2dv] = (void*)glad_glEvalCoord2dv;
+            glad_glEvalCoord2dv = record_glEvalCoord2dv;
+        }
+        if (glad_glEvalCoord2f && glad_glEvalCoord2f != record_glEvalCoord2f)
+        {
+            Table<>::loaded[ENTRY_glEvalCoord2f] = (void*)glad_glEvalCoord2f;
+            glad_glEvalCoord2f = record_glEvalCoord2f;
+        }
+        if (glad_glEvalCoord2fv && glad_glEvalCoord2fv != record_glEvalCoord2fv)
+        {
+            Table<>::loaded[ENTRY_glEvalCoord2fv] = (void*)glad_glEvalCoord2fv;
+            glad_glEvalCoord2fv = record_glEvalCoord2fv;
+        }
+        if (glad_glEvalMesh1 && glad_glEvalMesh1 != record_glEvalMesh1)
+        {
+            Table<>::loaded[ENTRY_glEvalMesh1] = (void*)glad_glEvalMesh1;
+            glad_glEvalMesh1 = record_glEvalMesh1;
+        }
+        if (glad_glEvalPoint1 && glad_glEvalPoint1 != record_glEvalPoint1)
+        {
+            Table<>::loaded[ENTRY_glEvalPoint1] = (void*)glad_glEvalPoint1;
+            glad_glEvalPoint1 = record_glEvalPoint1;
+        }
+        if (glad_glEvalMesh2 && glad_glEvalMesh2 != record_glEvalMesh2)
+        {
+            Table<>::loaded[ENTRY_glEvalMesh2] = (void*)glad_glEvalMesh2;
+            glad_glEvalMesh2 = record_glEvalMesh2;
+        }
+        if (glad_glEvalPoint2 && glad_glEvalPoint2 != record_glEvalPoint2)
+        {
+            Table<>::loaded[ENTRY_glEvalPoint2] = (void*)glad_glEvalPoint2;
+            glad_glEvalPoint2 = record_glEvalPoint2;
+        }
+        if (glad_glAlphaFunc && glad_glAlphaFunc != record_glAlphaFunc)
+        {
+            Table<>::loaded[ENTRY_glAlphaFunc] = (void*)glad_glAlphaFunc;
+            glad_glAlphaFunc = record_glAlphaFunc;
+        }
+        if (glad_glPixelZoom && glad_glPixelZoom != record_glPixelZoom)
+        {
+            Table<>::loaded[ENTRY_glPixelZoom] = (void*)glad_glPixelZoom;
+            glad_glPixelZoom = record_glPixelZoom;
+        }
+        if (glad_glPixelTransferf && glad_glPixelTransferf != record_glPixelTransferf)
+        {
+            Table<>::loaded[ENTRY_glPixelTransferf] = (void*)glad_glPixelTransferf;
+            glad_glPixelTransferf = record_glPixelTransferf;
+        }
+        if (glad_glPixelTransferi && glad_glPixelTransferi != record_glPixelTransferi)
+        {
+            Table<>::loaded[ENTRY_glPixelTransferi] = (void*)glad_glPixelTransferi;
+            glad_glPixelTransferi = record_glPixelTransferi;
+        }
+        if (glad_glPixelMapfv && glad_glPixelMapfv != record_glPixelMapfv)
+        {
+            Table<>::loaded[ENTRY_glPixelMapfv] = (void*)glad_glPixelMapfv;
+            glad_glPixelMapfv = record_glPixelMapfv;
+        }
+        if (glad_glPixelMapuiv && glad_glPixelMapuiv != record_glPixelMapuiv)
+        {
+            Table<>::loaded[ENTRY_glPixelMapuiv] = (void*)glad_glPixelMapuiv;
+            glad_glPixelMapuiv = record_glPixelMapuiv;
+        }
+        if (glad_glPixelMapusv && glad_glPixelMapusv != record_glPixelMapusv)
+        {
+            Table<>::loaded[ENTRY_glPixelMapusv] = (void*)glad_glPixelMapusv;
+            glad_glPixelMapusv = record_glPixelMapusv;
+        }
+        if (glad_glCopyPixels && glad_glCopyPixels != record_glCopyPixels)
+        {
+            Table<>::loaded[ENTRY_glCopyPixels] = (void*)glad_glCopyPixels;
+            glad_glCopyPixels = record_glCopyPixels;
+        }
+        if (glad_glDrawPixels && glad_glDrawPixels != record_glDrawPixels)
+        {
+            Table<>::loaded[ENTRY_glDrawPixels] = (void*)glad_glDrawPixels;
+            glad_glDrawPixels = record_glDrawPixels;
+        }
+        if (glad_glFrustum && glad_glFrustum != record_glFrustum)
+        {
+            Table<>::loaded[ENTRY_glFrustum] = (void*)glad_glFrustum;
+            glad_glFrustum = record_glFrustum;
+        }
+        if (glad_glLoadIdentity && glad_glLoadIdentity != record_glLoadIdentity)
+        {
+            Table<>::loaded[ENTRY_glLoadIdentity] = (void*)glad_glLoadIdentity;
+            glad_glLoadIdentity = record_glLoadIdentity;
+        }
+        if (glad_glLoadMatrixf && glad_glLoadMatrixf != record_glLoadMatrixf)
+        {
+            Table<>::loaded[ENTRY_glLoadMatrixf] = (void*)glad_glLoadMatrixf;
+            glad_glLoadMatrixf = record_glLoadMatrixf;
+        }
+        if (glad_glLoadMatrixd && glad_glLoadMatrixd != record_glLoadMatrixd)
+        {
+            Table<>::loaded[ENTRY_glLoadMatrixd] = (void*)glad_glLoadMatrixd;
+            glad_glLoadMatrixd = record_glLoadMatrixd;
+        }
+        if (glad_glMatrixMode && glad_glMatrixMode != record_glMatrixMode)
+        {
+            Table<>::loaded[ENTRY_glMatrixMode] = (void*)glad_glMatrixMode;
+            glad_glMatrixMode = record_glMatrixMode;
+        }
+        if (glad_glMultMatrixf && glad_glMultMatrixf != record_glMultMatrixf)
+        {
+            Table<>::loaded[ENTRY_glMultMatrixf] = (void*)glad_glMultMatrixf;
+            glad_glMultMatrixf = record_glMultMatrixf;
+        }
+        if (glad_glMultMatrixd && glad_glMultMatrixd != record_glMultMatrixd)
+        {
+            Table<>::loaded[ENTRY_glMultMatrixd] = (void*)glad_glMultMatrixd;
+            glad_glMultMatrixd = record_glMultMatrixd;
+        }
+        if (glad_glOrtho && glad_glOrtho != record_glOrtho)
+        {
+            Table<>::loaded[ENTRY_glOrtho] = (void*)glad_glOrtho;
+            glad_glOrtho = record_glOrtho;
+        }
+        if (glad_glPopMatrix && glad_glPopMatrix != record_glPopMatrix)
+        {
+            Table<>::loaded[ENTRY_glPopMatrix] = (void*)glad_glPopMatrix;
+            glad_glPopMatrix = record_glPopMatrix;
+        }
+        if (glad_glPushMatrix && glad_glPushMatrix != record_glPushMatrix)
+        {
+            Table<>::loaded[ENTRY_glPushMatrix] = (void*)glad_glPushMatrix;
+            glad_glPushMatrix = record_glPushMatrix;
+        }
+        if (glad_glRotated && glad_glRotated != record_glRotated)
+        {
+            Table<>::loaded[ENTRY_glRotated] = (void*)glad_glRotated;
+            glad_glRotated = record_glRotated;
+        }
+        if (glad_glRotatef && glad_glRotatef != record_glRotatef)
+        {
+            Table<>::loaded[ENTRY_glRotatef] = (void*)glad_glRotatef;
+            glad_glRotatef = record_glRotatef;
+        }
+        if (glad_glScaled && glad_glScaled != record_glScaled)
+        {
+            Table<>::loaded[ENTRY_glScaled] = (void*)glad_glScaled;
+            glad_glScaled = record_glScaled;
+        }
+        if (glad_glScalef && glad_glScalef != record_glScalef)
+        {
+            Table<>::loaded[ENTRY_glScalef] = (void*)glad_glScalef;
+            glad_glScalef = record_glScalef;
+        }
+        if (glad_glTranslated && glad_glTranslated != record_glTranslated)
+        {
+            Table<>::loaded[ENTRY_glTranslated] = (void*)glad_glTranslated;
+            glad_glTranslated = record_glTranslated;
+        }
+        if (glad_glTranslatef && glad_glTranslatef != record_glTranslatef)
+        {
+            Table<>::loaded[ENTRY_glTranslatef] = (void*)glad_glTranslatef;
+            glad_glTranslatef = record_glTranslatef;
+        }
+        if (glad_glDrawArrays && glad_glDrawArrays != record_glDrawArrays)
+        {
+            Table<>::loaded[ENTRY_glDrawArrays] = (void*)glad_glDrawArrays;
+            glad_glDrawArrays = record_glDrawArrays;
+        }
+        if (glad_glDrawElements && glad_glDrawElements != record_glDrawElements)
+        {
+            Table<>::loaded[ENTRY_glDrawElements] = (void*)glad_glDrawElements;
+            glad_glDrawElements = record_glDrawElements;
+        }
+        if (glad_glPolygonOffset && glad_glPolygonOffset != record_glPolygonOffset)
+        {
+            Table<>::loaded[ENTRY_glPolygonOffset] = (void*)glad_glPolygonOffset;
+            glad_glPolygonOffset = record_glPolygonOffset;
+        }
+        if (glad_glCopyTexImage1D && glad_glCopyTexImage1D != record_glCopyTexImage1D)
+        {
+            Table<>::loaded[ENTRY_glCopyTexImage1D] = (void*)glad_glCopyTexImage1D;
+            glad_glCopyTexImage1D = record_glCopyTexImage1D;
+        }
+        if (glad_glCopyTexImage2D && glad_glCopyTexImage2D != record_glCopyTexImage2D)
+        {
+            Table<>::loaded[ENTRY_glCopyTexImage2D] = (void*)glad_glCopyTexImage2D;
+            glad_glCopyTexImage2D = record_glCopyTexImage2D;
+        }
+        if (glad_glCopyTexSubImage1D && glad_glCopyTexSubImage1D != record_glCopyTexSubImage1D)
+        {
+            Table<>::loaded[ENTRY_glCopyTexSubImage1D] = (void*)glad_glCopyTexSubImage1D;
+            glad_glCopyTexSubImage1D = record_glCopyTexSubImage1D;
+        }
+        if (glad_glCopyTexSubImage2D && glad_glCopyTexSubImage2D != record_glCopyTexSubImage2D)
+        {
+            Table<>::loaded[ENTRY_glCopyTexSubImage2D] = (void*)glad_glCopyTexSubImage2D;
+            glad_glCopyTexSubImage2D = record_glCopyTexSubImage2D;
+        }
+        if (glad_glTexSubImage1D && glad_glTexSubImage1D != record_glTexSubImage1D)
+        {
+            Table<>::loaded[ENTRY_glTexSubImage1D] = (void*)glad_glTexSubImage1D;
+            glad_glTexSubImage1D = record_glTexSubImage1D;
+        }
+        if (glad_glTexSubImage2D && glad_glTexSubImage2D != record_glTexSubImage2D)
+        {
+            Table<>::loaded[ENTRY_glTexSubImage2D] = (void*)glad_glTexSubImage2D;
+            glad_glTexSubImage2D = record_glTexSubImage2D;
+        }
+        if (glad_glBindTexture && glad_glBindTexture != record_glBindTexture)
+        {
+            Table<>::loaded[ENTRY_glBindTexture] = (void*)glad_glBindTexture;
+            glad_glBindTexture = record_glBindTexture;
+        }
+        if (glad_glDeleteTextures && glad_glDeleteTextures != record_glDeleteTextures)
+        {
+            Table<>::loaded[ENTRY_glDeleteTextures] = (void*)glad_glDeleteTextures;
+            glad_glDeleteTextures = record_glDeleteTextures;
+        }
+        if (glad_glGenTextures && glad_glGenTextures != record_glGenTextures)
+        {
+            Table<>::loaded[ENTRY_glGenTextures] = (void*)glad_glGenTextures;
+            glad_glGenTextures = record_glGenTextures;
+        }
+        if (glad_glArrayElement && glad_glArrayElement != record_glArrayElement)
+        {
+            Table<>::loaded[ENTRY_glArrayElement] = (void*)glad_glArrayElement;
+            glad_glArrayElement = record_glArrayElement;
+        }
+        if (glad_glColorPointer && glad_glColorPointer != record_glColorPointer)
+        {
+            Table<>::loaded[ENTRY_glColorPointer] = (void*)glad_glColorPointer;
+            glad_glColorPointer = record_glColorPointer;
+        }
+        if (glad_glDisableClientState && glad_glDisableClientState != record_glDisableClientState)
+        {
+            Table<>::loaded[ENTRY_glDisableClientState] = (void*)glad_glDisableClientState;
+            glad_glDisableClientState = record_glDisableClientState;
+        }
+        if (glad_glEdgeFlagPointer && glad_glEdgeFlagPointer != record_glEdgeFlagPointer)
+        {
+            Table<>::loaded[ENTRY_glEdgeFlagPointer] = (void*)glad_glEdgeFlagPointer;
+            glad_glEdgeFlagPointer = record_glEdgeFlagPointer;
+        }
+        if (glad_glEnableClientState && glad_glEnableClientState != record_glEnableClientState)
+        {
+            Table<>::loaded[ENTRY_glEnableClientState] = (void*)glad_glEnableClientState;
+            glad_glEnableClientState = record_glEnableClientState;
+        }
+        if (glad_glIndexPointer && glad_glIndexPointer != record_glIndexPointer)
+        {
+            Table<>::loaded[ENTRY_glIndexPointer] = (void*)glad_glIndexPointer;
+            glad_glIndexPointer = record_glIndexPointer;
+        }
+        if (glad_glInterleavedArrays && glad_glInterleavedArrays != record_glInterleavedArrays)
+        {
+            Table<>::loaded[ENTRY_glInterleavedArrays] = (void*)glad_glInterleavedArrays;
+            glad_glInterleavedArrays = record_glInterleavedArrays;
+        }
+        if (glad_glNormalPointer && glad_glNormalPointer != record_glNormalPointer)
+        {
+            Table<>::loaded[ENTRY_glNormalPointer] = (void*)glad_glNormalPointer;
+            glad_glNormalPointer = record_glNormalPointer;
+        }
+        if (glad_glTexCoordPointer && glad_glTexCoordPointer != record_glTexCoordPointer)
+        {
+            Table<>::loaded[ENTRY_glTexCoordPointer] = (void*)glad_glTexCoordPointer;
+            glad_glTexCoordPointer = record_glTexCoordPointer;
+        }
+        if (glad_glVertexPointer && glad_glVertexPointer != record_glVertexPointer)
+        {
+            Table<>::loaded[ENTRY_glVertexPointer] = (void*)glad_glVertexPointer;
+            glad_glVertexPointer = record_glVertexPointer;
+        }
+        if (glad_glPrioritizeTextures && glad_glPrioritizeTextures != record_glPrioritizeTextures)
+        {
+            Table<>::loaded[ENTRY_glPrioritizeTextures] = (void*)glad_glPrioritizeTextures;
+            glad_glPrioritizeTextures = record_glPrioritizeTextures;
+        }
+        if (glad_glIndexub && glad_glIndexub != record_glIndexub)
+        {
+            Table<>::loaded[ENTRY_glIndexub] = (void*)glad_glIndexub;
+            glad_glIndexub = record_glIndexub;
+        }
+        if (glad_glIndexubv && glad_glIndexubv != record_glIndexubv)
+        {
+            Table<>::loaded[ENTRY_glIndexubv] = (void*)glad_glIndexubv;
+            glad_glIndexubv = record_glIndexubv;
+        }
+        if (glad_glPopClientAttrib && glad_glPopClientAttrib != record_glPopClientAttrib)
+        {
+            Table<>::loaded[ENTRY_glPopClientAttrib] = (void*)glad_glPopClientAttrib;
+            glad_glPopClientAttrib = record_glPopClientAttrib;
+        }
+        if (glad_glPushClientAttrib && glad_glPushClientAttrib != record_glPushClientAttrib)
+        {
+            Table<>::loaded[ENTRY_glPushClientAttrib] = (void*)glad_glPushClientAttrib;
+            glad_glPushClientAttrib = record_glPushClientAttrib;
+        }
+        if (glad_glDrawRangeElements && glad_glDrawRangeElements != record_glDrawRangeElements)
+        {
+            Table<>::loaded[ENTRY_glDrawRangeElements] = (void*)glad_glDrawRangeElements;
+            glad_glDrawRangeElements = record_glDrawRangeElements;
+        }
+        if (glad_glTexImage3D && glad_glTexImage3D != record_glTexImage3D)
+        {
+            Table<>::loaded[ENTRY_glTexImage3D] = (void*)glad_glTexImage3D;
+            glad_glTexImage3D = record_glTexImage3D;
+        }
+        if (glad_glTexSubImage3D && glad_glTexSubImage3D != record_glTexSubImage3D)
+        {
+            Table<>::loaded[ENTRY_glTexSubImage3D] = (void*)glad_glTexSubImage3D;
+            glad_glTexSubImage3D = record_glTexSubImage3D;
+        }
+        if (glad_glCopyTexSubImage3D && glad_glCopyTexSubImage3D != record_glCopyTexSubImage3D)
+        {
+            Table<>::loaded[ENTRY_glCopyTexSubImage3D] = (void*)glad_glCopyTexSubImage3D;
+            glad_glCopyTexSubImage3D = record_glCopyTexSubImage3D;
+        }
+        if (glad_glActiveTexture && glad_glActiveTexture != record_glActiveTexture)
+        {
+            Table<>::loaded[ENTRY_glActiveTexture] = (void*)glad_glActiveTexture;
+            glad_glActiveTexture = record_glActiveTexture;
+        }
+        if (glad_glSampleCoverage && glad_glSampleCoverage != record_glSampleCoverage)
+        {
+            Table<>::loaded[ENTRY_glSampleCoverage] = (void*)glad_glSampleCoverage;
+            glad_glSampleCoverage = record_glSampleCoverage;
+        }
+        if (glad_glCompressedTexImage3D && glad_glCompressedTexImage3D != record_glCompressedTexImage3D)
+        {
+            Table<>::loaded[ENTRY_glCompressedTexImage3D] = (void*)glad_glCompressedTexImage3D;
+            glad_glCompressedTexImage3D = record_glCompressedTexImage3D;
+        }
+        if (glad_glCompressedTexImage2D && glad_glCompressedTexImage2D != record_glCompressedTexImage2D)
+        {
+            Table<>::loaded[ENTRY_glCompressedTexImage2D] = (void*)glad_glCompressedTexImage2D;
+            glad_glCompressedTexImage2D = record_glCompressedTexImage2D;
+        }
+        if (glad_glCompressedTexImage1D && glad_glCompressedTexImage1D != record_glCompressedTexImage1D)
+        {
+            Table<>::loaded[ENTRY_glCompressedTexImage1D] = (void*)glad_glCompressedTexImage1D;
+            glad_glCompressedTexImage1D = record_glCompressedTexImage1D;
+        }
+        if (glad_glCompressedTexSubImage3D && glad_glCompressedTexSubImage3D != record_glCompressedTexSubImage3D)
+        {
+            Table<>::loaded[ENTRY_glCompressedTexSubImage3D] = (void*)glad_glCompressedTexSubImage3D;
+            glad_glCompressedTexSubImage3D = record_glCompressedTexSubImage3D;
+        }
+        if (glad_glCompressedTexSubImage2D && glad_glCompressedTexSubImage2D != record_glCompressedTexSubImage2D)
+        {
+            Table<>::loaded[ENTRY_glCompressedTexSubImage2D] = (void*)glad_glCompressedTexSubImage2D;
+            glad_glCompressedTexSubImage2D = record_glCompressedTexSubImage2D;
+        }
+        if (glad_glCompressedTexSubImage1D && glad_glCompressedTexSubImage1D != record_glCompressedTexSubImage1D)
+        {
+            Table<>::loaded[ENTRY_glCompressedTexSubImage1D] = (void*)glad_glCompressedTexSubImage1D;
+            glad_glCompressedTexSubImage1D = record_glCompressedTexSubImage1D;
+        }
+        if (glad_glClientActiveTexture && glad_glClientActiveTexture != record_glClientActiveTexture)
+        {
+            Table<>::loaded[ENTRY_glClientActiveTexture] = (void*)glad_glClientActiveTexture;
+            glad_glClientActiveTexture = record_glClientActiveTexture;
+        }
+        if (glad_glMultiTexCoord1d && glad_glMultiTexCoord1d != record_glMultiTexCoord1d)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord1d] = (void*)glad_glMultiTexCoord1d;
+            glad_glMultiTexCoord1d = record_glMultiTexCoord1d;
+        }
+        if (glad_glMultiTexCoord1dv && glad_glMultiTexCoord1dv != record_glMultiTexCoord1dv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord1dv] = (void*)glad_glMultiTexCoord1dv;
+            glad_glMultiTexCoord1dv = record_glMultiTexCoord1dv;
+        }
+        if (glad_glMultiTexCoord1f && glad_glMultiTexCoord1f != record_glMultiTexCoord1f)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord1f] = (void*)glad_glMultiTexCoord1f;
+            glad_glMultiTexCoord1f = record_glMultiTexCoord1f;
+        }
+        if (glad_glMultiTexCoord1fv && glad_glMultiTexCoord1fv != record_glMultiTexCoord1fv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord1fv] = (void*)glad_glMultiTexCoord1fv;
+            glad_glMultiTexCoord1fv = record_glMultiTexCoord1fv;
+        }
+        if (glad_glMultiTexCoord1i && glad_glMultiTexCoord1i != record_glMultiTexCoord1i)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord1i] = (void*)glad_glMultiTexCoord1i;
+            glad_glMultiTexCoord1i = record_glMultiTexCoord1i;
+        }
+        if (glad_glMultiTexCoord1iv && glad_glMultiTexCoord1iv != record_glMultiTexCoord1iv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord1iv] = (void*)glad_glMultiTexCoord1iv;
+            glad_glMultiTexCoord1iv = record_glMultiTexCoord1iv;
+        }
+        if (glad_glMultiTexCoord1s && glad_glMultiTexCoord1s != record_glMultiTexCoord1s)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord1s] = (void*)glad_glMultiTexCoord1s;
+            glad_glMultiTexCoord1s = record_glMultiTexCoord1s;
+        }
+        if (glad_glMultiTexCoord1sv && glad_glMultiTexCoord1sv != record_glMultiTexCoord1sv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord1sv] = (void*)glad_glMultiTexCoord1sv;
+            glad_glMultiTexCoord1sv = record_glMultiTexCoord1sv;
+        }
+        if (glad_glMultiTexCoord2d && glad_glMultiTexCoord2d != record_glMultiTexCoord2d)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord2d] = (void*)glad_glMultiTexCoord2d;
+            glad_glMultiTexCoord2d = record_glMultiTexCoord2d;
+        }
+        if (glad_glMultiTexCoord2dv && glad_glMultiTexCoord2dv != record_glMultiTexCoord2dv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord2dv] = (void*)glad_glMultiTexCoord2dv;
+            glad_glMultiTexCoord2dv = record_glMultiTexCoord2dv;
+        }
+        if (glad_glMultiTexCoord2f && glad_glMultiTexCoord2f != record_glMultiTexCoord2f)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord2f] = (void*)glad_glMultiTexCoord2f;
+            glad_glMultiTexCoord2f = record_glMultiTexCoord2f;
+        }
+        if (glad_glMultiTexCoord2fv && glad_glMultiTexCoord2fv != record_glMultiTexCoord2fv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord2fv] = (void*)glad_glMultiTexCoord2fv;
+            glad_glMultiTexCoord2fv = record_glMultiTexCoord2fv;
+        }
+        if (glad_glMultiTexCoord2i && glad_glMultiTexCoord2i != record_glMultiTexCoord2i)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord2i] = (void*)glad_glMultiTexCoord2i;
+            glad_glMultiTexCoord2i = record_glMultiTexCoord2i;
+        }
+        if (glad_glMultiTexCoord2iv && glad_glMultiTexCoord2iv != record_glMultiTexCoord2iv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord2iv] = (void*)glad_glMultiTexCoord2iv;
+            glad_glMultiTexCoord2iv = record_glMultiTexCoord2iv;
+        }
+        if (glad_glMultiTexCoord2s && glad_glMultiTexCoord2s != record_glMultiTexCoord2s)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord2s] = (void*)glad_glMultiTexCoord2s;
+            glad_glMultiTexCoord2s = record_glMultiTexCoord2s;
+        }
+        if (glad_glMultiTexCoord2sv && glad_glMultiTexCoord2sv != record_glMultiTexCoord2sv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord2sv] = (void*)glad_glMultiTexCoord2sv;
+            glad_glMultiTexCoord2sv = record_glMultiTexCoord2sv;
+        }
+        if (glad_glMultiTexCoord3d && glad_glMultiTexCoord3d != record_glMultiTexCoord3d)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord3d] = (void*)glad_glMultiTexCoord3d;
+            glad_glMultiTexCoord3d = record_glMultiTexCoord3d;
+        }
+        if (glad_glMultiTexCoord3dv && glad_glMultiTexCoord3dv != record_glMultiTexCoord3dv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord3dv] = (void*)glad_glMultiTexCoord3dv;
+            glad_glMultiTexCoord3dv = record_glMultiTexCoord3dv;
+        }
+        if (glad_glMultiTexCoord3f && glad_glMultiTexCoord3f != record_glMultiTexCoord3f)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord3f] = (void*)glad_glMultiTexCoord3f;
+            glad_glMultiTexCoord3f = record_glMultiTexCoord3f;
+        }
+        if (glad_glMultiTexCoord3fv && glad_glMultiTexCoord3fv != record_glMultiTexCoord3fv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord3fv] = (void*)glad_glMultiTexCoord3fv;
+            glad_glMultiTexCoord3fv = record_glMultiTexCoord3fv;
+        }
+        if (glad_glMultiTexCoord3i && glad_glMultiTexCoord3i != record_glMultiTexCoord3i)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord3i] = (void*)glad_glMultiTexCoord3i;
+            glad_glMultiTexCoord3i = record_glMultiTexCoord3i;
+        }
+        if (glad_glMultiTexCoord3iv && glad_glMultiTexCoord3iv != record_glMultiTexCoord3iv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord3iv] = (void*)glad_glMultiTexCoord3iv;
+            glad_glMultiTexCoord3iv = record_glMultiTexCoord3iv;
+        }
+        if (glad_glMultiTexCoord3s && glad_glMultiTexCoord3s != record_glMultiTexCoord3s)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord3s] = (void*)glad_glMultiTexCoord3s;
+            glad_glMultiTexCoord3s = record_glMultiTexCoord3s;
+        }
+        if (glad_glMultiTexCoord3sv && glad_glMultiTexCoord3sv != record_glMultiTexCoord3sv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord3sv] = (void*)glad_glMultiTexCoord3sv;
+            glad_glMultiTexCoord3sv = record_glMultiTexCoord3sv;
+        }
+        if (glad_glMultiTexCoord4d && glad_glMultiTexCoord4d != record_glMultiTexCoord4d)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord4d] = (void*)glad_glMultiTexCoord4d;
+            glad_glMultiTexCoord4d = record_glMultiTexCoord4d;
+        }
+        if (glad_glMultiTexCoord4dv && glad_glMultiTexCoord4dv != record_glMultiTexCoord4dv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord4dv] = (void*)glad_glMultiTexCoord4dv;
+            glad_glMultiTexCoord4dv = record_glMultiTexCoord4dv;
+        }
+        if (glad_glMultiTexCoord4f && glad_glMultiTexCoord4f != record_glMultiTexCoord4f)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord4f] = (void*)glad_glMultiTexCoord4f;
+            glad_glMultiTexCoord4f = record_glMultiTexCoord4f;
+        }
+        if (glad_glMultiTexCoord4fv && glad_glMultiTexCoord4fv != record_glMultiTexCoord4fv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord4fv] = (void*)glad_glMultiTexCoord4fv;
+            glad_glMultiTexCoord4fv = record_glMultiTexCoord4fv;
+        }
+        if (glad_glMultiTexCoord4i && glad_glMultiTexCoord4i != record_glMultiTexCoord4i)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord4i] = (void*)glad_glMultiTexCoord4i;
+            glad_glMultiTexCoord4i = record_glMultiTexCoord4i;
+        }
+        if (glad_glMultiTexCoord4iv && glad_glMultiTexCoord4iv != record_glMultiTexCoord4iv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord4iv] = (void*)glad_glMultiTexCoord4iv;
+            glad_glMultiTexCoord4iv = record_glMultiTexCoord4iv;
+        }
+        if (glad_glMultiTexCoord4s && glad_glMultiTexCoord4s != record_glMultiTexCoord4s)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord4s] = (void*)glad_glMultiTexCoord4s;
+            glad_glMultiTexCoord4s = record_glMultiTexCoord4s;
+        }
+        if (glad_glMultiTexCoord4sv && glad_glMultiTexCoord4sv != record_glMultiTexCoord4sv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoord4sv] = (void*)glad_glMultiTexCoord4sv;
+            glad_glMultiTexCoord4sv = record_glMultiTexCoord4sv;
+        }
+        if (glad_glLoadTransposeMatrixf && glad_glLoadTransposeMatrixf != record_glLoadTransposeMatrixf)
+        {
+            Table<>::loaded[ENTRY_glLoadTransposeMatrixf] = (void*)glad_glLoadTransposeMatrixf;
+            glad_glLoadTransposeMatrixf = record_glLoadTransposeMatrixf;
+        }
+        if (glad_glLoadTransposeMatrixd && glad_glLoadTransposeMatrixd != record_glLoadTransposeMatrixd)
+        {
+            Table<>::loaded[ENTRY_glLoadTransposeMatrixd] = (void*)glad_glLoadTransposeMatrixd;
+            glad_glLoadTransposeMatrixd = record_glLoadTransposeMatrixd;
+        }
+        if (glad_glMultTransposeMatrixf && glad_glMultTransposeMatrixf != record_glMultTransposeMatrixf)
+        {
+            Table<>::loaded[ENTRY_glMultTransposeMatrixf] = (void*)glad_glMultTransposeMatrixf;
+            glad_glMultTransposeMatrixf = record_glMultTransposeMatrixf;
+        }
+        if (glad_glMultTransposeMatrixd && glad_glMultTransposeMatrixd != record_glMultTransposeMatrixd)
+        {
+            Table<>::loaded[ENTRY_glMultTransposeMatrixd] = (void*)glad_glMultTransposeMatrixd;
+            glad_glMultTransposeMatrixd = record_glMultTransposeMatrixd;
+        }
+        if (glad_glBlendFuncSeparate && glad_glBlendFuncSeparate != record_glBlendFuncSeparate)
+        {
+            Table<>::loaded[ENTRY_glBlendFuncSeparate] = (void*)glad_glBlendFuncSeparate;
+            glad_glBlendFuncSeparate = record_glBlendFuncSeparate;
+        }
+        if (glad_glMultiDrawArrays && glad_glMultiDrawArrays != record_glMultiDrawArrays)
+        {
+            Table<>::loaded[ENTRY_glMultiDrawArrays] = (void*)glad_glMultiDrawArrays;
+            glad_glMultiDrawArrays = record_glMultiDrawArrays;
+        }
+        if (glad_glMultiDrawElements && glad_glMultiDrawElements != record_glMultiDrawElements)
+        {
+            Table<>::loaded[ENTRY_glMultiDrawElements] = (void*)glad_glMultiDrawElements;
+            glad_glMultiDrawElements = record_glMultiDrawElements;
+        }
+        if (glad_glPointParameterf && glad_glPointParameterf != record_glPointParameterf)
+        {
+            Table<>::loaded[ENTRY_glPointParameterf] = (void*)glad_glPointParameterf;
+            glad_glPointParameterf = record_glPointParameterf;
+        }
+        if (glad_glPointParameterfv && glad_glPointParameterfv != record_glPointParameterfv)
+        {
+            Table<>::loaded[ENTRY_glPointParameterfv] = (void*)glad_glPointParameterfv;
+            glad_glPointParameterfv = record_glPointParameterfv;
+        }
+        if (glad_glPointParameteri && glad_glPointParameteri != record_glPointParameteri)
+        {
+            Table<>::loaded[ENTRY_glPointParameteri] = (void*)glad_glPointParameteri;
+            glad_glPointParameteri = record_glPointParameteri;
+        }
+        if (glad_glPointParameteriv && glad_glPointParameteriv != record_glPointParameteriv)
+        {
+            Table<>::loaded[ENTRY_glPointParameteriv] = (void*)glad_glPointParameteriv;
+            glad_glPointParameteriv = record_glPointParameteriv;
+        }
+        if (glad_glFogCoordf && glad_glFogCoordf != record_glFogCoordf)
+        {
+            Table<>::loaded[ENTRY_glFogCoordf] = (void*)glad_glFogCoordf;
+            glad_glFogCoordf = record_glFogCoordf;
+        }
+        if (glad_glFogCoordfv && glad_glFogCoordfv != record_glFogCoordfv)
+        {
+            Table<>::loaded[ENTRY_glFogCoordfv] = (void*)glad_glFogCoordfv;
+            glad_glFogCoordfv = record_glFogCoordfv;
+        }
+        if (glad_glFogCoordd && glad_glFogCoordd != record_glFogCoordd)
+        {
+            Table<>::loaded[ENTRY_glFogCoordd] = (void*)glad_glFogCoordd;
+            glad_glFogCoordd = record_glFogCoordd;
+        }
+        if (glad_glFogCoorddv && glad_glFogCoorddv != record_glFogCoorddv)
+        {
+            Table<>::loaded[ENTRY_glFogCoorddv] = (void*)glad_glFogCoorddv;
+            glad_glFogCoorddv = record_glFogCoorddv;
+        }
+        if (glad_glFogCoordPointer && glad_glFogCoordPointer != record_glFogCoordPointer)
+        {
+            Table<>::loaded[ENTRY_glFogCoordPointer] = (void*)glad_glFogCoordPointer;
+            glad_glFogCoordPointer = record_glFogCoordPointer;
+        }
+        if (glad_glSecondaryColor3b && glad_glSecondaryColor3b != record_glSecondaryColor3b)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3b] = (void*)glad_glSecondaryColor3b;
+            glad_glSecondaryColor3b = record_glSecondaryColor3b;
+        }
+        if (glad_glSecondaryColor3bv && glad_glSecondaryColor3bv != record_glSecondaryColor3bv)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3bv] = (void*)glad_glSecondaryColor3bv;
+            glad_glSecondaryColor3bv = record_glSecondaryColor3bv;
+        }
+        if (glad_glSecondaryColor3d && glad_glSecondaryColor3d != record_glSecondaryColor3d)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3d] = (void*)glad_glSecondaryColor3d;
+            glad_glSecondaryColor3d = record_glSecondaryColor3d;
+        }
+        if (glad_glSecondaryColor3dv && glad_glSecondaryColor3dv != record_glSecondaryColor3dv)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3dv] = (void*)glad_glSecondaryColor3dv;
+            glad_glSecondaryColor3dv = record_glSecondaryColor3dv;
+        }
+        if (glad_glSecondaryColor3f && glad_glSecondaryColor3f != record_glSecondaryColor3f)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3f] = (void*)glad_glSecondaryColor3f;
+            glad_glSecondaryColor3f = record_glSecondaryColor3f;
+        }
+        if (glad_glSecondaryColor3fv && glad_glSecondaryColor3fv != record_glSecondaryColor3fv)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3fv] = (void*)glad_glSecondaryColor3fv;
+            glad_glSecondaryColor3fv = record_glSecondaryColor3fv;
+        }
+        if (glad_glSecondaryColor3i && glad_glSecondaryColor3i != record_glSecondaryColor3i)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3i] = (void*)glad_glSecondaryColor3i;
+            glad_glSecondaryColor3i = record_glSecondaryColor3i;
+        }
+        if (glad_glSecondaryColor3iv && glad_glSecondaryColor3iv != record_glSecondaryColor3iv)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3iv] = (void*)glad_glSecondaryColor3iv;
+            glad_glSecondaryColor3iv = record_glSecondaryColor3iv;
+        }
+        if (glad_glSecondaryColor3s && glad_glSecondaryColor3s != record_glSecondaryColor3s)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3s] = (void*)glad_glSecondaryColor3s;
+            glad_glSecondaryColor3s = record_glSecondaryColor3s;
+        }
+        if (glad_glSecondaryColor3sv && glad_glSecondaryColor3sv != record_glSecondaryColor3sv)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3sv] = (void*)glad_glSecondaryColor3sv;
+            glad_glSecondaryColor3sv = record_glSecondaryColor3sv;
+        }
+        if (glad_glSecondaryColor3ub && glad_glSecondaryColor3ub != record_glSecondaryColor3ub)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3ub] = (void*)glad_glSecondaryColor3ub;
+            glad_glSecondaryColor3ub = record_glSecondaryColor3ub;
+        }
+        if (glad_glSecondaryColor3ubv && glad_glSecondaryColor3ubv != record_glSecondaryColor3ubv)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3ubv] = (void*)glad_glSecondaryColor3ubv;
+            glad_glSecondaryColor3ubv = record_glSecondaryColor3ubv;
+        }
+        if (glad_glSecondaryColor3ui && glad_glSecondaryColor3ui != record_glSecondaryColor3ui)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3ui] = (void*)glad_glSecondaryColor3ui;
+            glad_glSecondaryColor3ui = record_glSecondaryColor3ui;
+        }
+        if (glad_glSecondaryColor3uiv && glad_glSecondaryColor3uiv != record_glSecondaryColor3uiv)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3uiv] = (void*)glad_glSecondaryColor3uiv;
+            glad_glSecondaryColor3uiv = record_glSecondaryColor3uiv;
+        }
+        if (glad_glSecondaryColor3us && glad_glSecondaryColor3us != record_glSecondaryColor3us)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3us] = (void*)glad_glSecondaryColor3us;
+            glad_glSecondaryColor3us = record_glSecondaryColor3us;
+        }
+        if (glad_glSecondaryColor3usv && glad_glSecondaryColor3usv != record_glSecondaryColor3usv)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColor3usv] = (void*)glad_glSecondaryColor3usv;
+            glad_glSecondaryColor3usv = record_glSecondaryColor3usv;
+        }
+        if (glad_glSecondaryColorPointer && glad_glSecondaryColorPointer != record_glSecondaryColorPointer)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColorPointer] = (void*)glad_glSecondaryColorPointer;
+            glad_glSecondaryColorPointer = record_glSecondaryColorPointer;
+        }
+        if (glad_glWindowPos2d && glad_glWindowPos2d != record_glWindowPos2d)
+        {
+            Table<>::loaded[ENTRY_glWindowPos2d] = (void*)glad_glWindowPos2d;
+            glad_glWindowPos2d = record_glWindowPos2d;
+        }
+        if (glad_glWindowPos2dv && glad_glWindowPos2dv != record_glWindowPos2dv)
+        {
+            Table<>::loaded[ENTRY_glWindowPos2dv] = (void*)glad_glWindowPos2dv;
+            glad_glWindowPos2dv = record_glWindowPos2dv;
+        }
+        if (glad_glWindowPos2f && glad_glWindowPos2f != record_glWindowPos2f)
+        {
+            Table<>::loaded[ENTRY_glWindowPos2f] = (void*)glad_glWindowPos2f;
+            glad_glWindowPos2f = record_glWindowPos2f;
+        }
+        if (glad_glWindowPos2fv && glad_glWindowPos2fv != record_glWindowPos2fv)
+        {
+            Table<>::loaded[ENTRY_glWindowPos2fv] = (void*)glad_glWindowPos2fv;
+            glad_glWindowPos2fv = record_glWindowPos2fv;
+        }
+        if (glad_glWindowPos2i && glad_glWindowPos2i != record_glWindowPos2i)
+        {
+            Table<>::loaded[ENTRY_glWindowPos2i] = (void*)glad_glWindowPos2i;
+            glad_glWindowPos2i = record_glWindowPos2i;
+        }
+        if (glad_glWindowPos2iv && glad_glWindowPos2iv != record_glWindowPos2iv)
+        {
+            Table<>::loaded[ENTRY_glWindowPos2iv] = (void*)glad_glWindowPos2iv;
+            glad_glWindowPos2iv = record_glWindowPos2iv;
+        }
+        if (glad_glWindowPos2s && glad_glWindowPos2s != record_glWindowPos2s)
+        {
+            Table<>::loaded[ENTRY_glWindowPos2s] = (void*)glad_glWindowPos2s;
+            glad_glWindowPos2s = record_glWindowPos2s;
+        }
+        if (glad_glWindowPos2sv && glad_glWindowPos2sv != record_glWindowPos2sv)
+        {
+            Table<>::loaded[ENTRY_glWindowPos2sv] = (void*)glad_glWindowPos2sv;
+            glad_glWindowPos2sv = record_glWindowPos2sv;
+        }
+        if (glad_glWindowPos3d && glad_glWindowPos3d != record_glWindowPos3d)
+        {
+            Table<>::loaded[ENTRY_glWindowPos3d] = (void*)glad_glWindowPos3d;
+            glad_glWindowPos3d = record_glWindowPos3d;
+        }
+        if (glad_glWindowPos3dv && glad_glWindowPos3dv != record_glWindowPos3dv)
+        {
+            Table<>::loaded[ENTRY_glWindowPos3dv] = (void*)glad_glWindowPos3dv;
+            glad_glWindowPos3dv = record_glWindowPos3dv;
+        }
+        if (glad_glWindowPos3f && glad_glWindowPos3f != record_glWindowPos3f)
+        {
+            Table<>::loaded[ENTRY_glWindowPos3f] = (void*)glad_glWindowPos3f;
+            glad_glWindowPos3f = record_glWindowPos3f;
+        }
+        if (glad_glWindowPos3fv && glad_glWindowPos3fv != record_glWindowPos3fv)
+        {
+            Table<>::loaded[ENTRY_glWindowPos3fv] = (void*)glad_glWindowPos3fv;
+            glad_glWindowPos3fv = record_glWindowPos3fv;
+        }
+        if (glad_glWindowPos3i && glad_glWindowPos3i != record_glWindowPos3i)
+        {
+            Table<>::loaded[ENTRY_glWindowPos3i] = (void*)glad_glWindowPos3i;
+            glad_glWindowPos3i = record_glWindowPos3i;
+        }
+        if (glad_glWindowPos3iv && glad_glWindowPos3iv != record_glWindowPos3iv)
+        {
+            Table<>::loaded[ENTRY_glWindowPos3iv] = (void*)glad_glWindowPos3iv;
+            glad_glWindowPos3iv = record_glWindowPos3iv;
+        }
+        if (glad_glWindowPos3s && glad_glWindowPos3s != record_glWindowPos3s)
+        {
+            Table<>::loaded[ENTRY_glWindowPos3s] = (void*)glad_glWindowPos3s;
+            glad_glWindowPos3s = record_glWindowPos3s;
+        }
+        if (glad_glWindowPos3sv && glad_glWindowPos3sv != record_glWindowPos3sv)
+        {
+            Table<>::loaded[ENTRY_glWindowPos3sv] = (void*)glad_glWindowPos3sv;
+            glad_glWindowPos3sv = record_glWindowPos3sv;
+        }
+        if (glad_glBlendColor && glad_glBlendColor != record_glBlendColor)
+        {
+            Table<>::loaded[ENTRY_glBlendColor] = (void*)glad_glBlendColor;
+            glad_glBlendColor = record_glBlendColor;
+        }
+        if (glad_glBlendEquation && glad_glBlendEquation != record_glBlendEquation)
+        {
+            Table<>::loaded[ENTRY_glBlendEquation] = (void*)glad_glBlendEquation;
+            glad_glBlendEquation = record_glBlendEquation;
+        }
+        if (glad_glGenQueries && glad_glGenQueries != record_glGenQueries)
+        {
+            Table<>::loaded[ENTRY_glGenQueries] = (void*)glad_glGenQueries;
+            glad_glGenQueries = record_glGenQueries;
+        }
+        if (glad_glDeleteQueries && glad_glDeleteQueries != record_glDeleteQueries)
+        {
+            Table<>::loaded[ENTRY_glDeleteQueries] = (void*)glad_glDeleteQueries;
+            glad_glDeleteQueries = record_glDeleteQueries;
+        }
+        if (glad_glBeginQuery && glad_glBeginQuery != record_glBeginQuery)
+        {
+            Table<>::loaded[ENTRY_glBeginQuery] = (void*)glad_glBeginQuery;
+            glad_glBeginQuery = record_glBeginQuery;
+        }
+        if (glad_glEndQuery && glad_glEndQuery != record_glEndQuery)
+        {
+            Table<>::loaded[ENTRY_glEndQuery] = (void*)glad_glEndQuery;
+            glad_glEndQuery = record_glEndQuery;
+        }
+        if (glad_glBindBuffer && glad_glBindBuffer != record_glBindBuffer)
+        {
+            Table<>::loaded[ENTRY_glBindBuffer] = (void*)glad_glBindBuffer;
+            glad_glBindBuffer = record_glBindBuffer;
+        }
+        if (glad_glDeleteBuffers && glad_glDeleteBuffers != record_glDeleteBuffers)
+        {
+            Table<>::loaded[ENTRY_glDeleteBuffers] = (void*)glad_glDeleteBuffers;
+            glad_glDeleteBuffers = record_glDeleteBuffers;
+        }
+        if (glad_glGenBuffers && glad_glGenBuffers != record_glGenBuffers)
+        {
+            Table<>::loaded[ENTRY_glGenBuffers] = (void*)glad_glGenBuffers;
+            glad_glGenBuffers = record_glGenBuffers;
+        }
+        if (glad_glBufferData && glad_glBufferData != record_glBufferData)
+        {
+            Table<>::loaded[ENTRY_glBufferData] = (void*)glad_glBufferData;
+            glad_glBufferData = record_glBufferData;
+        }
+        if (glad_glBufferSubData && glad_glBufferSubData != record_glBufferSubData)
+        {
+            Table<>::loaded[ENTRY_glBufferSubData] = (void*)glad_glBufferSubData;
+            glad_glBufferSubData = record_glBufferSubData;
+        }
+        if (glad_glMapBuffer && glad_glMapBuffer != record_glMapBuffer)
+        {
+            Table<>::loaded[ENTRY_glMapBuffer] = (void*)glad_glMapBuffer;
+            glad_glMapBuffer = record_glMapBuffer;
+        }
+        if (glad_glUnmapBuffer && glad_glUnmapBuffer != record_glUnmapBuffer)
+        {
+            Table<>::loaded[ENTRY_glUnmapBuffer] = (void*)glad_glUnmapBuffer;
+            glad_glUnmapBuffer = record_glUnmapBuffer;
+        }
+        if (glad_glBlendEquationSeparate && glad_glBlendEquationSeparate != record_glBlendEquationSeparate)
+        {
+            Table<>::loaded[ENTRY_glBlendEquationSeparate] = (void*)glad_glBlendEquationSeparate;
+            glad_glBlendEquationSeparate = record_glBlendEquationSeparate;
+        }
+        if (glad_glDrawBuffers && glad_glDrawBuffers != record_glDrawBuffers)
+        {
+            Table<>::loaded[ENTRY_glDrawBuffers] = (void*)glad_glDrawBuffers;
+            glad_glDrawBuffers = record_glDrawBuffers;
+        }
+        if (glad_glStencilOpSeparate && glad_glStencilOpSeparate != record_glStencilOpSeparate)
+        {
+            Table<>::loaded[ENTRY_glStencilOpSeparate] = (void*)glad_glStencilOpSeparate;
+            glad_glStencilOpSeparate = record_glStencilOpSeparate;
+        }
+        if (glad_glStencilFuncSeparate && glad_glStencilFuncSeparate != record_glStencilFuncSeparate)
+        {
+            Table<>::loaded[ENTRY_glStencilFuncSeparate] = (void*)glad_glStencilFuncSeparate;
+            glad_glStencilFuncSeparate = record_glStencilFuncSeparate;
+        }
+        if (glad_glStencilMaskSeparate && glad_glStencilMaskSeparate != record_glStencilMaskSeparate)
+        {
+            Table<>::loaded[ENTRY_glStencilMaskSeparate] = (void*)glad_glStencilMaskSeparate;
+            glad_glStencilMaskSeparate = record_glStencilMaskSeparate;
+        }
+        if (glad_glAttachShader && glad_glAttachShader != record_glAttachShader)
+        {
+            Table<>::loaded[ENTRY_glAttachShader] = (void*)glad_glAttachShader;
+            glad_glAttachShader = record_glAttachShader;
+        }
+        if (glad_glBindAttribLocation && glad_glBindAttribLocation != record_glBindAttribLocation)
+        {
+            Table<>::loaded[ENTRY_glBindAttribLocation] = (void*)glad_glBindAttribLocation;
+            glad_glBindAttribLocation = record_glBindAttribLocation;
+        }
+        if (glad_glCompileShader && glad_glCompileShader != record_glCompileShader)
+        {
+            Table<>::loaded[ENTRY_glCompileShader] = (void*)glad_glCompileShader;
+            glad_glCompileShader = record_glCompileShader;
+        }
+        if (glad_glCreateProgram && glad_glCreateProgram != record_glCreateProgram)
+        {
+            Table<>::loaded[ENTRY_glCreateProgram] = (void*)glad_glCreateProgram;
+            glad_glCreateProgram = record_glCreateProgram;
+        }
+        if (glad_glCreateShader && glad_glCreateShader != record_glCreateShader)
+        {
+            Table<>::loaded[ENTRY_glCreateShader] = (void*)glad_glCreateShader;
+            glad_glCreateShader = record_glCreateShader;
+        }
+        if (glad_glDeleteProgram && glad_glDeleteProgram != record_glDeleteProgram)
+        {
+            Table<>::loaded[ENTRY_glDeleteProgram] = (void*)glad_glDeleteProgram;
+            glad_glDeleteProgram = record_glDeleteProgram;
+        }
+        if (glad_glDeleteShader && glad_glDeleteShader != record_glDeleteShader)
+        {
+            Table<>::loaded[ENTRY_glDeleteShader] = (void*)glad_glDeleteShader;
+            glad_glDeleteShader = record_glDeleteShader;
+        }
+        if (glad_glDetachShader && glad_glDetachShader != record_glDetachShader)
+        {
+            Table<>::loaded[ENTRY_glDetachShader] = (void*)glad_glDetachShader;
+            glad_glDetachShader = record_glDetachShader;
+        }
+        if (glad_glDisableVertexAttribArray && glad_glDisableVertexAttribArray != record_glDisableVertexAttribArray)
+        {
+            Table<>::loaded[ENTRY_glDisableVertexAttribArray] = (void*)glad_glDisableVertexAttribArray;
+            glad_glDisableVertexAttribArray = record_glDisableVertexAttribArray;
+        }
+        if (glad_glEnableVertexAttribArray && glad_glEnableVertexAttribArray != record_glEnableVertexAttribArray)
+        {
+            Table<>::loaded[ENTRY_glEnableVertexAttribArray] = (void*)glad_glEnableVertexAttribArray;
+            glad_glEnableVertexAttribArray = record_glEnableVertexAttribArray;
+        }
+        if (glad_glGetUniformLocation && glad_glGetUniformLocation != record_glGetUniformLocation)
+        {
+            Table<>::loaded[ENTRY_glGetUniformLocation] = (void*)glad_glGetUniformLocation;
+            glad_glGetUniformLocation = record_glGetUniformLocation;
+        }
+        if (glad_glLinkProgram && glad_glLinkProgram != record_glLinkProgram)
+        {
+            Table<>::loaded[ENTRY_glLinkProgram] = (void*)glad_glLinkProgram;
+            glad_glLinkProgram = record_glLinkProgram;
+        }
+        if (glad_glShaderSource && glad_glShaderSource != record_glShaderSource)
+        {
+            Table<>::loaded[ENTRY_glShaderSource] = (void*)glad_glShaderSource;
+            glad_glShaderSource = record_glShaderSource;
+        }
+        if (glad_glUseProgram && glad_glUseProgram != record_glUseProgram)
+        {
+            Table<>::loaded[ENTRY_glUseProgram] = (void*)glad_glUseProgram;
+            glad_glUseProgram = record_glUseProgram;
+        }
+        if (glad_glUniform1f && glad_glUniform1f != record_glUniform1f)
+        {
+            Table<>::loaded[ENTRY_glUniform1f] = (void*)glad_glUniform1f;
+            glad_glUniform1f = record_glUniform1f;
+        }
+        if (glad_glUniform2f && glad_glUniform2f != record_glUniform2f)
+        {
+            Table<>::loaded[ENTRY_glUniform2f] = (void*)glad_glUniform2f;
+            glad_glUniform2f = record_glUniform2f;
+        }
+        if (glad_glUniform3f && glad_glUniform3f != record_glUniform3f)
+        {
+            Table<>::loaded[ENTRY_glUniform3f] = (void*)glad_glUniform3f;
+            glad_glUniform3f = record_glUniform3f;
+        }
+        if (glad_glUniform4f && glad_glUniform4f != record_glUniform4f)
+        {
+            Table<>::loaded[ENTRY_glUniform4f] = (void*)glad_glUniform4f;
+            glad_glUniform4f = record_glUniform4f;
+        }
+        if (glad_glUniform1i && glad_glUniform1i != record_glUniform1i)
+        {
+            Table<>::loaded[ENTRY_glUniform1i] = (void*)glad_glUniform1i;
+            glad_glUniform1i = record_glUniform1i;
+        }
+        if (glad_glUniform2i && glad_glUniform2i != record_glUniform2i)
+        {
+            Table<>::loaded[ENTRY_glUniform2i] = (void*)glad_glUniform2i;
+            glad_glUniform2i = record_glUniform2i;
+        }
+        if (glad_glUniform3i && glad_glUniform3i != record_glUniform3i)
+        {
+            Table<>::loaded[ENTRY_glUniform3i] = (void*)glad_glUniform3i;
+            glad_glUniform3i = record_glUniform3i;
+        }
+        if (glad_glUniform4i && glad_glUniform4i != record_glUniform4i)
+        {
+            Table<>::loaded[ENTRY_glUniform4i] = (void*)glad_glUniform4i;
+            glad_glUniform4i = record_glUniform4i;
+        }
+        if (glad_glUniform1fv && glad_glUniform1fv != record_glUniform1fv)
+        {
+            Table<>::loaded[ENTRY_glUniform1fv] = (void*)glad_glUniform1fv;
+            glad_glUniform1fv = record_glUniform1fv;
+        }
+        if (glad_glUniform2fv && glad_glUniform2fv != record_glUniform2fv)
+        {
+            Table<>::loaded[ENTRY_glUniform2fv] = (void*)glad_glUniform2fv;
+            glad_glUniform2fv = record_glUniform2fv;
+        }
+        if (glad_glUniform3fv && glad_glUniform3fv != record_glUniform3fv)
+        {
+            Table<>::loaded[ENTRY_glUniform3fv] = (void*)glad_glUniform3fv;
+            glad_glUniform3fv = record_glUniform3fv;
+        }
+        if (glad_glUniform4fv && glad_glUniform4fv != record_glUniform4fv)
+        {
+            Table<>::loaded[ENTRY_glUniform4fv] = (void*)glad_glUniform4fv;
+            glad_glUniform4fv = record_glUniform4fv;
+        }
+        if (glad_glUniform1iv && glad_glUniform1iv != record_glUniform1iv)
+        {
+            Table<>::loaded[ENTRY_glUniform1iv] = (void*)glad_glUniform1iv;
+            glad_glUniform1iv = record_glUniform1iv;
+        }
+        if (glad_glUniform2iv && glad_glUniform2iv != record_glUniform2iv)
+        {
+            Table<>::loaded[ENTRY_glUniform2iv] = (void*)glad_glUniform2iv;
+            glad_glUniform2iv = record_glUniform2iv;
+        }
+        if (glad_glUniform3iv && glad_glUniform3iv != record_glUniform3iv)
+        {
+            Table<>::loaded[ENTRY_glUniform3iv] = (void*)glad_glUniform3iv;
+            glad_glUniform3iv = record_glUniform3iv;
+        }
+        if (glad_glUniform4iv && glad_glUniform4iv != record_glUniform4iv)
+        {
+            Table<>::loaded[ENTRY_glUniform4iv] = (void*)glad_glUniform4iv;
+            glad_glUniform4iv = record_glUniform4iv;
+        }
+        if (glad_glUniformMatrix2fv && glad_glUniformMatrix2fv != record_glUniformMatrix2fv)
+        {
+            Table<>::loaded[ENTRY_glUniformMatrix2fv] = (void*)glad_glUniformMatrix2fv;
+            glad_glUniformMatrix2fv = record_glUniformMatrix2fv;
+        }
+        if (glad_glUniformMatrix3fv && glad_glUniformMatrix3fv != record_glUniformMatrix3fv)
+        {
+            Table<>::loaded[ENTRY_glUniformMatrix3fv] = (void*)glad_glUniformMatrix3fv;
+            glad_glUniformMatrix3fv = record_glUniformMatrix3fv;
+        }
+        if (glad_glUniformMatrix4fv && glad_glUniformMatrix4fv != record_glUniformMatrix4fv)
+        {
+            Table<>::loaded[ENTRY_glUniformMatrix4fv] = (void*)glad_glUniformMatrix4fv;
+            glad_glUniformMatrix4fv = record_glUniformMatrix4fv;
+        }
+        if (glad_glValidateProgram && glad_glValidateProgram != record_glValidateProgram)
+        {
+            Table<>::loaded[ENTRY_glValidateProgram] = (void*)glad_glValidateProgram;
+            glad_glValidateProgram = record_glValidateProgram;
+        }
+        if (glad_glVertexAttrib1d && glad_glVertexAttrib1d != record_glVertexAttrib1d)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib1d] = (void*)glad_glVertexAttrib1d;
+            glad_glVertexAttrib1d = record_glVertexAttrib1d;
+        }
+        if (glad_glVertexAttrib1dv && glad_glVertexAttrib1dv != record_glVertexAttrib1dv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib1dv] = (void*)glad_glVertexAttrib1dv;
+            glad_glVertexAttrib1dv = record_glVertexAttrib1dv;
+        }
+        if (glad_glVertexAttrib1f && glad_glVertexAttrib1f != record_glVertexAttrib1f)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib1f] = (void*)glad_glVertexAttrib1f;
+            glad_glVertexAttrib1f = record_glVertexAttrib1f;
+        }
+        if (glad_glVertexAttrib1fv && glad_glVertexAttrib1fv != record_glVertexAttrib1fv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib1fv] = (void*)glad_glVertexAttrib1fv;
+            glad_glVertexAttrib1fv = record_glVertexAttrib1fv;
+        }
+        if (glad_glVertexAttrib1s && glad_glVertexAttrib1s != record_glVertexAttrib1s)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib1s] = (void*)glad_glVertexAttrib1s;
+            glad_glVertexAttrib1s = record_glVertexAttrib1s;
+        }
+        if (glad_glVertexAttrib1sv && glad_glVertexAttrib1sv != record_glVertexAttrib1sv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib1sv] = (void*)glad_glVertexAttrib1sv;
+            glad_glVertexAttrib1sv = record_glVertexAttrib1sv;
+        }
+        if (glad_glVertexAttrib2d && glad_glVertexAttrib2d != record_glVertexAttrib2d)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib2d] = (void*)glad_glVertexAttrib2d;
+            glad_glVertexAttrib2d = record_glVertexAttrib2d;
+        }
+        if (glad_glVertexAttrib2dv && glad_glVertexAttrib2dv != record_glVertexAttrib2dv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib2dv] = (void*)glad_glVertexAttrib2dv;
+            glad_glVertexAttrib2dv = record_glVertexAttrib2dv;
+        }
+        if (glad_glVertexAttrib2f && glad_glVertexAttrib2f != record_glVertexAttrib2f)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib2f] = (void*)glad_glVertexAttrib2f;
+            glad_glVertexAttrib2f = record_glVertexAttrib2f;
+        }
+        if (glad_glVertexAttrib2fv && glad_glVertexAttrib2fv != record_glVertexAttrib2fv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib2fv] = (void*)glad_glVertexAttrib2fv;
+            glad_glVertexAttrib2fv = record_glVertexAttrib2fv;
+        }
+        if (glad_glVertexAttrib2s && glad_glVertexAttrib2s != record_glVertexAttrib2s)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib2s] = (void*)glad_glVertexAttrib2s;
+            glad_glVertexAttrib2s = record_glVertexAttrib2s;
+        }
+        if (glad_glVertexAttrib2sv && glad_glVertexAttrib2sv != record_glVertexAttrib2sv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib2sv] = (void*)glad_glVertexAttrib2sv;
+            glad_glVertexAttrib2sv = record_glVertexAttrib2sv;
+        }
+        if (glad_glVertexAttrib3d && glad_glVertexAttrib3d != record_glVertexAttrib3d)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib3d] = (void*)glad_glVertexAttrib3d;
+            glad_glVertexAttrib3d = record_glVertexAttrib3d;
+        }
+        if (glad_glVertexAttrib3dv && glad_glVertexAttrib3dv != record_glVertexAttrib3dv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib3dv] = (void*)glad_glVertexAttrib3dv;
+            glad_glVertexAttrib3dv = record_glVertexAttrib3dv;
+        }
+        if (glad_glVertexAttrib3f && glad_glVertexAttrib3f != record_glVertexAttrib3f)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib3f] = (void*)glad_glVertexAttrib3f;
+            glad_glVertexAttrib3f = record_glVertexAttrib3f;
+        }
+        if (glad_glVertexAttrib3fv && glad_glVertexAttrib3fv != record_glVertexAttrib3fv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib3fv] = (void*)glad_glVertexAttrib3fv;
+            glad_glVertexAttrib3fv = record_glVertexAttrib3fv;
+        }
+        if (glad_glVertexAttrib3s && glad_glVertexAttrib3s != record_glVertexAttrib3s)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib3s] = (void*)glad_glVertexAttrib3s;
+            glad_glVertexAttrib3s = record_glVertexAttrib3s;
+        }
+        if (glad_glVertexAttrib3sv && glad_glVertexAttrib3sv != record_glVertexAttrib3sv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib3sv] = (void*)glad_glVertexAttrib3sv;
+            glad_glVertexAttrib3sv = record_glVertexAttrib3sv;
+        }
+        if (glad_glVertexAttrib4Nbv && glad_glVertexAttrib4Nbv != record_glVertexAttrib4Nbv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4Nbv] = (void*)glad_glVertexAttrib4Nbv;
+            glad_glVertexAttrib4Nbv = record_glVertexAttrib4Nbv;
+        }
+        if (glad_glVertexAttrib4Niv && glad_glVertexAttrib4Niv != record_glVertexAttrib4Niv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4Niv] = (void*)glad_glVertexAttrib4Niv;
+            glad_glVertexAttrib4Niv = record_glVertexAttrib4Niv;
+        }
+        if (glad_glVertexAttrib4Nsv && glad_glVertexAttrib4Nsv != record_glVertexAttrib4Nsv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4Nsv] = (void*)glad_glVertexAttrib4Nsv;
+            glad_glVertexAttrib4Nsv = record_glVertexAttrib4Nsv;
+        }
+        if (glad_glVertexAttrib4Nub && glad_glVertexAttrib4Nub != record_glVertexAttrib4Nub)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4Nub] = (void*)glad_glVertexAttrib4Nub;
+            glad_glVertexAttrib4Nub = record_glVertexAttrib4Nub;
+        }
+        if (glad_glVertexAttrib4Nubv && glad_glVertexAttrib4Nubv != record_glVertexAttrib4Nubv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4Nubv] = (void*)glad_glVertexAttrib4Nubv;
+            glad_glVertexAttrib4Nubv = record_glVertexAttrib4Nubv;
+        }
+        if (glad_glVertexAttrib4Nuiv && glad_glVertexAttrib4Nuiv != record_glVertexAttrib4Nuiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4Nuiv] = (void*)glad_glVertexAttrib4Nuiv;
+            glad_glVertexAttrib4Nuiv = record_glVertexAttrib4Nuiv;
+        }
+        if (glad_glVertexAttrib4Nusv && glad_glVertexAttrib4Nusv != record_glVertexAttrib4Nusv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4Nusv] = (void*)glad_glVertexAttrib4Nusv;
+            glad_glVertexAttrib4Nusv = record_glVertexAttrib4Nusv;
+        }
+        if (glad_glVertexAttrib4bv && glad_glVertexAttrib4bv != record_glVertexAttrib4bv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4bv] = (void*)glad_glVertexAttrib4bv;
+            glad_glVertexAttrib4bv = record_glVertexAttrib4bv;
+        }
+        if (glad_glVertexAttrib4d && glad_glVertexAttrib4d != record_glVertexAttrib4d)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4d] = (void*)glad_glVertexAttrib4d;
+            glad_glVertexAttrib4d = record_glVertexAttrib4d;
+        }
+        if (glad_glVertexAttrib4dv && glad_glVertexAttrib4dv != record_glVertexAttrib4dv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4dv] = (void*)glad_glVertexAttrib4dv;
+            glad_glVertexAttrib4dv = record_glVertexAttrib4dv;
+        }
+        if (glad_glVertexAttrib4f && glad_glVertexAttrib4f != record_glVertexAttrib4f)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4f] = (void*)glad_glVertexAttrib4f;
+            glad_glVertexAttrib4f = record_glVertexAttrib4f;
+        }
+        if (glad_glVertexAttrib4fv && glad_glVertexAttrib4fv != record_glVertexAttrib4fv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4fv] = (void*)glad_glVertexAttrib4fv;
+            glad_glVertexAttrib4fv = record_glVertexAttrib4fv;
+        }
+        if (glad_glVertexAttrib4iv && glad_glVertexAttrib4iv != record_glVertexAttrib4iv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4iv] = (void*)glad_glVertexAttrib4iv;
+            glad_glVertexAttrib4iv = record_glVertexAttrib4iv;
+        }
+        if (glad_glVertexAttrib4s && glad_glVertexAttrib4s != record_glVertexAttrib4s)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4s] = (void*)glad_glVertexAttrib4s;
+            glad_glVertexAttrib4s = record_glVertexAttrib4s;
+        }
+        if (glad_glVertexAttrib4sv && glad_glVertexAttrib4sv != record_glVertexAttrib4sv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4sv] = (void*)glad_glVertexAttrib4sv;
+            glad_glVertexAttrib4sv = record_glVertexAttrib4sv;
+        }
+        if (glad_glVertexAttrib4ubv && glad_glVertexAttrib4ubv != record_glVertexAttrib4ubv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4ubv] = (void*)glad_glVertexAttrib4ubv;
+            glad_glVertexAttrib4ubv = record_glVertexAttrib4ubv;
+        }
+        if (glad_glVertexAttrib4uiv && glad_glVertexAttrib4uiv != record_glVertexAttrib4uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4uiv] = (void*)glad_glVertexAttrib4uiv;
+            glad_glVertexAttrib4uiv = record_glVertexAttrib4uiv;
+        }
+        if (glad_glVertexAttrib4usv && glad_glVertexAttrib4usv != record_glVertexAttrib4usv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttrib4usv] = (void*)glad_glVertexAttrib4usv;
+            glad_glVertexAttrib4usv = record_glVertexAttrib4usv;
+        }
+        if (glad_glVertexAttribPointer && glad_glVertexAttribPointer != record_glVertexAttribPointer)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribPointer] = (void*)glad_glVertexAttribPointer;
+            glad_glVertexAttribPointer = record_glVertexAttribPointer;
+        }
+        if (glad_glUniformMatrix2x3fv && glad_glUniformMatrix2x3fv != record_glUniformMatrix2x3fv)
+        {
+            Table<>::loaded[ENTRY_glUniformMatrix2x3fv] = (void*)glad_glUniformMatrix2x3fv;
+            glad_glUniformMatrix2x3fv = record_glUniformMatrix2x3fv;
+        }
+        if (glad_glUniformMatrix3x2fv && glad_glUniformMatrix3x2fv != record_glUniformMatrix3x2fv)
+        {
+            Table<>::loaded[ENTRY_glUniformMatrix3x2fv] = (void*)glad_glUniformMatrix3x2fv;
+            glad_glUniformMatrix3x2fv = record_glUniformMatrix3x2fv;
+        }
+        if (glad_glUniformMatrix2x4fv && glad_glUniformMatrix2x4fv != record_glUniformMatrix2x4fv)
+        {
+            Table<>::loaded[ENTRY_glUniformMatrix2x4fv] = (void*)glad_glUniformMatrix2x4fv;
+            glad_glUniformMatrix2x4fv = record_glUniformMatrix2x4fv;
+        }
+        if (glad_glUniformMatrix4x2fv && glad_glUniformMatrix4x2fv != record_glUniformMatrix4x2fv)
+        {
+            Table<>::loaded[ENTRY_glUniformMatrix4x2fv] = (void*)glad_glUniformMatrix4x2fv;
+            glad_glUniformMatrix4x2fv = record_glUniformMatrix4x2fv;
+        }
+        if (glad_glUniformMatrix3x4fv && glad_glUniformMatrix3x4fv != record_glUniformMatrix3x4fv)
+        {
+            Table<>::loaded[ENTRY_glUniformMatrix3x4fv] = (void*)glad_glUniformMatrix3x4fv;
+            glad_glUniformMatrix3x4fv = record_glUniformMatrix3x4fv;
+        }
+        if (glad_glUniformMatrix4x3fv && glad_glUniformMatrix4x3fv != record_glUniformMatrix4x3fv)
+        {
+            Table<>::loaded[ENTRY_glUniformMatrix4x3fv] = (void*)glad_glUniformMatrix4x3fv;
+            glad_glUniformMatrix4x3fv = record_glUniformMatrix4x3fv;
+        }
+        if (glad_glColorMaski && glad_glColorMaski != record_glColorMaski)
+        {
+            Table<>::loaded[ENTRY_glColorMaski] = (void*)glad_glColorMaski;
+            glad_glColorMaski = record_glColorMaski;
+        }
+        if (glad_glEnablei && glad_glEnablei != record_glEnablei)
+        {
+            Table<>::loaded[ENTRY_glEnablei] = (void*)glad_glEnablei;
+            glad_glEnablei = record_glEnablei;
+        }
+        if (glad_glDisablei && glad_glDisablei != record_glDisablei)
+        {
+            Table<>::loaded[ENTRY_glDisablei] = (void*)glad_glDisablei;
+            glad_glDisablei = record_glDisablei;
+        }
+        if (glad_glBeginTransformFeedback && glad_glBeginTransformFeedback != record_glBeginTransformFeedback)
+        {
+            Table<>::loaded[ENTRY_glBeginTransformFeedback] = (void*)glad_glBeginTransformFeedback;
+            glad_glBeginTransformFeedback = record_glBeginTransformFeedback;
+        }
+        if (glad_glEndTransformFeedback && glad_glEndTransformFeedback != record_glEndTransformFeedback)
+        {
+            Table<>::loaded[ENTRY_glEndTransformFeedback] = (void*)glad_glEndTransformFeedback;
+            glad_glEndTransformFeedback = record_glEndTransformFeedback;
+        }
+        if (glad_glBindBufferRange && glad_glBindBufferRange != record_glBindBufferRange)
+        {
+            Table<>::loaded[ENTRY_glBindBufferRange] = (void*)glad_glBindBufferRange;
+            glad_glBindBufferRange = record_glBindBufferRange;
+        }
+        if (glad_glBindBufferBase && glad_glBindBufferBase != record_glBindBufferBase)
+        {
+            Table<>::loaded[ENTRY_glBindBufferBase] = (void*)glad_glBindBufferBase;
+            glad_glBindBufferBase = record_glBindBufferBase;
+        }
+        if (glad_glTransformFeedbackVaryings && glad_glTransformFeedbackVaryings != record_glTransformFeedbackVaryings)
+        {
+            Table<>::loaded[ENTRY_glTransformFeedbackVaryings] = (void*)glad_glTransformFeedbackVaryings;
+            glad_glTransformFeedbackVaryings = record_glTransformFeedbackVaryings;
+        }
+        if (glad_glClampColor && glad_glClampColor != record_glClampColor)
+        {
+            Table<>::loaded[ENTRY_glClampColor] = (void*)glad_glClampColor;
+            glad_glClampColor = record_glClampColor;
+        }
+        if (glad_glBeginConditionalRender && glad_glBeginConditionalRender != record_glBeginConditionalRender)
+        {
+            Table<>::loaded[ENTRY_glBeginConditionalRender] = (void*)glad_glBeginConditionalRender;
+            glad_glBeginConditionalRender = record_glBeginConditionalRender;
+        }
+        if (glad_glEndConditionalRender && glad_glEndConditionalRender != record_glEndConditionalRender)
+        {
+            Table<>::loaded[ENTRY_glEndConditionalRender] = (void*)glad_glEndConditionalRender;
+            glad_glEndConditionalRender = record_glEndConditionalRender;
+        }
+        if (glad_glVertexAttribIPointer && glad_glVertexAttribIPointer != record_glVertexAttribIPointer)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribIPointer] = (void*)glad_glVertexAttribIPointer;
+            glad_glVertexAttribIPointer = record_glVertexAttribIPointer;
+        }
+        if (glad_glVertexAttribI1i && glad_glVertexAttribI1i != record_glVertexAttribI1i)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI1i] = (void*)glad_glVertexAttribI1i;
+            glad_glVertexAttribI1i = record_glVertexAttribI1i;
+        }
+        if (glad_glVertexAttribI2i && glad_glVertexAttribI2i != record_glVertexAttribI2i)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI2i] = (void*)glad_glVertexAttribI2i;
+            glad_glVertexAttribI2i = record_glVertexAttribI2i;
+        }
+        if (glad_glVertexAttribI3i && glad_glVertexAttribI3i != record_glVertexAttribI3i)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI3i] = (void*)glad_glVertexAttribI3i;
+            glad_glVertexAttribI3i = record_glVertexAttribI3i;
+        }
+        if (glad_glVertexAttribI4i && glad_glVertexAttribI4i != record_glVertexAttribI4i)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI4i] = (void*)glad_glVertexAttribI4i;
+            glad_glVertexAttribI4i = record_glVertexAttribI4i;
+        }
+        if (glad_glVertexAttribI1ui && glad_glVertexAttribI1ui != record_glVertexAttribI1ui)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI1ui] = (void*)glad_glVertexAttribI1ui;
+            glad_glVertexAttribI1ui = record_glVertexAttribI1ui;
+        }
+        if (glad_glVertexAttribI2ui && glad_glVertexAttribI2ui != record_glVertexAttribI2ui)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI2ui] = (void*)glad_glVertexAttribI2ui;
+            glad_glVertexAttribI2ui = record_glVertexAttribI2ui;
+        }
+        if (glad_glVertexAttribI3ui && glad_glVertexAttribI3ui != record_glVertexAttribI3ui)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI3ui] = (void*)glad_glVertexAttribI3ui;
+            glad_glVertexAttribI3ui = record_glVertexAttribI3ui;
+        }
+        if (glad_glVertexAttribI4ui && glad_glVertexAttribI4ui != record_glVertexAttribI4ui)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI4ui] = (void*)glad_glVertexAttribI4ui;
+            glad_glVertexAttribI4ui = record_glVertexAttribI4ui;
+        }
+        if (glad_glVertexAttribI1iv && glad_glVertexAttribI1iv != record_glVertexAttribI1iv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI1iv] = (void*)glad_glVertexAttribI1iv;
+            glad_glVertexAttribI1iv = record_glVertexAttribI1iv;
+        }
+        if (glad_glVertexAttribI2iv && glad_glVertexAttribI2iv != record_glVertexAttribI2iv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI2iv] = (void*)glad_glVertexAttribI2iv;
+            glad_glVertexAttribI2iv = record_glVertexAttribI2iv;
+        }
+        if (glad_glVertexAttribI3iv && glad_glVertexAttribI3iv != record_glVertexAttribI3iv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI3iv] = (void*)glad_glVertexAttribI3iv;
+            glad_glVertexAttribI3iv = record_glVertexAttribI3iv;
+        }
+        if (glad_glVertexAttribI4iv && glad_glVertexAttribI4iv != record_glVertexAttribI4iv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI4iv] = (void*)glad_glVertexAttribI4iv;
+            glad_glVertexAttribI4iv = record_glVertexAttribI4iv;
+        }
+        if (glad_glVertexAttribI1uiv && glad_glVertexAttribI1uiv != record_glVertexAttribI1uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI1uiv] = (void*)glad_glVertexAttribI1uiv;
+            glad_glVertexAttribI1uiv = record_glVertexAttribI1uiv;
+        }
+        if (glad_glVertexAttribI2uiv && glad_glVertexAttribI2uiv != record_glVertexAttribI2uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI2uiv] = (void*)glad_glVertexAttribI2uiv;
+            glad_glVertexAttribI2uiv = record_glVertexAttribI2uiv;
+        }
+        if (glad_glVertexAttribI3uiv && glad_glVertexAttribI3uiv != record_glVertexAttribI3uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI3uiv] = (void*)glad_glVertexAttribI3uiv;
+            glad_glVertexAttribI3uiv = record_glVertexAttribI3uiv;
+        }
+        if (glad_glVertexAttribI4uiv && glad_glVertexAttribI4uiv != record_glVertexAttribI4uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI4uiv] = (void*)glad_glVertexAttribI4uiv;
+            glad_glVertexAttribI4uiv = record_glVertexAttribI4uiv;
+        }
+        if (glad_glVertexAttribI4bv && glad_glVertexAttribI4bv != record_glVertexAttribI4bv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI4bv] = (void*)glad_glVertexAttribI4bv;
+            glad_glVertexAttribI4bv = record_glVertexAttribI4bv;
+        }
+        if (glad_glVertexAttribI4sv && glad_glVertexAttribI4sv != record_glVertexAttribI4sv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI4sv] = (void*)glad_glVertexAttribI4sv;
+            glad_glVertexAttribI4sv = record_glVertexAttribI4sv;
+        }
+        if (glad_glVertexAttribI4ubv && glad_glVertexAttribI4ubv != record_glVertexAttribI4ubv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI4ubv] = (void*)glad_glVertexAttribI4ubv;
+            glad_glVertexAttribI4ubv = record_glVertexAttribI4ubv;
+        }
+        if (glad_glVertexAttribI4usv && glad_glVertexAttribI4usv != record_glVertexAttribI4usv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribI4usv] = (void*)glad_glVertexAttribI4usv;
+            glad_glVertexAttribI4usv = record_glVertexAttribI4usv;
+        }
+        if (glad_glBindFragDataLocation && glad_glBindFragDataLocation != record_glBindFragDataLocation)
+        {
+            Table<>::loaded[ENTRY_glBindFragDataLocation] = (void*)glad_glBindFragDataLocation;
+            glad_glBindFragDataLocation = record_glBindFragDataLocation;
+        }
+        if (glad_glUniform1ui && glad_glUniform1ui != record_glUniform1ui)
+        {
+            Table<>::loaded[ENTRY_glUniform1ui] = (void*)glad_glUniform1ui;
+            glad_glUniform1ui = record_glUniform1ui;
+        }
+        if (glad_glUniform2ui && glad_glUniform2ui != record_glUniform2ui)
+        {
+            Table<>::loaded[ENTRY_glUniform2ui] = (void*)glad_glUniform2ui;
+            glad_glUniform2ui = record_glUniform2ui;
+        }
+        if (glad_glUniform3ui && glad_glUniform3ui != record_glUniform3ui)
+        {
+            Table<>::loaded[ENTRY_glUniform3ui] = (void*)glad_glUniform3ui;
+            glad_glUniform3ui = record_glUniform3ui;
+        }
+        if (glad_glUniform4ui && glad_glUniform4ui != record_glUniform4ui)
+        {
+            Table<>::loaded[ENTRY_glUniform4ui] = (void*)glad_glUniform4ui;
+            glad_glUniform4ui = record_glUniform4ui;
+        }
+        if (glad_glUniform1uiv && glad_glUniform1uiv != record_glUniform1uiv)
+        {
+            Table<>::loaded[ENTRY_glUniform1uiv] = (void*)glad_glUniform1uiv;
+            glad_glUniform1uiv = record_glUniform1uiv;
+        }
+        if (glad_glUniform2uiv && glad_glUniform2uiv != record_glUniform2uiv)
+        {
+            Table<>::loaded[ENTRY_glUniform2uiv] = (void*)glad_glUniform2uiv;
+            glad_glUniform2uiv = record_glUniform2uiv;
+        }
+        if (glad_glUniform3uiv && glad_glUniform3uiv != record_glUniform3uiv)
+        {
+            Table<>::loaded[ENTRY_glUniform3uiv] = (void*)glad_glUniform3uiv;
+            glad_glUniform3uiv = record_glUniform3uiv;
+        }
+        if (glad_glUniform4uiv && glad_glUniform4uiv != record_glUniform4uiv)
+        {
+            Table<>::loaded[ENTRY_glUniform4uiv] = (void*)glad_glUniform4uiv;
+            glad_glUniform4uiv = record_glUniform4uiv;
+        }
+        if (glad_glTexParameterIiv && glad_glTexParameterIiv != record_glTexParameterIiv)
+        {
+            Table<>::loaded[ENTRY_glTexParameterIiv] = (void*)glad_glTexParameterIiv;
+            glad_glTexParameterIiv = record_glTexParameterIiv;
+        }
+        if (glad_glTexParameterIuiv && glad_glTexParameterIuiv != record_glTexParameterIuiv)
+        {
+            Table<>::loaded[ENTRY_glTexParameterIuiv] = (void*)glad_glTexParameterIuiv;
+            glad_glTexParameterIuiv = record_glTexParameterIuiv;
+        }
+        if (glad_glClearBufferiv && glad_glClearBufferiv != record_glClearBufferiv)
+        {
+            Table<>::loaded[ENTRY_glClearBufferiv] = (void*)glad_glClearBufferiv;
+            glad_glClearBufferiv = record_glClearBufferiv;
+        }
+        if (glad_glClearBufferuiv && glad_glClearBufferuiv != record_glClearBufferuiv)
+        {
+            Table<>::loaded[ENTRY_glClearBufferuiv] = (void*)glad_glClearBufferuiv;
+            glad_glClearBufferuiv = record_glClearBufferuiv;
+        }
+        if (glad_glClearBufferfv && glad_glClearBufferfv != record_glClearBufferfv)
+        {
+            Table<>::loaded[ENTRY_glClearBufferfv] = (void*)glad_glClearBufferfv;
+            glad_glClearBufferfv = record_glClearBufferfv;
+        }
+        if (glad_glClearBufferfi && glad_glClearBufferfi != record_glClearBufferfi)
+        {
+            Table<>::loaded[ENTRY_glClearBufferfi] = (void*)glad_glClearBufferfi;
+            glad_glClearBufferfi = record_glClearBufferfi;
+        }
+        if (glad_glBindRenderbuffer && glad_glBindRenderbuffer != record_glBindRenderbuffer)
+        {
+            Table<>::loaded[ENTRY_glBindRenderbuffer] = (void*)glad_glBindRenderbuffer;
+            glad_glBindRenderbuffer = record_glBindRenderbuffer;
+        }
+        if (glad_glDeleteRenderbuffers && glad_glDeleteRenderbuffers != record_glDeleteRenderbuffers)
+        {
+            Table<>::loaded[ENTRY_glDeleteRenderbuffers] = (void*)glad_glDeleteRenderbuffers;
+            glad_glDeleteRenderbuffers = record_glDeleteRenderbuffers;
+        }
+        if (glad_glGenRenderbuffers && glad_glGenRenderbuffers != record_glGenRenderbuffers)
+        {
+            Table<>::loaded[ENTRY_glGenRenderbuffers] = (void*)glad_glGenRenderbuffers;
+            glad_glGenRenderbuffers = record_glGenRenderbuffers;
+        }
+        if (glad_glRenderbufferStorage && glad_glRenderbufferStorage != record_glRenderbufferStorage)
+        {
+            Table<>::loaded[ENTRY_glRenderbufferStorage] = (void*)glad_glRenderbufferStorage;
+            glad_glRenderbufferStorage = record_glRenderbufferStorage;
+        }
+        if (glad_glBindFramebuffer && glad_glBindFramebuffer != record_glBindFramebuffer)
+        {
+            Table<>::loaded[ENTRY_glBindFramebuffer] = (void*)glad_glBindFramebuffer;
+            glad_glBindFramebuffer = record_glBindFramebuffer;
+        }
+        if (glad_glDeleteFramebuffers && glad_glDeleteFramebuffers != record_glDeleteFramebuffers)
+        {
+            Table<>::loaded[ENTRY_glDeleteFramebuffers] = (void*)glad_glDeleteFramebuffers;
+            glad_glDeleteFramebuffers = record_glDeleteFramebuffers;
+        }
+        if (glad_glGenFramebuffers && glad_glGenFramebuffers != record_glGenFramebuffers)
+        {
+            Table<>::loaded[ENTRY_glGenFramebuffers] = (void*)glad_glGenFramebuffers;
+            glad_glGenFramebuffers = record_glGenFramebuffers;
+        }
+        if (glad_glFramebufferTexture1D && glad_glFramebufferTexture1D != record_glFramebufferTexture1D)
+        {
+            Table<>::loaded[ENTRY_glFramebufferTexture1D] = (void*)glad_glFramebufferTexture1D;
+            glad_glFramebufferTexture1D = record_glFramebufferTexture1D;
+        }
+        if (glad_glFramebufferTexture2D && glad_glFramebufferTexture2D != record_glFramebufferTexture2D)
+        {
+            Table<>::loaded[ENTRY_glFramebufferTexture2D] = (void*)glad_glFramebufferTexture2D;
+            glad_glFramebufferTexture2D = record_glFramebufferTexture2D;
+        }
+        if (glad_glFramebufferTexture3D && glad_glFramebufferTexture3D != record_glFramebufferTexture3D)
+        {
+            Table<>::loaded[ENTRY_glFramebufferTexture3D] = (void*)glad_glFramebufferTexture3D;
+            glad_glFramebufferTexture3D = record_glFramebufferTexture3D;
+        }
+        if (glad_glFramebufferRenderbuffer && glad_glFramebufferRenderbuffer != record_glFramebufferRenderbuffer)
+        {
+            Table<>::loaded[ENTRY_glFramebufferRenderbuffer] = (void*)glad_glFramebufferRenderbuffer;
+            glad_glFramebufferRenderbuffer = record_glFramebufferRenderbuffer;
+        }
+        if (glad_glGenerateMipmap && glad_glGenerateMipmap != record_glGenerateMipmap)
+        {
+            Table<>::loaded[ENTRY_glGenerateMipmap] = (void*)glad_glGenerateMipmap;
+            glad_glGenerateMipmap = record_glGenerateMipmap;
+        }
+        if (glad_glBlitFramebuffer && glad_glBlitFramebuffer != record_glBlitFramebuffer)
+        {
+            Table<>::loaded[ENTRY_glBlitFramebuffer] = (void*)glad_glBlitFramebuffer;
+            glad_glBlitFramebuffer = record_glBlitFramebuffer;
+        }
+        if (glad_glRenderbufferStorageMultisample && glad_glRenderbufferStorageMultisample != record_glRenderbufferStorageMultisample)
+        {
+            Table<>::loaded[ENTRY_glRenderbufferStorageMultisample] = (void*)glad_glRenderbufferStorageMultisample;
+            glad_glRenderbufferStorageMultisample = record_glRenderbufferStorageMultisample;
+        }
+        if (glad_glFramebufferTextureLayer && glad_glFramebufferTextureLayer != record_glFramebufferTextureLayer)
+        {
+            Table<>::loaded[ENTRY_glFramebufferTextureLayer] = (void*)glad_glFramebufferTextureLayer;
+            glad_glFramebufferTextureLayer = record_glFramebufferTextureLayer;
+        }
+        if (glad_glMapBufferRange && glad_glMapBufferRange != record_glMapBufferRange)
+        {
+            Table<>::loaded[ENTRY_glMapBufferRange] = (void*)glad_glMapBufferRange;
+            glad_glMapBufferRange = record_glMapBufferRange;
+        }
+        if (glad_glFlushMappedBufferRange && glad_glFlushMappedBufferRange != record_glFlushMappedBufferRange)
+        {
+            Table<>::loaded[ENTRY_glFlushMappedBufferRange] = (void*)glad_glFlushMappedBufferRange;
+            glad_glFlushMappedBufferRange = record_glFlushMappedBufferRange;
+        }
+        if (glad_glBindVertexArray && glad_glBindVertexArray != record_glBindVertexArray)
+        {
+            Table<>::loaded[ENTRY_glBindVertexArray] = (void*)glad_glBindVertexArray;
+            glad_glBindVertexArray = record_glBindVertexArray;
+        }
+        if (glad_glDeleteVertexArrays && glad_glDeleteVertexArrays != record_glDeleteVertexArrays)
+        {
+            Table<>::loaded[ENTRY_glDeleteVertexArrays] = (void*)glad_glDeleteVertexArrays;
+            glad_glDeleteVertexArrays = record_glDeleteVertexArrays;
+        }
+        if (glad_glGenVertexArrays && glad_glGenVertexArrays != record_glGenVertexArrays)
+        {
+            Table<>::loaded[ENTRY_glGenVertexArrays] = (void*)glad_glGenVertexArrays;
+            glad_glGenVertexArrays = record_glGenVertexArrays;
+        }
+        if (glad_glDrawArraysInstanced && glad_glDrawArraysInstanced != record_glDrawArraysInstanced)
+        {
+            Table<>::loaded[ENTRY_glDrawArraysInstanced] = (void*)glad_glDrawArraysInstanced;
+            glad_glDrawArraysInstanced = record_glDrawArraysInstanced;
+        }
+        if (glad_glDrawElementsInstanced && glad_glDrawElementsInstanced != record_glDrawElementsInstanced)
+        {
+            Table<>::loaded[ENTRY_glDrawElementsInstanced] = (void*)glad_glDrawElementsInstanced;
+            glad_glDrawElementsInstanced = record_glDrawElementsInstanced;
+        }
+        if (glad_glTexBuffer && glad_glTexBuffer != record_glTexBuffer)
+        {
+            Table<>::loaded[ENTRY_glTexBuffer] = (void*)glad_glTexBuffer;
+            glad_glTexBuffer = record_glTexBuffer;
+        }
+        if (glad_glPrimitiveRestartIndex && glad_glPrimitiveRestartIndex != record_glPrimitiveRestartIndex)
+        {
+            Table<>::loaded[ENTRY_glPrimitiveRestartIndex] = (void*)glad_glPrimitiveRestartIndex;
+            glad_glPrimitiveRestartIndex = record_glPrimitiveRestartIndex;
+        }
+        if (glad_glCopyBufferSubData && glad_glCopyBufferSubData != record_glCopyBufferSubData)
+        {
+            Table<>::loaded[ENTRY_glCopyBufferSubData] = (void*)glad_glCopyBufferSubData;
+            glad_glCopyBufferSubData = record_glCopyBufferSubData;
+        }
+        if (glad_glUniformBlockBinding && glad_glUniformBlockBinding != record_glUniformBlockBinding)
+        {
+            Table<>::loaded[ENTRY_glUniformBlockBinding] = (void*)glad_glUniformBlockBinding;
+            glad_glUniformBlockBinding = record_glUniformBlockBinding;
+        }
+        if (glad_glDrawElementsBaseVertex && glad_glDrawElementsBaseVertex != record_glDrawElementsBaseVertex)
+        {
+            Table<>::loaded[ENTRY_glDrawElementsBaseVertex] = (void*)glad_glDrawElementsBaseVertex;
+            glad_glDrawElementsBaseVertex = record_glDrawElementsBaseVertex;
+        }
+        if (glad_glDrawRangeElementsBaseVertex && glad_glDrawRangeElementsBaseVertex != record_glDrawRangeElementsBaseVertex)
+        {
+            Table<>::loaded[ENTRY_glDrawRangeElementsBaseVertex] = (void*)glad_glDrawRangeElementsBaseVertex;
+            glad_glDrawRangeElementsBaseVertex = record_glDrawRangeElementsBaseVertex;
+        }
+        if (glad_glDrawElementsInstancedBaseVertex && glad_glDrawElementsInstancedBaseVertex != record_glDrawElementsInstancedBaseVertex)
+        {
+            Table<>::loaded[ENTRY_glDrawElementsInstancedBaseVertex] = (void*)glad_glDrawElementsInstancedBaseVertex;
+            glad_glDrawElementsInstancedBaseVertex = record_glDrawElementsInstancedBaseVertex;
+        }
+        if (glad_glMultiDrawElementsBaseVertex && glad_glMultiDrawElementsBaseVertex != record_glMultiDrawElementsBaseVertex)
+        {
+            Table<>::loaded[ENTRY_glMultiDrawElementsBaseVertex] = (void*)glad_glMultiDrawElementsBaseVertex;
+            glad_glMultiDrawElementsBaseVertex = record_glMultiDrawElementsBaseVertex;
+        }
+        if (glad_glProvokingVertex && glad_glProvokingVertex != record_glProvokingVertex)
+        {
+            Table<>::loaded[ENTRY_glProvokingVertex] = (void*)glad_glProvokingVertex;
+            glad_glProvokingVertex = record_glProvokingVertex;
+        }
+        if (glad_glFenceSync && glad_glFenceSync != record_glFenceSync)
+        {
+            Table<>::loaded[ENTRY_glFenceSync] = (void*)glad_glFenceSync;
+            glad_glFenceSync = record_glFenceSync;
+        }
+        if (glad_glDeleteSync && glad_glDeleteSync != record_glDeleteSync)
+        {
+            Table<>::loaded[ENTRY_glDeleteSync] = (void*)glad_glDeleteSync;
+            glad_glDeleteSync = record_glDeleteSync;
+        }
+        if (glad_glClientWaitSync && glad_glClientWaitSync != record_glClientWaitSync)
+        {
+            Table<>::loaded[ENTRY_glClientWaitSync] = (void*)glad_glClientWaitSync;
+            glad_glClientWaitSync = record_glClientWaitSync;
+        }
+        if (glad_glWaitSync && glad_glWaitSync != record_glWaitSync)
+        {
+            Table<>::loaded[ENTRY_glWaitSync] = (void*)glad_glWaitSync;
+            glad_glWaitSync = record_glWaitSync;
+        }
+        if (glad_glFramebufferTexture && glad_glFramebufferTexture != record_glFramebufferTexture)
+        {
+            Table<>::loaded[ENTRY_glFramebufferTexture] = (void*)glad_glFramebufferTexture;
+            glad_glFramebufferTexture = record_glFramebufferTexture;
+        }
+        if (glad_glTexImage2DMultisample && glad_glTexImage2DMultisample != record_glTexImage2DMultisample)
+        {
+            Table<>::loaded[ENTRY_glTexImage2DMultisample] = (void*)glad_glTexImage2DMultisample;
+            glad_glTexImage2DMultisample = record_glTexImage2DMultisample;
+        }
+        if (glad_glTexImage3DMultisample && glad_glTexImage3DMultisample != record_glTexImage3DMultisample)
+        {
+            Table<>::loaded[ENTRY_glTexImage3DMultisample] = (void*)glad_glTexImage3DMultisample;
+            glad_glTexImage3DMultisample = record_glTexImage3DMultisample;
+        }
+        if (glad_glSampleMaski && glad_glSampleMaski != record_glSampleMaski)
+        {
+            Table<>::loaded[ENTRY_glSampleMaski] = (void*)glad_glSampleMaski;
+            glad_glSampleMaski = record_glSampleMaski;
+        }
+        if (glad_glBindFragDataLocationIndexed && glad_glBindFragDataLocationIndexed != record_glBindFragDataLocationIndexed)
+        {
+            Table<>::loaded[ENTRY_glBindFragDataLocationIndexed] = (void*)glad_glBindFragDataLocationIndexed;
+            glad_glBindFragDataLocationIndexed = record_glBindFragDataLocationIndexed;
+        }
+        if (glad_glGenSamplers && glad_glGenSamplers != record_glGenSamplers)
+        {
+            Table<>::loaded[ENTRY_glGenSamplers] = (void*)glad_glGenSamplers;
+            glad_glGenSamplers = record_glGenSamplers;
+        }
+        if (glad_glDeleteSamplers && glad_glDeleteSamplers != record_glDeleteSamplers)
+        {
+            Table<>::loaded[ENTRY_glDeleteSamplers] = (void*)glad_glDeleteSamplers;
+            glad_glDeleteSamplers = record_glDeleteSamplers;
+        }
+        if (glad_glBindSampler && glad_glBindSampler != record_glBindSampler)
+        {
+            Table<>::loaded[ENTRY_glBindSampler] = (void*)glad_glBindSampler;
+            glad_glBindSampler = record_glBindSampler;
+        }
+        if (glad_glSamplerParameteri && glad_glSamplerParameteri != record_glSamplerParameteri)
+        {
+            Table<>::loaded[ENTRY_glSamplerParameteri] = (void*)glad_glSamplerParameteri;
+            glad_glSamplerParameteri = record_glSamplerParameteri;
+        }
+        if (glad_glSamplerParameteriv && glad_glSamplerParameteriv != record_glSamplerParameteriv)
+        {
+            Table<>::loaded[ENTRY_glSamplerParameteriv] = (void*)glad_glSamplerParameteriv;
+            glad_glSamplerParameteriv = record_glSamplerParameteriv;
+        }
+        if (glad_glSamplerParameterf && glad_glSamplerParameterf != record_glSamplerParameterf)
+        {
+            Table<>::loaded[ENTRY_glSamplerParameterf] = (void*)glad_glSamplerParameterf;
+            glad_glSamplerParameterf = record_glSamplerParameterf;
+        }
+        if (glad_glSamplerParameterfv && glad_glSamplerParameterfv != record_glSamplerParameterfv)
+        {
+            Table<>::loaded[ENTRY_glSamplerParameterfv] = (void*)glad_glSamplerParameterfv;
+            glad_glSamplerParameterfv = record_glSamplerParameterfv;
+        }
+        if (glad_glSamplerParameterIiv && glad_glSamplerParameterIiv != record_glSamplerParameterIiv)
+        {
+            Table<>::loaded[ENTRY_glSamplerParameterIiv] = (void*)glad_glSamplerParameterIiv;
+            glad_glSamplerParameterIiv = record_glSamplerParameterIiv;
+        }
+        if (glad_glSamplerParameterIuiv && glad_glSamplerParameterIuiv != record_glSamplerParameterIuiv)
+        {
+            Table<>::loaded[ENTRY_glSamplerParameterIuiv] = (void*)glad_glSamplerParameterIuiv;
+            glad_glSamplerParameterIuiv = record_glSamplerParameterIuiv;
+        }
+        if (glad_glQueryCounter && glad_glQueryCounter != record_glQueryCounter)
+        {
+            Table<>::loaded[ENTRY_glQueryCounter] = (void*)glad_glQueryCounter;
+            glad_glQueryCounter = record_glQueryCounter;
+        }
+        if (glad_glVertexAttribDivisor && glad_glVertexAttribDivisor != record_glVertexAttribDivisor)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribDivisor] = (void*)glad_glVertexAttribDivisor;
+            glad_glVertexAttribDivisor = record_glVertexAttribDivisor;
+        }
+        if (glad_glVertexAttribP1ui && glad_glVertexAttribP1ui != record_glVertexAttribP1ui)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribP1ui] = (void*)glad_glVertexAttribP1ui;
+            glad_glVertexAttribP1ui = record_glVertexAttribP1ui;
+        }
+        if (glad_glVertexAttribP1uiv && glad_glVertexAttribP1uiv != record_glVertexAttribP1uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribP1uiv] = (void*)glad_glVertexAttribP1uiv;
+            glad_glVertexAttribP1uiv = record_glVertexAttribP1uiv;
+        }
+        if (glad_glVertexAttribP2ui && glad_glVertexAttribP2ui != record_glVertexAttribP2ui)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribP2ui] = (void*)glad_glVertexAttribP2ui;
+            glad_glVertexAttribP2ui = record_glVertexAttribP2ui;
+        }
+        if (glad_glVertexAttribP2uiv && glad_glVertexAttribP2uiv != record_glVertexAttribP2uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribP2uiv] = (void*)glad_glVertexAttribP2uiv;
+            glad_glVertexAttribP2uiv = record_glVertexAttribP2uiv;
+        }
+        if (glad_glVertexAttribP3ui && glad_glVertexAttribP3ui != record_glVertexAttribP3ui)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribP3ui] = (void*)glad_glVertexAttribP3ui;
+            glad_glVertexAttribP3ui = record_glVertexAttribP3ui;
+        }
+        if (glad_glVertexAttribP3uiv && glad_glVertexAttribP3uiv != record_glVertexAttribP3uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribP3uiv] = (void*)glad_glVertexAttribP3uiv;
+            glad_glVertexAttribP3uiv = record_glVertexAttribP3uiv;
+        }
+        if (glad_glVertexAttribP4ui && glad_glVertexAttribP4ui != record_glVertexAttribP4ui)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribP4ui] = (void*)glad_glVertexAttribP4ui;
+            glad_glVertexAttribP4ui = record_glVertexAttribP4ui;
+        }
+        if (glad_glVertexAttribP4uiv && glad_glVertexAttribP4uiv != record_glVertexAttribP4uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexAttribP4uiv] = (void*)glad_glVertexAttribP4uiv;
+            glad_glVertexAttribP4uiv = record_glVertexAttribP4uiv;
+        }
+        if (glad_glVertexP2ui && glad_glVertexP2ui != record_glVertexP2ui)
+        {
+            Table<>::loaded[ENTRY_glVertexP2ui] = (void*)glad_glVertexP2ui;
+            glad_glVertexP2ui = record_glVertexP2ui;
+        }
+        if (glad_glVertexP2uiv && glad_glVertexP2uiv != record_glVertexP2uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexP2uiv] = (void*)glad_glVertexP2uiv;
+            glad_glVertexP2uiv = record_glVertexP2uiv;
+        }
+        if (glad_glVertexP3ui && glad_glVertexP3ui != record_glVertexP3ui)
+        {
+            Table<>::loaded[ENTRY_glVertexP3ui] = (void*)glad_glVertexP3ui;
+            glad_glVertexP3ui = record_glVertexP3ui;
+        }
+        if (glad_glVertexP3uiv && glad_glVertexP3uiv != record_glVertexP3uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexP3uiv] = (void*)glad_glVertexP3uiv;
+            glad_glVertexP3uiv = record_glVertexP3uiv;
+        }
+        if (glad_glVertexP4ui && glad_glVertexP4ui != record_glVertexP4ui)
+        {
+            Table<>::loaded[ENTRY_glVertexP4ui] = (void*)glad_glVertexP4ui;
+            glad_glVertexP4ui = record_glVertexP4ui;
+        }
+        if (glad_glVertexP4uiv && glad_glVertexP4uiv != record_glVertexP4uiv)
+        {
+            Table<>::loaded[ENTRY_glVertexP4uiv] = (void*)glad_glVertexP4uiv;
+            glad_glVertexP4uiv = record_glVertexP4uiv;
+        }
+        if (glad_glTexCoordP1ui && glad_glTexCoordP1ui != record_glTexCoordP1ui)
+        {
+            Table<>::loaded[ENTRY_glTexCoordP1ui] = (void*)glad_glTexCoordP1ui;
+            glad_glTexCoordP1ui = record_glTexCoordP1ui;
+        }
+        if (glad_glTexCoordP1uiv && glad_glTexCoordP1uiv != record_glTexCoordP1uiv)
+        {
+            Table<>::loaded[ENTRY_glTexCoordP1uiv] = (void*)glad_glTexCoordP1uiv;
+            glad_glTexCoordP1uiv = record_glTexCoordP1uiv;
+        }
+        if (glad_glTexCoordP2ui && glad_glTexCoordP2ui != record_glTexCoordP2ui)
+        {
+            Table<>::loaded[ENTRY_glTexCoordP2ui] = (void*)glad_glTexCoordP2ui;
+            glad_glTexCoordP2ui = record_glTexCoordP2ui;
+        }
+        if (glad_glTexCoordP2uiv && glad_glTexCoordP2uiv != record_glTexCoordP2uiv)
+        {
+            Table<>::loaded[ENTRY_glTexCoordP2uiv] = (void*)glad_glTexCoordP2uiv;
+            glad_glTexCoordP2uiv = record_glTexCoordP2uiv;
+        }
+        if (glad_glTexCoordP3ui && glad_glTexCoordP3ui != record_glTexCoordP3ui)
+        {
+            Table<>::loaded[ENTRY_glTexCoordP3ui] = (void*)glad_glTexCoordP3ui;
+            glad_glTexCoordP3ui = record_glTexCoordP3ui;
+        }
+        if (glad_glTexCoordP3uiv && glad_glTexCoordP3uiv != record_glTexCoordP3uiv)
+        {
+            Table<>::loaded[ENTRY_glTexCoordP3uiv] = (void*)glad_glTexCoordP3uiv;
+            glad_glTexCoordP3uiv = record_glTexCoordP3uiv;
+        }
+        if (glad_glTexCoordP4ui && glad_glTexCoordP4ui != record_glTexCoordP4ui)
+        {
+            Table<>::loaded[ENTRY_glTexCoordP4ui] = (void*)glad_glTexCoordP4ui;
+            glad_glTexCoordP4ui = record_glTexCoordP4ui;
+        }
+        if (glad_glTexCoordP4uiv && glad_glTexCoordP4uiv != record_glTexCoordP4uiv)
+        {
+            Table<>::loaded[ENTRY_glTexCoordP4uiv] = (void*)glad_glTexCoordP4uiv;
+            glad_glTexCoordP4uiv = record_glTexCoordP4uiv;
+        }
+        if (glad_glMultiTexCoordP1ui && glad_glMultiTexCoordP1ui != record_glMultiTexCoordP1ui)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoordP1ui] = (void*)glad_glMultiTexCoordP1ui;
+            glad_glMultiTexCoordP1ui = record_glMultiTexCoordP1ui;
+        }
+        if (glad_glMultiTexCoordP1uiv && glad_glMultiTexCoordP1uiv != record_glMultiTexCoordP1uiv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoordP1uiv] = (void*)glad_glMultiTexCoordP1uiv;
+            glad_glMultiTexCoordP1uiv = record_glMultiTexCoordP1uiv;
+        }
+        if (glad_glMultiTexCoordP2ui && glad_glMultiTexCoordP2ui != record_glMultiTexCoordP2ui)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoordP2ui] = (void*)glad_glMultiTexCoordP2ui;
+            glad_glMultiTexCoordP2ui = record_glMultiTexCoordP2ui;
+        }
+        if (glad_glMultiTexCoordP2uiv && glad_glMultiTexCoordP2uiv != record_glMultiTexCoordP2uiv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoordP2uiv] = (void*)glad_glMultiTexCoordP2uiv;
+            glad_glMultiTexCoordP2uiv = record_glMultiTexCoordP2uiv;
+        }
+        if (glad_glMultiTexCoordP3ui && glad_glMultiTexCoordP3ui != record_glMultiTexCoordP3ui)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoordP3ui] = (void*)glad_glMultiTexCoordP3ui;
+            glad_glMultiTexCoordP3ui = record_glMultiTexCoordP3ui;
+        }
+        if (glad_glMultiTexCoordP3uiv && glad_glMultiTexCoordP3uiv != record_glMultiTexCoordP3uiv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoordP3uiv] = (void*)glad_glMultiTexCoordP3uiv;
+            glad_glMultiTexCoordP3uiv = record_glMultiTexCoordP3uiv;
+        }
+        if (glad_glMultiTexCoordP4ui && glad_glMultiTexCoordP4ui != record_glMultiTexCoordP4ui)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoordP4ui] = (void*)glad_glMultiTexCoordP4ui;
+            glad_glMultiTexCoordP4ui = record_glMultiTexCoordP4ui;
+        }
+        if (glad_glMultiTexCoordP4uiv && glad_glMultiTexCoordP4uiv != record_glMultiTexCoordP4uiv)
+        {
+            Table<>::loaded[ENTRY_glMultiTexCoordP4uiv] = (void*)glad_glMultiTexCoordP4uiv;
+            glad_glMultiTexCoordP4uiv = record_glMultiTexCoordP4uiv;
+        }
+        if (glad_glNormalP3ui && glad_glNormalP3ui != record_glNormalP3ui)
+        {
+            Table<>::loaded[ENTRY_glNormalP3ui] = (void*)glad_glNormalP3ui;
+            glad_glNormalP3ui = record_glNormalP3ui;
+        }
+        if (glad_glNormalP3uiv && glad_glNormalP3uiv != record_glNormalP3uiv)
+        {
+            Table<>::loaded[ENTRY_glNormalP3uiv] = (void*)glad_glNormalP3uiv;
+            glad_glNormalP3uiv = record_glNormalP3uiv;
+        }
+        if (glad_glColorP3ui && glad_glColorP3ui != record_glColorP3ui)
+        {
+            Table<>::loaded[ENTRY_glColorP3ui] = (void*)glad_glColorP3ui;
+            glad_glColorP3ui = record_glColorP3ui;
+        }
+        if (glad_glColorP3uiv && glad_glColorP3uiv != record_glColorP3uiv)
+        {
+            Table<>::loaded[ENTRY_glColorP3uiv] = (void*)glad_glColorP3uiv;
+            glad_glColorP3uiv = record_glColorP3uiv;
+        }
+        if (glad_glColorP4ui && glad_glColorP4ui != record_glColorP4ui)
+        {
+            Table<>::loaded[ENTRY_glColorP4ui] = (void*)glad_glColorP4ui;
+            glad_glColorP4ui = record_glColorP4ui;
+        }
+        if (glad_glColorP4uiv && glad_glColorP4uiv != record_glColorP4uiv)
+        {
+            Table<>::loaded[ENTRY_glColorP4uiv] = (void*)glad_glColorP4uiv;
+            glad_glColorP4uiv = record_glColorP4uiv;
+        }
+        if (glad_glSecondaryColorP3ui && glad_glSecondaryColorP3ui != record_glSecondaryColorP3ui)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColorP3ui] = (void*)glad_glSecondaryColorP3ui;
+            glad_glSecondaryColorP3ui = record_glSecondaryColorP3ui;
+        }
+        if (glad_glSecondaryColorP3uiv && glad_glSecondaryColorP3uiv != record_glSecondaryColorP3uiv)
+        {
+            Table<>::loaded[ENTRY_glSecondaryColorP3uiv] = (void*)glad_glSecondaryColorP3uiv;
+            glad_glSecondaryColorP3uiv = record_glSecondaryColorP3uiv;
+        }
+    }
+    inline void uninstall()
+    {
+        if (glad_glCullFace == record_glCullFace)
+            glad_glCullFace = (PFNGLCULLFACEPROC)Table<>::loaded[ENTRY_glCullFace];
+        if (glad_glFrontFace == record_glFrontFace)
+            glad_glFrontFace = (PFNGLFRONTFACEPROC)Table<>::loaded[ENTRY_glFrontFace];
+        if (glad_glHint == record_glHint)
+            glad_glHint = (PFNGLHINTPROC)Table<>::loaded[ENTRY_glHint];
+        if (glad_glLineWidth == record_glLineWidth)
+            glad_glLineWidth = (PFNGLLINEWIDTHPROC)Table<>::loaded[ENTRY_glLineWidth];
+        if (glad_glPointSize == record_glPointSize)
+            glad_glPointSize = (PFNGLPOINTSIZEPROC)Table<>::loaded[ENTRY_glPointSize];
+        if (glad_glPolygonMode == record_glPolygonMode)
+            glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)Table<>::loaded[ENTRY_glPolygonMode];
+        if (glad_glScissor == record_glScissor)
+            glad_glScissor = (PFNGLSCISSORPROC)Table<>::loaded[ENTRY_glScissor];
+        if (glad_glTexParameterf == record_glTexParameterf)
+            glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)Table<>::loaded[ENTRY_glTexParameterf];
+        if (glad_glTexParameterfv == record_glTexParameterfv)
+            glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)Table<>::loaded[ENTRY_glTexParameterfv];
+        if (glad_glTexParameteri == record_glTexParameteri)
+            glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)Table<>::loaded[ENTRY_glTexParameteri];
+        if (glad_glTexParameteriv == record_glTexParameteriv)
+            glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)Table<>::loaded[ENTRY_glTexParameteriv];
+        if (glad_glTexImage1D == record_glTexImage1D)
+            glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)Table<>::loaded[ENTRY_glTexImage1D];
+        if (glad_glTexImage2D == record_glTexImage2D)
+            glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)Table<>::loaded[ENTRY_glTexImage2D];
+        if (glad_glDrawBuffer == record_glDrawBuffer)
+            glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)Table<>::loaded[ENTRY_glDrawBuffer];
+        if (glad_glClear == record_glClear)
+            glad_glClear = (PFNGLCLEARPROC)Table<>::loaded[ENTRY_glClear];
+        if (glad_glClearColor == record_glClearColor)
+            glad_glClearColor = (PFNGLCLEARCOLORPROC)Table<>::loaded[ENTRY_glClearColor];
+        if (glad_glClearStencil == record_glClearStencil)
+            glad_glClearStencil = (PFNGLCLEARSTENCILPROC)Table<>::loaded[ENTRY_glClearStencil];
+        if (glad_glClearDepth == record_glClearDepth)
+            glad_glClearDepth = (PFNGLCLEARDEPTHPROC)Table<>::loaded[ENTRY_glClearDepth];
+        if (glad_glStencilMask == record_glStencilMask)
+            glad_glStencilMask = (PFNGLSTENCILMASKPROC)Table<>::loaded[ENTRY_glStencilMask];
+        if (glad_glColorMask == record_glColorMask)
+            glad_glColorMask = (PFNGLCOLORMASKPROC)Table<>::loaded[ENTRY_glColorMask];
+        if (glad_glDepthMask == record_glDepthMask)
+            glad_glDepthMask = (PFNGLDEPTHMASKPROC)Table<>::loaded[ENTRY_glDepthMask];
+        if (glad_glDisable == record_glDisable)
+            glad_glDisable = (PFNGLDISABLEPROC)Table<>::loaded[ENTRY_glDisable];
+        if (glad_glEnable == record_glEnable)
+            glad_glEnable = (PFNGLENABLEPROC)Table<>::loaded[ENTRY_glEnable];
+        if (glad_glFinish == record_glFinish)
+            glad_glFinish = (PFNGLFINISHPROC)Table<>::loaded[ENTRY_glFinish];
+        if (glad_glFlush == record_glFlush)
+            glad_glFlush = (PFNGLFLUSHPROC)Table<>::loaded[ENTRY_glFlush];
+        if (glad_glBlendFunc == record_glBlendFunc)
+            glad_glBlendFunc = (PFNGLBLENDFUNCPROC)Table<>::loaded[ENTRY_glBlendFunc];
+        if (glad_glLogicOp == record_glLogicOp)
+            glad_glLogicOp = (PFNGLLOGICOPPROC)Table<>::loaded[ENTRY_glLogicOp];
+        if (glad_glStencilFunc == record_glStencilFunc)
+            glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)Table<>::loaded[ENTRY_glStencilFunc];
+        if (glad_glStencilOp == record_glStencilOp)
+            glad_glStencilOp = (PFNGLSTENCILOPPROC)Table<>::loaded[ENTRY_glStencilOp];
+        if (glad_glDepthFunc == record_glDepthFunc)
+            glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)Table<>::loaded[ENTRY_glDepthFunc];
+        if (glad_glPixelStoref == record_glPixelStoref)
+            glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)Table<>::loaded[ENTRY_glPixelStoref];
+        if (glad_glPixelStorei == record_glPixelStorei)
+            glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)Table<>::loaded[ENTRY_glPixelStorei];
+        if (glad_glReadBuffer == record_glReadBuffer)
+            glad_glReadBuffer = (PFNGLREADBUFFERPROC)Table<>::loaded[ENTRY_glReadBuffer];
+        if (glad_glReadPixels == record_glReadPixels)
+            glad_glReadPixels = (PFNGLREADPIXELSPROC)Table<>::loaded[ENTRY_glReadPixels];
+        if (glad_glDepthRange == record_glDepthRange)
+            glad_glDepthRange = (PFNGLDEPTHRANGEPROC)Table<>::loaded[ENTRY_glDepthRange];
+        if (glad_glViewport == record_glViewport)
+            glad_glViewport = (PFNGLVIEWPORTPROC)Table<>::loaded[ENTRY_glViewport];
+        if (glad_glNewList == record_glNewList)
+            glad_glNewList = (PFNGLNEWLISTPROC)Table<>::loaded[ENTRY_glNewList];
+        if (glad_glEndList == record_glEndList)
+            glad_glEndList = (PFNGLENDLISTPROC)Table<>::loaded[ENTRY_glEndList];
+        if (glad_glCallList == record_glCallList)
+            glad_glCallList = (PFNGLCALLLISTPROC)Table<>::loaded[ENTRY_glCallList];
+        if (glad_glCallLists == record_glCallLists)
+            glad_glCallLists = (PFNGLCALLLISTSPROC)Table<>::loaded[ENTRY_glCallLists];
+        if (glad_glDeleteLists == record_glDeleteLists)
+            glad_glDeleteLists = (PFNGLDELETELISTSPROC)Table<>::loaded[ENTRY_glDeleteLists];
+        if (glad_glGenLists == record_glGenLists)
+            glad_glGenLists = (PFNGLGENLISTSPROC)Table<>::loaded[ENTRY_glGenLists];
+        if (glad_glListBase == record_glListBase)
+            glad_glListBase = (PFNGLLISTBASEPROC)Table<>::loaded[ENTRY_glListBase];
+        if (glad_glBegin == record_glBegin)
+            glad_glBegin = (PFNGLBEGINPROC)Table<>::loaded[ENTRY_glBegin];
+        if (glad_glBitmap == record_glBitmap)
+            glad_glBitmap = (PFNGLBITMAPPROC)Table<>::loaded[ENTRY_glBitmap];
+        if (glad_glColor3b == record_glColor3b)
+            glad_glColor3b = (PFNGLCOLOR3BPROC)Table<>::loaded[ENTRY_glColor3b];
+        if (glad_glColor3bv == record_glColor3bv)
+            glad_glColor3bv = (PFNGLCOLOR3BVPROC)Table<>::loaded[ENTRY_glColor3bv];
+        if (glad_glColor3d == record_glColor3d)
+            glad_glColor3d = (PFNGLCOLOR3DPROC)Table<>::loaded[ENTRY_glColor3d];
+        if (glad_glColor3dv == record_glColor3dv)
+            glad_glColor3dv = (PFNGLCOLOR3DVPROC)Table<>::loaded[ENTRY_glColor3dv];
+        if (glad_glColor3f == record_glColor3f)
+            glad_glColor3f = (PFNGLCOLOR3FPROC)Table<>::loaded[ENTRY_glColor3f];
+        if (glad_glColor3fv == record_glColor3fv)
+            glad_glColor3fv = (PFNGLCOLOR3FVPROC)Table<>::loaded[ENTRY_glColor3fv];
+        if (glad_glColor3i == record_glColor3i)
+            glad_glColor3i = (PFNGLCOLOR3IPROC)Table<>::loaded[ENTRY_glColor3i];
+        if (glad_glColor3iv == record_glColor3iv)
+            glad_glColor3iv = (PFNGLCOLOR3IVPROC)Table<>::loaded[ENTRY_glColor3iv];
+        if (glad_glColor3s == record_glColor3s)
+            glad_glColor3s = (PFNGLCOLOR3SPROC)Table<>::loaded[ENTRY_glColor3s];
+        if (glad_glColor3sv == record_glColor3sv)
+            glad_glColor3sv = (PFNGLCOLOR3SVPROC)Table<>::loaded[ENTRY_glColor3sv];
+        if (glad_glColor3ub == record_glColor3ub)
+            glad_glColor3ub = (PFNGLCOLOR3UBPROC)Table<>::loaded[ENTRY_glColor3ub];
+        if (glad_glColor3ubv == record_glColor3ubv)
+            glad_glColor3ubv = (PFNGLCOLOR3UBVPROC)Table<>::loaded[ENTRY_glColor3ubv];
+        if (glad_glColor3ui == record_glColor3ui)
+            glad_glColor3ui = (PFNGLCOLOR3UIPROC)Table<>::loaded[ENTRY_glColor3ui];
+        if (glad_glColor3uiv == record_glColor3uiv)
+            glad_glColor3uiv = (PFNGLCOLOR3UIVPROC)Table<>::loaded[ENTRY_glColor3uiv];
+        if (glad_glColor3us == record_glColor3us)
+            glad_glColor3us = (PFNGLCOLOR3USPROC)Table<>::loaded[ENTRY_glColor3us];
+        if (glad_glColor3usv == record_glColor3usv)
+            glad_glColor3usv = (PFNGLCOLOR3USVPROC)Table<>::loaded[ENTRY_glColor3usv];
+        if (glad_glColor4b == record_glColor4b)
+            glad_glColor4b = (PFNGLCOLOR4BPROC)Table<>::loaded[ENTRY_glColor4b];
+        if (glad_glColor4bv == record_glColor4bv)
+            glad_glColor4bv = (PFNGLCOLOR4BVPROC)Table<>::loaded[ENTRY_glColor4bv];
+        if (glad_glColor4d == record_glColor4d)
+            glad_glColor4d = (PFNGLCOLOR4DPROC)Table<>::loaded[ENTRY_glColor4d];
+        if (glad_glColor4dv == record_glColor4dv)
+            glad_glColor4dv = (PFNGLCOLOR4DVPROC)Table<>::loaded[ENTRY_glColor4dv];
+        if (glad_glColor4f == record_glColor4f)
+            glad_glColor4f = (PFNGLCOLOR4FPROC)Table<>::loaded[ENTRY_glColor4f];
+        if (glad_glColor4fv == record_glColor4fv)
+            glad_glColor4fv = (PFNGLCOLOR4FVPROC)Table<>::loaded[ENTRY_glColor4fv];
+        if (glad_glColor4i == record_glColor4i)
+            glad_glColor4i = (PFNGLCOLOR4IPROC)Table<>::loaded[ENTRY_glColor4i];
+        if (glad_glColor4iv == record_glColor4iv)
+            glad_glColor4iv = (PFNGLCOLOR4IVPROC)Table<>::loaded[ENTRY_glColor4iv];
+        if (glad_glColor4s == record_glColor4s)
+            glad_glColor4s = (PFNGLCOLOR4SPROC)Table<>::loaded[ENTRY_glColor4s];
+        if (glad_glColor4sv == record_glColor4sv)
+            glad_glColor4sv = (PFNGLCOLOR4SVPROC)Table<>::loaded[ENTRY_glColor4sv];
+        if (glad_glColor4ub == record_glColor4ub)
+            glad_glColor4ub = (PFNGLCOLOR4UBPROC)Table<>::loaded[ENTRY_glColor4ub];
+        if (glad_glColor4ubv == record_glColor4ubv)
+            glad_glColor4ubv = (PFNGLCOLOR4UBVPROC)Table<>::loaded[ENTRY_glColor4ubv];
+        if (glad_glColor4ui == record_glColor4ui)
+            glad_glColor4ui = (PFNGLCOLOR4UIPROC)Table<>::loaded[ENTRY_glColor4ui];
+        if (glad_glColor4uiv == record_glColor4uiv)
+            glad_glColor4uiv = (PFNGLCOLOR4UIVPROC)Table<>::loaded[ENTRY_glColor4uiv];
+        if (glad_glColor4us == record_glColor4us)
+            glad_glColor4us = (PFNGLCOLOR4USPROC)Table<>::loaded[ENTRY_glColor4us];
+        if (glad_glColor4usv == record_glColor4usv)
+            glad_glColor4usv = (PFNGLCOLOR4USVPROC)Table<>::loaded[ENTRY_glColor4usv];
+        if (glad_glEdgeFlag == record_glEdgeFlag)
+            glad_glEdgeFlag = (PFNGLEDGEFLAGPROC)Table<>::loaded[ENTRY_glEdgeFlag];
+        if (glad_glEdgeFlagv == record_glEdgeFlagv)
+            glad_glEdgeFlagv = (PFNGLEDGEFLAGVPROC)Table<>::loaded[ENTRY_glEdgeFlagv];
+        if (glad_glEnd == record_glEnd)
+            glad_glEnd = (PFNGLENDPROC)Table<>::loaded[ENTRY_glEnd];
+        if (glad_glIndexd == record_glIndexd)
+            glad_glIndexd = (PFNGLINDEXDPROC)Table<>::loaded[ENTRY_glIndexd];
+        if (glad_glIndexdv == record_glIndexdv)
+            glad_glIndexdv = (PFNGLINDEXDVPROC)Table<>::loaded[ENTRY_glIndexdv];
+        if (glad_glIndexf == record_glIndexf)
+            glad_glIndexf = (PFNGLINDEXFPROC)Table<>::loaded[ENTRY_glIndexf];
+        if (glad_glIndexfv == record_glIndexfv)
+            glad_glIndexfv = (PFNGLINDEXFVPROC)Table<>::loaded[ENTRY_glIndexfv];
+        if (glad_glIndexi == record_glIndexi)
+            glad_glIndexi = (PFNGLINDEXIPROC)Table<>::loaded[ENTRY_glIndexi];
+        if (glad_glIndexiv == record_glIndexiv)
+            glad_glIndexiv = (PFNGLINDEXIVPROC)Table<>::loaded[ENTRY_glIndexiv];
+        if (glad_glIndexs == record_glIndexs)
+            glad_glIndexs = (PFNGLINDEXSPROC)Table<>::loaded[ENTRY_glIndexs];
+        if (glad_glIndexsv == record_glIndexsv)
+            glad_glIndexsv = (PFNGLINDEXSVPROC)Table<>::loaded[ENTRY_glIndexsv];
+        if (glad_glNormal3b == record_glNormal3b)
+            glad_glNormal3b = (PFNGLNORMAL3BPROC)Table<>::loaded[ENTRY_glNormal3b];
+        if (glad_glNormal3bv == record_glNormal3bv)
+            glad_glNormal3bv = (PFNGLNORMAL3BVPROC)Table<>::loaded[ENTRY_glNormal3bv];
+        if (glad_glNormal3d == record_glNormal3d)
+            glad_glNormal3d = (PFNGLNORMAL3DPROC)Table<>::loaded[ENTRY_glNormal3d];
+        if (glad_glNormal3dv == record_glNormal3dv)
+            glad_glNormal3dv = (PFNGLNORMAL3DVPROC)Table<>::loaded[ENTRY_glNormal3dv];
+        if (glad_glNormal3f == record_glNormal3f)
+            glad_glNormal3f = (PFNGLNORMAL3FPROC)Table<>::loaded[ENTRY_glNormal3f];
+        if (glad_glNormal3fv == record_glNormal3fv)
+            glad_glNormal3fv = (PFNGLNORMAL3FVPROC)Table<>::loaded[ENTRY_glNormal3fv];
+        if (glad_glNormal3i == record_glNormal3i)
+            glad_glNormal3i = (PFNGLNORMAL3IPROC)Table<>::loaded[ENTRY_glNormal3i];
+        if (glad_glNormal3iv == record_glNormal3iv)
+            glad_glNormal3iv = (PFNGLNORMAL3IVPROC)Table<>::loaded[ENTRY_glNormal3iv];
+        if (glad_glNormal3s == record_glNormal3s)
+            glad_glNormal3s = (PFNGLNORMAL3SPROC)Table<>::loaded[ENTRY_glNormal3s];
+        if (glad_glNormal3sv == record_glNormal3sv)
+            glad_glNormal3sv = (PFNGLNORMAL3SVPROC)Table<>::loaded[ENTRY_glNormal3sv];
+        if (glad_glRasterPos2d == record_glRasterPos2d)
+            glad_glRasterPos2d = (PFNGLRASTERPOS2DPROC)Table<>::loaded[ENTRY_glRasterPos2d];
+        if (glad_glRasterPos2dv == record_glRasterPos2dv)
+            glad_glRasterPos2dv = (PFNGLRASTERPOS2DVPROC)Table<>::loaded[ENTRY_glRasterPos2dv];
+        if (glad_glRasterPos2f == record_glRasterPos2f)
+            glad_glRasterPos2f = (PFNGLRASTERPOS2FPROC)Table<>::loaded[ENTRY_glRasterPos2f];
+        if (glad_glRasterPos2fv == record_glRasterPos2fv)
+            glad_glRasterPos2fv = (PFNGLRASTERPOS2FVPROC)Table<>::loaded[ENTRY_glRasterPos2fv];
+        if (glad_glRasterPos2i == record_glRasterPos2i)
+            glad_glRasterPos2i = (PFNGLRASTERPOS2IPROC)Table<>::loaded[ENTRY_glRasterPos2i];
+        if (glad_glRasterPos2iv == record_glRasterPos2iv)
+            glad_glRasterPos2iv = (PFNGLRASTERPOS2IVPROC)Table<>::loaded[ENTRY_glRasterPos2iv];
+        if (glad_glRasterPos2s == record_glRasterPos2s)
+            glad_glRasterPos2s = (PFNGLRASTERPOS2SPROC)Table<>::loaded[ENTRY_glRasterPos2s];
+        if (glad_glRasterPos2sv == record_glRasterPos2sv)
+            glad_glRasterPos2sv = (PFNGLRASTERPOS2SVPROC)Table<>::loaded[ENTRY_glRasterPos2sv];
+        if (glad_glRasterPos3d == record_glRasterPos3d)
+            glad_glRasterPos3d = (PFNGLRASTERPOS3DPROC)Table<>::loaded[ENTRY_glRasterPos3d];
+        if (glad_glRasterPos3dv == record_glRasterPos3dv)
+            glad_glRasterPos3dv = (PFNGLRASTERPOS3DVPROC)Table<>::loaded[ENTRY_glRasterPos3dv];
+        if (glad_glRasterPos3f == record_glRasterPos3f)
+            glad_glRasterPos3f = (PFNGLRASTERPOS3FPROC)Table<>::loaded[ENTRY_glRasterPos3f];
+        if (glad_glRasterPos3fv == record_glRasterPos3fv)
+            glad_glRasterPos3fv = (PFNGLRASTERPOS3FVPROC)Table<>::loaded[ENTRY_glRasterPos3fv];
+        if (glad_glRasterPos3i == record_glRasterPos3i)
+            glad_glRasterPos3i = (PFNGLRASTERPOS3IPROC)Table<>::loaded[ENTRY_glRasterPos3i];
+        if (glad_glRasterPos3iv == record_glRasterPos3iv)
+            glad_glRasterPos3iv = (PFNGLRASTERPOS3IVPROC)Table<>::loaded[ENTRY_glRasterPos3iv];
+        if (glad_glRasterPos3s == record_glRasterPos3s)
+            glad_glRasterPos3s = (PFNGLRASTERPOS3SPROC)Table<>::loaded[ENTRY_glRasterPos3s];
+        if (glad_glRasterPos3sv == record_glRasterPos3sv)
+            glad_glRasterPos3sv = (PFNGLRASTERPOS3SVPROC)Table<>::loaded[ENTRY_glRasterPos3sv];
+        if (glad_glRasterPos4d == record_glRasterPos4d)
+            glad_glRasterPos4d = (PFNGLRASTERPOS4DPROC)Table<>::loaded[ENTRY_glRasterPos4d];
+        if (glad_glRasterPos4dv == record_glRasterPos4dv)
+            glad_glRasterPos4dv = (PFNGLRASTERPOS4DVPROC)Table<>::loaded[ENTRY_glRasterPos4dv];
+        if (glad_glRasterPos4f == record_glRasterPos4f)
+            glad_glRasterPos4f = (PFNGLRASTERPOS4FPROC)Table<>::loaded[ENTRY_glRasterPos4f];
+        if (glad_glRasterPos4fv == record_glRasterPos4fv)
+            glad_glRasterPos4fv = (PFNGLRASTERPOS4FVPROC)Table<>::loaded[ENTRY_glRasterPos4fv];
+        if (glad_glRasterPos4i == record_glRasterPos4i)
+            glad_glRasterPos4i = (PFNGLRASTERPOS4IPROC)Table<>::loaded[ENTRY_glRasterPos4i];
+        if (glad_glRasterPos4iv == record_glRasterPos4iv)
+            glad_glRasterPos4iv = (PFNGLRASTERPOS4IVPROC)Table<>::loaded[ENTRY_glRasterPos4iv];
+        if (glad_glRasterPos4s == record_glRasterPos4s)
+            glad_glRasterPos4s = (PFNGLRASTERPOS4SPROC)Table<>::loaded[ENTRY_glRasterPos4s];
+        if (glad_glRasterPos4sv == record_glRasterPos4sv)
+            glad_glRasterPos4sv = (PFNGLRASTERPOS4SVPROC)Table<>::loaded[ENTRY_glRasterPos4sv];
+        if (glad_glRectd == record_glRectd)
+            glad_glRectd = (PFNGLRECTDPROC)Table<>::loaded[ENTRY_glRectd];
+        if (glad_glRectdv == record_glRectdv)
+            glad_glRectdv = (PFNGLRECTDVPROC)Table<>::loaded[ENTRY_glRectdv];
+        if (glad_glRectf == record_glRectf)
+            glad_glRectf = (PFNGLRECTFPROC)Table<>::loaded[ENTRY_glRectf];
+        if (glad_glRectfv == record_glRectfv)
+            glad_glRectfv = (PFNGLRECTFVPROC)Table<>::loaded[ENTRY_glRectfv];
+        if (glad_glRecti == record_glRecti)
+            glad_glRecti = (PFNGLRECTIPROC)Table<>::loaded[ENTRY_glRecti];
+        if (glad_glRectiv == record_glRectiv)
+            glad_glRectiv = (PFNGLRECTIVPROC)Table<>::loaded[ENTRY_glRectiv];
+        if (glad_glRects == record_glRects)
+            glad_glRects = (PFNGLRECTSPROC)Table<>::loaded[ENTRY_glRects];
+        if (glad_glRectsv == record_glRectsv)
+            glad_glRectsv = (PFNGLRECTSVPROC)Table<>::loaded[ENTRY_glRectsv];
+        if (glad_glTexCoord1d == record_glTexCoord1d)
+            glad_glTexCoord1d = (PFNGLTEXCOORD1DPROC)Table<>::loaded[ENTRY_glTexCoord1d];
+        if (glad_glTexCoord1dv == record_glTexCoord1dv)
+            glad_glTexCoord1dv = (PFNGLTEXCOORD1DVPROC)Table<>::loaded[ENTRY_glTexCoord1dv];
+        if (glad_glTexCoord1f == record_glTexCoord1f)
+            glad_glTexCoord1f = (PFNGLTEXCOORD1FPROC)Table<>::loaded[ENTRY_glTexCoord1f];
+        if (glad_glTexCoord1fv == record_glTexCoord1fv)
+            glad_glTexCoord1fv = (PFNGLTEXCOORD1FVPROC)Table<>::loaded[ENTRY_glTexCoord1fv];
+        if (glad_glTexCoord1i == record_glTexCoord1i)
+            glad_glTexCoord1i = (PFNGLTEXCOORD1IPROC)Table<>::loaded[ENTRY_glTexCoord1i];
+        if (glad_glTexCoord1iv == record_glTexCoord1iv)
+            glad_glTexCoord1iv = (PFNGLTEXCOORD1IVPROC)Table<>::loaded[ENTRY_glTexCoord1iv];
+        if (glad_glTexCoord1s == record_glTexCoord1s)
+            glad_glTexCoord1s = (PFNGLTEXCOORD1SPROC)Table<>::loaded[ENTRY_glTexCoord1s];
+        if (glad_glTexCoord1sv == record_glTexCoord1sv)
+            glad_glTexCoord1sv = (PFNGLTEXCOORD1SVPROC)Table<>::loaded[ENTRY_glTexCoord1sv];
+        if (glad_glTexCoord2d == record_glTexCoord2d)
+            glad_glTexCoord2d = (PFNGLTEXCOORD2DPROC)Table<>::loaded[ENTRY_glTexCoord2d];
+        if (glad_glTexCoord2dv == record_glTexCoord2dv)
+            glad_glTexCoord2dv = (PFNGLTEXCOORD2DVPROC)Table<>::loaded[ENTRY_glTexCoord2dv];
+        if (glad_glTexCoord2f == record_glTexCoord2f)
+            glad_glTexCoord2f = (PFNGLTEXCOORD2FPROC)Table<>::loaded[ENTRY_glTexCoord2f];
+        if (glad_glTexCoord2fv == record_glTexCoord2fv)
+            glad_glTexCoord2fv = (PFNGLTEXCOORD2FVPROC)Table<>::loaded[ENTRY_glTexCoord2fv];
+        if (glad_glTexCoord2i == record_glTexCoord2i)
+            glad_glTexCoord2i = (PFNGLTEXCOORD2IPROC)Table<>::loaded[ENTRY_glTexCoord2i];
+        if (glad_glTexCoord2iv == record_glTexCoord2iv)
+            glad_glTexCoord2iv = (PFNGLTEXCOORD2IVPROC)Table<>::loaded[ENTRY_glTexCoord2iv];
+        if (glad_glTexCoord2s == record_glTexCoord2s)
+            glad_glTexCoord2s = (PFNGLTEXCOORD2SPROC)Table<>::loaded[ENTRY_glTexCoord2s];
+        if (glad_glTexCoord2sv == record_glTexCoord2sv)
+            glad_glTexCoord2sv = (PFNGLTEXCOORD2SVPROC)Table<>::loaded[ENTRY_glTexCoord2sv];
+        if (glad_glTexCoord3d == record_glTexCoord3d)
+            glad_glTexCoord3d = (PFNGLTEXCOORD3DPROC)Table<>::loaded[ENTRY_glTexCoord3d];
+        if (glad_glTexCoord3dv == record_glTexCoord3dv)
+            glad_glTexCoord3dv = (PFNGLTEXCOORD3DVPROC)Table<>::loaded[ENTRY_glTexCoord3dv];
+        if (glad_glTexCoord3f == record_glTexCoord3f)
+            glad_glTexCoord3f = (PFNGLTEXCOORD3FPROC)Table<>::loaded[ENTRY_glTexCoord3f];
+        if (glad_glTexCoord3fv == record_glTexCoord3fv)
+            glad_glTexCoord3fv = (PFNGLTEXCOORD3FVPROC)Table<>::loaded[ENTRY_glTexCoord3fv];
+        if (glad_glTexCoord3i == record_glTexCoord3i)
+            glad_glTexCoord3i = (PFNGLTEXCOORD3IPROC)Table<>::loaded[ENTRY_glTexCoord3i];
+        if (glad_glTexCoord3iv == record_glTexCoord3iv)
+            glad_glTexCoord3iv = (PFNGLTEXCOORD3IVPROC)Table<>::loaded[ENTRY_glTexCoord3iv];
+        if (glad_glTexCoord3s == record_glTexCoord3s)
+            glad_glTexCoord3s = (PFNGLTEXCOORD3SPROC)Table<>::loaded[ENTRY_glTexCoord3s];
+        if (glad_glTexCoord3sv == record_glTexCoord3sv)
+            glad_glTexCoord3sv = (PFNGLTEXCOORD3SVPROC)Table<>::loaded[ENTRY_glTexCoord3sv];
+        if (glad_glTexCoord4d == record_glTexCoord4d)
+            glad_glTexCoord4d = (PFNGLTEXCOORD4DPROC)Table<>::loaded[ENTRY_glTexCoord4d];
+        if (glad_glTexCoord4dv == record_glTexCoord4dv)
+            glad_glTexCoord4dv = (PFNGLTEXCOORD4DVPROC)Table<>::loaded[ENTRY_glTexCoord4dv];
+        if (glad_glTexCoord4f == record_glTexCoord4f)
+            glad_glTexCoord4f = (PFNGLTEXCOORD4FPROC)Table<>::loaded[ENTRY_glTexCoord4f];
+        if (glad_glTexCoord4fv == record_glTexCoord4fv)
+            glad_glTexCoord4fv = (PFNGLTEXCOORD4FVPROC)Table<>::loaded[ENTRY_glTexCoord4fv];
+        if (glad_glTexCoord4i == record_glTexCoord4i)
+            glad_glTexCoord4i = (PFNGLTEXCOORD4IPROC)Table<>::loaded[ENTRY_glTexCoord4i];
+        if (glad_glTexCoord4iv == record_glTexCoord4iv)
+            glad_glTexCoord4iv = (PFNGLTEXCOORD4IVPROC)Table<>::loaded[ENTRY_glTexCoord4iv];
+        if (glad_glTexCoord4s == record_glTexCoord4s)
+            glad_glTexCoord4s = (PFNGLTEXCOORD4SPROC)Table<>::loaded[ENTRY_glTexCoord4s];
+        if (glad_glTexCoord4sv == record_glTexCoord4sv)
+            glad_glTexCoord4sv = (PFNGLTEXCOORD4SVPROC)Table<>::loaded[ENTRY_glTexCoord4sv];
+        if (glad_glVertex2d == record_glVertex2d)
+            glad_glVertex2d = (PFNGLVERTEX2DPROC)Table<>::loaded[ENTRY_glVertex2d];
+        if (glad_glVertex2dv == record_glVertex2dv)
+            glad_glVertex2dv = (PFNGLVERTEX2DVPROC)Table<>::loaded[ENTRY_glVertex2dv];
+        if (glad_glVertex2f == record_glVertex2f)
+            glad_glVertex2f = (PFNGLVERTEX2FPROC)Table<>::loaded[ENTRY_glVertex2f];
+        if (glad_glVertex2fv == record_glVertex2fv)
+            glad_glVertex2fv = (PFNGLVERTEX2FVPROC)Table<>::loaded[ENTRY_glVertex2fv];
+        if (glad_glVertex2i == record_glVertex2i)
+            glad_glVertex2i = (PFNGLVERTEX2IPROC)Table<>::loaded[ENTRY_glVertex2i];
+        if (glad_glVertex2iv == record_glVertex2iv)
+            glad_glVertex2iv = (PFNGLVERTEX2IVPROC)Table<>::loaded[ENTRY_glVertex2iv];
+        if (glad_glVertex2s == record_glVertex2s)
+            glad_glVertex2s = (PFNGLVERTEX2SPROC)Table<>::loaded[ENTRY_glVertex2s];
+        if (glad_glVertex2sv == record_glVertex2sv)
+            glad_glVertex2sv = (PFNGLVERTEX2SVPROC)Table<>::loaded[ENTRY_glVertex2sv];
+        if (glad_glVertex3d == record_glVertex3d)
+            glad_glVertex3d = (PFNGLVERTEX3DPROC)Table<>::loaded[ENTRY_glVertex3d];
+        if (glad_glVertex3dv == record_glVertex3dv)
+            glad_glVertex3dv = (PFNGLVERTEX3DVPROC)Table<>::loaded[ENTRY_glVertex3dv];
+        if (glad_glVertex3f == record_glVertex3f)
+            glad_glVertex3f = (PFNGLVERTEX3FPROC)Table<>::loaded[ENTRY_glVertex3f];
+        if (glad_glVertex3fv == record_glVertex3fv)
+            glad_glVertex3fv = (PFNGLVERTEX3FVPROC)Table<>::loaded[ENTRY_glVertex3fv];
+        if (glad_glVertex3i == record_glVertex3i)
+            glad_glVertex3i = (PFNGLVERTEX3IPROC)Table<>::loaded[ENTRY_glVertex3i];
+        if (glad_glVertex3iv == record_glVertex3iv)
+            glad_glVertex3iv = (PFNGLVERTEX3IVPROC)Table<>::loaded[ENTRY_glVertex3iv];
+        if (glad_glVertex3s == record_glVertex3s)
+            glad_glVertex3s = (PFNGLVERTEX3SPROC)Table<>::loaded[ENTRY_glVertex3s];
+        if (glad_glVertex3sv == record_glVertex3sv)
+            glad_glVertex3sv = (PFNGLVERTEX3SVPROC)Table<>::loaded[ENTRY_glVertex3sv];
+        if (glad_glVertex4d == record_glVertex4d)
+            glad_glVertex4d = (PFNGLVERTEX4DPROC)Table<>::loaded[ENTRY_glVertex4d];
+        if (glad_glVertex4dv == record_glVertex4dv)
+            glad_glVertex4dv = (PFNGLVERTEX4DVPROC)Table<>::loaded[ENTRY_glVertex4dv];
+        if (glad_glVertex4f == record_glVertex4f)
+            glad_glVertex4f = (PFNGLVERTEX4FPROC)Table<>::loaded[ENTRY_glVertex4f];
+        if (glad_glVertex4fv == record_glVertex4fv)
+            glad_glVertex4fv = (PFNGLVERTEX4FVPROC)Table<>::loaded[ENTRY_glVertex4fv];
+        if (glad_glVertex4i == record_glVertex4i)
+            glad_glVertex4i = (PFNGLVERTEX4IPROC)Table<>::loaded[ENTRY_glVertex4i];
+        if (glad_glVertex4iv == record_glVertex4iv)
+            glad_glVertex4iv = (PFNGLVERTEX4IVPROC)Table<>::loaded[ENTRY_glVertex4iv];
+        if (glad_glVertex4s == record_glVertex4s)
+            glad_glVertex4s = (PFNGLVERTEX4SPROC)Table<>::loaded[ENTRY_glVertex4s];
+        if (glad_glVertex4sv == record_glVertex4sv)
+            glad_glVertex4sv = (PFNGLVERTEX4SVPROC)Table<>::loaded[ENTRY_glVertex4sv];
+        if (glad_glClipPlane == record_glClipPlane)
+            glad_glClipPlane = (PFNGLCLIPPLANEPROC)Table<>::loaded[ENTRY_glClipPlane];
+        if (glad_glColorMaterial == record_glColorMaterial)
+            glad_glColorMaterial = (PFNGLCOLORMATERIALPROC)Table<>::loaded[ENTRY_glColorMaterial];
+        if (glad_glFogf == record_glFogf)
+            glad_glFogf = (PFNGLFOGFPROC)Table<>::loaded[ENTRY_glFogf];
+        if (glad_glFogfv == record_glFogfv)
+            glad_glFogfv = (PFNGLFOGFVPROC)Table<>::loaded[ENTRY_glFogfv];
+        if (glad_glFogi == record_glFogi)
+            glad_glFogi = (PFNGLFOGIPROC)Table<>::loaded[ENTRY_glFogi];
+        if (glad_glFogiv == record_glFogiv)
+            glad_glFogiv = (PFNGLFOGIVPROC)Table<>::loaded[ENTRY_glFogiv];
+        if (glad_glLightf == record_glLightf)
+            glad_glLightf = (PFNGLLIGHTFPROC)Table<>::loaded[ENTRY_glLightf];
+        if (glad_glLightfv == record_glLightfv)
+            glad_glLightfv = (PFNGLLIGHTFVPROC)Table<>::loaded[ENTRY_glLightfv];
+        if (glad_glLighti == record_glLighti)
+            glad_glLighti = (PFNGLLIGHTIPROC)Table<>::loaded[ENTRY_glLighti];
+        if (glad_glLightiv == record_glLightiv)
+            glad_glLightiv = (PFNGLLIGHTIVPROC)Table<>::loaded[ENTRY_glLightiv];
+        if (glad_glLightModelf == record_glLightModelf)
+            glad_glLightModelf = (PFNGLLIGHTMODELFPROC)Table<>::loaded[ENTRY_glLightModelf];
+        if (glad_glLightModelfv == record_glLightModelfv)
+            glad_glLightModelfv = (PFNGLLIGHTMODELFVPROC)Table<>::loaded[ENTRY_glLightModelfv];
+        if (glad_glLightModeli == record_glLightModeli)
+            glad_glLightModeli = (PFNGLLIGHTMODELIPROC)Table<>::loaded[ENTRY_glLightModeli];
+        if (glad_glLightModeliv == record_glLightModeliv)
+            glad_glLightModeliv = (PFNGLLIGHTMODELIVPROC)Table<>::loaded[ENTRY_glLightModeliv];
+        if (glad_glLineStipple == record_glLineStipple)
+            glad_glLineStipple = (PFNGLLINESTIPPLEPROC)Table<>::loaded[ENTRY_glLineStipple];
+        if (glad_glMaterialf == record_glMaterialf)
+            glad_glMaterialf = (PFNGLMATERIALFPROC)Table<>::loaded[ENTRY_glMaterialf];
+        if (glad_glMaterialfv == record_glMaterialfv)
+            glad_glMaterialfv = (PFNGLMATERIALFVPROC)Table<>::loaded[ENTRY_glMaterialfv];
+        if (glad_glMateriali == record_glMateriali)
+            glad_glMateriali = (PFNGLMATERIALIPROC)Table<>::loaded[ENTRY_glMateriali];
+        if (glad_glMaterialiv == record_glMaterialiv)
+            glad_glMaterialiv = (PFNGLMATERIALIVPROC)Table<>::loaded[ENTRY_glMaterialiv];
+        if (glad_glPolygonStipple == record_glPolygonStipple)
+            glad_glPolygonStipple = (PFNGLPOLYGONSTIPPLEPROC)Table<>::loaded[ENTRY_glPolygonStipple];
+        if (glad_glShadeModel == record_glShadeModel)
+            glad_glShadeModel = (PFNGLSHADEMODELPROC)Table<>::loaded[ENTRY_glShadeModel];
+        if (glad_glTexEnvf == record_glTexEnvf)
+            glad_glTexEnvf = (PFNGLTEXENVFPROC)Table<>::loaded[ENTRY_glTexEnvf];
+        if (glad_glTexEnvfv == record_glTexEnvfv)
+            glad_glTexEnvfv = (PFNGLTEXENVFVPROC)Table<>::loaded[ENTRY_glTexEnvfv];
+        if (glad_glTexEnvi == record_glTexEnvi)
+            glad_glTexEnvi = (PFNGLTEXENVIPROC)Table<>::loaded[ENTRY_glTexEnvi];
+        if (glad_glTexEnviv == record_glTexEnviv)
+            glad_glTexEnviv = (PFNGLTEXENVIVPROC)Table<>::loaded[ENTRY_glTexEnviv];
+        if (glad_glTexGend == record_glTexGend)
+            glad_glTexGend = (PFNGLTEXGENDPROC)Table<>::loaded[ENTRY_glTexGend];
+        if (glad_glTexGendv == record_glTexGendv)
+            glad_glTexGendv = (PFNGLTEXGENDVPROC)Table<>::loaded[ENTRY_glTexGendv];
+        if (glad_glTexGenf == record_glTexGenf)
+            glad_glTexGenf = (PFNGLTEXGENFPROC)Table<>::loaded[ENTRY_glTexGenf];
+        if (glad_glTexGenfv == record_glTexGenfv)
+            glad_glTexGenfv = (PFNGLTEXGENFVPROC)Table<>::loaded[ENTRY_glTexGenfv];
+        if (glad_glTexGeni == record_glTexGeni)
+            glad_glTexGeni = (PFNGLTEXGENIPROC)Table<>::loaded[ENTRY_glTexGeni];
+        if (glad_glTexGeniv == record_glTexGeniv)
+            glad_glTexGeniv = (PFNGLTEXGENIVPROC)Table<>::loaded[ENTRY_glTexGeniv];
+        if (glad_glFeedbackBuffer == record_glFeedbackBuffer)
+            glad_glFeedbackBuffer = (PFNGLFEEDBACKBUFFERPROC)Table<>::loaded[ENTRY_glFeedbackBuffer];
+        if (glad_glSelectBuffer == record_glSelectBuffer)
+            glad_glSelectBuffer = (PFNGLSELECTBUFFERPROC)Table<>::loaded[ENTRY_glSelectBuffer];
+        if (glad_glInitNames == record_glInitNames)
+            glad_glInitNames = (PFNGLINITNAMESPROC)Table<>::loaded[ENTRY_glInitNames];
+        if (glad_glLoadName == record_glLoadName)
+            glad_glLoadName = (PFNGLLOADNAMEPROC)Table<>::loaded[ENTRY_glLoadName];
+        if (glad_glPassThrough == record_glPassThrough)
+            glad_glPassThrough = (PFNGLPASSTHROUGHPROC)Table<>::loaded[ENTRY_glPassThrough];
+        if (glad_glPopName == record_glPopName)
+            glad_glPopName = (PFNGLPOPNAMEPROC)Table<>::loaded[ENTRY_glPopName];
+        if (glad_glPushName == record_glPushName)
+            glad_glPushName = (PFNGLPUSHNAMEPROC)Table<>::loaded[ENTRY_glPushName];
+        if (glad_glClearAccum == record_glClearAccum)
+            glad_glClearAccum = (PFNGLCLEARACCUMPROC)Table<>::loaded[ENTRY_glClearAccum];
+        if (glad_glClearIndex == record_glClearIndex)
+            glad_glClearIndex = (PFNGLCLEARINDEXPROC)Table<>::loaded[ENTRY_glClearIndex];
+        if (glad_glIndexMask == record_glIndexMask)
+            glad_glIndexMask = (PFNGLINDEXMASKPROC)Table<>::loaded[ENTRY_glIndexMask];
+        if (glad_glAccum == record_glAccum)
+            glad_glAccum = (PFNGLACCUMPROC)Table<>::loaded[ENTRY_glAccum];
+        if (glad_glPopAttrib == record_glPopAttrib)
+            glad_glPopAttrib = (PFNGLPOPATTRIBPROC)Table<>::loaded[ENTRY_glPopAttrib];
+        if (glad_glPushAttrib == record_glPushAttrib)
+            glad_glPushAttrib = (PFNGLPUSHATTRIBPROC)Table<>::loaded[ENTRY_glPushAttrib];
+        if (glad_glMap1d == record_glMap1d)
+            glad_glMap1d = (PFNGLMAP1DPROC)Table<>::loaded[ENTRY_glMap1d];
+        if (glad_glMap1f == record_glMap1f)
+            glad_glMap1f = (PFNGLMAP1FPROC)Table<>::loaded[ENTRY_glMap1f];
+        if (glad_glMap2d == record_glMap2d)
+            glad_glMap2d = (PFNGLMAP2DPROC)Table<>::loaded[ENTRY_glMap2d];
+        if (glad_glMap2f == record_glMap2f)
+            glad_glMap2f = (PFNGLMAP2FPROC)Table<>::loaded[ENTRY_glMap2f];
+        if (glad_glMapGrid1d == record_glMapGrid1d)
+            glad_glMapGrid1d = (PFNGLMAPGRID1DPROC)Table<>::loaded[ENTRY_glMapGrid1d];
+        if (glad_glMapGrid1f == record_glMapGrid1f)
+            glad_glMapGrid1f = (PFNGLMAPGRID1FPROC)Table<>::loaded[ENTRY_glMapGrid1f];
+        if (glad_glMapGrid2d == record_glMapGrid2d)
+            glad_glMapGrid2d = (PFNGLMAPGRID2DPROC)Table<>::loaded[ENTRY_glMapGrid2d];
+        if (glad_glMapGrid2f == record_glMapGrid2f)
+            glad_glMapGrid2f = (PFNGLMAPGRID2FPROC)Table<>::loaded[ENTRY_glMapGrid2f];
+        if (glad_glEvalCoord1d == record_glEvalCoord1d)
+            glad_glEvalCoord1d = (PFNGLEVALCOORD1DPROC)Table<>::loaded[ENTRY_glEvalCoord1d];
+        if (glad_glEvalCoord1dv == record_glEvalCoord1dv)
+            glad_glEvalCoord1dv = (PFNGLEVALCOORD1DVPROC)Table<>::loaded[ENTRY_glEvalCoord1dv];
+        if (glad_glEvalCoord1f == record_glEvalCoord1f)
+            glad_glEvalCoord1f = (PFNGLEVALCOORD1FPROC)Table<>::loaded[ENTRY_glEvalCoord1f];
+        if (glad_glEvalCoord1fv == record_glEvalCoord1fv)
+            glad_glEvalCoord1fv = (PFNGLEVALCOORD1FVPROC)Table<>::loaded[ENTRY_glEvalCoord1fv];
+        if (glad_glEvalCoord2d == record_glEvalCoord2d)
+            glad_glEvalCoord2d = (PFNGLEVALCOORD2DPROC)Table<>::loaded[ENTRY_glEvalCoord2d];
+        if (glad_glEvalCoord2dv == record_glEvalCoord2dv)
+            glad_glEvalCoord2dv = (PFNGLEVALCOORD2DVPROC)Table<>::loaded[ENTRY_glEvalCoord2dv];
+        if (glad_glEvalCoord2f == record_glEvalCoord2f)
+            glad_glEvalCoord2f = (PFNGLEVALCOORD2FPROC)Table<>::loaded[ENTRY_glEvalCoord2f];
+        if (glad_glEvalCoord2fv == record_glEvalCoord2fv)
+            glad_glEvalCoord2fv = (PFNGLEVALCOORD2FVPROC)Table<>::loaded[ENTRY_glEvalCoord2fv];
+        if (glad_glEvalMesh1 == record_glEvalMesh1)
+            glad_glEvalMesh1 = (PFNGLEVALMESH1PROC)Table<>::loaded[ENTRY_glEvalMesh1];
+        if (glad_glEvalPoint1 == record_glEvalPoint1)
+            glad_glEvalPoint1 = (PFNGLEVALPOINT1PROC)Table<>::loaded[ENTRY_glEvalPoint1];
+        if (glad_glEvalMesh2 == record_glEvalMesh2)
+            glad_glEvalMesh2 = (PFNGLEVALMESH2PROC)Table<>::loaded[ENTRY_glEvalMesh2];
+        if (glad_glEvalPoint2 == record_glEvalPoint2)
+            glad_glEvalPoint2 = (PFNGLEVALPOINT2PROC)Table<>::loaded[ENTRY_glEvalPoint2];
+        if (glad_glAlphaFunc == record_glAlphaFunc)
+            glad_glAlphaFunc = (PFNGLALPHAFUNCPROC)Table<>::loaded[ENTRY_glAlphaFunc];
+        if (glad_glPixelZoom == record_glPixelZoom)
+            glad_glPixelZoom = (PFNGLPIXELZOOMPROC)Table<>::loaded[ENTRY_glPixelZoom];
+        if (glad_glPixelTransferf == record_glPixelTransferf)
+            glad_glPixelTransferf = (PFNGLPIXELTRANSFERFPROC)Table<>::loaded[ENTRY_glPixelTransferf];
+        if (glad_glPixelTransferi == record_glPixelTransferi)
+            glad_glPixelTransferi = (PFNGLPIXELTRANSFERIPROC)Table<>::loaded[ENTRY_glPixelTransferi];
+        if (glad_glPixelMapfv == record_glPixelMapfv)
+            glad_glPixelMapfv = (PFNGLPIXELMAPFVPROC)Table<>::loaded[ENTRY_glPixelMapfv];
+        if (glad_glPixelMapuiv == record_glPixelMapuiv)
+            glad_glPixelMapuiv = (PFNGLPIXELMAPUIVPROC)Table<>::loaded[ENTRY_glPixelMapuiv];
+        if (glad_glPixelMapusv == record_glPixelMapusv)
+            glad_glPixelMapusv = (PFNGLPIXELMAPUSVPROC)Table<>::loaded[ENTRY_glPixelMapusv];
+        if (glad_glCopyPixels == record_glCopyPixels)
+            glad_glCopyPixels = (PFNGLCOPYPIXELSPROC)Table<>::loaded[ENTRY_glCopyPixels];
+        if (glad_glDrawPixels == record_glDrawPixels)
+            glad_glDrawPixels = (PFNGLDRAWPIXELSPROC)Table<>::loaded[ENTRY_glDrawPixels];
+        if (glad_glFrustum == record_glFrustum)
+            glad_glFrustum = (PFNGLFRUSTUMPROC)Table<>::loaded[ENTRY_glFrustum];
+        if (glad_glLoadIdentity == record_glLoadIdentity)
+            glad_glLoadIdentity = (PFNGLLOADIDENTITYPROC)Table<>::loaded[ENTRY_glLoadIdentity];
+        if (glad_glLoadMatrixf == record_glLoadMatrixf)
+            glad_glLoadMatrixf = (PFNGLLOADMATRIXFPROC)Table<>::loaded[ENTRY_glLoadMatrixf];
+        if (glad_glLoadMatrixd == record_glLoadMatrixd)
+            glad_glLoadMatrixd = (PFNGLLOADMATRIXDPROC)Table<>::loaded[ENTRY_glLoadMatrixd];
+        if (glad_glMatrixMode == record_glMatrixMode)
+            glad_glMatrixMode = (PFNGLMATRIXMODEPROC)Table<>::loaded[ENTRY_glMatrixMode];
+        if (glad_glMultMatrixf == record_glMultMatrixf)
+            glad_glMultMatrixf = (PFNGLMULTMATRIXFPROC)Table<>::loaded[ENTRY_glMultMatrixf];
+        if (glad_glMultMatrixd == record_glMultMatrixd)
+            glad_glMultMatrixd = (PFNGLMULTMATRIXDPROC)Table<>::loaded[ENTRY_glMultMatrixd];
+        if (glad_glOrtho == record_glOrtho)
+            glad_glOrtho = (PFNGLORTHOPROC)Table<>::loaded[ENTRY_glOrtho];
+        if (glad_glPopMatrix == record_glPopMatrix)
+            glad_glPopMatrix = (PFNGLPOPMATRIXPROC)Table<>::loaded[ENTRY_glPopMatrix];
+        if (glad_glPushMatrix == record_glPushMatrix)
+            glad_glPushMatrix = (PFNGLPUSHMATRIXPROC)Table<>::loaded[ENTRY_glPushMatrix];
+        if (glad_glRotated == record_glRotated)
+            glad_glRotated = (PFNGLROTATEDPROC)Table<>::loaded[ENTRY_glRotated];
+        if (glad_glRotatef == record_glRotatef)
+            glad_glRotatef = (PFNGLROTATEFPROC)Table<>::loaded[ENTRY_glRotatef];
+        if (glad_glScaled == record_glScaled)
+            glad_glScaled = (PFNGLSCALEDPROC)Table<>::loaded[ENTRY_glScaled];
+        if (glad_glScalef == record_glScalef)
+            glad_glScalef = (PFNGLSCALEFPROC)Table<>::loaded[ENTRY_glScalef];
+        if (glad_glTranslated == record_glTranslated)
+            glad_glTranslated = (PFNGLTRANSLATEDPROC)Table<>::loaded[ENTRY_glTranslated];
+        if (glad_glTranslatef == record_glTranslatef)
+            glad_glTranslatef = (PFNGLTRANSLATEFPROC)Table<>::loaded[ENTRY_glTranslatef];
+        if (glad_glDrawArrays == record_glDrawArrays)
+            glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)Table<>::loaded[ENTRY_glDrawArrays];
+        if (glad_glDrawElements == record_glDrawElements)
+            glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)Table<>::loaded[ENTRY_glDrawElements];
+        if (glad_glPolygonOffset == record_glPolygonOffset)
+            glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)Table<>::loaded[ENTRY_glPolygonOffset];
+        if (glad_glCopyTexImage1D == record_glCopyTexImage1D)
+            glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)Table<>::loaded[ENTRY_glCopyTexImage1D];
+        if (glad_glCopyTexImage2D == record_glCopyTexImage2D)
+            glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)Table<>::loaded[ENTRY_glCopyTexImage2D];
+        if (glad_glCopyTexSubImage1D == record_glCopyTexSubImage1D)
+            glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)Table<>::loaded[ENTRY_glCopyTexSubImage1D];
+        if (glad_glCopyTexSubImage2D == record_glCopyTexSubImage2D)
+            glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)Table<>::loaded[ENTRY_glCopyTexSubImage2D];
+        if (glad_glTexSubImage1D == record_glTexSubImage1D)
+            glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)Table<>::loaded[ENTRY_glTexSubImage1D];
+        if (glad_glTexSubImage2D == record_glTexSubImage2D)
+            glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)Table<>::loaded[ENTRY_glTexSubImage2D];
+        if (glad_glBindTexture == record_glBindTexture)
+            glad_glBindTexture = (PFNGLBINDTEXTUREPROC)Table<>::loaded[ENTRY_glBindTexture];
+        if (glad_glDeleteTextures == record_glDeleteTextures)
+            glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)Table<>::loaded[ENTRY_glDeleteTextures];
+        if (glad_glGenTextures == record_glGenTextures)
+            glad_glGenTextures = (PFNGLGENTEXTURESPROC)Table<>::loaded[ENTRY_glGenTextures];
+        if (glad_glArrayElement == record_glArrayElement)
+            glad_glArrayElement = (PFNGLARRAYELEMENTPROC)Table<>::loaded[ENTRY_glArrayElement];
+        if (glad_glColorPointer == record_glColorPointer)
+            glad_glColorPointer = (PFNGLCOLORPOINTERPROC)Table<>::loaded[ENTRY_glColorPointer];
+        if (glad_glDisableClientState == record_glDisableClientState)
+            glad_glDisableClientState = (PFNGLDISABLECLIENTSTATEPROC)Table<>::loaded[ENTRY_glDisableClientState];
+        if (glad_glEdgeFlagPointer == record_glEdgeFlagPointer)
+            glad_glEdgeFlagPointer = (PFNGLEDGEFLAGPOINTERPROC)Table<>::loaded[ENTRY_glEdgeFlagPointer];
+        if (glad_glEnableClientState == record_glEnableClientState)
+            glad_glEnableClientState = (PFNGLENABLECLIENTSTATEPROC)Table<>::loaded[ENTRY_glEnableClientState];
+        if (glad_glIndexPointer == record_glIndexPointer)
+            glad_glIndexPointer = (PFNGLINDEXPOINTERPROC)Table<>::loaded[ENTRY_glIndexPointer];
+        if (glad_glInterleavedArrays == record_glInterleavedArrays)
+            glad_glInterleavedArrays = (PFNGLINTERLEAVEDARRAYSPROC)Table<>::loaded[ENTRY_glInterleavedArrays];
+        if (glad_glNormalPointer == record_glNormalPointer)
+            glad_glNormalPointer = (PFNGLNORMALPOINTERPROC)Table<>::loaded[ENTRY_glNormalPointer];
+        if (glad_glTexCoordPointer == record_glTexCoordPointer)
+            glad_glTexCoordPointer = (PFNGLTEXCOORDPOINTERPROC)Table<>::loaded[ENTRY_glTexCoordPointer];
+        if (glad_glVertexPointer == record_glVertexPointer)
+            glad_glVertexPointer = (PFNGLVERTEXPOINTERPROC)Table<>::loaded[ENTRY_glVertexPointer];
+        if (glad_glPrioritizeTextures == record_glPrioritizeTextures)
+            glad_glPrioritizeTextures = (PFNGLPRIORITIZETEXTURESPROC)Table<>::loaded[ENTRY_glPrioritizeTextures];
+        if (glad_glIndexub == record_glIndexub)
+            glad_glIndexub = (PFNGLINDEXUBPROC)Table<>::loaded[ENTRY_glIndexub];
+        if (glad_glIndexubv == record_glIndexubv)
+            glad_glIndexubv = (PFNGLINDEXUBVPROC)Table<>::loaded[ENTRY_glIndexubv];
+        if (glad_glPopClientAttrib == record_glPopClientAttrib)
+            glad_glPopClientAttrib = (PFNGLPOPCLIENTATTRIBPROC)Table<>::loaded[ENTRY_glPopClientAttrib];
+        if (glad_glPushClientAttrib == record_glPushClientAttrib)
+            glad_glPushClientAttrib = (PFNGLPUSHCLIENTATTRIBPROC)Table<>::loaded[ENTRY_glPushClientAttrib];
+        if (glad_glDrawRangeElements == record_glDrawRangeElements)
+            glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)Table<>::loaded[ENTRY_glDrawRangeElements];
+        if (glad_glTexImage3D == record_glTexImage3D)
+            glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)Table<>::loaded[ENTRY_glTexImage3D];
+        if (glad_glTexSubImage3D == record_glTexSubImage3D)
+            glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)Table<>::loaded[ENTRY_glTexSubImage3D];
+        if (glad_glCopyTexSubImage3D == record_glCopyTexSubImage3D)
+            glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)Table<>::loaded[ENTRY_glCopyTexSubImage3D];
+        if (glad_glActiveTexture == record_glActiveTexture)
+            glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)Table<>::loaded[ENTRY_glActiveTexture];
+        if (glad_glSampleCoverage == record_glSampleCoverage)
+            glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)Table<>::loaded[ENTRY_glSampleCoverage];
+        if (glad_glCompressedTexImage3D == record_glCompressedTexImage3D)
+            glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)Table<>::loaded[ENTRY_glCompressedTexImage3D];
+        if (glad_glCompressedTexImage2D == record_glCompressedTexImage2D)
+            glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)Table<>::loaded[ENTRY_glCompressedTexImage2D];
+        if (glad_glCompressedTexImage1D == record_glCompressedTexImage1D)
+            glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)Table<>::loaded[ENTRY_glCompressedTexImage1D];
+        if (glad_glCompressedTexSubImage3D == record_glCompressedTexSubImage3D)
+            glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)Table<>::loaded[ENTRY_glCompressedTexSubImage3D];
+        if (glad_glCompressedTexSubImage2D == record_glCompressedTexSubImage2D)
+            glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)Table<>::loaded[ENTRY_glCompressedTexSubImage2D];
+        if (glad_glCompressedTexSubImage1D == record_glCompressedTexSubImage1D)
+            glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)Table<>::loaded[ENTRY_glCompressedTexSubImage1D];
+        if (glad_glClientActiveTexture == record_glClientActiveTexture)
+            glad_glClientActiveTexture = (PFNGLCLIENTACTIVETEXTUREPROC)Table<>::loaded[ENTRY_glClientActiveTexture];
+        if (glad_glMultiTexCoord1d == record_glMultiTexCoord1d)
+            glad_glMultiTexCoord1d = (PFNGLMULTITEXCOORD1DPROC)Table<>::loaded[ENTRY_glMultiTexCoord1d];
+        if (glad_glMultiTexCoord1dv == record_glMultiTexCoord1dv)
+            glad_glMultiTexCoord1dv = (PFNGLMULTITEXCOORD1DVPROC)Table<>::loaded[ENTRY_glMultiTexCoord1dv];
+        if (glad_glMultiTexCoord1f == record_glMultiTexCoord1f)
+            glad_glMultiTexCoord1f = (PFNGLMULTITEXCOORD1FPROC)Table<>::loaded[ENTRY_glMultiTexCoord1f];
+        if (glad_glMultiTexCoord1fv == record_glMultiTexCoord1fv)
+            glad_glMultiTexCoord1fv = (PFNGLMULTITEXCOORD1FVPROC)Table<>::loaded[ENTRY_glMultiTexCoord1fv];
+        if (glad_glMultiTexCoord1i == record_glMultiTexCoord1i)
+            glad_glMultiTexCoord1i = (PFNGLMULTITEXCOORD1IPROC)Table<>::loaded[ENTRY_glMultiTexCoord1i];
+        if (glad_glMultiTexCoord1iv == record_glMultiTexCoord1iv)
+            glad_glMultiTexCoord1iv = (PFNGLMULTITEXCOORD1IVPROC)Table<>::loaded[ENTRY_glMultiTexCoord1iv];
+        if (glad_glMultiTexCoord1s == record_glMultiTexCoord1s)
+            glad_glMultiTexCoord1s = (PFNGLMULTITEXCOORD1SPROC)Table<>::loaded[ENTRY_glMultiTexCoord1s];
+        if (glad_glMultiTexCoord1sv == record_glMultiTexCoord1sv)
+            glad_glMultiTexCoord1sv = (PFNGLMULTITEXCOORD1SVPROC)Table<>::loaded[ENTRY_glMultiTexCoord1sv];
+        if (glad_glMultiTexCoord2d == record_glMultiTexCoord2d)
+            glad_glMultiTexCoord2d = (PFNGLMULTITEXCOORD2DPROC)Table<>::loaded[ENTRY_glMultiTexCoord2d];
+        if (glad_glMultiTexCoord2dv == record_glMultiTexCoord2dv)
+            glad_glMultiTexCoord2dv = (PFNGLMULTITEXCOORD2DVPROC)Table<>::loaded[ENTRY_glMultiTexCoord2dv];
+        if (glad_glMultiTexCoord2f == record_glMultiTexCoord2f)
+            glad_glMultiTexCoord2f = (PFNGLMULTITEXCOORD2FPROC)Table<>::loaded[ENTRY_glMultiTexCoord2f];
+        if (glad_glMultiTexCoord2fv == record_glMultiTexCoord2fv)
+            glad_glMultiTexCoord2fv = (PFNGLMULTITEXCOORD2FVPROC)Table<>::loaded[ENTRY_glMultiTexCoord2fv];
+        if (glad_glMultiTexCoord2i == record_glMultiTexCoord2i)
+            glad_glMultiTexCoord2i = (PFNGLMULTITEXCOORD2IPROC)Table<>::loaded[ENTRY_glMultiTexCoord2i];
+        if (glad_glMultiTexCoord2iv == record_glMultiTexCoord2iv)
+            glad_glMultiTexCoord2iv = (PFNGLMULTITEXCOORD2IVPROC)Table<>::loaded[ENTRY_glMultiTexCoord2iv];
+        if (glad_glMultiTexCoord2s == record_glMultiTexCoord2s)
+            glad_glMultiTexCoord2s = (PFNGLMULTITEXCOORD2SPROC)Table<>::loaded[ENTRY_glMultiTexCoord2s];
+        if (glad_glMultiTexCoord2sv == record_glMultiTexCoord2sv)
+            glad_glMultiTexCoord2sv = (PFNGLMULTITEXCOORD2SVPROC)Table<>::loaded[ENTRY_glMultiTexCoord2sv];
+        if (glad_glMultiTexCoord3d == record_glMultiTexCoord3d)
+            glad_glMultiTexCoord3d = (PFNGLMULTITEXCOORD3DPROC)Table<>::loaded[ENTRY_glMultiTexCoord3d];
+        if (glad_glMultiTexCoord3dv == record_glMultiTexCoord3dv)
+            glad_glMultiTexCoord3dv = (PFNGLMULTITEXCOORD3DVPROC)Table<>::loaded[ENTRY_glMultiTexCoord3dv];
+        if (glad_glMultiTexCoord3f == record_glMultiTexCoord3f)
+            glad_glMultiTexCoord3f = (PFNGLMULTITEXCOORD3FPROC)Table<>::loaded[ENTRY_glMultiTexCoord3f];
+        if (glad_glMultiTexCoord3fv == record_glMultiTexCoord3fv)
+            glad_glMultiTexCoord3fv = (PFNGLMULTITEXCOORD3FVPROC)Table<>::loaded[ENTRY_glMultiTexCoord3fv];
+        if (glad_glMultiTexCoord3i == record_glMultiTexCoord3i)
+            glad_glMultiTexCoord3i = (PFNGLMULTITEXCOORD3IPROC)Table<>::loaded[ENTRY_glMultiTexCoord3i];
+        if (glad_glMultiTexCoord3iv == record_glMultiTexCoord3iv)
+            glad_glMultiTexCoord3iv = (PFNGLMULTITEXCOORD3IVPROC)Table<>::loaded[ENTRY_glMultiTexCoord3iv];
+        if (glad_glMultiTexCoord3s == record_glMultiTexCoord3s)
+            glad_glMultiTexCoord3s = (PFNGLMULTITEXCOORD3SPROC)Table<>::loaded[ENTRY_glMultiTexCoord3s];
+        if (glad_glMultiTexCoord3sv == record_glMultiTexCoord3sv)
+            glad_glMultiTexCoord3sv = (PFNGLMULTITEXCOORD3SVPROC)Table<>::loaded[ENTRY_glMultiTexCoord3sv];
+        if (glad_glMultiTexCoord4d == record_glMultiTexCoord4d)
+            glad_glMultiTexCoord4d = (PFNGLMULTITEXCOORD4DPROC)Table<>::loaded[ENTRY_glMultiTexCoord4d];
+        if (glad_glMultiTexCoord4dv == record_glMultiTexCoord4dv)
+            glad_glMultiTexCoord4dv = (PFNGLMULTITEXCOORD4DVPROC)Table<>::loaded[ENTRY_glMultiTexCoord4dv];
+        if (glad_glMultiTexCoord4f == record_glMultiTexCoord4f)
+            glad_glMultiTexCoord4f = (PFNGLMULTITEXCOORD4FPROC)Table<>::loaded[ENTRY_glMultiTexCoord4f];
+        if (glad_glMultiTexCoord4fv == record_glMultiTexCoord4fv)
+            glad_glMultiTexCoord4fv = (PFNGLMULTITEXCOORD4FVPROC)Table<>::loaded[ENTRY_glMultiTexCoord4fv];
+        if (glad_glMultiTexCoord4i == record_glMultiTexCoord4i)
+            glad_glMultiTexCoord4i = (PFNGLMULTITEXCOORD4IPROC)Table<>::loaded[ENTRY_glMultiTexCoord4i];
+        if (glad_glMultiTexCoord4iv == record_glMultiTexCoord4iv)
+            glad_glMultiTexCoord4iv = (PFNGLMULTITEXCOORD4IVPROC)Table<>::loaded[ENTRY_glMultiTexCoord4iv];
+        if (glad_glMultiTexCoord4s == record_glMultiTexCoord4s)
+            glad_glMultiTexCoord4s = (PFNGLMULTITEXCOORD4SPROC)Table<>::loaded[ENTRY_glMultiTexCoord4s];
+        if (glad_glMultiTexCoord4sv == record_glMultiTexCoord4sv)
+            glad_glMultiTexCoord4sv = (PFNGLMULTITEXCOORD4SVPROC)Table<>::loaded[ENTRY_glMultiTexCoord4sv];
+        if (glad_glLoadTransposeMatrixf == record_glLoadTransposeMatrixf)
+            glad_glLoadTransposeMatrixf = (PFNGLLOADTRANSPOSEMATRIXFPROC)Table<>::loaded[ENTRY_glLoadTransposeMatrixf];
+        if (glad_glLoadTransposeMatrixd == record_glLoadTransposeMatrixd)
+            glad_glLoadTransposeMatrixd = (PFNGLLOADTRANSPOSEMATRIXDPROC)Table<>::loaded[ENTRY_glLoadTransposeMatrixd];
+        if (glad_glMultTransposeMatrixf == record_glMultTransposeMatrixf)
+            glad_glMultTransposeMatrixf = (PFNGLMULTTRANSPOSEMATRIXFPROC)Table<>::loaded[ENTRY_glMultTransposeMatrixf];
+        if (glad_glMultTransposeMatrixd == record_glMultTransposeMatrixd)
+            glad_glMultTransposeMatrixd = (PFNGLMULTTRANSPOSEMATRIXDPROC)Table<>::loaded[ENTRY_glMultTransposeMatrixd];
+        if (glad_glBlendFuncSeparate == record_glBlendFuncSeparate)
+            glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)Table<>::loaded[ENTRY_glBlendFuncSeparate];
+        if (glad_glMultiDrawArrays == record_glMultiDrawArrays)
+            glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)Table<>::loaded[ENTRY_glMultiDrawArrays];
+        if (glad_glMultiDrawElements == record_glMultiDrawElements)
+            glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)Table<>::loaded[ENTRY_glMultiDrawElements];
+        if (glad_glPointParameterf == record_glPointParameterf)
+            glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)Table<>::loaded[ENTRY_glPointParameterf];
+        if (glad_glPointParameterfv == record_glPointParameterfv)
+            glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)Table<>::loaded[ENTRY_glPointParameterfv];
+        if (glad_glPointParameteri == record_glPointParameteri)
+            glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)Table<>::loaded[ENTRY_glPointParameteri];
+        if (glad_glPointParameteriv == record_glPointParameteriv)
+            glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)Table<>::loaded[ENTRY_glPointParameteriv];
+        if (glad_glFogCoordf == record_glFogCoordf)
+            glad_glFogCoordf = (PFNGLFOGCOORDFPROC)Table<>::loaded[ENTRY_glFogCoordf];
+        if (glad_glFogCoordfv == record_glFogCoordfv)
+            glad_glFogCoordfv = (PFNGLFOGCOORDFVPROC)Table<>::loaded[ENTRY_glFogCoordfv];
+        if (glad_glFogCoordd == record_glFogCoordd)
+            glad_glFogCoordd = (PFNGLFOGCOORDDPROC)Table<>::loaded[ENTRY_glFogCoordd];
+        if (glad_glFogCoorddv == record_glFogCoorddv)
+            glad_glFogCoorddv = (PFNGLFOGCOORDDVPROC)Table<>::loaded[ENTRY_glFogCoorddv];
+        if (glad_glFogCoordPointer == record_glFogCoordPointer)
+            glad_glFogCoordPointer = (PFNGLFOGCOORDPOINTERPROC)Table<>::loaded[ENTRY_glFogCoordPointer];
+        if (glad_glSecondaryColor3b == record_glSecondaryColor3b)
+            glad_glSecondaryColor3b = (PFNGLSECONDARYCOLOR3BPROC)Table<>::loaded[ENTRY_glSecondaryColor3b];
+        if (glad_glSecondaryColor3bv == record_glSecondaryColor3bv)
+            glad_glSecondaryColor3bv = (PFNGLSECONDARYCOLOR3BVPROC)Table<>::loaded[ENTRY_glSecondaryColor3bv];
+        if (glad_glSecondaryColor3d == record_glSecondaryColor3d)
+            glad_glSecondaryColor3d = (PFNGLSECONDARYCOLOR3DPROC)Table<>::loaded[ENTRY_glSecondaryColor3d];
+        if (glad_glSecondaryColor3dv == record_glSecondaryColor3dv)
+            glad_glSecondaryColor3dv = (PFNGLSECONDARYCOLOR3DVPROC)Table<>::loaded[ENTRY_glSecondaryColor3dv];
+        if (glad_glSecondaryColor3f == record_glSecondaryColor3f)
+            glad_glSecondaryColor3f = (PFNGLSECONDARYCOLOR3FPROC)Table<>::loaded[ENTRY_glSecondaryColor3f];
+        if (glad_glSecondaryColor3fv == record_glSecondaryColor3fv)
+            glad_glSecondaryColor3fv = (PFNGLSECONDARYCOLOR3FVPROC)Table<>::loaded[ENTRY_glSecondaryColor3fv];
+        if (glad_glSecondaryColor3i == record_glSecondaryColor3i)
+            glad_glSecondaryColor3i = (PFNGLSECONDARYCOLOR3IPROC)Table<>::loaded[ENTRY_glSecondaryColor3i];
+        if (glad_glSecondaryColor3iv == record_glSecondaryColor3iv)
+            glad_glSecondaryColor3iv = (PFNGLSECONDARYCOLOR3IVPROC)Table<>::loaded[ENTRY_glSecondaryColor3iv];
+        if (glad_glSecondaryColor3s == record_glSecondaryColor3s)
+            glad_glSecondaryColor3s = (PFNGLSECONDARYCOLOR3SPROC)Table<>::loaded[ENTRY_glSecondaryColor3s];
+        if (glad_glSecondaryColor3sv == record_glSecondaryColor3sv)
+            glad_glSecondaryColor3sv = (PFNGLSECONDARYCOLOR3SVPROC)Table<>::loaded[ENTRY_glSecondaryColor3sv];
+        if (glad_glSecondaryColor3ub == record_glSecondaryColor3ub)
+            glad_glSecondaryColor3ub = (PFNGLSECONDARYCOLOR3UBPROC)Table<>::loaded[ENTRY_glSecondaryColor3ub];
+        if (glad_glSecondaryColor3ubv == record_glSecondaryColor3ubv)
+            glad_glSecondaryColor3ubv = (PFNGLSECONDARYCOLOR3UBVPROC)Table<>::loaded[ENTRY_glSecondaryColor3ubv];
+        if (glad_glSecondaryColor3ui == record_glSecondaryColor3ui)
+            glad_glSecondaryColor3ui = (PFNGLSECONDARYCOLOR3UIPROC)Table<>::loaded[ENTRY_glSecondaryColor3ui];
+        if (glad_glSecondaryColor3uiv == record_glSecondaryColor3uiv)
+            glad_glSecondaryColor3uiv = (PFNGLSECONDARYCOLOR3UIVPROC)Table<>::loaded[ENTRY_glSecondaryColor3uiv];
+        if (glad_glSecondaryColor3us == record_glSecondaryColor3us)
+            glad_glSecondaryColor3us = (PFNGLSECONDARYCOLOR3USPROC)Table<>::loaded[ENTRY_glSecondaryColor3us];
+        if (glad_glSecondaryColor3usv == record_glSecondaryColor3usv)
+            glad_glSecondaryColor3usv = (PFNGLSECONDARYCOLOR3USVPROC)Table<>::loaded[ENTRY_glSecondaryColor3usv];
+        if (glad_glSecondaryColorPointer == record_glSecondaryColorPointer)
+            glad_glSecondaryColorPointer = (PFNGLSECONDARYCOLORPOINTERPROC)Table<>::loaded[ENTRY_glSecondaryColorPointer];
+        if (glad_glWindowPos2d == record_glWindowPos2d)
+            glad_glWindowPos2d = (PFNGLWINDOWPOS2DPROC)Table<>::loaded[ENTRY_glWindowPos2d];
+        if (glad_glWindowPos2dv == record_glWindowPos2dv)
+            glad_glWindowPos2dv = (PFNGLWINDOWPOS2DVPROC)Table<>::loaded[ENTRY_glWindowPos2dv];
+        if (glad_glWindowPos2f == record_glWindowPos2f)
+            glad_glWindowPos2f = (PFNGLWINDOWPOS2FPROC)Table<>::loaded[ENTRY_glWindowPos2f];
+        if (glad_glWindowPos2fv == record_glWindowPos2fv)
+            glad_glWindowPos2fv = (PFNGLWINDOWPOS2FVPROC)Table<>::loaded[ENTRY_glWindowPos2fv];
+        if (glad_glWindowPos2i == record_glWindowPos2i)
+            glad_glWindowPos2i = (PFNGLWINDOWPOS2IPROC)Table<>::loaded[ENTRY_glWindowPos2i];
+        if (glad_glWindowPos2iv == record_glWindowPos2iv)
+            glad_glWindowPos2iv = (PFNGLWINDOWPOS2IVPROC)Table<>::loaded[ENTRY_glWindowPos2iv];
+        if (glad_glWindowPos2s == record_glWindowPos2s)
+            glad_glWindowPos2s = (PFNGLWINDOWPOS2SPROC)Table<>::loaded[ENTRY_glWindowPos2s];
+        if (glad_glWindowPos2sv == record_glWindowPos2sv)
+            glad_glWindowPos2sv = (PFNGLWINDOWPOS2SVPROC)Table<>::loaded[ENTRY_glWindowPos2sv];
+        if (glad_glWindowPos3d == record_glWindowPos3d)
+            glad_glWindowPos3d = (PFNGLWINDOWPOS3DPROC)Table<>::loaded[ENTRY_glWindowPos3d];
+        if (glad_glWindowPos3dv == record_glWindowPos3dv)
+            glad_glWindowPos3dv = (PFNGLWINDOWPOS3DVPROC)Table<>::loaded[ENTRY_glWindowPos3dv];
+        if (glad_glWindowPos3f == record_glWindowPos3f)
+            glad_glWindowPos3f = (PFNGLWINDOWPOS3FPROC)Table<>::loaded[ENTRY_glWindowPos3f];
+        if (glad_glWindowPos3fv == record_glWindowPos3fv)
+            glad_glWindowPos3fv = (PFNGLWINDOWPOS3FVPROC)Table<>::loaded[ENTRY_glWindowPos3fv];
+        if (glad_glWindowPos3i == record_glWindowPos3i)
+            glad_glWindowPos3i = (PFNGLWINDOWPOS3IPROC)Table<>::loaded[ENTRY_glWindowPos3i];
+        if (glad_glWindowPos3iv == record_glWindowPos3iv)
+            glad_glWindowPos3iv = (PFNGLWINDOWPOS3IVPROC)Table<>::loaded[ENTRY_glWindowPos3iv];
+        if (glad_glWindowPos3s == record_glWindowPos3s)
+            glad_glWindowPos3s = (PFNGLWINDOWPOS3SPROC)Table<>::loaded[ENTRY_glWindowPos3s];
+        if (glad_glWindowPos3sv == record_glWindowPos3sv)
+            glad_glWindowPos3sv = (PFNGLWINDOWPOS3SVPROC)Table<>::loaded[ENTRY_glWindowPos3sv];
+        if (glad_glBlendColor == record_glBlendColor)
+            glad_glBlendColor = (PFNGLBLENDCOLORPROC)Table<>::loaded[ENTRY_glBlendColor];
+        if (glad_glBlendEquation == record_glBlendEquation)
+            glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)Table<>::loaded[ENTRY_glBlendEquation];
+        if (glad_glGenQueries == record_glGenQueries)
+            glad_glGenQueries = (PFNGLGENQUERIESPROC)Table<>::loaded[ENTRY_glGenQueries];
+        if (glad_glDeleteQueries == record_glDeleteQueries)
+            glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)Table<>::loaded[ENTRY_glDeleteQueries];
+        if (glad_glBeginQuery == record_glBeginQuery)
+            glad_glBeginQuery = (PFNGLBEGINQUERYPROC)Table<>::loaded[ENTRY_glBeginQuery];
+        if (glad_glEndQuery == record_glEndQuery)
+            glad_glEndQuery = (PFNGLENDQUERYPROC)Table<>::loaded[ENTRY_glEndQuery];
+        if (glad_glBindBuffer == record_glBindBuffer)
+            glad_glBindBuffer = (PFNGLBINDBUFFERPROC)Table<>::loaded[ENTRY_glBindBuffer];
+        if (glad_glDeleteBuffers == record_glDeleteBuffers)
+            glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)Table<>::loaded[ENTRY_glDeleteBuffers];
+        if (glad_glGenBuffers == record_glGenBuffers)
+            glad_glGenBuffers = (PFNGLGENBUFFERSPROC)Table<>::loaded[ENTRY_glGenBuffers];
+        if (glad_glBufferData == record_glBufferData)
+            glad_glBufferData = (PFNGLBUFFERDATAPROC)Table<>::loaded[ENTRY_glBufferData];
+        if (glad_glBufferSubData == record_glBufferSubData)
+            glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)Table<>::loaded[ENTRY_glBufferSubData];
+        if (glad_glMapBuffer == record_glMapBuffer)
+            glad_glMapBuffer = (PFNGLMAPBUFFERPROC)Table<>::loaded[ENTRY_glMapBuffer];
+        if (glad_glUnmapBuffer == record_glUnmapBuffer)
+            glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)Table<>::loaded[ENTRY_glUnmapBuffer];
+        if (glad_glBlendEquationSeparate == record_glBlendEquationSeparate)
+            glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)Table<>::loaded[ENTRY_glBlendEquationSeparate];
+        if (glad_glDrawBuffers == record_glDrawBuffers)
+            glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)Table<>::loaded[ENTRY_glDrawBuffers];
+        if (glad_glStencilOpSeparate == record_glStencilOpSeparate)
+            glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)Table<>::loaded[ENTRY_glStencilOpSeparate];
+        if (glad_glStencilFuncSeparate == record_glStencilFuncSeparate)
+            glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)Table<>::loaded[ENTRY_glStencilFuncSeparate];
+        if (glad_glStencilMaskSeparate == record_glStencilMaskSeparate)
+            glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)Table<>::loaded[ENTRY_glStencilMaskSeparate];
+        if (glad_glAttachShader == record_glAttachShader)
+            glad_glAttachShader = (PFNGLATTACHSHADERPROC)Table<>::loaded[ENTRY_glAttachShader];
+        if (glad_glBindAttribLocation == record_glBindAttribLocation)
+            glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)Table<>::loaded[ENTRY_glBindAttribLocation];
+        if (glad_glCompileShader == record_glCompileShader)
+            glad_glCompileShader = (PFNGLCOMPILESHADERPROC)Table<>::loaded[ENTRY_glCompileShader];
+        if (glad_glCreateProgram == record_glCreateProgram)
+            glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)Table<>::loaded[ENTRY_glCreateProgram];
+        if (glad_glCreateShader == record_glCreateShader)
+            glad_glCreateShader = (PFNGLCREATESHADERPROC)Table<>::loaded[ENTRY_glCreateShader];
+        if (glad_glDeleteProgram == record_glDeleteProgram)
+            glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)Table<>::loaded[ENTRY_glDeleteProgram];
+        if (glad_glDeleteShader == record_glDeleteShader)
+            glad_glDeleteShader = (PFNGLDELETESHADERPROC)Table<>::loaded[ENTRY_glDeleteShader];
+        if (glad_glDetachShader == record_glDetachShader)
+            glad_glDetachShader = (PFNGLDETACHSHADERPROC)Table<>::loaded[ENTRY_glDetachShader];
+        if (glad_glDisableVertexAttribArray == record_glDisableVertexAttribArray)
+            glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)Table<>::loaded[ENTRY_glDisableVertexAttribArray];
+        if (glad_glEnableVertexAttribArray == record_glEnableVertexAttribArray)
+            glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)Table<>::loaded[ENTRY_glEnableVertexAttribArray];
+        if (glad_glGetUniformLocation == record_glGetUniformLocation)
+            glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)Table<>::loaded[ENTRY_glGetUniformLocation];
+        if (glad_glLinkProgram == record_glLinkProgram)
+            glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)Table<>::loaded[ENTRY_glLinkProgram];
+        if (glad_glShaderSource == record_glShaderSource)
+            glad_glShaderSource = (PFNGLSHADERSOURCEPROC)Table<>::loaded[ENTRY_glShaderSource];
+        if (glad_glUseProgram == record_glUseProgram)
+            glad_glUseProgram = (PFNGLUSEPROGRAMPROC)Table<>::loaded[ENTRY_glUseProgram];
+        if (glad_glUniform1f == record_glUniform1f)
+            glad_glUniform1f = (PFNGLUNIFORM1FPROC)Table<>::loaded[ENTRY_glUniform1f];
+        if (glad_glUniform2f == record_glUniform2f)
+            glad_glUniform2f = (PFNGLUNIFORM2FPROC)Table<>::loaded[ENTRY_glUniform2f];
+        if (glad_glUniform3f == record_glUniform3f)
+            glad_glUniform3f = (PFNGLUNIFORM3FPROC)Table<>::loaded[ENTRY_glUniform3f];
+        if (glad_glUniform4f == record_glUniform4f)
+            glad_glUniform4f = (PFNGLUNIFORM4FPROC)Table<>::loaded[ENTRY_glUniform4f];
+        if (glad_glUniform1i == record_glUniform1i)
+            glad_glUniform1i = (PFNGLUNIFORM1IPROC)Table<>::loaded[ENTRY_glUniform1i];
+        if (glad_glUniform2i == record_glUniform2i)
+            glad_glUniform2i = (PFNGLUNIFORM2IPROC)Table<>::loaded[ENTRY_glUniform2i];
+        if (glad_glUniform3i == record_glUniform3i)
+            glad_glUniform3i = (PFNGLUNIFORM3IPROC)Table<>::loaded[ENTRY_glUniform3i];
+        if (glad_glUniform4i == record_glUniform4i)
+            glad_glUniform4i = (PFNGLUNIFORM4IPROC)Table<>::loaded[ENTRY_glUniform4i];
+        if (glad_glUniform1fv == record_glUniform1fv)
+            glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)Table<>::loaded[ENTRY_glUniform1fv];
+        if (glad_glUniform2fv == record_glUniform2fv)
+            glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)Table<>::loaded[ENTRY_glUniform2fv];
+        if (glad_glUniform3fv == record_glUniform3fv)
+            glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)Table<>::loaded[ENTRY_glUniform3fv];
+        if (glad_glUniform4fv == record_glUniform4fv)
+            glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)Table<>::loaded[ENTRY_glUniform4fv];
+        if (glad_glUniform1iv == record_glUniform1iv)
+            glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)Table<>::loaded[ENTRY_glUniform1iv];
+        if (glad_glUniform2iv == record_glUniform2iv)
+            glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)Table<>::loaded[ENTRY_glUniform2iv];
+        if (glad_glUniform3iv == record_glUniform3iv)
+            glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)Table<>::loaded[ENTRY_glUniform3iv];
+        if (glad_glUniform4iv == record_glUniform4iv)
+            glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)Table<>::loaded[ENTRY_glUniform4iv];
+        if (glad_glUniformMatrix2fv == record_glUniformMatrix2fv)
+            glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)Table<>::loaded[ENTRY_glUniformMatrix2fv];
+        if (glad_glUniformMatrix3fv == record_glUniformMatrix3fv)
+            glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)Table<>::loaded[ENTRY_glUniformMatrix3fv];
+        if (glad_glUniformMatrix4fv == record_glUniformMatrix4fv)
+            glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)Table<>::loaded[ENTRY_glUniformMatrix4fv];
+        if (glad_glValidateProgram == record_glValidateProgram)
+            glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)Table<>::loaded[ENTRY_glValidateProgram];
+        if (glad_glVertexAttrib1d == record_glVertexAttrib1d)
+            glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)Table<>::loaded[ENTRY_glVertexAttrib1d];
+        if (glad_glVertexAttrib1dv == record_glVertexAttrib1dv)
+            glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)Table<>::loaded[ENTRY_glVertexAttrib1dv];
+        if (glad_glVertexAttrib1f == record_glVertexAttrib1f)
+            glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)Table<>::loaded[ENTRY_glVertexAttrib1f];
+        if (glad_glVertexAttrib1fv == record_glVertexAttrib1fv)
+            glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)Table<>::loaded[ENTRY_glVertexAttrib1fv];
+        if (glad_glVertexAttrib1s == record_glVertexAttrib1s)
+            glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)Table<>::loaded[ENTRY_glVertexAttrib1s];
+        if (glad_glVertexAttrib1sv == record_glVertexAttrib1sv)
+            glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)Table<>::loaded[ENTRY_glVertexAttrib1sv];
+        if (glad_glVertexAttrib2d == record_glVertexAttrib2d)
+            glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)Table<>::loaded[ENTRY_glVertexAttrib2d];
+        if (glad_glVertexAttrib2dv == record_glVertexAttrib2dv)
+            glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)Table<>::loaded[ENTRY_glVertexAttrib2dv];
+        if (glad_glVertexAttrib2f == record_glVertexAttrib2f)
+            glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)Table<>::loaded[ENTRY_glVertexAttrib2f];
+        if (glad_glVertexAttrib2fv == record_glVertexAttrib2fv)
+            glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)Table<>::loaded[ENTRY_glVertexAttrib2fv];
+        if (glad_glVertexAttrib2s == record_glVertexAttrib2s)
+            glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)Table<>::loaded[ENTRY_glVertexAttrib2s];
+        if (glad_glVertexAttrib2sv == record_glVertexAttrib2sv)
+            glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)Table<>::loaded[ENTRY_glVertexAttrib2sv];
+        if (glad_glVertexAttrib3d == record_glVertexAttrib3d)
+            glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)Table<>::loaded[ENTRY_glVertexAttrib3d];
+        if (glad_glVertexAttrib3dv == record_glVertexAttrib3dv)
+            glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)Table<>::loaded[ENTRY_glVertexAttrib3dv];
+        if (glad_glVertexAttrib3f == record_glVertexAttrib3f)
+            glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)Table<>::loaded[ENTRY_glVertexAttrib3f];
+        if (glad_glVertexAttrib3fv == record_glVertexAttrib3fv)
+            glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)Table<>::loaded[ENTRY_glVertexAttrib3fv];
+        if (glad_glVertexAttrib3s == record_glVertexAttrib3s)
+            glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)Table<>::loaded[ENTRY_glVertexAttrib3s];
+        if (glad_glVertexAttrib3sv == record_glVertexAttrib3sv)
+            glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)Table<>::loaded[ENTRY_glVertexAttrib3sv];
+        if (glad_glVertexAttrib4Nbv == record_glVertexAttrib4Nbv)
+            glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nbv];
+        if (glad_glVertexAttrib4Niv == record_glVertexAttrib4Niv)
+            glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Niv];
+        if (glad_glVertexAttrib4Nsv == record_glVertexAttrib4Nsv)
+            glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nsv];
+        if (glad_glVertexAttrib4Nub == record_glVertexAttrib4Nub)
+            glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nub];
+        if (glad_glVertexAttrib4Nubv == record_glVertexAttrib4Nubv)
+            glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nubv];
+        if (glad_glVertexAttrib4Nuiv == record_glVertexAttrib4Nuiv)
+            glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nuiv];
+        if (glad_glVertexAttrib4Nusv == record_glVertexAttrib4Nusv)
+            glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)Table<>::loaded[ENTRY_glVertexAttrib4Nusv];
+        if (glad_glVertexAttrib4bv == record_glVertexAttrib4bv)
+            glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)Table<>::loaded[ENTRY_glVertexAttrib4bv];
+        if (glad_glVertexAttrib4d == record_glVertexAttrib4d)
+            glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)Table<>::loaded[ENTRY_glVertexAttrib4d];
+        if (glad_glVertexAttrib4dv == record_glVertexAttrib4dv)
+            glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)Table<>::loaded[ENTRY_glVertexAttrib4dv];
+        if (glad_glVertexAttrib4f == record_glVertexAttrib4f)
+            glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)Table<>::loaded[ENTRY_glVertexAttrib4f];
+        if (glad_glVertexAttrib4fv == record_glVertexAttrib4fv)
+            glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)Table<>::loaded[ENTRY_glVertexAttrib4fv];
+        if (glad_glVertexAttrib4iv == record_glVertexAttrib4iv)
+            glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)Table<>::loaded[ENTRY_glVertexAttrib4iv];
+        if (glad_glVertexAttrib4s == record_glVertexAttrib4s)
+            glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)Table<>::loaded[ENTRY_glVertexAttrib4s];
+        if (glad_glVertexAttrib4sv == record_glVertexAttrib4sv)
+            glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)Table<>::loaded[ENTRY_glVertexAttrib4sv];
+        if (glad_glVertexAttrib4ubv == record_glVertexAttrib4ubv)
+            glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)Table<>::loaded[ENTRY_glVertexAttrib4ubv];
+        if (glad_glVertexAttrib4uiv == record_glVertexAttrib4uiv)
+            glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)Table<>::loaded[ENTRY_glVertexAttrib4uiv];
+        if (glad_glVertexAttrib4usv == record_glVertexAttrib4usv)
+            glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)Table<>::loaded[ENTRY_glVertexAttrib4usv];
+        if (glad_glVertexAttribPointer == record_glVertexAttribPointer)
+            glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)Table<>::loaded[ENTRY_glVertexAttribPointer];
+        if (glad_glUniformMatrix2x3fv == record_glUniformMatrix2x3fv)
+            glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)Table<>::loaded[ENTRY_glUniformMatrix2x3fv];
+        if (glad_glUniformMatrix3x2fv == record_glUniformMatrix3x2fv)
+            glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)Table<>::loaded[ENTRY_glUniformMatrix3x2fv];
+        if (glad_glUniformMatrix2x4fv == record_glUniformMatrix2x4fv)
+            glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)Table<>::loaded[ENTRY_glUniformMatrix2x4fv];
+        if (glad_glUniformMatrix4x2fv == record_glUniformMatrix4x2fv)
+            glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)Table<>::loaded[ENTRY_glUniformMatrix4x2fv];
+        if (glad_glUniformMatrix3x4fv == record_glUniformMatrix3x4fv)
+            glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)Table<>::loaded[ENTRY_glUniformMatrix3x4fv];
+        if (glad_glUniformMatrix4x3fv == record_glUniformMatrix4x3fv)
+            glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)Table<>::loaded[ENTRY_glUniformMatrix4x3fv];
+        if (glad_glColorMaski == record_glColorMaski)
+            glad_glColorMaski = (PFNGLCOLORMASKIPROC)Table<>::loaded[ENTRY_glColorMaski];
+        if (glad_glEnablei == record_glEnablei)
+            glad_glEnablei = (PFNGLENABLEIPROC)Table<>::loaded[ENTRY_glEnablei];
+        if (glad_glDisablei == record_glDisablei)
+            glad_glDisablei = (PFNGLDISABLEIPROC)Table<>::loaded[ENTRY_glDisablei];
+        if (glad_glBeginTransformFeedback == record_glBeginTransformFeedback)
+            glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)Table<>::loaded[ENTRY_glBeginTransformFeedback];
+        if (glad_glEndTransformFeedback == record_glEndTransformFeedback)
+            glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)Table<>::loaded[ENTRY_glEndTransformFeedback];
+        if (glad_glBindBufferRange == record_glBindBufferRange)
+            glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)Table<>::loaded[ENTRY_glBindBufferRange];
+        if (glad_glBindBufferBase == record_glBindBufferBase)
+            glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)Table<>::loaded[ENTRY_glBindBufferBase];
+        if (glad_glTransformFeedbackVaryings == record_glTransformFeedbackVaryings)
+            glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)Table<>::loaded[ENTRY_glTransformFeedbackVaryings];
+        if (glad_glClampColor == record_glClampColor)
+            glad_glClampColor = (PFNGLCLAMPCOLORPROC)Table<>::loaded[ENTRY_glClampColor];
+        if (glad_glBeginConditionalRender == record_glBeginConditionalRender)
+            glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)Table<>::loaded[ENTRY_glBeginConditionalRender];
+        if (glad_glEndConditionalRender == record_glEndConditionalRender)
+            glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)Table<>::loaded[ENTRY_glEndConditionalRender];
+        if (glad_glVertexAttribIPointer == record_glVertexAttribIPointer)
+            glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)Table<>::loaded[ENTRY_glVertexAttribIPointer];
+        if (glad_glVertexAttribI1i == record_glVertexAttribI1i)
+            glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)Table<>::loaded[ENTRY_glVertexAttribI1i];
+        if (glad_glVertexAttribI2i == record_glVertexAttribI2i)
+            glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)Table<>::loaded[ENTRY_glVertexAttribI2i];
+        if (glad_glVertexAttribI3i == record_glVertexAttribI3i)
+            glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)Table<>::loaded[ENTRY_glVertexAttribI3i];
+        if (glad_glVertexAttribI4i == record_glVertexAttribI4i)
+            glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)Table<>::loaded[ENTRY_glVertexAttribI4i];
+        if (glad_glVertexAttribI1ui == record_glVertexAttribI1ui)
+            glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)Table<>::loaded[ENTRY_glVertexAttribI1ui];
+        if (glad_glVertexAttribI2ui == record_glVertexAttribI2ui)
+            glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)Table<>::loaded[ENTRY_glVertexAttribI2ui];
+        if (glad_glVertexAttribI3ui == record_glVertexAttribI3ui)
+            glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)Table<>::loaded[ENTRY_glVertexAttribI3ui];
+        if (glad_glVertexAttribI4ui == record_glVertexAttribI4ui)
+            glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)Table<>::loaded[ENTRY_glVertexAttribI4ui];
+        if (glad_glVertexAttribI1iv == record_glVertexAttribI1iv)
+            glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)Table<>::loaded[ENTRY_glVertexAttribI1iv];
+        if (glad_glVertexAttribI2iv == record_glVertexAttribI2iv)
+            glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)Table<>::loaded[ENTRY_glVertexAttribI2iv];
+        if (glad_glVertexAttribI3iv == record_glVertexAttribI3iv)
+            glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)Table<>::loaded[ENTRY_glVertexAttribI3iv];
+        if (glad_glVertexAttribI4iv == record_glVertexAttribI4iv)
+            glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)Table<>::loaded[ENTRY_glVertexAttribI4iv];
+        if (glad_glVertexAttribI1uiv == record_glVertexAttribI1uiv)
+            glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)Table<>::loaded[ENTRY_glVertexAttribI1uiv];
+        if (glad_glVertexAttribI2uiv == record_glVertexAttribI2uiv)
+            glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)Table<>::loaded[ENTRY_glVertexAttribI2uiv];
+        if (glad_glVertexAttribI3uiv == record_glVertexAttribI3uiv)
+            glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)Table<>::loaded[ENTRY_glVertexAttribI3uiv];
+        if (glad_glVertexAttribI4uiv == record_glVertexAttribI4uiv)
+            glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)Table<>::loaded[ENTRY_glVertexAttribI4uiv];
+        if (glad_glVertexAttribI4bv == record_glVertexAttribI4bv)
+            glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)Table<>::loaded[ENTRY_glVertexAttribI4bv];
+        if (glad_glVertexAttribI4sv == record_glVertexAttribI4sv)
+            glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)Table<>::loaded[ENTRY_glVertexAttribI4sv];
+        if (glad_glVertexAttribI4ubv == record_glVertexAttribI4ubv)
+            glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)Table<>::loaded[ENTRY_glVertexAttribI4ubv];
+        if (glad_glVertexAttribI4usv == record_glVertexAttribI4usv)
+            glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)Table<>::loaded[ENTRY_glVertexAttribI4usv];
+        if (glad_glBindFragDataLocation == record_glBindFragDataLocation)
+            glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)Table<>::loaded[ENTRY_glBindFragDataLocation];
+        if (glad_glUniform1ui == record_glUniform1ui)
+            glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)Table<>::loaded[ENTRY_glUniform1ui];
+        if (glad_glUniform2ui == record_glUniform2ui)
+            glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)Table<>::loaded[ENTRY_glUniform2ui];
+        if (glad_glUniform3ui == record_glUniform3ui)
+            glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)Table<>::loaded[ENTRY_glUniform3ui];
+        if (glad_glUniform4ui == record_glUniform4ui)
+            glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)Table<>::loaded[ENTRY_glUniform4ui];
+        if (glad_glUniform1uiv == record_glUniform1uiv)
+            glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)Table<>::loaded[ENTRY_glUniform1uiv];
+        if (glad_glUniform2uiv == record_glUniform2uiv)
+            glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)Table<>::loaded[ENTRY_glUniform2uiv];
+        if (glad_glUniform3uiv == record_glUniform3uiv)
+            glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)Table<>::loaded[ENTRY_glUniform3uiv];
+        if (glad_glUniform4uiv == record_glUniform4uiv)
+            glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)Table<>::loaded[ENTRY_glUniform4uiv];
+        if (glad_glTexParameterIiv == record_glTexParameterIiv)
+            glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)Table<>::loaded[ENTRY_glTexParameterIiv];
+        if (glad_glTexParameterIuiv == record_glTexParameterIuiv)
+            glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)Table<>::loaded[ENTRY_glTexParameterIuiv];
+        if (glad_glClearBufferiv == record_glClearBufferiv)
+            glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)Table<>::loaded[ENTRY_glClearBufferiv];
+        if (glad_glClearBufferuiv == record_glClearBufferuiv)
+            glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)Table<>::loaded[ENTRY_glClearBufferuiv];
+        if (glad_glClearBufferfv == record_glClearBufferfv)
+            glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)Table<>::loaded[ENTRY_glClearBufferfv];
+        if (glad_glClearBufferfi == record_glClearBufferfi)
+            glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)Table<>::loaded[ENTRY_glClearBufferfi];
+        if (glad_glBindRenderbuffer == record_glBindRenderbuffer)
+            glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)Table<>::loaded[ENTRY_glBindRenderbuffer];
+        if (glad_glDeleteRenderbuffers == record_glDeleteRenderbuffers)
+            glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)Table<>::loaded[ENTRY_glDeleteRenderbuffers];
+        if (glad_glGenRenderbuffers == record_glGenRenderbuffers)
+            glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)Table<>::loaded[ENTRY_glGenRenderbuffers];
+        if (glad_glRenderbufferStorage == record_glRenderbufferStorage)
+            glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)Table<>::loaded[ENTRY_glRenderbufferStorage];
+        if (glad_glBindFramebuffer == record_glBindFramebuffer)
+            glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)Table<>::loaded[ENTRY_glBindFramebuffer];
+        if (glad_glDeleteFramebuffers == record_glDeleteFramebuffers)
+            glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)Table<>::loaded[ENTRY_glDeleteFramebuffers];
+        if (glad_glGenFramebuffers == record_glGenFramebuffers)
+            glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)Table<>::loaded[ENTRY_glGenFramebuffers];
+        if (glad_glFramebufferTexture1D == record_glFramebufferTexture1D)
+            glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)Table<>::loaded[ENTRY_glFramebufferTexture1D];
+        if (glad_glFramebufferTexture2D == record_glFramebufferTexture2D)
+            glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)Table<>::loaded[ENTRY_glFramebufferTexture2D];
+        if (glad_glFramebufferTexture3D == record_glFramebufferTexture3D)
+            glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)Table<>::loaded[ENTRY_glFramebufferTexture3D];
+        if (glad_glFramebufferRenderbuffer == record_glFramebufferRenderbuffer)
+            glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)Table<>::loaded[ENTRY_glFramebufferRenderbuffer];
+        if (glad_glGenerateMipmap == record_glGenerateMipmap)
+            glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)Table<>::loaded[ENTRY_glGenerateMipmap];
+        if (glad_glBlitFramebuffer == record_glBlitFramebuffer)
+            glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)Table<>::loaded[ENTRY_glBlitFramebuffer];
+        if (glad_glRenderbufferStorageMultisample == record_glRenderbufferStorageMultisample)
+            glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)Table<>::loaded[ENTRY_glRenderbufferStorageMultisample];
+        if (glad_glFramebufferTextureLayer == record_glFramebufferTextureLayer)
+            glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)Table<>::loaded[ENTRY_glFramebufferTextureLayer];
+        if (glad_glMapBufferRange == record_glMapBufferRange)
+            glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)Table<>::loaded[ENTRY_glMapBufferRange];
+        if (glad_glFlushMappedBufferRange == record_glFlushMappedBufferRange)
+            glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)Table<>::loaded[ENTRY_glFlushMappedBufferRange];
+        if (glad_glBindVertexArray == record_glBindVertexArray)
+            glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)Table<>::loaded[ENTRY_glBindVertexArray];
+        if (glad_glDeleteVertexArrays == record_glDeleteVertexArrays)
+            glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)Table<>::loaded[ENTRY_glDeleteVertexArrays];
+        if (glad_glGenVertexArrays == record_glGenVertexArrays)
+            glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)Table<>::loaded[ENTRY_glGenVertexArrays];
+        if (glad_glDrawArraysInstanced == record_glDrawArraysInstanced)
+            glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)Table<>::loaded[ENTRY_glDrawArraysInstanced];
+        if (glad_glDrawElementsInstanced == record_glDrawElementsInstanced)
+            glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)Table<>::loaded[ENTRY_glDrawElementsInstanced];
+        if (glad_glTexBuffer == record_glTexBuffer)
+            glad_glTexBuffer = (PFNGLTEXBUFFERPROC)Table<>::loaded[ENTRY_glTexBuffer];
+        if (glad_glPrimitiveRestartIndex == record_glPrimitiveRestartIndex)
+            glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)Table<>::loaded[ENTRY_glPrimitiveRestartIndex];
+        if (glad_glCopyBufferSubData == record_glCopyBufferSubData)
+            glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)Table<>::loaded[ENTRY_glCopyBufferSubData];
+        if (glad_glUniformBlockBinding == record_glUniformBlockBinding)
+            glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)Table<>::loaded[ENTRY_glUniformBlockBinding];
+        if (glad_glDrawElementsBaseVertex == record_glDrawElementsBaseVertex)
+            glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)Table<>::loaded[ENTRY_glDrawElementsBaseVertex];
+        if (glad_glDrawRangeElementsBaseVertex == record_glDrawRangeElementsBaseVertex)
+            glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)Table<>::loaded[ENTRY_glDrawRangeElementsBaseVertex];
+        if (glad_glDrawElementsInstancedBaseVertex == record_glDrawElementsInstancedBaseVertex)
+            glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)Table<>::loaded[ENTRY_glDrawElementsInstancedBaseVertex];
+        if (glad_glMultiDrawElementsBaseVertex == record_glMultiDrawElementsBaseVertex)
+            glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)Table<>::loaded[ENTRY_glMultiDrawElementsBaseVertex];
+        if (glad_glProvokingVertex == record_glProvokingVertex)
+            glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)Table<>::loaded[ENTRY_glProvokingVertex];
+        if (glad_glFenceSync == record_glFenceSync)
+            glad_glFenceSync = (PFNGLFENCESYNCPROC)Table<>::loaded[ENTRY_glFenceSync];
+        if (glad_glDeleteSync == record_glDeleteSync)
+            glad_glDeleteSync = (PFNGLDELETESYNCPROC)Table<>::loaded[ENTRY_glDeleteSync];
+        if (glad_glClientWaitSync == record_glClientWaitSync)
+            glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)Table<>::loaded[ENTRY_glClientWaitSync];
+        if (glad_glWaitSync == record_glWaitSync)
+            glad_glWaitSync = (PFNGLWAITSYNCPROC)Table<>::loaded[ENTRY_glWaitSync];
+        if (glad_glFramebufferTexture == record_glFramebufferTexture)
+            glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)Table<>::loaded[ENTRY_glFramebufferTexture];
+        if (glad_glTexImage2DMultisample == record_glTexImage2DMultisample)
+            glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)Table<>::loaded[ENTRY_glTexImage2DMultisample];
+        if (glad_glTexImage3DMultisample == record_glTexImage3DMultisample)
+            glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)Table<>::loaded[ENTRY_glTexImage3DMultisample];
+        if (glad_glSampleMaski == record_glSampleMaski)
+            glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)Table<>::loaded[ENTRY_glSampleMaski];
+        if (glad_glBindFragDataLocationIndexed == record_glBindFragDataLocationIndexed)
+            glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)Table<>::loaded[ENTRY_glBindFragDataLocationIndexed];
+        if (glad_glGenSamplers == record_glGenSamplers)
+            glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)Table<>::loaded[ENTRY_glGenSamplers];
+        if (glad_glDeleteSamplers == record_glDeleteSamplers)
+            glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)Table<>::loaded[ENTRY_glDeleteSamplers];
+        if (glad_glBindSampler == record_glBindSampler)
+            glad_glBindSampler = (PFNGLBINDSAMPLERPROC)Table<>::loaded[ENTRY_glBindSampler];
+        if (glad_glSamplerParameteri == record_glSamplerParameteri)
+            glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)Table<>::loaded[ENTRY_glSamplerParameteri];
+        if (glad_glSamplerParameteriv == record_glSamplerParameteriv)
+            glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)Table<>::loaded[ENTRY_glSamplerParameteriv];
+        if (glad_glSamplerParameterf == record_glSamplerParameterf)
+            glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)Table<>::loaded[ENTRY_glSamplerParameterf];
+        if (glad_glSamplerParameterfv == record_glSamplerParameterfv)
+            glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)Table<>::loaded[ENTRY_glSamplerParameterfv];
+        if (glad_glSamplerParameterIiv == record_glSamplerParameterIiv)
+            glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)Table<>::loaded[ENTRY_glSamplerParameterIiv];
+        if (glad_glSamplerParameterIuiv == record_glSamplerParameterIuiv)
+            glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)Table<>::loaded[ENTRY_glSamplerParameterIuiv];
+        if (glad_glQueryCounter == record_glQueryCounter)
+            glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)Table<>::loaded[ENTRY_glQueryCounter];
+        if (glad_glVertexAttribDivisor == record_glVertexAttribDivisor)
+            glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)Table<>::loaded[ENTRY_glVertexAttribDivisor];
+        if (glad_glVertexAttribP1ui == record_glVertexAttribP1ui)
+            glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)Table<>::loaded[ENTRY_glVertexAttribP1ui];
+        if (glad_glVertexAttribP1uiv == record_glVertexAttribP1uiv)
+            glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)Table<>::loaded[ENTRY_glVertexAttribP1uiv];
+        if (glad_glVertexAttribP2ui == record_glVertexAttribP2ui)
+            glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)Table<>::loaded[ENTRY_glVertexAttribP2ui];
+        if (glad_glVertexAttribP2uiv == record_glVertexAttribP2uiv)
+            glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)Table<>::loaded[ENTRY_glVertexAttribP2uiv];
+        if (glad_glVertexAttribP3ui == record_glVertexAttribP3ui)
+            glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)Table<>::loaded[ENTRY_glVertexAttribP3ui];
+        if (glad_glVertexAttribP3uiv == record_glVertexAttribP3uiv)
+            glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)Table<>::loaded[ENTRY_glVertexAttribP3uiv];
+        if (glad_glVertexAttribP4ui == record_glVertexAttribP4ui)
+            glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)Table<>::loaded[ENTRY_glVertexAttribP4ui];
+        if (glad_glVertexAttribP4uiv == record_glVertexAttribP4uiv)
+            glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)Table<>::loaded[ENTRY_glVertexAttribP4uiv];
+        if (glad_glVertexP2ui == record_glVertexP2ui)
+            glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)Table<>::loaded[ENTRY_glVertexP2ui];
+        if (glad_glVertexP2uiv == record_glVertexP2uiv)
+            glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)Table<>::loaded[ENTRY_glVertexP2uiv];
+        if (glad_glVertexP3ui == record_glVertexP3ui)
+            glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)Table<>::loaded[ENTRY_glVertexP3ui];
+        if (glad_glVertexP3uiv == record_glVertexP3uiv)
+            glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)Table<>::loaded[ENTRY_glVertexP3uiv];
+        if (glad_glVertexP4ui == record_glVertexP4ui)
+            glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)Table<>::loaded[ENTRY_glVertexP4ui];
+        if (glad_glVertexP4uiv == record_glVertexP4uiv)
+            glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)Table<>::loaded[ENTRY_glVertexP4uiv];
+        if (glad_glTexCoordP1ui == record_glTexCoordP1ui)
+            glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)Table<>::loaded[ENTRY_glTexCoordP1ui];
+        if (glad_glTexCoordP1uiv == record_glTexCoordP1uiv)
+            glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)Table<>::loaded[ENTRY_glTexCoordP1uiv];
+        if (glad_glTexCoordP2ui == record_glTexCoordP2ui)
+            glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)Table<>::loaded[ENTRY_glTexCoordP2ui];
+        if (glad_glTexCoordP2uiv == record_glTexCoordP2uiv)
+            glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)Table<>::loaded[ENTRY_glTexCoordP2uiv];
+        if (glad_glTexCoordP3ui == record_glTexCoordP3ui)
+            glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)Table<>::loaded[ENTRY_glTexCoordP3ui];
+        if (glad_glTexCoordP3uiv == record_glTexCoordP3uiv)
+            glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)Table<>::loaded[ENTRY_glTexCoordP3uiv];
+        if (glad_glTexCoordP4ui == record_glTexCoordP4ui)
+            glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)Table<>::loaded[ENTRY_glTexCoordP4ui];
+        if (glad_glTexCoordP4uiv == record_glTexCoordP4uiv)
+            glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)Table<>::loaded[ENTRY_glTexCoordP4uiv];
+        if (glad_glMultiTexCoordP1ui == record_glMultiTexCoordP1ui)
+            glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)Table<>::loaded[ENTRY_glMultiTexCoordP1ui];
+        if (glad_glMultiTexCoordP1uiv == record_glMultiTexCoordP1uiv)
+            glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)Table<>::loaded[ENTRY_glMultiTexCoordP1uiv];
+        if (glad_glMultiTexCoordP2ui == record_glMultiTexCoordP2ui)
+            glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)Table<>::loaded[ENTRY_glMultiTexCoordP2ui];
+        if (glad_glMultiTexCoordP2uiv == record_glMultiTexCoordP2uiv)
+            glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)Table<>::loaded[ENTRY_glMultiTexCoordP2uiv];
+        if (glad_glMultiTexCoordP3ui == record_glMultiTexCoordP3ui)
+            glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)Table<>::loaded[ENTRY_glMultiTexCoordP3ui];
+        if (glad_glMultiTexCoordP3uiv == record_glMultiTexCoordP3uiv)
+            glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)Table<>::loaded[ENTRY_glMultiTexCoordP3uiv];
+        if (glad_glMultiTexCoordP4ui == record_glMultiTexCoordP4ui)
+            glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)Table<>::loaded[ENTRY_glMultiTexCoordP4ui];
+        if (glad_glMultiTexCoordP4uiv == record_glMultiTexCoordP4uiv)
+            glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)Table<>::loaded[ENTRY_glMultiTexCoordP4uiv];
+        if (glad_glNormalP3ui == record_glNormalP3ui)
+            glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)Table<>::loaded[ENTRY_glNormalP3ui];
+        if (glad_glNormalP3uiv == record_glNormalP3uiv)
+            glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)Table<>::loaded[ENTRY_glNormalP3uiv];
+        if (glad_glColorP3ui == record_glColorP3ui)
+            glad_glColorP3ui = (PFNGLCOLORP3UIPROC)Table<>::loaded[ENTRY_glColorP3ui];
+        if (glad_glColorP3uiv == record_glColorP3uiv)
+            glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)Table<>::loaded[ENTRY_glColorP3uiv];
+        if (glad_glColorP4ui == record_glColorP4ui)
+            glad_glColorP4ui = (PFNGLCOLORP4UIPROC)Table<>::loaded[ENTRY_glColorP4ui];
+        if (glad_glColorP4uiv == record_glColorP4uiv)
+            glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)Table<>::loaded[ENTRY_glColorP4uiv];
+        if (glad_glSecondaryColorP3ui == record_glSecondaryColorP3ui)
+            glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)Table<>::loaded[ENTRY_glSecondaryColorP3ui];
+        if (glad_glSecondaryColorP3uiv == record_glSecondaryColorP3uiv)
+            glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)Table<>::loaded[ENTRY_glSecondaryColorP3uiv];
+    }
+
+    // Decodes one record and makes the call through glad. False for entry
+    // points a trace cannot contain.
+    // ------------------------------------------------------------------------
+    inline bool replayCall(uint32_t entry, Reader& in, Replayer& replay)
+    {
+        switch (entry)
+        {
+        case ENTRY_glCullFace:
+        {
+            GLenum mode = in.value<GLenum>();
+            if (glad_glCullFace)
+            {
+                replay.beginCall();
+                glad_glCullFace(mode);
+                replay.endCall(ENTRY_glCullFace);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glFrontFace:
+        {
+            GLenum mode = in.value<GLenum>();
+            if (glad_glFrontFace)
+            {
+                replay.beginCall();
+                glad_glFrontFace(mode);
+                replay.endCall(ENTRY_glFrontFace);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glHint:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum mode = in.value<GLenum>();
+            if (glad_glHint)
+            {
+                replay.beginCall();
+                glad_glHint(target, mode);
+                replay.endCall(ENTRY_glHint);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glLineWidth:
+        {
+            GLfloat width = in.value<GLfloat>();
+            if (glad_glLineWidth)
+            {
+                replay.beginCall();
+                glad_glLineWidth(width);
+                replay.endCall(ENTRY_glLineWidth);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPointSize:
+        {
+            GLfloat size = in.value<GLfloat>();
+            if (glad_glPointSize)
+            {
+                replay.beginCall();
+                glad_glPointSize(size);
+                replay.endCall(ENTRY_glPointSize);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPolygonMode:
+        {
+            GLenum face = in.value<GLenum>();
+            GLenum mode = in.value<GLenum>();
+            if (glad_glPolygonMode)
+            {
+                replay.beginCall();
+                glad_glPolygonMode(face, mode);
+                replay.endCall(ENTRY_glPolygonMode);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glScissor:
+        {
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            if (glad_glScissor)
+            {
+                replay.beginCall();
+                glad_glScissor(x, y, width, height);
+                replay.endCall(ENTRY_glScissor);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexParameterf:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum pname = in.value<GLenum>();
+            GLfloat param = in.value<GLfloat>();
+            if (glad_glTexParameterf)
+            {
+                replay.beginCall();
+                glad_glTexParameterf(target, pname, param);
+                replay.endCall(ENTRY_glTexParameterf);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexParameterfv:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum pname = in.value<GLenum>();
+            const GLfloat * params = (const GLfloat *)in.pointer();
+            if (glad_glTexParameterfv)
+            {
+                replay.beginCall();
+                glad_glTexParameterfv(target, pname, params);
+                replay.endCall(ENTRY_glTexParameterfv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexParameteri:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum pname = in.value<GLenum>();
+            GLint param = in.value<GLint>();
+            if (glad_glTexParameteri)
+            {
+                replay.beginCall();
+                glad_glTexParameteri(target, pname, param);
+                replay.endCall(ENTRY_glTexParameteri);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexParameteriv:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum pname = in.value<GLenum>();
+            const GLint * params = (const GLint *)in.pointer();
+            if (glad_glTexParameteriv)
+            {
+                replay.beginCall();
+                glad_glTexParameteriv(target, pname, params);
+                replay.endCall(ENTRY_glTexParameteriv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexImage1D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint level = in.value<GLint>();
+            GLint internalformat = in.value<GLint>();
+            GLsizei width = in.value<GLsizei>();
+            GLint border = in.value<GLint>();
+            GLenum format = in.value<GLenum>();
+            GLenum type = in.value<GLenum>();
+            const void * pixels = (const void *)in.pointer();
+            if (glad_glTexImage1D)
+            {
+                replay.beginCall();
+                glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+                replay.endCall(ENTRY_glTexImage1D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexImage2D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint level = in.value<GLint>();
+            GLint internalformat = in.value<GLint>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            GLint border = in.value<GLint>();
+            GLenum format = in.value<GLenum>();
+            GLenum type = in.value<GLenum>();
+            const void * pixels = (const void *)in.pointer();
+            if (glad_glTexImage2D)
+            {
+                replay.beginCall();
+                glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+                replay.endCall(ENTRY_glTexImage2D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDrawBuffer:
+        {
+            GLenum buf = in.value<GLenum>();
+            if (glad_glDrawBuffer)
+            {
+                replay.beginCall();
+                glad_glDrawBuffer(buf);
+                replay.endCall(ENTRY_glDrawBuffer);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glClear:
+        {
+            GLbitfield mask = in.value<GLbitfield>();
+            if (glad_glClear)
+            {
+                replay.beginCall();
+                glad_glClear(mask);
+                replay.endCall(ENTRY_glClear);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glClearColor:
+        {
+            GLfloat red = in.value<GLfloat>();
+            GLfloat green = in.value<GLfloat>();
+            GLfloat blue = in.value<GLfloat>();
+            GLfloat alpha = in.value<GLfloat>();
+            if (glad_glClearColor)
+            {
+                replay.beginCall();
+                glad_glClearColor(red, green, blue, alpha);
+                replay.endCall(ENTRY_glClearColor);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glClearStencil:
+        {
+            GLint s = in.value<GLint>();
+            if (glad_glClearStencil)
+            {
+                replay.beginCall();
+                glad_glClearStencil(s);
+                replay.endCall(ENTRY_glClearStencil);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glClearDepth:
+        {
+            GLdouble depth = in.value<GLdouble>();
+            if (glad_glClearDepth)
+            {
+                replay.beginCall();
+                glad_glClearDepth(depth);
+                replay.endCall(ENTRY_glClearDepth);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glStencilMask:
+        {
+            GLuint mask = in.value<GLuint>();
+            if (glad_glStencilMask)
+            {
+                replay.beginCall();
+                glad_glStencilMask(mask);
+                replay.endCall(ENTRY_glStencilMask);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColorMask:
+        {
+            GLboolean red = in.value<GLboolean>();
+            GLboolean green = in.value<GLboolean>();
+            GLboolean blue = in.value<GLboolean>();
+            GLboolean alpha = in.value<GLboolean>();
+            if (glad_glColorMask)
+            {
+                replay.beginCall();
+                glad_glColorMask(red, green, blue, alpha);
+                replay.endCall(ENTRY_glColorMask);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDepthMask:
+        {
+            GLboolean flag = in.value<GLboolean>();
+            if (glad_glDepthMask)
+            {
+                replay.beginCall();
+                glad_glDepthMask(flag);
+                replay.endCall(ENTRY_glDepthMask);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDisable:
+        {
+            GLenum cap = in.value<GLenum>();
+            if (glad_glDisable)
+            {
+                replay.beginCall();
+                glad_glDisable(cap);
+                replay.endCall(ENTRY_glDisable);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glEnable:
+        {
+            GLenum cap = in.value<GLenum>();
+            if (glad_glEnable)
+            {
+                replay.beginCall();
+                glad_glEnable(cap);
+                replay.endCall(ENTRY_glEnable);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glFinish:
+        {
+            if (glad_glFinish)
+            {
+                replay.beginCall();
+                glad_glFinish();
+                replay.endCall(ENTRY_glFinish);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glFlush:
+        {
+            if (glad_glFlush)
+            {
+                replay.beginCall();
+                glad_glFlush();
+                replay.endCall(ENTRY_glFlush);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBlendFunc:
+        {
+            GLenum sfactor = in.value<GLenum>();
+            GLenum dfactor = in.value<GLenum>();
+            if (glad_glBlendFunc)
+            {
+                replay.beginCall();
+                glad_glBlendFunc(sfactor, dfactor);
+                replay.endCall(ENTRY_glBlendFunc);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glLogicOp:
+        {
+            GLenum opcode = in.value<GLenum>();
+            if (glad_glLogicOp)
+            {
+                replay.beginCall();
+                glad_glLogicOp(opcode);
+                replay.endCall(ENTRY_glLogicOp);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glStencilFunc:
+        {
+            GLenum func = in.value<GLenum>();
+            GLint ref = in.value<GLint>();
+            GLuint mask = in.value<GLuint>();
+            if (glad_glStencilFunc)
+            {
+                replay.beginCall();
+                glad_glStencilFunc(func, ref, mask);
+                replay.endCall(ENTRY_glStencilFunc);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glStencilOp:
+        {
+            GLenum fail = in.value<GLenum>();
+            GLenum zfail = in.value<GLenum>();
+            GLenum zpass = in.value<GLenum>();
+            if (glad_glStencilOp)
+            {
+                replay.beginCall();
+                glad_glStencilOp(fail, zfail, zpass);
+                replay.endCall(ENTRY_glStencilOp);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDepthFunc:
+        {
+            GLenum func = in.value<GLenum>();
+            if (glad_glDepthFunc)
+            {
+                replay.beginCall();
+                glad_glDepthFunc(func);
+                replay.endCall(ENTRY_glDepthFunc);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPixelStoref:
+        {
+            GLenum pname = in.value<GLenum>();
+            GLfloat param = in.value<GLfloat>();
+            if (glad_glPixelStoref)
+            {
+                replay.beginCall();
+                glad_glPixelStoref(pname, param);
+                replay.endCall(ENTRY_glPixelStoref);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPixelStorei:
+        {
+            GLenum pname = in.value<GLenum>();
+            GLint param = in.value<GLint>();
+            if (glad_glPixelStorei)
+            {
+                replay.beginCall();
+                glad_glPixelStorei(pname, param);
+                replay.endCall(ENTRY_glPixelStorei);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glReadBuffer:
+        {
+            GLenum src = in.value<GLenum>();
+            if (glad_glReadBuffer)
+            {
+                replay.beginCall();
+                glad_glReadBuffer(src);
+                replay.endCall(ENTRY_glReadBuffer);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glReadPixels:
+        {
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            GLenum format = in.value<GLenum>();
+            GLenum type = in.value<GLenum>();
+            void * pixels = (void *)in.pointer();
+            if (glad_glReadPixels)
+            {
+                replay.beginCall();
+                glad_glReadPixels(x, y, width, height, format, type, pixels);
+                replay.endCall(ENTRY_glReadPixels);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDepthRange:
+        {
+            GLdouble n = in.value<GLdouble>();
+            GLdouble f = in.value<GLdouble>();
+            if (glad_glDepthRange)
+            {
+                replay.beginCall();
+                glad_glDepthRange(n, f);
+                replay.endCall(ENTRY_glDepthRange);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glViewport:
+        {
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            if (glad_glViewport)
+            {
+                replay.beginCall();
+                glad_glViewport(x, y, width, height);
+                replay.endCall(ENTRY_glViewport);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glNewList:
+        {
+            GLuint list = in.value<GLuint>();
+            GLenum mode = in.value<GLenum>();
+            if (glad_glNewList)
+            {
+                replay.beginCall();
+                glad_glNewList(list, mode);
+                replay.endCall(ENTRY_glNewList);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glEndList:
+        {
+            if (glad_glEndList)
+            {
+                replay.beginCall();
+                glad_glEndList();
+                replay.endCall(ENTRY_glEndList);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glCallList:
+        {
+            GLuint list = in.value<GLuint>();
+            if (glad_glCallList)
+            {
+                replay.beginCall();
+                glad_glCallList(list);
+                replay.endCall(ENTRY_glCallList);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDeleteLists:
+        {
+            GLuint list = in.value<GLuint>();
+            GLsizei range = in.value<GLsizei>();
+            if (glad_glDeleteLists)
+            {
+                replay.beginCall();
+                glad_glDeleteLists(list, range);
+                replay.endCall(ENTRY_glDeleteLists);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glGenLists:
+        {
+            GLsizei range = in.value<GLsizei>();
+            GLuint result = GLuint();
+            if (glad_glGenLists)
+            {
+                replay.beginCall();
+                result = glad_glGenLists(range);
+                replay.endCall(ENTRY_glGenLists);
+            }
+            else
+                replay.missing();
+            (void)result;
+            return true;
+        }
+        case ENTRY_glListBase:
+        {
+            GLuint base = in.value<GLuint>();
+            if (glad_glListBase)
+            {
+                replay.beginCall();
+                glad_glListBase(base);
+                replay.endCall(ENTRY_glListBase);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBegin:
+        {
+            GLenum mode = in.value<GLenum>();
+            if (glad_glBegin)
+            {
+                replay.beginCall();
+                glad_glBegin(mode);
+                replay.endCall(ENTRY_glBegin);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColor3b:
+        {
+            GLbyte red = in.value<GLbyte>();
+            GLbyte green = in.value<GLbyte>();
+            GLbyte blue = in.value<GLbyte>();
+            if (glad_glColor3b)
+            {
+                replay.beginCall();
+                glad_glColor3b(red, green, blue);
+                replay.endCall(ENTRY_glColor3b);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColor3d:
+        {
+            GLdouble red = in.value<GLdouble>();
+            GLdouble green = in.value<GLdouble>();
+            GLdouble blue = in.value<GLdouble>();
+            if (glad_glColor3d)
+            {
+                replay.beginCall();
+                glad_glColor3d(red, green, blue);
+                replay.endCall(ENTRY_glColor3d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColor3f:
+        {
+            GLfloat red = in.value<GLfloat>();
+            GLfloat green = in.value<GLfloat>();
+            GLfloat blue = in.value<GLfloat>();
+            if (glad_glColor3f)
+            {
+                replay.beginCall();
+                glad_glColor3f(red, green, blue);
+                replay.endCall(ENTRY_glColor3f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColor3i:
+        {
+            GLint red = in.value<GLint>();
+            GLint green = in.value<GLint>();
+            GLint blue = in.value<GLint>();
+            if (glad_glColor3i)
+            {
+                replay.beginCall();
+                glad_glColor3i(red, green, blue);
+                replay.endCall(ENTRY_glColor3i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColor3s:
+        {
+            GLshort red = in.value<GLshort>();
+            GLshort green = in.value<GLshort>();
+            GLshort blue = in.value<GLshort>();
+            if (glad_glColor3s)
+            {
+                replay.beginCall();
+                glad_glColor3s(red, green, blue);
+                replay.endCall(ENTRY_glColor3s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColor3ub:
+        {
+            GLubyte red = in.value<GLubyte>();
+            GLubyte green = in.value<GLubyte>();
+            GLubyte blue = in.value<GLubyte>();
+            if (glad_glColor3ub)
+            {
+                replay.beginCall();
+                glad_glColor3ub(red, green, blue);
+                replay.endCall(ENTRY_glColor3ub);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColor3ui:
+        {
+            GLuint red = in.value<GLuint>();
+            GLuint green = in.value<GLuint>();
+            GLuint blue = in.value<GLuint>();
+            if (glad_glColor3ui)
+            {
+                replay.beginCall();
+                glad_glColor3ui(red, green, blue);
+                replay.endCall(ENTRY_glColor3ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColor3us:
+        {
+            GLushort red = in.value<GLushort>();
+            GLushort green = in.value<GLushort>();
+            GLushort blue = in.value<GLushort>();
+            if (glad_glColor3us)
+            {
+                replay.beginCall();
+                glad_glColor3us(red, green, blue);
+                replay.endCall(ENTRY_glColor3us);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColor4b:
+        {
+            GLbyte red = in.value<GLbyte>();
+            GLbyte green = in.value<GLbyte>();
+            GLbyte blue = in.value<GLbyte>();
+            GLbyte alpha = in.value<GLbyte>();
+            if (glad_glColor4b)
+            {
+                replay.beginCall();
+                glad_glColor4b(red, green, blue, alpha);
+                replay.endCall(ENTRY_glColor4b);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColor4d:
+        {
+            GLdouble red = in.value<GLdouble>();
+            GLdouble green = in.value<GLdouble>();
+            GLdouble blue = in.value<GLdouble>();
+            GLdouble alpha = in.value<GLdouble>();
+            if (glad_glColor4d)
+            {
+                replay.beginCall();
+                glad_glColor4d(red, green, blue, alpha);
+                replay.endCall(ENTRY_glColor4d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColor4f:
+        {
+            GLfloat red = in.value<GLfloat>();
+            GLfloat green = in.value<GLfloat>();
+            GLfloat blue = in.value<GLfloat>();
+            GLfloat alpha = in.value<GLfloat>();
+            if (glad_glColor4f)
+            {
+                replay.beginCall();
+                glad_glColor4f(red, green, blue, alpha);
+                replay.endCall(ENTRY_glColor4f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColor4i:
+        {
+            GLint red = in.value<GLint>();
+            GLint green = in.value<GLint>();
+            GLint blue = in.value<GLint>();
+            GLint alpha = in.value<GLint>();
+            if (glad_glColor4i)
+            {
+                replay.beginCall();
+                glad_glColor4i(red, green, blue, alpha);
+                replay.endCall(ENTRY_glColor4i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColor4s:
+        {
+            GLshort red = in.value<GLshort>();
+            GLshort green = in.value<GLshort>();
+            GLshort blue = in.value<GLshort>();
+            GLshort alpha = in.value<GLshort>();
+            if (glad_glColor4s)
+            {
+                replay.beginCall();
+                glad_glColor4s(red, green, blue, alpha);
+                replay.endCall(ENTRY_glColor4s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColor4ub:
+        {
+            GLubyte red = in.value<GLubyte>();
+            GLubyte green = in.value<GLubyte>();
+            GLubyte blue = in.value<GLubyte>();
+            GLubyte alpha = in.value<GLubyte>();
+            if (glad_glColor4ub)
+            {
+                replay.beginCall();
+                glad_glColor4ub(red, green, blue, alpha);
+                replay.endCall(ENTRY_glColor4ub);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColor4ui:
+        {
+            GLuint red = in.value<GLuint>();
+            GLuint green = in.value<GLuint>();
+            GLuint blue = in.value<GLuint>();
+            GLuint alpha = in.value<GLuint>();
+            if (glad_glColor4ui)
+            {
+                replay.beginCall();
+                glad_glColor4ui(red, green, blue, alpha);
+                replay.endCall(ENTRY_glColor4ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColor4us:
+        {
+            GLushort red = in.value<GLushort>();
+            GLushort green = in.value<GLushort>();
+            GLushort blue = in.value<GLushort>();
+            GLushort alpha = in.value<GLushort>();
+            if (glad_glColor4us)
+            {
+                replay.beginCall();
+                glad_glColor4us(red, green, blue, alpha);
+                replay.endCall(ENTRY_glColor4us);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glEdgeFlag:
+        {
+            GLboolean flag = in.value<GLboolean>();
+            if (glad_glEdgeFlag)
+            {
+                replay.beginCall();
+                glad_glEdgeFlag(flag);
+                replay.endCall(ENTRY_glEdgeFlag);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glEnd:
+        {
+            if (glad_glEnd)
+            {
+                replay.beginCall();
+                glad_glEnd();
+                replay.endCall(ENTRY_glEnd);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glIndexd:
+        {
+            GLdouble c = in.value<GLdouble>();
+            if (glad_glIndexd)
+            {
+                replay.beginCall();
+                glad_glIndexd(c);
+                replay.endCall(ENTRY_glIndexd);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glIndexf:
+        {
+            GLfloat c = in.value<GLfloat>();
+            if (glad_glIndexf)
+            {
+                replay.beginCall();
+                glad_glIndexf(c);
+                replay.endCall(ENTRY_glIndexf);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glIndexi:
+        {
+            GLint c = in.value<GLint>();
+            if (glad_glIndexi)
+            {
+                replay.beginCall();
+                glad_glIndexi(c);
+                replay.endCall(ENTRY_glIndexi);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glIndexs:
+        {
+            GLshort c = in.value<GLshort>();
+            if (glad_glIndexs)
+            {
+                replay.beginCall();
+                glad_glIndexs(c);
+                replay.endCall(ENTRY_glIndexs);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glNormal3b:
+        {
+            GLbyte nx = in.value<GLbyte>();
+            GLbyte ny = in.value<GLbyte>();
+            GLbyte nz = in.value<GLbyte>();
+            if (glad_glNormal3b)
+            {
+                replay.beginCall();
+                glad_glNormal3b(nx, ny, nz);
+                replay.endCall(ENTRY_glNormal3b);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glNormal3d:
+        {
+            GLdouble nx = in.value<GLdouble>();
+            GLdouble ny = in.value<GLdouble>();
+            GLdouble nz = in.value<GLdouble>();
+            if (glad_glNormal3d)
+            {
+                replay.beginCall();
+                glad_glNormal3d(nx, ny, nz);
+                replay.endCall(ENTRY_glNormal3d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glNormal3f:
+        {
+            GLfloat nx = in.value<GLfloat>();
+            GLfloat ny = in.value<GLfloat>();
+            GLfloat nz = in.value<GLfloat>();
+            if (glad_glNormal3f)
+            {
+                replay.beginCall();
+                glad_glNormal3f(nx, ny, nz);
+                replay.endCall(ENTRY_glNormal3f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glNormal3i:
+        {
+            GLint nx = in.value<GLint>();
+            GLint ny = in.value<GLint>();
+            GLint nz = in.value<GLint>();
+            if (glad_glNormal3i)
+            {
+                replay.beginCall();
+                glad_glNormal3i(nx, ny, nz);
+                replay.endCall(ENTRY_glNormal3i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glNormal3s:
+        {
+            GLshort nx = in.value<GLshort>();
+            GLshort ny = in.value<GLshort>();
+            GLshort nz = in.value<GLshort>();
+            if (glad_glNormal3s)
+            {
+                replay.beginCall();
+                glad_glNormal3s(nx, ny, nz);
+                replay.endCall(ENTRY_glNormal3s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRasterPos2d:
+        {
+            GLdouble x = in.value<GLdouble>();
+            GLdouble y = in.value<GLdouble>();
+            if (glad_glRasterPos2d)
+            {
+                replay.beginCall();
+                glad_glRasterPos2d(x, y);
+                replay.endCall(ENTRY_glRasterPos2d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRasterPos2f:
+        {
+            GLfloat x = in.value<GLfloat>();
+            GLfloat y = in.value<GLfloat>();
+            if (glad_glRasterPos2f)
+            {
+                replay.beginCall();
+                glad_glRasterPos2f(x, y);
+                replay.endCall(ENTRY_glRasterPos2f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRasterPos2i:
+        {
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            if (glad_glRasterPos2i)
+            {
+                replay.beginCall();
+                glad_glRasterPos2i(x, y);
+                replay.endCall(ENTRY_glRasterPos2i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRasterPos2s:
+        {
+            GLshort x = in.value<GLshort>();
+            GLshort y = in.value<GLshort>();
+            if (glad_glRasterPos2s)
+            {
+                replay.beginCall();
+                glad_glRasterPos2s(x, y);
+                replay.endCall(ENTRY_glRasterPos2s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRasterPos3d:
+        {
+            GLdouble x = in.value<GLdouble>();
+            GLdouble y = in.value<GLdouble>();
+            GLdouble z = in.value<GLdouble>();
+            if (glad_glRasterPos3d)
+            {
+                replay.beginCall();
+                glad_glRasterPos3d(x, y, z);
+                replay.endCall(ENTRY_glRasterPos3d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRasterPos3f:
+        {
+            GLfloat x = in.value<GLfloat>();
+            GLfloat y = in.value<GLfloat>();
+            GLfloat z = in.value<GLfloat>();
+            if (glad_glRasterPos3f)
+            {
+                replay.beginCall();
+                glad_glRasterPos3f(x, y, z);
+                replay.endCall(ENTRY_glRasterPos3f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRasterPos3i:
+        {
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            GLint z = in.value<GLint>();
+            if (glad_glRasterPos3i)
+            {
+                replay.beginCall();
+                glad_glRasterPos3i(x, y, z);
+                replay.endCall(ENTRY_glRasterPos3i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRasterPos3s:
+        {
+            GLshort x = in.value<GLshort>();
+            GLshort y = in.value<GLshort>();
+            GLshort z = in.value<GLshort>();
+            if (glad_glRasterPos3s)
+            {
+                replay.beginCall();
+                glad_glRasterPos3s(x, y, z);
+                replay.endCall(ENTRY_glRasterPos3s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRasterPos4d:
+        {
+            GLdouble x = in.value<GLdouble>();
+            GLdouble y = in.value<GLdouble>();
+            GLdouble z = in.value<GLdouble>();
+            GLdouble w = in.value<GLdouble>();
+            if (glad_glRasterPos4d)
+            {
+                replay.beginCall();
+                glad_glRasterPos4d(x, y, z, w);
+                replay.endCall(ENTRY_glRasterPos4d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRasterPos4f:
+        {
+            GLfloat x = in.value<GLfloat>();
+            GLfloat y = in.value<GLfloat>();
+            GLfloat z = in.value<GLfloat>();
+            GLfloat w = in.value<GLfloat>();
+            if (glad_glRasterPos4f)
+            {
+                replay.beginCall();
+                glad_glRasterPos4f(x, y, z, w);
+                replay.endCall(ENTRY_glRasterPos4f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRasterPos4i:
+        {
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            GLint z = in.value<GLint>();
+            GLint w = in.value<GLint>();
+            if (glad_glRasterPos4i)
+            {
+                replay.beginCall();
+                glad_glRasterPos4i(x, y, z, w);
+                replay.endCall(ENTRY_glRasterPos4i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRasterPos4s:
+        {
+            GLshort x = in.value<GLshort>();
+            GLshort y = in.value<GLshort>();
+            GLshort z = in.value<GLshort>();
+            GLshort w = in.value<GLshort>();
+            if (glad_glRasterPos4s)
+            {
+                replay.beginCall();
+                glad_glRasterPos4s(x, y, z, w);
+                replay.endCall(ENTRY_glRasterPos4s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRectd:
+        {
+            GLdouble x1 = in.value<GLdouble>();
+            GLdouble y1 = in.value<GLdouble>();
+            GLdouble x2 = in.value<GLdouble>();
+            GLdouble y2 = in.value<GLdouble>();
+            if (glad_glRectd)
+            {
+                replay.beginCall();
+                glad_glRectd(x1, y1, x2, y2);
+                replay.endCall(ENTRY_glRectd);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRectf:
+        {
+            GLfloat x1 = in.value<GLfloat>();
+            GLfloat y1 = in.value<GLfloat>();
+            GLfloat x2 = in.value<GLfloat>();
+            GLfloat y2 = in.value<GLfloat>();
+            if (glad_glRectf)
+            {
+                replay.beginCall();
+                glad_glRectf(x1, y1, x2, y2);
+                replay.endCall(ENTRY_glRectf);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRecti:
+        {
+            GLint x1 = in.value<GLint>();
+            GLint y1 = in.value<GLint>();
+            GLint x2 = in.value<GLint>();
+            GLint y2 = in.value<GLint>();
+            if (glad_glRecti)
+            {
+                replay.beginCall();
+                glad_glRecti(x1, y1, x2, y2);
+                replay.endCall(ENTRY_glRecti);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRects:
+        {
+            GLshort x1 = in.value<GLshort>();
+            GLshort y1 = in.value<GLshort>();
+            GLshort x2 = in.value<GLshort>();
+            GLshort y2 = in.value<GLshort>();
+            if (glad_glRects)
+            {
+                replay.beginCall();
+                glad_glRects(x1, y1, x2, y2);
+                replay.endCall(ENTRY_glRects);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoord1d:
+        {
+            GLdouble s = in.value<GLdouble>();
+            if (glad_glTexCoord1d)
+            {
+                replay.beginCall();
+                glad_glTexCoord1d(s);
+                replay.endCall(ENTRY_glTexCoord1d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoord1f:
+        {
+            GLfloat s = in.value<GLfloat>();
+            if (glad_glTexCoord1f)
+            {
+                replay.beginCall();
+                glad_glTexCoord1f(s);
+                replay.endCall(ENTRY_glTexCoord1f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoord1i:
+        {
+            GLint s = in.value<GLint>();
+            if (glad_glTexCoord1i)
+            {
+                replay.beginCall();
+                glad_glTexCoord1i(s);
+                replay.endCall(ENTRY_glTexCoord1i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoord1s:
+        {
+            GLshort s = in.value<GLshort>();
+            if (glad_glTexCoord1s)
+            {
+                replay.beginCall();
+                glad_glTexCoord1s(s);
+                replay.endCall(ENTRY_glTexCoord1s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoord2d:
+        {
+            GLdouble s = in.value<GLdouble>();
+            GLdouble t = in.value<GLdouble>();
+            if (glad_glTexCoord2d)
+            {
+                replay.beginCall();
+                glad_glTexCoord2d(s, t);
+                replay.endCall(ENTRY_glTexCoord2d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoord2f:
+        {
+            GLfloat s = in.value<GLfloat>();
+            GLfloat t = in.value<GLfloat>();
+            if (glad_glTexCoord2f)
+            {
+                replay.beginCall();
+                glad_glTexCoord2f(s, t);
+                replay.endCall(ENTRY_glTexCoord2f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoord2i:
+        {
+            GLint s = in.value<GLint>();
+            GLint t = in.value<GLint>();
+            if (glad_glTexCoord2i)
+            {
+                replay.beginCall();
+                glad_glTexCoord2i(s, t);
+                replay.endCall(ENTRY_glTexCoord2i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoord2s:
+        {
+            GLshort s = in.value<GLshort>();
+            GLshort t = in.value<GLshort>();
+            if (glad_glTexCoord2s)
+            {
+                replay.beginCall();
+                glad_glTexCoord2s(s, t);
+                replay.endCall(ENTRY_glTexCoord2s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoord3d:
+        {
+            GLdouble s = in.value<GLdouble>();
+            GLdouble t = in.value<GLdouble>();
+            GLdouble r = in.value<GLdouble>();
+            if (glad_glTexCoord3d)
+            {
+                replay.beginCall();
+                glad_glTexCoord3d(s, t, r);
+                replay.endCall(ENTRY_glTexCoord3d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoord3f:
+        {
+            GLfloat s = in.value<GLfloat>();
+            GLfloat t = in.value<GLfloat>();
+            GLfloat r = in.value<GLfloat>();
+            if (glad_glTexCoord3f)
+            {
+                replay.beginCall();
+                glad_glTexCoord3f(s, t, r);
+                replay.endCall(ENTRY_glTexCoord3f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoord3i:
+        {
+            GLint s = in.value<GLint>();
+            GLint t = in.value<GLint>();
+            GLint r = in.value<GLint>();
+            if (glad_glTexCoord3i)
+            {
+                replay.beginCall();
+                glad_glTexCoord3i(s, t, r);
+                replay.endCall(ENTRY_glTexCoord3i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoord3s:
+        {
+            GLshort s = in.value<GLshort>();
+            GLshort t = in.value<GLshort>();
+            GLshort r = in.value<GLshort>();
+            if (glad_glTexCoord3s)
+            {
+                replay.beginCall();
+                glad_glTexCoord3s(s, t, r);
+                replay.endCall(ENTRY_glTexCoord3s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoord4d:
+        {
+            GLdouble s = in.value<GLdouble>();
+            GLdouble t = in.value<GLdouble>();
+            GLdouble r = in.value<GLdouble>();
+            GLdouble q = in.value<GLdouble>();
+            if (glad_glTexCoord4d)
+            {
+                replay.beginCall();
+                glad_glTexCoord4d(s, t, r, q);
+                replay.endCall(ENTRY_glTexCoord4d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoord4f:
+        {
+            GLfloat s = in.value<GLfloat>();
+            GLfloat t = in.value<GLfloat>();
+            GLfloat r = in.value<GLfloat>();
+            GLfloat q = in.value<GLfloat>();
+            if (glad_glTexCoord4f)
+            {
+                replay.beginCall();
+                glad_glTexCoord4f(s, t, r, q);
+                replay.endCall(ENTRY_glTexCoord4f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoord4i:
+        {
+            GLint s = in.value<GLint>();
+            GLint t = in.value<GLint>();
+            GLint r = in.value<GLint>();
+            GLint q = in.value<GLint>();
+            if (glad_glTexCoord4i)
+            {
+                replay.beginCall();
+                glad_glTexCoord4i(s, t, r, q);
+                replay.endCall(ENTRY_glTexCoord4i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoord4s:
+        {
+            GLshort s = in.value<GLshort>();
+            GLshort t = in.value<GLshort>();
+            GLshort r = in.value<GLshort>();
+            GLshort q = in.value<GLshort>();
+            if (glad_glTexCoord4s)
+            {
+                replay.beginCall();
+                glad_glTexCoord4s(s, t, r, q);
+                replay.endCall(ENTRY_glTexCoord4s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertex2d:
+        {
+            GLdouble x = in.value<GLdouble>();
+            GLdouble y = in.value<GLdouble>();
+            if (glad_glVertex2d)
+            {
+                replay.beginCall();
+                glad_glVertex2d(x, y);
+                replay.endCall(ENTRY_glVertex2d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertex2f:
+        {
+            GLfloat x = in.value<GLfloat>();
+            GLfloat y = in.value<GLfloat>();
+            if (glad_glVertex2f)
+            {
+                replay.beginCall();
+                glad_glVertex2f(x, y);
+                replay.endCall(ENTRY_glVertex2f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertex2i:
+        {
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            if (glad_glVertex2i)
+            {
+                replay.beginCall();
+                glad_glVertex2i(x, y);
+                replay.endCall(ENTRY_glVertex2i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertex2s:
+        {
+            GLshort x = in.value<GLshort>();
+            GLshort y = in.value<GLshort>();
+            if (glad_glVertex2s)
+            {
+                replay.beginCall();
+                glad_glVertex2s(x, y);
+                replay.endCall(ENTRY_glVertex2s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertex3d:
+        {
+            GLdouble x = in.value<GLdouble>();
+            GLdouble y = in.value<GLdouble>();
+            GLdouble z = in.value<GLdouble>();
+            if (glad_glVertex3d)
+            {
+                replay.beginCall();
+                glad_glVertex3d(x, y, z);
+                replay.endCall(ENTRY_glVertex3d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertex3f:
+        {
+            GLfloat x = in.value<GLfloat>();
+            GLfloat y = in.value<GLfloat>();
+            GLfloat z = in.value<GLfloat>();
+            if (glad_glVertex3f)
+            {
+                replay.beginCall();
+                glad_glVertex3f(x, y, z);
+                replay.endCall(ENTRY_glVertex3f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertex3i:
+        {
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            GLint z = in.value<GLint>();
+            if (glad_glVertex3i)
+            {
+                replay.beginCall();
+                glad_glVertex3i(x, y, z);
+                replay.endCall(ENTRY_glVertex3i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertex3s:
+        {
+            GLshort x = in.value<GLshort>();
+            GLshort y = in.value<GLshort>();
+            GLshort z = in.value<GLshort>();
+            if (glad_glVertex3s)
+            {
+                replay.beginCall();
+                glad_glVertex3s(x, y, z);
+                replay.endCall(ENTRY_glVertex3s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertex4d:
+        {
+            GLdouble x = in.value<GLdouble>();
+            GLdouble y = in.value<GLdouble>();
+            GLdouble z = in.value<GLdouble>();
+            GLdouble w = in.value<GLdouble>();
+            if (glad_glVertex4d)
+            {
+                replay.beginCall();
+                glad_glVertex4d(x, y, z, w);
+                replay.endCall(ENTRY_glVertex4d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertex4f:
+        {
+            GLfloat x = in.value<GLfloat>();
+            GLfloat y = in.value<GLfloat>();
+            GLfloat z = in.value<GLfloat>();
+            GLfloat w = in.value<GLfloat>();
+            if (glad_glVertex4f)
+            {
+                replay.beginCall();
+                glad_glVertex4f(x, y, z, w);
+                replay.endCall(ENTRY_glVertex4f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertex4i:
+        {
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            GLint z = in.value<GLint>();
+            GLint w = in.value<GLint>();
+            if (glad_glVertex4i)
+            {
+                replay.beginCall();
+                glad_glVertex4i(x, y, z, w);
+                replay.endCall(ENTRY_glVertex4i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertex4s:
+        {
+            GLshort x = in.value<GLshort>();
+            GLshort y = in.value<GLshort>();
+            GLshort z = in.value<GLshort>();
+            GLshort w = in.value<GLshort>();
+            if (glad_glVertex4s)
+            {
+                replay.beginCall();
+                glad_glVertex4s(x, y, z, w);
+                replay.endCall(ENTRY_glVertex4s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColorMaterial:
+        {
+            GLenum face = in.value<GLenum>();
+            GLenum mode = in.value<GLenum>();
+            if (glad_glColorMaterial)
+            {
+                replay.beginCall();
+                glad_glColorMaterial(face, mode);
+                replay.endCall(ENTRY_glColorMaterial);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glFogf:
+        {
+            GLenum pname = in.value<GLenum>();
+            GLfloat param = in.value<GLfloat>();
+            if (glad_glFogf)
+            {
+                replay.beginCall();
+                glad_glFogf(pname, param);
+                replay.endCall(ENTRY_glFogf);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glFogi:
+        {
+            GLenum pname = in.value<GLenum>();
+            GLint param = in.value<GLint>();
+            if (glad_glFogi)
+            {
+                replay.beginCall();
+                glad_glFogi(pname, param);
+                replay.endCall(ENTRY_glFogi);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glLightf:
+        {
+            GLenum light = in.value<GLenum>();
+            GLenum pname = in.value<GLenum>();
+            GLfloat param = in.value<GLfloat>();
+            if (glad_glLightf)
+            {
+                replay.beginCall();
+                glad_glLightf(light, pname, param);
+                replay.endCall(ENTRY_glLightf);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glLighti:
+        {
+            GLenum light = in.value<GLenum>();
+            GLenum pname = in.value<GLenum>();
+            GLint param = in.value<GLint>();
+            if (glad_glLighti)
+            {
+                replay.beginCall();
+                glad_glLighti(light, pname, param);
+                replay.endCall(ENTRY_glLighti);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glLightModelf:
+        {
+            GLenum pname = in.value<GLenum>();
+            GLfloat param = in.value<GLfloat>();
+            if (glad_glLightModelf)
+            {
+                replay.beginCall();
+                glad_glLightModelf(pname, param);
+                replay.endCall(ENTRY_glLightModelf);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glLightModeli:
+        {
+            GLenum pname = in.value<GLenum>();
+            GLint param = in.value<GLint>();
+            if (glad_glLightModeli)
+            {
+                replay.beginCall();
+                glad_glLightModeli(pname, param);
+                replay.endCall(ENTRY_glLightModeli);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glLineStipple:
+        {
+            GLint factor = in.value<GLint>();
+            GLushort pattern = in.value<GLushort>();
+            if (glad_glLineStipple)
+            {
+                replay.beginCall();
+                glad_glLineStipple(factor, pattern);
+                replay.endCall(ENTRY_glLineStipple);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMaterialf:
+        {
+            GLenum face = in.value<GLenum>();
+            GLenum pname = in.value<GLenum>();
+            GLfloat param = in.value<GLfloat>();
+            if (glad_glMaterialf)
+            {
+                replay.beginCall();
+                glad_glMaterialf(face, pname, param);
+                replay.endCall(ENTRY_glMaterialf);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMateriali:
+        {
+            GLenum face = in.value<GLenum>();
+            GLenum pname = in.value<GLenum>();
+            GLint param = in.value<GLint>();
+            if (glad_glMateriali)
+            {
+                replay.beginCall();
+                glad_glMateriali(face, pname, param);
+                replay.endCall(ENTRY_glMateriali);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glShadeModel:
+        {
+            GLenum mode = in.value<GLenum>();
+            if (glad_glShadeModel)
+            {
+                replay.beginCall();
+                glad_glShadeModel(mode);
+                replay.endCall(ENTRY_glShadeModel);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexEnvf:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum pname = in.value<GLenum>();
+            GLfloat param = in.value<GLfloat>();
+            if (glad_glTexEnvf)
+            {
+                replay.beginCall();
+                glad_glTexEnvf(target, pname, param);
+                replay.endCall(ENTRY_glTexEnvf);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexEnvi:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum pname = in.value<GLenum>();
+            GLint param = in.value<GLint>();
+            if (glad_glTexEnvi)
+            {
+                replay.beginCall();
+                glad_glTexEnvi(target, pname, param);
+                replay.endCall(ENTRY_glTexEnvi);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexGend:
+        {
+            GLenum coord = in.value<GLenum>();
+            GLenum pname = in.value<GLenum>();
+            GLdouble param = in.value<GLdouble>();
+            if (glad_glTexGend)
+            {
+                replay.beginCall();
+                glad_glTexGend(coord, pname, param);
+                replay.endCall(ENTRY_glTexGend);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexGenf:
+        {
+            GLenum coord = in.value<GLenum>();
+            GLenum pname = in.value<GLenum>();
+            GLfloat param = in.value<GLfloat>();
+            if (glad_glTexGenf)
+            {
+                replay.beginCall();
+                glad_glTexGenf(coord, pname, param);
+                replay.endCall(ENTRY_glTexGenf);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexGeni:
+        {
+            GLenum coord = in.value<GLenum>();
+            GLenum pname = in.value<GLenum>();
+            GLint param = in.value<GLint>();
+            if (glad_glTexGeni)
+            {
+                replay.beginCall();
+                glad_glTexGeni(coord, pname, param);
+                replay.endCall(ENTRY_glTexGeni);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glInitNames:
+        {
+            if (glad_glInitNames)
+            {
+                replay.beginCall();
+                glad_glInitNames();
+                replay.endCall(ENTRY_glInitNames);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glLoadName:
+        {
+            GLuint name = in.value<GLuint>();
+            if (glad_glLoadName)
+            {
+                replay.beginCall();
+                glad_glLoadName(name);
+                replay.endCall(ENTRY_glLoadName);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPassThrough:
+        {
+            GLfloat token = in.value<GLfloat>();
+            if (glad_glPassThrough)
+            {
+                replay.beginCall();
+                glad_glPassThrough(token);
+                replay.endCall(ENTRY_glPassThrough);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPopName:
+        {
+            if (glad_glPopName)
+            {
+                replay.beginCall();
+                glad_glPopName();
+                replay.endCall(ENTRY_glPopName);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPushName:
+        {
+            GLuint name = in.value<GLuint>();
+            if (glad_glPushName)
+            {
+                replay.beginCall();
+                glad_glPushName(name);
+                replay.endCall(ENTRY_glPushName);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glClearAccum:
+        {
+            GLfloat red = in.value<GLfloat>();
+            GLfloat green = in.value<GLfloat>();
+            GLfloat blue = in.value<GLfloat>();
+            GLfloat alpha = in.value<GLfloat>();
+            if (glad_glClearAccum)
+            {
+                replay.beginCall();
+                glad_glClearAccum(red, green, blue, alpha);
+                replay.endCall(ENTRY_glClearAccum);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glClearIndex:
+        {
+            GLfloat c = in.value<GLfloat>();
+            if (glad_glClearIndex)
+            {
+                replay.beginCall();
+                glad_glClearIndex(c);
+                replay.endCall(ENTRY_glClearIndex);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glIndexMask:
+        {
+            GLuint mask = in.value<GLuint>();
+            if (glad_glIndexMask)
+            {
+                replay.beginCall();
+                glad_glIndexMask(mask);
+                replay.endCall(ENTRY_glIndexMask);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glAccum:
+        {
+            GLenum op = in.value<GLenum>();
+            GLfloat value = in.value<GLfloat>();
+            if (glad_glAccum)
+            {
+                replay.beginCall();
+                glad_glAccum(op, value);
+                replay.endCall(ENTRY_glAccum);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPopAttrib:
+        {
+            if (glad_glPopAttrib)
+            {
+                replay.beginCall();
+                glad_glPopAttrib();
+                replay.endCall(ENTRY_glPopAttrib);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPushAttrib:
+        {
+            GLbitfield mask = in.value<GLbitfield>();
+            if (glad_glPushAttrib)
+            {
+                replay.beginCall();
+                glad_glPushAttrib(mask);
+                replay.endCall(ENTRY_glPushAttrib);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMapGrid1d:
+        {
+            GLint un = in.value<GLint>();
+            GLdouble u1 = in.value<GLdouble>();
+            GLdouble u2 = in.value<GLdouble>();
+            if (glad_glMapGrid1d)
+            {
+                replay.beginCall();
+                glad_glMapGrid1d(un, u1, u2);
+                replay.endCall(ENTRY_glMapGrid1d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMapGrid1f:
+        {
+            GLint un = in.value<GLint>();
+            GLfloat u1 = in.value<GLfloat>();
+            GLfloat u2 = in.value<GLfloat>();
+            if (glad_glMapGrid1f)
+            {
+                replay.beginCall();
+                glad_glMapGrid1f(un, u1, u2);
+                replay.endCall(ENTRY_glMapGrid1f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMapGrid2d:
+        {
+            GLint un = in.value<GLint>();
+            GLdouble u1 = in.value<GLdouble>();
+            GLdouble u2 = in.value<GLdouble>();
+            GLint vn = in.value<GLint>();
+            GLdouble v1 = in.value<GLdouble>();
+            GLdouble v2 = in.value<GLdouble>();
+            if (glad_glMapGrid2d)
+            {
+                replay.beginCall();
+                glad_glMapGrid2d(un, u1, u2, vn, v1, v2);
+                replay.endCall(ENTRY_glMapGrid2d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMapGrid2f:
+        {
+            GLint un = in.value<GLint>();
+            GLfloat u1 = in.value<GLfloat>();
+            GLfloat u2 = in.value<GLfloat>();
+            GLint vn = in.value<GLint>();
+            GLfloat v1 = in.value<GLfloat>();
+            GLfloat v2 = in.value<GLfloat>();
+            if (glad_glMapGrid2f)
+            {
+                replay.beginCall();
+                glad_glMapGrid2f(un, u1, u2, vn, v1, v2);
+                replay.endCall(ENTRY_glMapGrid2f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glEvalCoord1d:
+        {
+            GLdouble u = in.value<GLdouble>();
+            if (glad_glEvalCoord1d)
+            {
+                replay.beginCall();
+                glad_glEvalCoord1d(u);
+                replay.endCall(ENTRY_glEvalCoord1d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glEvalCoord1f:
+        {
+            GLfloat u = in.value<GLfloat>();
+            if (glad_glEvalCoord1f)
+            {
+                replay.beginCall();
+                glad_glEvalCoord1f(u);
+                replay.endCall(ENTRY_glEvalCoord1f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glEvalCoord2d:
+        {
+            GLdouble u = in.value<GLdouble>();
+            GLdouble v = in.value<GLdouble>();
+            if (glad_glEvalCoord2d)
+            {
+                replay.beginCall();
+                glad_glEvalCoord2d(u, v);
+                replay.endCall(ENTRY_glEvalCoord2d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glEvalCoord2f:
+        {
+            GLfloat u = in.value<GLfloat>();
+            GLfloat v = in.value<GLfloat>();
+            if (glad_glEvalCoord2f)
+            {
+                replay.beginCall();
+                glad_glEvalCoord2f(u, v);
+                replay.endCall(ENTRY_glEvalCoord2f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glEvalMesh1:
+        {
+            GLenum mode = in.value<GLenum>();
+            GLint i1 = in.value<GLint>();
+            GLint i2 = in.value<GLint>();
+            if (glad_glEvalMesh1)
+            {
+                replay.beginCall();
+                glad_glEvalMesh1(mode, i1, i2);
+                replay.endCall(ENTRY_glEvalMesh1);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glEvalPoint1:
+        {
+            GLint i = in.value<GLint>();
+            if (glad_glEvalPoint1)
+            {
+                replay.beginCall();
+                glad_glEvalPoint1(i);
+                replay.endCall(ENTRY_glEvalPoint1);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glEvalMesh2:
+        {
+            GLenum mode = in.value<GLenum>();
+            GLint i1 = in.value<GLint>();
+            GLint i2 = in.value<GLint>();
+            GLint j1 = in.value<GLint>();
+            GLint j2 = in.value<GLint>();
+            if (glad_glEvalMesh2)
+            {
+                replay.beginCall();
+                glad_glEvalMesh2(mode, i1, i2, j1, j2);
+                replay.endCall(ENTRY_glEvalMesh2);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glEvalPoint2:
+        {
+            GLint i = in.value<GLint>();
+            GLint j = in.value<GLint>();
+            if (glad_glEvalPoint2)
+            {
+                replay.beginCall();
+                glad_glEvalPoint2(i, j);
+                replay.endCall(ENTRY_glEvalPoint2);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glAlphaFunc:
+        {
+            GLenum func = in.value<GLenum>();
+            GLfloat ref = in.value<GLfloat>();
+            if (glad_glAlphaFunc)
+            {
+                replay.beginCall();
+                glad_glAlphaFunc(func, ref);
+                replay.endCall(ENTRY_glAlphaFunc);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPixelZoom:
+        {
+            GLfloat xfactor = in.value<GLfloat>();
+            GLfloat yfactor = in.value<GLfloat>();
+            if (glad_glPixelZoom)
+            {
+                replay.beginCall();
+                glad_glPixelZoom(xfactor, yfactor);
+                replay.endCall(ENTRY_glPixelZoom);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPixelTransferf:
+        {
+            GLenum pname = in.value<GLenum>();
+            GLfloat param = in.value<GLfloat>();
+            if (glad_glPixelTransferf)
+            {
+                replay.beginCall();
+                glad_glPixelTransferf(pname, param);
+                replay.endCall(ENTRY_glPixelTransferf);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPixelTransferi:
+        {
+            GLenum pname = in.value<GLenum>();
+            GLint param = in.value<GLint>();
+            if (glad_glPixelTransferi)
+            {
+                replay.beginCall();
+                glad_glPixelTransferi(pname, param);
+                replay.endCall(ENTRY_glPixelTransferi);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glCopyPixels:
+        {
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            GLenum type = in.value<GLenum>();
+            if (glad_glCopyPixels)
+            {
+                replay.beginCall();
+                glad_glCopyPixels(x, y, width, height, type);
+                replay.endCall(ENTRY_glCopyPixels);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glFrustum:
+        {
+            GLdouble left = in.value<GLdouble>();
+            GLdouble right = in.value<GLdouble>();
+            GLdouble bottom = in.value<GLdouble>();
+            GLdouble top = in.value<GLdouble>();
+            GLdouble zNear = in.value<GLdouble>();
+            GLdouble zFar = in.value<GLdouble>();
+            if (glad_glFrustum)
+            {
+                replay.beginCall();
+                glad_glFrustum(left, right, bottom, top, zNear, zFar);
+                replay.endCall(ENTRY_glFrustum);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glLoadIdentity:
+        {
+            if (glad_glLoadIdentity)
+            {
+                replay.beginCall();
+                glad_glLoadIdentity();
+                replay.endCall(ENTRY_glLoadIdentity);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMatrixMode:
+        {
+            GLenum mode = in.value<GLenum>();
+            if (glad_glMatrixMode)
+            {
+                replay.beginCall();
+                glad_glMatrixMode(mode);
+                replay.endCall(ENTRY_glMatrixMode);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glOrtho:
+        {
+            GLdouble left = in.value<GLdouble>();
+            GLdouble right = in.value<GLdouble>();
+            GLdouble bottom = in.value<GLdouble>();
+            GLdouble top = in.value<GLdouble>();
+            GLdouble zNear = in.value<GLdouble>();
+            GLdouble zFar = in.value<GLdouble>();
+            if (glad_glOrtho)
+            {
+                replay.beginCall();
+                glad_glOrtho(left, right, bottom, top, zNear, zFar);
+                replay.endCall(ENTRY_glOrtho);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPopMatrix:
+        {
+            if (glad_glPopMatrix)
+            {
+                replay.beginCall();
+                glad_glPopMatrix();
+                replay.endCall(ENTRY_glPopMatrix);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPushMatrix:
+        {
+            if (glad_glPushMatrix)
+            {
+                replay.beginCall();
+                glad_glPushMatrix();
+                replay.endCall(ENTRY_glPushMatrix);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRotated:
+        {
+            GLdouble angle = in.value<GLdouble>();
+            GLdouble x = in.value<GLdouble>();
+            GLdouble y = in.value<GLdouble>();
+            GLdouble z = in.value<GLdouble>();
+            if (glad_glRotated)
+            {
+                replay.beginCall();
+                glad_glRotated(angle, x, y, z);
+                replay.endCall(ENTRY_glRotated);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRotatef:
+        {
+            GLfloat angle = in.value<GLfloat>();
+            GLfloat x = in.value<GLfloat>();
+            GLfloat y = in.value<GLfloat>();
+            GLfloat z = in.value<GLfloat>();
+            if (glad_glRotatef)
+            {
+                replay.beginCall();
+                glad_glRotatef(angle, x, y, z);
+                replay.endCall(ENTRY_glRotatef);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glScaled:
+        {
+            GLdouble x = in.value<GLdouble>();
+            GLdouble y = in.value<GLdouble>();
+            GLdouble z = in.value<GLdouble>();
+            if (glad_glScaled)
+            {
+                replay.beginCall();
+                glad_glScaled(x, y, z);
+                replay.endCall(ENTRY_glScaled);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glScalef:
+        {
+            GLfloat x = in.value<GLfloat>();
+            GLfloat y = in.value<GLfloat>();
+            GLfloat z = in.value<GLfloat>();
+            if (glad_glScalef)
+            {
+                replay.beginCall();
+                glad_glScalef(x, y, z);
+                replay.endCall(ENTRY_glScalef);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTranslated:
+        {
+            GLdouble x = in.value<GLdouble>();
+            GLdouble y = in.value<GLdouble>();
+            GLdouble z = in.value<GLdouble>();
+            if (glad_glTranslated)
+            {
+                replay.beginCall();
+                glad_glTranslated(x, y, z);
+                replay.endCall(ENTRY_glTranslated);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTranslatef:
+        {
+            GLfloat x = in.value<GLfloat>();
+            GLfloat y = in.value<GLfloat>();
+            GLfloat z = in.value<GLfloat>();
+            if (glad_glTranslatef)
+            {
+                replay.beginCall();
+                glad_glTranslatef(x, y, z);
+                replay.endCall(ENTRY_glTranslatef);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDrawArrays:
+        {
+            GLenum mode = in.value<GLenum>();
+            GLint first = in.value<GLint>();
+            GLsizei count = in.value<GLsizei>();
+            if (glad_glDrawArrays)
+            {
+                replay.beginCall();
+                glad_glDrawArrays(mode, first, count);
+                replay.endCall(ENTRY_glDrawArrays);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDrawElements:
+        {
+            GLenum mode = in.value<GLenum>();
+            GLsizei count = in.value<GLsizei>();
+            GLenum type = in.value<GLenum>();
+            const void * indices = (const void *)in.pointer();
+            if (glad_glDrawElements)
+            {
+                replay.beginCall();
+                glad_glDrawElements(mode, count, type, indices);
+                replay.endCall(ENTRY_glDrawElements);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPolygonOffset:
+        {
+            GLfloat factor = in.value<GLfloat>();
+            GLfloat units = in.value<GLfloat>();
+            if (glad_glPolygonOffset)
+            {
+                replay.beginCall();
+                glad_glPolygonOffset(factor, units);
+                replay.endCall(ENTRY_glPolygonOffset);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glCopyTexImage1D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint level = in.value<GLint>();
+            GLenum internalformat = in.value<GLenum>();
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            GLsizei width = in.value<GLsizei>();
+            GLint border = in.value<GLint>();
+            if (glad_glCopyTexImage1D)
+            {
+                replay.beginCall();
+                glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+                replay.endCall(ENTRY_glCopyTexImage1D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glCopyTexImage2D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint level = in.value<GLint>();
+            GLenum internalformat = in.value<GLenum>();
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            GLint border = in.value<GLint>();
+            if (glad_glCopyTexImage2D)
+            {
+                replay.beginCall();
+                glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+                replay.endCall(ENTRY_glCopyTexImage2D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glCopyTexSubImage1D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint level = in.value<GLint>();
+            GLint xoffset = in.value<GLint>();
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            GLsizei width = in.value<GLsizei>();
+            if (glad_glCopyTexSubImage1D)
+            {
+                replay.beginCall();
+                glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+                replay.endCall(ENTRY_glCopyTexSubImage1D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glCopyTexSubImage2D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint level = in.value<GLint>();
+            GLint xoffset = in.value<GLint>();
+            GLint yoffset = in.value<GLint>();
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            if (glad_glCopyTexSubImage2D)
+            {
+                replay.beginCall();
+                glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+                replay.endCall(ENTRY_glCopyTexSubImage2D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexSubImage1D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint level = in.value<GLint>();
+            GLint xoffset = in.value<GLint>();
+            GLsizei width = in.value<GLsizei>();
+            GLenum format = in.value<GLenum>();
+            GLenum type = in.value<GLenum>();
+            const void * pixels = (const void *)in.pointer();
+            if (glad_glTexSubImage1D)
+            {
+                replay.beginCall();
+                glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+                replay.endCall(ENTRY_glTexSubImage1D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexSubImage2D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint level = in.value<GLint>();
+            GLint xoffset = in.value<GLint>();
+            GLint yoffset = in.value<GLint>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            GLenum format = in.value<GLenum>();
+            GLenum type = in.value<GLenum>();
+            const void * pixels = (const void *)in.pointer();
+            if (glad_glTexSubImage2D)
+            {
+                replay.beginCall();
+                glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+                replay.endCall(ENTRY_glTexSubImage2D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBindTexture:
+        {
+            GLenum target = in.value<GLenum>();
+            GLuint captured_texture = in.value<GLuint>();
+            GLuint texture = replay.object(gltrace::Texture, captured_texture);
+            if (glad_glBindTexture)
+            {
+                replay.beginCall();
+                glad_glBindTexture(target, texture);
+                replay.endCall(ENTRY_glBindTexture);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDeleteTextures:
+        {
+            GLsizei n = in.value<GLsizei>();
+            const GLuint* textures = replay.objects(gltrace::Texture, (const GLuint*)in.pointer(), n);
+            if (glad_glDeleteTextures)
+            {
+                replay.beginCall();
+                glad_glDeleteTextures(n, textures);
+                replay.endCall(ENTRY_glDeleteTextures);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glGenTextures:
+        {
+            GLsizei n = in.value<GLsizei>();
+            GLuint* textures = replay.names(n);
+            if (glad_glGenTextures)
+            {
+                replay.beginCall();
+                glad_glGenTextures(n, textures);
+                replay.endCall(ENTRY_glGenTextures);
+            }
+            else
+                replay.missing();
+            replay.bindObjects(gltrace::Texture, (const GLuint*)in.pointer(), textures, n);
+            return true;
+        }
+        case ENTRY_glArrayElement:
+        {
+            GLint i = in.value<GLint>();
+            if (glad_glArrayElement)
+            {
+                replay.beginCall();
+                glad_glArrayElement(i);
+                replay.endCall(ENTRY_glArrayElement);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDisableClientState:
+        {
+            GLenum array = in.value<GLenum>();
+            if (glad_glDisableClientState)
+            {
+                replay.beginCall();
+                glad_glDisableClientState(array);
+                replay.endCall(ENTRY_glDisableClientState);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glEnableClientState:
+        {
+            GLenum array = in.value<GLenum>();
+            if (glad_glEnableClientState)
+            {
+                replay.beginCall();
+                glad_glEnableClientState(array);
+                replay.endCall(ENTRY_glEnableClientState);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glIndexub:
+        {
+            GLubyte c = in.value<GLubyte>();
+            if (glad_glIndexub)
+            {
+                replay.beginCall();
+                glad_glIndexub(c);
+                replay.endCall(ENTRY_glIndexub);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPopClientAttrib:
+        {
+            if (glad_glPopClientAttrib)
+            {
+                replay.beginCall();
+                glad_glPopClientAttrib();
+                replay.endCall(ENTRY_glPopClientAttrib);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPushClientAttrib:
+        {
+            GLbitfield mask = in.value<GLbitfield>();
+            if (glad_glPushClientAttrib)
+            {
+                replay.beginCall();
+                glad_glPushClientAttrib(mask);
+                replay.endCall(ENTRY_glPushClientAttrib);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDrawRangeElements:
+        {
+            GLenum mode = in.value<GLenum>();
+            GLuint start = in.value<GLuint>();
+            GLuint end = in.value<GLuint>();
+            GLsizei count = in.value<GLsizei>();
+            GLenum type = in.value<GLenum>();
+            const void * indices = (const void *)in.pointer();
+            if (glad_glDrawRangeElements)
+            {
+                replay.beginCall();
+                glad_glDrawRangeElements(mode, start, end, count, type, indices);
+                replay.endCall(ENTRY_glDrawRangeElements);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexImage3D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint level = in.value<GLint>();
+            GLint internalformat = in.value<GLint>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            GLsizei depth = in.value<GLsizei>();
+            GLint border = in.value<GLint>();
+            GLenum format = in.value<GLenum>();
+            GLenum type = in.value<GLenum>();
+            const void * pixels = (const void *)in.pointer();
+            if (glad_glTexImage3D)
+            {
+                replay.beginCall();
+                glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+                replay.endCall(ENTRY_glTexImage3D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexSubImage3D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint level = in.value<GLint>();
+            GLint xoffset = in.value<GLint>();
+            GLint yoffset = in.value<GLint>();
+            GLint zoffset = in.value<GLint>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            GLsizei depth = in.value<GLsizei>();
+            GLenum format = in.value<GLenum>();
+            GLenum type = in.value<GLenum>();
+            const void * pixels = (const void *)in.pointer();
+            if (glad_glTexSubImage3D)
+            {
+                replay.beginCall();
+                glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+                replay.endCall(ENTRY_glTexSubImage3D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glCopyTexSubImage3D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint level = in.value<GLint>();
+            GLint xoffset = in.value<GLint>();
+            GLint yoffset = in.value<GLint>();
+            GLint zoffset = in.value<GLint>();
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            if (glad_glCopyTexSubImage3D)
+            {
+                replay.beginCall();
+                glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+                replay.endCall(ENTRY_glCopyTexSubImage3D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glActiveTexture:
+        {
+            GLenum texture = in.value<GLenum>();
+            if (glad_glActiveTexture)
+            {
+                replay.beginCall();
+                glad_glActiveTexture(texture);
+                replay.endCall(ENTRY_glActiveTexture);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glSampleCoverage:
+        {
+            GLfloat value = in.value<GLfloat>();
+            GLboolean invert = in.value<GLboolean>();
+            if (glad_glSampleCoverage)
+            {
+                replay.beginCall();
+                glad_glSampleCoverage(value, invert);
+                replay.endCall(ENTRY_glSampleCoverage);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glCompressedTexImage3D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint level = in.value<GLint>();
+            GLenum internalformat = in.value<GLenum>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            GLsizei depth = in.value<GLsizei>();
+            GLint border = in.value<GLint>();
+            GLsizei imageSize = in.value<GLsizei>();
+            const void * data = (const void *)in.pointer();
+            if (glad_glCompressedTexImage3D)
+            {
+                replay.beginCall();
+                glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+                replay.endCall(ENTRY_glCompressedTexImage3D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glCompressedTexImage2D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint level = in.value<GLint>();
+            GLenum internalformat = in.value<GLenum>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            GLint border = in.value<GLint>();
+            GLsizei imageSize = in.value<GLsizei>();
+            const void * data = (const void *)in.pointer();
+            if (glad_glCompressedTexImage2D)
+            {
+                replay.beginCall();
+                glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+                replay.endCall(ENTRY_glCompressedTexImage2D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glCompressedTexImage1D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint level = in.value<GLint>();
+            GLenum internalformat = in.value<GLenum>();
+            GLsizei width = in.value<GLsizei>();
+            GLint border = in.value<GLint>();
+            GLsizei imageSize = in.value<GLsizei>();
+            const void * data = (const void *)in.pointer();
+            if (glad_glCompressedTexImage1D)
+            {
+                replay.beginCall();
+                glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+                replay.endCall(ENTRY_glCompressedTexImage1D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glCompressedTexSubImage3D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint level = in.value<GLint>();
+            GLint xoffset = in.value<GLint>();
+            GLint yoffset = in.value<GLint>();
+            GLint zoffset = in.value<GLint>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            GLsizei depth = in.value<GLsizei>();
+            GLenum format = in.value<GLenum>();
+            GLsizei imageSize = in.value<GLsizei>();
+            const void * data = (const void *)in.pointer();
+            if (glad_glCompressedTexSubImage3D)
+            {
+                replay.beginCall();
+                glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+                replay.endCall(ENTRY_glCompressedTexSubImage3D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glCompressedTexSubImage2D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint level = in.value<GLint>();
+            GLint xoffset = in.value<GLint>();
+            GLint yoffset = in.value<GLint>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            GLenum format = in.value<GLenum>();
+            GLsizei imageSize = in.value<GLsizei>();
+            const void * data = (const void *)in.pointer();
+            if (glad_glCompressedTexSubImage2D)
+            {
+                replay.beginCall();
+                glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+                replay.endCall(ENTRY_glCompressedTexSubImage2D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glCompressedTexSubImage1D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint level = in.value<GLint>();
+            GLint xoffset = in.value<GLint>();
+            GLsizei width = in.value<GLsizei>();
+            GLenum format = in.value<GLenum>();
+            GLsizei imageSize = in.value<GLsizei>();
+            const void * data = (const void *)in.pointer();
+            if (glad_glCompressedTexSubImage1D)
+            {
+                replay.beginCall();
+                glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+                replay.endCall(ENTRY_glCompressedTexSubImage1D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glClientActiveTexture:
+        {
+            GLenum texture = in.value<GLenum>();
+            if (glad_glClientActiveTexture)
+            {
+                replay.beginCall();
+                glad_glClientActiveTexture(texture);
+                replay.endCall(ENTRY_glClientActiveTexture);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoord1d:
+        {
+            GLenum target = in.value<GLenum>();
+            GLdouble s = in.value<GLdouble>();
+            if (glad_glMultiTexCoord1d)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoord1d(target, s);
+                replay.endCall(ENTRY_glMultiTexCoord1d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoord1f:
+        {
+            GLenum target = in.value<GLenum>();
+            GLfloat s = in.value<GLfloat>();
+            if (glad_glMultiTexCoord1f)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoord1f(target, s);
+                replay.endCall(ENTRY_glMultiTexCoord1f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoord1i:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint s = in.value<GLint>();
+            if (glad_glMultiTexCoord1i)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoord1i(target, s);
+                replay.endCall(ENTRY_glMultiTexCoord1i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoord1s:
+        {
+            GLenum target = in.value<GLenum>();
+            GLshort s = in.value<GLshort>();
+            if (glad_glMultiTexCoord1s)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoord1s(target, s);
+                replay.endCall(ENTRY_glMultiTexCoord1s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoord2d:
+        {
+            GLenum target = in.value<GLenum>();
+            GLdouble s = in.value<GLdouble>();
+            GLdouble t = in.value<GLdouble>();
+            if (glad_glMultiTexCoord2d)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoord2d(target, s, t);
+                replay.endCall(ENTRY_glMultiTexCoord2d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoord2f:
+        {
+            GLenum target = in.value<GLenum>();
+            GLfloat s = in.value<GLfloat>();
+            GLfloat t = in.value<GLfloat>();
+            if (glad_glMultiTexCoord2f)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoord2f(target, s, t);
+                replay.endCall(ENTRY_glMultiTexCoord2f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoord2i:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint s = in.value<GLint>();
+            GLint t = in.value<GLint>();
+            if (glad_glMultiTexCoord2i)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoord2i(target, s, t);
+                replay.endCall(ENTRY_glMultiTexCoord2i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoord2s:
+        {
+            GLenum target = in.value<GLenum>();
+            GLshort s = in.value<GLshort>();
+            GLshort t = in.value<GLshort>();
+            if (glad_glMultiTexCoord2s)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoord2s(target, s, t);
+                replay.endCall(ENTRY_glMultiTexCoord2s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoord3d:
+        {
+            GLenum target = in.value<GLenum>();
+            GLdouble s = in.value<GLdouble>();
+            GLdouble t = in.value<GLdouble>();
+            GLdouble r = in.value<GLdouble>();
+            if (glad_glMultiTexCoord3d)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoord3d(target, s, t, r);
+                replay.endCall(ENTRY_glMultiTexCoord3d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoord3f:
+        {
+            GLenum target = in.value<GLenum>();
+            GLfloat s = in.value<GLfloat>();
+            GLfloat t = in.value<GLfloat>();
+            GLfloat r = in.value<GLfloat>();
+            if (glad_glMultiTexCoord3f)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoord3f(target, s, t, r);
+                replay.endCall(ENTRY_glMultiTexCoord3f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoord3i:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint s = in.value<GLint>();
+            GLint t = in.value<GLint>();
+            GLint r = in.value<GLint>();
+            if (glad_glMultiTexCoord3i)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoord3i(target, s, t, r);
+                replay.endCall(ENTRY_glMultiTexCoord3i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoord3s:
+        {
+            GLenum target = in.value<GLenum>();
+            GLshort s = in.value<GLshort>();
+            GLshort t = in.value<GLshort>();
+            GLshort r = in.value<GLshort>();
+            if (glad_glMultiTexCoord3s)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoord3s(target, s, t, r);
+                replay.endCall(ENTRY_glMultiTexCoord3s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoord4d:
+        {
+            GLenum target = in.value<GLenum>();
+            GLdouble s = in.value<GLdouble>();
+            GLdouble t = in.value<GLdouble>();
+            GLdouble r = in.value<GLdouble>();
+            GLdouble q = in.value<GLdouble>();
+            if (glad_glMultiTexCoord4d)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoord4d(target, s, t, r, q);
+                replay.endCall(ENTRY_glMultiTexCoord4d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoord4f:
+        {
+            GLenum target = in.value<GLenum>();
+            GLfloat s = in.value<GLfloat>();
+            GLfloat t = in.value<GLfloat>();
+            GLfloat r = in.value<GLfloat>();
+            GLfloat q = in.value<GLfloat>();
+            if (glad_glMultiTexCoord4f)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoord4f(target, s, t, r, q);
+                replay.endCall(ENTRY_glMultiTexCoord4f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoord4i:
+        {
+            GLenum target = in.value<GLenum>();
+            GLint s = in.value<GLint>();
+            GLint t = in.value<GLint>();
+            GLint r = in.value<GLint>();
+            GLint q = in.value<GLint>();
+            if (glad_glMultiTexCoord4i)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoord4i(target, s, t, r, q);
+                replay.endCall(ENTRY_glMultiTexCoord4i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoord4s:
+        {
+            GLenum target = in.value<GLenum>();
+            GLshort s = in.value<GLshort>();
+            GLshort t = in.value<GLshort>();
+            GLshort r = in.value<GLshort>();
+            GLshort q = in.value<GLshort>();
+            if (glad_glMultiTexCoord4s)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoord4s(target, s, t, r, q);
+                replay.endCall(ENTRY_glMultiTexCoord4s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBlendFuncSeparate:
+        {
+            GLenum sfactorRGB = in.value<GLenum>();
+            GLenum dfactorRGB = in.value<GLenum>();
+            GLenum sfactorAlpha = in.value<GLenum>();
+            GLenum dfactorAlpha = in.value<GLenum>();
+            if (glad_glBlendFuncSeparate)
+            {
+                replay.beginCall();
+                glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+                replay.endCall(ENTRY_glBlendFuncSeparate);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPointParameterf:
+        {
+            GLenum pname = in.value<GLenum>();
+            GLfloat param = in.value<GLfloat>();
+            if (glad_glPointParameterf)
+            {
+                replay.beginCall();
+                glad_glPointParameterf(pname, param);
+                replay.endCall(ENTRY_glPointParameterf);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPointParameteri:
+        {
+            GLenum pname = in.value<GLenum>();
+            GLint param = in.value<GLint>();
+            if (glad_glPointParameteri)
+            {
+                replay.beginCall();
+                glad_glPointParameteri(pname, param);
+                replay.endCall(ENTRY_glPointParameteri);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glFogCoordf:
+        {
+            GLfloat coord = in.value<GLfloat>();
+            if (glad_glFogCoordf)
+            {
+                replay.beginCall();
+                glad_glFogCoordf(coord);
+                replay.endCall(ENTRY_glFogCoordf);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glFogCoordd:
+        {
+            GLdouble coord = in.value<GLdouble>();
+            if (glad_glFogCoordd)
+            {
+                replay.beginCall();
+                glad_glFogCoordd(coord);
+                replay.endCall(ENTRY_glFogCoordd);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glSecondaryColor3b:
+        {
+            GLbyte red = in.value<GLbyte>();
+            GLbyte green = in.value<GLbyte>();
+            GLbyte blue = in.value<GLbyte>();
+            if (glad_glSecondaryColor3b)
+            {
+                replay.beginCall();
+                glad_glSecondaryColor3b(red, green, blue);
+                replay.endCall(ENTRY_glSecondaryColor3b);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glSecondaryColor3d:
+        {
+            GLdouble red = in.value<GLdouble>();
+            GLdouble green = in.value<GLdouble>();
+            GLdouble blue = in.value<GLdouble>();
+            if (glad_glSecondaryColor3d)
+            {
+                replay.beginCall();
+                glad_glSecondaryColor3d(red, green, blue);
+                replay.endCall(ENTRY_glSecondaryColor3d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glSecondaryColor3f:
+        {
+            GLfloat red = in.value<GLfloat>();
+            GLfloat green = in.value<GLfloat>();
+            GLfloat blue = in.value<GLfloat>();
+            if (glad_glSecondaryColor3f)
+            {
+                replay.beginCall();
+                glad_glSecondaryColor3f(red, green, blue);
+                replay.endCall(ENTRY_glSecondaryColor3f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glSecondaryColor3i:
+        {
+            GLint red = in.value<GLint>();
+            GLint green = in.value<GLint>();
+            GLint blue = in.value<GLint>();
+            if (glad_glSecondaryColor3i)
+            {
+                replay.beginCall();
+                glad_glSecondaryColor3i(red, green, blue);
+                replay.endCall(ENTRY_glSecondaryColor3i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glSecondaryColor3s:
+        {
+            GLshort red = in.value<GLshort>();
+            GLshort green = in.value<GLshort>();
+            GLshort blue = in.value<GLshort>();
+            if (glad_glSecondaryColor3s)
+            {
+                replay.beginCall();
+                glad_glSecondaryColor3s(red, green, blue);
+                replay.endCall(ENTRY_glSecondaryColor3s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glSecondaryColor3ub:
+        {
+            GLubyte red = in.value<GLubyte>();
+            GLubyte green = in.value<GLubyte>();
+            GLubyte blue = in.value<GLubyte>();
+            if (glad_glSecondaryColor3ub)
+            {
+                replay.beginCall();
+                glad_glSecondaryColor3ub(red, green, blue);
+                replay.endCall(ENTRY_glSecondaryColor3ub);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glSecondaryColor3ui:
+        {
+            GLuint red = in.value<GLuint>();
+            GLuint green = in.value<GLuint>();
+            GLuint blue = in.value<GLuint>();
+            if (glad_glSecondaryColor3ui)
+            {
+                replay.beginCall();
+                glad_glSecondaryColor3ui(red, green, blue);
+                replay.endCall(ENTRY_glSecondaryColor3ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glSecondaryColor3us:
+        {
+            GLushort red = in.value<GLushort>();
+            GLushort green = in.value<GLushort>();
+            GLushort blue = in.value<GLushort>();
+            if (glad_glSecondaryColor3us)
+            {
+                replay.beginCall();
+                glad_glSecondaryColor3us(red, green, blue);
+                replay.endCall(ENTRY_glSecondaryColor3us);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glWindowPos2d:
+        {
+            GLdouble x = in.value<GLdouble>();
+            GLdouble y = in.value<GLdouble>();
+            if (glad_glWindowPos2d)
+            {
+                replay.beginCall();
+                glad_glWindowPos2d(x, y);
+                replay.endCall(ENTRY_glWindowPos2d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glWindowPos2f:
+        {
+            GLfloat x = in.value<GLfloat>();
+            GLfloat y = in.value<GLfloat>();
+            if (glad_glWindowPos2f)
+            {
+                replay.beginCall();
+                glad_glWindowPos2f(x, y);
+                replay.endCall(ENTRY_glWindowPos2f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glWindowPos2i:
+        {
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            if (glad_glWindowPos2i)
+            {
+                replay.beginCall();
+                glad_glWindowPos2i(x, y);
+                replay.endCall(ENTRY_glWindowPos2i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glWindowPos2s:
+        {
+            GLshort x = in.value<GLshort>();
+            GLshort y = in.value<GLshort>();
+            if (glad_glWindowPos2s)
+            {
+                replay.beginCall();
+                glad_glWindowPos2s(x, y);
+                replay.endCall(ENTRY_glWindowPos2s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glWindowPos3d:
+        {
+            GLdouble x = in.value<GLdouble>();
+            GLdouble y = in.value<GLdouble>();
+            GLdouble z = in.value<GLdouble>();
+            if (glad_glWindowPos3d)
+            {
+                replay.beginCall();
+                glad_glWindowPos3d(x, y, z);
+                replay.endCall(ENTRY_glWindowPos3d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glWindowPos3f:
+        {
+            GLfloat x = in.value<GLfloat>();
+            GLfloat y = in.value<GLfloat>();
+            GLfloat z = in.value<GLfloat>();
+            if (glad_glWindowPos3f)
+            {
+                replay.beginCall();
+                glad_glWindowPos3f(x, y, z);
+                replay.endCall(ENTRY_glWindowPos3f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glWindowPos3i:
+        {
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            GLint z = in.value<GLint>();
+            if (glad_glWindowPos3i)
+            {
+                replay.beginCall();
+                glad_glWindowPos3i(x, y, z);
+                replay.endCall(ENTRY_glWindowPos3i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glWindowPos3s:
+        {
+            GLshort x = in.value<GLshort>();
+            GLshort y = in.value<GLshort>();
+            GLshort z = in.value<GLshort>();
+            if (glad_glWindowPos3s)
+            {
+                replay.beginCall();
+                glad_glWindowPos3s(x, y, z);
+                replay.endCall(ENTRY_glWindowPos3s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBlendColor:
+        {
+            GLfloat red = in.value<GLfloat>();
+            GLfloat green = in.value<GLfloat>();
+            GLfloat blue = in.value<GLfloat>();
+            GLfloat alpha = in.value<GLfloat>();
+            if (glad_glBlendColor)
+            {
+                replay.beginCall();
+                glad_glBlendColor(red, green, blue, alpha);
+                replay.endCall(ENTRY_glBlendColor);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBlendEquation:
+        {
+            GLenum mode = in.value<GLenum>();
+            if (glad_glBlendEquation)
+            {
+                replay.beginCall();
+                glad_glBlendEquation(mode);
+                replay.endCall(ENTRY_glBlendEquation);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glGenQueries:
+        {
+            GLsizei n = in.value<GLsizei>();
+            GLuint* ids = replay.names(n);
+            if (glad_glGenQueries)
+            {
+                replay.beginCall();
+                glad_glGenQueries(n, ids);
+                replay.endCall(ENTRY_glGenQueries);
+            }
+            else
+                replay.missing();
+            replay.bindObjects(gltrace::Query, (const GLuint*)in.pointer(), ids, n);
+            return true;
+        }
+        case ENTRY_glDeleteQueries:
+        {
+            GLsizei n = in.value<GLsizei>();
+            const GLuint* ids = replay.objects(gltrace::Query, (const GLuint*)in.pointer(), n);
+            if (glad_glDeleteQueries)
+            {
+                replay.beginCall();
+                glad_glDeleteQueries(n, ids);
+                replay.endCall(ENTRY_glDeleteQueries);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBeginQuery:
+        {
+            GLenum target = in.value<GLenum>();
+            GLuint captured_id = in.value<GLuint>();
+            GLuint id = replay.object(gltrace::Query, captured_id);
+            if (glad_glBeginQuery)
+            {
+                replay.beginCall();
+                glad_glBeginQuery(target, id);
+                replay.endCall(ENTRY_glBeginQuery);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glEndQuery:
+        {
+            GLenum target = in.value<GLenum>();
+            if (glad_glEndQuery)
+            {
+                replay.beginCall();
+                glad_glEndQuery(target);
+                replay.endCall(ENTRY_glEndQuery);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBindBuffer:
+        {
+            GLenum target = in.value<GLenum>();
+            GLuint captured_buffer = in.value<GLuint>();
+            GLuint buffer = replay.object(gltrace::Buffer, captured_buffer);
+            if (glad_glBindBuffer)
+            {
+                replay.beginCall();
+                glad_glBindBuffer(target, buffer);
+                replay.endCall(ENTRY_glBindBuffer);
+            }
+            else
+                replay.missing();
+            replay.bindBuffer(target, buffer);
+            return true;
+        }
+        case ENTRY_glDeleteBuffers:
+        {
+            GLsizei n = in.value<GLsizei>();
+            const GLuint* buffers = replay.objects(gltrace::Buffer, (const GLuint*)in.pointer(), n);
+            if (glad_glDeleteBuffers)
+            {
+                replay.beginCall();
+                glad_glDeleteBuffers(n, buffers);
+                replay.endCall(ENTRY_glDeleteBuffers);
+            }
+            else
+                replay.missing();
+            replay.deleteBuffers(n, buffers);
+            return true;
+        }
+        case ENTRY_glGenBuffers:
+        {
+            GLsizei n = in.value<GLsizei>();
+            GLuint* buffers = replay.names(n);
+            if (glad_glGenBuffers)
+            {
+                replay.beginCall();
+                glad_glGenBuffers(n, buffers);
+                replay.endCall(ENTRY_glGenBuffers);
+            }
+            else
+                replay.missing();
+            replay.bindObjects(gltrace::Buffer, (const GLuint*)in.pointer(), buffers, n);
+            return true;
+        }
+        case ENTRY_glBufferData:
+        {
+            GLenum target = in.value<GLenum>();
+            GLsizeiptr size = in.value<GLsizeiptr>();
+            const void * data = (const void *)in.pointer();
+            GLenum usage = in.value<GLenum>();
+            if (glad_glBufferData)
+            {
+                replay.beginCall();
+                glad_glBufferData(target, size, data, usage);
+                replay.endCall(ENTRY_glBufferData);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBufferSubData:
+        {
+            GLenum target = in.value<GLenum>();
+            GLintptr offset = in.value<GLintptr>();
+            GLsizeiptr size = in.value<GLsizeiptr>();
+            const void * data = (const void *)in.pointer();
+            if (glad_glBufferSubData)
+            {
+                replay.beginCall();
+                glad_glBufferSubData(target, offset, size, data);
+                replay.endCall(ENTRY_glBufferSubData);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMapBuffer:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum access = in.value<GLenum>();
+            void * result = nullptr;
+            if (glad_glMapBuffer)
+            {
+                replay.beginCall();
+                result = glad_glMapBuffer(target, access);
+                replay.endCall(ENTRY_glMapBuffer);
+            }
+            else
+                replay.missing();
+            replay.mapped(target, result);
+            return true;
+        }
+        case ENTRY_glUnmapBuffer:
+        {
+            GLenum target = in.value<GLenum>();
+            const void* written = in.pointer();
+            replay.unmapped(target, written, in.lastSize());
+            GLboolean result = GLboolean();
+            if (glad_glUnmapBuffer)
+            {
+                replay.beginCall();
+                result = glad_glUnmapBuffer(target);
+                replay.endCall(ENTRY_glUnmapBuffer);
+            }
+            else
+                replay.missing();
+            (void)result;
+            return true;
+        }
+        case ENTRY_glBlendEquationSeparate:
+        {
+            GLenum modeRGB = in.value<GLenum>();
+            GLenum modeAlpha = in.value<GLenum>();
+            if (glad_glBlendEquationSeparate)
+            {
+                replay.beginCall();
+                glad_glBlendEquationSeparate(modeRGB, modeAlpha);
+                replay.endCall(ENTRY_glBlendEquationSeparate);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDrawBuffers:
+        {
+            GLsizei n = in.value<GLsizei>();
+            const GLenum * bufs = (const GLenum *)in.pointer();
+            if (glad_glDrawBuffers)
+            {
+                replay.beginCall();
+                glad_glDrawBuffers(n, bufs);
+                replay.endCall(ENTRY_glDrawBuffers);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glStencilOpSeparate:
+        {
+            GLenum face = in.value<GLenum>();
+            GLenum sfail = in.value<GLenum>();
+            GLenum dpfail = in.value<GLenum>();
+            GLenum dppass = in.value<GLenum>();
+            if (glad_glStencilOpSeparate)
+            {
+                replay.beginCall();
+                glad_glStencilOpSeparate(face, sfail, dpfail, dppass);
+                replay.endCall(ENTRY_glStencilOpSeparate);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glStencilFuncSeparate:
+        {
+            GLenum face = in.value<GLenum>();
+            GLenum func = in.value<GLenum>();
+            GLint ref = in.value<GLint>();
+            GLuint mask = in.value<GLuint>();
+            if (glad_glStencilFuncSeparate)
+            {
+                replay.beginCall();
+                glad_glStencilFuncSeparate(face, func, ref, mask);
+                replay.endCall(ENTRY_glStencilFuncSeparate);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glStencilMaskSeparate:
+        {
+            GLenum face = in.value<GLenum>();
+            GLuint mask = in.value<GLuint>();
+            if (glad_glStencilMaskSeparate)
+            {
+                replay.beginCall();
+                glad_glStencilMaskSeparate(face, mask);
+                replay.endCall(ENTRY_glStencilMaskSeparate);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glAttachShader:
+        {
+            GLuint captured_program = in.value<GLuint>();
+            GLuint program = replay.object(gltrace::Program, captured_program);
+            GLuint captured_shader = in.value<GLuint>();
+            GLuint shader = replay.object(gltrace::Shader, captured_shader);
+            if (glad_glAttachShader)
+            {
+                replay.beginCall();
+                glad_glAttachShader(program, shader);
+                replay.endCall(ENTRY_glAttachShader);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBindAttribLocation:
+        {
+            GLuint captured_program = in.value<GLuint>();
+            GLuint program = replay.object(gltrace::Program, captured_program);
+            GLuint index = in.value<GLuint>();
+            const GLchar * name = (const GLchar *)in.pointer();
+            if (glad_glBindAttribLocation)
+            {
+                replay.beginCall();
+                glad_glBindAttribLocation(program, index, name);
+                replay.endCall(ENTRY_glBindAttribLocation);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glCompileShader:
+        {
+            GLuint captured_shader = in.value<GLuint>();
+            GLuint shader = replay.object(gltrace::Shader, captured_shader);
+            if (glad_glCompileShader)
+            {
+                replay.beginCall();
+                glad_glCompileShader(shader);
+                replay.endCall(ENTRY_glCompileShader);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glCreateProgram:
+        {
+            GLuint result = GLuint();
+            if (glad_glCreateProgram)
+            {
+                replay.beginCall();
+                result = glad_glCreateProgram();
+                replay.endCall(ENTRY_glCreateProgram);
+            }
+            else
+                replay.missing();
+            replay.bindObject(gltrace::Program, in.value<GLuint>(), result);
+            return true;
+        }
+        case ENTRY_glCreateShader:
+        {
+            GLenum type = in.value<GLenum>();
+            GLuint result = GLuint();
+            if (glad_glCreateShader)
+            {
+                replay.beginCall();
+                result = glad_glCreateShader(type);
+                replay.endCall(ENTRY_glCreateShader);
+            }
+            else
+                replay.missing();
+            replay.bindObject(gltrace::Shader, in.value<GLuint>(), result);
+            return true;
+        }
+        case ENTRY_glDeleteProgram:
+        {
+            GLuint captured_program = in.value<GLuint>();
+            GLuint program = replay.object(gltrace::Program, captured_program);
+            if (glad_glDeleteProgram)
+            {
+                replay.beginCall();
+                glad_glDeleteProgram(program);
+                replay.endCall(ENTRY_glDeleteProgram);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDeleteShader:
+        {
+            GLuint captured_shader = in.value<GLuint>();
+            GLuint shader = replay.object(gltrace::Shader, captured_shader);
+            if (glad_glDeleteShader)
+            {
+                replay.beginCall();
+                glad_glDeleteShader(shader);
+                replay.endCall(ENTRY_glDeleteShader);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDetachShader:
+        {
+            GLuint captured_program = in.value<GLuint>();
+            GLuint program = replay.object(gltrace::Program, captured_program);
+            GLuint captured_shader = in.value<GLuint>();
+            GLuint shader = replay.object(gltrace::Shader, captured_shader);
+            if (glad_glDetachShader)
+            {
+                replay.beginCall();
+                glad_glDetachShader(program, shader);
+                replay.endCall(ENTRY_glDetachShader);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDisableVertexAttribArray:
+        {
+            GLuint index = in.value<GLuint>();
+            if (glad_glDisableVertexAttribArray)
+            {
+                replay.beginCall();
+                glad_glDisableVertexAttribArray(index);
+                replay.endCall(ENTRY_glDisableVertexAttribArray);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glEnableVertexAttribArray:
+        {
+            GLuint index = in.value<GLuint>();
+            if (glad_glEnableVertexAttribArray)
+            {
+                replay.beginCall();
+                glad_glEnableVertexAttribArray(index);
+                replay.endCall(ENTRY_glEnableVertexAttribArray);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glGetUniformLocation:
+        {
+            GLuint captured_program = in.value<GLuint>();
+            GLuint program = replay.object(gltrace::Program, captured_program);
+            const GLchar * name = (const GLchar *)in.pointer();
+            GLint result = GLint();
+            if (glad_glGetUniformLocation)
+            {
+                replay.beginCall();
+                result = glad_glGetUniformLocation(program, name);
+                replay.endCall(ENTRY_glGetUniformLocation);
+            }
+            else
+                replay.missing();
+            replay.bindLocation(captured_program, in.value<GLint>(), result);
+            return true;
+        }
+        case ENTRY_glLinkProgram:
+        {
+            GLuint captured_program = in.value<GLuint>();
+            GLuint program = replay.object(gltrace::Program, captured_program);
+            if (glad_glLinkProgram)
+            {
+                replay.beginCall();
+                glad_glLinkProgram(program);
+                replay.endCall(ENTRY_glLinkProgram);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glShaderSource:
+        {
+            GLuint captured_shader = in.value<GLuint>();
+            GLuint shader = replay.object(gltrace::Shader, captured_shader);
+            GLsizei count = in.value<GLsizei>();
+            const GLchar* source = (const GLchar*)in.pointer();
+            const GLchar* const* string = &source;
+            count = 1;
+            const GLint* length = nullptr;
+            if (glad_glShaderSource)
+            {
+                replay.beginCall();
+                glad_glShaderSource(shader, count, string, length);
+                replay.endCall(ENTRY_glShaderSource);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUseProgram:
+        {
+            GLuint captured_program = in.value<GLuint>();
+            GLuint program = replay.object(gltrace::Program, captured_program);
+            if (glad_glUseProgram)
+            {
+                replay.beginCall();
+                glad_glUseProgram(program);
+                replay.endCall(ENTRY_glUseProgram);
+            }
+            else
+                replay.missing();
+            replay.useProgram(captured_program);
+            return true;
+        }
+        case ENTRY_glUniform1f:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLfloat v0 = in.value<GLfloat>();
+            if (glad_glUniform1f)
+            {
+                replay.beginCall();
+                glad_glUniform1f(location, v0);
+                replay.endCall(ENTRY_glUniform1f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform2f:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLfloat v0 = in.value<GLfloat>();
+            GLfloat v1 = in.value<GLfloat>();
+            if (glad_glUniform2f)
+            {
+                replay.beginCall();
+                glad_glUniform2f(location, v0, v1);
+                replay.endCall(ENTRY_glUniform2f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform3f:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLfloat v0 = in.value<GLfloat>();
+            GLfloat v1 = in.value<GLfloat>();
+            GLfloat v2 = in.value<GLfloat>();
+            if (glad_glUniform3f)
+            {
+                replay.beginCall();
+                glad_glUniform3f(location, v0, v1, v2);
+                replay.endCall(ENTRY_glUniform3f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform4f:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLfloat v0 = in.value<GLfloat>();
+            GLfloat v1 = in.value<GLfloat>();
+            GLfloat v2 = in.value<GLfloat>();
+            GLfloat v3 = in.value<GLfloat>();
+            if (glad_glUniform4f)
+            {
+                replay.beginCall();
+                glad_glUniform4f(location, v0, v1, v2, v3);
+                replay.endCall(ENTRY_glUniform4f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform1i:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLint v0 = in.value<GLint>();
+            if (glad_glUniform1i)
+            {
+                replay.beginCall();
+                glad_glUniform1i(location, v0);
+                replay.endCall(ENTRY_glUniform1i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform2i:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLint v0 = in.value<GLint>();
+            GLint v1 = in.value<GLint>();
+            if (glad_glUniform2i)
+            {
+                replay.beginCall();
+                glad_glUniform2i(location, v0, v1);
+                replay.endCall(ENTRY_glUniform2i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform3i:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLint v0 = in.value<GLint>();
+            GLint v1 = in.value<GLint>();
+            GLint v2 = in.value<GLint>();
+            if (glad_glUniform3i)
+            {
+                replay.beginCall();
+                glad_glUniform3i(location, v0, v1, v2);
+                replay.endCall(ENTRY_glUniform3i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform4i:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLint v0 = in.value<GLint>();
+            GLint v1 = in.value<GLint>();
+            GLint v2 = in.value<GLint>();
+            GLint v3 = in.value<GLint>();
+            if (glad_glUniform4i)
+            {
+                replay.beginCall();
+                glad_glUniform4i(location, v0, v1, v2, v3);
+                replay.endCall(ENTRY_glUniform4i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform1fv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            const GLfloat * value = (const GLfloat *)in.pointer();
+            if (glad_glUniform1fv)
+            {
+                replay.beginCall();
+                glad_glUniform1fv(location, count, value);
+                replay.endCall(ENTRY_glUniform1fv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform2fv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            const GLfloat * value = (const GLfloat *)in.pointer();
+            if (glad_glUniform2fv)
+            {
+                replay.beginCall();
+                glad_glUniform2fv(location, count, value);
+                replay.endCall(ENTRY_glUniform2fv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform3fv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            const GLfloat * value = (const GLfloat *)in.pointer();
+            if (glad_glUniform3fv)
+            {
+                replay.beginCall();
+                glad_glUniform3fv(location, count, value);
+                replay.endCall(ENTRY_glUniform3fv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform4fv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            const GLfloat * value = (const GLfloat *)in.pointer();
+            if (glad_glUniform4fv)
+            {
+                replay.beginCall();
+                glad_glUniform4fv(location, count, value);
+                replay.endCall(ENTRY_glUniform4fv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform1iv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            const GLint * value = (const GLint *)in.pointer();
+            if (glad_glUniform1iv)
+            {
+                replay.beginCall();
+                glad_glUniform1iv(location, count, value);
+                replay.endCall(ENTRY_glUniform1iv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform2iv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            const GLint * value = (const GLint *)in.pointer();
+            if (glad_glUniform2iv)
+            {
+                replay.beginCall();
+                glad_glUniform2iv(location, count, value);
+                replay.endCall(ENTRY_glUniform2iv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform3iv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            const GLint * value = (const GLint *)in.pointer();
+            if (glad_glUniform3iv)
+            {
+                replay.beginCall();
+                glad_glUniform3iv(location, count, value);
+                replay.endCall(ENTRY_glUniform3iv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform4iv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            const GLint * value = (const GLint *)in.pointer();
+            if (glad_glUniform4iv)
+            {
+                replay.beginCall();
+                glad_glUniform4iv(location, count, value);
+                replay.endCall(ENTRY_glUniform4iv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniformMatrix2fv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            GLboolean transpose = in.value<GLboolean>();
+            const GLfloat * value = (const GLfloat *)in.pointer();
+            if (glad_glUniformMatrix2fv)
+            {
+                replay.beginCall();
+                glad_glUniformMatrix2fv(location, count, transpose, value);
+                replay.endCall(ENTRY_glUniformMatrix2fv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniformMatrix3fv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            GLboolean transpose = in.value<GLboolean>();
+            const GLfloat * value = (const GLfloat *)in.pointer();
+            if (glad_glUniformMatrix3fv)
+            {
+                replay.beginCall();
+                glad_glUniformMatrix3fv(location, count, transpose, value);
+                replay.endCall(ENTRY_glUniformMatrix3fv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniformMatrix4fv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            GLboolean transpose = in.value<GLboolean>();
+            const GLfloat * value = (const GLfloat *)in.pointer();
+            if (glad_glUniformMatrix4fv)
+            {
+                replay.beginCall();
+                glad_glUniformMatrix4fv(location, count, transpose, value);
+                replay.endCall(ENTRY_glUniformMatrix4fv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glValidateProgram:
+        {
+            GLuint captured_program = in.value<GLuint>();
+            GLuint program = replay.object(gltrace::Program, captured_program);
+            if (glad_glValidateProgram)
+            {
+                replay.beginCall();
+                glad_glValidateProgram(program);
+                replay.endCall(ENTRY_glValidateProgram);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib1d:
+        {
+            GLuint index = in.value<GLuint>();
+            GLdouble x = in.value<GLdouble>();
+            if (glad_glVertexAttrib1d)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib1d(index, x);
+                replay.endCall(ENTRY_glVertexAttrib1d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib1dv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLdouble * v = (const GLdouble *)in.pointer();
+            if (glad_glVertexAttrib1dv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib1dv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib1dv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib1f:
+        {
+            GLuint index = in.value<GLuint>();
+            GLfloat x = in.value<GLfloat>();
+            if (glad_glVertexAttrib1f)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib1f(index, x);
+                replay.endCall(ENTRY_glVertexAttrib1f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib1fv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLfloat * v = (const GLfloat *)in.pointer();
+            if (glad_glVertexAttrib1fv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib1fv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib1fv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib1s:
+        {
+            GLuint index = in.value<GLuint>();
+            GLshort x = in.value<GLshort>();
+            if (glad_glVertexAttrib1s)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib1s(index, x);
+                replay.endCall(ENTRY_glVertexAttrib1s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib1sv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLshort * v = (const GLshort *)in.pointer();
+            if (glad_glVertexAttrib1sv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib1sv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib1sv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib2d:
+        {
+            GLuint index = in.value<GLuint>();
+            GLdouble x = in.value<GLdouble>();
+            GLdouble y = in.value<GLdouble>();
+            if (glad_glVertexAttrib2d)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib2d(index, x, y);
+                replay.endCall(ENTRY_glVertexAttrib2d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib2dv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLdouble * v = (const GLdouble *)in.pointer();
+            if (glad_glVertexAttrib2dv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib2dv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib2dv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib2f:
+        {
+            GLuint index = in.value<GLuint>();
+            GLfloat x = in.value<GLfloat>();
+            GLfloat y = in.value<GLfloat>();
+            if (glad_glVertexAttrib2f)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib2f(index, x, y);
+                replay.endCall(ENTRY_glVertexAttrib2f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib2fv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLfloat * v = (const GLfloat *)in.pointer();
+            if (glad_glVertexAttrib2fv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib2fv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib2fv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib2s:
+        {
+            GLuint index = in.value<GLuint>();
+            GLshort x = in.value<GLshort>();
+            GLshort y = in.value<GLshort>();
+            if (glad_glVertexAttrib2s)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib2s(index, x, y);
+                replay.endCall(ENTRY_glVertexAttrib2s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib2sv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLshort * v = (const GLshort *)in.pointer();
+            if (glad_glVertexAttrib2sv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib2sv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib2sv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib3d:
+        {
+            GLuint index = in.value<GLuint>();
+            GLdouble x = in.value<GLdouble>();
+            GLdouble y = in.value<GLdouble>();
+            GLdouble z = in.value<GLdouble>();
+            if (glad_glVertexAttrib3d)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib3d(index, x, y, z);
+                replay.endCall(ENTRY_glVertexAttrib3d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib3dv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLdouble * v = (const GLdouble *)in.pointer();
+            if (glad_glVertexAttrib3dv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib3dv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib3dv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib3f:
+        {
+            GLuint index = in.value<GLuint>();
+            GLfloat x = in.value<GLfloat>();
+            GLfloat y = in.value<GLfloat>();
+            GLfloat z = in.value<GLfloat>();
+            if (glad_glVertexAttrib3f)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib3f(index, x, y, z);
+                replay.endCall(ENTRY_glVertexAttrib3f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib3fv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLfloat * v = (const GLfloat *)in.pointer();
+            if (glad_glVertexAttrib3fv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib3fv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib3fv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib3s:
+        {
+            GLuint index = in.value<GLuint>();
+            GLshort x = in.value<GLshort>();
+            GLshort y = in.value<GLshort>();
+            GLshort z = in.value<GLshort>();
+            if (glad_glVertexAttrib3s)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib3s(index, x, y, z);
+                replay.endCall(ENTRY_glVertexAttrib3s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib3sv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLshort * v = (const GLshort *)in.pointer();
+            if (glad_glVertexAttrib3sv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib3sv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib3sv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib4Nbv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLbyte * v = (const GLbyte *)in.pointer();
+            if (glad_glVertexAttrib4Nbv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib4Nbv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib4Nbv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib4Niv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLint * v = (const GLint *)in.pointer();
+            if (glad_glVertexAttrib4Niv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib4Niv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib4Niv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib4Nsv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLshort * v = (const GLshort *)in.pointer();
+            if (glad_glVertexAttrib4Nsv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib4Nsv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib4Nsv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib4Nub:
+        {
+            GLuint index = in.value<GLuint>();
+            GLubyte x = in.value<GLubyte>();
+            GLubyte y = in.value<GLubyte>();
+            GLubyte z = in.value<GLubyte>();
+            GLubyte w = in.value<GLubyte>();
+            if (glad_glVertexAttrib4Nub)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib4Nub(index, x, y, z, w);
+                replay.endCall(ENTRY_glVertexAttrib4Nub);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib4Nubv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLubyte * v = (const GLubyte *)in.pointer();
+            if (glad_glVertexAttrib4Nubv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib4Nubv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib4Nubv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib4Nuiv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLuint * v = (const GLuint *)in.pointer();
+            if (glad_glVertexAttrib4Nuiv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib4Nuiv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib4Nuiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib4Nusv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLushort * v = (const GLushort *)in.pointer();
+            if (glad_glVertexAttrib4Nusv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib4Nusv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib4Nusv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib4bv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLbyte * v = (const GLbyte *)in.pointer();
+            if (glad_glVertexAttrib4bv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib4bv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib4bv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib4d:
+        {
+            GLuint index = in.value<GLuint>();
+            GLdouble x = in.value<GLdouble>();
+            GLdouble y = in.value<GLdouble>();
+            GLdouble z = in.value<GLdouble>();
+            GLdouble w = in.value<GLdouble>();
+            if (glad_glVertexAttrib4d)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib4d(index, x, y, z, w);
+                replay.endCall(ENTRY_glVertexAttrib4d);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib4dv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLdouble * v = (const GLdouble *)in.pointer();
+            if (glad_glVertexAttrib4dv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib4dv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib4dv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib4f:
+        {
+            GLuint index = in.value<GLuint>();
+            GLfloat x = in.value<GLfloat>();
+            GLfloat y = in.value<GLfloat>();
+            GLfloat z = in.value<GLfloat>();
+            GLfloat w = in.value<GLfloat>();
+            if (glad_glVertexAttrib4f)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib4f(index, x, y, z, w);
+                replay.endCall(ENTRY_glVertexAttrib4f);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib4fv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLfloat * v = (const GLfloat *)in.pointer();
+            if (glad_glVertexAttrib4fv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib4fv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib4fv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib4iv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLint * v = (const GLint *)in.pointer();
+            if (glad_glVertexAttrib4iv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib4iv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib4iv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib4s:
+        {
+            GLuint index = in.value<GLuint>();
+            GLshort x = in.value<GLshort>();
+            GLshort y = in.value<GLshort>();
+            GLshort z = in.value<GLshort>();
+            GLshort w = in.value<GLshort>();
+            if (glad_glVertexAttrib4s)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib4s(index, x, y, z, w);
+                replay.endCall(ENTRY_glVertexAttrib4s);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib4sv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLshort * v = (const GLshort *)in.pointer();
+            if (glad_glVertexAttrib4sv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib4sv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib4sv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib4ubv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLubyte * v = (const GLubyte *)in.pointer();
+            if (glad_glVertexAttrib4ubv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib4ubv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib4ubv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib4uiv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLuint * v = (const GLuint *)in.pointer();
+            if (glad_glVertexAttrib4uiv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib4uiv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib4uiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttrib4usv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLushort * v = (const GLushort *)in.pointer();
+            if (glad_glVertexAttrib4usv)
+            {
+                replay.beginCall();
+                glad_glVertexAttrib4usv(index, v);
+                replay.endCall(ENTRY_glVertexAttrib4usv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribPointer:
+        {
+            GLuint index = in.value<GLuint>();
+            GLint size = in.value<GLint>();
+            GLenum type = in.value<GLenum>();
+            GLboolean normalized = in.value<GLboolean>();
+            GLsizei stride = in.value<GLsizei>();
+            const void * pointer = (const void *)in.pointer();
+            if (glad_glVertexAttribPointer)
+            {
+                replay.beginCall();
+                glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+                replay.endCall(ENTRY_glVertexAttribPointer);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniformMatrix2x3fv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            GLboolean transpose = in.value<GLboolean>();
+            const GLfloat * value = (const GLfloat *)in.pointer();
+            if (glad_glUniformMatrix2x3fv)
+            {
+                replay.beginCall();
+                glad_glUniformMatrix2x3fv(location, count, transpose, value);
+                replay.endCall(ENTRY_glUniformMatrix2x3fv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniformMatrix3x2fv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            GLboolean transpose = in.value<GLboolean>();
+            const GLfloat * value = (const GLfloat *)in.pointer();
+            if (glad_glUniformMatrix3x2fv)
+            {
+                replay.beginCall();
+                glad_glUniformMatrix3x2fv(location, count, transpose, value);
+                replay.endCall(ENTRY_glUniformMatrix3x2fv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniformMatrix2x4fv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            GLboolean transpose = in.value<GLboolean>();
+            const GLfloat * value = (const GLfloat *)in.pointer();
+            if (glad_glUniformMatrix2x4fv)
+            {
+                replay.beginCall();
+                glad_glUniformMatrix2x4fv(location, count, transpose, value);
+                replay.endCall(ENTRY_glUniformMatrix2x4fv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniformMatrix4x2fv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            GLboolean transpose = in.value<GLboolean>();
+            const GLfloat * value = (const GLfloat *)in.pointer();
+            if (glad_glUniformMatrix4x2fv)
+            {
+                replay.beginCall();
+                glad_glUniformMatrix4x2fv(location, count, transpose, value);
+                replay.endCall(ENTRY_glUniformMatrix4x2fv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniformMatrix3x4fv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            GLboolean transpose = in.value<GLboolean>();
+            const GLfloat * value = (const GLfloat *)in.pointer();
+            if (glad_glUniformMatrix3x4fv)
+            {
+                replay.beginCall();
+                glad_glUniformMatrix3x4fv(location, count, transpose, value);
+                replay.endCall(ENTRY_glUniformMatrix3x4fv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniformMatrix4x3fv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            GLboolean transpose = in.value<GLboolean>();
+            const GLfloat * value = (const GLfloat *)in.pointer();
+            if (glad_glUniformMatrix4x3fv)
+            {
+                replay.beginCall();
+                glad_glUniformMatrix4x3fv(location, count, transpose, value);
+                replay.endCall(ENTRY_glUniformMatrix4x3fv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColorMaski:
+        {
+            GLuint index = in.value<GLuint>();
+            GLboolean r = in.value<GLboolean>();
+            GLboolean g = in.value<GLboolean>();
+            GLboolean b = in.value<GLboolean>();
+            GLboolean a = in.value<GLboolean>();
+            if (glad_glColorMaski)
+            {
+                replay.beginCall();
+                glad_glColorMaski(index, r, g, b, a);
+                replay.endCall(ENTRY_glColorMaski);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glEnablei:
+        {
+            GLenum target = in.value<GLenum>();
+            GLuint index = in.value<GLuint>();
+            if (glad_glEnablei)
+            {
+                replay.beginCall();
+                glad_glEnablei(target, index);
+                replay.endCall(ENTRY_glEnablei);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDisablei:
+        {
+            GLenum target = in.value<GLenum>();
+            GLuint index = in.value<GLuint>();
+            if (glad_glDisablei)
+            {
+                replay.beginCall();
+                glad_glDisablei(target, index);
+                replay.endCall(ENTRY_glDisablei);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBeginTransformFeedback:
+        {
+            GLenum primitiveMode = in.value<GLenum>();
+            if (glad_glBeginTransformFeedback)
+            {
+                replay.beginCall();
+                glad_glBeginTransformFeedback(primitiveMode);
+                replay.endCall(ENTRY_glBeginTransformFeedback);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glEndTransformFeedback:
+        {
+            if (glad_glEndTransformFeedback)
+            {
+                replay.beginCall();
+                glad_glEndTransformFeedback();
+                replay.endCall(ENTRY_glEndTransformFeedback);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBindBufferRange:
+        {
+            GLenum target = in.value<GLenum>();
+            GLuint index = in.value<GLuint>();
+            GLuint captured_buffer = in.value<GLuint>();
+            GLuint buffer = replay.object(gltrace::Buffer, captured_buffer);
+            GLintptr offset = in.value<GLintptr>();
+            GLsizeiptr size = in.value<GLsizeiptr>();
+            if (glad_glBindBufferRange)
+            {
+                replay.beginCall();
+                glad_glBindBufferRange(target, index, buffer, offset, size);
+                replay.endCall(ENTRY_glBindBufferRange);
+            }
+            else
+                replay.missing();
+            replay.bindBuffer(target, buffer);
+            return true;
+        }
+        case ENTRY_glBindBufferBase:
+        {
+            GLenum target = in.value<GLenum>();
+            GLuint index = in.value<GLuint>();
+            GLuint captured_buffer = in.value<GLuint>();
+            GLuint buffer = replay.object(gltrace::Buffer, captured_buffer);
+            if (glad_glBindBufferBase)
+            {
+                replay.beginCall();
+                glad_glBindBufferBase(target, index, buffer);
+                replay.endCall(ENTRY_glBindBufferBase);
+            }
+            else
+                replay.missing();
+            replay.bindBuffer(target, buffer);
+            return true;
+        }
+        case ENTRY_glClampColor:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum clamp = in.value<GLenum>();
+            if (glad_glClampColor)
+            {
+                replay.beginCall();
+                glad_glClampColor(target, clamp);
+                replay.endCall(ENTRY_glClampColor);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBeginConditionalRender:
+        {
+            GLuint captured_id = in.value<GLuint>();
+            GLuint id = replay.object(gltrace::Query, captured_id);
+            GLenum mode = in.value<GLenum>();
+            if (glad_glBeginConditionalRender)
+            {
+                replay.beginCall();
+                glad_glBeginConditionalRender(id, mode);
+                replay.endCall(ENTRY_glBeginConditionalRender);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glEndConditionalRender:
+        {
+            if (glad_glEndConditionalRender)
+            {
+                replay.beginCall();
+                glad_glEndConditionalRender();
+                replay.endCall(ENTRY_glEndConditionalRender);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribIPointer:
+        {
+            GLuint index = in.value<GLuint>();
+            GLint size = in.value<GLint>();
+            GLenum type = in.value<GLenum>();
+            GLsizei stride = in.value<GLsizei>();
+            const void * pointer = (const void *)in.pointer();
+            if (glad_glVertexAttribIPointer)
+            {
+                replay.beginCall();
+                glad_glVertexAttribIPointer(index, size, type, stride, pointer);
+                replay.endCall(ENTRY_glVertexAttribIPointer);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI1i:
+        {
+            GLuint index = in.value<GLuint>();
+            GLint x = in.value<GLint>();
+            if (glad_glVertexAttribI1i)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI1i(index, x);
+                replay.endCall(ENTRY_glVertexAttribI1i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI2i:
+        {
+            GLuint index = in.value<GLuint>();
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            if (glad_glVertexAttribI2i)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI2i(index, x, y);
+                replay.endCall(ENTRY_glVertexAttribI2i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI3i:
+        {
+            GLuint index = in.value<GLuint>();
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            GLint z = in.value<GLint>();
+            if (glad_glVertexAttribI3i)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI3i(index, x, y, z);
+                replay.endCall(ENTRY_glVertexAttribI3i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI4i:
+        {
+            GLuint index = in.value<GLuint>();
+            GLint x = in.value<GLint>();
+            GLint y = in.value<GLint>();
+            GLint z = in.value<GLint>();
+            GLint w = in.value<GLint>();
+            if (glad_glVertexAttribI4i)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI4i(index, x, y, z, w);
+                replay.endCall(ENTRY_glVertexAttribI4i);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI1ui:
+        {
+            GLuint index = in.value<GLuint>();
+            GLuint x = in.value<GLuint>();
+            if (glad_glVertexAttribI1ui)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI1ui(index, x);
+                replay.endCall(ENTRY_glVertexAttribI1ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI2ui:
+        {
+            GLuint index = in.value<GLuint>();
+            GLuint x = in.value<GLuint>();
+            GLuint y = in.value<GLuint>();
+            if (glad_glVertexAttribI2ui)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI2ui(index, x, y);
+                replay.endCall(ENTRY_glVertexAttribI2ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI3ui:
+        {
+            GLuint index = in.value<GLuint>();
+            GLuint x = in.value<GLuint>();
+            GLuint y = in.value<GLuint>();
+            GLuint z = in.value<GLuint>();
+            if (glad_glVertexAttribI3ui)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI3ui(index, x, y, z);
+                replay.endCall(ENTRY_glVertexAttribI3ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI4ui:
+        {
+            GLuint index = in.value<GLuint>();
+            GLuint x = in.value<GLuint>();
+            GLuint y = in.value<GLuint>();
+            GLuint z = in.value<GLuint>();
+            GLuint w = in.value<GLuint>();
+            if (glad_glVertexAttribI4ui)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI4ui(index, x, y, z, w);
+                replay.endCall(ENTRY_glVertexAttribI4ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI1iv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLint * v = (const GLint *)in.pointer();
+            if (glad_glVertexAttribI1iv)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI1iv(index, v);
+                replay.endCall(ENTRY_glVertexAttribI1iv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI2iv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLint * v = (const GLint *)in.pointer();
+            if (glad_glVertexAttribI2iv)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI2iv(index, v);
+                replay.endCall(ENTRY_glVertexAttribI2iv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI3iv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLint * v = (const GLint *)in.pointer();
+            if (glad_glVertexAttribI3iv)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI3iv(index, v);
+                replay.endCall(ENTRY_glVertexAttribI3iv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI4iv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLint * v = (const GLint *)in.pointer();
+            if (glad_glVertexAttribI4iv)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI4iv(index, v);
+                replay.endCall(ENTRY_glVertexAttribI4iv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI1uiv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLuint * v = (const GLuint *)in.pointer();
+            if (glad_glVertexAttribI1uiv)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI1uiv(index, v);
+                replay.endCall(ENTRY_glVertexAttribI1uiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI2uiv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLuint * v = (const GLuint *)in.pointer();
+            if (glad_glVertexAttribI2uiv)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI2uiv(index, v);
+                replay.endCall(ENTRY_glVertexAttribI2uiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI3uiv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLuint * v = (const GLuint *)in.pointer();
+            if (glad_glVertexAttribI3uiv)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI3uiv(index, v);
+                replay.endCall(ENTRY_glVertexAttribI3uiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI4uiv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLuint * v = (const GLuint *)in.pointer();
+            if (glad_glVertexAttribI4uiv)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI4uiv(index, v);
+                replay.endCall(ENTRY_glVertexAttribI4uiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI4bv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLbyte * v = (const GLbyte *)in.pointer();
+            if (glad_glVertexAttribI4bv)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI4bv(index, v);
+                replay.endCall(ENTRY_glVertexAttribI4bv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI4sv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLshort * v = (const GLshort *)in.pointer();
+            if (glad_glVertexAttribI4sv)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI4sv(index, v);
+                replay.endCall(ENTRY_glVertexAttribI4sv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI4ubv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLubyte * v = (const GLubyte *)in.pointer();
+            if (glad_glVertexAttribI4ubv)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI4ubv(index, v);
+                replay.endCall(ENTRY_glVertexAttribI4ubv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribI4usv:
+        {
+            GLuint index = in.value<GLuint>();
+            const GLushort * v = (const GLushort *)in.pointer();
+            if (glad_glVertexAttribI4usv)
+            {
+                replay.beginCall();
+                glad_glVertexAttribI4usv(index, v);
+                replay.endCall(ENTRY_glVertexAttribI4usv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBindFragDataLocation:
+        {
+            GLuint captured_program = in.value<GLuint>();
+            GLuint program = replay.object(gltrace::Program, captured_program);
+            GLuint color = in.value<GLuint>();
+            const GLchar * name = (const GLchar *)in.pointer();
+            if (glad_glBindFragDataLocation)
+            {
+                replay.beginCall();
+                glad_glBindFragDataLocation(program, color, name);
+                replay.endCall(ENTRY_glBindFragDataLocation);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform1ui:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLuint v0 = in.value<GLuint>();
+            if (glad_glUniform1ui)
+            {
+                replay.beginCall();
+                glad_glUniform1ui(location, v0);
+                replay.endCall(ENTRY_glUniform1ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform2ui:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLuint v0 = in.value<GLuint>();
+            GLuint v1 = in.value<GLuint>();
+            if (glad_glUniform2ui)
+            {
+                replay.beginCall();
+                glad_glUniform2ui(location, v0, v1);
+                replay.endCall(ENTRY_glUniform2ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform3ui:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLuint v0 = in.value<GLuint>();
+            GLuint v1 = in.value<GLuint>();
+            GLuint v2 = in.value<GLuint>();
+            if (glad_glUniform3ui)
+            {
+                replay.beginCall();
+                glad_glUniform3ui(location, v0, v1, v2);
+                replay.endCall(ENTRY_glUniform3ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform4ui:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLuint v0 = in.value<GLuint>();
+            GLuint v1 = in.value<GLuint>();
+            GLuint v2 = in.value<GLuint>();
+            GLuint v3 = in.value<GLuint>();
+            if (glad_glUniform4ui)
+            {
+                replay.beginCall();
+                glad_glUniform4ui(location, v0, v1, v2, v3);
+                replay.endCall(ENTRY_glUniform4ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform1uiv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            const GLuint * value = (const GLuint *)in.pointer();
+            if (glad_glUniform1uiv)
+            {
+                replay.beginCall();
+                glad_glUniform1uiv(location, count, value);
+                replay.endCall(ENTRY_glUniform1uiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform2uiv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            const GLuint * value = (const GLuint *)in.pointer();
+            if (glad_glUniform2uiv)
+            {
+                replay.beginCall();
+                glad_glUniform2uiv(location, count, value);
+                replay.endCall(ENTRY_glUniform2uiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform3uiv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            const GLuint * value = (const GLuint *)in.pointer();
+            if (glad_glUniform3uiv)
+            {
+                replay.beginCall();
+                glad_glUniform3uiv(location, count, value);
+                replay.endCall(ENTRY_glUniform3uiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniform4uiv:
+        {
+            GLint location = replay.location(in.value<GLint>());
+            GLsizei count = in.value<GLsizei>();
+            const GLuint * value = (const GLuint *)in.pointer();
+            if (glad_glUniform4uiv)
+            {
+                replay.beginCall();
+                glad_glUniform4uiv(location, count, value);
+                replay.endCall(ENTRY_glUniform4uiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexParameterIiv:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum pname = in.value<GLenum>();
+            const GLint * params = (const GLint *)in.pointer();
+            if (glad_glTexParameterIiv)
+            {
+                replay.beginCall();
+                glad_glTexParameterIiv(target, pname, params);
+                replay.endCall(ENTRY_glTexParameterIiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexParameterIuiv:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum pname = in.value<GLenum>();
+            const GLuint * params = (const GLuint *)in.pointer();
+            if (glad_glTexParameterIuiv)
+            {
+                replay.beginCall();
+                glad_glTexParameterIuiv(target, pname, params);
+                replay.endCall(ENTRY_glTexParameterIuiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glClearBufferiv:
+        {
+            GLenum buffer = in.value<GLenum>();
+            GLint drawbuffer = in.value<GLint>();
+            const GLint * value = (const GLint *)in.pointer();
+            if (glad_glClearBufferiv)
+            {
+                replay.beginCall();
+                glad_glClearBufferiv(buffer, drawbuffer, value);
+                replay.endCall(ENTRY_glClearBufferiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glClearBufferuiv:
+        {
+            GLenum buffer = in.value<GLenum>();
+            GLint drawbuffer = in.value<GLint>();
+            const GLuint * value = (const GLuint *)in.pointer();
+            if (glad_glClearBufferuiv)
+            {
+                replay.beginCall();
+                glad_glClearBufferuiv(buffer, drawbuffer, value);
+                replay.endCall(ENTRY_glClearBufferuiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glClearBufferfv:
+        {
+            GLenum buffer = in.value<GLenum>();
+            GLint drawbuffer = in.value<GLint>();
+            const GLfloat * value = (const GLfloat *)in.pointer();
+            if (glad_glClearBufferfv)
+            {
+                replay.beginCall();
+                glad_glClearBufferfv(buffer, drawbuffer, value);
+                replay.endCall(ENTRY_glClearBufferfv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glClearBufferfi:
+        {
+            GLenum buffer = in.value<GLenum>();
+            GLint drawbuffer = in.value<GLint>();
+            GLfloat depth = in.value<GLfloat>();
+            GLint stencil = in.value<GLint>();
+            if (glad_glClearBufferfi)
+            {
+                replay.beginCall();
+                glad_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+                replay.endCall(ENTRY_glClearBufferfi);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBindRenderbuffer:
+        {
+            GLenum target = in.value<GLenum>();
+            GLuint captured_renderbuffer = in.value<GLuint>();
+            GLuint renderbuffer = replay.object(gltrace::Renderbuffer, captured_renderbuffer);
+            if (glad_glBindRenderbuffer)
+            {
+                replay.beginCall();
+                glad_glBindRenderbuffer(target, renderbuffer);
+                replay.endCall(ENTRY_glBindRenderbuffer);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDeleteRenderbuffers:
+        {
+            GLsizei n = in.value<GLsizei>();
+            const GLuint* renderbuffers = replay.objects(gltrace::Renderbuffer, (const GLuint*)in.pointer(), n);
+            if (glad_glDeleteRenderbuffers)
+            {
+                replay.beginCall();
+                glad_glDeleteRenderbuffers(n, renderbuffers);
+                replay.endCall(ENTRY_glDeleteRenderbuffers);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glGenRenderbuffers:
+        {
+            GLsizei n = in.value<GLsizei>();
+            GLuint* renderbuffers = replay.names(n);
+            if (glad_glGenRenderbuffers)
+            {
+                replay.beginCall();
+                glad_glGenRenderbuffers(n, renderbuffers);
+                replay.endCall(ENTRY_glGenRenderbuffers);
+            }
+            else
+                replay.missing();
+            replay.bindObjects(gltrace::Renderbuffer, (const GLuint*)in.pointer(), renderbuffers, n);
+            return true;
+        }
+        case ENTRY_glRenderbufferStorage:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum internalformat = in.value<GLenum>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            if (glad_glRenderbufferStorage)
+            {
+                replay.beginCall();
+                glad_glRenderbufferStorage(target, internalformat, width, height);
+                replay.endCall(ENTRY_glRenderbufferStorage);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBindFramebuffer:
+        {
+            GLenum target = in.value<GLenum>();
+            GLuint captured_framebuffer = in.value<GLuint>();
+            GLuint framebuffer = replay.object(gltrace::Framebuffer, captured_framebuffer);
+            if (glad_glBindFramebuffer)
+            {
+                replay.beginCall();
+                glad_glBindFramebuffer(target, framebuffer);
+                replay.endCall(ENTRY_glBindFramebuffer);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDeleteFramebuffers:
+        {
+            GLsizei n = in.value<GLsizei>();
+            const GLuint* framebuffers = replay.objects(gltrace::Framebuffer, (const GLuint*)in.pointer(), n);
+            if (glad_glDeleteFramebuffers)
+            {
+                replay.beginCall();
+                glad_glDeleteFramebuffers(n, framebuffers);
+                replay.endCall(ENTRY_glDeleteFramebuffers);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glGenFramebuffers:
+        {
+            GLsizei n = in.value<GLsizei>();
+            GLuint* framebuffers = replay.names(n);
+            if (glad_glGenFramebuffers)
+            {
+                replay.beginCall();
+                glad_glGenFramebuffers(n, framebuffers);
+                replay.endCall(ENTRY_glGenFramebuffers);
+            }
+            else
+                replay.missing();
+            replay.bindObjects(gltrace::Framebuffer, (const GLuint*)in.pointer(), framebuffers, n);
+            return true;
+        }
+        case ENTRY_glFramebufferTexture1D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum attachment = in.value<GLenum>();
+            GLenum textarget = in.value<GLenum>();
+            GLuint captured_texture = in.value<GLuint>();
+            GLuint texture = replay.object(gltrace::Texture, captured_texture);
+            GLint level = in.value<GLint>();
+            if (glad_glFramebufferTexture1D)
+            {
+                replay.beginCall();
+                glad_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+                replay.endCall(ENTRY_glFramebufferTexture1D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glFramebufferTexture2D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum attachment = in.value<GLenum>();
+            GLenum textarget = in.value<GLenum>();
+            GLuint captured_texture = in.value<GLuint>();
+            GLuint texture = replay.object(gltrace::Texture, captured_texture);
+            GLint level = in.value<GLint>();
+            if (glad_glFramebufferTexture2D)
+            {
+                replay.beginCall();
+                glad_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+                replay.endCall(ENTRY_glFramebufferTexture2D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glFramebufferTexture3D:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum attachment = in.value<GLenum>();
+            GLenum textarget = in.value<GLenum>();
+            GLuint captured_texture = in.value<GLuint>();
+            GLuint texture = replay.object(gltrace::Texture, captured_texture);
+            GLint level = in.value<GLint>();
+            GLint zoffset = in.value<GLint>();
+            if (glad_glFramebufferTexture3D)
+            {
+                replay.beginCall();
+                glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+                replay.endCall(ENTRY_glFramebufferTexture3D);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glFramebufferRenderbuffer:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum attachment = in.value<GLenum>();
+            GLenum renderbuffertarget = in.value<GLenum>();
+            GLuint captured_renderbuffer = in.value<GLuint>();
+            GLuint renderbuffer = replay.object(gltrace::Renderbuffer, captured_renderbuffer);
+            if (glad_glFramebufferRenderbuffer)
+            {
+                replay.beginCall();
+                glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+                replay.endCall(ENTRY_glFramebufferRenderbuffer);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glGenerateMipmap:
+        {
+            GLenum target = in.value<GLenum>();
+            if (glad_glGenerateMipmap)
+            {
+                replay.beginCall();
+                glad_glGenerateMipmap(target);
+                replay.endCall(ENTRY_glGenerateMipmap);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBlitFramebuffer:
+        {
+            GLint srcX0 = in.value<GLint>();
+            GLint srcY0 = in.value<GLint>();
+            GLint srcX1 = in.value<GLint>();
+            GLint srcY1 = in.value<GLint>();
+            GLint dstX0 = in.value<GLint>();
+            GLint dstY0 = in.value<GLint>();
+            GLint dstX1 = in.value<GLint>();
+            GLint dstY1 = in.value<GLint>();
+            GLbitfield mask = in.value<GLbitfield>();
+            GLenum filter = in.value<GLenum>();
+            if (glad_glBlitFramebuffer)
+            {
+                replay.beginCall();
+                glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+                replay.endCall(ENTRY_glBlitFramebuffer);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glRenderbufferStorageMultisample:
+        {
+            GLenum target = in.value<GLenum>();
+            GLsizei samples = in.value<GLsizei>();
+            GLenum internalformat = in.value<GLenum>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            if (glad_glRenderbufferStorageMultisample)
+            {
+                replay.beginCall();
+                glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+                replay.endCall(ENTRY_glRenderbufferStorageMultisample);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glFramebufferTextureLayer:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum attachment = in.value<GLenum>();
+            GLuint captured_texture = in.value<GLuint>();
+            GLuint texture = replay.object(gltrace::Texture, captured_texture);
+            GLint level = in.value<GLint>();
+            GLint layer = in.value<GLint>();
+            if (glad_glFramebufferTextureLayer)
+            {
+                replay.beginCall();
+                glad_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+                replay.endCall(ENTRY_glFramebufferTextureLayer);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMapBufferRange:
+        {
+            GLenum target = in.value<GLenum>();
+            GLintptr offset = in.value<GLintptr>();
+            GLsizeiptr length = in.value<GLsizeiptr>();
+            GLbitfield access = in.value<GLbitfield>();
+            void * result = nullptr;
+            if (glad_glMapBufferRange)
+            {
+                replay.beginCall();
+                result = glad_glMapBufferRange(target, offset, length, access);
+                replay.endCall(ENTRY_glMapBufferRange);
+            }
+            else
+                replay.missing();
+            replay.mapped(target, result);
+            return true;
+        }
+        case ENTRY_glFlushMappedBufferRange:
+        {
+            GLenum target = in.value<GLenum>();
+            GLintptr offset = in.value<GLintptr>();
+            GLsizeiptr length = in.value<GLsizeiptr>();
+            if (glad_glFlushMappedBufferRange)
+            {
+                replay.beginCall();
+                glad_glFlushMappedBufferRange(target, offset, length);
+                replay.endCall(ENTRY_glFlushMappedBufferRange);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBindVertexArray:
+        {
+            GLuint captured_array = in.value<GLuint>();
+            GLuint array = replay.object(gltrace::VertexArray, captured_array);
+            if (glad_glBindVertexArray)
+            {
+                replay.beginCall();
+                glad_glBindVertexArray(array);
+                replay.endCall(ENTRY_glBindVertexArray);
+            }
+            else
+                replay.missing();
+            replay.bindVertexArray(array);
+            return true;
+        }
+        case ENTRY_glDeleteVertexArrays:
+        {
+            GLsizei n = in.value<GLsizei>();
+            const GLuint* arrays = replay.objects(gltrace::VertexArray, (const GLuint*)in.pointer(), n);
+            if (glad_glDeleteVertexArrays)
+            {
+                replay.beginCall();
+                glad_glDeleteVertexArrays(n, arrays);
+                replay.endCall(ENTRY_glDeleteVertexArrays);
+            }
+            else
+                replay.missing();
+            replay.deleteVertexArrays(n, arrays);
+            return true;
+        }
+        case ENTRY_glGenVertexArrays:
+        {
+            GLsizei n = in.value<GLsizei>();
+            GLuint* arrays = replay.names(n);
+            if (glad_glGenVertexArrays)
+            {
+                replay.beginCall();
+                glad_glGenVertexArrays(n, arrays);
+                replay.endCall(ENTRY_glGenVertexArrays);
+            }
+            else
+                replay.missing();
+            replay.bindObjects(gltrace::VertexArray, (const GLuint*)in.pointer(), arrays, n);
+            return true;
+        }
+        case ENTRY_glDrawArraysInstanced:
+        {
+            GLenum mode = in.value<GLenum>();
+            GLint first = in.value<GLint>();
+            GLsizei count = in.value<GLsizei>();
+            GLsizei instancecount = in.value<GLsizei>();
+            if (glad_glDrawArraysInstanced)
+            {
+                replay.beginCall();
+                glad_glDrawArraysInstanced(mode, first, count, instancecount);
+                replay.endCall(ENTRY_glDrawArraysInstanced);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDrawElementsInstanced:
+        {
+            GLenum mode = in.value<GLenum>();
+            GLsizei count = in.value<GLsizei>();
+            GLenum type = in.value<GLenum>();
+            const void * indices = (const void *)in.pointer();
+            GLsizei instancecount = in.value<GLsizei>();
+            if (glad_glDrawElementsInstanced)
+            {
+                replay.beginCall();
+                glad_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+                replay.endCall(ENTRY_glDrawElementsInstanced);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexBuffer:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum internalformat = in.value<GLenum>();
+            GLuint captured_buffer = in.value<GLuint>();
+            GLuint buffer = replay.object(gltrace::Buffer, captured_buffer);
+            if (glad_glTexBuffer)
+            {
+                replay.beginCall();
+                glad_glTexBuffer(target, internalformat, buffer);
+                replay.endCall(ENTRY_glTexBuffer);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glPrimitiveRestartIndex:
+        {
+            GLuint index = in.value<GLuint>();
+            if (glad_glPrimitiveRestartIndex)
+            {
+                replay.beginCall();
+                glad_glPrimitiveRestartIndex(index);
+                replay.endCall(ENTRY_glPrimitiveRestartIndex);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glCopyBufferSubData:
+        {
+            GLenum readTarget = in.value<GLenum>();
+            GLenum writeTarget = in.value<GLenum>();
+            GLintptr readOffset = in.value<GLintptr>();
+            GLintptr writeOffset = in.value<GLintptr>();
+            GLsizeiptr size = in.value<GLsizeiptr>();
+            if (glad_glCopyBufferSubData)
+            {
+                replay.beginCall();
+                glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+                replay.endCall(ENTRY_glCopyBufferSubData);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glUniformBlockBinding:
+        {
+            GLuint captured_program = in.value<GLuint>();
+            GLuint program = replay.object(gltrace::Program, captured_program);
+            GLuint uniformBlockIndex = in.value<GLuint>();
+            GLuint uniformBlockBinding = in.value<GLuint>();
+            if (glad_glUniformBlockBinding)
+            {
+                replay.beginCall();
+                glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+                replay.endCall(ENTRY_glUniformBlockBinding);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDrawElementsBaseVertex:
+        {
+            GLenum mode = in.value<GLenum>();
+            GLsizei count = in.value<GLsizei>();
+            GLenum type = in.value<GLenum>();
+            const void * indices = (const void *)in.pointer();
+            GLint basevertex = in.value<GLint>();
+            if (glad_glDrawElementsBaseVertex)
+            {
+                replay.beginCall();
+                glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+                replay.endCall(ENTRY_glDrawElementsBaseVertex);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDrawRangeElementsBaseVertex:
+        {
+            GLenum mode = in.value<GLenum>();
+            GLuint start = in.value<GLuint>();
+            GLuint end = in.value<GLuint>();
+            GLsizei count = in.value<GLsizei>();
+            GLenum type = in.value<GLenum>();
+            const void * indices = (const void *)in.pointer();
+            GLint basevertex = in.value<GLint>();
+            if (glad_glDrawRangeElementsBaseVertex)
+            {
+                replay.beginCall();
+                glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+                replay.endCall(ENTRY_glDrawRangeElementsBaseVertex);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glDrawElementsInstancedBaseVertex:
+        {
+            GLenum mode = in.value<GLenum>();
+            GLsizei count = in.value<GLsizei>();
+            GLenum type = in.value<GLenum>();
+            const void * indices = (const void *)in.pointer();
+            GLsizei instancecount = in.value<GLsizei>();
+            GLint basevertex = in.value<GLint>();
+            if (glad_glDrawElementsInstancedBaseVertex)
+            {
+                replay.beginCall();
+                glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+                replay.endCall(ENTRY_glDrawElementsInstancedBaseVertex);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glProvokingVertex:
+        {
+            GLenum mode = in.value<GLenum>();
+            if (glad_glProvokingVertex)
+            {
+                replay.beginCall();
+                glad_glProvokingVertex(mode);
+                replay.endCall(ENTRY_glProvokingVertex);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glFenceSync:
+        {
+            GLenum condition = in.value<GLenum>();
+            GLbitfield flags = in.value<GLbitfield>();
+            GLsync result = GLsync();
+            if (glad_glFenceSync)
+            {
+                replay.beginCall();
+                result = glad_glFenceSync(condition, flags);
+                replay.endCall(ENTRY_glFenceSync);
+            }
+            else
+                replay.missing();
+            replay.bindSync(in.value<uint64_t>(), result);
+            return true;
+        }
+        case ENTRY_glDeleteSync:
+        {
+            GLsync sync = replay.sync(in.value<uint64_t>());
+            if (glad_glDeleteSync)
+            {
+                replay.beginCall();
+                glad_glDeleteSync(sync);
+                replay.endCall(ENTRY_glDeleteSync);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glClientWaitSync:
+        {
+            GLsync sync = replay.sync(in.value<uint64_t>());
+            GLbitfield flags = in.value<GLbitfield>();
+            GLuint64 timeout = in.value<GLuint64>();
+            GLenum result = GLenum();
+            if (glad_glClientWaitSync)
+            {
+                replay.beginCall();
+                result = glad_glClientWaitSync(sync, flags, timeout);
+                replay.endCall(ENTRY_glClientWaitSync);
+            }
+            else
+                replay.missing();
+            (void)result;
+            return true;
+        }
+        case ENTRY_glWaitSync:
+        {
+            GLsync sync = replay.sync(in.value<uint64_t>());
+            GLbitfield flags = in.value<GLbitfield>();
+            GLuint64 timeout = in.value<GLuint64>();
+            if (glad_glWaitSync)
+            {
+                replay.beginCall();
+                glad_glWaitSync(sync, flags, timeout);
+                replay.endCall(ENTRY_glWaitSync);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glFramebufferTexture:
+        {
+            GLenum target = in.value<GLenum>();
+            GLenum attachment = in.value<GLenum>();
+            GLuint captured_texture = in.value<GLuint>();
+            GLuint texture = replay.object(gltrace::Texture, captured_texture);
+            GLint level = in.value<GLint>();
+            if (glad_glFramebufferTexture)
+            {
+                replay.beginCall();
+                glad_glFramebufferTexture(target, attachment, texture, level);
+                replay.endCall(ENTRY_glFramebufferTexture);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexImage2DMultisample:
+        {
+            GLenum target = in.value<GLenum>();
+            GLsizei samples = in.value<GLsizei>();
+            GLenum internalformat = in.value<GLenum>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            GLboolean fixedsamplelocations = in.value<GLboolean>();
+            if (glad_glTexImage2DMultisample)
+            {
+                replay.beginCall();
+                glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+                replay.endCall(ENTRY_glTexImage2DMultisample);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexImage3DMultisample:
+        {
+            GLenum target = in.value<GLenum>();
+            GLsizei samples = in.value<GLsizei>();
+            GLenum internalformat = in.value<GLenum>();
+            GLsizei width = in.value<GLsizei>();
+            GLsizei height = in.value<GLsizei>();
+            GLsizei depth = in.value<GLsizei>();
+            GLboolean fixedsamplelocations = in.value<GLboolean>();
+            if (glad_glTexImage3DMultisample)
+            {
+                replay.beginCall();
+                glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+                replay.endCall(ENTRY_glTexImage3DMultisample);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glSampleMaski:
+        {
+            GLuint maskNumber = in.value<GLuint>();
+            GLbitfield mask = in.value<GLbitfield>();
+            if (glad_glSampleMaski)
+            {
+                replay.beginCall();
+                glad_glSampleMaski(maskNumber, mask);
+                replay.endCall(ENTRY_glSampleMaski);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBindFragDataLocationIndexed:
+        {
+            GLuint captured_program = in.value<GLuint>();
+            GLuint program = replay.object(gltrace::Program, captured_program);
+            GLuint colorNumber = in.value<GLuint>();
+            GLuint index = in.value<GLuint>();
+            const GLchar * name = (const GLchar *)in.pointer();
+            if (glad_glBindFragDataLocationIndexed)
+            {
+                replay.beginCall();
+                glad_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+                replay.endCall(ENTRY_glBindFragDataLocationIndexed);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glGenSamplers:
+        {
+            GLsizei count = in.value<GLsizei>();
+            GLuint* samplers = replay.names(count);
+            if (glad_glGenSamplers)
+            {
+                replay.beginCall();
+                glad_glGenSamplers(count, samplers);
+                replay.endCall(ENTRY_glGenSamplers);
+            }
+            else
+                replay.missing();
+            replay.bindObjects(gltrace::Sampler, (const GLuint*)in.pointer(), samplers, count);
+            return true;
+        }
+        case ENTRY_glDeleteSamplers:
+        {
+            GLsizei count = in.value<GLsizei>();
+            const GLuint* samplers = replay.objects(gltrace::Sampler, (const GLuint*)in.pointer(), count);
+            if (glad_glDeleteSamplers)
+            {
+                replay.beginCall();
+                glad_glDeleteSamplers(count, samplers);
+                replay.endCall(ENTRY_glDeleteSamplers);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glBindSampler:
+        {
+            GLuint unit = in.value<GLuint>();
+            GLuint captured_sampler = in.value<GLuint>();
+            GLuint sampler = replay.object(gltrace::Sampler, captured_sampler);
+            if (glad_glBindSampler)
+            {
+                replay.beginCall();
+                glad_glBindSampler(unit, sampler);
+                replay.endCall(ENTRY_glBindSampler);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glSamplerParameteri:
+        {
+            GLuint captured_sampler = in.value<GLuint>();
+            GLuint sampler = replay.object(gltrace::Sampler, captured_sampler);
+            GLenum pname = in.value<GLenum>();
+            GLint param = in.value<GLint>();
+            if (glad_glSamplerParameteri)
+            {
+                replay.beginCall();
+                glad_glSamplerParameteri(sampler, pname, param);
+                replay.endCall(ENTRY_glSamplerParameteri);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glSamplerParameteriv:
+        {
+            GLuint captured_sampler = in.value<GLuint>();
+            GLuint sampler = replay.object(gltrace::Sampler, captured_sampler);
+            GLenum pname = in.value<GLenum>();
+            const GLint * param = (const GLint *)in.pointer();
+            if (glad_glSamplerParameteriv)
+            {
+                replay.beginCall();
+                glad_glSamplerParameteriv(sampler, pname, param);
+                replay.endCall(ENTRY_glSamplerParameteriv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glSamplerParameterf:
+        {
+            GLuint captured_sampler = in.value<GLuint>();
+            GLuint sampler = replay.object(gltrace::Sampler, captured_sampler);
+            GLenum pname = in.value<GLenum>();
+            GLfloat param = in.value<GLfloat>();
+            if (glad_glSamplerParameterf)
+            {
+                replay.beginCall();
+                glad_glSamplerParameterf(sampler, pname, param);
+                replay.endCall(ENTRY_glSamplerParameterf);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glSamplerParameterfv:
+        {
+            GLuint captured_sampler = in.value<GLuint>();
+            GLuint sampler = replay.object(gltrace::Sampler, captured_sampler);
+            GLenum pname = in.value<GLenum>();
+            const GLfloat * param = (const GLfloat *)in.pointer();
+            if (glad_glSamplerParameterfv)
+            {
+                replay.beginCall();
+                glad_glSamplerParameterfv(sampler, pname, param);
+                replay.endCall(ENTRY_glSamplerParameterfv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glSamplerParameterIiv:
+        {
+            GLuint captured_sampler = in.value<GLuint>();
+            GLuint sampler = replay.object(gltrace::Sampler, captured_sampler);
+            GLenum pname = in.value<GLenum>();
+            const GLint * param = (const GLint *)in.pointer();
+            if (glad_glSamplerParameterIiv)
+            {
+                replay.beginCall();
+                glad_glSamplerParameterIiv(sampler, pname, param);
+                replay.endCall(ENTRY_glSamplerParameterIiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glSamplerParameterIuiv:
+        {
+            GLuint captured_sampler = in.value<GLuint>();
+            GLuint sampler = replay.object(gltrace::Sampler, captured_sampler);
+            GLenum pname = in.value<GLenum>();
+            const GLuint * param = (const GLuint *)in.pointer();
+            if (glad_glSamplerParameterIuiv)
+            {
+                replay.beginCall();
+                glad_glSamplerParameterIuiv(sampler, pname, param);
+                replay.endCall(ENTRY_glSamplerParameterIuiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glQueryCounter:
+        {
+            GLuint captured_id = in.value<GLuint>();
+            GLuint id = replay.object(gltrace::Query, captured_id);
+            GLenum target = in.value<GLenum>();
+            if (glad_glQueryCounter)
+            {
+                replay.beginCall();
+                glad_glQueryCounter(id, target);
+                replay.endCall(ENTRY_glQueryCounter);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribDivisor:
+        {
+            GLuint index = in.value<GLuint>();
+            GLuint divisor = in.value<GLuint>();
+            if (glad_glVertexAttribDivisor)
+            {
+                replay.beginCall();
+                glad_glVertexAttribDivisor(index, divisor);
+                replay.endCall(ENTRY_glVertexAttribDivisor);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribP1ui:
+        {
+            GLuint index = in.value<GLuint>();
+            GLenum type = in.value<GLenum>();
+            GLboolean normalized = in.value<GLboolean>();
+            GLuint value = in.value<GLuint>();
+            if (glad_glVertexAttribP1ui)
+            {
+                replay.beginCall();
+                glad_glVertexAttribP1ui(index, type, normalized, value);
+                replay.endCall(ENTRY_glVertexAttribP1ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribP1uiv:
+        {
+            GLuint index = in.value<GLuint>();
+            GLenum type = in.value<GLenum>();
+            GLboolean normalized = in.value<GLboolean>();
+            const GLuint * value = (const GLuint *)in.pointer();
+            if (glad_glVertexAttribP1uiv)
+            {
+                replay.beginCall();
+                glad_glVertexAttribP1uiv(index, type, normalized, value);
+                replay.endCall(ENTRY_glVertexAttribP1uiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribP2ui:
+        {
+            GLuint index = in.value<GLuint>();
+            GLenum type = in.value<GLenum>();
+            GLboolean normalized = in.value<GLboolean>();
+            GLuint value = in.value<GLuint>();
+            if (glad_glVertexAttribP2ui)
+            {
+                replay.beginCall();
+                glad_glVertexAttribP2ui(index, type, normalized, value);
+                replay.endCall(ENTRY_glVertexAttribP2ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribP2uiv:
+        {
+            GLuint index = in.value<GLuint>();
+            GLenum type = in.value<GLenum>();
+            GLboolean normalized = in.value<GLboolean>();
+            const GLuint * value = (const GLuint *)in.pointer();
+            if (glad_glVertexAttribP2uiv)
+            {
+                replay.beginCall();
+                glad_glVertexAttribP2uiv(index, type, normalized, value);
+                replay.endCall(ENTRY_glVertexAttribP2uiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribP3ui:
+        {
+            GLuint index = in.value<GLuint>();
+            GLenum type = in.value<GLenum>();
+            GLboolean normalized = in.value<GLboolean>();
+            GLuint value = in.value<GLuint>();
+            if (glad_glVertexAttribP3ui)
+            {
+                replay.beginCall();
+                glad_glVertexAttribP3ui(index, type, normalized, value);
+                replay.endCall(ENTRY_glVertexAttribP3ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribP3uiv:
+        {
+            GLuint index = in.value<GLuint>();
+            GLenum type = in.value<GLenum>();
+            GLboolean normalized = in.value<GLboolean>();
+            const GLuint * value = (const GLuint *)in.pointer();
+            if (glad_glVertexAttribP3uiv)
+            {
+                replay.beginCall();
+                glad_glVertexAttribP3uiv(index, type, normalized, value);
+                replay.endCall(ENTRY_glVertexAttribP3uiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribP4ui:
+        {
+            GLuint index = in.value<GLuint>();
+            GLenum type = in.value<GLenum>();
+            GLboolean normalized = in.value<GLboolean>();
+            GLuint value = in.value<GLuint>();
+            if (glad_glVertexAttribP4ui)
+            {
+                replay.beginCall();
+                glad_glVertexAttribP4ui(index, type, normalized, value);
+                replay.endCall(ENTRY_glVertexAttribP4ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexAttribP4uiv:
+        {
+            GLuint index = in.value<GLuint>();
+            GLenum type = in.value<GLenum>();
+            GLboolean normalized = in.value<GLboolean>();
+            const GLuint * value = (const GLuint *)in.pointer();
+            if (glad_glVertexAttribP4uiv)
+            {
+                replay.beginCall();
+                glad_glVertexAttribP4uiv(index, type, normalized, value);
+                replay.endCall(ENTRY_glVertexAttribP4uiv);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexP2ui:
+        {
+            GLenum type = in.value<GLenum>();
+            GLuint value = in.value<GLuint>();
+            if (glad_glVertexP2ui)
+            {
+                replay.beginCall();
+                glad_glVertexP2ui(type, value);
+                replay.endCall(ENTRY_glVertexP2ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexP3ui:
+        {
+            GLenum type = in.value<GLenum>();
+            GLuint value = in.value<GLuint>();
+            if (glad_glVertexP3ui)
+            {
+                replay.beginCall();
+                glad_glVertexP3ui(type, value);
+                replay.endCall(ENTRY_glVertexP3ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glVertexP4ui:
+        {
+            GLenum type = in.value<GLenum>();
+            GLuint value = in.value<GLuint>();
+            if (glad_glVertexP4ui)
+            {
+                replay.beginCall();
+                glad_glVertexP4ui(type, value);
+                replay.endCall(ENTRY_glVertexP4ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoordP1ui:
+        {
+            GLenum type = in.value<GLenum>();
+            GLuint coords = in.value<GLuint>();
+            if (glad_glTexCoordP1ui)
+            {
+                replay.beginCall();
+                glad_glTexCoordP1ui(type, coords);
+                replay.endCall(ENTRY_glTexCoordP1ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoordP2ui:
+        {
+            GLenum type = in.value<GLenum>();
+            GLuint coords = in.value<GLuint>();
+            if (glad_glTexCoordP2ui)
+            {
+                replay.beginCall();
+                glad_glTexCoordP2ui(type, coords);
+                replay.endCall(ENTRY_glTexCoordP2ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoordP3ui:
+        {
+            GLenum type = in.value<GLenum>();
+            GLuint coords = in.value<GLuint>();
+            if (glad_glTexCoordP3ui)
+            {
+                replay.beginCall();
+                glad_glTexCoordP3ui(type, coords);
+                replay.endCall(ENTRY_glTexCoordP3ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glTexCoordP4ui:
+        {
+            GLenum type = in.value<GLenum>();
+            GLuint coords = in.value<GLuint>();
+            if (glad_glTexCoordP4ui)
+            {
+                replay.beginCall();
+                glad_glTexCoordP4ui(type, coords);
+                replay.endCall(ENTRY_glTexCoordP4ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoordP1ui:
+        {
+            GLenum texture = in.value<GLenum>();
+            GLenum type = in.value<GLenum>();
+            GLuint coords = in.value<GLuint>();
+            if (glad_glMultiTexCoordP1ui)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoordP1ui(texture, type, coords);
+                replay.endCall(ENTRY_glMultiTexCoordP1ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoordP2ui:
+        {
+            GLenum texture = in.value<GLenum>();
+            GLenum type = in.value<GLenum>();
+            GLuint coords = in.value<GLuint>();
+            if (glad_glMultiTexCoordP2ui)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoordP2ui(texture, type, coords);
+                replay.endCall(ENTRY_glMultiTexCoordP2ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoordP3ui:
+        {
+            GLenum texture = in.value<GLenum>();
+            GLenum type = in.value<GLenum>();
+            GLuint coords = in.value<GLuint>();
+            if (glad_glMultiTexCoordP3ui)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoordP3ui(texture, type, coords);
+                replay.endCall(ENTRY_glMultiTexCoordP3ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glMultiTexCoordP4ui:
+        {
+            GLenum texture = in.value<GLenum>();
+            GLenum type = in.value<GLenum>();
+            GLuint coords = in.value<GLuint>();
+            if (glad_glMultiTexCoordP4ui)
+            {
+                replay.beginCall();
+                glad_glMultiTexCoordP4ui(texture, type, coords);
+                replay.endCall(ENTRY_glMultiTexCoordP4ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glNormalP3ui:
+        {
+            GLenum type = in.value<GLenum>();
+            GLuint coords = in.value<GLuint>();
+            if (glad_glNormalP3ui)
+            {
+                replay.beginCall();
+                glad_glNormalP3ui(type, coords);
+                replay.endCall(ENTRY_glNormalP3ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColorP3ui:
+        {
+            GLenum type = in.value<GLenum>();
+            GLuint color = in.value<GLuint>();
+            if (glad_glColorP3ui)
+            {
+                replay.beginCall();
+                glad_glColorP3ui(type, color);
+                replay.endCall(ENTRY_glColorP3ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glColorP4ui:
+        {
+            GLenum type = in.value<GLenum>();
+            GLuint color = in.value<GLuint>();
+            if (glad_glColorP4ui)
+            {
+                replay.beginCall();
+                glad_glColorP4ui(type, color);
+                replay.endCall(ENTRY_glColorP4ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        case ENTRY_glSecondaryColorP3ui:
+        {
+            GLenum type = in.value<GLenum>();
+            GLuint color = in.value<GLuint>();
+            if (glad_glSecondaryColorP3ui)
+            {
+                replay.beginCall();
+                glad_glSecondaryColorP3ui(type, color);
+                replay.endCall(ENTRY_glSecondaryColorP3ui);
+            }
+            else
+                replay.missing();
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+}
+
+#endif
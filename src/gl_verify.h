@@ -0,0 +1,38 @@
+#ifndef GL_VERIFY_H
+#define GL_VERIFY_H
+
+#include <cassert>
+
+#include <glad/glad.h>
+
+// the source line of the GL_VERIFY being executed, so GpuMemoryRegistry can
+// tell where an object was created; file is null outside GL_VERIFY and in
+// release builds. GL thread only.
+struct GLCallSite
+{
+    const char* file;
+    int line;
+};
+inline GLCallSite& glCallSite()
+{
+    static GLCallSite site = { nullptr, 0 };
+    return site;
+}
+
+// wraps a GL call and asserts that it did not raise an error (debug builds only)
+#ifndef NDEBUG
+#define GL_VERIFY(OP) do {                  \
+    glCallSite() = { __FILE__, __LINE__ };  \
+    OP;                                     \
+    glCallSite() = { nullptr, 0 };          \
+    GLenum error = glGetError();            \
+    if(error != GL_NO_ERROR)                \
+    {                                       \
+        assert(false);                      \
+    }                                       \
+} while(false)
+#else
+#define GL_VERIFY(OP) OP
+#endif
+
+#endif
@@ -0,0 +1,776 @@
+#ifndef GPU_MEMORY_H
+#define GPU_MEMORY_H
+
+#include <glad/glad.h>
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <array>
+#include <ostream>
+#include <unordered_map>
+#include <algorithm>
+
+#include "gl_verify.h"
+
+// the loader only has core 3.3, the compressed formats we size come from extensions
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT3_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT3_EXT 0x83F2
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+#ifndef GL_COMPRESSED_RGBA_BPTC_UNORM
+#define GL_COMPRESSED_RGBA_BPTC_UNORM 0x8E8C
+#endif
+#ifndef GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM
+#define GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM 0x8E8D
+#endif
+
+enum class GpuMemoryCategory : uint8_t
+{
+    VertexBuffer,
+    IndexBuffer,
+    UniformBuffer,
+    PixelBuffer,  // PBOs, pack and unpack
+    OtherBuffer,  // texture buffers, copies, transform feedback
+    Texture,
+    RenderTarget, // renderbuffers and textures attached to a framebuffer
+    Count
+};
+
+enum class GpuObjectKind : uint8_t
+{
+    Buffer,
+    Texture,
+    Renderbuffer,
+};
+
+// bytes of one image of internalFormat, compressed ones rounded up to whole
+// 4x4 blocks. The driver's real footprint adds padding and alignment this
+// does not know about; 3 component formats are counted as 4, as drivers
+// store them.
+// ----------------------------------------------------------------------------
+inline uint64_t gpuImageBytes(GLenum internalFormat, int width, int height, int depth = 1)
+{
+    uint64_t blocks = (uint64_t)((width + 3) / 4) * ((height + 3) / 4) * std::max(depth, 1);
+    uint64_t texels = (uint64_t)std::max(width, 0) * std::max(height, 0) * std::max(depth, 1);
+    switch (internalFormat)
+    {
+    case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+    case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+    case GL_COMPRESSED_RED_RGTC1:
+    case GL_COMPRESSED_SIGNED_RED_RGTC1:
+        return blocks * 8;
+    case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
+    case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+    case GL_COMPRESSED_RG_RGTC2:
+    case GL_COMPRESSED_SIGNED_RG_RGTC2:
+    case GL_COMPRESSED_RGBA_BPTC_UNORM:
+    case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+        return blocks * 16;
+    case GL_R8: case GL_R8I: case GL_R8UI: case GL_R8_SNORM: case GL_RED: case GL_STENCIL_INDEX8:
+        return texels;
+    case GL_RG8: case GL_RG8I: case GL_RG8UI: case GL_RG8_SNORM: case GL_RG:
+    case GL_R16: case GL_R16F: case GL_R16I: case GL_R16UI: case GL_DEPTH_COMPONENT16:
+        return texels * 2;
+    case GL_RGBA16: case GL_RGBA16F: case GL_RGBA16I: case GL_RGBA16UI: case GL_RGB16F:
+    case GL_RG32F: case GL_RG32I: case GL_RG32UI: case GL_DEPTH32F_STENCIL8:
+        return texels * 8;
+    case GL_RGBA32F: case GL_RGBA32I: case GL_RGBA32UI: case GL_RGB32F:
+        return texels * 16;
+    default:
+        // RGBA8, sRGB, RGB10_A2, R11F_G11F_B10F, RG16, R32F, depth 24/32, unsized RGB(A)
+        return texels * 4;
+    }
+}
+
+// one live GL object with storage
+struct GpuResource
+{
+    GpuObjectKind kind;
+    GLuint name;
+    GpuMemoryCategory category;
+    uint64_t bytes;     // all levels and faces
+    uint64_t mipBytes;  // of which below level 0
+    GLCallSite site;    // where it was created, file null when unknown
+    uint64_t createdFrame;
+    // textures: the base level, for glGenerateMipmap
+    GLenum format;
+    int width;
+    int height;
+    std::vector<uint64_t> levelBytes; // face * MAX_LEVELS + level
+};
+
+// totals of one category
+struct GpuMemoryTotals
+{
+    uint64_t bytes = 0;
+    uint64_t peakBytes = 0;
+    uint64_t mipBytes = 0;
+    uint32_t objects = 0;
+    uint64_t created = 0;
+    uint64_t deleted = 0;
+};
+
+// Byte estimates for every buffer, texture and renderbuffer, by category and
+// by the line that created it. install() puts hooks in front of glad's
+// pointers for the entry points that create, bind, size and delete objects,
+// so nothing has to be annotated: the hooks shadow the bindings, which name
+// the object that gets storage without asking GL, its category follows from
+// the target (a texture attached to a framebuffer becomes a render target)
+// and its site is the GL_VERIFY the glGen* call was wrapped in, so debug
+// builds only.
+//
+// Objects still alive at shutdown are leaks, writeLeaks() lists them.
+// glTexStorage2D is loaded past glad, TextureStorageSupport reports it
+// through textureStorage(). GL thread only.
+class GpuMemoryRegistry
+{
+public:
+    static const int MAX_LEVELS = 16;
+
+    GpuMemoryRegistry() {}
+    GpuMemoryRegistry(const GpuMemoryRegistry&) = delete;
+    GpuMemoryRegistry& operator=(const GpuMemoryRegistry&) = delete;
+
+    // after gladLoadGL*() and before any GL call, so the shadowed bindings
+    // start from GL's defaults
+    bool install();
+    void uninstall();
+    bool installed() const { return m_installed; }
+
+    // ------------------------------------------------------------------------
+    void endFrame() { m_frame++; }
+    uint64_t frame() const { return m_frame; }
+
+    const GpuMemoryTotals& totals(GpuMemoryCategory category) const { return m_totals[(size_t)category]; }
+    uint64_t bytes() const { return m_bytes; }
+    uint64_t peakBytes() const { return m_peakBytes; }
+    size_t liveObjects() const { return m_resources.size(); }
+
+    // ------------------------------------------------------------------------
+    static const char* categoryName(GpuMemoryCategory category)
+    {
+        static const char* const names[] = { "vertex buffers", "index buffers", "uniform buffers", "pixel buffers",
+            "other buffers", "textures", "render targets" };
+        return category < GpuMemoryCategory::Count ? names[(size_t)category] : "";
+    }
+    static const char* kindName(GpuObjectKind kind)
+    {
+        static const char* const names[] = { "buffer", "texture", "renderbuffer" };
+        return names[(size_t)kind];
+    }
+
+    // what the hooks report, public for storage allocated past glad
+    // ------------------------------------------------------------------------
+    void created(GpuObjectKind kind, GLsizei count, const GLuint* names)
+    {
+        for (GLsizei i = 0; i < count; i++)
+        {
+            GpuResource resource = { kind, names[i], kind == GpuObjectKind::Renderbuffer ? GpuMemoryCategory::RenderTarget
+                : kind == GpuObjectKind::Texture ? GpuMemoryCategory::Texture : GpuMemoryCategory::OtherBuffer,
+                0, 0, glCallSite(), m_frame, GL_NONE, 0, 0, {} };
+            auto inserted = m_resources.emplace(key(kind, names[i]), resource);
+            if (inserted.second)
+            {
+                m_totals[(size_t)resource.category].objects++;
+                m_totals[(size_t)resource.category].created++;
+            }
+        }
+    }
+    void deleted(GpuObjectKind kind, GLsizei count, const GLuint* names)
+    {
+        for (GLsizei i = 0; i < count; i++)
+        {
+            unbind(kind, names[i]);
+            auto it = m_resources.find(key(kind, names[i]));
+            if (it == m_resources.end())
+                continue;
+            resize(it->second, 0, 0);
+            GpuMemoryTotals& totals = m_totals[(size_t)it->second.category];
+            totals.objects--;
+            totals.deleted++;
+            m_resources.erase(it);
+        }
+    }
+    // glBind* as the hooks see them ------------------------------------------
+    void bindBuffer(GLenum target, GLuint buffer)
+    {
+        if (target == GL_ELEMENT_ARRAY_BUFFER)
+            m_elementBuffers[m_vertexArray] = buffer;
+        else if (bufferSlot(target) >= 0)
+            m_buffers[bufferSlot(target)] = buffer;
+    }
+    void bindVertexArray(GLuint vertexArray) { m_vertexArray = vertexArray; }
+    void deletedVertexArrays(GLsizei count, const GLuint* vertexArrays)
+    {
+        for (GLsizei i = 0; i < count; i++)
+        {
+            m_elementBuffers.erase(vertexArrays[i]);
+            if (vertexArrays[i] == m_vertexArray)
+                m_vertexArray = 0;
+        }
+    }
+    void activeTexture(GLenum unit)
+    {
+        if (unit < GL_TEXTURE0 || unit - GL_TEXTURE0 >= 256)
+            return; // GL_INVALID_ENUM, the unit stays
+        m_textureUnit = unit - GL_TEXTURE0;
+        if (m_textures.size() <= m_textureUnit)
+            m_textures.resize(m_textureUnit + 1, TextureUnit());
+    }
+    void bindTexture(GLenum target, GLuint texture)
+    {
+        if (textureSlot(target) >= 0)
+            m_textures[m_textureUnit][textureSlot(target)] = texture;
+    }
+    void bindRenderbuffer(GLuint renderbuffer) { m_renderbuffer = renderbuffer; }
+
+    // the buffer bound to target got size bytes
+    void bufferData(GLenum target, GLsizeiptr size)
+    {
+        GpuResource* resource = find(GpuObjectKind::Buffer, boundBuffer(target));
+        if (!resource)
+            return;
+        recategorize(*resource, bufferCategory(target));
+        resize(*resource, (uint64_t)std::max<GLsizeiptr>(size, 0), 0);
+    }
+    // one level of one face of the texture bound to target got storage
+    void textureImage(GLenum target, GLint level, GLenum internalFormat, int width, int height, uint64_t bytes)
+    {
+        GpuResource* resource = find(GpuObjectKind::Texture, boundTexture(target));
+        if (!resource || level < 0 || level >= MAX_LEVELS)
+            return;
+        int face = target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z
+            ? (int)(target - GL_TEXTURE_CUBE_MAP_POSITIVE_X) : 0;
+        if (level == 0)
+        {
+            resource->format = internalFormat;
+            resource->width = width;
+            resource->height = height;
+        }
+        setLevel(*resource, face * MAX_LEVELS + level, bytes);
+    }
+    // immutable storage for levels levels of the texture bound to target
+    void textureStorage(GLenum target, GLsizei levels, GLenum internalFormat, int width, int height)
+    {
+        for (GLsizei level = 0; level < levels && level < MAX_LEVELS; level++)
+        {
+            textureImage(target, level, internalFormat, width, height, gpuImageBytes(internalFormat, width, height));
+            width = std::max(1, width / 2);
+            height = std::max(1, height / 2);
+        }
+    }
+    // the levels below the base of the texture bound to target
+    void generateMipmap(GLenum target)
+    {
+        GpuResource* resource = find(GpuObjectKind::Texture, boundTexture(target));
+        if (!resource || !resource->width)
+            return;
+        int width = resource->width;
+        int height = resource->height;
+        for (int level = 1; level < MAX_LEVELS && (width > 1 || height > 1); level++)
+        {
+            width = std::max(1, width / 2);
+            height = std::max(1, height / 2);
+            setLevel(*resource, level, gpuImageBytes(resource->format, width, height));
+        }
+    }
+    // the renderbuffer bound to GL_RENDERBUFFER got storage
+    void renderbufferStorage(GLenum internalFormat, GLsizei samples, int width, int height)
+    {
+        GpuResource* resource = find(GpuObjectKind::Renderbuffer, m_renderbuffer);
+        if (resource)
+            resize(*resource, gpuImageBytes(internalFormat, width, height) * std::max<GLsizei>(samples, 1), 0);
+    }
+    void attached(GLuint texture)
+    {
+        auto it = m_resources.find(key(GpuObjectKind::Texture, texture));
+        if (it != m_resources.end())
+            recategorize(it->second, GpuMemoryCategory::RenderTarget);
+    }
+
+    // live objects, biggest first
+    // ------------------------------------------------------------------------
+    std::vector<const GpuResource*> resources() const
+    {
+        std::vector<const GpuResource*> live;
+        for (const auto& entry : m_resources)
+            live.push_back(&entry.second);
+        std::sort(live.begin(), live.end(), [](const GpuResource* a, const GpuResource* b) {
+            return a->bytes != b->bytes ? a->bytes > b->bytes : a->name < b->name;
+        });
+        return live;
+    }
+
+    // totals and peaks per category, then the live objects summed per site
+    // ------------------------------------------------------------------------
+    void writeReport(std::ostream& out) const
+    {
+        char line[256];
+        snprintf(line, sizeof(line), "GPU memory: %.2f MiB in %zu objects, peak %.2f MiB\n", mebibytes(m_bytes),
+            m_resources.size(), mebibytes(m_peakBytes));
+        out << line;
+        snprintf(line, sizeof(line), "%-16s %8s %8s %8s %12s %12s %12s\n", "category", "objects", "created", "deleted",
+            "MiB", "peak MiB", "mips MiB");
+        out << line;
+        for (size_t c = 0; c < (size_t)GpuMemoryCategory::Count; c++)
+        {
+            const GpuMemoryTotals& totals = m_totals[c];
+            snprintf(line, sizeof(line), "%-16s %8u %8llu %8llu %12.3f %12.3f %12.3f\n", categoryName((GpuMemoryCategory)c),
+                totals.objects, (unsigned long long)totals.created, (unsigned long long)totals.deleted,
+                mebibytes(totals.bytes), mebibytes(totals.peakBytes), mebibytes(totals.mipBytes));
+            out << line;
+        }
+
+        struct SiteTotal
+        {
+            std::string site;
+            uint32_t objects;
+            uint64_t bytes;
+        };
+        std::vector<SiteTotal> sites;
+        for (const auto& entry : m_resources)
+        {
+            std::string site = siteName(entry.second.site);
+            auto it = std::find_if(sites.begin(), sites.end(), [&site](const SiteTotal& total) { return total.site == site; });
+            if (it == sites.end())
+                sites.push_back(SiteTotal{ site, 1, entry.second.bytes });
+            else
+            {
+                it->objects++;
+                it->bytes += entry.second.bytes;
+            }
+        }
+        std::sort(sites.begin(), sites.end(), [](const SiteTotal& a, const SiteTotal& b) { return a.bytes > b.bytes; });
+        for (const SiteTotal& total : sites)
+        {
+            snprintf(line, sizeof(line), "  %-40s %6u objects %12.3f MiB\n", total.site.c_str(), total.objects, mebibytes(total.bytes));
+            out << line;
+        }
+    }
+    // every live object, for shutdown after everything was released; false
+    // when there was none
+    // ------------------------------------------------------------------------
+    bool writeLeaks(std::ostream& out) const
+    {
+        char line[256];
+        for (const GpuResource* resource : resources())
+        {
+            snprintf(line, sizeof(line), "leaked %s %u (%s, %llu bytes) created at %s in frame %llu\n",
+                kindName(resource->kind), resource->name, categoryName(resource->category),
+                (unsigned long long)resource->bytes, siteName(resource->site).c_str(), (unsigned long long)resource->createdFrame);
+            out << line;
+        }
+        return !m_resources.empty();
+    }
+
+    // ------------------------------------------------------------------------
+    static std::string siteName(const GLCallSite& site)
+    {
+        if (!site.file)
+            return "unknown";
+        const char* file = site.file;
+        for (const char* c = site.file; *c; c++)
+        {
+            if (*c == '/' || *c == '\\')
+                file = c + 1;
+        }
+        return std::string(file) + ":" + std::to_string(site.line);
+    }
+
+private:
+    std::unordered_map<uint64_t, GpuResource> m_resources;
+    GpuMemoryTotals m_totals[(size_t)GpuMemoryCategory::Count];
+    uint64_t m_bytes = 0;
+    uint64_t m_peakBytes = 0;
+    uint64_t m_frame = 0;
+    bool m_installed = false;
+
+    // the shadowed bindings
+    enum { BUFFER_TARGETS = 8, TEXTURE_TARGETS = 9 };
+    typedef std::array<GLuint, TEXTURE_TARGETS> TextureUnit;
+    GLuint m_buffers[BUFFER_TARGETS] = {};
+    std::unordered_map<GLuint, GLuint> m_elementBuffers; // per vertex array
+    GLuint m_vertexArray = 0;
+    std::vector<TextureUnit> m_textures = std::vector<TextureUnit>(1, TextureUnit());
+    GLuint m_textureUnit = 0;
+    GLuint m_renderbuffer = 0;
+
+    // ------------------------------------------------------------------------
+    static uint64_t key(GpuObjectKind kind, GLuint name) { return (uint64_t)kind << 32 | name; }
+    static double mebibytes(uint64_t bytes) { return bytes / (1024.0 * 1024.0); }
+
+    // index into m_buffers, -1 for targets not tracked; the element array
+    // binding belongs to the vertex array
+    // ------------------------------------------------------------------------
+    static int bufferSlot(GLenum target)
+    {
+        switch (target)
+        {
+        case GL_ARRAY_BUFFER: return 0;
+        case GL_UNIFORM_BUFFER: return 1;
+        case GL_PIXEL_PACK_BUFFER: return 2;
+        case GL_PIXEL_UNPACK_BUFFER: return 3;
+        case GL_TEXTURE_BUFFER: return 4;
+        case GL_COPY_READ_BUFFER: return 5;
+        case GL_COPY_WRITE_BUFFER: return 6;
+        case GL_TRANSFORM_FEEDBACK_BUFFER: return 7;
+        default: return -1;
+        }
+    }
+    GLuint boundBuffer(GLenum target) const
+    {
+        if (target == GL_ELEMENT_ARRAY_BUFFER)
+        {
+            auto it = m_elementBuffers.find(m_vertexArray);
+            return it != m_elementBuffers.end() ? it->second : 0;
+        }
+        return bufferSlot(target) >= 0 ? m_buffers[bufferSlot(target)] : 0;
+    }
+    static GpuMemoryCategory bufferCategory(GLenum target)
+    {
+        switch (target)
+        {
+        case GL_ARRAY_BUFFER: return GpuMemoryCategory::VertexBuffer;
+        case GL_ELEMENT_ARRAY_BUFFER: return GpuMemoryCategory::IndexBuffer;
+        case GL_UNIFORM_BUFFER: return GpuMemoryCategory::UniformBuffer;
+        case GL_PIXEL_PACK_BUFFER:
+        case GL_PIXEL_UNPACK_BUFFER: return GpuMemoryCategory::PixelBuffer;
+        default: return GpuMemoryCategory::OtherBuffer;
+        }
+    }
+    // index into a TextureUnit, cube faces are the cube map
+    static int textureSlot(GLenum target)
+    {
+        if (target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z)
+            target = GL_TEXTURE_CUBE_MAP;
+        switch (target)
+        {
+        case GL_TEXTURE_1D: return 0;
+        case GL_TEXTURE_2D: return 1;
+        case GL_TEXTURE_3D: return 2;
+        case GL_TEXTURE_1D_ARRAY: return 3;
+        case GL_TEXTURE_2D_ARRAY: return 4;
+        case GL_TEXTURE_RECTANGLE: return 5;
+        case GL_TEXTURE_CUBE_MAP: return 6;
+        case GL_TEXTURE_2D_MULTISAMPLE: return 7;
+        case GL_TEXTURE_2D_MULTISAMPLE_ARRAY: return 8;
+        default: return -1; // proxies have no storage
+        }
+    }
+    GLuint boundTexture(GLenum target) const
+    {
+        return textureSlot(target) >= 0 ? m_textures[m_textureUnit][textureSlot(target)] : 0;
+    }
+    // a deleted object is unbound wherever it was bound, as GL does
+    // ------------------------------------------------------------------------
+    void unbind(GpuObjectKind kind, GLuint name)
+    {
+        if (kind == GpuObjectKind::Buffer)
+        {
+            std::replace(std::begin(m_buffers), std::end(m_buffers), name, 0u);
+            auto it = m_elementBuffers.find(m_vertexArray);
+            if (it != m_elementBuffers.end() && it->second == name)
+                it->second = 0;
+        }
+        else if (kind == GpuObjectKind::Texture)
+        {
+            for (TextureUnit& unit : m_textures)
+                std::replace(unit.begin(), unit.end(), name, 0u);
+        }
+        else if (m_renderbuffer == name)
+            m_renderbuffer = 0;
+    }
+    // the tracked object, null for 0 or unknown
+    GpuResource* find(GpuObjectKind kind, GLuint name)
+    {
+        auto it = m_resources.find(key(kind, name));
+        return name && it != m_resources.end() ? &it->second : nullptr;
+    }
+
+    // ------------------------------------------------------------------------
+    void setLevel(GpuResource& resource, int index, uint64_t bytes)
+    {
+        if (resource.levelBytes.size() <= (size_t)index)
+            resource.levelBytes.resize(index + 1, 0);
+        resource.levelBytes[index] = bytes;
+        uint64_t total = 0, mips = 0;
+        for (size_t i = 0; i < resource.levelBytes.size(); i++)
+        {
+            total += resource.levelBytes[i];
+            mips += i % MAX_LEVELS ? resource.levelBytes[i] : 0;
+        }
+        resize(resource, total, mips);
+    }
+    void resize(GpuResource& resource, uint64_t bytes, uint64_t mipBytes)
+    {
+        GpuMemoryTotals& totals = m_totals[(size_t)resource.category];
+        totals.bytes += bytes - resource.bytes;
+        totals.mipBytes += mipBytes - resource.mipBytes;
+        totals.peakBytes = std::max(totals.peakBytes, totals.bytes);
+        m_bytes += bytes - resource.bytes;
+        m_peakBytes = std::max(m_peakBytes, m_bytes);
+        resource.bytes = bytes;
+        resource.mipBytes = mipBytes;
+    }
+    void recategorize(GpuResource& resource, GpuMemoryCategory category)
+    {
+        if (resource.category == category)
+            return;
+        GpuMemoryTotals& from = m_totals[(size_t)resource.category];
+        GpuMemoryTotals& to = m_totals[(size_t)category];
+        from.bytes -= resource.bytes;
+        from.mipBytes -= resource.mipBytes;
+        from.objects--;
+        to.bytes += resource.bytes;
+        to.mipBytes += resource.mipBytes;
+        to.peakBytes = std::max(to.peakBytes, to.bytes);
+        to.objects++;
+        to.created++;
+        from.created--;
+        resource.category = category;
+    }
+};
+
+// ----------------------------------------------------------------------------
+inline GpuMemoryRegistry& gpuMemory()
+{
+    static GpuMemoryRegistry registry;
+    return registry;
+}
+
+// The hooks, each forwarding to the pointer it replaced and then telling
+// gpuMemory().
+namespace gpumem
+{
+#define GPU_MEMORY_HOOKS(X)                                                        \
+    X(glGenBuffers, PFNGLGENBUFFERSPROC)                                           \
+    X(glDeleteBuffers, PFNGLDELETEBUFFERSPROC)                                     \
+    X(glBindBuffer, PFNGLBINDBUFFERPROC)                                           \
+    X(glBindBufferBase, PFNGLBINDBUFFERBASEPROC)                                   \
+    X(glBindBufferRange, PFNGLBINDBUFFERRANGEPROC)                                 \
+    X(glBindVertexArray, PFNGLBINDVERTEXARRAYPROC)                                 \
+    X(glDeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC)                           \
+    X(glBufferData, PFNGLBUFFERDATAPROC)                                           \
+    X(glGenTextures, PFNGLGENTEXTURESPROC)                                         \
+    X(glDeleteTextures, PFNGLDELETETEXTURESPROC)                                   \
+    X(glActiveTexture, PFNGLACTIVETEXTUREPROC)                                     \
+    X(glBindTexture, PFNGLBINDTEXTUREPROC)                                         \
+    X(glTexImage2D, PFNGLTEXIMAGE2DPROC)                                           \
+    X(glTexImage3D, PFNGLTEXIMAGE3DPROC)                                           \
+    X(glTexImage2DMultisample, PFNGLTEXIMAGE2DMULTISAMPLEPROC)                     \
+    X(glCompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC)                       \
+    X(glCompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC)                       \
+    X(glGenerateMipmap, PFNGLGENERATEMIPMAPPROC)                                   \
+    X(glFramebufferTexture, PFNGLFRAMEBUFFERTEXTUREPROC)                           \
+    X(glFramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC)                       \
+    X(glFramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC)                 \
+    X(glGenRenderbuffers, PFNGLGENRENDERBUFFERSPROC)                               \
+    X(glDeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC)                         \
+    X(glBindRenderbuffer, PFNGLBINDRENDERBUFFERPROC)                               \
+    X(glRenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC)                         \
+    X(glRenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)
+
+    enum Hook : uint32_t
+    {
+#define GPU_MEMORY_HOOK_ENUM(NAME, TYPE) HOOK_##NAME,
+        GPU_MEMORY_HOOKS(GPU_MEMORY_HOOK_ENUM)
+#undef GPU_MEMORY_HOOK_ENUM
+        HOOK_COUNT
+    };
+
+    // the replaced pointers, a template so the header defines them once
+    template<typename Unused = void>
+    struct Table
+    {
+        static void* loaded[HOOK_COUNT];
+    };
+    template<typename Unused> void* Table<Unused>::loaded[HOOK_COUNT] = {};
+
+#define GPU_MEMORY_FORWARD(NAME) ((decltype(glad_##NAME))Table<>::loaded[HOOK_##NAME])
+
+    // ------------------------------------------------------------------------
+    inline void APIENTRY hooked_glGenBuffers(GLsizei n, GLuint* buffers)
+    {
+        GPU_MEMORY_FORWARD(glGenBuffers)(n, buffers);
+        gpuMemory().created(GpuObjectKind::Buffer, n, buffers);
+    }
+    inline void APIENTRY hooked_glDeleteBuffers(GLsizei n, const GLuint* buffers)
+    {
+        gpuMemory().deleted(GpuObjectKind::Buffer, n, buffers);
+        GPU_MEMORY_FORWARD(glDeleteBuffers)(n, buffers);
+    }
+    inline void APIENTRY hooked_glBindBuffer(GLenum target, GLuint buffer)
+    {
+        GPU_MEMORY_FORWARD(glBindBuffer)(target, buffer);
+        gpuMemory().bindBuffer(target, buffer);
+    }
+    inline void APIENTRY hooked_glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+    {
+        GPU_MEMORY_FORWARD(glBindBufferBase)(target, index, buffer);
+        gpuMemory().bindBuffer(target, buffer);
+    }
+    inline void APIENTRY hooked_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+    {
+        GPU_MEMORY_FORWARD(glBindBufferRange)(target, index, buffer, offset, size);
+        gpuMemory().bindBuffer(target, buffer);
+    }
+    inline void APIENTRY hooked_glBindVertexArray(GLuint array)
+    {
+        GPU_MEMORY_FORWARD(glBindVertexArray)(array);
+        gpuMemory().bindVertexArray(array);
+    }
+    inline void APIENTRY hooked_glDeleteVertexArrays(GLsizei n, const GLuint* arrays)
+    {
+        gpuMemory().deletedVertexArrays(n, arrays);
+        GPU_MEMORY_FORWARD(glDeleteVertexArrays)(n, arrays);
+    }
+    inline void APIENTRY hooked_glBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+    {
+        GPU_MEMORY_FORWARD(glBufferData)(target, size, data, usage);
+        gpuMemory().bufferData(target, size);
+    }
+    inline void APIENTRY hooked_glGenTextures(GLsizei n, GLuint* textures)
+    {
+        GPU_MEMORY_FORWARD(glGenTextures)(n, textures);
+        gpuMemory().created(GpuObjectKind::Texture, n, textures);
+    }
+    inline void APIENTRY hooked_glDeleteTextures(GLsizei n, const GLuint* textures)
+    {
+        gpuMemory().deleted(GpuObjectKind::Texture, n, textures);
+        GPU_MEMORY_FORWARD(glDeleteTextures)(n, textures);
+    }
+    inline void APIENTRY hooked_glActiveTexture(GLenum texture)
+    {
+        GPU_MEMORY_FORWARD(glActiveTexture)(texture);
+        gpuMemory().activeTexture(texture);
+    }
+    inline void APIENTRY hooked_glBindTexture(GLenum target, GLuint texture)
+    {
+        GPU_MEMORY_FORWARD(glBindTexture)(target, texture);
+        gpuMemory().bindTexture(target, texture);
+    }
+    inline void APIENTRY hooked_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height,
+        GLint border, GLenum format, GLenum type, const void* pixels)
+    {
+        GPU_MEMORY_FORWARD(glTexImage2D)(target, level, internalformat, width, height, border, format, type, pixels);
+        gpuMemory().textureImage(target, level, internalformat, width, height,
+            gpuImageBytes(internalformat, width, height));
+    }
+    inline void APIENTRY hooked_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height,
+        GLsizei depth, GLint border, GLenum format, GLenum type, const void* pixels)
+    {
+        GPU_MEMORY_FORWARD(glTexImage3D)(target, level, internalformat, width, height, depth, border, format, type, pixels);
+        gpuMemory().textureImage(target, level, internalformat, width, height,
+            gpuImageBytes(internalformat, width, height, depth));
+    }
+    inline void APIENTRY hooked_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width,
+        GLsizei height, GLboolean fixedsamplelocations)
+    {
+        GPU_MEMORY_FORWARD(glTexImage2DMultisample)(target, samples, internalformat, width, height, fixedsamplelocations);
+        gpuMemory().textureImage(target, 0, internalformat, width, height,
+            gpuImageBytes(internalformat, width, height) * std::max<GLsizei>(samples, 1));
+    }
+    inline void APIENTRY hooked_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width,
+        GLsizei height, GLint border, GLsizei imageSize, const void* data)
+    {
+        GPU_MEMORY_FORWARD(glCompressedTexImage2D)(target, level, internalformat, width, height, border, imageSize, data);
+        gpuMemory().textureImage(target, level, internalformat, width, height, (uint64_t)std::max<GLsizei>(imageSize, 0));
+    }
+    inline void APIENTRY hooked_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width,
+        GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void* data)
+    {
+        GPU_MEMORY_FORWARD(glCompressedTexImage3D)(target, level, internalformat, width, height, depth, border, imageSize, data);
+        gpuMemory().textureImage(target, level, internalformat, width, height, (uint64_t)std::max<GLsizei>(imageSize, 0));
+    }
+    inline void APIENTRY hooked_glGenerateMipmap(GLenum target)
+    {
+        GPU_MEMORY_FORWARD(glGenerateMipmap)(target);
+        gpuMemory().generateMipmap(target);
+    }
+    inline void APIENTRY hooked_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level)
+    {
+        GPU_MEMORY_FORWARD(glFramebufferTexture)(target, attachment, texture, level);
+        gpuMemory().attached(texture);
+    }
+    inline void APIENTRY hooked_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+    {
+        GPU_MEMORY_FORWARD(glFramebufferTexture2D)(target, attachment, textarget, texture, level);
+        gpuMemory().attached(texture);
+    }
+    inline void APIENTRY hooked_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+    {
+        GPU_MEMORY_FORWARD(glFramebufferTextureLayer)(target, attachment, texture, level, layer);
+        gpuMemory().attached(texture);
+    }
+    inline void APIENTRY hooked_glGenRenderbuffers(GLsizei n, GLuint* renderbuffers)
+    {
+        GPU_MEMORY_FORWARD(glGenRenderbuffers)(n, renderbuffers);
+        gpuMemory().created(GpuObjectKind::Renderbuffer, n, renderbuffers);
+    }
+    inline void APIENTRY hooked_glDeleteRenderbuffers(GLsizei n, const GLuint* renderbuffers)
+    {
+        gpuMemory().deleted(GpuObjectKind::Renderbuffer, n, renderbuffers);
+        GPU_MEMORY_FORWARD(glDeleteRenderbuffers)(n, renderbuffers);
+    }
+    inline void APIENTRY hooked_glBindRenderbuffer(GLenum target, GLuint renderbuffer)
+    {
+        GPU_MEMORY_FORWARD(glBindRenderbuffer)(target, renderbuffer);
+        gpuMemory().bindRenderbuffer(renderbuffer);
+    }
+    inline void APIENTRY hooked_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+    {
+        GPU_MEMORY_FORWARD(glRenderbufferStorage)(target, internalformat, width, height);
+        gpuMemory().renderbufferStorage(internalformat, 1, width, height);
+    }
+    inline void APIENTRY hooked_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat,
+        GLsizei width, GLsizei height)
+    {
+        GPU_MEMORY_FORWARD(glRenderbufferStorageMultisample)(target, samples, internalformat, width, height);
+        gpuMemory().renderbufferStorage(internalformat, samples, width, height);
+    }
+
+#undef GPU_MEMORY_FORWARD
+}
+
+// ----------------------------------------------------------------------------
+inline bool GpuMemoryRegistry::install()
+{
+    if (m_installed || !glad_glBindBuffer)
+        return m_installed;
+#define GPU_MEMORY_INSTALL(NAME, TYPE)                               \
+    if (glad_##NAME && glad_##NAME != gpumem::hooked_##NAME)         \
+    {                                                                \
+        gpumem::Table<>::loaded[gpumem::HOOK_##NAME] = (void*)glad_##NAME; \
+        glad_##NAME = gpumem::hooked_##NAME;                         \
+    }
+    GPU_MEMORY_HOOKS(GPU_MEMORY_INSTALL)
+#undef GPU_MEMORY_INSTALL
+    m_installed = true;
+    return true;
+}
+// the objects stay tracked, later calls are no longer seen
+// ----------------------------------------------------------------------------
+inline void GpuMemoryRegistry::uninstall()
+{
+    if (!m_installed)
+        return;
+#define GPU_MEMORY_UNINSTALL(NAME, TYPE)                             \
+    if (glad_##NAME == gpumem::hooked_##NAME)                        \
+        glad_##NAME = (TYPE)gpumem::Table<>::loaded[gpumem::HOOK_##NAME];
+    GPU_MEMORY_HOOKS(GPU_MEMORY_UNINSTALL)
+#undef GPU_MEMORY_UNINSTALL
+    m_installed = false;
+}
+
+#endif
@@ -0,0 +1,343 @@
+#ifndef GPU_PROFILER_H
+#define GPU_PROFILER_H
+
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <ostream>
+#include <iomanip>
+#include <algorithm>
+#include <unordered_map>
+
+#include "gl_verify.h"
+#include "cpu_profiler.h"
+
+// rolling statistics of one named scope, milliseconds
+struct GpuScopeStats
+{
+    const char* name;
+    uint32_t samples; // in the window
+    double mean;
+    double p95;
+    double max;
+    double last;
+};
+
+// one finished scope, on the profilerNanoseconds() clock
+struct GpuTimelineEvent
+{
+    const char* name; // owned by the profiler
+    uint32_t depth;   // 0 is the frame itself
+    uint64_t frame;
+    uint64_t beginNanoseconds;
+    uint64_t endNanoseconds;
+};
+
+// GPU time of named scopes. Every begin() and end() drops a GL_TIMESTAMP
+// query into the command stream, so scopes can nest (GL_TIME_ELAPSED
+// queries cannot). Each frame has its own set of queries in a ring of
+// `frames` frames and is read back only when its last query is available,
+// normally a couple of frames later, so nothing ever waits for the GPU. If
+// the GPU falls a whole ring behind, the oldest frame is dropped instead.
+//
+// Finished scopes feed a rolling window per name and a timeline, moved to
+// the CPU clock by pairing a GL_TIMESTAMP read with profilerNanoseconds()
+// every few hundred frames, so they line up with CPU trace events.
+class GpuProfiler
+{
+public:
+    explicit GpuProfiler(uint32_t frames = 4, uint32_t window = 128)
+        : m_frames(std::max(frames, 2u)), m_window(std::max(window, 1u))
+    {
+    }
+    ~GpuProfiler()
+    {
+        release();
+    }
+    GpuProfiler(const GpuProfiler&) = delete;
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+    // reads back finished frames and opens the "frame" scope
+    // ------------------------------------------------------------------------
+    void beginFrame()
+    {
+        if (m_ring.empty())
+            m_ring.resize(m_frames);
+        if (m_frameIndex % CALIBRATION_INTERVAL == 0)
+            calibrate();
+        collect();
+
+        Frame& frame = m_ring[m_frameIndex % m_frames];
+        if (frame.pending)
+            m_droppedFrames++; // a full ring behind, its results are lost
+        frame.pending = false;
+        frame.usedQueries = 0;
+        frame.scopes.clear();
+        frame.index = m_frameIndex;
+        m_current = &frame;
+        begin("frame");
+    }
+    // ------------------------------------------------------------------------
+    void endFrame()
+    {
+        if (!m_current)
+            return;
+        while (!m_stack.empty()) // "frame", and whatever was left open
+            end();
+        m_current->pending = true;
+        m_current = nullptr;
+        m_frameIndex++;
+    }
+    // scopes outside beginFrame()/endFrame() are ignored
+    // ------------------------------------------------------------------------
+    void begin(const char* name)
+    {
+        if (!m_current)
+            return;
+        Scope scope;
+        scope.name = intern(name);
+        scope.depth = (uint32_t)m_stack.size();
+        scope.beginQuery = timestamp();
+        scope.endQuery = scope.beginQuery;
+        m_stack.push_back((uint32_t)m_current->scopes.size());
+        m_current->scopes.push_back(scope);
+    }
+    void end()
+    {
+        if (!m_current || m_stack.empty())
+            return;
+        m_current->scopes[m_stack.back()].endQuery = timestamp();
+        m_stack.pop_back();
+    }
+
+    // ------------------------------------------------------------------------
+    std::vector<GpuScopeStats> stats() const
+    {
+        std::vector<GpuScopeStats> result;
+        std::vector<float> sorted;
+        for (const Series& series : m_series)
+        {
+            GpuScopeStats stats = { series.name->c_str(), series.count, 0.0, 0.0, 0.0, 0.0 };
+            if (series.count)
+            {
+                sorted.assign(series.samples.begin(), series.samples.begin() + series.count);
+                std::sort(sorted.begin(), sorted.end());
+                double sum = 0.0;
+                for (float sample : sorted)
+                    sum += sample;
+                stats.mean = sum / series.count;
+                stats.p95 = sorted[std::min((size_t)(0.95 * series.count), sorted.size() - 1)];
+                stats.max = sorted.back();
+                stats.last = series.samples[(series.head + m_window - 1) % m_window];
+            }
+            result.push_back(stats);
+        }
+        return result;
+    }
+    // newest sample of one scope, 0 until it has one; no sorting, so cheap
+    // enough to read every frame
+    // ------------------------------------------------------------------------
+    double lastMilliseconds(const char* name) const
+    {
+        for (const Series& series : m_series)
+        {
+            if (series.count && *series.name == name)
+                return series.samples[(series.head + m_window - 1) % m_window];
+        }
+        return 0.0;
+    }
+    // one line per scope
+    // ------------------------------------------------------------------------
+    void writeCsv(std::ostream& out) const
+    {
+        out << "scope,samples,mean_ms,p95_ms,max_ms,last_ms\n";
+        for (const GpuScopeStats& stats : this->stats())
+        {
+            out << stats.name << "," << stats.samples << std::fixed << std::setprecision(4) << "," << stats.mean << ","
+                << stats.p95 << "," << stats.max << "," << stats.last << "\n";
+        }
+    }
+    // Appends the scopes finished since the last call. Nobody calling it is
+    // fine, only the newest TIMELINE_CAPACITY events are kept.
+    // ------------------------------------------------------------------------
+    void takeTimeline(std::vector<GpuTimelineEvent>& out)
+    {
+        out.insert(out.end(), m_timeline.begin(), m_timeline.end());
+        m_timeline.clear();
+    }
+    uint64_t droppedFrames() const { return m_droppedFrames; }
+
+    // ------------------------------------------------------------------------
+    void release()
+    {
+        for (Frame& frame : m_ring)
+        {
+            if (!frame.queries.empty())
+                GL_VERIFY(glDeleteQueries((GLsizei)frame.queries.size(), frame.queries.data()));
+        }
+        m_ring.clear();
+        m_stack.clear();
+        m_current = nullptr;
+    }
+
+private:
+    static const uint64_t CALIBRATION_INTERVAL = 256; // frames
+    static const size_t TIMELINE_CAPACITY = 65536;
+
+    struct Scope
+    {
+        uint32_t name;
+        uint32_t depth;
+        uint32_t beginQuery;
+        uint32_t endQuery;
+    };
+    struct Frame
+    {
+        std::vector<GLuint> queries;
+        uint32_t usedQueries = 0;
+        std::vector<Scope> scopes;
+        uint64_t index = 0;
+        bool pending = false; // ended, results not read yet
+    };
+    struct Series
+    {
+        const std::string* name;
+        std::vector<float> samples; // ring of the last m_window, ms
+        uint32_t head;
+        uint32_t count;
+    };
+
+    uint32_t m_frames;
+    uint32_t m_window;
+    std::vector<Frame> m_ring;
+    Frame* m_current = nullptr;
+    std::vector<uint32_t> m_stack;
+    uint64_t m_frameIndex = 0;
+    uint64_t m_droppedFrames = 0;
+
+    std::unordered_map<std::string, uint32_t> m_names;
+    std::vector<Series> m_series;
+    std::vector<GpuTimelineEvent> m_timeline;
+    int64_t m_gpuToCpu = 0; // add to a GL timestamp to get profilerNanoseconds()
+
+    // ------------------------------------------------------------------------
+    uint32_t intern(const char* name)
+    {
+        auto it = m_names.find(name);
+        if (it != m_names.end())
+            return it->second;
+        uint32_t id = (uint32_t)m_series.size();
+        it = m_names.emplace(name, id).first;
+        Series series;
+        series.name = &it->first; // node based, stays put
+        series.samples.resize(m_window);
+        series.head = series.count = 0;
+        m_series.push_back(series);
+        return id;
+    }
+    // ------------------------------------------------------------------------
+    uint32_t timestamp()
+    {
+        Frame& frame = *m_current;
+        if (frame.usedQueries == frame.queries.size())
+        {
+            size_t grown = std::max<size_t>(16, frame.queries.size() * 2);
+            size_t added = grown - frame.queries.size();
+            frame.queries.resize(grown);
+            GL_VERIFY(glGenQueries((GLsizei)added, &frame.queries[grown - added]));
+        }
+        uint32_t query = frame.usedQueries++;
+        GL_VERIFY(glQueryCounter(frame.queries[query], GL_TIMESTAMP));
+        return query;
+    }
+    // GL_TIMESTAMP reads the GPU clock without waiting for queued work
+    // ------------------------------------------------------------------------
+    void calibrate()
+    {
+        GLint64 gpu = 0;
+        uint64_t before = profilerNanoseconds();
+        glGetInteger64v(GL_TIMESTAMP, &gpu);
+        uint64_t after = profilerNanoseconds();
+        m_gpuToCpu = (int64_t)(before + (after - before) / 2) - (int64_t)gpu;
+    }
+    // oldest pending frames first, stops at the first that is not done
+    // ------------------------------------------------------------------------
+    void collect()
+    {
+        for (uint32_t age = m_frames; age > 0; age--)
+        {
+            if (m_frameIndex < age)
+                continue;
+            Frame& frame = m_ring[(m_frameIndex - age) % m_frames];
+            if (!frame.pending)
+                continue;
+            GLuint available = 0;
+            GL_VERIFY(glGetQueryObjectuiv(frame.queries[frame.usedQueries - 1], GL_QUERY_RESULT_AVAILABLE, &available));
+            if (!available)
+                return;
+            read(frame);
+            frame.pending = false;
+        }
+    }
+    // ------------------------------------------------------------------------
+    void read(const Frame& frame)
+    {
+        std::vector<GLuint64> times(frame.usedQueries);
+        for (uint32_t i = 0; i < frame.usedQueries; i++)
+            GL_VERIFY(glGetQueryObjectui64v(frame.queries[i], GL_QUERY_RESULT, &times[i]));
+        for (const Scope& scope : frame.scopes)
+        {
+            uint64_t begin = times[scope.beginQuery], end = std::max(times[scope.endQuery], begin);
+            Series& series = m_series[scope.name];
+            series.samples[series.head] = (float)((end - begin) / 1e6);
+            series.head = (series.head + 1) % m_window;
+            series.count = std::min(series.count + 1, m_window);
+
+            if (m_timeline.size() == TIMELINE_CAPACITY)
+                m_timeline.erase(m_timeline.begin(), m_timeline.begin() + TIMELINE_CAPACITY / 2);
+            GpuTimelineEvent event = { series.name->c_str(), scope.depth, frame.index,
+                (uint64_t)((int64_t)begin + m_gpuToCpu), (uint64_t)((int64_t)end + m_gpuToCpu) };
+            m_timeline.push_back(event);
+        }
+    }
+};
+
+// times the enclosing block on the GPU
+class GpuScope
+{
+public:
+    GpuScope(GpuProfiler& profiler, const char* name) : m_profiler(profiler)
+    {
+        m_profiler.begin(name);
+    }
+    ~GpuScope()
+    {
+        m_profiler.end();
+    }
+    GpuScope(const GpuScope&) = delete;
+    GpuScope& operator=(const GpuScope&) = delete;
+
+private:
+    GpuProfiler& m_profiler;
+};
+
+// Moves the GPU scopes finished since the last call into the running CPU
+// capture as a "GPU" track; without a capture they are dropped.
+// ----------------------------------------------------------------------------
+inline void captureGpuTimeline(GpuProfiler& gpu, CpuProfiler& cpu)
+{
+    std::vector<GpuTimelineEvent> timeline;
+    gpu.takeTimeline(timeline);
+    std::vector<ProfileEvent> events;
+    events.reserve(timeline.size());
+    for (const GpuTimelineEvent& scope : timeline)
+    {
+        ProfileEvent event = { scope.name, scope.beginNanoseconds, scope.endNanoseconds, scope.depth };
+        events.push_back(event);
+    }
+    cpu.addEvents("GPU", events.data(), events.size());
+}
+
+#endif
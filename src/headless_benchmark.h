@@ -0,0 +1,211 @@
+#ifndef HEADLESS_BENCHMARK_H
+#define HEADLESS_BENCHMARK_H
+
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <ostream>
+#include <iomanip>
+#include <utility>
+#include <algorithm>
+
+#include "cpu_profiler.h"
+#include "gpu_profiler.h"
+#include "gl_call_counters.h"
+
+// how long a scene runs
+struct HeadlessBenchmarkOptions
+{
+    uint32_t warmupFrames = 30;      // at least, and until the scene is ready()
+    uint32_t maxWarmupFrames = 3000; // a scene that never gets ready is measured anyway
+    uint32_t frames = 300;
+    float frameTime = 1.0f / 60.0f;  // scene time steps, fixed so every run draws the same
+    bool countCalls = true;          // GL call counts, an extra indirect call per GL call
+};
+
+// time in one profile zone name on one thread, or in one GPU scope on the
+// "GPU" track, over the measured frames
+struct BenchmarkPhase
+{
+    std::string thread;
+    std::string name;
+    uint64_t calls;
+    double milliseconds;
+};
+
+// What a scene run measured. A frame is timed from its first GL call to the
+// end of a glFinish after its last, so it holds the GPU work too.
+struct HeadlessBenchmarkResult
+{
+    std::string scene;
+    std::string renderer;
+    int width = 0;
+    int height = 0;
+    uint32_t warmupFrames = 0;
+    double setupMilliseconds = 0.0;  // constructing the scene, glFinish included
+    double warmupMilliseconds = 0.0; // the frames before measuring, until ready() for a loading scene
+    std::vector<double> frameMilliseconds;
+    std::vector<BenchmarkPhase> phases; // most expensive first
+    double callsPerFrame = 0.0;
+    double categoryCallsPerFrame[(size_t)GLCallCategory::Count] = {};
+
+    // p in [0, 1] of the measured frames, nearest rank
+    // ------------------------------------------------------------------------
+    double percentile(double p) const
+    {
+        if (frameMilliseconds.empty())
+            return 0.0;
+        std::vector<double> sorted(frameMilliseconds);
+        std::sort(sorted.begin(), sorted.end());
+        size_t rank = (size_t)(std::min(std::max(p, 0.0), 1.0) * (sorted.size() - 1) + 0.5);
+        return sorted[rank];
+    }
+    double mean() const
+    {
+        double sum = 0.0;
+        for (double ms : frameMilliseconds)
+            sum += ms;
+        return frameMilliseconds.empty() ? 0.0 : sum / frameMilliseconds.size();
+    }
+
+    // one JSON object
+    // ------------------------------------------------------------------------
+    void writeJson(std::ostream& out) const
+    {
+        size_t frames = std::max(frameMilliseconds.size(), (size_t)1);
+        out << std::fixed << std::setprecision(4);
+        out << "{\"scene\":";
+        writeJsonString(out, scene.c_str());
+        out << ",\"renderer\":";
+        writeJsonString(out, renderer.c_str());
+        out << ",\"width\":" << width << ",\"height\":" << height
+            << ",\"warmup_frames\":" << warmupFrames << ",\"frames\":" << frameMilliseconds.size()
+            << ",\"setup_ms\":" << setupMilliseconds << ",\"warmup_ms\":" << warmupMilliseconds;
+        out << ",\n \"frame_ms\":{\"mean\":" << mean() << ",\"min\":" << percentile(0.0) << ",\"p50\":" << percentile(0.5)
+            << ",\"p90\":" << percentile(0.9) << ",\"p95\":" << percentile(0.95) << ",\"p99\":" << percentile(0.99)
+            << ",\"max\":" << percentile(1.0) << "}";
+        out << ",\n \"phases\":[";
+        for (size_t i = 0; i < phases.size(); i++)
+        {
+            out << (i ? ",\n  " : "\n  ") << "{\"thread\":";
+            writeJsonString(out, phases[i].thread.c_str());
+            out << ",\"name\":";
+            writeJsonString(out, phases[i].name.c_str());
+            out << ",\"calls\":" << phases[i].calls << ",\"total_ms\":" << phases[i].milliseconds
+                << ",\"per_frame_ms\":" << phases[i].milliseconds / frames << "}";
+        }
+        out << "],\n \"gl_calls_per_frame\":{\"total\":" << callsPerFrame;
+        for (size_t c = 0; c < (size_t)GLCallCategory::Count; c++)
+            out << ",\"" << GLCallCounters::categoryName((GLCallCategory)c) << "\":" << categoryCallsPerFrame[c];
+        out << "}}";
+    }
+};
+
+// Runs a scene on the current context: constructs it from args, warms it up,
+// then measures options.frames frames into the bound framebuffer. A Scene
+// has
+//
+//     bool ready() const;                        // done loading, worth measuring
+//     void frame(GpuProfiler& gpu, float time);  // one frame's work after the clear
+//
+// Phases are the PROFILE_ZONEs of the measured frames per thread, the
+// calling thread named "main", and the GpuScopes read back meanwhile.
+// ----------------------------------------------------------------------------
+template<typename Scene, typename... Args>
+HeadlessBenchmarkResult runHeadlessBenchmark(const char* name, const HeadlessBenchmarkOptions& options, Args&&... args)
+{
+    HeadlessBenchmarkResult result;
+    result.scene = name;
+    result.renderer = (const char*)glGetString(GL_RENDERER);
+    GLint viewport[4] = { 0, 0, 0, 0 };
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    result.width = viewport[2];
+    result.height = viewport[3];
+
+    CpuProfiler& cpu = cpuProfiler();
+    cpu.setThreadName("main");
+    cpu.setEnabled(true);
+    GLCallCounters counters;
+    if (options.countCalls)
+        counters.install();
+    GpuProfiler gpu;
+
+    uint64_t setupStart = profilerNanoseconds();
+    Scene scene(std::forward<Args>(args)...);
+    glFinish();
+    result.setupMilliseconds = (profilerNanoseconds() - setupStart) / 1e6;
+
+    uint64_t totalCalls = 0;
+    uint64_t categoryCalls[(size_t)GLCallCategory::Count] = {};
+    uint32_t frame = 0;
+    uint32_t measured = 0;
+    while (measured < options.frames)
+    {
+        bool warm = frame >= options.warmupFrames && (scene.ready() || frame >= options.maxWarmupFrames);
+        if (warm && !measured && !cpu.capturing())
+        {
+            result.warmupFrames = frame;
+            result.warmupMilliseconds = (profilerNanoseconds() - setupStart) / 1e6 - result.setupMilliseconds;
+            cpu.startCapture();
+        }
+
+        uint64_t frameStart = profilerNanoseconds();
+        gpu.beginFrame();
+        {
+            PROFILE_ZONE("clear");
+            glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        }
+        scene.frame(gpu, frame * options.frameTime);
+        gpu.endFrame();
+        captureGpuTimeline(gpu, cpu);
+        {
+            PROFILE_ZONE("glFinish");
+            glFinish();
+        }
+        double milliseconds = (profilerNanoseconds() - frameStart) / 1e6;
+        cpu.endFrame();
+        counters.endFrame();
+        if (warm)
+        {
+            result.frameMilliseconds.push_back(milliseconds);
+            const GLFrameCalls& calls = counters.lastFrame();
+            totalCalls += calls.total;
+            for (size_t c = 0; c < (size_t)GLCallCategory::Count; c++)
+                categoryCalls[c] += calls.categories[c];
+            measured++;
+        }
+        frame++;
+    }
+
+    CpuCapture capture = cpu.stopCapture();
+    for (const ProfileTrack& track : capture.tracks)
+    {
+        size_t first = result.phases.size();
+        for (const ProfileEvent& event : track.events)
+        {
+            auto it = std::find_if(result.phases.begin() + first, result.phases.end(), [&event](const BenchmarkPhase& phase) {
+                return phase.name == event.name;
+            });
+            if (it == result.phases.end())
+            {
+                BenchmarkPhase phase = { track.name, event.name, 0, 0.0 };
+                result.phases.push_back(phase);
+                it = result.phases.end() - 1;
+            }
+            it->calls++;
+            it->milliseconds += (event.end - event.begin) / 1e6;
+        }
+    }
+    std::sort(result.phases.begin(), result.phases.end(), [](const BenchmarkPhase& a, const BenchmarkPhase& b) {
+        return a.milliseconds > b.milliseconds;
+    });
+    result.callsPerFrame = measured ? (double)totalCalls / measured : 0.0;
+    for (size_t c = 0; c < (size_t)GLCallCategory::Count; c++)
+        result.categoryCallsPerFrame[c] = measured ? (double)categoryCalls[c] / measured : 0.0;
+    return result;
+}
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef HEADLESS_CONTEXT_H
+#define HEADLESS_CONTEXT_H
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <glad/glad.h>
+
+#include <string>
+
+// A GL 3.3 core context without a window, for the Linux tools. EGL on
+// Mesa's surfaceless platform needs no display server and runs on
+// llvmpipe when there is no GPU; other EGL implementations get the
+// default display. There is no default framebuffer, so rendering goes to
+// framebuffer(), an RGBA8 + depth/stencil FBO bound on creation.
+class HeadlessContext
+{
+public:
+    HeadlessContext() {}
+    ~HeadlessContext()
+    {
+        release();
+    }
+    HeadlessContext(const HeadlessContext&) = delete;
+    HeadlessContext& operator=(const HeadlessContext&) = delete;
+
+    // makes the context current and loads glad; false with error() set
+    // ------------------------------------------------------------------------
+    bool create(int width, int height)
+    {
+        PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+            (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+        if (getPlatformDisplay)
+            m_display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        if (m_display == EGL_NO_DISPLAY)
+            m_display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        EGLint major = 0, minor = 0;
+        if (m_display == EGL_NO_DISPLAY || !eglInitialize(m_display, &major, &minor))
+            return fail("no EGL display");
+        if (!eglBindAPI(EGL_OPENGL_API))
+            return fail("EGL has no desktop OpenGL");
+
+        const EGLint configAttributes[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+        EGLConfig config = nullptr;
+        EGLint configs = 0;
+        eglChooseConfig(m_display, configAttributes, &config, 1, &configs); // none is fine with EGL_KHR_no_config_context
+        const EGLint contextAttributes[] = {
+            EGL_CONTEXT_MAJOR_VERSION, 3,
+            EGL_CONTEXT_MINOR_VERSION, 3,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE
+        };
+        m_context = eglCreateContext(m_display, configs ? config : EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, contextAttributes);
+        if (m_context == EGL_NO_CONTEXT)
+            return fail("cannot create a GL 3.3 core context");
+        if (!eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, m_context))
+            return fail("surfaceless contexts are not supported");
+        if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+            return fail("failed to initialize GLAD");
+
+        m_width = width;
+        m_height = height;
+        glGenRenderbuffers(2, m_renderbuffers);
+        glBindRenderbuffer(GL_RENDERBUFFER, m_renderbuffers[0]);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+        glBindRenderbuffer(GL_RENDERBUFFER, m_renderbuffers[1]);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+        glGenFramebuffers(1, &m_framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, m_framebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_renderbuffers[0]);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m_renderbuffers[1]);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+            return fail("incomplete framebuffer");
+        glViewport(0, 0, width, height);
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    GLuint framebuffer() const { return m_framebuffer; }
+    int width() const { return m_width; }
+    int height() const { return m_height; }
+    const std::string& error() const { return m_error; }
+    const char* renderer() const { return m_context ? (const char*)glGetString(GL_RENDERER) : ""; }
+
+    // ------------------------------------------------------------------------
+    void release()
+    {
+        if (m_framebuffer)
+        {
+            glDeleteFramebuffers(1, &m_framebuffer);
+            glDeleteRenderbuffers(2, m_renderbuffers);
+        }
+        m_framebuffer = m_renderbuffers[0] = m_renderbuffers[1] = 0;
+        if (m_context != EGL_NO_CONTEXT)
+        {
+            eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            eglDestroyContext(m_display, m_context);
+        }
+        if (m_display != EGL_NO_DISPLAY)
+            eglTerminate(m_display);
+        m_context = EGL_NO_CONTEXT;
+        m_display = EGL_NO_DISPLAY;
+    }
+
+private:
+    EGLDisplay m_display = EGL_NO_DISPLAY;
+    EGLContext m_context = EGL_NO_CONTEXT;
+    GLuint m_framebuffer = 0;
+    GLuint m_renderbuffers[2] = { 0, 0 };
+    int m_width = 0;
+    int m_height = 0;
+    std::string m_error;
+
+    // ------------------------------------------------------------------------
+    bool fail(const char* error)
+    {
+        m_error = error;
+        release();
+        return false;
+    }
+};
+
+#endif
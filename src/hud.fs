@@ -0,0 +1,14 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec2 texel;
+in vec4 color;
+
+uniform sampler2D atlas;
+
+void main()
+{
+    // texelFetch takes no filtering or sampler state, glyphs stay sharp at any scale
+    float coverage = texelFetch(atlas, ivec2(texel), 0).r;
+    FragColor = vec4(color.rgb, color.a * coverage);
+}
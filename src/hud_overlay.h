@@ -0,0 +1,295 @@
+#ifndef HUD_OVERLAY_H
+#define HUD_OVERLAY_H
+
+#include <glad/glad.h>
+
+#include <cstdio>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+#include "gl_verify.h"
+#include "gl_state_cache.h"
+#include "shader.h"
+#include "cpu_profiler.h"
+#include "gpu_profiler.h"
+#include "gl_call_counters.h"
+#include "gpu_memory.h"
+
+namespace hud
+{
+    // 3x5 pixel glyphs for ' ' to '_', row by row from the top, the top left
+    // pixel in bit 14. Lower case is drawn as upper case.
+    static const uint16_t GLYPHS[64] = {
+        0x0000, 0x2482, 0x5a00, 0x5f7d, 0x3c9e, 0x52a5, 0x2aab, 0x2400, //  !"#$%&'
+        0x1491, 0x4494, 0x0aa8, 0x05d0, 0x0014, 0x01c0, 0x0002, 0x12a4, // ()*+,-./
+        0x7b6f, 0x2c97, 0x73e7, 0x73cf, 0x5bc9, 0x79cf, 0x79ef, 0x7252, // 01234567
+        0x7bef, 0x7bcf, 0x0410, 0x0414, 0x1511, 0x0e38, 0x4454, 0x7282, // 89:;<=>?
+        0x2be3, 0x2bed, 0x6bae, 0x3923, 0x6b6e, 0x79a7, 0x79a4, 0x396b, // @ABCDEFG
+        0x5bed, 0x7497, 0x126a, 0x5bad, 0x4927, 0x5fed, 0x6b6d, 0x2b6a, // HIJKLMNO
+        0x6ba4, 0x2b73, 0x6bad, 0x388e, 0x7492, 0x5b6f, 0x5b6a, 0x5bfd, // PQRSTUVW
+        0x5aad, 0x5a92, 0x72a7, 0x6926, 0x4889, 0x324b, 0x2a00, 0x0007, // XYZ[\]^_
+    };
+
+    // the atlas is a grid of 4x6 cells, a glyph and a texel of spacing each;
+    // the cell after the glyphs is solid, for bars and backgrounds
+    static const int CELL_WIDTH = 4;
+    static const int CELL_HEIGHT = 6;
+    static const int ATLAS_COLUMNS = 16;
+    static const int SOLID_CELL = 64;
+    static const int ATLAS_WIDTH = ATLAS_COLUMNS * CELL_WIDTH;
+    static const int ATLAS_HEIGHT = (SOLID_CELL / ATLAS_COLUMNS + 1) * CELL_HEIGHT;
+
+    // RGBA8 as the vertex attribute reads it
+    // ------------------------------------------------------------------------
+    inline uint32_t rgba(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255)
+    {
+        return (uint32_t)r | (uint32_t)g << 8 | (uint32_t)b << 16 | (uint32_t)a << 24;
+    }
+}
+
+// pixels from the top left of the window, atlas texels
+struct HudVertex
+{
+    float x, y;
+    float u, v;
+    uint32_t color;
+};
+
+// Frame time, GPU time, GL calls and GPU memory drawn over the scene: a bar
+// graph of the last HISTORY frame intervals with the GPU time of each frame
+// over it, and a few lines of counters. Text and graph are quads into one
+// streamed vertex buffer, drawn with a single glDrawElements from a static
+// index buffer; glyphs come from a small atlas built from an embedded 3x5
+// font and are read with texelFetch, so no sampler state is involved.
+//
+// update() reads the profilers and counters and builds the quads, draw()
+// uploads them and draws over whatever framebuffer is bound. draw() binds
+// through the scene's GLStateCache, so nothing is queried or put back;
+// blending is on for its draw only.
+class HudOverlay
+{
+public:
+    static const uint32_t HISTORY = 128;  // frames in the graph
+    static const uint32_t MAX_QUADS = 1024;
+
+    HudOverlay() : m_shader("hud.vs", "hud.fs") {}
+    ~HudOverlay()
+    {
+        release();
+    }
+    HudOverlay(const HudOverlay&) = delete;
+    HudOverlay& operator=(const HudOverlay&) = delete;
+
+    // the draw counts are the previous frame's, GLCallCounters closes a frame
+    // after the swap
+    // ------------------------------------------------------------------------
+    void update(const GpuProfiler& gpu, const GLCallCounters& calls, const GpuMemoryRegistry& memory)
+    {
+        uint64_t now = profilerNanoseconds();
+        float frameMilliseconds = m_lastUpdate ? (float)((now - m_lastUpdate) / 1e6) : 0.0f;
+        float gpuMilliseconds = (float)gpu.lastMilliseconds("frame");
+        m_lastUpdate = now;
+        m_frameHistory[m_head] = frameMilliseconds;
+        m_gpuHistory[m_head] = gpuMilliseconds;
+        m_head = (m_head + 1) % HISTORY;
+        m_count = m_count < HISTORY ? m_count + 1 : HISTORY;
+
+        // frame rate over the graph, one slow frame would make it jump around
+        float sum = 0.0f;
+        for (uint32_t i = 0; i < m_count; i++)
+            sum += m_frameHistory[i];
+        float fps = sum > 0.0f ? 1000.0f * m_count / sum : 0.0f;
+
+        const float PADDING = 6.0f;
+        const float SCALE = 2.0f;
+        const float LINE = (hud::CELL_HEIGHT + 1) * SCALE;
+        const float GRAPH_WIDTH = 2.0f * HISTORY;
+        const float GRAPH_HEIGHT = 64.0f;
+        const float BUDGET = 1000.0f / 60.0f; // ms, the graph goes to twice that
+
+        m_vertices.clear();
+        float left = PADDING, top = PADDING;
+        float x = left + PADDING, y = top + PADDING;
+        quad(left, top, GRAPH_WIDTH + 2.0f * PADDING, 4.0f * LINE + GRAPH_HEIGHT + 3.0f * PADDING, hud::rgba(0, 0, 0, 160));
+
+        char line[64];
+        uint32_t white = hud::rgba(255, 255, 255);
+        snprintf(line, sizeof(line), "FRAME %6.2f MS %5.0f FPS", frameMilliseconds, fps);
+        text(x, y, SCALE, line, white);
+        snprintf(line, sizeof(line), "GPU   %6.2f MS", gpuMilliseconds);
+        text(x, y + LINE, SCALE, line, hud::rgba(96, 200, 255));
+        snprintf(line, sizeof(line), "DRAWS %u  GL CALLS %u", calls.lastFrame()[GLCallCategory::Draw], calls.lastFrame().total);
+        text(x, y + 2.0f * LINE, SCALE, line, white);
+        snprintf(line, sizeof(line), "GPU MEM %.1f MB  PEAK %.1f", memory.bytes() / 1048576.0, memory.peakBytes() / 1048576.0);
+        text(x, y + 3.0f * LINE, SCALE, line, white);
+
+        // oldest frame on the left
+        float bottom = y + 4.0f * LINE + PADDING + GRAPH_HEIGHT;
+        float pixelsPerMillisecond = GRAPH_HEIGHT / (2.0f * BUDGET);
+        for (uint32_t i = 0; i < m_count; i++)
+        {
+            uint32_t sample = (m_head + HISTORY - m_count + i) % HISTORY;
+            float barX = x + 2.0f * (HISTORY - m_count + i);
+            float frame = std::min(m_frameHistory[sample], 2.0f * BUDGET);
+            float gpuTime = std::min(m_gpuHistory[sample], 2.0f * BUDGET);
+            uint32_t color = frame <= BUDGET * 1.05f ? hud::rgba(80, 220, 80) : frame < 2.0f * BUDGET ? hud::rgba(240, 200, 60)
+                : hud::rgba(240, 70, 60);
+            quad(barX, bottom - frame * pixelsPerMillisecond, 2.0f, frame * pixelsPerMillisecond, color);
+            quad(barX, bottom - gpuTime * pixelsPerMillisecond, 2.0f, gpuTime * pixelsPerMillisecond, hud::rgba(96, 200, 255, 180));
+        }
+        quad(x, bottom - BUDGET * pixelsPerMillisecond, GRAPH_WIDTH, 1.0f, hud::rgba(255, 255, 255, 128));
+    }
+
+    // draws the quads of the last update() over a width x height framebuffer
+    // ------------------------------------------------------------------------
+    void draw(GLStateCache& state, int width, int height)
+    {
+        if (m_vertices.empty() || width <= 0 || height <= 0)
+            return;
+        ensureObjects(state);
+
+        // respecified at the used size every frame: one transfer, and the
+        // driver hands out fresh storage if it is still reading the last one
+        GL_VERIFY(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
+        GL_VERIFY(glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(m_vertices.size() * sizeof(HudVertex)), m_vertices.data(), GL_STREAM_DRAW));
+
+        state.useProgram(m_shader.ID);
+        GL_VERIFY(glUniform2f(m_screenSizeLocation, (float)width, (float)height));
+        state.bindVertexArray(m_vertexArray);
+        state.bindTexture(0, GL_TEXTURE_2D, m_atlas);
+        // a sampler object on the unit would make the atlas incomplete
+        state.bindSampler(0, 0);
+        GL_VERIFY(glEnable(GL_BLEND));
+        GL_VERIFY(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+        GL_VERIFY(glDrawElements(GL_TRIANGLES, (GLsizei)(m_vertices.size() / 4 * 6), GL_UNSIGNED_SHORT, nullptr));
+        GL_VERIFY(glDisable(GL_BLEND));
+    }
+
+    // ------------------------------------------------------------------------
+    uint32_t quadCount() const { return (uint32_t)(m_vertices.size() / 4); }
+
+    // ------------------------------------------------------------------------
+    void release()
+    {
+        if (m_vertexArray)
+            GL_VERIFY(glDeleteVertexArrays(1, &m_vertexArray));
+        if (m_vertexBuffer)
+            GL_VERIFY(glDeleteBuffers(1, &m_vertexBuffer));
+        if (m_indexBuffer)
+            GL_VERIFY(glDeleteBuffers(1, &m_indexBuffer));
+        if (m_atlas)
+            GL_VERIFY(glDeleteTextures(1, &m_atlas));
+        if (m_shader.ID)
+            GL_VERIFY(glDeleteProgram(m_shader.ID));
+        m_shader.ID = 0;
+        m_vertexArray = m_vertexBuffer = m_indexBuffer = m_atlas = 0;
+    }
+
+private:
+    Shader m_shader;
+    GLint m_screenSizeLocation = -1;
+    GLuint m_vertexArray = 0;
+    GLuint m_vertexBuffer = 0;
+    GLuint m_indexBuffer = 0;
+    GLuint m_atlas = 0;
+    std::vector<HudVertex> m_vertices;
+
+    uint64_t m_lastUpdate = 0;
+    float m_frameHistory[HISTORY] = {}; // ms, ring
+    float m_gpuHistory[HISTORY] = {};
+    uint32_t m_head = 0;
+    uint32_t m_count = 0;
+
+    // one quad, all four corners on the same texel for a solid one
+    // ------------------------------------------------------------------------
+    void quad(float x, float y, float width, float height, uint32_t color, float u = -1.0f, float v = 0.0f,
+        float texelsWide = 0.0f, float texelsHigh = 0.0f)
+    {
+        if (m_vertices.size() + 4 > (size_t)MAX_QUADS * 4)
+            return;
+        if (u < 0.0f)
+        {
+            u = (hud::SOLID_CELL % hud::ATLAS_COLUMNS) * hud::CELL_WIDTH + 0.5f;
+            v = (hud::SOLID_CELL / hud::ATLAS_COLUMNS) * hud::CELL_HEIGHT + 0.5f;
+        }
+        m_vertices.push_back({ x, y, u, v, color });
+        m_vertices.push_back({ x + width, y, u + texelsWide, v, color });
+        m_vertices.push_back({ x + width, y + height, u + texelsWide, v + texelsHigh, color });
+        m_vertices.push_back({ x, y + height, u, v + texelsHigh, color });
+    }
+    // scale screen pixels per font pixel, spaces cost no quad
+    // ------------------------------------------------------------------------
+    void text(float x, float y, float scale, const char* string, uint32_t color)
+    {
+        for (; *string; string++, x += hud::CELL_WIDTH * scale)
+        {
+            int c = *string >= 'a' && *string <= 'z' ? *string - 'a' + 'A' : *string;
+            if (c == ' ')
+                continue;
+            int cell = c > ' ' && c <= '_' ? c - ' ' : '?' - ' ';
+            float u = (float)(cell % hud::ATLAS_COLUMNS * hud::CELL_WIDTH);
+            float v = (float)(cell / hud::ATLAS_COLUMNS * hud::CELL_HEIGHT);
+            quad(x, y, 3.0f * scale, 5.0f * scale, color, u, v, 3.0f, 5.0f);
+        }
+    }
+    // ------------------------------------------------------------------------
+    void ensureObjects(GLStateCache& state)
+    {
+        if (m_vertexArray)
+            return;
+        m_screenSizeLocation = glGetUniformLocation(m_shader.ID, "screenSize");
+        state.useProgram(m_shader.ID);
+        GL_VERIFY(glUniform1i(glGetUniformLocation(m_shader.ID, "atlas"), 0));
+
+        std::vector<uint8_t> texels(hud::ATLAS_WIDTH * hud::ATLAS_HEIGHT, 0);
+        for (int cell = 0; cell < 64; cell++)
+        {
+            int cellX = cell % hud::ATLAS_COLUMNS * hud::CELL_WIDTH;
+            int cellY = cell / hud::ATLAS_COLUMNS * hud::CELL_HEIGHT;
+            for (int bit = 0; bit < 15; bit++)
+            {
+                if (hud::GLYPHS[cell] & (0x4000 >> bit))
+                    texels[(cellY + bit / 3) * hud::ATLAS_WIDTH + cellX + bit % 3] = 255;
+            }
+        }
+        int solidX = hud::SOLID_CELL % hud::ATLAS_COLUMNS * hud::CELL_WIDTH;
+        int solidY = hud::SOLID_CELL / hud::ATLAS_COLUMNS * hud::CELL_HEIGHT;
+        for (int y = 0; y < hud::CELL_HEIGHT; y++)
+            std::fill_n(&texels[(solidY + y) * hud::ATLAS_WIDTH + solidX], hud::CELL_WIDTH, (uint8_t)255);
+        GL_VERIFY(glGenTextures(1, &m_atlas));
+        state.bindTexture(0, GL_TEXTURE_2D, m_atlas);
+        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0));
+        GL_VERIFY(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+        GL_VERIFY(glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, hud::ATLAS_WIDTH, hud::ATLAS_HEIGHT, 0, GL_RED, GL_UNSIGNED_BYTE, texels.data()));
+        GL_VERIFY(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+
+        // every quad is two triangles of its own four vertices
+        std::vector<GLushort> indices(MAX_QUADS * 6);
+        for (uint32_t i = 0; i < MAX_QUADS; i++)
+        {
+            GLushort first = (GLushort)(i * 4);
+            GLushort quadIndices[6] = { first, (GLushort)(first + 1), (GLushort)(first + 2), first, (GLushort)(first + 2),
+                (GLushort)(first + 3) };
+            std::copy(quadIndices, quadIndices + 6, &indices[i * 6]);
+        }
+        GL_VERIFY(glGenVertexArrays(1, &m_vertexArray));
+        GL_VERIFY(glGenBuffers(1, &m_vertexBuffer));
+        GL_VERIFY(glGenBuffers(1, &m_indexBuffer));
+        state.bindVertexArray(m_vertexArray);
+        GL_VERIFY(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
+        GL_VERIFY(glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)(indices.size() * sizeof(GLushort)), indices.data(), GL_STATIC_DRAW));
+        GL_VERIFY(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
+        GL_VERIFY(glEnableVertexAttribArray(0));
+        GL_VERIFY(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(HudVertex), (void*)offsetof(HudVertex, x)));
+        GL_VERIFY(glEnableVertexAttribArray(1));
+        GL_VERIFY(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(HudVertex), (void*)offsetof(HudVertex, u)));
+        GL_VERIFY(glEnableVertexAttribArray(2));
+        GL_VERIFY(glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(HudVertex), (void*)offsetof(HudVertex, color)));
+    }
+};
+
+#endif
@@ -0,0 +1,457 @@
+#ifndef IMAGE_RESAMPLER_H
+#define IMAGE_RESAMPLER_H
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+#include "cpu_features.h"
+#include "thread_pool.h"
+#include "texture_upload.h"
+
+// Separable image resampler for 8 bit images of 1, 2 or 4 channels.
+//
+// Pixels are widened to four floats, filtered horizontally into a band of
+// rows and then vertically, one SIMD register per pixel (two with AVX2 in
+// the vertical pass). sRGB images are filtered in linear light and alpha
+// images premultiplied, so neither dark halos nor colour bleeding from
+// transparent texels show up in the smaller levels. Output rows are split
+// over a ThreadPool when one is given.
+//
+// The texture streamer uses it to scale images down to the quality tier and
+// to build mip chains on its workers.
+
+enum class ResampleFilter
+{
+    Box,      // 2x2 average at 2:1, the old downsampleRGBA
+    Triangle,
+    Lanczos3, // sharpest, rings a little on hard edges
+    Kaiser,   // Kaiser windowed sinc, softer than Lanczos with less ringing
+};
+
+struct ResampleOptions
+{
+    ResampleFilter filter = ResampleFilter::Lanczos3;
+    ColorSpace colorSpace = ColorSpace::Linear; // sRGB: colour channels filtered in linear light
+    int alphaChannel = -1;                      // premultiplied while filtering, -1 for none
+};
+
+// What the streamer scales textures to. Each tier drops mip levels from every
+// texture and caps the largest dimension.
+enum class TextureQuality
+{
+    Low,
+    Medium,
+    High,
+    Full, // source resolution, only limited by GL_MAX_TEXTURE_SIZE
+};
+
+namespace resample
+{
+    static const int BAND_ROWS = 64; // output rows filtered together
+    static const int LINEAR_STEPS = 16384;
+
+    // byte <-> float tables, built once
+    struct SrgbTables
+    {
+        float toLinear[256];
+        uint8_t toSrgb[LINEAR_STEPS + 1];
+
+        SrgbTables()
+        {
+            for (int i = 0; i < 256; i++)
+            {
+                double c = i / 255.0;
+                toLinear[i] = (float)(c <= 0.04045 ? c / 12.92 : pow((c + 0.055) / 1.055, 2.4));
+            }
+            for (int i = 0; i <= LINEAR_STEPS; i++)
+            {
+                double l = (double)i / LINEAR_STEPS;
+                double c = l <= 0.0031308 ? l * 12.92 : 1.055 * pow(l, 1.0 / 2.4) - 0.055;
+                toSrgb[i] = (uint8_t)(c * 255.0 + 0.5);
+            }
+        }
+    };
+    inline const SrgbTables& srgbTables()
+    {
+        static const SrgbTables tables;
+        return tables;
+    }
+
+    // ------------------------------------------------------------------------
+    inline double sinc(double x)
+    {
+        x *= 3.14159265358979323846;
+        return fabs(x) < 1e-9 ? 1.0 : sin(x) / x;
+    }
+    // modified Bessel function of the first kind, order 0
+    inline double besselI0(double x)
+    {
+        double sum = 1.0, term = 1.0;
+        for (int k = 1; k < 32; k++)
+        {
+            term *= (x / (2.0 * k)) * (x / (2.0 * k));
+            sum += term;
+            if (term < sum * 1e-12)
+                break;
+        }
+        return sum;
+    }
+    inline double filterRadius(ResampleFilter filter)
+    {
+        switch (filter)
+        {
+        case ResampleFilter::Box: return 0.5;
+        case ResampleFilter::Triangle: return 1.0;
+        case ResampleFilter::Lanczos3: return 3.0;
+        case ResampleFilter::Kaiser: return 3.0;
+        }
+        return 1.0;
+    }
+    inline double evaluateFilter(ResampleFilter filter, double x)
+    {
+        const double KAISER_BETA = 4.0;
+        double radius = filterRadius(filter);
+        switch (filter)
+        {
+        case ResampleFilter::Box:
+            return x >= -0.5 && x < 0.5 ? 1.0 : 0.0;
+        case ResampleFilter::Triangle:
+            return std::max(0.0, 1.0 - fabs(x));
+        case ResampleFilter::Lanczos3:
+            return fabs(x) < radius ? sinc(x) * sinc(x / radius) : 0.0;
+        case ResampleFilter::Kaiser:
+        {
+            if (fabs(x) >= radius)
+                return 0.0;
+            double t = x / radius;
+            return sinc(x) * besselI0(KAISER_BETA * sqrt(1.0 - t * t)) / besselI0(KAISER_BETA);
+        }
+        }
+        return 0.0;
+    }
+
+    // Source texels and weights for every output texel along one axis. The
+    // filter is widened by the scale factor when minifying; taps past the
+    // edge are dropped and the rest renormalized.
+    struct Contributions
+    {
+        int taps = 0;               // weights stored per output texel
+        std::vector<int> first;     // first source texel
+        std::vector<int> count;     // texels actually used
+        std::vector<float> weights; // taps per output texel
+    };
+    // ------------------------------------------------------------------------
+    inline Contributions computeContributions(int source, int target, ResampleFilter filter)
+    {
+        Contributions c;
+        double scale = (double)target / source;
+        double stretch = scale < 1.0 ? 1.0 / scale : 1.0;
+        double radius = filterRadius(filter) * stretch;
+        c.taps = (int)ceil(radius * 2.0) + 2;
+        c.first.resize(target);
+        c.count.resize(target);
+        c.weights.assign((size_t)target * c.taps, 0.0f);
+
+        std::vector<double> weights(c.taps);
+        for (int o = 0; o < target; o++)
+        {
+            double center = (o + 0.5) / scale - 0.5;
+            int lo = std::max(0, (int)floor(center - radius));
+            int hi = std::min(source - 1, (int)ceil(center + radius));
+            hi = std::min(hi, lo + c.taps - 1);
+            double sum = 0.0;
+            for (int i = lo; i <= hi; i++)
+            {
+                weights[i - lo] = evaluateFilter(filter, (i - center) / stretch);
+                sum += weights[i - lo];
+            }
+            if (fabs(sum) < 1e-9)
+            {
+                // nothing in reach, take the nearest texel
+                lo = hi = std::min(source - 1, std::max(0, (int)floor(center + 0.5)));
+                weights[0] = sum = 1.0;
+            }
+            c.first[o] = lo;
+            c.count[o] = hi - lo + 1;
+            for (int i = 0; i < c.count[o]; i++)
+                c.weights[(size_t)o * c.taps + i] = (float)(weights[i] / sum);
+        }
+        return c;
+    }
+
+    // 8 bit texels to four floats each, linear and premultiplied
+    // ------------------------------------------------------------------------
+    inline void decodeRow(const uint8_t* source, int width, int channels, const ResampleOptions& options, float* out)
+    {
+        const float* toLinear = srgbTables().toLinear;
+        bool srgb = options.colorSpace == ColorSpace::sRGB;
+        int alpha = options.alphaChannel;
+        for (int x = 0; x < width; x++, source += channels, out += 4)
+        {
+            for (int c = 0; c < 4; c++)
+            {
+                if (c >= channels)
+                    out[c] = 0.0f;
+                else if (srgb && c != alpha)
+                    out[c] = toLinear[source[c]];
+                else
+                    out[c] = source[c] * (1.0f / 255.0f);
+            }
+            if (alpha >= 0)
+            {
+                for (int c = 0; c < channels; c++)
+                {
+                    if (c != alpha)
+                        out[c] *= out[alpha];
+                }
+            }
+        }
+    }
+    // back to 8 bit, undoing the premultiply; filters with negative lobes
+    // overshoot, so everything is clamped
+    // ------------------------------------------------------------------------
+    inline void encodeRow(const float* in, int width, int channels, const ResampleOptions& options, uint8_t* target)
+    {
+        const uint8_t* toSrgb = srgbTables().toSrgb;
+        bool srgb = options.colorSpace == ColorSpace::sRGB;
+        int alpha = options.alphaChannel;
+        for (int x = 0; x < width; x++, in += 4, target += channels)
+        {
+            float scale = 1.0f;
+            if (alpha >= 0)
+                scale = in[alpha] > 0.5f / 255.0f ? 1.0f / in[alpha] : 0.0f;
+            for (int c = 0; c < channels; c++)
+            {
+                float v = c == alpha ? in[c] : in[c] * scale;
+                v = std::min(1.0f, std::max(0.0f, v));
+                if (srgb && c != alpha)
+                    target[c] = toSrgb[(int)(v * LINEAR_STEPS + 0.5f)];
+                else
+                    target[c] = (uint8_t)(v * 255.0f + 0.5f);
+            }
+        }
+    }
+
+    // one row of the band: each output texel a weighted sum of source texels
+    // ------------------------------------------------------------------------
+    inline void filterRow(const float* source, const Contributions& c, int width, float* out)
+    {
+        for (int o = 0; o < width; o++)
+        {
+            const float* weights = &c.weights[(size_t)o * c.taps];
+            const float* texel = source + (size_t)c.first[o] * 4;
+#ifdef CPU_HAS_SSE2
+            __m128 sum = _mm_setzero_ps();
+            for (int k = 0; k < c.count[o]; k++)
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(weights[k]), _mm_loadu_ps(texel + k * 4)));
+            _mm_storeu_ps(out + (size_t)o * 4, sum);
+#else
+            float sum[4] = {};
+            for (int k = 0; k < c.count[o]; k++)
+            {
+                for (int j = 0; j < 4; j++)
+                    sum[j] += weights[k] * texel[k * 4 + j];
+            }
+            memcpy(out + (size_t)o * 4, sum, sizeof(sum));
+#endif
+        }
+    }
+    // one output row from `count` band rows `stride` floats apart
+    // ------------------------------------------------------------------------
+    inline void filterColumnScalar(const float* rows, size_t stride, const float* weights, int count, size_t floats, float* out)
+    {
+        for (size_t i = 0; i < floats; i++)
+        {
+            float sum = 0.0f;
+            for (int k = 0; k < count; k++)
+                sum += weights[k] * rows[k * stride + i];
+            out[i] = sum;
+        }
+    }
+#ifdef CPU_HAS_SSE2
+    // two pixels per step
+    // ------------------------------------------------------------------------
+    inline void filterColumnSSE2(const float* rows, size_t stride, const float* weights, int count, size_t floats, float* out)
+    {
+        size_t i = 0;
+        for (; i + 8 <= floats; i += 8)
+        {
+            __m128 a = _mm_setzero_ps(), b = _mm_setzero_ps();
+            for (int k = 0; k < count; k++)
+            {
+                __m128 w = _mm_set1_ps(weights[k]);
+                a = _mm_add_ps(a, _mm_mul_ps(w, _mm_loadu_ps(rows + k * stride + i)));
+                b = _mm_add_ps(b, _mm_mul_ps(w, _mm_loadu_ps(rows + k * stride + i + 4)));
+            }
+            _mm_storeu_ps(out + i, a);
+            _mm_storeu_ps(out + i + 4, b);
+        }
+        for (; i < floats; i += 4)
+        {
+            __m128 a = _mm_setzero_ps();
+            for (int k = 0; k < count; k++)
+                a = _mm_add_ps(a, _mm_mul_ps(_mm_set1_ps(weights[k]), _mm_loadu_ps(rows + k * stride + i)));
+            _mm_storeu_ps(out + i, a);
+        }
+    }
+    // four pixels per step
+    // ------------------------------------------------------------------------
+    TARGET_AVX2 inline void filterColumnAVX2(const float* rows, size_t stride, const float* weights, int count, size_t floats, float* out)
+    {
+        size_t i = 0;
+        for (; i + 16 <= floats; i += 16)
+        {
+            __m256 a = _mm256_setzero_ps(), b = _mm256_setzero_ps();
+            for (int k = 0; k < count; k++)
+            {
+                __m256 w = _mm256_set1_ps(weights[k]);
+                a = _mm256_fmadd_ps(w, _mm256_loadu_ps(rows + k * stride + i), a);
+                b = _mm256_fmadd_ps(w, _mm256_loadu_ps(rows + k * stride + i + 8), b);
+            }
+            _mm256_storeu_ps(out + i, a);
+            _mm256_storeu_ps(out + i + 8, b);
+        }
+        filterColumnSSE2(rows + i, stride, weights, count, floats - i, out + i);
+    }
+#endif
+
+    // output rows [rowBegin, rowEnd): filters the source rows they reach
+    // horizontally into a band, then down the columns
+    // ------------------------------------------------------------------------
+    inline void resampleBand(const uint8_t* source, int sourceWidth, uint8_t* target, int targetWidth, int channels,
+        const ResampleOptions& options, const Contributions& horizontal, const Contributions& vertical, int rowBegin, int rowEnd)
+    {
+        int firstRow = vertical.first[rowBegin];
+        int lastRow = firstRow;
+        for (int y = rowBegin; y < rowEnd; y++)
+            lastRow = std::max(lastRow, vertical.first[y] + vertical.count[y] - 1);
+
+        size_t stride = (size_t)targetWidth * 4;
+        std::vector<float> decoded((size_t)sourceWidth * 4);
+        std::vector<float> band(stride * (lastRow - firstRow + 1));
+        for (int y = firstRow; y <= lastRow; y++)
+        {
+            decodeRow(source + (size_t)y * sourceWidth * channels, sourceWidth, channels, options, decoded.data());
+            filterRow(decoded.data(), horizontal, targetWidth, &band[(y - firstRow) * stride]);
+        }
+
+#ifdef CPU_HAS_SSE2
+        // filterColumnAVX2 accumulates with FMA, which AVX2 alone does not imply
+        bool avx2 = cpuFeatures().avx2 && cpuFeatures().fma;
+#endif
+        std::vector<float> row(stride);
+        for (int y = rowBegin; y < rowEnd; y++)
+        {
+            const float* rows = &band[(vertical.first[y] - firstRow) * stride];
+            const float* weights = &vertical.weights[(size_t)y * vertical.taps];
+#ifdef CPU_HAS_SSE2
+            if (avx2)
+                filterColumnAVX2(rows, stride, weights, vertical.count[y], stride, row.data());
+            else
+                filterColumnSSE2(rows, stride, weights, vertical.count[y], stride, row.data());
+#else
+            filterColumnScalar(rows, stride, weights, vertical.count[y], stride, row.data());
+#endif
+            encodeRow(row.data(), targetWidth, channels, options, target + (size_t)y * targetWidth * channels);
+        }
+    }
+}
+
+// Scales an image of 1, 2 or 4 channels to any size, up or down.
+// ----------------------------------------------------------------------------
+inline void resampleImage(const uint8_t* source, int sourceWidth, int sourceHeight, uint8_t* target, int targetWidth, int targetHeight,
+    int channels, const ResampleOptions& options, ThreadPool* pool = nullptr)
+{
+    resample::Contributions horizontal = resample::computeContributions(sourceWidth, targetWidth, options.filter);
+    resample::Contributions vertical = resample::computeContributions(sourceHeight, targetHeight, options.filter);
+    uint32_t bands = (uint32_t)(targetHeight + resample::BAND_ROWS - 1) / resample::BAND_ROWS;
+    auto run = [&](uint32_t begin, uint32_t end) {
+        for (uint32_t band = begin; band < end; band++)
+        {
+            int rowBegin = (int)band * resample::BAND_ROWS;
+            int rowEnd = std::min(targetHeight, rowBegin + resample::BAND_ROWS);
+            resample::resampleBand(source, sourceWidth, target, targetWidth, channels, options, horizontal, vertical, rowBegin, rowEnd);
+        }
+    };
+    if (pool && bands > 1)
+        pool->parallelFor(bands, 1, run);
+    else
+        run(0, bands);
+}
+
+// Bytes of a full mip chain, level 0 included, levels packed back to back
+// ----------------------------------------------------------------------------
+inline size_t mipChainBytes(int width, int height, int channels)
+{
+    size_t bytes = 0;
+    for (;;)
+    {
+        bytes += (size_t)width * height * channels;
+        if (width == 1 && height == 1)
+            return bytes;
+        width = std::max(1, width / 2);
+        height = std::max(1, height / 2);
+    }
+}
+// Writes levels 1 and down to 1x1 to out, back to back, each one filtered
+// from the level above. Nothing is read back from out, so it may be a
+// mapped buffer.
+// ----------------------------------------------------------------------------
+inline void buildMipChain(const uint8_t* level0, int width, int height, int channels, const ResampleOptions& options,
+    uint8_t* out, ThreadPool* pool = nullptr)
+{
+    std::vector<uint8_t> above(level0, level0 + (size_t)width * height * channels);
+    std::vector<uint8_t> level;
+    while (width > 1 || height > 1)
+    {
+        int nextWidth = std::max(1, width / 2);
+        int nextHeight = std::max(1, height / 2);
+        level.resize((size_t)nextWidth * nextHeight * channels);
+        resampleImage(above.data(), width, height, level.data(), nextWidth, nextHeight, channels, options, pool);
+        memcpy(out, level.data(), level.size());
+        out += level.size();
+        above.swap(level);
+        width = nextWidth;
+        height = nextHeight;
+    }
+}
+
+// Size a texture is loaded at: the tier's halvings, then the larger side
+// capped by the tier and by what the driver allows (0 for no limit).
+// ----------------------------------------------------------------------------
+inline void qualityTargetSize(int width, int height, TextureQuality quality, int maxTextureSize, int& outWidth, int& outHeight)
+{
+    static const int HALVINGS[] = { 2, 1, 0, 0 };
+    static const int MAX_DIMENSION[] = { 1024, 2048, 4096, 0 };
+    int shift = HALVINGS[(int)quality];
+    int limit = MAX_DIMENSION[(int)quality];
+    if (maxTextureSize > 0)
+        limit = limit > 0 ? std::min(limit, maxTextureSize) : maxTextureSize;
+
+    outWidth = std::max(1, width >> shift);
+    outHeight = std::max(1, height >> shift);
+    int largest = std::max(outWidth, outHeight);
+    if (limit > 0 && largest > limit)
+    {
+        outWidth = std::max(1, (int)((int64_t)outWidth * limit / largest));
+        outHeight = std::max(1, (int)((int64_t)outHeight * limit / largest));
+    }
+}
+// premultiplied alpha and colour space for pixels in an upload layout
+// ----------------------------------------------------------------------------
+inline ResampleOptions resampleOptionsFor(const UploadFormat& upload, ColorSpace colorSpace, ResampleFilter filter)
+{
+    ResampleOptions options;
+    options.filter = filter;
+    options.colorSpace = colorSpace;
+    if (upload.channels == 4)
+        options.alphaChannel = 3;
+    else if (upload.channels == 2)
+        options.alphaChannel = 1; // grey + alpha
+    return options;
+}
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef INSTANCE_BUFFER_H
+#define INSTANCE_BUFFER_H
+
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <algorithm>
+
+#include "gl_verify.h"
+#include "gl_state_cache.h"
+#include "math3d.h"
+#include "transform_hierarchy.h"
+
+// Per-instance model matrices for instanced draws. The matrix takes four
+// vertex attribute locations starting at firstLocation (a mat4 attribute in
+// the shader) with divisor 1, so instance i reads matrix i.
+//
+// update() takes the world matrices of a TransformHierarchy as they are and
+// only re-uploads the slots the last TransformHierarchy::update() rewrote.
+class InstanceBuffer
+{
+public:
+    explicit InstanceBuffer(GLuint firstLocation = 3) : m_firstLocation(firstLocation) {}
+    ~InstanceBuffer()
+    {
+        release();
+    }
+    InstanceBuffer(const InstanceBuffer&) = delete;
+    InstanceBuffer& operator=(const InstanceBuffer&) = delete;
+
+    // Adds the matrix attributes to a VAO, e.g. GeometryArena::vertexArray().
+    // Growing the buffer keeps the attachment; a VAO the arena recreated has
+    // to be attached again. The VAO is bound through the cache the arena
+    // draws with and stays bound.
+    // ------------------------------------------------------------------------
+    void attach(GLStateCache& state, GLuint vertexArray)
+    {
+        ensureBuffer();
+        state.bindVertexArray(vertexArray);
+        GL_VERIFY(glBindBuffer(GL_ARRAY_BUFFER, m_buffer));
+        for (GLuint column = 0; column < 4; column++)
+        {
+            GLuint location = m_firstLocation + column;
+            GL_VERIFY(glEnableVertexAttribArray(location));
+            GL_VERIFY(glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, sizeof(Mat4), (void*)(column * sizeof(Vec4))));
+            GL_VERIFY(glVertexAttribDivisor(location, 1));
+        }
+    }
+
+    // uploads what changed since the last call, the whole array after a re-sort
+    // ------------------------------------------------------------------------
+    void update(const TransformHierarchy& hierarchy)
+    {
+        uint32_t count = hierarchy.size();
+        bool grown = reserve(count);
+        m_count = count;
+        uint32_t first, changed;
+        if (grown)
+            upload(hierarchy.worldMatrices(), 0, count);
+        else if (hierarchy.changedRange(first, changed))
+            upload(hierarchy.worldMatrices() + first, first, changed);
+    }
+    // copies count matrices to instances [first, first + count), growing the
+    // buffer drops what was uploaded before
+    // ------------------------------------------------------------------------
+    void upload(const Mat4* matrices, uint32_t first, uint32_t count)
+    {
+        if (count == 0)
+            return;
+        reserve(first + count);
+        m_count = std::max(m_count, first + count);
+        GL_VERIFY(glBindBuffer(GL_ARRAY_BUFFER, m_buffer));
+        GL_VERIFY(glBufferSubData(GL_ARRAY_BUFFER, (GLintptr)first * sizeof(Mat4), (GLsizeiptr)count * sizeof(Mat4), matrices));
+        m_uploadedBytes += (uint64_t)count * sizeof(Mat4);
+    }
+
+    // ------------------------------------------------------------------------
+    GLuint buffer() const { return m_buffer; }
+    uint32_t count() const { return m_count; }
+    uint64_t uploadedBytes() const { return m_uploadedBytes; } // since creation
+
+    // ------------------------------------------------------------------------
+    void release()
+    {
+        if (m_buffer)
+            GL_VERIFY(glDeleteBuffers(1, &m_buffer));
+        m_buffer = 0;
+        m_capacity = m_count = 0;
+    }
+
+private:
+    GLuint m_firstLocation;
+    GLuint m_buffer = 0;
+    uint32_t m_capacity = 0; // matrices
+    uint32_t m_count = 0;
+    uint64_t m_uploadedBytes = 0;
+
+    // ------------------------------------------------------------------------
+    void ensureBuffer()
+    {
+        if (!m_buffer)
+            GL_VERIFY(glGenBuffers(1, &m_buffer));
+    }
+    // grows by doubling, the old contents are dropped; true when it grew
+    // ------------------------------------------------------------------------
+    bool reserve(uint32_t count)
+    {
+        ensureBuffer();
+        if (count <= m_capacity)
+            return false;
+        m_capacity = std::max(count, std::max(m_capacity * 2, 64u));
+        GL_VERIFY(glBindBuffer(GL_ARRAY_BUFFER, m_buffer));
+        GL_VERIFY(glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)m_capacity * sizeof(Mat4), nullptr, GL_DYNAMIC_DRAW));
+        return true;
+    }
+};
+
+#endif
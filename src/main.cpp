@@ -1,6 +1,7 @@
 #include <Windows.h>
 
 #include <sstream>
+#include <fstream>
 #include <cassert>
 
 #include <glad/glad.h>
@@ -9,25 +10,37 @@
 
 #include "../stb/stb_image.h"
 
+#include "gl_verify.h"
 #include "shader.h"
-
-#ifndef NDEBUG
-#define GL_VERIFY(OP) do {                  \
-    OP;                                     \
-    GLenum error = glGetError();            \
-    if(error != GL_NO_ERROR)                \
-    {                                       \
-        assert(false);                      \
-    }                                       \
-} while(false)
-#else
-#define GL_VERIFY(OP) OP
-#endif
+#include "geometry_arena.h"
+#include "block_compression.h"
+#include "texture_streamer.h"
+#include "texture_cache.h"
+#include "progressive_streamer.h"
+#include "decode_arena.h"
+#include "gl_state_cache.h"
+#include "sampler_cache.h"
+#include "supercompressed_texture.h"
+#include "math3d.h"
+#include "transform_hierarchy.h"
+#include "instance_buffer.h"
+#include "skeletal_animation.h"
+#include "bone_palette_buffer.h"
+#include "gpu_profiler.h"
+#include "cpu_profiler.h"
+#include "gl_call_counters.h"
+#include "gpu_memory.h"
+#include "gl_trace.h"
+#include "demo_scene.h"
+#include "framebuffer_readback.h"
+#include "hud_overlay.h"
 
 #define APPTITLE "OpenGLLearn"
 
 int gWidth = 800;
 int gHeight = 600;
+bool gScreenshotRequested = false;
+bool gHudVisible = true;
 
 void ShowFatal(const char* message)
 {
@@ -69,8 +82,83 @@ void checkShaderLink(GLuint program)
     }
 }
 
+// Writes block compressed .bct versions of our textures next to the sources.
+// Run with --bake after changing an image, the app picks them up on start.
+// --bake-universal writes supercompressed .sct files instead, transcoded for
+// whatever the GPU supports when loaded.
+bool bakeTextures(bool universal)
+{
+    struct
+    {
+        const char* source;
+        const char* baked;
+        const char* universal;
+        bool flip;
+    } textures[] = {
+        { "container.jpg", "container.bct", "container.sct", false },
+        { "awesomeface.png", "awesomeface.bct", "awesomeface.sct", true },
+    };
+
+    ThreadPool pool;
+    for (const auto& texture : textures)
+    {
+        DecodeArenaScope arena; // rewound after each texture
+        int width, height, nrChannels;
+        stbi_set_flip_vertically_on_load(texture.flip);
+        unsigned char* data = stbi_load(texture.source, &width, &height, &nrChannels, 4); // always RGBA
+        if (!data)
+        {
+            MessageBoxA(nullptr, texture.source, APPTITLE " - failed to load", MB_ICONERROR);
+            return false;
+        }
+
+        bool ok;
+        if (universal)
+        {
+            std::vector<uint8_t> file = bakeSupercompressedTexture(data, width, height, &pool);
+            ok = saveSupercompressedTexture(texture.universal, file);
+        }
+        else
+        {
+            BlockFormat format = selectBlockFormat(data, width, height);
+            CompressedTexture compressed = bakeCompressedTexture(data, width, height, format, &pool);
+            ok = saveCompressedTexture(texture.baked, compressed);
+        }
+        stbi_image_free(data);
+
+        if (!ok)
+        {
+            MessageBoxA(nullptr, universal ? texture.universal : texture.baked, APPTITLE " - failed to write", MB_ICONERROR);
+            return false;
+        }
+    }
+    return true;
+}
+
 int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR pCmdLine, int nCmdShow)
 {
+    if (pCmdLine && wcsstr(pCmdLine, L"--bake"))
+        return bakeTextures(wcsstr(pCmdLine, L"--bake-universal") != nullptr) ? 0 : 1;
+    // --profile writes GPU scope statistics to gpu_profile.csv, the CPU and
+    // GPU timeline to cpu_trace.json and cpu_capture.bin, the GL calls of
+    // every frame to gl_calls.csv and GPU memory by category and creation
+    // site to gpu_memory.txt on exit
+    bool profile = pCmdLine && wcsstr(pCmdLine, L"--profile");
+    // --record appends every frame to capture.rgba as raw video
+    bool record = pCmdLine && wcsstr(pCmdLine, L"--record");
+    // --capture-gl[=N] records the GL calls of the first N frames (100) to
+    // gl_capture.gltrace for tools/gl_replay
+    const wchar_t* captureGl = pCmdLine ? wcsstr(pCmdLine, L"--capture-gl") : nullptr;
+    uint32_t captureFrames = 0;
+    if (captureGl)
+        captureFrames = captureGl[12] == L'=' ? (uint32_t)wcstoul(captureGl + 13, nullptr, 10) : 100;
+    cpuProfiler().setThreadName("main");
+    if (profile)
+    {
+        cpuProfiler().setEnabled(true);
+        cpuProfiler().startCapture();
+    }
+
     glfwInit();
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
@@ -97,6 +185,21 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR pCmdLine
     if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
         ShowFatal("Failed to initialize GLAD");
 
+    // sizes every buffer, texture and renderbuffer from here on; first, so
+    // the bindings it shadows start from GL's defaults
+    gpuMemory().install();
+
+    // counts the GL calls of every frame (debug builds); the quads, the
+    // ribbon and the HUD are one draw each, more means something started
+    // drawing per object
+    GLCallCounters glCalls;
+    glCalls.install();
+    glCalls.setBudget(GLCallCategory::Draw, 3);
+
+    // before any other GL call, so every object is created inside the trace
+    GLTraceCapture glTrace;
+    glTrace.start("gl_capture.gltrace", captureFrames);
+
     GL_VERIFY(glViewport(0, 0, gWidth, gHeight));
 
     // called when the window resized
@@ -106,140 +209,64 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR pCmdLine
         GL_VERIFY(glViewport(0, 0, width, height));
         }
     );
+    // F12 saves the next frame as screenshot_N.png, F1 shows and hides the HUD
+    glfwSetKeyCallback(win, [](GLFWwindow*, int key, int, int action, int) {
+        if (key == GLFW_KEY_F12 && action == GLFW_PRESS)
+            gScreenshotRequested = true;
+        if (key == GLFW_KEY_F1 && action == GLFW_PRESS)
+            gHudVisible = !gHudVisible;
+        }
+    );
 
-    // Draw preparation
-    float vertices[] = {
-        // positions          // colors           // texture coords
-         0.5f,  0.5f, 0.0f,   1.0f, 0.0f, 0.0f,   1.0f, 1.0f,   // top right
-         0.5f, -0.5f, 0.0f,   0.0f, 1.0f, 0.0f,   1.0f, 0.0f,   // bottom right
-        -0.5f, -0.5f, 0.0f,   0.0f, 0.0f, 1.0f,   0.0f, 0.0f,   // bottom left
-        -0.5f,  0.5f, 0.0f,   1.0f, 1.0f, 0.0f,   0.0f, 1.0f    // top left 
-    };
-    const int ELEMENT_COUNT = 8;
-    unsigned int indices[] = {
-        0, 1, 3, // first triangle
-        1, 2, 3  // second triangle
-    };
-
-    GLuint VBO;
-    {
-        GL_VERIFY(glGenBuffers(
-            1, // count
-            &VBO));
-        GL_VERIFY(glBindBuffer(GL_ARRAY_BUFFER, VBO));
-        GL_VERIFY(glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW));
-    }
-
-    // VAO
-    GLuint VAO;
-    {
-        GL_VERIFY(glGenVertexArrays(1, &VAO));
-        GL_VERIFY(glBindVertexArray(VAO));
-    }
-
-    // EBO
-    GLuint EBO;
-    {
-        GL_VERIFY(glGenBuffers(1, &EBO));
-        GL_VERIFY(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO));
-        GL_VERIFY(glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW));
-    }
-
-    // needs VBO and VAO
-    GL_VERIFY(glVertexAttribPointer(
-        0, // location in shader
-        3, // x,y,z
-        GL_FLOAT,
-        GL_FALSE, // normalize
-        ELEMENT_COUNT * sizeof(float), // byte count of 1 vertex
-        (void*)0 // offset
-    ));
-    GL_VERIFY(glEnableVertexAttribArray(
-        0 // location in shader
-    ));
-    // color attribute
-    GL_VERIFY(glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, ELEMENT_COUNT * sizeof(float), (void*)(3 * sizeof(float))));
-    GL_VERIFY(glEnableVertexAttribArray(1));
-
-    GL_VERIFY(glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, ELEMENT_COUNT * sizeof(float), (void*)(6 * sizeof(float))));
-    GL_VERIFY(glEnableVertexAttribArray(2));
-
-
-    Shader ourShader("3.3.shader.vs", "3.3.shader.fs"); // you can name your shader files however you like
-
-
-    GLuint texture1;
-    {
-        int width, height, nrChannels;
-        unsigned char* data = stbi_load("container.jpg", &width, &height, &nrChannels, 0);
-        assert(data);
-
-        GL_VERIFY(glGenTextures(1, &texture1));
-        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, texture1));
-
-        // set the texture wrapping/filtering options (on the currently bound texture object)
-        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
-        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
-        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
-        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
-
-        // attach image to texture
-        GL_VERIFY(glTexImage2D(
-            GL_TEXTURE_2D,
-            0, // mipmap level
-            GL_RGB,
-            width, height,
-            0, // reserved
-            GL_RGB, // source format
-            GL_UNSIGNED_BYTE, // source format
-            data));
-        GL_VERIFY(glGenerateMipmap(GL_TEXTURE_2D));
+    BlockCompressionSupport compressionSupport = BlockCompressionSupport::query();
 
-        stbi_image_free(data);
-    }
-    GLuint texture2;
-    {
-        int width, height, nrChannels;
-        stbi_set_flip_vertically_on_load(true);
-        unsigned char* data = stbi_load("awesomeface.png", &width, &height, &nrChannels, 0);
-        assert(data);
-
-        GL_VERIFY(glGenTextures(1, &texture2));
-        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, texture2));
-
-        // set the texture wrapping/filtering options (on the currently bound texture object)
-        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
-        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
-        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
-        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
-
-        // attach image to texture
-        GL_VERIFY(glTexImage2D(
-            GL_TEXTURE_2D,
-            0, // mipmap level
-            GL_RGBA,
-            width, height,
-            0, // reserved
-            GL_RGBA, // source format
-            GL_UNSIGNED_BYTE, // source format
-            data));
-        GL_VERIFY(glGenerateMipmap(GL_TEXTURE_2D));
+    // decodes images on workers, uploads them through PBOs a few rows per frame
+    ThreadPool assetWorkers;
+    // glTexStorage2D is loaded past glad, a trace would miss it
+    DemoScene demo(assetWorkers, compressionSupport, glTrace.capturing() ? TextureStorageSupport() :
+        TextureStorageSupport::query((GLADloadproc)glfwGetProcAddress));
 
-        stbi_image_free(data);
-    }
+    // GPU time per scope, read back a few frames late
+    GpuProfiler gpuProfiler;
 
+    // frames for screenshots and --record, mapped a few frames after the
+    // copy and written out on workers
+    FramebufferReadback screenshots(2);
+    PngFrameWriter screenshotWriter(assetWorkers, "screenshot_%llu.png");
+    screenshots.addSink(screenshotWriter.sink());
+    FramebufferReadback recording;
+    RawVideoWriter video;
+    if (record && video.open("capture.rgba"))
+        recording.addSink(video.sink());
+    uint64_t frameNumber = 0;
 
-    ourShader.use(); // don't forget to activate the shader before setting uniforms!  
-    glUniform1i(glGetUniformLocation(ourShader.ID, "texture1"), 0); // set it manually
-    glUniform1i(glGetUniformLocation(ourShader.ID, "texture2"), 1); // set it manually
+    // frame time graph, GPU time, draws and GPU memory over the scene
+    HudOverlay hud;
 
     // Main loop
     while (!glfwWindowShouldClose(win))
     {
-        processInput(win);
+        {
+            PROFILE_ZONE("processInput");
+            processInput(win);
+        }
+        gpuProfiler.beginFrame();
+
+        demo.updateTextures(gpuProfiler, gWidth, gHeight);
+        if (demo.streamer().frameStats().uploadedBytes)
+        {
+            const TextureStreamStats& stats = demo.streamer().frameStats();
+            char line[128];
+            snprintf(line, sizeof(line), "texture streaming: %llu bytes, %.3f ms stalled, %u pending\n",
+                (unsigned long long)stats.uploadedBytes, stats.stallMilliseconds, stats.pendingTextures);
+            OutputDebugStringA(line);
+        }
 
-        GL_VERIFY(glClearColor(0.2f, 0.3f, 0.3f, 1.0f));
-        GL_VERIFY(glClear(GL_COLOR_BUFFER_BIT));
+        {
+            PROFILE_ZONE("clear");
+            GL_VERIFY(glClearColor(0.2f, 0.3f, 0.3f, 1.0f));
+            GL_VERIFY(glClear(GL_COLOR_BUFFER_BIT));
+        }
 
         // draw our first triangle
         //float timeValue = glfwGetTime();
@@ -249,21 +276,88 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR pCmdLine
         //GL_VERIFY(glUseProgram(shaderProgram));
         //GL_VERIFY(glUniform4f(vertexColorLocation, 0.0f, greenValue, 0.0f, 1.0f));
 
-        ourShader.use();
+        demo.draw(gpuProfiler, (float)glfwGetTime());
+
+        {
+            PROFILE_ZONE("readback");
+            if (gScreenshotRequested)
+                gScreenshotRequested = !screenshots.capture(frameNumber, 0, 0, 0, gWidth, gHeight);
+            if (record)
+                recording.capture(frameNumber, 0, 0, 0, gWidth, gHeight);
+            screenshots.update();
+            recording.update();
+        }
 
-        GL_VERIFY(glActiveTexture(GL_TEXTURE0));
-        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, texture1));
-        GL_VERIFY(glActiveTexture(GL_TEXTURE1));
-        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, texture2));
+        // after the readbacks, screenshots and recordings show the scene only
+        {
+            PROFILE_ZONE("hud");
+            GpuScope scope(gpuProfiler, "hud");
+            hud.update(gpuProfiler, glCalls, gpuMemory());
+            if (gHudVisible)
+                hud.draw(demo.glState(), gWidth, gHeight);
+        }
 
-        GL_VERIFY(glBindVertexArray(VAO)); // seeing as we only have a single VAO there's no need to bind it every time, but we'll do so to keep things a bit more organized
-        // GL_VERIFY(glDrawArrays(GL_TRIANGLES, 0, 3));
-        GL_VERIFY(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0));
+        gpuProfiler.endFrame();
+        captureGpuTimeline(gpuProfiler, cpuProfiler());
+        if (glTrace.endFrame() && !glTrace.written())
+            OutputDebugStringA("cannot write gl_capture.gltrace\n");
+        {
+            PROFILE_ZONE("glfwSwapBuffers");
+            glfwSwapBuffers(win);
+        }
+        {
+            PROFILE_ZONE("glfwPollEvents");
+            glfwPollEvents();
+        }
+        cpuProfiler().endFrame();
+        if (!glCalls.endFrame() && glCalls.overBudgetFrames() == 1)
+        {
+            char line[128];
+            snprintf(line, sizeof(line), "GL call budget exceeded in frame %llu: %u draws, %u calls\n",
+                (unsigned long long)glCalls.lastFrame().frame, glCalls.lastFrame()[GLCallCategory::Draw], glCalls.lastFrame().total);
+            OutputDebugStringA(line);
+        }
+        frameNumber++;
+        gpuMemory().endFrame();
+    }
 
-        glfwSwapBuffers(win);
-        glfwPollEvents();
+    screenshots.flush();
+    recording.flush();
+    screenshotWriter.wait();
+    video.close();
+    if (record && video.written())
+    {
+        char line[128];
+        snprintf(line, sizeof(line), "capture.rgba: %llu frames of %dx%d, %llu dropped\n", (unsigned long long)video.written(),
+            video.width(), video.height(), (unsigned long long)(recording.stats().dropped + video.skipped()));
+        OutputDebugStringA(line);
     }
 
+    if (profile)
+    {
+        std::ofstream csv("gpu_profile.csv");
+        gpuProfiler.writeCsv(csv);
+        std::ofstream calls("gl_calls.csv");
+        glCalls.writeCsv(calls);
+        std::ofstream memory("gpu_memory.txt");
+        gpuMemory().writeReport(memory);
+
+        CpuCapture capture = cpuProfiler().stopCapture();
+        std::ofstream trace("cpu_trace.json");
+        capture.writeChromeTrace(trace);
+        std::vector<uint8_t> binary;
+        capture.writeBinary(binary);
+        std::ofstream("cpu_capture.bin", std::ios::binary).write((const char*)binary.data(), (std::streamsize)binary.size());
+    }
+    screenshots.release();
+    recording.release();
+    gpuProfiler.release();
+    hud.release();
+    demo.release();
+    // everything is released, what is still alive leaked
+    std::ostringstream leaks;
+    if (gpuMemory().writeLeaks(leaks))
+        OutputDebugStringA(leaks.str().c_str());
     glfwTerminate();
 	return 0;
 }
\ No newline at end of file
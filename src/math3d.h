@@ -0,0 +1,630 @@
+#ifndef MATH3D_H
+#define MATH3D_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "cpu_features.h"
+
+#if !defined(CPU_HAS_SSE2) && (defined(__ARM_NEON) || defined(_M_ARM64))
+#include <arm_neon.h>
+#define MATH3D_USE_NEON 1
+#endif
+
+// Vectors, matrices and quaternions for the transform code, laid out the way
+// GLSL expects them: matrices are column major, so a Mat4 goes to
+// glUniformMatrix4fv as is and M * v means the same here as in a shader.
+//
+// Element-wise vector operations are constexpr scalar code, which compilers
+// vectorize well enough and which keeps them usable in constant
+// expressions. Matrix products and the batch kernels further down work on
+// whole columns with SSE or NEON; without either they fall back to the same
+// scalar code the benchmarks compare against. The batch matrix products use
+// AVX2 and FMA when the CPU has them, SSE2 has no faster way to broadcast
+// than the shuffles the compiler already emits for the scalar code.
+
+// ----------------------------------------------------------------------------
+struct Vec2
+{
+    float x, y;
+
+    constexpr Vec2() : x(0.0f), y(0.0f) {}
+    constexpr Vec2(float x, float y) : x(x), y(y) {}
+    constexpr explicit Vec2(float s) : x(s), y(s) {}
+
+    float& operator[](int i) { return (&x)[i]; }
+    float operator[](int i) const { return (&x)[i]; }
+};
+struct Vec3
+{
+    float x, y, z;
+
+    constexpr Vec3() : x(0.0f), y(0.0f), z(0.0f) {}
+    constexpr Vec3(float x, float y, float z) : x(x), y(y), z(z) {}
+    constexpr explicit Vec3(float s) : x(s), y(s), z(s) {}
+    constexpr Vec3(const Vec2& xy, float z) : x(xy.x), y(xy.y), z(z) {}
+
+    float& operator[](int i) { return (&x)[i]; }
+    float operator[](int i) const { return (&x)[i]; }
+};
+// 16 byte aligned so a column is one register
+struct alignas(16) Vec4
+{
+    float x, y, z, w;
+
+    constexpr Vec4() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
+    constexpr Vec4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+    constexpr explicit Vec4(float s) : x(s), y(s), z(s), w(s) {}
+    constexpr Vec4(const Vec3& xyz, float w) : x(xyz.x), y(xyz.y), z(xyz.z), w(w) {}
+
+    constexpr Vec3 xyz() const { return Vec3(x, y, z); }
+    float& operator[](int i) { return (&x)[i]; }
+    float operator[](int i) const { return (&x)[i]; }
+};
+
+// column major, columns[c][r]
+struct Mat3
+{
+    Vec3 columns[3];
+
+    constexpr Mat3() : columns{ Vec3(1, 0, 0), Vec3(0, 1, 0), Vec3(0, 0, 1) } {}
+    constexpr Mat3(const Vec3& c0, const Vec3& c1, const Vec3& c2) : columns{ c0, c1, c2 } {}
+
+    static constexpr Mat3 identity() { return Mat3(); }
+    Vec3& operator[](int c) { return columns[c]; }
+    const Vec3& operator[](int c) const { return columns[c]; }
+    const float* data() const { return &columns[0].x; }
+};
+struct alignas(16) Mat4
+{
+    Vec4 columns[4];
+
+    constexpr Mat4() : columns{ Vec4(1, 0, 0, 0), Vec4(0, 1, 0, 0), Vec4(0, 0, 1, 0), Vec4(0, 0, 0, 1) } {}
+    constexpr Mat4(const Vec4& c0, const Vec4& c1, const Vec4& c2, const Vec4& c3) : columns{ c0, c1, c2, c3 } {}
+
+    static constexpr Mat4 identity() { return Mat4(); }
+    Vec4& operator[](int c) { return columns[c]; }
+    const Vec4& operator[](int c) const { return columns[c]; }
+    const float* data() const { return &columns[0].x; }
+};
+
+// unit quaternions for rotations, w is the real part
+struct Quat
+{
+    float x, y, z, w;
+
+    constexpr Quat() : x(0.0f), y(0.0f), z(0.0f), w(1.0f) {}
+    constexpr Quat(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+
+    static constexpr Quat identity() { return Quat(); }
+};
+
+// axis aligned box, min <= max on every axis
+struct Aabb
+{
+    Vec3 min, max;
+
+    constexpr Aabb() {}
+    constexpr Aabb(const Vec3& min, const Vec3& max) : min(min), max(max) {}
+
+    constexpr Vec3 center() const { return Vec3((min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f); }
+    constexpr Vec3 extent() const { return Vec3((max.x - min.x) * 0.5f, (max.y - min.y) * 0.5f, (max.z - min.z) * 0.5f); }
+};
+
+// vector arithmetic ----------------------------------------------------------
+constexpr Vec2 operator+(const Vec2& a, const Vec2& b) { return Vec2(a.x + b.x, a.y + b.y); }
+constexpr Vec2 operator-(const Vec2& a, const Vec2& b) { return Vec2(a.x - b.x, a.y - b.y); }
+constexpr Vec2 operator*(const Vec2& a, const Vec2& b) { return Vec2(a.x * b.x, a.y * b.y); }
+constexpr Vec2 operator*(const Vec2& a, float s) { return Vec2(a.x * s, a.y * s); }
+constexpr Vec2 operator*(float s, const Vec2& a) { return a * s; }
+constexpr Vec2 operator/(const Vec2& a, float s) { return Vec2(a.x / s, a.y / s); }
+constexpr Vec2 operator-(const Vec2& a) { return Vec2(-a.x, -a.y); }
+constexpr bool operator==(const Vec2& a, const Vec2& b) { return a.x == b.x && a.y == b.y; }
+
+constexpr Vec3 operator+(const Vec3& a, const Vec3& b) { return Vec3(a.x + b.x, a.y + b.y, a.z + b.z); }
+constexpr Vec3 operator-(const Vec3& a, const Vec3& b) { return Vec3(a.x - b.x, a.y - b.y, a.z - b.z); }
+constexpr Vec3 operator*(const Vec3& a, const Vec3& b) { return Vec3(a.x * b.x, a.y * b.y, a.z * b.z); }
+constexpr Vec3 operator*(const Vec3& a, float s) { return Vec3(a.x * s, a.y * s, a.z * s); }
+constexpr Vec3 operator*(float s, const Vec3& a) { return a * s; }
+constexpr Vec3 operator/(const Vec3& a, float s) { return Vec3(a.x / s, a.y / s, a.z / s); }
+constexpr Vec3 operator-(const Vec3& a) { return Vec3(-a.x, -a.y, -a.z); }
+constexpr bool operator==(const Vec3& a, const Vec3& b) { return a.x == b.x && a.y == b.y && a.z == b.z; }
+
+constexpr Vec4 operator+(const Vec4& a, const Vec4& b) { return Vec4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w); }
+constexpr Vec4 operator-(const Vec4& a, const Vec4& b) { return Vec4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w); }
+constexpr Vec4 operator*(const Vec4& a, const Vec4& b) { return Vec4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w); }
+constexpr Vec4 operator*(const Vec4& a, float s) { return Vec4(a.x * s, a.y * s, a.z * s, a.w * s); }
+constexpr Vec4 operator*(float s, const Vec4& a) { return a * s; }
+constexpr Vec4 operator/(const Vec4& a, float s) { return Vec4(a.x / s, a.y / s, a.z / s, a.w / s); }
+constexpr Vec4 operator-(const Vec4& a) { return Vec4(-a.x, -a.y, -a.z, -a.w); }
+constexpr bool operator==(const Vec4& a, const Vec4& b) { return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w; }
+
+inline Vec2& operator+=(Vec2& a, const Vec2& b) { return a = a + b; }
+inline Vec2& operator-=(Vec2& a, const Vec2& b) { return a = a - b; }
+inline Vec2& operator*=(Vec2& a, float s) { return a = a * s; }
+inline Vec3& operator+=(Vec3& a, const Vec3& b) { return a = a + b; }
+inline Vec3& operator-=(Vec3& a, const Vec3& b) { return a = a - b; }
+inline Vec3& operator*=(Vec3& a, float s) { return a = a * s; }
+inline Vec4& operator+=(Vec4& a, const Vec4& b) { return a = a + b; }
+inline Vec4& operator-=(Vec4& a, const Vec4& b) { return a = a - b; }
+inline Vec4& operator*=(Vec4& a, float s) { return a = a * s; }
+
+constexpr float dot(const Vec2& a, const Vec2& b) { return a.x * b.x + a.y * b.y; }
+constexpr float dot(const Vec3& a, const Vec3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+constexpr float dot(const Vec4& a, const Vec4& b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+constexpr Vec3 cross(const Vec3& a, const Vec3& b)
+{
+    return Vec3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+constexpr Vec2 lerp(const Vec2& a, const Vec2& b, float t) { return a + (b - a) * t; }
+constexpr Vec3 lerp(const Vec3& a, const Vec3& b, float t) { return a + (b - a) * t; }
+constexpr Vec4 lerp(const Vec4& a, const Vec4& b, float t) { return a + (b - a) * t; }
+
+inline float length(const Vec2& a) { return std::sqrt(dot(a, a)); }
+inline float length(const Vec3& a) { return std::sqrt(dot(a, a)); }
+inline float length(const Vec4& a) { return std::sqrt(dot(a, a)); }
+// zero vectors stay zero
+inline Vec2 normalize(const Vec2& a)
+{
+    float l = length(a);
+    return l > 0.0f ? a / l : a;
+}
+inline Vec3 normalize(const Vec3& a)
+{
+    float l = length(a);
+    return l > 0.0f ? a / l : a;
+}
+inline Vec4 normalize(const Vec4& a)
+{
+    float l = length(a);
+    return l > 0.0f ? a / l : a;
+}
+
+constexpr float radians(float degrees) { return degrees * 0.01745329251994329577f; }
+constexpr float degrees(float radians) { return radians * 57.2957795130823208768f; }
+
+// SIMD columns ---------------------------------------------------------------
+namespace vecmath
+{
+#if defined(CPU_HAS_SSE2)
+    typedef __m128 float4;
+    inline float4 load(const float* p) { return _mm_loadu_ps(p); }
+    inline void store(float* p, float4 v) { _mm_storeu_ps(p, v); }
+    inline float4 set1(float s) { return _mm_set1_ps(s); }
+    inline float4 add(float4 a, float4 b) { return _mm_add_ps(a, b); }
+    inline float4 mul(float4 a, float4 b) { return _mm_mul_ps(a, b); }
+    inline float4 madd(float4 a, float4 b, float4 c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    template<int I> inline float4 splat(float4 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(I, I, I, I)); }
+#elif defined(MATH3D_USE_NEON)
+    typedef float32x4_t float4;
+    inline float4 load(const float* p) { return vld1q_f32(p); }
+    inline void store(float* p, float4 v) { vst1q_f32(p, v); }
+    inline float4 set1(float s) { return vdupq_n_f32(s); }
+    inline float4 add(float4 a, float4 b) { return vaddq_f32(a, b); }
+    inline float4 mul(float4 a, float4 b) { return vmulq_f32(a, b); }
+    inline float4 madd(float4 a, float4 b, float4 c) { return vmlaq_f32(c, a, b); }
+    template<int I> inline float4 splat(float4 v) { return vdupq_n_f32(vgetq_lane_f32(v, I)); }
+#else
+    struct float4
+    {
+        float v[4];
+    };
+    inline float4 load(const float* p)
+    {
+        float4 r;
+        memcpy(r.v, p, 16);
+        return r;
+    }
+    inline void store(float* p, float4 v) { memcpy(p, v.v, 16); }
+    inline float4 set1(float s) { return float4{ { s, s, s, s } }; }
+    inline float4 add(float4 a, float4 b) { return float4{ { a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3] } }; }
+    inline float4 mul(float4 a, float4 b) { return float4{ { a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3] } }; }
+    inline float4 madd(float4 a, float4 b, float4 c) { return add(mul(a, b), c); }
+    template<int I> inline float4 splat(float4 v) { return set1(v.v[I]); }
+#endif
+
+    // the four columns of m
+    struct Columns
+    {
+        float4 c0, c1, c2, c3;
+    };
+    inline Columns loadColumns(const Mat4& m)
+    {
+        return Columns{ load(&m.columns[0].x), load(&m.columns[1].x), load(&m.columns[2].x), load(&m.columns[3].x) };
+    }
+    // m * v, one column per lane of v
+    inline float4 transform(const Columns& m, float4 v)
+    {
+        return madd(m.c3, splat<3>(v), madd(m.c2, splat<2>(v), madd(m.c1, splat<1>(v), mul(m.c0, splat<0>(v)))));
+    }
+    // m * (x, y, z, 1)
+    inline float4 transformPoint(const Columns& m, float x, float y, float z)
+    {
+        return madd(m.c2, set1(z), madd(m.c1, set1(y), madd(m.c0, set1(x), m.c3)));
+    }
+    // all of b is loaded before out is written, so out may be b and the
+    // compiler needs no loop over the columns
+    inline void multiply(const Columns& a, const Mat4& b, Mat4& out)
+    {
+        float4 b0 = load(&b.columns[0].x);
+        float4 b1 = load(&b.columns[1].x);
+        float4 b2 = load(&b.columns[2].x);
+        float4 b3 = load(&b.columns[3].x);
+        store(&out.columns[0].x, transform(a, b0));
+        store(&out.columns[1].x, transform(a, b1));
+        store(&out.columns[2].x, transform(a, b2));
+        store(&out.columns[3].x, transform(a, b3));
+    }
+#if defined(CPU_HAS_SSE2)
+    // out[i] = a[i * aStep] * b[i], two columns of b per step with a's columns
+    // repeated in both halves; the broadcasts come straight from memory
+    // ------------------------------------------------------------------------
+    TARGET_AVX2 inline void multiplyMatricesAVX2(const Mat4* a, size_t aStep, const Mat4* b, Mat4* out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            const float* m = &a[i * aStep].columns[0].x;
+            __m256 a0 = _mm256_broadcast_ps((const __m128*)m);
+            __m256 a1 = _mm256_broadcast_ps((const __m128*)(m + 4));
+            __m256 a2 = _mm256_broadcast_ps((const __m128*)(m + 8));
+            __m256 a3 = _mm256_broadcast_ps((const __m128*)(m + 12));
+            const float* n = &b[i].columns[0].x;
+            float* o = &out[i].columns[0].x;
+            __m256 lo = _mm256_loadu_ps(n);
+            __m256 hi = _mm256_loadu_ps(n + 8);
+            __m256 rlo = _mm256_mul_ps(a0, _mm256_permute_ps(lo, 0x00));
+            __m256 rhi = _mm256_mul_ps(a0, _mm256_permute_ps(hi, 0x00));
+            rlo = _mm256_fmadd_ps(a1, _mm256_permute_ps(lo, 0x55), rlo);
+            rhi = _mm256_fmadd_ps(a1, _mm256_permute_ps(hi, 0x55), rhi);
+            rlo = _mm256_fmadd_ps(a2, _mm256_permute_ps(lo, 0xaa), rlo);
+            rhi = _mm256_fmadd_ps(a2, _mm256_permute_ps(hi, 0xaa), rhi);
+            rlo = _mm256_fmadd_ps(a3, _mm256_permute_ps(lo, 0xff), rlo);
+            rhi = _mm256_fmadd_ps(a3, _mm256_permute_ps(hi, 0xff), rhi);
+            _mm256_storeu_ps(o, rlo);
+            _mm256_storeu_ps(o + 8, rhi);
+        }
+    }
+    inline bool hasAVX2() { return cpuFeatures().avx2 && cpuFeatures().fma; }
+#endif
+
+    // scalar references, also what the batch kernels are benchmarked against
+    // ------------------------------------------------------------------------
+    constexpr Vec4 transformScalar(const Mat4& m, const Vec4& v)
+    {
+        return Vec4(
+            m.columns[0].x * v.x + m.columns[1].x * v.y + m.columns[2].x * v.z + m.columns[3].x * v.w,
+            m.columns[0].y * v.x + m.columns[1].y * v.y + m.columns[2].y * v.z + m.columns[3].y * v.w,
+            m.columns[0].z * v.x + m.columns[1].z * v.y + m.columns[2].z * v.z + m.columns[3].z * v.w,
+            m.columns[0].w * v.x + m.columns[1].w * v.y + m.columns[2].w * v.z + m.columns[3].w * v.w);
+    }
+    constexpr Mat4 multiplyScalar(const Mat4& a, const Mat4& b)
+    {
+        return Mat4(transformScalar(a, b.columns[0]), transformScalar(a, b.columns[1]),
+                    transformScalar(a, b.columns[2]), transformScalar(a, b.columns[3]));
+    }
+    inline void transformPointsScalar(const Mat4& m, const Vec3* in, Vec3* out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+            out[i] = transformScalar(m, Vec4(in[i], 1.0f)).xyz();
+    }
+    inline void transformVectorsScalar(const Mat4& m, const Vec4* in, Vec4* out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+            out[i] = transformScalar(m, in[i]);
+    }
+    inline void multiplyMatricesScalar(const Mat4* a, const Mat4* b, Mat4* out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+            out[i] = multiplyScalar(a[i], b[i]);
+    }
+}
+
+// matrices -------------------------------------------------------------------
+inline Vec4 operator*(const Mat4& m, const Vec4& v)
+{
+    Vec4 r;
+    vecmath::store(&r.x, vecmath::transform(vecmath::loadColumns(m), vecmath::load(&v.x)));
+    return r;
+}
+inline Mat4 operator*(const Mat4& a, const Mat4& b)
+{
+    Mat4 r;
+    vecmath::multiply(vecmath::loadColumns(a), b, r);
+    return r;
+}
+inline Mat4& operator*=(Mat4& a, const Mat4& b) { return a = a * b; }
+constexpr Vec3 operator*(const Mat3& m, const Vec3& v)
+{
+    return m.columns[0] * v.x + m.columns[1] * v.y + m.columns[2] * v.z;
+}
+constexpr Mat3 operator*(const Mat3& a, const Mat3& b)
+{
+    return Mat3(a * b.columns[0], a * b.columns[1], a * b.columns[2]);
+}
+// (x, y, z, 1) through m, no perspective divide
+inline Vec3 transformPoint(const Mat4& m, const Vec3& p)
+{
+    return (m * Vec4(p, 1.0f)).xyz();
+}
+// (x, y, z, 0) through m, translation ignored
+inline Vec3 transformDirection(const Mat4& m, const Vec3& d)
+{
+    return (m * Vec4(d, 0.0f)).xyz();
+}
+
+constexpr Mat4 transpose(const Mat4& m)
+{
+    return Mat4(
+        Vec4(m.columns[0].x, m.columns[1].x, m.columns[2].x, m.columns[3].x),
+        Vec4(m.columns[0].y, m.columns[1].y, m.columns[2].y, m.columns[3].y),
+        Vec4(m.columns[0].z, m.columns[1].z, m.columns[2].z, m.columns[3].z),
+        Vec4(m.columns[0].w, m.columns[1].w, m.columns[2].w, m.columns[3].w));
+}
+constexpr Mat3 transpose(const Mat3& m)
+{
+    return Mat3(
+        Vec3(m.columns[0].x, m.columns[1].x, m.columns[2].x),
+        Vec3(m.columns[0].y, m.columns[1].y, m.columns[2].y),
+        Vec3(m.columns[0].z, m.columns[1].z, m.columns[2].z));
+}
+// upper left 3x3
+constexpr Mat3 toMat3(const Mat4& m)
+{
+    return Mat3(m.columns[0].xyz(), m.columns[1].xyz(), m.columns[2].xyz());
+}
+constexpr Mat4 toMat4(const Mat3& m)
+{
+    return Mat4(Vec4(m.columns[0], 0.0f), Vec4(m.columns[1], 0.0f), Vec4(m.columns[2], 0.0f), Vec4(0.0f, 0.0f, 0.0f, 1.0f));
+}
+constexpr float determinant(const Mat3& m)
+{
+    return dot(m.columns[0], cross(m.columns[1], m.columns[2]));
+}
+// singular matrices come back as they went in
+// ----------------------------------------------------------------------------
+inline Mat3 inverse(const Mat3& m)
+{
+    Vec3 r0 = cross(m.columns[1], m.columns[2]);
+    Vec3 r1 = cross(m.columns[2], m.columns[0]);
+    Vec3 r2 = cross(m.columns[0], m.columns[1]);
+    float det = dot(m.columns[0], r0);
+    if (det == 0.0f)
+        return m;
+    return transpose(Mat3(r0 / det, r1 / det, r2 / det));
+}
+// general 4x4 inverse by cofactors, singular matrices come back as they went in
+// ----------------------------------------------------------------------------
+inline Mat4 inverse(const Mat4& m)
+{
+    const float* a = m.data();
+    float inv[16];
+    inv[0] = a[5] * a[10] * a[15] - a[5] * a[11] * a[14] - a[9] * a[6] * a[15] + a[9] * a[7] * a[14] + a[13] * a[6] * a[11] - a[13] * a[7] * a[10];
+    inv[4] = -a[4] * a[10] * a[15] + a[4] * a[11] * a[14] + a[8] * a[6] * a[15] - a[8] * a[7] * a[14] - a[12] * a[6] * a[11] + a[12] * a[7] * a[10];
+    inv[8] = a[4] * a[9] * a[15] - a[4] * a[11] * a[13] - a[8] * a[5] * a[15] + a[8] * a[7] * a[13] + a[12] * a[5] * a[11] - a[12] * a[7] * a[9];
+    inv[12] = -a[4] * a[9] * a[14] + a[4] * a[10] * a[13] + a[8] * a[5] * a[14] - a[8] * a[6] * a[13] - a[12] * a[5] * a[10] + a[12] * a[6] * a[9];
+    inv[1] = -a[1] * a[10] * a[15] + a[1] * a[11] * a[14] + a[9] * a[2] * a[15] - a[9] * a[3] * a[14] - a[13] * a[2] * a[11] + a[13] * a[3] * a[10];
+    inv[5] = a[0] * a[10] * a[15] - a[0] * a[11] * a[14] - a[8] * a[2] * a[15] + a[8] * a[3] * a[14] + a[12] * a[2] * a[11] - a[12] * a[3] * a[10];
+    inv[9] = -a[0] * a[9] * a[15] + a[0] * a[11] * a[13] + a[8] * a[1] * a[15] - a[8] * a[3] * a[13] - a[12] * a[1] * a[11] + a[12] * a[3] * a[9];
+    inv[13] = a[0] * a[9] * a[14] - a[0] * a[10] * a[13] - a[8] * a[1] * a[14] + a[8] * a[2] * a[13] + a[12] * a[1] * a[10] - a[12] * a[2] * a[9];
+    inv[2] = a[1] * a[6] * a[15] - a[1] * a[7] * a[14] - a[5] * a[2] * a[15] + a[5] * a[3] * a[14] + a[13] * a[2] * a[7] - a[13] * a[3] * a[6];
+    inv[6] = -a[0] * a[6] * a[15] + a[0] * a[7] * a[14] + a[4] * a[2] * a[15] - a[4] * a[3] * a[14] - a[12] * a[2] * a[7] + a[12] * a[3] * a[6];
+    inv[10] = a[0] * a[5] * a[15] - a[0] * a[7] * a[13] - a[4] * a[1] * a[15] + a[4] * a[3] * a[13] + a[12] * a[1] * a[7] - a[12] * a[3] * a[5];
+    inv[14] = -a[0] * a[5] * a[14] + a[0] * a[6] * a[13] + a[4] * a[1] * a[14] - a[4] * a[2] * a[13] - a[12] * a[1] * a[6] + a[12] * a[2] * a[5];
+    inv[3] = -a[1] * a[6] * a[11] + a[1] * a[7] * a[10] + a[5] * a[2] * a[11] - a[5] * a[3] * a[10] - a[9] * a[2] * a[7] + a[9] * a[3] * a[6];
+    inv[7] = a[0] * a[6] * a[11] - a[0] * a[7] * a[10] - a[4] * a[2] * a[11] + a[4] * a[3] * a[10] + a[8] * a[2] * a[7] - a[8] * a[3] * a[6];
+    inv[11] = -a[0] * a[5] * a[11] + a[0] * a[7] * a[9] + a[4] * a[1] * a[11] - a[4] * a[3] * a[9] - a[8] * a[1] * a[7] + a[8] * a[3] * a[5];
+    inv[15] = a[0] * a[5] * a[10] - a[0] * a[6] * a[9] - a[4] * a[1] * a[10] + a[4] * a[2] * a[9] + a[8] * a[1] * a[6] - a[8] * a[2] * a[5];
+
+    float det = a[0] * inv[0] + a[1] * inv[4] + a[2] * inv[8] + a[3] * inv[12];
+    if (det == 0.0f)
+        return m;
+    Mat4 r;
+    float* out = &r.columns[0].x;
+    for (int i = 0; i < 16; i++)
+        out[i] = inv[i] / det;
+    return r;
+}
+// rotation + translation (+ uniform or not scale) only, cheaper than inverse()
+// ----------------------------------------------------------------------------
+inline Mat4 affineInverse(const Mat4& m)
+{
+    Mat3 linear = inverse(toMat3(m));
+    Vec3 t = -(linear * m.columns[3].xyz());
+    return Mat4(Vec4(linear.columns[0], 0.0f), Vec4(linear.columns[1], 0.0f), Vec4(linear.columns[2], 0.0f), Vec4(t, 1.0f));
+}
+// for transforming normals by a model matrix with non-uniform scale
+inline Mat3 normalMatrix(const Mat4& model)
+{
+    return transpose(inverse(toMat3(model)));
+}
+
+// builders -------------------------------------------------------------------
+constexpr Mat4 translation(const Vec3& t)
+{
+    return Mat4(Vec4(1, 0, 0, 0), Vec4(0, 1, 0, 0), Vec4(0, 0, 1, 0), Vec4(t, 1.0f));
+}
+constexpr Mat4 scaling(const Vec3& s)
+{
+    return Mat4(Vec4(s.x, 0, 0, 0), Vec4(0, s.y, 0, 0), Vec4(0, 0, s.z, 0), Vec4(0, 0, 0, 1));
+}
+// angle in radians, counter clockwise looking down the axis
+// ----------------------------------------------------------------------------
+inline Mat4 rotation(float angle, const Vec3& axis)
+{
+    Vec3 a = normalize(axis);
+    float c = std::cos(angle);
+    float s = std::sin(angle);
+    float t = 1.0f - c;
+    return Mat4(
+        Vec4(t * a.x * a.x + c, t * a.x * a.y + s * a.z, t * a.x * a.z - s * a.y, 0.0f),
+        Vec4(t * a.x * a.y - s * a.z, t * a.y * a.y + c, t * a.y * a.z + s * a.x, 0.0f),
+        Vec4(t * a.x * a.z + s * a.y, t * a.y * a.z - s * a.x, t * a.z * a.z + c, 0.0f),
+        Vec4(0.0f, 0.0f, 0.0f, 1.0f));
+}
+// m followed by the transform, in the order the tutorials build them:
+// translate(rotate(I, ...), ...) rotates first, then translates
+inline Mat4 translate(const Mat4& m, const Vec3& t) { return m * translation(t); }
+inline Mat4 rotate(const Mat4& m, float angle, const Vec3& axis) { return m * rotation(angle, axis); }
+inline Mat4 scale(const Mat4& m, const Vec3& s) { return m * scaling(s); }
+
+// OpenGL clip space, z in [-1, 1]; fovy in radians
+// ----------------------------------------------------------------------------
+inline Mat4 perspective(float fovy, float aspect, float zNear, float zFar)
+{
+    float f = 1.0f / std::tan(fovy * 0.5f);
+    return Mat4(
+        Vec4(f / aspect, 0.0f, 0.0f, 0.0f),
+        Vec4(0.0f, f, 0.0f, 0.0f),
+        Vec4(0.0f, 0.0f, (zFar + zNear) / (zNear - zFar), -1.0f),
+        Vec4(0.0f, 0.0f, 2.0f * zFar * zNear / (zNear - zFar), 0.0f));
+}
+constexpr Mat4 ortho(float left, float right, float bottom, float top, float zNear, float zFar)
+{
+    return Mat4(
+        Vec4(2.0f / (right - left), 0.0f, 0.0f, 0.0f),
+        Vec4(0.0f, 2.0f / (top - bottom), 0.0f, 0.0f),
+        Vec4(0.0f, 0.0f, -2.0f / (zFar - zNear), 0.0f),
+        Vec4(-(right + left) / (right - left), -(top + bottom) / (top - bottom), -(zFar + zNear) / (zFar - zNear), 1.0f));
+}
+// right handed view matrix, the camera looks down -z
+// ----------------------------------------------------------------------------
+inline Mat4 lookAt(const Vec3& eye, const Vec3& center, const Vec3& up)
+{
+    Vec3 f = normalize(center - eye);
+    Vec3 s = normalize(cross(f, up));
+    Vec3 u = cross(s, f);
+    return Mat4(
+        Vec4(s.x, u.x, -f.x, 0.0f),
+        Vec4(s.y, u.y, -f.y, 0.0f),
+        Vec4(s.z, u.z, -f.z, 0.0f),
+        Vec4(-dot(s, eye), -dot(u, eye), dot(f, eye), 1.0f));
+}
+
+// quaternions ----------------------------------------------------------------
+constexpr Quat operator*(const Quat& a, const Quat& b)
+{
+    return Quat(
+        a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+        a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+        a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+        a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z);
+}
+constexpr Quat conjugate(const Quat& q) { return Quat(-q.x, -q.y, -q.z, q.w); }
+constexpr float dot(const Quat& a, const Quat& b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+inline Quat normalize(const Quat& q)
+{
+    float l = std::sqrt(dot(q, q));
+    return l > 0.0f ? Quat(q.x / l, q.y / l, q.z / l, q.w / l) : Quat();
+}
+// ----------------------------------------------------------------------------
+inline Quat quatFromAxisAngle(const Vec3& axis, float angle)
+{
+    Vec3 a = normalize(axis) * std::sin(angle * 0.5f);
+    return Quat(a.x, a.y, a.z, std::cos(angle * 0.5f));
+}
+// v rotated by the unit quaternion q
+constexpr Vec3 rotate(const Quat& q, const Vec3& v)
+{
+    // v + 2w (u x v) + 2 u x (u x v), u the vector part
+    return v + cross(Vec3(q.x, q.y, q.z), v) * (2.0f * q.w) + cross(Vec3(q.x, q.y, q.z), cross(Vec3(q.x, q.y, q.z), v)) * 2.0f;
+}
+constexpr Mat3 toMat3(const Quat& q)
+{
+    return Mat3(
+        Vec3(1.0f - 2.0f * (q.y * q.y + q.z * q.z), 2.0f * (q.x * q.y + q.z * q.w), 2.0f * (q.x * q.z - q.y * q.w)),
+        Vec3(2.0f * (q.x * q.y - q.z * q.w), 1.0f - 2.0f * (q.x * q.x + q.z * q.z), 2.0f * (q.y * q.z + q.x * q.w)),
+        Vec3(2.0f * (q.x * q.z + q.y * q.w), 2.0f * (q.y * q.z - q.x * q.w), 1.0f - 2.0f * (q.x * q.x + q.y * q.y)));
+}
+constexpr Mat4 toMat4(const Quat& q)
+{
+    return toMat4(toMat3(q));
+}
+// translation * rotation * scale, the usual local transform
+constexpr Mat4 composeTransform(const Vec3& t, const Quat& r, const Vec3& s)
+{
+    return Mat4(
+        Vec4(toMat3(r).columns[0] * s.x, 0.0f),
+        Vec4(toMat3(r).columns[1] * s.y, 0.0f),
+        Vec4(toMat3(r).columns[2] * s.z, 0.0f),
+        Vec4(t, 1.0f));
+}
+// normalized lerp along the shorter arc, fine for small steps
+// ----------------------------------------------------------------------------
+inline Quat nlerp(const Quat& a, const Quat& b, float t)
+{
+    float sign = dot(a, b) < 0.0f ? -1.0f : 1.0f;
+    return normalize(Quat(
+        a.x + (b.x * sign - a.x) * t, a.y + (b.y * sign - a.y) * t,
+        a.z + (b.z * sign - a.z) * t, a.w + (b.w * sign - a.w) * t));
+}
+// constant angular speed, nlerp when the two are nearly equal
+// ----------------------------------------------------------------------------
+inline Quat slerp(const Quat& a, const Quat& b, float t)
+{
+    float cosTheta = dot(a, b);
+    Quat end = b;
+    if (cosTheta < 0.0f)
+    {
+        cosTheta = -cosTheta;
+        end = Quat(-b.x, -b.y, -b.z, -b.w);
+    }
+    if (cosTheta > 0.9995f)
+        return nlerp(a, end, t);
+    float theta = std::acos(cosTheta);
+    float sinTheta = std::sin(theta);
+    float wa = std::sin((1.0f - t) * theta) / sinTheta;
+    float wb = std::sin(t * theta) / sinTheta;
+    return Quat(a.x * wa + end.x * wb, a.y * wa + end.y * wb, a.z * wa + end.z * wb, a.w * wa + end.w * wb);
+}
+
+// Batch kernels: one matrix (or one per element) over whole arrays. The
+// matrix stays in registers and the inputs stream through, which is where
+// SIMD pays off over calling operator* in a loop.
+// ----------------------------------------------------------------------------
+inline void transformPoints(const Mat4& m, const Vec3* in, Vec3* out, size_t count)
+{
+    vecmath::Columns columns = vecmath::loadColumns(m);
+    for (size_t i = 0; i < count; i++)
+    {
+        alignas(16) float r[4];
+        vecmath::store(r, vecmath::transformPoint(columns, in[i].x, in[i].y, in[i].z));
+        out[i] = Vec3(r[0], r[1], r[2]);
+    }
+}
+inline void transformVectors(const Mat4& m, const Vec4* in, Vec4* out, size_t count)
+{
+    vecmath::Columns columns = vecmath::loadColumns(m);
+    for (size_t i = 0; i < count; i++)
+        vecmath::store(&out[i].x, vecmath::transform(columns, vecmath::load(&in[i].x)));
+}
+// out[i] = a[i] * b[i]
+inline void multiplyMatrices(const Mat4* a, const Mat4* b, Mat4* out, size_t count)
+{
+#if defined(CPU_HAS_SSE2)
+    if (vecmath::hasAVX2())
+    {
+        vecmath::multiplyMatricesAVX2(a, 1, b, out, count);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < count; i++)
+        vecmath::multiply(vecmath::loadColumns(a[i]), b[i], out[i]);
+}
+// out[i] = a * b[i], e.g. a view projection over model matrices
+inline void multiplyMatrices(const Mat4& a, const Mat4* b, Mat4* out, size_t count)
+{
+#if defined(CPU_HAS_SSE2)
+    if (vecmath::hasAVX2())
+    {
+        vecmath::multiplyMatricesAVX2(&a, 0, b, out, count);
+        return;
+    }
+#endif
+    vecmath::Columns columns = vecmath::loadColumns(a);
+    for (size_t i = 0; i < count; i++)
+        vecmath::multiply(columns, b[i], out[i]);
+}
+
+#endif
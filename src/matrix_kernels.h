@@ -0,0 +1,403 @@
+#ifndef MATRIX_KERNELS_H
+#define MATRIX_KERNELS_H
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "cpu_features.h"
+#include "math3d.h"
+
+// Per-instance transform work over whole arrays: a shared matrix (usually
+// the view projection) times every model matrix, bounding boxes through a
+// matrix, and model matrices packed into smaller vertex attribute layouts.
+//
+// Every kernel comes as Scalar, SSE2, AVX2 and AVX512; the unsuffixed entry
+// point picks the best one the CPU has. AVX2 works on two columns (or two
+// boxes) per instruction and AVX-512 on a whole matrix (or four boxes).
+// Off x86 only the Scalar kernels exist; multiply() goes through math3d,
+// which has a NEON path.
+
+// how packMatrices() lays out one matrix
+enum class MatrixPacking
+{
+    Float4x4, // the matrix as is, 64 bytes
+    Float3x4, // rows 0-2, the (0, 0, 0, 1) row of affine matrices dropped, 48 bytes
+    Half4x4,  // GL_HALF_FLOAT columns, 32 bytes
+    Half3x4,  // GL_HALF_FLOAT rows 0-2, 24 bytes
+};
+
+// ----------------------------------------------------------------------------
+inline size_t packedMatrixBytes(MatrixPacking packing)
+{
+    switch (packing)
+    {
+    case MatrixPacking::Float4x4: return 64;
+    case MatrixPacking::Float3x4: return 48;
+    case MatrixPacking::Half4x4: return 32;
+    default: return 24;
+    }
+}
+
+namespace batch
+{
+    // round to nearest even like F16C, overflow goes to infinity
+    // ------------------------------------------------------------------------
+    inline uint16_t floatToHalf(float value)
+    {
+        uint32_t bits;
+        memcpy(&bits, &value, 4);
+        uint16_t sign = (uint16_t)((bits >> 16) & 0x8000);
+        bits &= 0x7fffffff;
+        if (bits >= 0x47800000) // 65536 and up, inf, nan
+            return sign | (bits > 0x7f800000 ? 0x7e00 : 0x7c00);
+        if (bits < 0x38800000) // below the smallest normal half: let the FPU round
+        {
+            float shifted;
+            memcpy(&shifted, &bits, 4);
+            shifted += 0.5f;
+            memcpy(&bits, &shifted, 4);
+            return sign | (uint16_t)(bits - 0x3f000000);
+        }
+        uint32_t odd = (bits >> 13) & 1;
+        bits += 0xc8000fff + odd; // rebias the exponent and round
+        return sign | (uint16_t)(bits >> 13);
+    }
+
+    // out[i] = a * b[i] ------------------------------------------------------
+    inline void multiplyScalar(const Mat4& a, const Mat4* b, Mat4* out, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+            out[i] = vecmath::multiplyScalar(a, b[i]);
+    }
+#ifdef CPU_HAS_SSE2
+    inline void multiplySSE2(const Mat4& a, const Mat4* b, Mat4* out, size_t count)
+    {
+        vecmath::Columns columns = vecmath::loadColumns(a);
+        for (size_t i = 0; i < count; i++)
+            vecmath::multiply(columns, b[i], out[i]);
+    }
+    // two columns of b per step, a's columns repeated in both halves
+    // ------------------------------------------------------------------------
+    TARGET_AVX2 inline void multiplyAVX2(const Mat4& a, const Mat4* b, Mat4* out, size_t count)
+    {
+        const __m256 a0 = _mm256_broadcast_ps((const __m128*)&a.columns[0].x);
+        const __m256 a1 = _mm256_broadcast_ps((const __m128*)&a.columns[1].x);
+        const __m256 a2 = _mm256_broadcast_ps((const __m128*)&a.columns[2].x);
+        const __m256 a3 = _mm256_broadcast_ps((const __m128*)&a.columns[3].x);
+        for (size_t i = 0; i < count; i++)
+        {
+            const float* m = b[i].data();
+            float* o = &out[i].columns[0].x;
+            __m256 lo = _mm256_loadu_ps(m);
+            __m256 hi = _mm256_loadu_ps(m + 8);
+            __m256 rlo = _mm256_mul_ps(a0, _mm256_permute_ps(lo, 0x00));
+            __m256 rhi = _mm256_mul_ps(a0, _mm256_permute_ps(hi, 0x00));
+            rlo = _mm256_fmadd_ps(a1, _mm256_permute_ps(lo, 0x55), rlo);
+            rhi = _mm256_fmadd_ps(a1, _mm256_permute_ps(hi, 0x55), rhi);
+            rlo = _mm256_fmadd_ps(a2, _mm256_permute_ps(lo, 0xaa), rlo);
+            rhi = _mm256_fmadd_ps(a2, _mm256_permute_ps(hi, 0xaa), rhi);
+            rlo = _mm256_fmadd_ps(a3, _mm256_permute_ps(lo, 0xff), rlo);
+            rhi = _mm256_fmadd_ps(a3, _mm256_permute_ps(hi, 0xff), rhi);
+            _mm256_storeu_ps(o, rlo);
+            _mm256_storeu_ps(o + 8, rhi);
+        }
+    }
+    // the whole of b[i] in one register
+    // ------------------------------------------------------------------------
+    TARGET_AVX512 inline void multiplyAVX512(const Mat4& a, const Mat4* b, Mat4* out, size_t count)
+    {
+        const __m512 a0 = _mm512_broadcast_f32x4(_mm_loadu_ps(&a.columns[0].x));
+        const __m512 a1 = _mm512_broadcast_f32x4(_mm_loadu_ps(&a.columns[1].x));
+        const __m512 a2 = _mm512_broadcast_f32x4(_mm_loadu_ps(&a.columns[2].x));
+        const __m512 a3 = _mm512_broadcast_f32x4(_mm_loadu_ps(&a.columns[3].x));
+        for (size_t i = 0; i < count; i++)
+        {
+            __m512 m = _mm512_loadu_ps(b[i].data());
+            __m512 r = _mm512_mul_ps(a0, _mm512_permute_ps(m, 0x00));
+            r = _mm512_fmadd_ps(a1, _mm512_permute_ps(m, 0x55), r);
+            r = _mm512_fmadd_ps(a2, _mm512_permute_ps(m, 0xaa), r);
+            r = _mm512_fmadd_ps(a3, _mm512_permute_ps(m, 0xff), r);
+            _mm512_storeu_ps(&out[i].columns[0].x, r);
+        }
+    }
+#endif
+
+    // Bounding boxes go through as center and extent (Arvo): the center is
+    // transformed as a point, the extent by the absolute upper 3x3.
+    // ------------------------------------------------------------------------
+    inline void transformAabbsScalar(const Mat4& m, const Aabb* in, Aabb* out, size_t count)
+    {
+        Vec3 x(std::fabs(m.columns[0].x), std::fabs(m.columns[0].y), std::fabs(m.columns[0].z));
+        Vec3 y(std::fabs(m.columns[1].x), std::fabs(m.columns[1].y), std::fabs(m.columns[1].z));
+        Vec3 z(std::fabs(m.columns[2].x), std::fabs(m.columns[2].y), std::fabs(m.columns[2].z));
+        for (size_t i = 0; i < count; i++)
+        {
+            Vec3 center = in[i].center(), extent = in[i].extent();
+            Vec3 c = vecmath::transformScalar(m, Vec4(center, 1.0f)).xyz();
+            Vec3 e = x * extent.x + y * extent.y + z * extent.z;
+            out[i] = Aabb(c - e, c + e);
+        }
+    }
+#ifdef CPU_HAS_SSE2
+    // An Aabb is 24 bytes, so both halves are moved with overlapping 16 byte
+    // accesses at min.x and min.z; neither reaches outside the box.
+    // ------------------------------------------------------------------------
+    inline void loadAabb(const Aabb& box, __m128& min, __m128& max)
+    {
+        min = _mm_loadu_ps(&box.min.x);                                  // min.xyz, max.x
+        __m128 upper = _mm_loadu_ps(&box.min.z);                         // min.z, max.xyz
+        max = _mm_shuffle_ps(upper, upper, _MM_SHUFFLE(3, 3, 2, 1));     // max.xyzz
+    }
+    inline void storeAabb(Aabb& box, __m128 min, __m128 max)
+    {
+        __m128 upper = _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(max), 4)); // 0, max.xyz
+        upper = _mm_move_ss(upper, _mm_shuffle_ps(min, min, _MM_SHUFFLE(2, 2, 2, 2)));
+        _mm_storeu_ps(&box.min.x, min);
+        _mm_storeu_ps(&box.min.z, upper);
+    }
+    // ------------------------------------------------------------------------
+    inline void transformAabbsSSE2(const Mat4& m, const Aabb* in, Aabb* out, size_t count)
+    {
+        const __m128 signless = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+        const __m128 half = _mm_set1_ps(0.5f);
+        vecmath::Columns columns = vecmath::loadColumns(m);
+        __m128 x = _mm_and_ps(columns.c0, signless), y = _mm_and_ps(columns.c1, signless), z = _mm_and_ps(columns.c2, signless);
+        for (size_t i = 0; i < count; i++)
+        {
+            __m128 min, max;
+            loadAabb(in[i], min, max);
+            __m128 center = _mm_mul_ps(_mm_add_ps(min, max), half);
+            __m128 extent = _mm_mul_ps(_mm_sub_ps(max, min), half);
+            __m128 c = vecmath::madd(columns.c2, vecmath::splat<2>(center),
+                       vecmath::madd(columns.c1, vecmath::splat<1>(center),
+                       vecmath::madd(columns.c0, vecmath::splat<0>(center), columns.c3)));
+            __m128 e = vecmath::madd(z, vecmath::splat<2>(extent),
+                       vecmath::madd(y, vecmath::splat<1>(extent), _mm_mul_ps(x, vecmath::splat<0>(extent))));
+            storeAabb(out[i], _mm_sub_ps(c, e), _mm_add_ps(c, e));
+        }
+    }
+    // two boxes per step, one per 128 bit half
+    // ------------------------------------------------------------------------
+    TARGET_AVX2 inline void transformAabbsAVX2(const Mat4& m, const Aabb* in, Aabb* out, size_t count)
+    {
+        const __m256 signless = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+        const __m256 half = _mm256_set1_ps(0.5f);
+        const __m256 c0 = _mm256_broadcast_ps((const __m128*)&m.columns[0].x);
+        const __m256 c1 = _mm256_broadcast_ps((const __m128*)&m.columns[1].x);
+        const __m256 c2 = _mm256_broadcast_ps((const __m128*)&m.columns[2].x);
+        const __m256 c3 = _mm256_broadcast_ps((const __m128*)&m.columns[3].x);
+        const __m256 x = _mm256_and_ps(c0, signless), y = _mm256_and_ps(c1, signless), z = _mm256_and_ps(c2, signless);
+        size_t i = 0;
+        for (; i + 2 <= count; i += 2)
+        {
+            __m128 min0, max0, min1, max1;
+            loadAabb(in[i], min0, max0);
+            loadAabb(in[i + 1], min1, max1);
+            __m256 min = _mm256_insertf128_ps(_mm256_castps128_ps256(min0), min1, 1);
+            __m256 max = _mm256_insertf128_ps(_mm256_castps128_ps256(max0), max1, 1);
+            __m256 center = _mm256_mul_ps(_mm256_add_ps(min, max), half);
+            __m256 extent = _mm256_mul_ps(_mm256_sub_ps(max, min), half);
+            __m256 c = _mm256_fmadd_ps(c0, _mm256_permute_ps(center, 0x00), c3);
+            c = _mm256_fmadd_ps(c1, _mm256_permute_ps(center, 0x55), c);
+            c = _mm256_fmadd_ps(c2, _mm256_permute_ps(center, 0xaa), c);
+            __m256 e = _mm256_mul_ps(x, _mm256_permute_ps(extent, 0x00));
+            e = _mm256_fmadd_ps(y, _mm256_permute_ps(extent, 0x55), e);
+            e = _mm256_fmadd_ps(z, _mm256_permute_ps(extent, 0xaa), e);
+            __m256 lo = _mm256_sub_ps(c, e), hi = _mm256_add_ps(c, e);
+            storeAabb(out[i], _mm256_castps256_ps128(lo), _mm256_castps256_ps128(hi));
+            storeAabb(out[i + 1], _mm256_extractf128_ps(lo, 1), _mm256_extractf128_ps(hi, 1));
+        }
+        transformAabbsSSE2(m, in + i, out + i, count - i);
+    }
+    // four boxes per step
+    // ------------------------------------------------------------------------
+    TARGET_AVX512 inline void transformAabbsAVX512(const Mat4& m, const Aabb* in, Aabb* out, size_t count)
+    {
+        const __m512 signless = _mm512_castsi512_ps(_mm512_set1_epi32(0x7fffffff));
+        const __m512 half = _mm512_set1_ps(0.5f);
+        const __m512 c0 = _mm512_broadcast_f32x4(_mm_loadu_ps(&m.columns[0].x));
+        const __m512 c1 = _mm512_broadcast_f32x4(_mm_loadu_ps(&m.columns[1].x));
+        const __m512 c2 = _mm512_broadcast_f32x4(_mm_loadu_ps(&m.columns[2].x));
+        const __m512 c3 = _mm512_broadcast_f32x4(_mm_loadu_ps(&m.columns[3].x));
+        const __m512 x = _mm512_and_ps(c0, signless), y = _mm512_and_ps(c1, signless), z = _mm512_and_ps(c2, signless);
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 mins[4], maxs[4];
+            for (int k = 0; k < 4; k++)
+                loadAabb(in[i + k], mins[k], maxs[k]);
+            __m512 min = _mm512_castps128_ps512(mins[0]);
+            __m512 max = _mm512_castps128_ps512(maxs[0]);
+            min = _mm512_insertf32x4(min, mins[1], 1);
+            max = _mm512_insertf32x4(max, maxs[1], 1);
+            min = _mm512_insertf32x4(min, mins[2], 2);
+            max = _mm512_insertf32x4(max, maxs[2], 2);
+            min = _mm512_insertf32x4(min, mins[3], 3);
+            max = _mm512_insertf32x4(max, maxs[3], 3);
+            __m512 center = _mm512_mul_ps(_mm512_add_ps(min, max), half);
+            __m512 extent = _mm512_mul_ps(_mm512_sub_ps(max, min), half);
+            __m512 c = _mm512_fmadd_ps(c0, _mm512_permute_ps(center, 0x00), c3);
+            c = _mm512_fmadd_ps(c1, _mm512_permute_ps(center, 0x55), c);
+            c = _mm512_fmadd_ps(c2, _mm512_permute_ps(center, 0xaa), c);
+            __m512 e = _mm512_mul_ps(x, _mm512_permute_ps(extent, 0x00));
+            e = _mm512_fmadd_ps(y, _mm512_permute_ps(extent, 0x55), e);
+            e = _mm512_fmadd_ps(z, _mm512_permute_ps(extent, 0xaa), e);
+            __m512 lo = _mm512_sub_ps(c, e), hi = _mm512_add_ps(c, e);
+            storeAabb(out[i], _mm512_castps512_ps128(lo), _mm512_castps512_ps128(hi));
+            storeAabb(out[i + 1], _mm512_extractf32x4_ps(lo, 1), _mm512_extractf32x4_ps(hi, 1));
+            storeAabb(out[i + 2], _mm512_extractf32x4_ps(lo, 2), _mm512_extractf32x4_ps(hi, 2));
+            storeAabb(out[i + 3], _mm512_extractf32x4_ps(lo, 3), _mm512_extractf32x4_ps(hi, 3));
+        }
+        transformAabbsAVX2(m, in + i, out + i, count - i);
+    }
+#endif
+
+    // packedMatrixBytes(packing) bytes per matrix, back to back --------------
+    inline void packMatricesScalar(const Mat4* in, size_t count, MatrixPacking packing, void* out)
+    {
+        uint8_t* bytes = (uint8_t*)out;
+        size_t stride = packedMatrixBytes(packing);
+        for (size_t i = 0; i < count; i++, bytes += stride)
+        {
+            const Mat4& m = in[i];
+            float values[16];
+            int n = 0;
+            if (packing == MatrixPacking::Float4x4 || packing == MatrixPacking::Half4x4)
+            {
+                memcpy(values, m.data(), 64);
+                n = 16;
+            }
+            else
+            {
+                for (int r = 0; r < 3; r++)
+                    for (int c = 0; c < 4; c++)
+                        values[n++] = m.columns[c][r];
+            }
+            if (packing == MatrixPacking::Float4x4 || packing == MatrixPacking::Float3x4)
+                memcpy(bytes, values, n * 4);
+            else
+            {
+                uint16_t halves[16];
+                for (int k = 0; k < n; k++)
+                    halves[k] = floatToHalf(values[k]);
+                memcpy(bytes, halves, n * 2);
+            }
+        }
+    }
+#ifdef CPU_HAS_SSE2
+    // SSE2 has no half conversion, those layouts stay scalar
+    // ------------------------------------------------------------------------
+    inline void packMatricesSSE2(const Mat4* in, size_t count, MatrixPacking packing, void* out)
+    {
+        if (packing == MatrixPacking::Float4x4)
+            memcpy(out, in, count * sizeof(Mat4));
+        else if (packing != MatrixPacking::Float3x4)
+            packMatricesScalar(in, count, packing, out);
+        else
+        {
+            float* floats = (float*)out;
+            for (size_t i = 0; i < count; i++, floats += 12)
+            {
+                vecmath::Columns m = vecmath::loadColumns(in[i]);
+                _MM_TRANSPOSE4_PS(m.c0, m.c1, m.c2, m.c3);
+                _mm_storeu_ps(floats, m.c0);
+                _mm_storeu_ps(floats + 4, m.c1);
+                _mm_storeu_ps(floats + 8, m.c2);
+            }
+        }
+    }
+    // F16C conversions, rows transposed with SSE
+    // ------------------------------------------------------------------------
+    TARGET_AVX2 inline void packMatricesAVX2(const Mat4* in, size_t count, MatrixPacking packing, void* out)
+    {
+        if (packing == MatrixPacking::Float4x4 || packing == MatrixPacking::Float3x4)
+        {
+            packMatricesSSE2(in, count, packing, out);
+            return;
+        }
+        uint8_t* bytes = (uint8_t*)out;
+        if (packing == MatrixPacking::Half4x4)
+        {
+            for (size_t i = 0; i < count; i++, bytes += 32)
+            {
+                const float* m = in[i].data();
+                __m128i lo = _mm256_cvtps_ph(_mm256_loadu_ps(m), _MM_FROUND_TO_NEAREST_INT);
+                __m128i hi = _mm256_cvtps_ph(_mm256_loadu_ps(m + 8), _MM_FROUND_TO_NEAREST_INT);
+                _mm_storeu_si128((__m128i*)bytes, lo);
+                _mm_storeu_si128((__m128i*)(bytes + 16), hi);
+            }
+            return;
+        }
+        for (size_t i = 0; i < count; i++, bytes += 24)
+        {
+            vecmath::Columns m = vecmath::loadColumns(in[i]);
+            _MM_TRANSPOSE4_PS(m.c0, m.c1, m.c2, m.c3);
+            __m128i rows01 = _mm256_cvtps_ph(_mm256_insertf128_ps(_mm256_castps128_ps256(m.c0), m.c1, 1), _MM_FROUND_TO_NEAREST_INT);
+            __m128i row2 = _mm_cvtps_ph(m.c2, _MM_FROUND_TO_NEAREST_INT);
+            _mm_storeu_si128((__m128i*)bytes, rows01);
+            _mm_storel_epi64((__m128i*)(bytes + 16), row2);
+        }
+    }
+    // one conversion per matrix; the row layouts gain nothing over AVX2
+    // ------------------------------------------------------------------------
+    TARGET_AVX512 inline void packMatricesAVX512(const Mat4* in, size_t count, MatrixPacking packing, void* out)
+    {
+        if (packing != MatrixPacking::Half4x4)
+        {
+            packMatricesAVX2(in, count, packing, out);
+            return;
+        }
+        uint8_t* bytes = (uint8_t*)out;
+        for (size_t i = 0; i < count; i++, bytes += 32)
+            _mm256_storeu_si256((__m256i*)bytes, _mm512_cvtps_ph(_mm512_loadu_ps(in[i].data()), _MM_FROUND_TO_NEAREST_INT));
+    }
+#endif
+
+    // best kernels this CPU has
+    // ------------------------------------------------------------------------
+    inline void multiply(const Mat4& a, const Mat4* b, Mat4* out, size_t count)
+    {
+#ifdef CPU_HAS_SSE2
+        const CpuFeatures& cpu = cpuFeatures();
+        if (cpu.avx512f)
+            multiplyAVX512(a, b, out, count);
+        else if (cpu.avx2 && cpu.fma)
+            multiplyAVX2(a, b, out, count);
+        else
+            multiplySSE2(a, b, out, count);
+#else
+        multiplyMatrices(a, b, out, count);
+#endif
+    }
+    inline void transformAabbs(const Mat4& m, const Aabb* in, Aabb* out, size_t count)
+    {
+#ifdef CPU_HAS_SSE2
+        const CpuFeatures& cpu = cpuFeatures();
+        if (cpu.avx512f)
+            transformAabbsAVX512(m, in, out, count);
+        else if (cpu.avx2 && cpu.fma)
+            transformAabbsAVX2(m, in, out, count);
+        else
+            transformAabbsSSE2(m, in, out, count);
+#else
+        transformAabbsScalar(m, in, out, count);
+#endif
+    }
+    inline void packMatrices(const Mat4* in, size_t count, MatrixPacking packing, void* out)
+    {
+#ifdef CPU_HAS_SSE2
+        const CpuFeatures& cpu = cpuFeatures();
+        if (cpu.avx512f)
+            packMatricesAVX512(in, count, packing, out);
+        else if (cpu.avx2 && cpu.f16c)
+            packMatricesAVX2(in, count, packing, out);
+        else
+            packMatricesSSE2(in, count, packing, out);
+#else
+        packMatricesScalar(in, count, packing, out);
+#endif
+    }
+}
+
+#endif
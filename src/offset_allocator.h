@@ -0,0 +1,389 @@
+#ifndef OFFSET_ALLOCATOR_H
+#define OFFSET_ALLOCATOR_H
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// TLSF-style offset allocator. It never touches the memory it manages, it only
+// hands out [offset, offset + size) ranges, so it can sub-allocate GPU buffers.
+// Free ranges are kept in 256 bins indexed by a tiny float (5 bit exponent,
+// 3 bit mantissa) of their size, and two levels of bitmasks find the first
+// non-empty bin that fits a request in O(1). Neighbouring free ranges are
+// merged on free.
+class OffsetAllocator
+{
+public:
+    static const uint32_t NO_SPACE = 0xffffffff;
+
+    struct Allocation
+    {
+        uint32_t offset = NO_SPACE;
+        uint32_t metadata = NO_SPACE; // node index, needed to free
+
+        bool valid() const { return offset != NO_SPACE; }
+    };
+
+    struct StorageReport
+    {
+        uint32_t totalFreeSpace;
+        uint32_t largestFreeRegion;
+    };
+
+    OffsetAllocator(uint32_t size, uint32_t maxAllocs = 64 * 1024)
+        : m_size(size), m_maxAllocs(maxAllocs)
+    {
+        reset();
+    }
+
+    // forget every allocation, the whole range becomes a single free block
+    // ------------------------------------------------------------------------
+    void reset()
+    {
+        m_freeStorage = 0;
+        m_usedBinsTop = 0;
+        m_freeOffset = m_maxAllocs - 1;
+        for (uint32_t i = 0; i < NUM_TOP_BINS; i++)
+            m_usedBins[i] = 0;
+        for (uint32_t i = 0; i < NUM_LEAF_BINS; i++)
+            m_binIndices[i] = Node::UNUSED;
+
+        m_nodes.assign(m_maxAllocs, Node());
+        m_freeNodes.resize(m_maxAllocs);
+        // freelist is a stack, nodes are handed out from the top
+        for (uint32_t i = 0; i < m_maxAllocs; i++)
+            m_freeNodes[i] = m_maxAllocs - i - 1;
+
+        insertNodeIntoBin(m_size, 0);
+    }
+    // ------------------------------------------------------------------------
+    Allocation allocate(uint32_t size)
+    {
+        // out of nodes, or a zero sized request
+        if (m_freeOffset == 0 || size == 0)
+            return {};
+
+        // round up so that every block in the chosen bin is big enough
+        uint32_t minBinIndex = uintToFloatRoundUp(size);
+        uint32_t minTopBinIndex = minBinIndex >> TOP_BINS_INDEX_SHIFT;
+        uint32_t minLeafBinIndex = minBinIndex & LEAF_BINS_INDEX_MASK;
+
+        uint32_t topBinIndex = minTopBinIndex;
+        uint32_t leafBinIndex = NO_SPACE;
+
+        // first try the leaf bins of the same top bin
+        if (m_usedBinsTop & (1u << topBinIndex))
+            leafBinIndex = findLowestSetBitAfter(m_usedBins[topBinIndex], minLeafBinIndex);
+
+        // otherwise any block of a larger top bin fits
+        if (leafBinIndex == NO_SPACE)
+        {
+            if (minTopBinIndex + 1 >= NUM_TOP_BINS)
+                return {};
+            topBinIndex = findLowestSetBitAfter(m_usedBinsTop, minTopBinIndex + 1);
+            if (topBinIndex == NO_SPACE)
+                return {};
+            leafBinIndex = tzcnt(m_usedBins[topBinIndex]);
+        }
+
+        uint32_t binIndex = (topBinIndex << TOP_BINS_INDEX_SHIFT) | leafBinIndex;
+
+        // pop the head of the bin list
+        uint32_t nodeIndex = m_binIndices[binIndex];
+        Node& node = m_nodes[nodeIndex];
+        uint32_t nodeTotalSize = node.dataSize;
+        node.dataSize = size;
+        node.used = true;
+        m_binIndices[binIndex] = node.binListNext;
+        if (node.binListNext != Node::UNUSED)
+            m_nodes[node.binListNext].binListPrev = Node::UNUSED;
+        m_freeStorage -= nodeTotalSize;
+
+        if (m_binIndices[binIndex] == Node::UNUSED)
+        {
+            m_usedBins[topBinIndex] &= ~(1u << leafBinIndex);
+            if (m_usedBins[topBinIndex] == 0)
+                m_usedBinsTop &= ~(1u << topBinIndex);
+        }
+
+        // give the remainder back as a new free block right after this one
+        uint32_t remainderSize = nodeTotalSize - size;
+        if (remainderSize > 0)
+        {
+            uint32_t newNodeIndex = insertNodeIntoBin(remainderSize, node.dataOffset + size);
+
+            if (node.neighborNext != Node::UNUSED)
+                m_nodes[node.neighborNext].neighborPrev = newNodeIndex;
+            m_nodes[newNodeIndex].neighborPrev = nodeIndex;
+            m_nodes[newNodeIndex].neighborNext = node.neighborNext;
+            node.neighborNext = newNodeIndex;
+        }
+
+        Allocation allocation;
+        allocation.offset = node.dataOffset;
+        allocation.metadata = nodeIndex;
+        return allocation;
+    }
+    // ------------------------------------------------------------------------
+    void free(Allocation allocation)
+    {
+        assert(allocation.metadata != NO_SPACE);
+        if (allocation.metadata == NO_SPACE)
+            return;
+
+        uint32_t nodeIndex = allocation.metadata;
+        Node& node = m_nodes[nodeIndex];
+        assert(node.used);
+
+        uint32_t offset = node.dataOffset;
+        uint32_t size = node.dataSize;
+
+        // merge with the previous block if it is free
+        if (node.neighborPrev != Node::UNUSED && !m_nodes[node.neighborPrev].used)
+        {
+            Node& prevNode = m_nodes[node.neighborPrev];
+            offset = prevNode.dataOffset;
+            size += prevNode.dataSize;
+
+            removeNodeFromBin(node.neighborPrev);
+            node.neighborPrev = prevNode.neighborPrev;
+        }
+
+        // and with the next one
+        if (node.neighborNext != Node::UNUSED && !m_nodes[node.neighborNext].used)
+        {
+            Node& nextNode = m_nodes[node.neighborNext];
+            size += nextNode.dataSize;
+
+            removeNodeFromBin(node.neighborNext);
+            node.neighborNext = nextNode.neighborNext;
+        }
+
+        uint32_t neighborNext = node.neighborNext;
+        uint32_t neighborPrev = node.neighborPrev;
+
+        m_freeNodes[++m_freeOffset] = nodeIndex;
+
+        uint32_t combinedNodeIndex = insertNodeIntoBin(size, offset);
+        if (neighborNext != Node::UNUSED)
+        {
+            m_nodes[combinedNodeIndex].neighborNext = neighborNext;
+            m_nodes[neighborNext].neighborPrev = combinedNodeIndex;
+        }
+        if (neighborPrev != Node::UNUSED)
+        {
+            m_nodes[combinedNodeIndex].neighborPrev = neighborPrev;
+            m_nodes[neighborPrev].neighborNext = combinedNodeIndex;
+        }
+    }
+    // ------------------------------------------------------------------------
+    uint32_t allocationSize(Allocation allocation) const
+    {
+        if (allocation.metadata == NO_SPACE)
+            return 0;
+        return m_nodes[allocation.metadata].dataSize;
+    }
+    // ------------------------------------------------------------------------
+    StorageReport storageReport() const
+    {
+        StorageReport report = { 0, 0 };
+        // with no nodes left nothing can be allocated anymore
+        if (m_freeOffset > 0)
+        {
+            report.totalFreeSpace = m_freeStorage;
+            if (m_usedBinsTop)
+            {
+                uint32_t topBinIndex = 31 - lzcnt(m_usedBinsTop);
+                uint32_t leafBinIndex = 31 - lzcnt(m_usedBins[topBinIndex]);
+                uint32_t binIndex = (topBinIndex << TOP_BINS_INDEX_SHIFT) | leafBinIndex;
+                for (uint32_t i = m_binIndices[binIndex]; i != Node::UNUSED; i = m_nodes[i].binListNext)
+                {
+                    if (m_nodes[i].dataSize > report.largestFreeRegion)
+                        report.largestFreeRegion = m_nodes[i].dataSize;
+                }
+            }
+        }
+        return report;
+    }
+    // ------------------------------------------------------------------------
+    uint32_t size() const { return m_size; }
+    uint32_t usedSpace() const { return m_size - m_freeStorage; }
+
+private:
+    static const uint32_t NUM_TOP_BINS = 32;
+    static const uint32_t BINS_PER_LEAF = 8;
+    static const uint32_t TOP_BINS_INDEX_SHIFT = 3;
+    static const uint32_t LEAF_BINS_INDEX_MASK = 0x7;
+    static const uint32_t NUM_LEAF_BINS = NUM_TOP_BINS * BINS_PER_LEAF;
+
+    static const uint32_t MANTISSA_BITS = 3;
+    static const uint32_t MANTISSA_VALUE = 1 << MANTISSA_BITS;
+    static const uint32_t MANTISSA_MASK = MANTISSA_VALUE - 1;
+
+    struct Node
+    {
+        static const uint32_t UNUSED = 0xffffffff;
+
+        uint32_t dataOffset = 0;
+        uint32_t dataSize = 0;
+        uint32_t binListPrev = UNUSED;
+        uint32_t binListNext = UNUSED;
+        uint32_t neighborPrev = UNUSED;
+        uint32_t neighborNext = UNUSED;
+        bool used = false;
+    };
+
+    uint32_t m_size;
+    uint32_t m_maxAllocs;
+    uint32_t m_freeStorage = 0;
+
+    uint32_t m_usedBinsTop = 0;
+    uint8_t m_usedBins[NUM_TOP_BINS];
+    uint32_t m_binIndices[NUM_LEAF_BINS];
+
+    std::vector<Node> m_nodes;
+    std::vector<uint32_t> m_freeNodes;
+    uint32_t m_freeOffset = 0;
+
+    // ------------------------------------------------------------------------
+    static uint32_t lzcnt(uint32_t v)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        return _BitScanReverse(&index, v) ? 31 - index : 32;
+#else
+        return v ? __builtin_clz(v) : 32;
+#endif
+    }
+    static uint32_t tzcnt(uint32_t v)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        return _BitScanForward(&index, v) ? index : 32;
+#else
+        return v ? __builtin_ctz(v) : 32;
+#endif
+    }
+    static uint32_t findLowestSetBitAfter(uint32_t bitMask, uint32_t startBitIndex)
+    {
+        uint32_t maskBeforeStartIndex = (1u << startBitIndex) - 1;
+        uint32_t bitsAfter = bitMask & ~maskBeforeStartIndex;
+        if (bitsAfter == 0)
+            return NO_SPACE;
+        return tzcnt(bitsAfter);
+    }
+    // size -> bin, rounded up: every block in the bin is at least this big
+    static uint32_t uintToFloatRoundUp(uint32_t size)
+    {
+        uint32_t exp = 0;
+        uint32_t mantissa = 0;
+
+        if (size < MANTISSA_VALUE)
+        {
+            // denorm: 0..7
+            mantissa = size;
+        }
+        else
+        {
+            uint32_t highestSetBit = 31 - lzcnt(size);
+            uint32_t mantissaStartBit = highestSetBit - MANTISSA_BITS;
+            exp = mantissaStartBit + 1;
+            mantissa = (size >> mantissaStartBit) & MANTISSA_MASK;
+
+            uint32_t lowBitsMask = (1u << mantissaStartBit) - 1;
+            if ((size & lowBitsMask) != 0)
+                mantissa++;
+        }
+
+        // + allows the mantissa to carry into the exponent
+        return (exp << MANTISSA_BITS) + mantissa;
+    }
+    // size -> bin, rounded down: used to file free blocks
+    static uint32_t uintToFloatRoundDown(uint32_t size)
+    {
+        uint32_t exp = 0;
+        uint32_t mantissa = 0;
+
+        if (size < MANTISSA_VALUE)
+        {
+            mantissa = size;
+        }
+        else
+        {
+            uint32_t highestSetBit = 31 - lzcnt(size);
+            uint32_t mantissaStartBit = highestSetBit - MANTISSA_BITS;
+            exp = mantissaStartBit + 1;
+            mantissa = (size >> mantissaStartBit) & MANTISSA_MASK;
+        }
+
+        return (exp << MANTISSA_BITS) | mantissa;
+    }
+    // ------------------------------------------------------------------------
+    uint32_t insertNodeIntoBin(uint32_t size, uint32_t dataOffset)
+    {
+        uint32_t binIndex = uintToFloatRoundDown(size);
+        uint32_t topBinIndex = binIndex >> TOP_BINS_INDEX_SHIFT;
+        uint32_t leafBinIndex = binIndex & LEAF_BINS_INDEX_MASK;
+
+        // bin was empty before?
+        if (m_binIndices[binIndex] == Node::UNUSED)
+        {
+            m_usedBins[topBinIndex] |= 1u << leafBinIndex;
+            m_usedBinsTop |= 1u << topBinIndex;
+        }
+
+        uint32_t topNodeIndex = m_binIndices[binIndex];
+        uint32_t nodeIndex = m_freeNodes[m_freeOffset--];
+
+        Node node;
+        node.dataOffset = dataOffset;
+        node.dataSize = size;
+        node.binListNext = topNodeIndex;
+        m_nodes[nodeIndex] = node;
+        if (topNodeIndex != Node::UNUSED)
+            m_nodes[topNodeIndex].binListPrev = nodeIndex;
+        m_binIndices[binIndex] = nodeIndex;
+
+        m_freeStorage += size;
+        return nodeIndex;
+    }
+    // ------------------------------------------------------------------------
+    void removeNodeFromBin(uint32_t nodeIndex)
+    {
+        Node& node = m_nodes[nodeIndex];
+
+        if (node.binListPrev != Node::UNUSED)
+        {
+            // easy case: not the head of the bin list
+            m_nodes[node.binListPrev].binListNext = node.binListNext;
+            if (node.binListNext != Node::UNUSED)
+                m_nodes[node.binListNext].binListPrev = node.binListPrev;
+        }
+        else
+        {
+            uint32_t binIndex = uintToFloatRoundDown(node.dataSize);
+            uint32_t topBinIndex = binIndex >> TOP_BINS_INDEX_SHIFT;
+            uint32_t leafBinIndex = binIndex & LEAF_BINS_INDEX_MASK;
+
+            m_binIndices[binIndex] = node.binListNext;
+            if (node.binListNext != Node::UNUSED)
+                m_nodes[node.binListNext].binListPrev = Node::UNUSED;
+
+            if (m_binIndices[binIndex] == Node::UNUSED)
+            {
+                m_usedBins[topBinIndex] &= ~(1u << leafBinIndex);
+                if (m_usedBins[topBinIndex] == 0)
+                    m_usedBinsTop &= ~(1u << topBinIndex);
+            }
+        }
+
+        m_freeNodes[++m_freeOffset] = nodeIndex;
+        m_freeStorage -= node.dataSize;
+    }
+};
+
+#endif
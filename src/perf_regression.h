@@ -0,0 +1,218 @@
+#ifndef PERF_REGRESSION_H
+#define PERF_REGRESSION_H
+
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <ostream>
+#include <algorithm>
+
+// Baselines and noise-aware comparison for tools/gl_regress. A metric is
+// measured once per run; what is compared is the median over the runs, and
+// the spread it is allowed is taken from the median absolute deviation of
+// the baseline's runs and the current ones, so a noisy metric needs a
+// bigger change to count than a stable one.
+
+enum class PerfMetricKind : uint8_t
+{
+    Milliseconds, // smaller is better, noisy
+    Count,        // smaller is better, normally the same every run
+};
+
+// one metric's samples, one per run
+struct PerfMetric
+{
+    std::string name; // "scene.metric"
+    PerfMetricKind kind = PerfMetricKind::Milliseconds;
+    std::vector<double> samples;
+
+    // ------------------------------------------------------------------------
+    double median() const { return medianOf(samples); }
+    double mad() const
+    {
+        double m = median();
+        std::vector<double> deviations;
+        for (double sample : samples)
+            deviations.push_back(std::fabs(sample - m));
+        return medianOf(deviations);
+    }
+
+    // ------------------------------------------------------------------------
+    static double medianOf(std::vector<double> values)
+    {
+        if (values.empty())
+            return 0.0;
+        std::sort(values.begin(), values.end());
+        size_t half = values.size() / 2;
+        return values.size() % 2 ? values[half] : 0.5 * (values[half - 1] + values[half]);
+    }
+};
+
+// a metric as the baseline file stores it
+struct PerfBaselineEntry
+{
+    std::string name;
+    double median;
+    double mad;
+    uint32_t runs;
+};
+
+// The committed baseline: "# comment" lines, then one "name median mad runs"
+// line per metric.
+class PerfBaseline
+{
+public:
+    std::vector<PerfBaselineEntry> entries;
+    std::string renderer; // from the "# renderer: " comment, informational
+
+    // false if the file cannot be read or has a malformed line
+    // ------------------------------------------------------------------------
+    bool load(const char* path)
+    {
+        std::ifstream in(path);
+        if (!in)
+            return false;
+        entries.clear();
+        std::string line;
+        while (std::getline(in, line))
+        {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+            if (line.compare(0, 12, "# renderer: ") == 0)
+                renderer = line.substr(12);
+            if (line.empty() || line[0] == '#')
+                continue;
+            std::istringstream fields(line);
+            PerfBaselineEntry entry;
+            if (!(fields >> entry.name >> entry.median >> entry.mad >> entry.runs))
+                return false;
+            entries.push_back(entry);
+        }
+        return true;
+    }
+    // ------------------------------------------------------------------------
+    bool save(const char* path) const
+    {
+        std::ofstream out(path);
+        out << "# GL performance baseline, rewrite with gl_regress --update\n";
+        out << "# renderer: " << renderer << "\n";
+        out << "# metric median mad runs\n";
+        char line[256];
+        for (const PerfBaselineEntry& entry : entries)
+        {
+            snprintf(line, sizeof(line), "%s %.4f %.4f %u\n", entry.name.c_str(), entry.median, entry.mad, entry.runs);
+            out << line;
+        }
+        return (bool)out;
+    }
+
+    // ------------------------------------------------------------------------
+    const PerfBaselineEntry* find(const std::string& name) const
+    {
+        for (const PerfBaselineEntry& entry : entries)
+        {
+            if (entry.name == name)
+                return &entry;
+        }
+        return nullptr;
+    }
+};
+
+// how much worse than the baseline a median may get
+struct PerfThresholds
+{
+    double relative = 0.10;          // of the baseline median
+    double sigmas = 3.0;             // of the noise, 1.4826 * MAD estimates one sigma
+    double minMilliseconds = 0.02;   // changes below this are timer noise
+    double minCount = 0.5;           // any whole extra call or byte counts
+};
+
+enum class PerfVerdict : uint8_t
+{
+    Ok,
+    Regressed,
+    Improved,
+    New,     // not in the baseline
+    Missing, // in the baseline, not measured
+};
+
+struct PerfComparison
+{
+    std::string name;
+    double baseline;
+    double current;
+    double limit; // the largest increase that still passes
+    PerfVerdict verdict;
+};
+
+// ----------------------------------------------------------------------------
+inline PerfComparison comparePerfMetric(const PerfMetric& metric, const PerfBaselineEntry* baseline, const PerfThresholds& thresholds)
+{
+    PerfComparison comparison = { metric.name, 0.0, metric.median(), 0.0, PerfVerdict::New };
+    if (!baseline)
+        return comparison;
+    comparison.baseline = baseline->median;
+    double noise = 1.4826 * std::max(baseline->mad, metric.mad());
+    if (metric.kind == PerfMetricKind::Count)
+        comparison.limit = std::max(thresholds.sigmas * noise, thresholds.minCount);
+    else
+    {
+        comparison.limit = std::max(std::max(thresholds.relative * baseline->median, thresholds.sigmas * noise),
+            thresholds.minMilliseconds);
+    }
+    double delta = comparison.current - comparison.baseline;
+    comparison.verdict = delta > comparison.limit ? PerfVerdict::Regressed
+        : delta < -comparison.limit ? PerfVerdict::Improved : PerfVerdict::Ok;
+    return comparison;
+}
+
+// every measured metric against the baseline, then the baseline's metrics
+// that were not measured
+// ----------------------------------------------------------------------------
+inline std::vector<PerfComparison> comparePerfMetrics(const std::vector<PerfMetric>& metrics, const PerfBaseline& baseline,
+    const PerfThresholds& thresholds)
+{
+    std::vector<PerfComparison> comparisons;
+    for (const PerfMetric& metric : metrics)
+        comparisons.push_back(comparePerfMetric(metric, baseline.find(metric.name), thresholds));
+    for (const PerfBaselineEntry& entry : baseline.entries)
+    {
+        bool measured = std::any_of(metrics.begin(), metrics.end(), [&entry](const PerfMetric& metric) {
+            return metric.name == entry.name;
+        });
+        if (!measured)
+            comparisons.push_back(PerfComparison{ entry.name, entry.median, 0.0, 0.0, PerfVerdict::Missing });
+    }
+    return comparisons;
+}
+
+// ----------------------------------------------------------------------------
+inline const char* perfVerdictName(PerfVerdict verdict)
+{
+    static const char* const names[] = { "ok", "REGRESSED", "improved", "new", "missing" };
+    return names[(size_t)verdict];
+}
+
+// a table, one line per metric
+// ----------------------------------------------------------------------------
+inline void writePerfReport(std::ostream& out, const std::vector<PerfComparison>& comparisons)
+{
+    char line[256];
+    snprintf(line, sizeof(line), "%-34s %12s %12s %9s %9s  %s\n", "metric", "baseline", "current", "change", "limit", "result");
+    out << line;
+    for (const PerfComparison& c : comparisons)
+    {
+        bool compared = c.verdict != PerfVerdict::New && c.verdict != PerfVerdict::Missing;
+        double percent = compared && c.baseline > 0.0 ? 100.0 * (c.current - c.baseline) / c.baseline : 0.0;
+        double limitPercent = compared && c.baseline > 0.0 ? 100.0 * c.limit / c.baseline : 0.0;
+        snprintf(line, sizeof(line), "%-34s %12.4f %12.4f %+8.1f%% %+8.1f%%  %s\n", c.name.c_str(), c.baseline, c.current,
+            percent, limitPercent, perfVerdictName(c.verdict));
+        out << line;
+    }
+}
+
+#endif
@@ -0,0 +1,295 @@
+#ifndef PNG_WRITER_H
+#define PNG_WRITER_H
+
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+
+// PNG encoder for frame captures and golden images. Every row gets the PNG
+// filter with the smallest sum of absolute differences, the filtered rows go
+// through one deflate block with the fixed Huffman codes and a single
+// candidate LZ77 match per position. Files come out larger than from a full
+// deflate but any decoder reads them, and encoding a 800x600 frame takes a
+// few milliseconds on a worker.
+namespace png
+{
+    static const uint32_t WINDOW = 32768;
+    static const uint32_t HASH_BITS = 15;
+    static const uint32_t MIN_MATCH = 3;
+    static const uint32_t MAX_MATCH = 258;
+
+    // ------------------------------------------------------------------------
+    inline uint32_t crc32(const uint8_t* data, size_t size, uint32_t crc = 0)
+    {
+        // built once, also when the first frames are encoded on several workers at once
+        struct Table
+        {
+            uint32_t entries[256];
+            Table()
+            {
+                for (uint32_t n = 0; n < 256; n++)
+                {
+                    uint32_t c = n;
+                    for (int k = 0; k < 8; k++)
+                        c = c & 1 ? 0xedb88320u ^ (c >> 1) : c >> 1;
+                    entries[n] = c;
+                }
+            }
+        };
+        static const Table table;
+        crc = ~crc;
+        for (size_t i = 0; i < size; i++)
+            crc = table.entries[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    // ------------------------------------------------------------------------
+    inline uint32_t adler32(const uint8_t* data, size_t size)
+    {
+        uint32_t a = 1, b = 0;
+        while (size)
+        {
+            // 5552 bytes is the most that cannot overflow before the modulo
+            size_t run = size < 5552 ? size : 5552;
+            for (size_t i = 0; i < run; i++)
+            {
+                a += data[i];
+                b += a;
+            }
+            a %= 65521;
+            b %= 65521;
+            data += run;
+            size -= run;
+        }
+        return (b << 16) | a;
+    }
+
+    // deflate writes its bits least significant first
+    class BitWriter
+    {
+    public:
+        explicit BitWriter(std::vector<uint8_t>& out) : m_out(out) {}
+
+        // ------------------------------------------------------------------------
+        void bits(uint32_t value, uint32_t count)
+        {
+            m_buffer |= (uint64_t)value << m_count;
+            m_count += count;
+            while (m_count >= 8)
+            {
+                m_out.push_back((uint8_t)m_buffer);
+                m_buffer >>= 8;
+                m_count -= 8;
+            }
+        }
+        // Huffman codes go most significant bit first
+        void code(uint32_t code, uint32_t length)
+        {
+            uint32_t reversed = 0;
+            for (uint32_t i = 0; i < length; i++)
+                reversed |= ((code >> i) & 1) << (length - 1 - i);
+            bits(reversed, length);
+        }
+        void flush()
+        {
+            if (m_count)
+                m_out.push_back((uint8_t)m_buffer);
+            m_buffer = 0;
+            m_count = 0;
+        }
+
+    private:
+        std::vector<uint8_t>& m_out;
+        uint64_t m_buffer = 0;
+        uint32_t m_count = 0;
+    };
+
+    // the fixed literal/length code of RFC 1951 3.2.6
+    // ------------------------------------------------------------------------
+    inline void writeSymbol(BitWriter& out, uint32_t symbol)
+    {
+        if (symbol < 144)
+            out.code(0x30 + symbol, 8);
+        else if (symbol < 256)
+            out.code(0x190 + symbol - 144, 9);
+        else if (symbol < 280)
+            out.code(symbol - 256, 7);
+        else
+            out.code(0xc0 + symbol - 280, 8);
+    }
+
+    // ------------------------------------------------------------------------
+    inline void writeMatch(BitWriter& out, uint32_t length, uint32_t distance)
+    {
+        static const uint16_t lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+            35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+        static const uint8_t lengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+            3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+        static const uint16_t distanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+            257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+        static const uint8_t distanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+            7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+        uint32_t l = 28;
+        while (lengthBase[l] > length)
+            l--;
+        writeSymbol(out, 257 + l);
+        out.bits(length - lengthBase[l], lengthExtra[l]);
+        uint32_t d = 29;
+        while (distanceBase[d] > distance)
+            d--;
+        out.code(d, 5);
+        out.bits(distance - distanceBase[d], distanceExtra[d]);
+    }
+
+    // a zlib stream of one fixed Huffman block
+    // ------------------------------------------------------------------------
+    inline void zlibCompress(const uint8_t* data, size_t size, std::vector<uint8_t>& out)
+    {
+        out.push_back(0x78);
+        out.push_back(0x01);
+        BitWriter bits(out);
+        bits.bits(1, 1); // final block
+        bits.bits(1, 2); // fixed Huffman codes
+
+        std::vector<int32_t> head((size_t)1 << HASH_BITS, -1);
+        size_t i = 0;
+        while (i < size)
+        {
+            uint32_t length = 0;
+            uint32_t distance = 0;
+            if (i + MIN_MATCH <= size)
+            {
+                uint32_t hash = ((data[i] << 16 | data[i + 1] << 8 | data[i + 2]) * 2654435761u) >> (32 - HASH_BITS);
+                int32_t candidate = head[hash];
+                head[hash] = (int32_t)i;
+                if (candidate >= 0 && i - candidate <= WINDOW)
+                {
+                    size_t limit = std::min<size_t>(MAX_MATCH, size - i);
+                    while (length < limit && data[candidate + length] == data[i + length])
+                        length++;
+                    distance = (uint32_t)(i - candidate);
+                }
+            }
+            if (length >= MIN_MATCH)
+            {
+                writeMatch(bits, length, distance);
+                i += length;
+            }
+            else
+                writeSymbol(bits, data[i++]);
+        }
+        writeSymbol(bits, 256);
+        bits.flush();
+
+        uint32_t adler = adler32(data, size);
+        for (int shift = 24; shift >= 0; shift -= 8)
+            out.push_back((uint8_t)(adler >> shift));
+    }
+
+    // ------------------------------------------------------------------------
+    inline uint8_t paeth(int a, int b, int c)
+    {
+        int p = a + b - c;
+        int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+        return (uint8_t)(pa <= pb && pa <= pc ? a : pb <= pc ? b : c);
+    }
+
+    // one row filtered with type into out, returns the sum the heuristic minimises
+    // ------------------------------------------------------------------------
+    inline uint32_t filterRow(uint8_t type, const uint8_t* row, const uint8_t* above, size_t bytes, int bpp, uint8_t* out)
+    {
+        uint32_t cost = 0;
+        for (size_t x = 0; x < bytes; x++)
+        {
+            int a = x >= (size_t)bpp ? row[x - bpp] : 0;
+            int b = above ? above[x] : 0;
+            int c = above && x >= (size_t)bpp ? above[x - bpp] : 0;
+            uint8_t predicted = type == 1 ? (uint8_t)a : type == 2 ? (uint8_t)b
+                : type == 3 ? (uint8_t)((a + b) / 2) : type == 4 ? paeth(a, b, c) : 0;
+            out[x] = (uint8_t)(row[x] - predicted);
+            cost += (uint32_t)abs((int8_t)out[x]);
+        }
+        return cost;
+    }
+
+    // ------------------------------------------------------------------------
+    inline void writeChunk(std::vector<uint8_t>& out, const char* type, const uint8_t* data, size_t size)
+    {
+        for (int shift = 24; shift >= 0; shift -= 8)
+            out.push_back((uint8_t)(size >> shift));
+        size_t start = out.size();
+        out.insert(out.end(), type, type + 4);
+        out.insert(out.end(), data, data + size);
+        uint32_t crc = crc32(out.data() + start, out.size() - start);
+        for (int shift = 24; shift >= 0; shift -= 8)
+            out.push_back((uint8_t)(crc >> shift));
+    }
+}
+
+// 8 bit grey, grey + alpha, RGB or RGBA by channels. stride 0 means tightly
+// packed rows; bottomUp takes the rows last to first, as glReadPixels
+// returns them.
+// ----------------------------------------------------------------------------
+inline std::vector<uint8_t> encodePng(const uint8_t* pixels, int width, int height, int channels, bool bottomUp = false,
+    size_t stride = 0)
+{
+    static const uint8_t colorTypes[5] = { 0, 0, 4, 2, 6 };
+    size_t rowBytes = (size_t)width * channels;
+    if (!stride)
+        stride = rowBytes;
+
+    std::vector<uint8_t> filtered;
+    filtered.reserve((rowBytes + 1) * height);
+    std::vector<uint8_t> candidate(rowBytes);
+    std::vector<uint8_t> best(rowBytes);
+    const uint8_t* above = nullptr;
+    for (int y = 0; y < height; y++)
+    {
+        const uint8_t* row = pixels + stride * (bottomUp ? height - 1 - y : y);
+        uint32_t bestCost = UINT32_MAX;
+        uint8_t bestType = 0;
+        for (uint8_t type = 0; type < 5; type++)
+        {
+            uint32_t cost = png::filterRow(type, row, above, rowBytes, channels, candidate.data());
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestType = type;
+                best.swap(candidate);
+            }
+        }
+        filtered.push_back(bestType);
+        filtered.insert(filtered.end(), best.begin(), best.end());
+        above = row;
+    }
+
+    std::vector<uint8_t> out = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    uint8_t header[13] = {
+        (uint8_t)(width >> 24), (uint8_t)(width >> 16), (uint8_t)(width >> 8), (uint8_t)width,
+        (uint8_t)(height >> 24), (uint8_t)(height >> 16), (uint8_t)(height >> 8), (uint8_t)height,
+        8, colorTypes[channels], 0, 0, 0,
+    };
+    png::writeChunk(out, "IHDR", header, sizeof(header));
+    std::vector<uint8_t> compressed;
+    png::zlibCompress(filtered.data(), filtered.size(), compressed);
+    png::writeChunk(out, "IDAT", compressed.data(), compressed.size());
+    png::writeChunk(out, "IEND", nullptr, 0);
+    return out;
+}
+
+// ----------------------------------------------------------------------------
+inline bool savePng(const char* path, const uint8_t* pixels, int width, int height, int channels, bool bottomUp = false,
+    size_t stride = 0)
+{
+    std::vector<uint8_t> file = encodePng(pixels, width, height, channels, bottomUp, stride);
+    FILE* out = fopen(path, "wb");
+    if (!out)
+        return false;
+    bool ok = fwrite(file.data(), file.size(), 1, out) == 1;
+    return fclose(out) == 0 && ok;
+}
+
+#endif
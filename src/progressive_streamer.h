@@ -0,0 +1,405 @@
+#ifndef PROGRESSIVE_STREAMER_H
+#define PROGRESSIVE_STREAMER_H
+
+#include <glad/glad.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+
+#include "gl_verify.h"
+#include "thread_pool.h"
+#include "block_compression.h"
+
+// per frame numbers, reset at the start of every update()
+struct ProgressiveStreamStats
+{
+    uint64_t uploadedBytes = 0;
+    uint32_t levelsUploaded = 0;
+    uint32_t readsInFlight = 0;
+    uint32_t streamingTextures = 0; // resident levels still coarser than wanted
+};
+
+// Streams baked mip chains (.bct) smallest level first.
+//
+// A worker reads the level table and the small tail of the chain (every level
+// up to tailDimension) in one go; update() uploads the tail and clamps
+// sampling to it with GL_TEXTURE_BASE_LEVEL/GL_TEXTURE_MAX_LEVEL, so the
+// texture is usable at low resolution one or two frames after request().
+// Then one level at a time is read and uploaded, each lowering BASE_LEVEL by
+// one. Textures whose resident resolution lags furthest behind their size on
+// screen (setScreenSize()) go first, and nothing finer than the screen needs
+// is loaded. Levels are specified one by one rather than with immutable
+// storage so that unloaded levels take no memory.
+class ProgressiveTextureStreamer
+{
+public:
+    ProgressiveTextureStreamer(ThreadPool& pool, const BlockCompressionSupport& support,
+        size_t frameBudgetBytes = 4 * 1024 * 1024, int tailDimension = 64, int maxReadsInFlight = 4)
+        : m_pool(pool), m_support(support), m_frameBudgetBytes(frameBudgetBytes),
+          m_tailDimension(tailDimension), m_maxReadsInFlight(maxReadsInFlight)
+    {
+    }
+    ~ProgressiveTextureStreamer()
+    {
+        release();
+    }
+    ProgressiveTextureStreamer(const ProgressiveTextureStreamer&) = delete;
+    ProgressiveTextureStreamer& operator=(const ProgressiveTextureStreamer&) = delete;
+
+    // GL thread only. Levels are read from the file as they are needed. The
+    // texture holds one grey texel until the tail is in and is left bound.
+    // ------------------------------------------------------------------------
+    GLuint request(const std::string& path)
+    {
+        return start(std::make_shared<Source>(path, std::vector<uint8_t>()));
+    }
+    // same for a .bct file already in memory, path is only used as a name
+    // ------------------------------------------------------------------------
+    GLuint request(const std::string& path, std::vector<uint8_t> fileData)
+    {
+        return start(std::make_shared<Source>(path, std::move(fileData)));
+    }
+    // longest edge of the texture on screen in pixels, picks the finest level
+    // worth loading and the order textures are refined in
+    // ------------------------------------------------------------------------
+    void setScreenSize(GLuint texture, float pixels)
+    {
+        auto it = m_entries.find(texture);
+        if (it != m_entries.end())
+            it->second->screenSize = pixels;
+    }
+    // stops streaming into the texture, which is not deleted
+    // ------------------------------------------------------------------------
+    void cancel(GLuint texture)
+    {
+        m_entries.erase(texture);
+    }
+    // GL thread, once per frame
+    // ------------------------------------------------------------------------
+    void update()
+    {
+        m_stats = ProgressiveStreamStats();
+        size_t budget = m_frameBudgetBytes;
+
+        std::vector<Entry*> candidates;
+        for (auto it = m_entries.begin(); it != m_entries.end(); )
+        {
+            Entry& entry = *it->second;
+            int state = entry.state.load();
+            if (state == Entry::FAILED)
+            {
+                it = m_entries.erase(it);
+                continue;
+            }
+            if (state == Entry::TAIL_READ)
+                uploadTail(entry);
+            if (entry.state == Entry::READY)
+            {
+                if (entry.read && entry.read->done)
+                    uploadLevel(entry, budget);
+                int wanted = wantedLevel(entry);
+                if (entry.baseLevel > wanted)
+                {
+                    m_stats.streamingTextures++;
+                    if (!entry.read)
+                        candidates.push_back(&entry);
+                }
+            }
+            if (entry.read)
+                m_stats.readsInFlight++;
+            ++it;
+        }
+
+        // furthest behind first, then biggest on screen
+        std::sort(candidates.begin(), candidates.end(), [this](const Entry* a, const Entry* b) {
+            int lagA = a->baseLevel - wantedLevel(*a);
+            int lagB = b->baseLevel - wantedLevel(*b);
+            if (lagA != lagB)
+                return lagA > lagB;
+            return a->screenSize > b->screenSize;
+        });
+        for (Entry* entry : candidates)
+        {
+            if ((int)m_stats.readsInFlight >= m_maxReadsInFlight)
+                break;
+            readLevel(*entry, entry->baseLevel - 1);
+            m_stats.readsInFlight++;
+        }
+    }
+    // ------------------------------------------------------------------------
+    const ProgressiveStreamStats& frameStats() const { return m_stats; }
+
+    // nothing left to load at the current screen sizes
+    // ------------------------------------------------------------------------
+    bool idle() const
+    {
+        for (const auto& it : m_entries)
+        {
+            const Entry& entry = *it.second;
+            if (entry.state != Entry::READY || entry.read || entry.baseLevel > wantedLevel(entry))
+                return false;
+        }
+        return true;
+    }
+    // ------------------------------------------------------------------------
+    bool streaming(GLuint texture) const { return m_entries.count(texture) != 0; }
+    // finest level resident now, -1 before the tail is in
+    // ------------------------------------------------------------------------
+    int residentLevel(GLuint texture) const
+    {
+        auto it = m_entries.find(texture);
+        if (it == m_entries.end() || it->second->state != Entry::READY)
+            return -1;
+        return it->second->baseLevel;
+    }
+    void setFrameBudgetBytes(size_t bytes) { m_frameBudgetBytes = std::max<size_t>(bytes, 1); }
+
+    // drops every job, the textures stay
+    // ------------------------------------------------------------------------
+    void release()
+    {
+        // workers only touch the shared job objects, nothing to wait for
+        m_entries.clear();
+    }
+
+private:
+    // where the .bct bytes come from, shared with the workers
+    struct Source
+    {
+        std::string path;
+        std::vector<uint8_t> bytes; // whole file, or empty to read from path
+
+        Source(const std::string& path, std::vector<uint8_t> bytes) : path(path), bytes(std::move(bytes)) {}
+
+        // reads `size` bytes at `offset`
+        bool read(size_t offset, void* out, size_t size) const
+        {
+            if (!bytes.empty())
+            {
+                if (offset + size > bytes.size())
+                    return false;
+                memcpy(out, bytes.data() + offset, size);
+                return true;
+            }
+            FILE* file = fopen(path.c_str(), "rb");
+            if (!file)
+                return false;
+            bool ok = fseek(file, (long)offset, SEEK_SET) == 0 && fread(out, size, 1, file) == 1;
+            fclose(file);
+            return ok;
+        }
+    };
+    struct LevelInfo
+    {
+        int width;
+        int height;
+        size_t offset; // of the blocks in the file
+        size_t size;
+    };
+    struct LevelRead
+    {
+        int level = 0;
+        std::vector<uint8_t> data; // blocks, or RGBA8 when the format is not native
+        bool ok = false;
+        std::atomic<bool> done{ false };
+    };
+    struct Entry
+    {
+        enum State
+        {
+            READING_TAIL,
+            TAIL_READ,
+            READY,
+            FAILED,
+        };
+        std::shared_ptr<Source> source;
+        GLuint texture = 0;
+        BlockFormat format = BlockFormat::BC1;
+        bool native = true;
+        std::vector<LevelInfo> levels;
+        std::vector<std::vector<uint8_t>> tail; // data of levels tailLevel.., ready for upload
+        int tailLevel = 0;
+        int baseLevel = 0;                      // finest resident level
+        float screenSize = 1e30f;               // unknown means full resolution
+        std::shared_ptr<LevelRead> read;        // the level in flight, one at a time
+        std::atomic<int> state{ READING_TAIL };
+    };
+
+    ThreadPool& m_pool;
+    BlockCompressionSupport m_support;
+    size_t m_frameBudgetBytes;
+    int m_tailDimension;
+    int m_maxReadsInFlight;
+    std::unordered_map<GLuint, std::shared_ptr<Entry>> m_entries;
+    ProgressiveStreamStats m_stats;
+
+    // ------------------------------------------------------------------------
+    GLuint start(std::shared_ptr<Source> source)
+    {
+        std::shared_ptr<Entry> entry = std::make_shared<Entry>();
+        entry->source = source;
+        entry->native = true;
+
+        static const uint8_t grey[4] = { 128, 128, 128, 255 };
+        GL_VERIFY(glGenTextures(1, &entry->texture));
+        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, entry->texture));
+        GL_VERIFY(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, grey));
+        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0));
+
+        BlockCompressionSupport support = m_support;
+        int tailDimension = m_tailDimension;
+        m_pool.submit([entry, support, tailDimension] {
+            if (!readLayout(*entry))
+            {
+                entry->state = Entry::FAILED;
+                return;
+            }
+            entry->native = support.supports(entry->format);
+            // the tail: every level no bigger than tailDimension, and at least the last one
+            int count = (int)entry->levels.size();
+            int tailLevel = count - 1;
+            while (tailLevel > 0 && std::max(entry->levels[tailLevel - 1].width, entry->levels[tailLevel - 1].height) <= tailDimension)
+                tailLevel--;
+            for (int level = tailLevel; level < count; level++)
+            {
+                std::vector<uint8_t> data;
+                if (!readLevelData(*entry, level, data))
+                {
+                    entry->state = Entry::FAILED;
+                    return;
+                }
+                entry->tail.push_back(std::move(data));
+            }
+            entry->tailLevel = tailLevel;
+            entry->state = Entry::TAIL_READ;
+        });
+        m_entries[entry->texture] = entry;
+        return entry->texture;
+    }
+    // the .bct level table, see saveCompressedTexture()
+    // ------------------------------------------------------------------------
+    static bool readLayout(Entry& entry)
+    {
+        uint32_t header[3];
+        if (!entry.source->read(0, header, sizeof(header)) || header[0] != 0x31544342 ||
+            header[1] > (uint32_t)BlockFormat::BC7 || header[2] == 0 || header[2] > 32)
+            return false;
+        entry.format = (BlockFormat)header[1];
+        size_t offset = sizeof(header);
+        for (uint32_t i = 0; i < header[2]; i++)
+        {
+            uint32_t levelHeader[3];
+            if (!entry.source->read(offset, levelHeader, sizeof(levelHeader)))
+                return false;
+            LevelInfo level;
+            level.width = (int)levelHeader[0];
+            level.height = (int)levelHeader[1];
+            level.offset = offset + sizeof(levelHeader);
+            level.size = levelHeader[2];
+            if (level.size != compressedLevelSize(entry.format, level.width, level.height))
+                return false;
+            entry.levels.push_back(level);
+            offset = level.offset + level.size;
+        }
+        return true;
+    }
+    // worker side: the blocks of one level, decoded when the driver lacks the format
+    // ------------------------------------------------------------------------
+    static bool readLevelData(const Entry& entry, int level, std::vector<uint8_t>& data)
+    {
+        const LevelInfo& info = entry.levels[level];
+        data.resize(info.size);
+        if (!entry.source->read(info.offset, data.data(), info.size))
+            return false;
+        if (!entry.native)
+            data = decompressImage(data.data(), info.width, info.height, entry.format);
+        return true;
+    }
+    // finest level whose size still covers the screen size
+    // ------------------------------------------------------------------------
+    static int wantedLevel(const Entry& entry)
+    {
+        int level = 0;
+        while (level + 1 < (int)entry.levels.size() &&
+               std::max(entry.levels[level + 1].width, entry.levels[level + 1].height) >= entry.screenSize)
+            level++;
+        return std::min(level, entry.tailLevel);
+    }
+    // ------------------------------------------------------------------------
+    void specifyLevel(const Entry& entry, int level, const std::vector<uint8_t>& data)
+    {
+        const LevelInfo& info = entry.levels[level];
+        if (entry.native)
+        {
+            GL_VERIFY(glCompressedTexImage2D(GL_TEXTURE_2D, level, glCompressedFormat(entry.format),
+                info.width, info.height, 0, (GLsizei)data.size(), data.data()));
+        }
+        else
+        {
+            GL_VERIFY(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+            GL_VERIFY(glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, info.width, info.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data.data()));
+            GL_VERIFY(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+        }
+        m_stats.uploadedBytes += data.size();
+        m_stats.levelsUploaded++;
+    }
+    // the tail goes up whole, whatever the budget says
+    // ------------------------------------------------------------------------
+    void uploadTail(Entry& entry)
+    {
+        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, entry.texture));
+        for (size_t i = 0; i < entry.tail.size(); i++)
+            specifyLevel(entry, entry.tailLevel + (int)i, entry.tail[i]);
+        entry.tail.clear();
+        entry.baseLevel = entry.tailLevel;
+        // the placeholder at level 0 stays until replaced, outside the sampled range
+        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, entry.baseLevel));
+        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint)entry.levels.size() - 1));
+        entry.state = Entry::READY;
+    }
+    // ------------------------------------------------------------------------
+    void readLevel(Entry& entry, int level)
+    {
+        std::shared_ptr<LevelRead> read = std::make_shared<LevelRead>();
+        read->level = level;
+        entry.read = read;
+
+        // the worker gets what it needs by value, the entry may be cancelled meanwhile
+        std::shared_ptr<Entry> job = m_entries[entry.texture];
+        m_pool.submit([job, read] {
+            read->ok = readLevelData(*job, read->level, read->data);
+            read->done = true;
+        });
+    }
+    // one level per texture per frame, once it fits the budget (the first always does)
+    // ------------------------------------------------------------------------
+    void uploadLevel(Entry& entry, size_t& budget)
+    {
+        LevelRead& read = *entry.read;
+        if (!read.ok)
+        {
+            // keep what we have, stop refining
+            entry.screenSize = (float)std::max(entry.levels[entry.baseLevel].width, entry.levels[entry.baseLevel].height);
+            entry.read.reset();
+            return;
+        }
+        if (read.data.size() > budget && budget < m_frameBudgetBytes)
+            return;
+
+        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, entry.texture));
+        specifyLevel(entry, read.level, read.data);
+        entry.baseLevel = read.level;
+        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, entry.baseLevel));
+        budget = read.data.size() >= budget ? 0 : budget - read.data.size();
+        entry.read.reset();
+    }
+};
+
+#endif
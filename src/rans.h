@@ -0,0 +1,222 @@
+#ifndef RANS_H
+#define RANS_H
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+// Order-0 byte entropy coder (rANS with byte-wise renormalization).
+//
+// ransEncode() appends one self-delimiting stream to a buffer and
+// ransDecode() reads it back from a cursor, so several streams can simply be
+// concatenated. Frequencies are normalized to 12 bits and stored up front;
+// a stream of a single repeated byte costs a few bytes and streams that do not
+// compress are stored raw.
+namespace rans
+{
+    static const uint32_t PROB_BITS = 12;
+    static const uint32_t PROB_SCALE = 1u << PROB_BITS;
+    static const uint32_t LOWER_BOUND = 1u << 23; // state stays in [L, L << 8)
+
+    enum Mode : uint8_t
+    {
+        RAW = 0,
+        SINGLE = 1, // every byte the same
+        CODED = 2,
+    };
+
+    // ------------------------------------------------------------------------
+    inline void writeVarint(std::vector<uint8_t>& out, uint32_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back((uint8_t)(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back((uint8_t)value);
+    }
+    inline bool readVarint(const uint8_t*& cursor, const uint8_t* end, uint32_t& value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 35; shift += 7)
+        {
+            if (cursor == end)
+                return false;
+            uint8_t byte = *cursor++;
+            value |= (uint32_t)(byte & 0x7f) << shift;
+            if (!(byte & 0x80))
+                return true;
+        }
+        return false;
+    }
+
+    // scales the histogram to PROB_SCALE, every present symbol keeps at least 1
+    // ------------------------------------------------------------------------
+    inline void normalizeFrequencies(const uint32_t counts[256], size_t total, uint32_t freqs[256])
+    {
+        int64_t sum = 0;
+        for (int s = 0; s < 256; s++)
+        {
+            freqs[s] = counts[s] ? std::max<uint32_t>(1, (uint32_t)((uint64_t)counts[s] * PROB_SCALE / total)) : 0;
+            sum += freqs[s];
+        }
+        // rounding is settled on the most frequent symbols, they mind the least
+        while (sum != PROB_SCALE)
+        {
+            int largest = -1;
+            for (int s = 0; s < 256; s++)
+            {
+                if (freqs[s] > (sum > PROB_SCALE ? 1u : 0u) && (largest < 0 || freqs[s] > freqs[largest]))
+                    largest = s;
+            }
+            int64_t step = sum > PROB_SCALE ? -1 : 1;
+            freqs[largest] += (uint32_t)step;
+            sum += step;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+inline void ransEncode(const uint8_t* data, size_t count, std::vector<uint8_t>& out)
+{
+    using namespace rans;
+    writeVarint(out, (uint32_t)count);
+    if (count == 0)
+        return;
+
+    uint32_t counts[256] = {};
+    for (size_t i = 0; i < count; i++)
+        counts[data[i]]++;
+    int symbols = 0;
+    for (int s = 0; s < 256; s++)
+        symbols += counts[s] != 0;
+    if (symbols == 1)
+    {
+        out.push_back(SINGLE);
+        out.push_back(data[0]);
+        return;
+    }
+
+    uint32_t freqs[256], starts[256];
+    normalizeFrequencies(counts, count, freqs);
+    for (uint32_t s = 0, start = 0; s < 256; s++)
+    {
+        starts[s] = start;
+        start += freqs[s];
+    }
+
+    // symbols go in back to front so the decoder reads front to back; the
+    // bytes come out reversed as well
+    std::vector<uint8_t> reversed;
+    reversed.reserve(count + 16);
+    uint32_t x = LOWER_BOUND;
+    for (size_t i = count; i-- > 0; )
+    {
+        uint32_t freq = freqs[data[i]];
+        uint32_t limit = ((LOWER_BOUND >> PROB_BITS) << 8) * freq;
+        while (x >= limit)
+        {
+            reversed.push_back((uint8_t)x);
+            x >>= 8;
+        }
+        x = ((x / freq) << PROB_BITS) + (x % freq) + starts[data[i]];
+    }
+    for (int shift = 24; shift >= 0; shift -= 8)
+        reversed.push_back((uint8_t)(x >> shift));
+
+    // symbol table: count, then (symbol, frequency) pairs
+    std::vector<uint8_t> table;
+    table.push_back((uint8_t)(symbols - 1));
+    for (int s = 0; s < 256; s++)
+    {
+        if (freqs[s])
+        {
+            table.push_back((uint8_t)s);
+            writeVarint(table, freqs[s]);
+        }
+    }
+    if (table.size() + reversed.size() + 5 >= count)
+    {
+        out.push_back(RAW);
+        out.insert(out.end(), data, data + count);
+        return;
+    }
+    out.push_back(CODED);
+    out.insert(out.end(), table.begin(), table.end());
+    writeVarint(out, (uint32_t)reversed.size());
+    out.insert(out.end(), reversed.rbegin(), reversed.rend());
+}
+
+// reads one ransEncode() stream at cursor and moves past it, false on damaged input
+// ----------------------------------------------------------------------------
+inline bool ransDecode(const uint8_t*& cursor, const uint8_t* end, std::vector<uint8_t>& out)
+{
+    using namespace rans;
+    uint32_t count;
+    if (!readVarint(cursor, end, count))
+        return false;
+    out.resize(count);
+    if (count == 0)
+        return true;
+    if (cursor == end)
+        return false;
+
+    uint8_t mode = *cursor++;
+    if (mode == SINGLE || mode == RAW)
+    {
+        size_t bytes = mode == SINGLE ? 1 : count;
+        if ((size_t)(end - cursor) < bytes)
+            return false;
+        if (mode == SINGLE)
+            memset(out.data(), *cursor, count);
+        else
+            memcpy(out.data(), cursor, count);
+        cursor += bytes;
+        return true;
+    }
+    if (mode != CODED || cursor == end)
+        return false;
+
+    uint32_t freqs[256] = {}, starts[256] = {};
+    uint8_t slots[PROB_SCALE];
+    int symbols = *cursor++ + 1;
+    uint32_t start = 0;
+    for (int i = 0; i < symbols; i++)
+    {
+        uint32_t freq;
+        if (cursor == end)
+            return false;
+        uint8_t s = *cursor++;
+        if (!readVarint(cursor, end, freq) || freq == 0 || start + freq > PROB_SCALE)
+            return false;
+        freqs[s] = freq;
+        starts[s] = start;
+        memset(slots + start, s, freq);
+        start += freq;
+    }
+    uint32_t payload;
+    if (start != PROB_SCALE || !readVarint(cursor, end, payload) || payload < 4 || (size_t)(end - cursor) < payload)
+        return false;
+
+    const uint8_t* bytes = cursor;
+    const uint8_t* bytesEnd = cursor + payload;
+    uint32_t x = (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+    bytes += 4;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint8_t s = slots[x & (PROB_SCALE - 1)];
+        out[i] = s;
+        x = freqs[s] * (x >> PROB_BITS) + (x & (PROB_SCALE - 1)) - starts[s];
+        while (x < LOWER_BOUND)
+        {
+            if (bytes == bytesEnd)
+                return false;
+            x = (x << 8) | *bytes++;
+        }
+    }
+    cursor = bytesEnd;
+    return true;
+}
+
+#endif
@@ -0,0 +1,171 @@
+#ifndef SAMPLER_CACHE_H
+#define SAMPLER_CACHE_H
+
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <algorithm>
+
+#include "gl_verify.h"
+
+// from EXT/ARB_texture_filter_anisotropic, core in 4.6
+#ifndef GL_TEXTURE_MAX_ANISOTROPY
+#define GL_TEXTURE_MAX_ANISOTROPY 0x84FE
+#endif
+#ifndef GL_MAX_TEXTURE_MAX_ANISOTROPY
+#define GL_MAX_TEXTURE_MAX_ANISOTROPY 0x84FF
+#endif
+
+// Everything a sampler object holds. Two equal descriptors always map to the
+// same GL sampler.
+struct SamplerDesc
+{
+    GLenum wrapS = GL_REPEAT;
+    GLenum wrapT = GL_REPEAT;
+    GLenum wrapR = GL_REPEAT;
+    GLenum minFilter = GL_LINEAR;
+    GLenum magFilter = GL_LINEAR;
+    GLenum compareMode = GL_NONE;
+    GLenum compareFunc = GL_LEQUAL;
+    float maxAnisotropy = 1.0f;
+    float minLod = -1000.0f;
+    float maxLod = 1000.0f;
+    float lodBias = 0.0f;
+    float borderColor[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    // ------------------------------------------------------------------------
+    static SamplerDesc linear(GLenum wrap = GL_REPEAT)
+    {
+        SamplerDesc desc;
+        desc.wrapS = desc.wrapT = desc.wrapR = wrap;
+        return desc;
+    }
+    static SamplerDesc trilinear(GLenum wrap = GL_REPEAT, float maxAnisotropy = 1.0f)
+    {
+        SamplerDesc desc = linear(wrap);
+        desc.minFilter = GL_LINEAR_MIPMAP_LINEAR;
+        desc.maxAnisotropy = maxAnisotropy;
+        return desc;
+    }
+    static SamplerDesc nearest(GLenum wrap = GL_CLAMP_TO_EDGE)
+    {
+        SamplerDesc desc;
+        desc.wrapS = desc.wrapT = desc.wrapR = wrap;
+        desc.minFilter = desc.magFilter = GL_NEAREST;
+        return desc;
+    }
+
+    bool operator==(const SamplerDesc& other) const
+    {
+        return wrapS == other.wrapS && wrapT == other.wrapT && wrapR == other.wrapR &&
+               minFilter == other.minFilter && magFilter == other.magFilter &&
+               compareMode == other.compareMode && compareFunc == other.compareFunc &&
+               maxAnisotropy == other.maxAnisotropy && minLod == other.minLod && maxLod == other.maxLod &&
+               lodBias == other.lodBias && !memcmp(borderColor, other.borderColor, sizeof(borderColor));
+    }
+    // FNV-1a over the fields
+    size_t hash() const
+    {
+        uint64_t h = 14695981039346656037ull;
+        auto mix = [&h](const void* data, size_t size) {
+            const uint8_t* bytes = (const uint8_t*)data;
+            for (size_t i = 0; i < size; i++)
+            {
+                h ^= bytes[i];
+                h *= 1099511628211ull;
+            }
+        };
+        GLenum enums[7] = { wrapS, wrapT, wrapR, minFilter, magFilter, compareMode, compareFunc };
+        float floats[8] = { maxAnisotropy, minLod, maxLod, lodBias, borderColor[0], borderColor[1], borderColor[2], borderColor[3] };
+        mix(enums, sizeof(enums));
+        mix(floats, sizeof(floats));
+        return (size_t)h;
+    }
+};
+
+struct SamplerDescHash
+{
+    size_t operator()(const SamplerDesc& desc) const { return desc.hash(); }
+};
+
+// Interns sampler objects by descriptor. Bind the returned name per texture
+// unit (see GLStateCache::bindSampler), the sampler overrides the filtering
+// and wrapping state of whatever texture is on that unit.
+class SamplerCache
+{
+public:
+    SamplerCache() {}
+    ~SamplerCache()
+    {
+        release();
+    }
+    SamplerCache(const SamplerCache&) = delete;
+    SamplerCache& operator=(const SamplerCache&) = delete;
+
+    // ------------------------------------------------------------------------
+    GLuint get(const SamplerDesc& desc)
+    {
+        auto it = m_samplers.find(desc);
+        if (it != m_samplers.end())
+            return it->second;
+
+        if (m_maxAnisotropy < 0.0f)
+            m_maxAnisotropy = queryMaxAnisotropy();
+
+        GLuint sampler;
+        GL_VERIFY(glGenSamplers(1, &sampler));
+        GL_VERIFY(glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, desc.wrapS));
+        GL_VERIFY(glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, desc.wrapT));
+        GL_VERIFY(glSamplerParameteri(sampler, GL_TEXTURE_WRAP_R, desc.wrapR));
+        GL_VERIFY(glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, desc.minFilter));
+        GL_VERIFY(glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, desc.magFilter));
+        GL_VERIFY(glSamplerParameteri(sampler, GL_TEXTURE_COMPARE_MODE, desc.compareMode));
+        GL_VERIFY(glSamplerParameteri(sampler, GL_TEXTURE_COMPARE_FUNC, desc.compareFunc));
+        GL_VERIFY(glSamplerParameterf(sampler, GL_TEXTURE_MIN_LOD, desc.minLod));
+        GL_VERIFY(glSamplerParameterf(sampler, GL_TEXTURE_MAX_LOD, desc.maxLod));
+        GL_VERIFY(glSamplerParameterf(sampler, GL_TEXTURE_LOD_BIAS, desc.lodBias));
+        GL_VERIFY(glSamplerParameterfv(sampler, GL_TEXTURE_BORDER_COLOR, desc.borderColor));
+        // silently clamped to what the driver offers, skipped without the extension
+        if (desc.maxAnisotropy > 1.0f && m_maxAnisotropy > 1.0f)
+            GL_VERIFY(glSamplerParameterf(sampler, GL_TEXTURE_MAX_ANISOTROPY, std::min(desc.maxAnisotropy, m_maxAnisotropy)));
+
+        m_samplers.emplace(desc, sampler);
+        return sampler;
+    }
+    // ------------------------------------------------------------------------
+    size_t size() const { return m_samplers.size(); }
+
+    // ------------------------------------------------------------------------
+    void release()
+    {
+        for (auto& entry : m_samplers)
+            GL_VERIFY(glDeleteSamplers(1, &entry.second));
+        m_samplers.clear();
+    }
+
+private:
+    std::unordered_map<SamplerDesc, GLuint, SamplerDescHash> m_samplers;
+    float m_maxAnisotropy = -1.0f;
+
+    // ------------------------------------------------------------------------
+    static float queryMaxAnisotropy()
+    {
+        GLint count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        for (GLint i = 0; i < count; i++)
+        {
+            const char* name = (const char*)glGetStringi(GL_EXTENSIONS, i);
+            if (!strcmp(name, "GL_EXT_texture_filter_anisotropic") || !strcmp(name, "GL_ARB_texture_filter_anisotropic"))
+            {
+                float maxAnisotropy = 1.0f;
+                glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &maxAnisotropy);
+                return maxAnisotropy;
+            }
+        }
+        return 1.0f;
+    }
+};
+
+#endif
@@ -0,0 +1,238 @@
+#ifndef SKELETAL_ANIMATION_H
+#define SKELETAL_ANIMATION_H
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+#include "cpu_features.h"
+#include "math3d.h"
+#include "matrix_kernels.h"
+#include "thread_pool.h"
+
+// Joints ordered parents first, so one pass from the root computes every
+// model space transform.
+struct Skeleton
+{
+    std::vector<int16_t> parents;      // -1 for roots, always below the joint's own index
+    std::vector<Mat4> inverseBindPose; // model space to joint space at bind time
+
+    uint32_t jointCount() const { return (uint32_t)parents.size(); }
+};
+
+// Local joint transforms, one array per component. Translation and scale
+// carry an unused w so every component is one 16 byte load.
+struct Pose
+{
+    std::vector<Vec4> translations;
+    std::vector<Quat> rotations;
+    std::vector<Vec4> scales;
+
+    void resize(uint32_t joints)
+    {
+        translations.resize(joints);
+        rotations.resize(joints);
+        scales.resize(joints, Vec4(1.0f));
+    }
+};
+
+// Keyframes of every joint at a fixed rate, stored frame after frame
+// ([frame * jointCount + joint]); clips with sparse keys are resampled to
+// this on import. Sampling then only ever blends two neighbouring frames
+// of contiguous memory.
+struct AnimationClip
+{
+    uint32_t jointCount = 0;
+    uint32_t frameCount = 0;
+    float frameRate = 30.0f;
+    std::vector<Vec4> translations;
+    std::vector<Quat> rotations;
+    std::vector<Vec4> scales;
+
+    float duration() const { return frameCount > 1 ? (float)(frameCount - 1) / frameRate : 0.0f; }
+    void resize(uint32_t joints, uint32_t frames)
+    {
+        jointCount = joints;
+        frameCount = frames;
+        translations.resize((size_t)joints * frames);
+        rotations.resize((size_t)joints * frames);
+        scales.resize((size_t)joints * frames, Vec4(1.0f));
+    }
+};
+
+// Up to two clips playing on one character, clips[1] weighted by blend
+struct AnimatedCharacter
+{
+    const AnimationClip* clips[2] = { nullptr, nullptr };
+    float times[2] = { 0.0f, 0.0f }; // seconds
+    float blend = 0.0f;
+    bool loop = true;
+};
+
+namespace anim
+{
+    // per-thread buffers, sized on first use
+    struct Scratch
+    {
+        Pose poses[2];
+        std::vector<Mat4> model;
+        std::vector<Mat4> skin;
+    };
+
+    // the two frames around time and how far between them
+    // ------------------------------------------------------------------------
+    inline void findFrames(const AnimationClip& clip, float time, bool loop, uint32_t& first, uint32_t& second, float& t)
+    {
+        float duration = clip.duration();
+        if (duration <= 0.0f)
+        {
+            first = second = 0;
+            t = 0.0f;
+            return;
+        }
+        time = loop ? time - std::floor(time / duration) * duration : std::min(std::max(time, 0.0f), duration);
+        float frame = time * clip.frameRate;
+        first = std::min((uint32_t)frame, clip.frameCount - 1);
+        second = std::min(first + 1, clip.frameCount - 1);
+        t = frame - (float)first;
+    }
+
+    // out = a + (b - a) * t per joint, rotations nlerped along the short arc
+    // ------------------------------------------------------------------------
+    inline void blendJointsScalar(const Vec4* ta, const Quat* ra, const Vec4* sa, const Vec4* tb, const Quat* rb, const Vec4* sb,
+        float t, uint32_t count, Pose& out)
+    {
+        for (uint32_t j = 0; j < count; j++)
+        {
+            out.translations[j] = lerp(ta[j], tb[j], t);
+            out.rotations[j] = nlerp(ra[j], rb[j], t);
+            out.scales[j] = lerp(sa[j], sb[j], t);
+        }
+    }
+#ifdef CPU_HAS_SSE2
+    // one joint component per register, sign fix and normalization branch free
+    // ------------------------------------------------------------------------
+    inline void blendJointsSSE2(const Vec4* ta, const Quat* ra, const Vec4* sa, const Vec4* tb, const Quat* rb, const Vec4* sb,
+        float t, uint32_t count, Pose& out)
+    {
+        const __m128 weight = _mm_set1_ps(t);
+        const __m128 signBit = _mm_castsi128_ps(_mm_set1_epi32((int)0x80000000));
+        for (uint32_t j = 0; j < count; j++)
+        {
+            __m128 t0 = _mm_loadu_ps(&ta[j].x), t1 = _mm_loadu_ps(&tb[j].x);
+            __m128 s0 = _mm_loadu_ps(&sa[j].x), s1 = _mm_loadu_ps(&sb[j].x);
+            _mm_storeu_ps(&out.translations[j].x, _mm_add_ps(t0, _mm_mul_ps(_mm_sub_ps(t1, t0), weight)));
+            _mm_storeu_ps(&out.scales[j].x, _mm_add_ps(s0, _mm_mul_ps(_mm_sub_ps(s1, s0), weight)));
+
+            __m128 q0 = _mm_loadu_ps(&ra[j].x), q1 = _mm_loadu_ps(&rb[j].x);
+            __m128 d = _mm_mul_ps(q0, q1);
+            d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)));
+            d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(1, 0, 3, 2)));
+            q1 = _mm_xor_ps(q1, _mm_and_ps(d, signBit)); // the other hemisphere when dot < 0
+            __m128 q = _mm_add_ps(q0, _mm_mul_ps(_mm_sub_ps(q1, q0), weight));
+            __m128 l = _mm_mul_ps(q, q);
+            l = _mm_add_ps(l, _mm_shuffle_ps(l, l, _MM_SHUFFLE(2, 3, 0, 1)));
+            l = _mm_add_ps(l, _mm_shuffle_ps(l, l, _MM_SHUFFLE(1, 0, 3, 2)));
+            _mm_storeu_ps(&out.rotations[j].x, _mm_div_ps(q, _mm_sqrt_ps(l)));
+        }
+    }
+#endif
+
+    // off x86 the blend stays scalar, the matrix work still goes through math3d's SIMD
+    // ------------------------------------------------------------------------
+    template<bool SIMD>
+    inline void blendJoints(const Vec4* ta, const Quat* ra, const Vec4* sa, const Vec4* tb, const Quat* rb, const Vec4* sb,
+        float t, uint32_t count, Pose& out)
+    {
+#ifdef CPU_HAS_SSE2
+        if (SIMD)
+            blendJointsSSE2(ta, ra, sa, tb, rb, sb, t, count, out);
+        else
+#endif
+            blendJointsScalar(ta, ra, sa, tb, rb, sb, t, count, out);
+    }
+    template<bool SIMD>
+    inline void sampleClip(const AnimationClip& clip, float time, bool loop, Pose& out)
+    {
+        uint32_t first, second;
+        float t;
+        findFrames(clip, time, loop, first, second, t);
+        size_t a = (size_t)first * clip.jointCount, b = (size_t)second * clip.jointCount;
+        out.resize(clip.jointCount);
+        blendJoints<SIMD>(&clip.translations[a], &clip.rotations[a], &clip.scales[a],
+            &clip.translations[b], &clip.rotations[b], &clip.scales[b], t, clip.jointCount, out);
+    }
+    // out may be a
+    template<bool SIMD>
+    inline void blendPoses(const Pose& a, const Pose& b, float weight, Pose& out)
+    {
+        uint32_t count = (uint32_t)a.translations.size();
+        out.resize(count);
+        blendJoints<SIMD>(a.translations.data(), a.rotations.data(), a.scales.data(),
+            b.translations.data(), b.rotations.data(), b.scales.data(), weight, count, out);
+    }
+
+    // Skinning matrices (model space * inverse bind) of a pose as Float3x4
+    // rows, 12 floats per joint
+    // ------------------------------------------------------------------------
+    inline void computePalette(const Skeleton& skeleton, const Pose& pose, Scratch& scratch, float* palette)
+    {
+        uint32_t count = skeleton.jointCount();
+        scratch.model.resize(count);
+        scratch.skin.resize(count);
+        for (uint32_t j = 0; j < count; j++)
+        {
+            Mat4 local = composeTransform(pose.translations[j].xyz(), pose.rotations[j], pose.scales[j].xyz());
+            int parent = skeleton.parents[j];
+            if (parent < 0)
+                scratch.model[j] = local;
+            else
+                vecmath::multiply(vecmath::loadColumns(scratch.model[parent]), local, scratch.model[j]);
+            vecmath::multiply(vecmath::loadColumns(scratch.model[j]), skeleton.inverseBindPose[j], scratch.skin[j]);
+        }
+        batch::packMatrices(scratch.skin.data(), count, MatrixPacking::Float3x4, palette);
+    }
+    // samples, blends and skins one character
+    // ------------------------------------------------------------------------
+    template<bool SIMD>
+    inline void animateCharacter(const Skeleton& skeleton, const AnimatedCharacter& character, Scratch& scratch, float* palette)
+    {
+        Pose& pose = scratch.poses[0];
+        sampleClip<SIMD>(*character.clips[0], character.times[0], character.loop, pose);
+        if (character.clips[1] && character.blend > 0.0f)
+        {
+            sampleClip<SIMD>(*character.clips[1], character.times[1], character.loop, scratch.poses[1]);
+            blendPoses<SIMD>(pose, scratch.poses[1], character.blend, pose);
+        }
+        computePalette(skeleton, pose, scratch, palette);
+    }
+}
+
+// Floats of skinning palette per character, three rows per joint
+// ----------------------------------------------------------------------------
+inline size_t paletteFloats(const Skeleton& skeleton)
+{
+    return (size_t)skeleton.jointCount() * 12;
+}
+
+// Animates characters sharing one skeleton, writing their palettes back to
+// back (paletteFloats() each). Characters are independent, so with a pool
+// they are spread over its workers in batches of 16.
+// ----------------------------------------------------------------------------
+inline void animateCharacters(const Skeleton& skeleton, const AnimatedCharacter* characters, uint32_t count, float* palettes,
+    ThreadPool* pool = nullptr)
+{
+    size_t stride = paletteFloats(skeleton);
+    auto run = [&](uint32_t begin, uint32_t end) {
+        anim::Scratch scratch;
+        for (uint32_t i = begin; i < end; i++)
+            anim::animateCharacter<true>(skeleton, characters[i], scratch, palettes + i * stride);
+    };
+    if (pool && count > 16)
+        pool->parallelFor(count, 16, run);
+    else
+        run(0, count);
+}
+
+#endif
@@ -1,2 +1,8 @@
+// stb_image allocates through the per-thread decode arena, see decode_arena.h
+#include "decode_arena.h"
+#define STBI_MALLOC(size) decodeArenaMalloc(size)
+#define STBI_REALLOC(pointer, size) decodeArenaRealloc(pointer, size)
+#define STBI_FREE(pointer) decodeArenaFree(pointer)
+
 #define STB_IMAGE_IMPLEMENTATION
-#include "../stb/stb_image.h"
+#include "../stb/stb_image.h"
\ No newline at end of file
@@ -0,0 +1,471 @@
+#ifndef SUPERCOMPRESSED_TEXTURE_H
+#define SUPERCOMPRESSED_TEXTURE_H
+
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+#include "gl_verify.h"
+#include "thread_pool.h"
+#include "block_compression.h"
+#include "texture_residency.h"
+#include "rans.h"
+
+// One file for every GPU: block compressed levels under an entropy coder,
+// turned into whatever the driver samples at load time.
+//
+// The universal block is the one BC3 uses, a BC4 alpha block plus a four
+// color BC1 block; opaque textures store the color half only. Each level is
+// split into streams of like data (color endpoints predicted from the block
+// to the left, color selectors, and the same for alpha) and each stream is
+// rANS coded, which is where the size goes compared to a .bct.
+//
+// Transcoding never searches anything, so it is cheap enough for the loader
+// threads:
+//   BC1 / BC3  the blocks are copied out as they are
+//   BC7        each block is repacked as mode 5, whose 2 bit color indices
+//              hit the same four palette entries as BC1
+//   RGBA8      decoded, for drivers with none of the above
+//
+// .sct file: "SCT1", flags (bit 0: alpha), level count, then per level
+// width, height and the rANS streams.
+
+enum class TranscodeTarget
+{
+    BC1,
+    BC3,
+    BC7,
+    RGBA8,
+};
+
+struct SupercompressedInfo
+{
+    int width = 0;
+    int height = 0;
+    int levels = 0;
+    bool hasAlpha = false;
+};
+
+namespace sct
+{
+    static const uint32_t MAGIC = 0x31544353; // "SCT1"
+    static const uint32_t FLAG_ALPHA = 1;
+
+    // 565 color as components, the unit the endpoint predictor works in
+    // ------------------------------------------------------------------------
+    inline void splitRGB565(uint16_t color, uint8_t out[3])
+    {
+        out[0] = (uint8_t)(color >> 11);
+        out[1] = (uint8_t)((color >> 5) & 63);
+        out[2] = (uint8_t)(color & 31);
+    }
+    inline uint16_t joinRGB565(const uint8_t in[3])
+    {
+        return (uint16_t)((in[0] << 11) | (in[1] << 5) | in[2]);
+    }
+    static const uint8_t COMPONENT_MASKS[6] = { 31, 63, 31, 31, 63, 31 };
+
+    // Universal blocks are BC3 layout (alpha first) or BC1 when opaque.
+    // Endpoints are stored as differences to the left neighbour, the first
+    // block of a row uses the one above.
+    // ------------------------------------------------------------------------
+    inline void encodeLevel(const CompressedLevel& level, bool hasAlpha, std::vector<uint8_t>& out)
+    {
+        int blocksX = (level.width + 3) / 4;
+        int blocksY = (level.height + 3) / 4;
+        size_t count = (size_t)blocksX * blocksY;
+        size_t stride = hasAlpha ? 16 : 8;
+        std::vector<uint8_t> colorEndpoints, colorSelectors, alphaEndpoints, alphaSelectors;
+        colorEndpoints.reserve(count * 6);
+        colorSelectors.reserve(count * 4);
+        if (hasAlpha)
+        {
+            alphaEndpoints.reserve(count * 2);
+            alphaSelectors.reserve(count * 6);
+        }
+
+        for (int by = 0; by < blocksY; by++)
+        {
+            for (int bx = 0; bx < blocksX; bx++)
+            {
+                size_t index = (size_t)by * blocksX + bx;
+                const uint8_t* block = level.data.data() + index * stride;
+                const uint8_t* predictor = nullptr;
+                if (bx > 0)
+                    predictor = block - stride;
+                else if (by > 0)
+                    predictor = block - blocksX * stride;
+
+                if (hasAlpha)
+                {
+                    for (int i = 0; i < 2; i++)
+                        alphaEndpoints.push_back((uint8_t)(block[i] - (predictor ? predictor[i] : 0)));
+                    alphaSelectors.insert(alphaSelectors.end(), block + 2, block + 8);
+                    block += 8;
+                    if (predictor)
+                        predictor += 8;
+                }
+                uint8_t components[6], predicted[6] = {};
+                splitRGB565((uint16_t)(block[0] | (block[1] << 8)), components);
+                splitRGB565((uint16_t)(block[2] | (block[3] << 8)), components + 3);
+                if (predictor)
+                {
+                    splitRGB565((uint16_t)(predictor[0] | (predictor[1] << 8)), predicted);
+                    splitRGB565((uint16_t)(predictor[2] | (predictor[3] << 8)), predicted + 3);
+                }
+                for (int c = 0; c < 6; c++)
+                    colorEndpoints.push_back((uint8_t)((components[c] - predicted[c]) & COMPONENT_MASKS[c]));
+                colorSelectors.insert(colorSelectors.end(), block + 4, block + 8);
+            }
+        }
+        ransEncode(colorEndpoints.data(), colorEndpoints.size(), out);
+        ransEncode(colorSelectors.data(), colorSelectors.size(), out);
+        if (hasAlpha)
+        {
+            ransEncode(alphaEndpoints.data(), alphaEndpoints.size(), out);
+            ransEncode(alphaSelectors.data(), alphaSelectors.size(), out);
+        }
+    }
+    // back to universal blocks, the exact bytes encodeLevel() was given
+    // ------------------------------------------------------------------------
+    inline bool decodeLevel(const uint8_t*& cursor, const uint8_t* end, int width, int height, bool hasAlpha, std::vector<uint8_t>& blocks)
+    {
+        int blocksX = (width + 3) / 4;
+        int blocksY = (height + 3) / 4;
+        size_t count = (size_t)blocksX * blocksY;
+        size_t stride = hasAlpha ? 16 : 8;
+        std::vector<uint8_t> colorEndpoints, colorSelectors, alphaEndpoints, alphaSelectors;
+        if (!ransDecode(cursor, end, colorEndpoints) || colorEndpoints.size() != count * 6 ||
+            !ransDecode(cursor, end, colorSelectors) || colorSelectors.size() != count * 4)
+            return false;
+        if (hasAlpha && (!ransDecode(cursor, end, alphaEndpoints) || alphaEndpoints.size() != count * 2 ||
+            !ransDecode(cursor, end, alphaSelectors) || alphaSelectors.size() != count * 6))
+            return false;
+
+        blocks.resize(count * stride);
+        for (int by = 0; by < blocksY; by++)
+        {
+            for (int bx = 0; bx < blocksX; bx++)
+            {
+                size_t index = (size_t)by * blocksX + bx;
+                uint8_t* block = blocks.data() + index * stride;
+                const uint8_t* predictor = nullptr;
+                if (bx > 0)
+                    predictor = block - stride;
+                else if (by > 0)
+                    predictor = block - blocksX * stride;
+
+                if (hasAlpha)
+                {
+                    for (int i = 0; i < 2; i++)
+                        block[i] = (uint8_t)(alphaEndpoints[index * 2 + i] + (predictor ? predictor[i] : 0));
+                    memcpy(block + 2, &alphaSelectors[index * 6], 6);
+                    block += 8;
+                    if (predictor)
+                        predictor += 8;
+                }
+                uint8_t predicted[6] = {}, components[6];
+                if (predictor)
+                {
+                    splitRGB565((uint16_t)(predictor[0] | (predictor[1] << 8)), predicted);
+                    splitRGB565((uint16_t)(predictor[2] | (predictor[3] << 8)), predicted + 3);
+                }
+                for (int c = 0; c < 6; c++)
+                    components[c] = (uint8_t)((colorEndpoints[index * 6 + c] + predicted[c]) & COMPONENT_MASKS[c]);
+                uint16_t c0 = joinRGB565(components);
+                uint16_t c1 = joinRGB565(components + 3);
+                block[0] = (uint8_t)c0;
+                block[1] = (uint8_t)(c0 >> 8);
+                block[2] = (uint8_t)c1;
+                block[3] = (uint8_t)(c1 >> 8);
+                memcpy(block + 4, &colorSelectors[index * 4], 4);
+            }
+        }
+        return true;
+    }
+
+    // Universal block to BC7 mode 5. The BC1 palette is e0, e1, 1/3 and 2/3
+    // of the way, the mode 5 one e0, 1/3, 2/3, e1, so the color indices are
+    // a lookup and only the endpoints lose a bit of precision. The alpha
+    // ramp is rebuilt over the block's alpha range with four steps.
+    // ------------------------------------------------------------------------
+    inline void transcodeBlockBC7(const uint8_t* color, const uint8_t* alpha, uint8_t out[16])
+    {
+        static const int BC1_TO_BC7[4] = { 0, 3, 1, 2 };
+
+        uint16_t packed[2] = { (uint16_t)(color[0] | (color[1] << 8)), (uint16_t)(color[2] | (color[3] << 8)) };
+        int endpoints[2][4];
+        for (int e = 0; e < 2; e++)
+        {
+            int rgb[3];
+            bc::unpackRGB565(packed[e], rgb);
+            for (int c = 0; c < 3; c++)
+                endpoints[e][c] = (rgb[c] * 127 + 127) / 255;
+        }
+        uint32_t bits = (uint32_t)color[4] | ((uint32_t)color[5] << 8) | ((uint32_t)color[6] << 16) | ((uint32_t)color[7] << 24);
+        int colorIndex[16];
+        for (int i = 0; i < 16; i++)
+            colorIndex[i] = BC1_TO_BC7[(bits >> (2 * i)) & 3];
+
+        int alphaIndex[16] = {};
+        endpoints[0][3] = endpoints[1][3] = 255;
+        if (alpha)
+        {
+            uint8_t texels[16][4];
+            bc::decodeBC4(alpha, texels, 3);
+            int lo = 255, hi = 0;
+            for (int i = 0; i < 16; i++)
+            {
+                lo = std::min<int>(lo, texels[i][3]);
+                hi = std::max<int>(hi, texels[i][3]);
+            }
+            endpoints[0][3] = lo;
+            endpoints[1][3] = hi;
+            for (int i = 0; i < 16 && hi > lo; i++)
+                alphaIndex[i] = std::min(3, ((texels[i][3] - lo) * 3 * 2 + (hi - lo)) / ((hi - lo) * 2));
+        }
+
+        // the first index of each set has its top bit implied zero
+        if (colorIndex[0] & 2)
+        {
+            for (int c = 0; c < 3; c++)
+                std::swap(endpoints[0][c], endpoints[1][c]);
+            for (int i = 0; i < 16; i++)
+                colorIndex[i] = 3 - colorIndex[i];
+        }
+        if (alphaIndex[0] & 2)
+        {
+            std::swap(endpoints[0][3], endpoints[1][3]);
+            for (int i = 0; i < 16; i++)
+                alphaIndex[i] = 3 - alphaIndex[i];
+        }
+
+        bc::BitWriter writer;
+        writer.write(1 << 5, 6); // mode 5
+        writer.write(0, 2);      // no rotation
+        for (int c = 0; c < 3; c++)
+        {
+            writer.write((uint32_t)endpoints[0][c], 7);
+            writer.write((uint32_t)endpoints[1][c], 7);
+        }
+        writer.write((uint32_t)endpoints[0][3], 8);
+        writer.write((uint32_t)endpoints[1][3], 8);
+        for (int i = 0; i < 16; i++)
+            writer.write((uint32_t)colorIndex[i], i == 0 ? 1 : 2);
+        for (int i = 0; i < 16; i++)
+            writer.write((uint32_t)alphaIndex[i], i == 0 ? 1 : 2);
+        memcpy(out, &writer.lo, 8);
+        memcpy(out + 8, &writer.hi, 8);
+    }
+    // ------------------------------------------------------------------------
+    inline void transcodeLevel(const std::vector<uint8_t>& blocks, int width, int height, bool hasAlpha,
+        TranscodeTarget target, std::vector<uint8_t>& out)
+    {
+        static const uint8_t OPAQUE_ALPHA[8] = { 255, 255, 0, 0, 0, 0, 0, 0 };
+        int blocksX = (width + 3) / 4;
+        int blocksY = (height + 3) / 4;
+        size_t count = (size_t)blocksX * blocksY;
+        size_t stride = hasAlpha ? 16 : 8;
+
+        if (target == TranscodeTarget::RGBA8)
+        {
+            out = decompressImage(blocks.data(), width, height, hasAlpha ? BlockFormat::BC3 : BlockFormat::BC1);
+            return;
+        }
+        out.resize(count * (target == TranscodeTarget::BC1 ? 8 : 16));
+        for (size_t i = 0; i < count; i++)
+        {
+            const uint8_t* block = blocks.data() + i * stride;
+            const uint8_t* alpha = hasAlpha ? block : nullptr;
+            const uint8_t* color = hasAlpha ? block + 8 : block;
+            switch (target)
+            {
+            case TranscodeTarget::BC1:
+                memcpy(&out[i * 8], color, 8);
+                break;
+            case TranscodeTarget::BC3:
+                memcpy(&out[i * 16], alpha ? alpha : OPAQUE_ALPHA, 8);
+                memcpy(&out[i * 16 + 8], color, 8);
+                break;
+            case TranscodeTarget::BC7:
+                transcodeBlockBC7(color, alpha, &out[i * 16]);
+                break;
+            case TranscodeTarget::RGBA8:
+                break;
+            }
+        }
+    }
+}
+
+// the cheapest target the driver samples natively, RGBA8 when it has none
+// ----------------------------------------------------------------------------
+inline TranscodeTarget chooseTranscodeTarget(const BlockCompressionSupport& support, bool hasAlpha)
+{
+    if (support.s3tc)
+        return hasAlpha ? TranscodeTarget::BC3 : TranscodeTarget::BC1;
+    if (support.bptc)
+        return TranscodeTarget::BC7;
+    return TranscodeTarget::RGBA8;
+}
+inline const char* transcodeTargetName(TranscodeTarget target)
+{
+    switch (target)
+    {
+    case TranscodeTarget::BC1: return "BC1";
+    case TranscodeTarget::BC3: return "BC3";
+    case TranscodeTarget::BC7: return "BC7";
+    case TranscodeTarget::RGBA8: return "RGBA8";
+    }
+    return "?";
+}
+
+// Builds the mip chain, block compresses it and entropy codes every level.
+// Bake time only, the block encoder is the slow part.
+// ----------------------------------------------------------------------------
+inline std::vector<uint8_t> bakeSupercompressedTexture(const uint8_t* rgba, int width, int height, ThreadPool* pool = nullptr)
+{
+    bool hasAlpha = false;
+    for (size_t i = 0, count = (size_t)width * height; i < count && !hasAlpha; i++)
+        hasAlpha = rgba[i * 4 + 3] != 255;
+    CompressedTexture blocks = bakeCompressedTexture(rgba, width, height, hasAlpha ? BlockFormat::BC3 : BlockFormat::BC1, pool);
+
+    std::vector<uint8_t> file;
+    uint32_t header[3] = { sct::MAGIC, hasAlpha ? sct::FLAG_ALPHA : 0, (uint32_t)blocks.levels.size() };
+    file.insert(file.end(), (const uint8_t*)header, (const uint8_t*)(header + 3));
+    for (const CompressedLevel& level : blocks.levels)
+    {
+        uint32_t size[2] = { (uint32_t)level.width, (uint32_t)level.height };
+        file.insert(file.end(), (const uint8_t*)size, (const uint8_t*)(size + 2));
+        sct::encodeLevel(level, hasAlpha, file);
+    }
+    return file;
+}
+// ----------------------------------------------------------------------------
+inline bool saveSupercompressedTexture(const char* path, const std::vector<uint8_t>& file)
+{
+    FILE* out = fopen(path, "wb");
+    if (!out)
+        return false;
+    bool ok = fwrite(file.data(), file.size(), 1, out) == 1;
+    fclose(out);
+    return ok;
+}
+// reads the header only
+// ----------------------------------------------------------------------------
+inline bool parseSupercompressedInfo(const uint8_t* data, size_t size, SupercompressedInfo& info)
+{
+    uint32_t header[5];
+    if (size < sizeof(header))
+        return false;
+    memcpy(header, data, sizeof(header));
+    if (header[0] != sct::MAGIC || header[2] == 0 || header[2] > 32 || header[3] == 0 || header[4] == 0 ||
+        header[3] > 16384 || header[4] > 16384)
+        return false;
+    info.hasAlpha = (header[1] & sct::FLAG_ALPHA) != 0;
+    info.levels = (int)header[2];
+    info.width = (int)header[3];
+    info.height = (int)header[4];
+    return true;
+}
+
+// Decodes every level of a .sct read into memory and transcodes it for the
+// target. Safe on any thread, it does not touch GL.
+// ----------------------------------------------------------------------------
+inline bool transcodeSupercompressed(const uint8_t* data, size_t size, TranscodeTarget target, TextureLevels& out)
+{
+    SupercompressedInfo info;
+    if (!parseSupercompressedInfo(data, size, info))
+        return false;
+    const uint8_t* cursor = data + 12;
+    const uint8_t* end = data + size;
+
+    out = TextureLevels();
+    out.compressed = target != TranscodeTarget::RGBA8;
+    switch (target)
+    {
+    case TranscodeTarget::BC1: out.blockFormat = BlockFormat::BC1; break;
+    case TranscodeTarget::BC3: out.blockFormat = BlockFormat::BC3; break;
+    case TranscodeTarget::BC7: out.blockFormat = BlockFormat::BC7; break;
+    case TranscodeTarget::RGBA8: out.internalFormat = GL_RGBA8; break;
+    }
+    out.levels.resize(info.levels);
+
+    std::vector<uint8_t> blocks;
+    for (CompressedLevel& level : out.levels)
+    {
+        uint32_t levelSize[2];
+        if ((size_t)(end - cursor) < sizeof(levelSize))
+            return false;
+        memcpy(levelSize, cursor, sizeof(levelSize));
+        cursor += sizeof(levelSize);
+        if (levelSize[0] == 0 || levelSize[1] == 0 || levelSize[0] > 16384 || levelSize[1] > 16384)
+            return false;
+        level.width = (int)levelSize[0];
+        level.height = (int)levelSize[1];
+        if (!sct::decodeLevel(cursor, end, level.width, level.height, info.hasAlpha, blocks))
+            return false;
+        sct::transcodeLevel(blocks, level.width, level.height, info.hasAlpha, target, level.data);
+    }
+    return true;
+}
+inline bool transcodeSupercompressed(const uint8_t* data, size_t size, const BlockCompressionSupport& support, TextureLevels& out)
+{
+    SupercompressedInfo info;
+    return parseSupercompressedInfo(data, size, info) &&
+           transcodeSupercompressed(data, size, chooseTranscodeTarget(support, info.hasAlpha), out);
+}
+// a TextureLoader for TextureResidencyManager, bind path and support
+// ----------------------------------------------------------------------------
+inline bool loadSupercompressedTexture(const char* path, const BlockCompressionSupport& support, TextureLevels& out)
+{
+    FILE* file = fopen(path, "rb");
+    if (!file)
+        return false;
+    std::vector<uint8_t> bytes;
+    if (fseek(file, 0, SEEK_END) == 0)
+    {
+        long size = ftell(file);
+        if (size > 0 && fseek(file, 0, SEEK_SET) == 0)
+        {
+            bytes.resize((size_t)size);
+            if (fread(bytes.data(), bytes.size(), 1, file) != 1)
+                bytes.clear();
+        }
+    }
+    fclose(file);
+    return !bytes.empty() && transcodeSupercompressed(bytes.data(), bytes.size(), support, out);
+}
+
+// Creates a texture with every level of a transcoded file and leaves it bound
+// to GL_TEXTURE_2D. GL thread.
+// ----------------------------------------------------------------------------
+inline GLuint uploadTextureLevels(const TextureLevels& levels)
+{
+    GLuint id;
+    GL_VERIFY(glGenTextures(1, &id));
+    GL_VERIFY(glBindTexture(GL_TEXTURE_2D, id));
+    GL_VERIFY(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+    for (size_t i = 0; i < levels.levels.size(); i++)
+    {
+        const CompressedLevel& level = levels.levels[i];
+        if (levels.compressed)
+        {
+            GL_VERIFY(glCompressedTexImage2D(GL_TEXTURE_2D, (GLint)i, glCompressedFormat(levels.blockFormat),
+                level.width, level.height, 0, (GLsizei)level.data.size(), level.data.data()));
+        }
+        else
+        {
+            GL_VERIFY(glTexImage2D(GL_TEXTURE_2D, (GLint)i, levels.internalFormat, level.width, level.height, 0,
+                GL_RGBA, GL_UNSIGNED_BYTE, level.data.data()));
+        }
+    }
+    GL_VERIFY(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+    GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint)levels.levels.size() - 1));
+    return id;
+}
+
+#endif
@@ -0,0 +1,391 @@
+#ifndef TEXTURE_ATLAS_H
+#define TEXTURE_ATLAS_H
+
+#include <glad/glad.h>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+
+#include "gl_verify.h"
+
+struct PackRect
+{
+    int x;
+    int y;
+    int width;
+    int height;
+};
+
+// MaxRects bin packer with the best short side fit heuristic. Keeps the list
+// of maximal free rectangles, which may overlap each other.
+class MaxRectsPacker
+{
+public:
+    MaxRectsPacker(int width, int height)
+        : m_width(width), m_height(height)
+    {
+        reset();
+    }
+    // ------------------------------------------------------------------------
+    void reset()
+    {
+        m_free.clear();
+        m_free.push_back({ 0, 0, m_width, m_height });
+        m_usedArea = 0;
+    }
+    // ------------------------------------------------------------------------
+    bool insert(int width, int height, PackRect& placed)
+    {
+        int bestShortSide = INT32_MAX;
+        int bestLongSide = INT32_MAX;
+        int bestIndex = -1;
+        for (size_t i = 0; i < m_free.size(); i++)
+        {
+            const PackRect& freeRect = m_free[i];
+            if (freeRect.width < width || freeRect.height < height)
+                continue;
+            int leftoverHorizontal = freeRect.width - width;
+            int leftoverVertical = freeRect.height - height;
+            int shortSide = std::min(leftoverHorizontal, leftoverVertical);
+            int longSide = std::max(leftoverHorizontal, leftoverVertical);
+            if (shortSide < bestShortSide || (shortSide == bestShortSide && longSide < bestLongSide))
+            {
+                bestShortSide = shortSide;
+                bestLongSide = longSide;
+                bestIndex = (int)i;
+            }
+        }
+        if (bestIndex < 0)
+            return false;
+
+        placed = { m_free[bestIndex].x, m_free[bestIndex].y, width, height };
+        place(placed);
+        m_usedArea += (int64_t)width * height;
+        return true;
+    }
+    // Gives a placed rect back. It is not merged with the free space around
+    // it, so it only takes rects that fit inside it, until the last rect is
+    // freed and the whole bin is one free rect again.
+    // ------------------------------------------------------------------------
+    void free(const PackRect& used)
+    {
+        m_usedArea -= (int64_t)used.width * used.height;
+        if (m_usedArea == 0)
+        {
+            reset();
+            return;
+        }
+        m_free.push_back(used);
+        prune();
+    }
+    // ------------------------------------------------------------------------
+    float occupancy() const
+    {
+        return (float)m_usedArea / ((float)m_width * m_height);
+    }
+
+private:
+    int m_width;
+    int m_height;
+    int64_t m_usedArea = 0;
+    std::vector<PackRect> m_free;
+
+    // ------------------------------------------------------------------------
+    static bool intersects(const PackRect& a, const PackRect& b)
+    {
+        return a.x < b.x + b.width && b.x < a.x + a.width &&
+               a.y < b.y + b.height && b.y < a.y + a.height;
+    }
+    static bool contains(const PackRect& outer, const PackRect& inner)
+    {
+        return inner.x >= outer.x && inner.y >= outer.y &&
+               inner.x + inner.width <= outer.x + outer.width &&
+               inner.y + inner.height <= outer.y + outer.height;
+    }
+    // cut the placed rectangle out of every free rectangle it overlaps
+    // ------------------------------------------------------------------------
+    void place(const PackRect& used)
+    {
+        std::vector<PackRect> split;
+        for (size_t i = 0; i < m_free.size(); )
+        {
+            const PackRect f = m_free[i];
+            if (!intersects(f, used))
+            {
+                i++;
+                continue;
+            }
+            if (used.x > f.x)
+                split.push_back({ f.x, f.y, used.x - f.x, f.height });
+            if (used.x + used.width < f.x + f.width)
+                split.push_back({ used.x + used.width, f.y, f.x + f.width - (used.x + used.width), f.height });
+            if (used.y > f.y)
+                split.push_back({ f.x, f.y, f.width, used.y - f.y });
+            if (used.y + used.height < f.y + f.height)
+                split.push_back({ f.x, used.y + used.height, f.width, f.y + f.height - (used.y + used.height) });
+
+            m_free[i] = m_free.back();
+            m_free.pop_back();
+        }
+        m_free.insert(m_free.end(), split.begin(), split.end());
+        prune();
+    }
+    // drop free rectangles that are fully inside another one
+    // ------------------------------------------------------------------------
+    void prune()
+    {
+        for (size_t i = 0; i < m_free.size(); i++)
+        {
+            for (size_t j = i + 1; j < m_free.size(); )
+            {
+                if (contains(m_free[i], m_free[j]))
+                {
+                    m_free.erase(m_free.begin() + j);
+                }
+                else if (contains(m_free[j], m_free[i]))
+                {
+                    m_free.erase(m_free.begin() + i);
+                    i--;
+                    break;
+                }
+                else
+                {
+                    j++;
+                }
+            }
+        }
+    }
+};
+
+// where an image ended up, uv rect is the image without its gutter
+struct AtlasRegion
+{
+    uint32_t page;
+    int x, y, width, height; // texels, without gutter
+    float u0, v0, u1, v1;
+
+    // maps a uv of the original image into the page
+    void remap(float u, float v, float& outU, float& outV) const
+    {
+        outU = u0 + (u1 - u0) * u;
+        outV = v0 + (v1 - v0) * v;
+    }
+};
+
+struct AtlasImage
+{
+    std::string name;
+    const uint8_t* rgba; // tightly packed RGBA8
+    int width;
+    int height;
+};
+
+// Packs many small RGBA8 images into a few big pages. Every image gets a
+// gutter of repeated edge texels, and rects are aligned to the block size of
+// the smallest mip level, so bilinear and mip sampling never bleed between
+// neighbours. Images can be added any time; call flush() once per frame to
+// rebuild the mips of pages that changed.
+class TextureAtlas
+{
+public:
+    // mipLevels: levels that stay bleed free, padding: gutter texels at the smallest of them
+    TextureAtlas(int pageSize = 2048, int padding = 1, int mipLevels = 4)
+        : m_pageSize(pageSize), m_mipLevels(std::max(1, mipLevels))
+    {
+        m_alignment = 1 << (m_mipLevels - 1);
+        m_gutter = std::max(1, padding) << (m_mipLevels - 1);
+    }
+    ~TextureAtlas()
+    {
+        release();
+    }
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    // packs a set of images at once, biggest first, which packs tighter than one by one
+    // ------------------------------------------------------------------------
+    bool build(std::vector<AtlasImage> images)
+    {
+        std::sort(images.begin(), images.end(), [](const AtlasImage& a, const AtlasImage& b) {
+            return std::max(a.width, a.height) > std::max(b.width, b.height);
+        });
+        bool ok = true;
+        for (const AtlasImage& image : images)
+            ok = insert(image.name, image.rgba, image.width, image.height) && ok;
+        return ok;
+    }
+    // Adds one image, opening a new page when none has room. An image of the
+    // same name is replaced: in place when the size matches, otherwise its
+    // rect is freed and the new image packed again. Returns false if the
+    // image cannot fit even an empty page.
+    // ------------------------------------------------------------------------
+    bool insert(const std::string& name, const uint8_t* rgba, int width, int height)
+    {
+        int paddedWidth = alignUp(width + 2 * m_gutter);
+        int paddedHeight = alignUp(height + 2 * m_gutter);
+        if (paddedWidth > m_pageSize || paddedHeight > m_pageSize)
+            return false;
+
+        auto existing = m_regions.find(name);
+        if (existing != m_regions.end())
+        {
+            PackRect old = paddedRect(existing->second);
+            if (old.width == paddedWidth && old.height == paddedHeight)
+            {
+                Page& page = m_pages[existing->second.page];
+                uploadPadded(page, old, rgba, width, height);
+                page.dirty = true;
+                return true;
+            }
+            remove(name);
+        }
+
+        PackRect rect;
+        uint32_t page = 0;
+        for (; page < m_pages.size(); page++)
+        {
+            if (m_pages[page].packer.insert(paddedWidth, paddedHeight, rect))
+                break;
+        }
+        if (page == m_pages.size())
+        {
+            createPage();
+            bool ok = m_pages.back().packer.insert(paddedWidth, paddedHeight, rect);
+            assert(ok);
+            (void)ok;
+        }
+
+        uploadPadded(m_pages[page], rect, rgba, width, height);
+        m_pages[page].dirty = true;
+
+        AtlasRegion region;
+        region.page = page;
+        region.x = rect.x + m_gutter;
+        region.y = rect.y + m_gutter;
+        region.width = width;
+        region.height = height;
+        region.u0 = (float)region.x / m_pageSize;
+        region.v0 = (float)region.y / m_pageSize;
+        region.u1 = (float)(region.x + width) / m_pageSize;
+        region.v1 = (float)(region.y + height) / m_pageSize;
+        m_regions[name] = region;
+        return true;
+    }
+    // frees the image's rect for later inserts, false if there is no such image
+    // ------------------------------------------------------------------------
+    bool remove(const std::string& name)
+    {
+        auto it = m_regions.find(name);
+        if (it == m_regions.end())
+            return false;
+        m_pages[it->second.page].packer.free(paddedRect(it->second));
+        m_regions.erase(it);
+        return true;
+    }
+    // regenerates mips of the pages touched since the last flush
+    // ------------------------------------------------------------------------
+    void flush()
+    {
+        for (Page& page : m_pages)
+        {
+            if (!page.dirty)
+                continue;
+            GL_VERIFY(glBindTexture(GL_TEXTURE_2D, page.texture));
+            GL_VERIFY(glGenerateMipmap(GL_TEXTURE_2D));
+            page.dirty = false;
+        }
+    }
+    // the uv remap table entry, nullptr if the image was never inserted
+    // ------------------------------------------------------------------------
+    const AtlasRegion* find(const std::string& name) const
+    {
+        auto it = m_regions.find(name);
+        return it == m_regions.end() ? nullptr : &it->second;
+    }
+    const std::unordered_map<std::string, AtlasRegion>& regions() const { return m_regions; }
+
+    uint32_t pageCount() const { return (uint32_t)m_pages.size(); }
+    GLuint pageTexture(uint32_t page) const { return m_pages[page].texture; }
+    float pageOccupancy(uint32_t page) const { return m_pages[page].packer.occupancy(); }
+
+    // ------------------------------------------------------------------------
+    void release()
+    {
+        for (Page& page : m_pages)
+            GL_VERIFY(glDeleteTextures(1, &page.texture));
+        m_pages.clear();
+        m_regions.clear();
+    }
+
+private:
+    struct Page
+    {
+        GLuint texture = 0;
+        MaxRectsPacker packer;
+        bool dirty = false;
+
+        explicit Page(int size) : packer(size, size) {}
+    };
+
+    int m_pageSize;
+    int m_mipLevels;
+    int m_alignment;
+    int m_gutter;
+    std::vector<Page> m_pages;
+    std::unordered_map<std::string, AtlasRegion> m_regions;
+    std::vector<uint8_t> m_scratch;
+
+    // ------------------------------------------------------------------------
+    int alignUp(int value) const
+    {
+        return (value + m_alignment - 1) / m_alignment * m_alignment;
+    }
+    // the rect the packer handed out for a region, gutter included
+    // ------------------------------------------------------------------------
+    PackRect paddedRect(const AtlasRegion& region) const
+    {
+        return { region.x - m_gutter, region.y - m_gutter, alignUp(region.width + 2 * m_gutter),
+            alignUp(region.height + 2 * m_gutter) };
+    }
+    // ------------------------------------------------------------------------
+    void createPage()
+    {
+        Page page(m_pageSize);
+        GL_VERIFY(glGenTextures(1, &page.texture));
+        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, page.texture));
+        int size = m_pageSize;
+        for (int level = 0; level < m_mipLevels; level++)
+        {
+            GL_VERIFY(glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+            size = std::max(1, size / 2);
+        }
+        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, m_mipLevels - 1));
+        m_pages.push_back(std::move(page));
+    }
+    // copies the image into the packed rect with its edge texels extruded into the gutter
+    // ------------------------------------------------------------------------
+    void uploadPadded(const Page& page, const PackRect& rect, const uint8_t* rgba, int width, int height)
+    {
+        m_scratch.resize((size_t)rect.width * rect.height * 4);
+        for (int y = 0; y < rect.height; y++)
+        {
+            int sy = std::min(std::max(y - m_gutter, 0), height - 1);
+            for (int x = 0; x < rect.width; x++)
+            {
+                int sx = std::min(std::max(x - m_gutter, 0), width - 1);
+                memcpy(&m_scratch[((size_t)y * rect.width + x) * 4], rgba + ((size_t)sy * width + sx) * 4, 4);
+            }
+        }
+        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, page.texture));
+        GL_VERIFY(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+        GL_VERIFY(glTexSubImage2D(GL_TEXTURE_2D, 0, rect.x, rect.y, rect.width, rect.height, GL_RGBA, GL_UNSIGNED_BYTE, m_scratch.data()));
+        GL_VERIFY(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+    }
+};
+
+#endif
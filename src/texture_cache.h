@@ -0,0 +1,434 @@
+#ifndef TEXTURE_CACHE_H
+#define TEXTURE_CACHE_H
+
+#include <glad/glad.h>
+
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "gl_verify.h"
+#include "thread_pool.h"
+#include "block_compression.h"
+#include "texture_streamer.h"
+#include "progressive_streamer.h"
+#include "supercompressed_texture.h"
+
+typedef uint32_t TextureHandle;
+const TextureHandle INVALID_TEXTURE = 0xffffffff;
+
+struct TextureCacheStats
+{
+    uint32_t requests = 0;     // acquire() calls
+    uint32_t pathHits = 0;     // path already known, no file read
+    uint32_t contentHits = 0;  // new path, but same bytes as a texture we have
+    uint32_t loads = 0;        // textures actually created
+    uint32_t liveTextures = 0;
+};
+
+// Shares textures between everything that uses them.
+//
+// acquire() keys a request by its normalized path, so "./a\\B.png" and
+// "a/b.png" are the same texture, and concurrent requests for one path wait
+// on the same load. A worker reads the file (a baked .bct next to it wins,
+// then a .sct, like --bake and --bake-universal write them) and hashes the
+// bytes; update() then links paths with identical content to one texture
+// before anything is decoded, comparing the bytes whenever the hashes match. Handles are reference counted, the texture is
+// deleted with the last release().
+//
+// .sct files are transcoded by the same worker for whatever the driver
+// supports, update() only uploads the result.
+//
+// Baked files go to the ProgressiveTextureStreamer when one is given, which
+// makes them usable at low resolution right away, otherwise all levels are
+// uploaded at once.
+//
+// texture() returns a grey placeholder until the real one exists and may
+// change once, so look it up when binding instead of keeping the GL name.
+class TextureCache
+{
+public:
+    TextureCache(TextureStreamer& streamer, ThreadPool& pool, const BlockCompressionSupport& support,
+        ProgressiveTextureStreamer* progressive = nullptr)
+        : m_streamer(streamer), m_pool(pool), m_support(support), m_progressive(progressive)
+    {
+    }
+    ~TextureCache()
+    {
+        release();
+    }
+    TextureCache(const TextureCache&) = delete;
+    TextureCache& operator=(const TextureCache&) = delete;
+
+    // GL thread only, every handle needs a matching release()
+    // ------------------------------------------------------------------------
+    TextureHandle acquire(const std::string& path, bool flipVertically = false)
+    {
+        m_stats.requests++;
+        std::string key = normalizePath(path) + (flipVertically ? "|flip" : "");
+        auto it = m_paths.find(key);
+        if (it != m_paths.end())
+        {
+            m_stats.pathHits++;
+            addRef(it->second);
+            return it->second;
+        }
+
+        TextureHandle handle;
+        if (!m_freeHandles.empty())
+        {
+            handle = m_freeHandles.back();
+            m_freeHandles.pop_back();
+        }
+        else
+        {
+            handle = (TextureHandle)m_entries.size();
+            m_entries.emplace_back();
+        }
+        Entry& entry = m_entries[handle];
+        entry = Entry();
+        entry.key = key;
+        entry.refs = 1;
+        entry.probe = std::make_shared<Probe>();
+        entry.probe->path = path;
+        entry.probe->flip = flipVertically;
+        m_paths[key] = handle;
+        m_unresolved.push_back(handle);
+
+        std::shared_ptr<Probe> probe = entry.probe;
+        BlockCompressionSupport support = m_support;
+        m_pool.submit([probe, support] {
+            probe->baked = readFile(bakedPath(probe->path, ".bct"), probe->bytes);
+            if (!probe->baked && readFile(bakedPath(probe->path, ".sct"), probe->bytes))
+            {
+                // a damaged file falls through to the source
+                probe->universal = transcodeSupercompressed(probe->bytes.data(), probe->bytes.size(), support, probe->transcoded);
+                probe->baked = probe->universal;
+            }
+            if (!probe->baked && !readFile(probe->path, probe->bytes))
+            {
+                probe->state = Probe::FAILED;
+                return;
+            }
+            probe->hash = hashBytes(probe->bytes.data(), probe->bytes.size());
+            probe->state = Probe::READ;
+        });
+        return handle;
+    }
+    // ------------------------------------------------------------------------
+    void addRef(TextureHandle handle)
+    {
+        Entry& entry = m_entries[handle];
+        entry.refs++;
+        if (entry.content)
+            m_contents[entry.contentKey].refs++;
+    }
+    // ------------------------------------------------------------------------
+    void release(TextureHandle handle)
+    {
+        Entry& entry = m_entries[handle];
+        if (entry.content)
+            releaseContent(entry.contentKey);
+        if (--entry.refs > 0)
+            return;
+
+        m_paths.erase(entry.key);
+        // a worker may still hold the probe, it is shared
+        entry = Entry();
+        m_freeHandles.push_back(handle);
+    }
+    // the placeholder until loaded, 0 for an invalid handle
+    // ------------------------------------------------------------------------
+    GLuint texture(TextureHandle handle) const
+    {
+        if (handle == INVALID_TEXTURE)
+            return 0;
+        const Entry& entry = m_entries[handle];
+        if (!entry.content)
+            return m_placeholder;
+        return m_contents.find(entry.contentKey)->second.texture;
+    }
+    // true when neither the file nor its baked version could be read
+    bool failed(TextureHandle handle) const { return m_entries[handle].failed; }
+
+    // GL thread, once per frame before TextureStreamer::update()
+    // ------------------------------------------------------------------------
+    void update()
+    {
+        if (!m_placeholder)
+            createPlaceholder();
+
+        for (size_t i = 0; i < m_unresolved.size(); )
+        {
+            TextureHandle handle = m_unresolved[i];
+            Entry& entry = m_entries[handle];
+            // released before its read finished
+            if (!entry.probe)
+            {
+                m_unresolved[i] = m_unresolved.back();
+                m_unresolved.pop_back();
+                continue;
+            }
+            int state = entry.probe->state.load();
+            if (state == Probe::READING)
+            {
+                i++;
+                continue;
+            }
+            if (state == Probe::READ)
+                resolve(entry);
+            else
+                entry.failed = true;
+            entry.probe.reset();
+            m_unresolved[i] = m_unresolved.back();
+            m_unresolved.pop_back();
+        }
+
+        // textures still being streamed into are deleted once the streamer lets go
+        for (size_t i = 0; i < m_dying.size(); )
+        {
+            if (m_streamer.streaming(m_dying[i]))
+            {
+                i++;
+                continue;
+            }
+            GL_VERIFY(glDeleteTextures(1, &m_dying[i]));
+            m_dying[i] = m_dying.back();
+            m_dying.pop_back();
+        }
+    }
+    // ------------------------------------------------------------------------
+    const TextureCacheStats& stats() const { return m_stats; }
+    // false while update() still has reads to resolve or textures to delete,
+    // either of which changes texture bindings
+    bool idle() const { return m_unresolved.empty() && m_dying.empty(); }
+
+    // lower case, forward slashes, no "." or "dir/.." segments; Windows paths
+    // are case insensitive so neither are we
+    // ------------------------------------------------------------------------
+    static std::string normalizePath(const std::string& path)
+    {
+        std::vector<std::string> segments;
+        std::string segment;
+        bool absolute = !path.empty() && (path[0] == '/' || path[0] == '\\');
+        for (size_t i = 0; i <= path.size(); i++)
+        {
+            char c = i < path.size() ? path[i] : '/';
+            if (c != '/' && c != '\\')
+            {
+                segment += (char)tolower((unsigned char)c);
+                continue;
+            }
+            if (segment == "..")
+            {
+                if (!segments.empty() && segments.back() != "..")
+                    segments.pop_back();
+                else
+                    segments.push_back(segment);
+            }
+            else if (!segment.empty() && segment != ".")
+            {
+                segments.push_back(segment);
+            }
+            segment.clear();
+        }
+        std::string normalized = absolute ? "/" : "";
+        for (size_t i = 0; i < segments.size(); i++)
+            normalized += (i ? "/" : "") + segments[i];
+        return normalized;
+    }
+    // 64 bit FNV-1a style mix, eight bytes per step
+    // ------------------------------------------------------------------------
+    static uint64_t hashBytes(const uint8_t* data, size_t size)
+    {
+        const uint64_t prime = 1099511628211ull;
+        uint64_t h = 14695981039346656037ull ^ size;
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            uint64_t word;
+            memcpy(&word, data + i, 8);
+            h = (h ^ word) * prime;
+            h ^= h >> 29;
+        }
+        for (; i < size; i++)
+            h = (h ^ data[i]) * prime;
+        return h ^ (h >> 32);
+    }
+
+    // deletes every texture, outstanding handles become invalid
+    // ------------------------------------------------------------------------
+    void release()
+    {
+        for (Entry& entry : m_entries)
+        {
+            // keep the workers off freed memory
+            while (entry.probe && entry.probe->state == Probe::READING)
+                std::this_thread::yield();
+        }
+        for (auto& content : m_contents)
+            m_dying.push_back(content.second.texture);
+        for (GLuint texture : m_dying)
+            GL_VERIFY(glDeleteTextures(1, &texture));
+        if (m_placeholder)
+            GL_VERIFY(glDeleteTextures(1, &m_placeholder));
+        m_placeholder = 0;
+        m_dying.clear();
+        m_contents.clear();
+        m_entries.clear();
+        m_freeHandles.clear();
+        m_paths.clear();
+        m_unresolved.clear();
+        m_stats.liveTextures = 0;
+    }
+
+private:
+    // what a worker found on disk
+    struct Probe
+    {
+        enum State
+        {
+            READING,
+            READ,
+            FAILED,
+        };
+        std::string path;
+        bool flip = false;
+        bool baked = false;     // .bct or .sct, flipped already
+        bool universal = false; // .sct, transcoded below
+        std::vector<uint8_t> bytes; // as read, kept for .sct too so dedup can compare
+        TextureLevels transcoded;
+        uint64_t hash = 0;
+        std::atomic<int> state{ READING };
+    };
+    struct Entry
+    {
+        std::string key;
+        uint32_t refs = 0;
+        bool content = false; // contentKey is valid
+        bool failed = false;
+        uint64_t contentKey = 0;
+        std::shared_ptr<Probe> probe;
+    };
+    struct Content
+    {
+        GLuint texture = 0;
+        uint32_t refs = 0;
+        bool flipped = false;
+        std::vector<uint8_t> bytes; // the file, a hash match only counts when these match too
+    };
+
+    TextureStreamer& m_streamer;
+    ThreadPool& m_pool;
+    BlockCompressionSupport m_support;
+    ProgressiveTextureStreamer* m_progressive;
+    GLuint m_placeholder = 0;
+    std::vector<Entry> m_entries; // indexed by handle
+    std::vector<TextureHandle> m_freeHandles;
+    std::vector<TextureHandle> m_unresolved;
+    std::unordered_map<std::string, TextureHandle> m_paths;
+    std::unordered_map<uint64_t, Content> m_contents; // by content hash, colliding ones at the next free key
+    std::vector<GLuint> m_dying;
+    TextureCacheStats m_stats;
+
+    // links the entry to a texture with the same bytes, or starts loading one
+    // ------------------------------------------------------------------------
+    void resolve(Entry& entry)
+    {
+        Probe& probe = *entry.probe;
+        // the same image flipped is a different texture, baked ones are flipped already
+        bool flipped = probe.flip && !probe.baked;
+        uint64_t key = probe.hash ^ (flipped ? 0x9e3779b97f4a7c15ull : 0);
+        entry.content = true;
+
+        // a hash hit with different bytes is a collision, move on to the next key
+        for (auto it = m_contents.find(key); it != m_contents.end(); it = m_contents.find(++key))
+        {
+            const Content& existing = it->second;
+            if (existing.flipped != flipped || existing.bytes.size() != probe.bytes.size() ||
+                memcmp(existing.bytes.data(), probe.bytes.data(), probe.bytes.size()) != 0)
+                continue;
+            m_stats.contentHits++;
+            it->second.refs += entry.refs;
+            entry.contentKey = key;
+            return;
+        }
+        entry.contentKey = key;
+
+        Content content;
+        content.refs = entry.refs;
+        content.flipped = flipped;
+        content.bytes = probe.bytes;
+        CompressedTexture compressed;
+        if (probe.universal)
+            content.texture = uploadTextureLevels(probe.transcoded);
+        else if (probe.baked && m_progressive)
+            content.texture = m_progressive->request(probe.path, std::move(probe.bytes));
+        else if (probe.baked && parseCompressedTexture(probe.bytes.data(), probe.bytes.size(), compressed))
+            content.texture = uploadCompressedTexture(compressed, m_support);
+        else
+            content.texture = m_streamer.request(probe.path, std::move(probe.bytes), probe.flip);
+        m_contents[key] = std::move(content);
+        m_stats.loads++;
+        m_stats.liveTextures++;
+    }
+    // ------------------------------------------------------------------------
+    void releaseContent(uint64_t key)
+    {
+        auto it = m_contents.find(key);
+        if (--it->second.refs > 0)
+            return;
+        if (m_progressive)
+            m_progressive->cancel(it->second.texture);
+        m_dying.push_back(it->second.texture);
+        m_contents.erase(it);
+        m_stats.liveTextures--;
+    }
+    // ------------------------------------------------------------------------
+    void createPlaceholder()
+    {
+        static const uint8_t grey[4] = { 128, 128, 128, 255 };
+        GL_VERIFY(glGenTextures(1, &m_placeholder));
+        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, m_placeholder));
+        GL_VERIFY(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, grey));
+        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0));
+    }
+    // "textures/a.png", ".bct" -> "textures/a.bct"
+    // ------------------------------------------------------------------------
+    static std::string bakedPath(const std::string& path, const char* extension)
+    {
+        size_t dot = path.find_last_of('.');
+        size_t slash = path.find_last_of("/\\");
+        if (dot == std::string::npos || (slash != std::string::npos && dot < slash))
+            return path + extension;
+        return path.substr(0, dot) + extension;
+    }
+    // ------------------------------------------------------------------------
+    static bool readFile(const std::string& path, std::vector<uint8_t>& bytes)
+    {
+        FILE* file = fopen(path.c_str(), "rb");
+        if (!file)
+            return false;
+        bool ok = fseek(file, 0, SEEK_END) == 0;
+        long size = ok ? ftell(file) : -1;
+        ok = size > 0 && fseek(file, 0, SEEK_SET) == 0;
+        if (ok)
+        {
+            bytes.resize((size_t)size);
+            ok = fread(bytes.data(), bytes.size(), 1, file) == 1;
+        }
+        fclose(file);
+        if (!ok)
+            bytes.clear();
+        return ok;
+    }
+};
+
+#endif
@@ -0,0 +1,401 @@
+#ifndef TEXTURE_RESIDENCY_H
+#define TEXTURE_RESIDENCY_H
+
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "gl_verify.h"
+#include "block_compression.h"
+
+// Pixels of one texture as its loader hands them over. Uncompressed sources
+// may give level 0 only, the rest is built on demand.
+struct TextureLevels
+{
+    bool compressed = false;
+    BlockFormat blockFormat = BlockFormat::BC1; // when compressed
+    GLenum internalFormat = GL_RGBA8;           // when not compressed, data is always RGBA8
+    std::vector<CompressedLevel> levels;        // width, height, bytes; reused for raw RGBA8
+};
+
+typedef std::function<bool(TextureLevels&)> TextureLoader;
+typedef uint32_t ResidentTextureId;
+
+struct TextureResidencyStats
+{
+    uint64_t budgetBytes = 0;
+    uint64_t residentBytes = 0;
+    uint64_t peakResidentBytes = 0;
+    uint32_t residentTextures = 0;
+    uint32_t evictions = 0;  // textures whose storage was freed entirely
+    uint32_t mipDrops = 0;   // top levels given up
+    uint32_t reloads = 0;    // loader calls after the first load
+};
+
+// Keeps the textures of a scene under a VRAM budget.
+//
+// Every texture is accounted with all of its mip levels. When enforceBudget()
+// finds the total above budget it walks the textures from least recently used,
+// skipping anything used this frame: first it drops the top mip level of each
+// (down to minDimension), and only when that is not enough it frees their
+// storage outright. Dropping levels copies the ones that stay one level up
+// through a buffer on the GPU, the loader is not called for it. use() brings
+// a texture back through its loader, at full resolution when the budget
+// allows.
+//
+// The GL name of a texture is created by its first use() and never changes:
+// eviction respecifies every level as 0x0, which frees the storage and leaves
+// the texture incomplete (it samples black) until it is used again.
+class TextureResidencyManager
+{
+public:
+    explicit TextureResidencyManager(uint64_t budgetBytes, int minDimension = 64)
+        : m_minDimension(minDimension)
+    {
+        m_stats.budgetBytes = budgetBytes;
+    }
+    ~TextureResidencyManager()
+    {
+        release();
+    }
+    TextureResidencyManager(const TextureResidencyManager&) = delete;
+    TextureResidencyManager& operator=(const TextureResidencyManager&) = delete;
+
+    // registers a texture, nothing is loaded until the first use()
+    // ------------------------------------------------------------------------
+    ResidentTextureId add(const std::string& name, TextureLoader loader)
+    {
+        Entry entry;
+        entry.name = name;
+        entry.loader = loader;
+        entry.lru = m_lru.end();
+        m_entries.push_back(entry);
+        return (ResidentTextureId)(m_entries.size() - 1);
+    }
+    // ------------------------------------------------------------------------
+    void beginFrame()
+    {
+        m_frame++;
+    }
+    // marks the texture used this frame and returns its GL name, (re)loading when needed
+    // ------------------------------------------------------------------------
+    GLuint use(ResidentTextureId id)
+    {
+        Entry& entry = m_entries[id];
+        entry.lastUsedFrame = m_frame;
+        if (entry.lru != m_lru.end())
+            m_lru.erase(entry.lru);
+        m_lru.push_front(id);
+        entry.lru = m_lru.begin();
+
+        if (!entry.resident || entry.droppedLevels > 0)
+        {
+            // come back with as many top levels as fit the budget
+            int skip = 0;
+            if (entry.loadedOnce)
+            {
+                uint64_t others = m_stats.residentBytes - entry.bytes;
+                while (canDropLevel(entry, skip) && others + bytesWithout(entry, skip) > m_stats.budgetBytes)
+                    skip++;
+            }
+            if (!entry.resident || skip < entry.droppedLevels)
+                load(entry, skip);
+        }
+        return entry.texture;
+    }
+    // call at the end of the frame, after all use() calls
+    // ------------------------------------------------------------------------
+    void enforceBudget()
+    {
+        if (m_stats.residentBytes <= m_stats.budgetBytes)
+            return;
+
+        // first pass: shrink, second pass: evict
+        for (int pass = 0; pass < 2 && m_stats.residentBytes > m_stats.budgetBytes; pass++)
+        {
+            for (auto it = m_lru.rbegin(); it != m_lru.rend() && m_stats.residentBytes > m_stats.budgetBytes; ++it)
+            {
+                Entry& entry = m_entries[*it];
+                if (!entry.resident || entry.lastUsedFrame == m_frame)
+                    continue;
+                if (pass == 0)
+                {
+                    // find how far to go first, so the levels are copied once
+                    int skip = entry.droppedLevels;
+                    uint64_t others = m_stats.residentBytes - entry.bytes;
+                    while (canDropLevel(entry, skip) && others + bytesWithout(entry, skip) > m_stats.budgetBytes)
+                        skip++;
+                    if (skip > entry.droppedLevels)
+                        dropLevels(entry, skip);
+                }
+                else
+                {
+                    evict(entry);
+                }
+            }
+        }
+    }
+    // ------------------------------------------------------------------------
+    void setBudget(uint64_t budgetBytes)
+    {
+        m_stats.budgetBytes = budgetBytes;
+    }
+    const TextureResidencyStats& stats() const { return m_stats; }
+    uint64_t textureBytes(ResidentTextureId id) const { return m_entries[id].bytes; }
+    bool isResident(ResidentTextureId id) const { return m_entries[id].resident; }
+    int droppedLevels(ResidentTextureId id) const { return m_entries[id].droppedLevels; }
+
+    // bytes the driver needs for one level
+    // ------------------------------------------------------------------------
+    static uint64_t levelBytes(const TextureLevels& levels, int width, int height)
+    {
+        if (levels.compressed)
+            return compressedLevelSize(levels.blockFormat, width, height);
+        uint64_t texels = (uint64_t)width * height;
+        switch (levels.internalFormat)
+        {
+        case GL_R8: return texels;
+        case GL_RG8: return texels * 2;
+        default: return texels * 4; // RGB8 is padded to 4 bytes by every driver we know
+        }
+    }
+    // deletes the textures, not counted as evictions
+    // ------------------------------------------------------------------------
+    void release()
+    {
+        for (Entry& entry : m_entries)
+        {
+            if (entry.texture)
+                GL_VERIFY(glDeleteTextures(1, &entry.texture));
+        }
+        if (m_copyBuffer)
+            GL_VERIFY(glDeleteBuffers(1, &m_copyBuffer));
+        m_copyBuffer = 0;
+        m_entries.clear();
+        m_lru.clear();
+        m_stats.residentBytes = 0;
+        m_stats.residentTextures = 0;
+    }
+
+private:
+    struct Entry
+    {
+        std::string name;
+        TextureLoader loader;
+        GLuint texture = 0;
+        bool resident = false;
+        bool loadedOnce = false;
+        int droppedLevels = 0;
+        int residentLevels = 0; // specified GL levels
+        bool compressed = false;
+        BlockFormat blockFormat = BlockFormat::BC1;
+        GLenum internalFormat = GL_RGBA8;
+        int fullWidth = 0;
+        int fullHeight = 0;
+        uint64_t bytes = 0;               // what is resident now
+        std::vector<uint64_t> levelBytes; // of the full chain
+        uint64_t lastUsedFrame = 0;
+        std::list<ResidentTextureId>::iterator lru;
+    };
+
+    int m_minDimension;
+    uint64_t m_frame = 0;
+    std::vector<Entry> m_entries;
+    std::list<ResidentTextureId> m_lru; // most recently used first
+    TextureResidencyStats m_stats;
+    GLuint m_copyBuffer = 0; // levels on their way one level up
+
+    // ------------------------------------------------------------------------
+    bool canDropLevel(const Entry& entry, int dropped) const
+    {
+        int width = std::max(1, entry.fullWidth >> (dropped + 1));
+        int height = std::max(1, entry.fullHeight >> (dropped + 1));
+        return std::max(width, height) >= m_minDimension;
+    }
+    // resident size with the top `skip` levels left out
+    uint64_t bytesWithout(const Entry& entry, int skip) const
+    {
+        uint64_t bytes = 0;
+        for (size_t i = skip; i < entry.levelBytes.size(); i++)
+            bytes += entry.levelBytes[i];
+        return bytes;
+    }
+    // respecifies levels [first, end) as 0x0, the driver frees their storage
+    // ------------------------------------------------------------------------
+    static void clearLevels(int first, int end)
+    {
+        for (int level = first; level < end; level++)
+            GL_VERIFY(glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, 0, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+    }
+    // frees the storage, the name stays
+    // ------------------------------------------------------------------------
+    void evict(Entry& entry)
+    {
+        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, entry.texture));
+        clearLevels(0, entry.residentLevels);
+        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0));
+        entry.residentLevels = 0;
+        entry.resident = false;
+        m_stats.residentBytes -= entry.bytes;
+        m_stats.residentTextures--;
+        m_stats.evictions++;
+        entry.bytes = 0;
+    }
+    // (re)specifies the texture with its top `skip` levels left out
+    // ------------------------------------------------------------------------
+    void load(Entry& entry, int skip)
+    {
+        TextureLevels source;
+        if (!entry.loader(source) || source.levels.empty())
+            return;
+        if (entry.loadedOnce)
+            m_stats.reloads++;
+        entry.loadedOnce = true;
+
+        // raw sources give level 0, build what we skip to on the CPU
+        if (!source.compressed)
+        {
+            while ((int)source.levels.size() <= skip)
+            {
+                const CompressedLevel& last = source.levels.back();
+                CompressedLevel next;
+                next.data = downsampleRGBA(last.data.data(), last.width, last.height, next.width, next.height);
+                source.levels.push_back(std::move(next));
+            }
+        }
+        skip = std::min(skip, (int)source.levels.size() - 1);
+
+        entry.fullWidth = source.levels[0].width;
+        entry.fullHeight = source.levels[0].height;
+        entry.levelBytes.clear();
+        for (int w = entry.fullWidth, h = entry.fullHeight;; w = std::max(1, w / 2), h = std::max(1, h / 2))
+        {
+            entry.levelBytes.push_back(levelBytes(source, w, h));
+            if (w == 1 && h == 1)
+                break;
+        }
+
+        if (!entry.texture)
+            GL_VERIFY(glGenTextures(1, &entry.texture));
+        if (!entry.resident)
+        {
+            entry.resident = true;
+            m_stats.residentTextures++;
+        }
+        entry.compressed = source.compressed;
+        entry.blockFormat = source.blockFormat;
+        entry.internalFormat = source.internalFormat;
+        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, entry.texture));
+
+        uint64_t bytes = 0;
+        GLint levelCount = 0;
+        if (source.compressed)
+        {
+            for (size_t i = skip; i < source.levels.size(); i++, levelCount++)
+            {
+                const CompressedLevel& level = source.levels[i];
+                GL_VERIFY(glCompressedTexImage2D(GL_TEXTURE_2D, levelCount, glCompressedFormat(source.blockFormat),
+                    level.width, level.height, 0, (GLsizei)level.data.size(), level.data.data()));
+                bytes += level.data.size();
+            }
+        }
+        else
+        {
+            // every level below comes from glGenerateMipmap
+            const CompressedLevel& level = source.levels[skip];
+            GL_VERIFY(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+            GL_VERIFY(glTexImage2D(GL_TEXTURE_2D, 0, source.internalFormat, level.width, level.height, 0,
+                GL_RGBA, GL_UNSIGNED_BYTE, level.data.data()));
+            GL_VERIFY(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+            GL_VERIFY(glGenerateMipmap(GL_TEXTURE_2D));
+            for (int w = level.width, h = level.height;; w = std::max(1, w / 2), h = std::max(1, h / 2))
+            {
+                bytes += levelBytes(source, w, h);
+                levelCount++;
+                if (w == 1 && h == 1)
+                    break;
+            }
+        }
+        // a reload with more levels skipped leaves the old tail behind
+        clearLevels(levelCount, entry.residentLevels);
+        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levelCount - 1));
+
+        m_stats.residentBytes = m_stats.residentBytes - entry.bytes + bytes;
+        m_stats.peakResidentBytes = std::max(m_stats.peakResidentBytes, m_stats.residentBytes);
+        entry.bytes = bytes;
+        entry.droppedLevels = skip;
+        entry.residentLevels = levelCount;
+    }
+    // Gives up top levels until `skip` are gone. The levels that stay are read
+    // into m_copyBuffer and specified again from it, all in the command
+    // stream, so nothing waits for the GPU and the loader is not needed.
+    // Uncompressed levels make the trip as RGBA8.
+    // ------------------------------------------------------------------------
+    void dropLevels(Entry& entry, int skip)
+    {
+        int drop = skip - entry.droppedLevels;
+        int kept = entry.residentLevels - drop;
+        if (drop <= 0 || kept <= 0)
+            return;
+
+        std::vector<size_t> offsets(kept);
+        size_t total = 0;
+        for (int i = 0; i < kept; i++)
+        {
+            int width = std::max(1, entry.fullWidth >> (skip + i));
+            int height = std::max(1, entry.fullHeight >> (skip + i));
+            offsets[i] = total;
+            total += entry.compressed ? compressedLevelSize(entry.blockFormat, width, height) : (size_t)width * height * 4;
+        }
+        if (!m_copyBuffer)
+            GL_VERIFY(glGenBuffers(1, &m_copyBuffer));
+        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, entry.texture));
+        GL_VERIFY(glBindBuffer(GL_PIXEL_PACK_BUFFER, m_copyBuffer));
+        GL_VERIFY(glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)total, nullptr, GL_STREAM_COPY));
+        GL_VERIFY(glPixelStorei(GL_PACK_ALIGNMENT, 1));
+        for (int i = 0; i < kept; i++)
+        {
+            void* offset = (void*)(uintptr_t)offsets[i];
+            if (entry.compressed)
+                GL_VERIFY(glGetCompressedTexImage(GL_TEXTURE_2D, drop + i, offset));
+            else
+                GL_VERIFY(glGetTexImage(GL_TEXTURE_2D, drop + i, GL_RGBA, GL_UNSIGNED_BYTE, offset));
+        }
+        GL_VERIFY(glPixelStorei(GL_PACK_ALIGNMENT, 4));
+        GL_VERIFY(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+        GL_VERIFY(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_copyBuffer));
+        GL_VERIFY(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+        uint64_t bytes = 0;
+        for (int i = 0; i < kept; i++)
+        {
+            int width = std::max(1, entry.fullWidth >> (skip + i));
+            int height = std::max(1, entry.fullHeight >> (skip + i));
+            void* offset = (void*)(uintptr_t)offsets[i];
+            size_t size = (i + 1 < kept ? offsets[i + 1] : total) - offsets[i];
+            if (entry.compressed)
+                GL_VERIFY(glCompressedTexImage2D(GL_TEXTURE_2D, i, glCompressedFormat(entry.blockFormat), width, height, 0,
+                    (GLsizei)size, offset));
+            else
+                GL_VERIFY(glTexImage2D(GL_TEXTURE_2D, i, entry.internalFormat, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, offset));
+            bytes += entry.levelBytes[skip + i];
+        }
+        GL_VERIFY(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+        GL_VERIFY(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+        clearLevels(kept, entry.residentLevels);
+        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, kept - 1));
+
+        m_stats.residentBytes = m_stats.residentBytes - entry.bytes + bytes;
+        m_stats.mipDrops += drop;
+        entry.bytes = bytes;
+        entry.droppedLevels = skip;
+        entry.residentLevels = kept;
+    }
+};
+
+#endif
@@ -0,0 +1,465 @@
+#ifndef TEXTURE_STREAMER_H
+#define TEXTURE_STREAMER_H
+
+#include <glad/glad.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include "../stb/stb_image.h"
+
+#include "gl_verify.h"
+#include "thread_pool.h"
+#include "texture_upload.h"
+#include "decode_arena.h"
+#include "image_resampler.h"
+
+// per frame numbers, reset at the start of every update()
+struct TextureStreamStats
+{
+    uint64_t uploadedBytes = 0;   // bytes sourced from PBOs by glTexSubImage2D this frame
+    double stallMilliseconds = 0; // GL thread time spent in map/unmap/upload/fence calls
+    uint32_t completedTextures = 0;
+    uint32_t pendingTextures = 0;
+};
+
+// Streams image files into textures without blocking the GL thread.
+//
+// request() returns a texture right away that holds one grey texel. A worker
+// reads the image header, the GL thread maps a pixel buffer object of the
+// right size, and the worker decodes into that mapping. update() then copies
+// from the PBO into the texture with glTexSubImage2D, a few rows at a time so
+// at most frameBudgetBytes are uploaded per frame, and fences the PBO so it is
+// only reused once the GPU has consumed it. The image fills in top to bottom
+// over a few frames, the smaller mip levels follow once the last row is in.
+//
+// Pixels go up in a layout the driver takes without converting: workers
+// decode with the file's own channel count and expand RGB to RGBA on the way
+// into the PBO, grey images stay R8 / RG8.
+//
+// The workers also scale the image to the quality tier and build the mip
+// chain with the resampler, so the GL thread never runs glGenerateMipmap.
+class TextureStreamer
+{
+public:
+    TextureStreamer(ThreadPool& pool, size_t frameBudgetBytes = 4 * 1024 * 1024, size_t maxMappedBytes = 64 * 1024 * 1024)
+        : m_pool(pool), m_frameBudgetBytes(frameBudgetBytes), m_maxMappedBytes(maxMappedBytes)
+    {
+    }
+    ~TextureStreamer()
+    {
+        release();
+    }
+    TextureStreamer(const TextureStreamer&) = delete;
+    TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+    // GL thread only. The new texture is left bound to GL_TEXTURE_2D so the
+    // caller can set its parameters.
+    // ------------------------------------------------------------------------
+    GLuint request(const std::string& path, bool flipVertically = false)
+    {
+        return request(path, std::vector<uint8_t>(), flipVertically);
+    }
+    // same, but decodes an image file already read into memory instead of
+    // opening path, which is then only used as a name
+    // ------------------------------------------------------------------------
+    GLuint request(const std::string& path, std::vector<uint8_t> fileData, bool flipVertically)
+    {
+        std::shared_ptr<Job> job = std::make_shared<Job>();
+        job->path = path;
+        job->fileData = std::move(fileData);
+        job->flip = flipVertically;
+        job->colorSpace = m_colorSpace;
+        job->quality = m_quality;
+        job->filter = m_filter;
+        if (!m_maxTextureSize)
+            GL_VERIFY(glGetIntegerv(GL_MAX_TEXTURE_SIZE, &m_maxTextureSize));
+        job->maxTextureSize = m_maxTextureSize;
+
+        // placeholder until the real pixels arrive
+        static const uint8_t grey[4] = { 128, 128, 128, 255 };
+        GL_VERIFY(glGenTextures(1, &job->texture));
+        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, job->texture));
+        GL_VERIFY(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, grey));
+        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0));
+
+        m_pool.submit([job] {
+            DecodeArenaScope arena;
+            int channels;
+            int ok = job->fileData.empty()
+                ? stbi_info(job->path.c_str(), &job->sourceWidth, &job->sourceHeight, &channels)
+                : stbi_info_from_memory(job->fileData.data(), (int)job->fileData.size(), &job->sourceWidth, &job->sourceHeight, &channels);
+            if (!ok)
+            {
+                job->state = Job::FAILED;
+                return;
+            }
+            job->upload = chooseUploadFormat(channels, job->colorSpace);
+            qualityTargetSize(job->sourceWidth, job->sourceHeight, job->quality, job->maxTextureSize, job->width, job->height);
+            job->levels = fullMipCount(job->width, job->height);
+            job->state = Job::PROBED;
+        });
+        m_jobs.push_back(job);
+        return job->texture;
+    }
+    // GL thread, once per frame
+    // ------------------------------------------------------------------------
+    void update()
+    {
+        m_stats = TextureStreamStats();
+
+        retireBuffers();
+
+        size_t budget = m_frameBudgetBytes;
+        for (size_t i = 0; i < m_jobs.size(); )
+        {
+            Job& job = *m_jobs[i];
+            switch (job.state.load())
+            {
+            case Job::PROBED:
+                beginDecode(m_jobs[i]);
+                break;
+            case Job::DECODED:
+                finishDecode(job);
+                break;
+            case Job::UPLOADING:
+                uploadRows(job, budget);
+                break;
+            default:
+                break;
+            }
+
+            if (job.state == Job::DONE || job.state == Job::FAILED)
+            {
+                if (job.state == Job::DONE)
+                    m_stats.completedTextures++;
+                else if (job.mapped)
+                    abandonBuffer(job);
+                m_jobs.erase(m_jobs.begin() + i);
+                continue;
+            }
+            i++;
+        }
+        m_stats.pendingTextures = (uint32_t)m_jobs.size();
+    }
+    // ------------------------------------------------------------------------
+    const TextureStreamStats& frameStats() const { return m_stats; }
+    bool idle() const { return m_jobs.empty(); }
+    // true while a job still writes to the texture, it must not be deleted before
+    bool streaming(GLuint texture) const
+    {
+        for (const std::shared_ptr<Job>& job : m_jobs)
+        {
+            if (job->texture == texture)
+                return true;
+        }
+        return false;
+    }
+    size_t frameBudgetBytes() const { return m_frameBudgetBytes; }
+    void setFrameBudgetBytes(size_t bytes) { m_frameBudgetBytes = std::max<size_t>(bytes, 1); }
+    // these apply to later requests
+    void setColorSpace(ColorSpace colorSpace) { m_colorSpace = colorSpace; }
+    void setQuality(TextureQuality quality) { m_quality = quality; }
+    void setMipFilter(ResampleFilter filter) { m_filter = filter; }
+    // immutable storage when the context has it
+    void setTextureStorage(const TextureStorageSupport& storage) { m_storage = storage; }
+
+    // waits for the workers of pending jobs and deletes the PBOs, the textures stay
+    // ------------------------------------------------------------------------
+    void release()
+    {
+        for (std::shared_ptr<Job>& job : m_jobs)
+        {
+            // a worker may still write into the mapping
+            while (job->state == Job::DECODING)
+                std::this_thread::yield();
+        }
+        m_jobs.clear();
+        for (PixelBuffer& buffer : m_buffers)
+        {
+            if (buffer.fence)
+                GL_VERIFY(glDeleteSync(buffer.fence));
+            if (buffer.mapped)
+            {
+                GL_VERIFY(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id));
+                GL_VERIFY(glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER));
+            }
+            GL_VERIFY(glDeleteBuffers(1, &buffer.id));
+        }
+        GL_VERIFY(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+        m_buffers.clear();
+        m_mappedBytes = 0;
+    }
+
+private:
+    struct Job
+    {
+        enum State
+        {
+            QUEUED,    // worker reads the header
+            PROBED,    // size known, waiting for a PBO
+            DECODING,  // worker decodes into the mapped PBO
+            DECODED,
+            UPLOADING, // rows go from the PBO to the texture
+            DONE,
+            FAILED,
+        };
+        std::string path;
+        std::vector<uint8_t> fileData; // decoded instead of path when not empty
+        bool flip = false;
+        ColorSpace colorSpace = ColorSpace::Linear;
+        TextureQuality quality = TextureQuality::Full;
+        ResampleFilter filter = ResampleFilter::Kaiser;
+        GLint maxTextureSize = 0;
+        UploadFormat upload;
+        GLuint texture = 0;
+        int sourceWidth = 0;
+        int sourceHeight = 0;
+        int width = 0;  // of the texture, after the quality tier
+        int height = 0;
+        int levels = 0;
+        int buffer = -1;
+        int nextRow = 0;    // of level 0
+        int nextLevel = 1;  // once level 0 is in
+        size_t nextOffset = 0;
+        uint8_t* mapped = nullptr;
+        std::atomic<int> state{ QUEUED };
+
+        size_t rowBytes() const { return (size_t)width * upload.channels; }
+        size_t bytes() const { return mipChainBytes(width, height, upload.channels); }
+    };
+    struct PixelBuffer
+    {
+        GLuint id = 0;
+        size_t capacity = 0;
+        GLsync fence = 0; // set after the last upload sourcing from it
+        bool inUse = false;
+        bool mapped = false;
+    };
+    class StallTimer
+    {
+    public:
+        explicit StallTimer(double& total) : m_total(total), m_start(std::chrono::steady_clock::now()) {}
+        ~StallTimer()
+        {
+            m_total += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+        }
+
+    private:
+        double& m_total;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    ThreadPool& m_pool;
+    size_t m_frameBudgetBytes;
+    size_t m_maxMappedBytes;
+    size_t m_mappedBytes = 0;
+    ColorSpace m_colorSpace = ColorSpace::Linear;
+    TextureQuality m_quality = TextureQuality::Full;
+    ResampleFilter m_filter = ResampleFilter::Kaiser;
+    GLint m_maxTextureSize = 0;
+    TextureStorageSupport m_storage;
+    std::vector<std::shared_ptr<Job>> m_jobs;
+    std::vector<PixelBuffer> m_buffers;
+    TextureStreamStats m_stats;
+
+    // PBOs whose fence has signalled can be handed out again
+    // ------------------------------------------------------------------------
+    void retireBuffers()
+    {
+        StallTimer timer(m_stats.stallMilliseconds);
+        for (PixelBuffer& buffer : m_buffers)
+        {
+            if (!buffer.fence)
+                continue;
+            GLenum status = glClientWaitSync(buffer.fence, 0, 0);
+            if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED)
+            {
+                GL_VERIFY(glDeleteSync(buffer.fence));
+                buffer.fence = 0;
+                buffer.inUse = false;
+            }
+        }
+    }
+    // ------------------------------------------------------------------------
+    int acquireBuffer(size_t size)
+    {
+        int best = -1;
+        for (size_t i = 0; i < m_buffers.size(); i++)
+        {
+            const PixelBuffer& buffer = m_buffers[i];
+            if (!buffer.inUse && buffer.capacity >= size && (best < 0 || buffer.capacity < m_buffers[best].capacity))
+                best = (int)i;
+        }
+        if (best >= 0)
+            return best;
+
+        PixelBuffer buffer;
+        buffer.capacity = 64 * 1024;
+        while (buffer.capacity < size)
+            buffer.capacity *= 2;
+        GL_VERIFY(glGenBuffers(1, &buffer.id));
+        GL_VERIFY(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id));
+        GL_VERIFY(glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)buffer.capacity, nullptr, GL_STREAM_DRAW));
+        m_buffers.push_back(buffer);
+        return (int)m_buffers.size() - 1;
+    }
+    // maps a PBO and lets a worker decode straight into it
+    // ------------------------------------------------------------------------
+    void beginDecode(const std::shared_ptr<Job>& job)
+    {
+        size_t size = job->bytes();
+        // keep the mapped total bounded, one oversized image may still go alone
+        if (m_mappedBytes > 0 && m_mappedBytes + size > m_maxMappedBytes)
+            return;
+
+        StallTimer timer(m_stats.stallMilliseconds);
+        job->buffer = acquireBuffer(size);
+        PixelBuffer& buffer = m_buffers[job->buffer];
+        buffer.inUse = true;
+        GL_VERIFY(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id));
+        job->mapped = (uint8_t*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, (GLsizeiptr)size,
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        GL_VERIFY(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+        if (!job->mapped)
+        {
+            buffer.inUse = false;
+            job->state = Job::FAILED;
+            return;
+        }
+        buffer.mapped = true;
+        m_mappedBytes += size;
+
+        job->state = Job::DECODING;
+        ThreadPool* pool = &m_pool;
+        m_pool.submit([job, pool] {
+            // stb's scratch and output live in this worker's arena until the copy into the PBO is done
+            DecodeArenaScope arena;
+            int width, height, channels;
+            int decodeChannels = job->upload.sourceChannels;
+            unsigned char* data = job->fileData.empty()
+                ? stbi_load(job->path.c_str(), &width, &height, &channels, decodeChannels)
+                : stbi_load_from_memory(job->fileData.data(), (int)job->fileData.size(), &width, &height, &channels, decodeChannels);
+            std::vector<uint8_t>().swap(job->fileData);
+            if (!data || width != job->sourceWidth || height != job->sourceHeight)
+            {
+                if (data)
+                    stbi_image_free(data);
+                job->state = Job::FAILED;
+                return;
+            }
+
+            // level 0 goes to the PBO, the smaller levels are filtered from a
+            // copy since the mapping is write only
+            ResampleOptions options = resampleOptionsFor(job->upload, job->colorSpace, job->filter);
+            std::vector<uint8_t> level0((size_t)width * height * job->upload.channels);
+            convertImageForUpload(job->upload, data, level0.data(), width, height, job->flip);
+            stbi_image_free(data);
+            if (width != job->width || height != job->height)
+            {
+                std::vector<uint8_t> scaled(job->rowBytes() * job->height);
+                resampleImage(level0.data(), width, height, scaled.data(), job->width, job->height, job->upload.channels, options, pool);
+                level0.swap(scaled);
+            }
+            memcpy(job->mapped, level0.data(), level0.size());
+            buildMipChain(level0.data(), job->width, job->height, job->upload.channels, options, job->mapped + level0.size(), pool);
+            job->state = Job::DECODED;
+        });
+    }
+    // a decode failed after we mapped for it, the texture keeps its placeholder
+    // ------------------------------------------------------------------------
+    void abandonBuffer(Job& job)
+    {
+        PixelBuffer& buffer = m_buffers[job.buffer];
+        GL_VERIFY(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id));
+        GL_VERIFY(glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER));
+        GL_VERIFY(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+        buffer.mapped = false;
+        buffer.inUse = false;
+        m_mappedBytes -= job.bytes();
+        job.mapped = nullptr;
+    }
+    // unmaps and gives the texture its final size
+    // ------------------------------------------------------------------------
+    void finishDecode(Job& job)
+    {
+        StallTimer timer(m_stats.stallMilliseconds);
+        PixelBuffer& buffer = m_buffers[job.buffer];
+        GL_VERIFY(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id));
+        GL_VERIFY(glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER));
+        GL_VERIFY(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+        buffer.mapped = false;
+        m_mappedBytes -= job.bytes();
+        job.mapped = nullptr;
+
+        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, job.texture));
+        m_storage.allocate(job.upload, job.width, job.height, job.levels);
+        job.state = Job::UPLOADING;
+    }
+    // as many rows as the frame budget allows, at least one, then the
+    // smaller levels whole
+    // ------------------------------------------------------------------------
+    void uploadRows(Job& job, size_t& budget)
+    {
+        if (budget == 0)
+            return;
+        if (job.nextRow == job.height)
+        {
+            uploadLevels(job, budget);
+            return;
+        }
+        size_t rowBytes = job.rowBytes();
+        int rows = (int)std::max<size_t>(1, budget / rowBytes);
+        rows = std::min(rows, job.height - job.nextRow);
+
+        StallTimer timer(m_stats.stallMilliseconds);
+        PixelBuffer& buffer = m_buffers[job.buffer];
+        GL_VERIFY(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id));
+        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, job.texture));
+        uploadTextureRows(job.upload, job.width, job.nextRow, rows, (void*)(rowBytes * job.nextRow)); // offset into the PBO
+        GL_VERIFY(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+
+        size_t bytes = rowBytes * rows;
+        m_stats.uploadedBytes += bytes;
+        budget = bytes >= budget ? 0 : budget - bytes;
+        job.nextRow += rows;
+        job.nextOffset = rowBytes * job.nextRow;
+        if (job.nextRow == job.height)
+            uploadLevels(job, budget);
+    }
+    // ------------------------------------------------------------------------
+    void uploadLevels(Job& job, size_t& budget)
+    {
+        StallTimer timer(m_stats.stallMilliseconds);
+        PixelBuffer& buffer = m_buffers[job.buffer];
+        GL_VERIFY(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id));
+        GL_VERIFY(glBindTexture(GL_TEXTURE_2D, job.texture));
+        while (job.nextLevel < job.levels && budget > 0)
+        {
+            int width = std::max(1, job.width >> job.nextLevel);
+            int height = std::max(1, job.height >> job.nextLevel);
+            uploadTextureLevel(job.upload, job.nextLevel, width, height, (void*)job.nextOffset);
+            size_t bytes = (size_t)width * height * job.upload.channels;
+            m_stats.uploadedBytes += bytes;
+            budget = bytes >= budget ? 0 : budget - bytes;
+            job.nextOffset += bytes;
+            job.nextLevel++;
+        }
+        GL_VERIFY(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+
+        if (job.nextLevel == job.levels)
+        {
+            buffer.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            job.state = Job::DONE;
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,272 @@
+#ifndef TEXTURE_UPLOAD_H
+#define TEXTURE_UPLOAD_H
+
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+#include "gl_verify.h"
+#include "gpu_memory.h"
+#include "cpu_features.h"
+
+// glTexStorage2D is not in our 3.3 loader, core since 4.2
+typedef void (APIENTRYP TexStorage2DProc)(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height);
+
+enum class ColorSpace
+{
+    Linear,
+    sRGB, // colour textures authored for display, decoded to linear by the sampler
+};
+
+// How pixels of one image go to the GPU. Drivers only take 1, 2 and 4 byte
+// texels without converting on the CPU inside glTexImage2D, so 3 channel
+// images are expanded to RGBA by us first.
+struct UploadFormat
+{
+    GLenum internalFormat = GL_RGBA8;
+    GLenum format = GL_RGBA;
+    int sourceChannels = 4; // as decoded
+    int channels = 4;       // as uploaded
+    bool grey = false;      // R / RG hold luminance (+ alpha), sampled through a swizzle
+};
+
+// ----------------------------------------------------------------------------
+inline UploadFormat chooseUploadFormat(int sourceChannels, ColorSpace colorSpace = ColorSpace::Linear)
+{
+    UploadFormat upload;
+    upload.sourceChannels = sourceChannels;
+    switch (sourceChannels)
+    {
+    case 1:
+        // there is no core sRGB R8, keep grey images exact instead
+        upload.internalFormat = colorSpace == ColorSpace::sRGB ? GL_SRGB8_ALPHA8 : GL_R8;
+        upload.format = colorSpace == ColorSpace::sRGB ? GL_RGBA : GL_RED;
+        upload.channels = colorSpace == ColorSpace::sRGB ? 4 : 1;
+        upload.grey = colorSpace != ColorSpace::sRGB;
+        break;
+    case 2:
+        upload.internalFormat = colorSpace == ColorSpace::sRGB ? GL_SRGB8_ALPHA8 : GL_RG8;
+        upload.format = colorSpace == ColorSpace::sRGB ? GL_RGBA : GL_RG;
+        upload.channels = colorSpace == ColorSpace::sRGB ? 4 : 2;
+        upload.grey = colorSpace != ColorSpace::sRGB;
+        break;
+    default:
+        upload.internalFormat = colorSpace == ColorSpace::sRGB ? GL_SRGB8_ALPHA8 : GL_RGBA8;
+        upload.format = GL_RGBA;
+        upload.channels = 4;
+        break;
+    }
+    return upload;
+}
+// largest GL_UNPACK_ALIGNMENT that every row start satisfies
+// ----------------------------------------------------------------------------
+inline GLint unpackAlignment(size_t rowBytes)
+{
+    if (rowBytes % 8 == 0)
+        return 8;
+    if (rowBytes % 4 == 0)
+        return 4;
+    return rowBytes % 2 == 0 ? 2 : 1;
+}
+
+namespace texel
+{
+    // ------------------------------------------------------------------------
+    inline void expandRGBToRGBAScalar(const uint8_t* rgb, uint8_t* rgba, size_t count)
+    {
+        for (size_t i = 0; i < count; i++, rgb += 3, rgba += 4)
+        {
+            rgba[0] = rgb[0];
+            rgba[1] = rgb[1];
+            rgba[2] = rgb[2];
+            rgba[3] = 255;
+        }
+    }
+#ifdef CPU_HAS_SSE2
+    // 16 pixels per step, three loads and alignr so we never read past the end
+    // ------------------------------------------------------------------------
+    TARGET_SSSE3 inline void expandRGBToRGBASSSE3(const uint8_t* rgb, uint8_t* rgba, size_t count)
+    {
+        const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+        const __m128i alpha = _mm_set1_epi32((int)0xff000000);
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16, rgb += 48, rgba += 64)
+        {
+            __m128i a = _mm_loadu_si128((const __m128i*)rgb);
+            __m128i b = _mm_loadu_si128((const __m128i*)(rgb + 16));
+            __m128i c = _mm_loadu_si128((const __m128i*)(rgb + 32));
+            __m128i p0 = _mm_shuffle_epi8(a, shuffle);
+            __m128i p1 = _mm_shuffle_epi8(_mm_alignr_epi8(b, a, 12), shuffle);
+            __m128i p2 = _mm_shuffle_epi8(_mm_alignr_epi8(c, b, 8), shuffle);
+            __m128i p3 = _mm_shuffle_epi8(_mm_srli_si128(c, 4), shuffle);
+            _mm_storeu_si128((__m128i*)rgba, _mm_or_si128(p0, alpha));
+            _mm_storeu_si128((__m128i*)(rgba + 16), _mm_or_si128(p1, alpha));
+            _mm_storeu_si128((__m128i*)(rgba + 32), _mm_or_si128(p2, alpha));
+            _mm_storeu_si128((__m128i*)(rgba + 48), _mm_or_si128(p3, alpha));
+        }
+        expandRGBToRGBAScalar(rgb, rgba, count - i);
+    }
+    // 16 pixels per step, each lane shuffles 4 pixels from its own 16 byte load.
+    // The last load of a step reads 4 bytes past its pixels, so stop early enough.
+    // ------------------------------------------------------------------------
+    TARGET_AVX2 inline void expandRGBToRGBAAVX2(const uint8_t* rgb, uint8_t* rgba, size_t count)
+    {
+        const __m256i shuffle = _mm256_setr_epi8(
+            0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+            0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+        const __m256i alpha = _mm256_set1_epi32((int)0xff000000);
+        size_t i = 0;
+        for (; i + 18 <= count; i += 16, rgb += 48, rgba += 64)
+        {
+            __m256i p01 = _mm256_inserti128_si256(_mm256_castsi128_si256(
+                _mm_loadu_si128((const __m128i*)rgb)), _mm_loadu_si128((const __m128i*)(rgb + 12)), 1);
+            __m256i p23 = _mm256_inserti128_si256(_mm256_castsi128_si256(
+                _mm_loadu_si128((const __m128i*)(rgb + 24))), _mm_loadu_si128((const __m128i*)(rgb + 36)), 1);
+            _mm256_storeu_si256((__m256i*)rgba, _mm256_or_si256(_mm256_shuffle_epi8(p01, shuffle), alpha));
+            _mm256_storeu_si256((__m256i*)(rgba + 32), _mm256_or_si256(_mm256_shuffle_epi8(p23, shuffle), alpha));
+        }
+        expandRGBToRGBASSSE3(rgb, rgba, count - i);
+    }
+#endif
+    // best kernel this CPU has, scalar off x86
+    // ------------------------------------------------------------------------
+    inline void expandRGBToRGBA(const uint8_t* rgb, uint8_t* rgba, size_t count)
+    {
+#ifdef CPU_HAS_SSE2
+        const CpuFeatures& cpu = cpuFeatures();
+        if (cpu.avx2)
+            expandRGBToRGBAAVX2(rgb, rgba, count);
+        else if (cpu.ssse3)
+            expandRGBToRGBASSSE3(rgb, rgba, count);
+        else
+#endif
+            expandRGBToRGBAScalar(rgb, rgba, count);
+    }
+    // grey (+ alpha) to RGBA, only for sRGB targets which have no R/RG format
+    // ------------------------------------------------------------------------
+    inline void expandGreyToRGBA(const uint8_t* grey, int channels, uint8_t* rgba, size_t count)
+    {
+        for (size_t i = 0; i < count; i++, grey += channels, rgba += 4)
+        {
+            rgba[0] = rgba[1] = rgba[2] = grey[0];
+            rgba[3] = channels == 2 ? grey[1] : 255;
+        }
+    }
+}
+
+// Converts `count` decoded pixels of one row into the upload layout
+// ----------------------------------------------------------------------------
+inline void convertForUpload(const UploadFormat& upload, const uint8_t* source, uint8_t* destination, size_t count)
+{
+    if (upload.sourceChannels == upload.channels)
+        memcpy(destination, source, count * upload.channels);
+    else if (upload.sourceChannels == 3)
+        texel::expandRGBToRGBA(source, destination, count);
+    else
+        texel::expandGreyToRGBA(source, upload.sourceChannels, destination, count);
+}
+// whole image, optionally bottom row first. Rows are tightly packed on both sides.
+// ----------------------------------------------------------------------------
+inline void convertImageForUpload(const UploadFormat& upload, const uint8_t* source, uint8_t* destination, int width, int height, bool flip)
+{
+    size_t sourceRow = (size_t)width * upload.sourceChannels;
+    size_t destinationRow = (size_t)width * upload.channels;
+    for (int y = 0; y < height; y++)
+    {
+        int row = flip ? height - 1 - y : y;
+        convertForUpload(upload, source + sourceRow * row, destination + destinationRow * y, (size_t)width);
+    }
+}
+
+// levels down to 1x1
+// ----------------------------------------------------------------------------
+inline GLsizei fullMipCount(int width, int height)
+{
+    GLsizei levels = 1;
+    while (width > 1 || height > 1)
+    {
+        width = std::max(1, width / 2);
+        height = std::max(1, height / 2);
+        levels++;
+    }
+    return levels;
+}
+
+// Allocates textures, immutable when the driver can
+// ----------------------------------------------------------------------------
+struct TextureStorageSupport
+{
+    TexStorage2DProc texStorage2D = nullptr;
+
+    // pass the same loader GLAD was initialised with
+    static TextureStorageSupport query(GLADloadproc loadProc)
+    {
+        TextureStorageSupport support;
+        GLint major = 0, minor = 0;
+        glGetIntegerv(GL_MAJOR_VERSION, &major);
+        glGetIntegerv(GL_MINOR_VERSION, &minor);
+        bool available = major > 4 || (major == 4 && minor >= 2);
+
+        GLint count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        for (GLint i = 0; i < count && !available; i++)
+            available = !strcmp((const char*)glGetStringi(GL_EXTENSIONS, i), "GL_ARB_texture_storage");
+        if (available && loadProc)
+            support.texStorage2D = (TexStorage2DProc)loadProc("glTexStorage2D");
+        return support;
+    }
+
+    // allocates the levels of the texture bound to GL_TEXTURE_2D and sets the
+    // swizzle for grey formats, the pixels follow with glTexSubImage2D.
+    // The texture may hold mutable images already, not immutable ones.
+    // ------------------------------------------------------------------------
+    void allocate(const UploadFormat& upload, int width, int height, GLsizei levels) const
+    {
+        if (texStorage2D)
+        {
+            GL_VERIFY(texStorage2D(GL_TEXTURE_2D, levels, upload.internalFormat, width, height));
+            // past glad, so past the registry's hooks
+            if (gpuMemory().installed())
+                gpuMemory().textureStorage(GL_TEXTURE_2D, levels, upload.internalFormat, width, height);
+        }
+        else
+        {
+            for (GLsizei level = 0; level < levels; level++)
+            {
+                GL_VERIFY(glTexImage2D(GL_TEXTURE_2D, level, upload.internalFormat, width, height, 0, upload.format, GL_UNSIGNED_BYTE, nullptr));
+                width = std::max(1, width / 2);
+                height = std::max(1, height / 2);
+            }
+        }
+        // glGenerateMipmap stops at MAX_LEVEL too
+        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0));
+        GL_VERIFY(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1));
+        if (upload.grey)
+        {
+            const GLint greySwizzle[4] = { GL_RED, GL_RED, GL_RED, upload.channels == 2 ? GL_GREEN : GL_ONE };
+            GL_VERIFY(glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, greySwizzle));
+        }
+    }
+};
+
+// Uploads rows already in the upload layout, from client memory or, with a
+// PBO bound, from the byte offset `pixels`
+// ----------------------------------------------------------------------------
+inline void uploadTextureRows(const UploadFormat& upload, int width, int firstRow, int rows, const void* pixels)
+{
+    GL_VERIFY(glPixelStorei(GL_UNPACK_ALIGNMENT, unpackAlignment((size_t)width * upload.channels)));
+    GL_VERIFY(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, firstRow, width, rows, upload.format, GL_UNSIGNED_BYTE, pixels));
+    GL_VERIFY(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+}
+// one whole mip level, for chains built on the CPU
+// ----------------------------------------------------------------------------
+inline void uploadTextureLevel(const UploadFormat& upload, int level, int width, int height, const void* pixels)
+{
+    GL_VERIFY(glPixelStorei(GL_UNPACK_ALIGNMENT, unpackAlignment((size_t)width * upload.channels)));
+    GL_VERIFY(glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, upload.format, GL_UNSIGNED_BYTE, pixels));
+    GL_VERIFY(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+}
+
+#endif
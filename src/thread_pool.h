@@ -0,0 +1,160 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "cpu_profiler.h"
+
+// Fixed set of worker threads fed from one FIFO queue. Used for asset work
+// (decoding, encoding, resampling) that must stay off the GL thread.
+// Workers show up in CPU captures as "worker N", every task as a zone.
+class ThreadPool
+{
+public:
+    // 0 means one thread per hardware thread
+    explicit ThreadPool(unsigned threadCount = 0)
+    {
+        if (threadCount == 0)
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned i = 0; i < threadCount; i++)
+            m_workers.emplace_back([this, i] { workerLoop(i); });
+    }
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wakeup.notify_all();
+        for (std::thread& worker : m_workers)
+            worker.join();
+    }
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned size() const { return (unsigned)m_workers.size(); }
+
+    // runs f on a worker, the future carries its result or exception
+    // ------------------------------------------------------------------------
+    template<typename F>
+    auto submit(F&& f) -> std::future<decltype(f())>
+    {
+        typedef decltype(f()) Result;
+        std::shared_ptr<std::packaged_task<Result()>> task =
+            std::make_shared<std::packaged_task<Result()>>(std::forward<F>(f));
+        std::future<Result> future = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.push_back([task] { (*task)(); });
+        }
+        m_wakeup.notify_one();
+        return future;
+    }
+    // Calls fn(begin, end) over [0, count) split into chunks of at most
+    // grainSize items. The calling thread works on chunks too, so this is safe
+    // to call from inside a worker.
+    // ------------------------------------------------------------------------
+    void parallelFor(uint32_t count, uint32_t grainSize, const std::function<void(uint32_t, uint32_t)>& fn)
+    {
+        if (count == 0)
+            return;
+        if (grainSize == 0)
+            grainSize = 1;
+        uint32_t chunkCount = (count + grainSize - 1) / grainSize;
+        if (chunkCount == 1)
+        {
+            fn(0, count);
+            return;
+        }
+
+        // shared with helper tasks that may only start after we returned
+        struct State
+        {
+            std::function<void(uint32_t, uint32_t)> fn;
+            std::atomic<uint32_t> nextChunk{ 0 };
+            std::atomic<uint32_t> doneChunks{ 0 };
+            uint32_t count = 0;
+            uint32_t grainSize = 0;
+            uint32_t chunkCount = 0;
+            std::mutex mutex;
+            std::condition_variable done;
+
+            void run()
+            {
+                for (;;)
+                {
+                    uint32_t chunk = nextChunk.fetch_add(1);
+                    if (chunk >= chunkCount)
+                        return;
+                    uint32_t begin = chunk * grainSize;
+                    uint32_t end = std::min(begin + grainSize, count);
+                    fn(begin, end);
+                    if (doneChunks.fetch_add(1) + 1 == chunkCount)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        done.notify_all();
+                    }
+                }
+            }
+        };
+        std::shared_ptr<State> state = std::make_shared<State>();
+        state->fn = fn;
+        state->count = count;
+        state->grainSize = grainSize;
+        state->chunkCount = chunkCount;
+
+        unsigned helpers = std::min<unsigned>(size(), chunkCount - 1);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (unsigned i = 0; i < helpers; i++)
+                m_tasks.push_back([state] { state->run(); });
+        }
+        m_wakeup.notify_all();
+
+        state->run();
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->done.wait(lock, [&] { return state->doneChunks.load() == state->chunkCount; });
+    }
+
+private:
+    std::vector<std::thread> m_workers;
+    std::deque<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    bool m_stopping = false;
+
+    // ------------------------------------------------------------------------
+    void workerLoop(unsigned index)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "worker %u", index);
+        cpuProfiler().setThreadName(name);
+        for (;;)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wakeup.wait(lock, [this] { return m_stopping || !m_tasks.empty(); });
+                if (m_tasks.empty())
+                    return;
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+            PROFILE_ZONE("task");
+            task();
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,374 @@
+#ifndef TRANSFORM_HIERARCHY_H
+#define TRANSFORM_HIERARCHY_H
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+#include "math3d.h"
+#include "thread_pool.h"
+
+typedef uint32_t TransformNode;
+const TransformNode INVALID_NODE = 0xffffffff;
+
+struct TransformHierarchyStats
+{
+    uint32_t nodes = 0;
+    uint32_t levels = 0;
+    uint32_t updatedNodes = 0; // world matrices recomputed by the last update()
+    uint32_t rebuilds = 0;     // times the arrays were re-sorted after structural changes
+};
+
+// Parent/child transforms for the whole scene, stored as parallel arrays.
+//
+// Nodes live in "slots" sorted by depth, roots first, so every parent comes
+// before its children and one pass over the arrays computes all world
+// matrices. Setting a local transform only flags the node; update() then
+// recomputes the flagged nodes and everything below them and leaves clean
+// subtrees alone. The nodes of one level only read the level above, so
+// big levels are split over a ThreadPool.
+//
+// Creating, destroying or re-parenting nodes only marks the order stale;
+// the arrays are re-sorted once at the start of the next update(). Node ids
+// stay valid across that, slots do not.
+//
+// The world matrices are in slot order and back to back, so they go to an
+// InstanceBuffer as they are: instance i is the node in slot i.
+class TransformHierarchy
+{
+public:
+    static const uint32_t PARALLEL_GRAIN = 4096; // nodes per task
+
+    explicit TransformHierarchy(uint32_t reserveNodes = 0)
+    {
+        reserve(reserveNodes);
+    }
+
+    // ------------------------------------------------------------------------
+    TransformNode create(TransformNode parent = INVALID_NODE)
+    {
+        TransformNode node;
+        if (!m_freeIds.empty())
+        {
+            node = m_freeIds.back();
+            m_freeIds.pop_back();
+        }
+        else
+        {
+            node = (TransformNode)m_slotOf.size();
+            m_slotOf.push_back(INVALID_SLOT);
+        }
+        uint32_t slot = (uint32_t)m_ids.size();
+        m_slotOf[node] = slot;
+        m_ids.push_back(node);
+        m_parents.push_back(parent == INVALID_NODE ? INVALID_SLOT : m_slotOf[parent]);
+        m_depths.push_back(0); // set by the re-sort
+        m_translations.push_back(Vec3());
+        m_rotations.push_back(Quat());
+        m_scales.push_back(Vec3(1.0f));
+        m_worlds.push_back(Mat4());
+        m_dirty.push_back(1);
+        m_destroyed.push_back(0);
+        m_changedFrame.push_back(0);
+        m_orderStale = true;
+        return node;
+    }
+    // removes the node and everything below it at the next update()
+    // ------------------------------------------------------------------------
+    void destroy(TransformNode node)
+    {
+        m_destroyed[m_slotOf[node]] = 1;
+        m_orderStale = true;
+    }
+    // INVALID_NODE makes it a root; the parent must not be below the node
+    // ------------------------------------------------------------------------
+    void setParent(TransformNode node, TransformNode parent)
+    {
+        uint32_t slot = m_slotOf[node];
+        m_parents[slot] = parent == INVALID_NODE ? INVALID_SLOT : m_slotOf[parent];
+        m_dirty[slot] = 1;
+        m_orderStale = true;
+    }
+    // ------------------------------------------------------------------------
+    void setLocal(TransformNode node, const Vec3& translation, const Quat& rotation, const Vec3& scale)
+    {
+        uint32_t slot = m_slotOf[node];
+        m_translations[slot] = translation;
+        m_rotations[slot] = rotation;
+        m_scales[slot] = scale;
+        markDirty(slot);
+    }
+    void setTranslation(TransformNode node, const Vec3& translation)
+    {
+        m_translations[m_slotOf[node]] = translation;
+        markDirty(m_slotOf[node]);
+    }
+    void setRotation(TransformNode node, const Quat& rotation)
+    {
+        m_rotations[m_slotOf[node]] = rotation;
+        markDirty(m_slotOf[node]);
+    }
+    void setScale(TransformNode node, const Vec3& scale)
+    {
+        m_scales[m_slotOf[node]] = scale;
+        markDirty(m_slotOf[node]);
+    }
+    const Vec3& translation(TransformNode node) const { return m_translations[m_slotOf[node]]; }
+    const Quat& rotation(TransformNode node) const { return m_rotations[m_slotOf[node]]; }
+    const Vec3& scale(TransformNode node) const { return m_scales[m_slotOf[node]]; }
+    TransformNode parent(TransformNode node) const
+    {
+        uint32_t parentSlot = m_parents[m_slotOf[node]];
+        return parentSlot == INVALID_SLOT ? INVALID_NODE : m_ids[parentSlot];
+    }
+    // as of the last update()
+    const Mat4& world(TransformNode node) const { return m_worlds[m_slotOf[node]]; }
+
+    // Re-sorts if needed and recomputes the world matrix of every node that
+    // changed or sits below one that did. With a pool, levels of more than
+    // PARALLEL_GRAIN nodes are split over its workers.
+    // ------------------------------------------------------------------------
+    void update(ThreadPool* pool = nullptr)
+    {
+        if (m_orderStale)
+            rebuild();
+        m_frame++;
+        m_stats.updatedNodes = 0;
+        m_changedFirst = INVALID_SLOT;
+        m_changedLast = 0;
+        if (m_firstDirtyLevel == INVALID_SLOT)
+            return;
+
+        std::atomic<uint32_t> updated{ 0 };
+        std::atomic<uint32_t> changedFirst{ INVALID_SLOT };
+        std::atomic<uint32_t> changedLast{ 0 };
+        for (uint32_t level = m_firstDirtyLevel; level + 1 < m_levelStarts.size(); level++)
+        {
+            uint32_t begin = m_levelStarts[level];
+            uint32_t count = m_levelStarts[level + 1] - begin;
+            auto run = [&](uint32_t first, uint32_t end) {
+                uint32_t lo = INVALID_SLOT, hi = 0, n = updateRange(begin + first, begin + end, lo, hi);
+                if (!n)
+                    return;
+                updated.fetch_add(n);
+                atomicMin(changedFirst, lo);
+                atomicMax(changedLast, hi);
+            };
+            if (pool && count > PARALLEL_GRAIN)
+                pool->parallelFor(count, PARALLEL_GRAIN, run);
+            else
+                run(0, count);
+        }
+        m_firstDirtyLevel = INVALID_SLOT;
+        m_stats.updatedNodes = updated.load();
+        m_changedFirst = changedFirst.load();
+        m_changedLast = changedLast.load();
+    }
+
+    // world matrices in slot order, size() of them
+    const Mat4* worldMatrices() const { return m_worlds.data(); }
+    uint32_t size() const { return (uint32_t)m_ids.size(); }
+    // where the node's matrix is in worldMatrices(), changes with re-sorts
+    uint32_t slot(TransformNode node) const { return m_slotOf[node]; }
+    // slots whose world matrix the last update() rewrote, false when none
+    // ------------------------------------------------------------------------
+    bool changedRange(uint32_t& first, uint32_t& count) const
+    {
+        if (m_changedFirst == INVALID_SLOT)
+            return false;
+        first = m_changedFirst;
+        count = m_changedLast - m_changedFirst + 1;
+        return true;
+    }
+    const TransformHierarchyStats& stats() const { return m_stats; }
+
+    // ------------------------------------------------------------------------
+    void reserve(uint32_t nodes)
+    {
+        m_slotOf.reserve(nodes);
+        m_ids.reserve(nodes);
+        m_parents.reserve(nodes);
+        m_depths.reserve(nodes);
+        m_translations.reserve(nodes);
+        m_rotations.reserve(nodes);
+        m_scales.reserve(nodes);
+        m_worlds.reserve(nodes);
+        m_dirty.reserve(nodes);
+        m_destroyed.reserve(nodes);
+        m_changedFrame.reserve(nodes);
+    }
+
+private:
+    enum : uint32_t { INVALID_SLOT = 0xffffffff }; // enum so push_back(INVALID_SLOT) needs no definition
+
+    // by node id
+    std::vector<uint32_t> m_slotOf;
+    std::vector<TransformNode> m_freeIds;
+    // by slot
+    std::vector<TransformNode> m_ids;
+    std::vector<uint32_t> m_parents; // slot of the parent
+    std::vector<uint32_t> m_depths;
+    std::vector<Vec3> m_translations;
+    std::vector<Quat> m_rotations;
+    std::vector<Vec3> m_scales;
+    std::vector<Mat4> m_worlds;
+    std::vector<uint8_t> m_dirty;         // local transform changed
+    std::vector<uint8_t> m_destroyed;
+    std::vector<uint32_t> m_changedFrame; // update() that last rewrote the world matrix
+    std::vector<uint32_t> m_levelStarts;  // first slot of every depth, plus the end
+
+    bool m_orderStale = false;
+    uint32_t m_firstDirtyLevel = INVALID_SLOT;
+    uint32_t m_frame = 0;
+    uint32_t m_changedFirst = INVALID_SLOT;
+    uint32_t m_changedLast = 0;
+    TransformHierarchyStats m_stats;
+
+    // ------------------------------------------------------------------------
+    void markDirty(uint32_t slot)
+    {
+        m_dirty[slot] = 1;
+        if (!m_orderStale)
+            m_firstDirtyLevel = std::min(m_firstDirtyLevel, m_depths[slot]);
+    }
+    // returns the number of world matrices rewritten and their slot range
+    // ------------------------------------------------------------------------
+    uint32_t updateRange(uint32_t begin, uint32_t end, uint32_t& first, uint32_t& last)
+    {
+        uint32_t updated = 0;
+        for (uint32_t slot = begin; slot < end; slot++)
+        {
+            uint32_t parent = m_parents[slot];
+            bool parentChanged = parent != INVALID_SLOT && m_changedFrame[parent] == m_frame;
+            if (!m_dirty[slot] && !parentChanged)
+                continue;
+
+            Mat4 local = composeTransform(m_translations[slot], m_rotations[slot], m_scales[slot]);
+            if (parent == INVALID_SLOT)
+                m_worlds[slot] = local;
+            else
+                vecmath::multiply(vecmath::loadColumns(m_worlds[parent]), local, m_worlds[slot]);
+            m_dirty[slot] = 0;
+            m_changedFrame[slot] = m_frame;
+            first = std::min(first, slot);
+            last = std::max(last, slot);
+            updated++;
+        }
+        return updated;
+    }
+    // ------------------------------------------------------------------------
+    static void atomicMin(std::atomic<uint32_t>& value, uint32_t candidate)
+    {
+        uint32_t current = value.load();
+        while (candidate < current && !value.compare_exchange_weak(current, candidate)) {}
+    }
+    static void atomicMax(std::atomic<uint32_t>& value, uint32_t candidate)
+    {
+        uint32_t current = value.load();
+        while (candidate > current && !value.compare_exchange_weak(current, candidate)) {}
+    }
+
+    // Counting sort by depth after structural changes. Destroyed subtrees are
+    // dropped and their ids recycled; every world matrix is recomputed since
+    // the slots moved anyway.
+    // ------------------------------------------------------------------------
+    void rebuild()
+    {
+        uint32_t count = (uint32_t)m_ids.size();
+        // depth of every slot, walking up to the nearest known one
+        const uint32_t UNKNOWN = INVALID_SLOT;
+        std::vector<uint32_t> depth(count, UNKNOWN);
+        std::vector<uint32_t> path;
+        for (uint32_t slot = 0; slot < count; slot++)
+        {
+            uint32_t s = slot;
+            while (s != INVALID_SLOT && depth[s] == UNKNOWN)
+            {
+                path.push_back(s);
+                s = m_parents[s];
+                assert(path.size() <= count); // a cycle
+            }
+            uint32_t d = s == INVALID_SLOT ? 0 : depth[s] + 1;
+            while (!path.empty())
+            {
+                depth[path.back()] = d++;
+                path.pop_back();
+            }
+        }
+
+        uint32_t levels = 0;
+        for (uint32_t d : depth)
+            levels = std::max(levels, d + 1);
+        std::vector<uint32_t> starts(levels + 1, 0);
+        for (uint32_t d : depth)
+            starts[d + 1]++;
+        for (uint32_t l = 0; l < levels; l++)
+            starts[l + 1] += starts[l];
+        std::vector<uint32_t> order(count);
+        {
+            std::vector<uint32_t> next(starts.begin(), starts.end() - 1);
+            for (uint32_t slot = 0; slot < count; slot++)
+                order[next[depth[slot]]++] = slot;
+        }
+
+        // parents come first, so a destroyed flag reaches the whole subtree
+        std::vector<uint32_t> newSlot(count, INVALID_SLOT);
+        std::vector<uint32_t> kept;
+        kept.reserve(count);
+        for (uint32_t old : order)
+        {
+            uint32_t parent = m_parents[old];
+            if (m_destroyed[old] || (parent != INVALID_SLOT && newSlot[parent] == INVALID_SLOT))
+            {
+                m_slotOf[m_ids[old]] = INVALID_SLOT;
+                m_freeIds.push_back(m_ids[old]);
+                continue;
+            }
+            newSlot[old] = (uint32_t)kept.size();
+            kept.push_back(old);
+        }
+
+        permute(m_ids, kept);
+        permute(m_translations, kept);
+        permute(m_rotations, kept);
+        permute(m_scales, kept);
+        permute(m_worlds, kept);
+        std::vector<uint32_t> parents(kept.size());
+        m_levelStarts.assign(1, 0);
+        m_depths.resize(kept.size());
+        for (uint32_t i = 0; i < kept.size(); i++)
+        {
+            uint32_t parent = m_parents[kept[i]];
+            parents[i] = parent == INVALID_SLOT ? INVALID_SLOT : newSlot[parent];
+            m_depths[i] = depth[kept[i]];
+            while (m_levelStarts.size() <= m_depths[i])
+                m_levelStarts.push_back(i);
+            m_slotOf[m_ids[i]] = i;
+        }
+        m_levelStarts.push_back((uint32_t)kept.size());
+        m_parents.swap(parents);
+        m_dirty.assign(kept.size(), 1);
+        m_destroyed.assign(kept.size(), 0);
+        m_changedFrame.assign(kept.size(), 0);
+
+        m_orderStale = false;
+        m_firstDirtyLevel = kept.empty() ? (uint32_t)INVALID_SLOT : 0;
+        m_stats.nodes = (uint32_t)kept.size();
+        m_stats.levels = (uint32_t)m_levelStarts.size() - 1;
+        m_stats.rebuilds++;
+    }
+    // ------------------------------------------------------------------------
+    template<typename T>
+    static void permute(std::vector<T>& values, const std::vector<uint32_t>& order)
+    {
+        std::vector<T> sorted;
+        sorted.reserve(order.size());
+        for (uint32_t old : order)
+            sorted.push_back(values[old]);
+        values.swap(sorted);
+    }
+};
+
+#endif
@@ -0,0 +1,185 @@
+"""Generates src/gl_call_table.h, the counting dispatch layer behind
+gl_call_counters.h, from the glad_gl* function pointers in glad.h.
+
+Every GLAPI PFN...PROC glad_glXxx gets an entry index, a category and a
+wrapper with the exact signature that counts the call and forwards it to
+the loaded pointer. Run it again whenever glad.h is regenerated:
+
+    python tools/gen_gl_call_table.py
+"""
+
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+GLAD_H = os.path.join(ROOT, "GLAD", "include", "glad", "glad.h")
+OUTPUT = os.path.join(ROOT, "src", "gl_call_table.h")
+
+# must match enum class GLCallCategory in gl_call_counters.h
+CATEGORIES = ["Draw", "Clear", "Bind", "State", "Uniform", "Transfer", "Query",
+              "Object", "Shader", "Sync", "Get", "Debug", "Other"]
+
+# first match wins
+RULES = [
+    ("Debug", r"^glGetError$|^glDebugMessage|^glObjectLabel|^glPushDebugGroup|^glPopDebugGroup"),
+    ("Draw", r"^glDraw(?!Buffers?$)|^glMultiDraw"),
+    ("Clear", r"^glClear(?!Color$|Depth$|Stencil$)"),
+    ("Bind", r"^glBind|^glUseProgram$|^glActiveTexture$"),
+    ("Uniform", r"^glUniform|^glProgramUniform"),
+    ("Transfer", r"^glBufferData$|^glBufferSubData$|^glMapBuffer|^glUnmapBuffer$|^glFlushMappedBufferRange$"
+                 r"|^glTexImage|^glTexSubImage|^glCompressedTex|^glCopyBufferSubData$|^glCopyTex"
+                 r"|^glReadPixels$|^glGetBufferSubData$|^glGetTexImage$|^glGetCompressedTexImage$"
+                 r"|^glTexBuffer$|^glGenerateMipmap$|^glBlitFramebuffer$"),
+    ("Query", r"^glBeginQuery|^glEndQuery|^glQueryCounter$|^glGetQuery|^glBeginConditionalRender|^glEndConditionalRender"),
+    ("Object", r"^glGen|^glDelete|^glCreate(?!ShaderProgram)|^glIs"),
+    ("Sync", r"^glFenceSync$|^glClientWaitSync$|^glWaitSync$|^glFinish$|^glFlush$"),
+    ("Shader", r"Shader|Program|^glBindAttribLocation$|^glGetAttribLocation$|^glGetUniform|^glGetActive"
+               r"|^glBindFragData|^glGetFragData|^glTransformFeedbackVaryings$"),
+    ("Get", r"^glGet|^glCheckFramebufferStatus$"),
+    ("State", r"^glEnable|^glDisable|^glBlend|^glDepth|^glStencil|^glViewport$|^glScissor$|^glCullFace$"
+              r"|^glFrontFace$|^glPolygon|^glColorMask|^glClearColor$|^glClearDepth$|^glClearStencil$"
+              r"|^glVertexAttrib|^glTexParameter|^glClampColor$|^glBeginTransformFeedback$|^glEndTransformFeedback$"
+              r"|^glSamplerParameter|^glPixelStore|^glLineWidth$|^glPointSize$|^glPointParameter"
+              r"|^glDrawBuffer|^glReadBuffer$|^glFramebuffer|^glRenderbufferStorage|^glHint$|^glLogicOp$"
+              r"|^glPrimitiveRestart|^glProvokingVertex$|^glSampleCoverage$|^glSampleMask|^glMinSampleShading$"),
+]
+
+TYPEDEF = re.compile(r"^typedef\s+(.+?)\s*\(APIENTRYP\s+(PFN\w+PROC)\)\s*\((.*)\);\s*$")
+POINTER = re.compile(r"^GLAPI\s+(PFN\w+PROC)\s+glad_(gl\w+);\s*$")
+PARAM_NAME = re.compile(r"(\w+)\s*(\[\s*\d*\s*\])?\s*$")
+
+
+def category(name):
+    for cat, pattern in RULES:
+        if re.search(pattern, name):
+            return cat
+    return "Other"
+
+
+def parse(path):
+    typedefs = {}
+    entries = []
+    with open(path) as f:
+        for line in f:
+            match = TYPEDEF.match(line)
+            if match:
+                typedefs[match.group(2)] = (match.group(1), match.group(3).strip())
+                continue
+            match = POINTER.match(line)
+            if match:
+                pfn, name = match.groups()
+                result, params = typedefs[pfn]
+                entries.append((name, pfn, result, params))
+    return entries
+
+
+def argument_names(params):
+    if params in ("", "void"):
+        return []
+    names = []
+    for param in params.split(","):
+        match = PARAM_NAME.search(param)
+        if not match:
+            sys.exit("cannot name parameter '%s'" % param)
+        names.append(match.group(1))
+    return names
+
+
+def generate(entries):
+    out = []
+    w = out.append
+    w("// Generated by tools/gen_gl_call_table.py from GLAD/include/glad/glad.h,")
+    w("// do not edit. Included by gl_call_counters.h when GL_CALL_COUNTERS is on.")
+    w("#ifndef GL_CALL_TABLE_H")
+    w("#define GL_CALL_TABLE_H")
+    w("")
+    w("#include <glad/glad.h>")
+    w("")
+    w("#include <cstdint>")
+    w("")
+    w("namespace glcalls")
+    w("{")
+    w("    enum Entry : uint32_t")
+    w("    {")
+    for name, _, _, _ in entries:
+        w("        ENTRY_%s," % name)
+    w("        ENTRY_COUNT")
+    w("    };")
+    w("")
+    w("    // ------------------------------------------------------------------------")
+    w("    inline const char* entryName(uint32_t entry)")
+    w("    {")
+    w("        static const char* const names[ENTRY_COUNT] = {")
+    for name, _, _, _ in entries:
+        w("            \"%s\"," % name)
+    w("        };")
+    w("        return entry < ENTRY_COUNT ? names[entry] : \"\";")
+    w("    }")
+    w("    inline GLCallCategory entryCategory(uint32_t entry)")
+    w("    {")
+    w("        static const GLCallCategory categories[ENTRY_COUNT] = {")
+    for name, _, _, _ in entries:
+        w("            GLCallCategory::%s," % category(name))
+    w("        };")
+    w("        return entry < ENTRY_COUNT ? categories[entry] : GLCallCategory::Other;")
+    w("    }")
+    w("")
+    w("    // the loaded pointers and this frame's calls, a template so the header")
+    w("    // can define them")
+    w("    template<typename Unused = void>")
+    w("    struct Table")
+    w("    {")
+    w("        static void* loaded[ENTRY_COUNT];")
+    w("        static uint32_t counts[ENTRY_COUNT];")
+    w("    };")
+    w("    template<typename Unused> void* Table<Unused>::loaded[ENTRY_COUNT] = {};")
+    w("    template<typename Unused> uint32_t Table<Unused>::counts[ENTRY_COUNT] = {};")
+    w("")
+    for name, pfn, result, params in entries:
+        args = ", ".join(argument_names(params))
+        call = "((%s)Table<>::loaded[ENTRY_%s])(%s)" % (pfn, name, args)
+        w("    inline %s APIENTRY counted_%s(%s)" % (result, name, params))
+        w("    {")
+        w("        Table<>::counts[ENTRY_%s]++;" % name)
+        w("        %s%s;" % ("" if result == "void" else "return ", call))
+        w("    }")
+    w("")
+    w("    // points every loaded glad_gl* at its counting wrapper, or back")
+    w("    // ------------------------------------------------------------------------")
+    w("    inline void install()")
+    w("    {")
+    for name, pfn, _, _ in entries:
+        w("        if (glad_%s && glad_%s != counted_%s)" % (name, name, name))
+        w("        {")
+        w("            Table<>::loaded[ENTRY_%s] = (void*)glad_%s;" % (name, name))
+        w("            glad_%s = counted_%s;" % (name, name))
+        w("        }")
+    w("    }")
+    w("    inline void uninstall()")
+    w("    {")
+    for name, pfn, _, _ in entries:
+        w("        if (glad_%s == counted_%s)" % (name, name))
+        w("            glad_%s = (%s)Table<>::loaded[ENTRY_%s];" % (name, pfn, name))
+    w("    }")
+    w("}")
+    w("")
+    w("#endif")
+    return "\r\n".join(out) + "\r\n"
+
+
+def main():
+    entries = parse(GLAD_H)
+    if not entries:
+        sys.exit("no glad_gl* pointers in " + GLAD_H)
+    with open(OUTPUT, "w", newline="") as f:
+        f.write(generate(entries))
+    counts = {}
+    for name, _, _, _ in entries:
+        counts[category(name)] = counts.get(category(name), 0) + 1
+    print("%d entry points -> %s" % (len(entries), os.path.relpath(OUTPUT, ROOT)))
+    print("  " + ", ".join("%s %d" % (cat, counts.get(cat, 0)) for cat in CATEGORIES))
+
+
+if __name__ == "__main__":
+    main()
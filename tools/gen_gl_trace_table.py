@@ -0,0 +1,381 @@
+"""Generates src/gl_trace_table.h, the recording wrappers and replay cases
+behind gl_trace.h, from the glad_gl* function pointers in glad.h.
+
+Scalars are recorded as they are. Pointer parameters need to know how much
+client memory the call reads, which the rules below describe; entry points
+with a pointer no rule covers are counted as unsupported instead of being
+recorded. Gets and glIs* are not wrapped at all. Run it again whenever
+glad.h is regenerated:
+
+    python tools/gen_gl_trace_table.py
+"""
+
+import os
+import re
+import sys
+
+from gen_gl_call_table import GLAD_H, ROOT, parse
+
+OUTPUT = os.path.join(ROOT, "src", "gl_trace_table.h")
+
+# GLuint parameters and arrays holding object names
+OBJECT_PARAMS = {
+    "texture": "Texture", "buffer": "Buffer", "array": "VertexArray", "sampler": "Sampler", "id": "Query",
+    "framebuffer": "Framebuffer", "renderbuffer": "Renderbuffer", "program": "Program", "shader": "Shader",
+}
+OBJECT_ARRAYS = {
+    "textures": "Texture", "buffers": "Buffer", "arrays": "VertexArray", "samplers": "Sampler", "ids": "Query",
+    "framebuffers": "Framebuffer", "renderbuffers": "Renderbuffer",
+}
+CREATED_OBJECTS = {"glCreateShader": "Shader", "glCreateProgram": "Program"}
+ELEMENT_BYTES = {"b": 1, "ub": 1, "s": 2, "us": 2, "i": 4, "ui": 4, "f": 4, "d": 8}
+
+PARAM = re.compile(r"^(.*?)(\w+)\s*$")
+
+
+def skipped(name):
+    """Calls that change no state are neither recorded nor replayed."""
+    if name == "glGetUniformLocation":
+        return False
+    return bool(re.match(r"^glGet|^glIs|^glCheckFramebufferStatus$|^glAreTexturesResident$|^glRenderMode$", name))
+
+
+def split_params(params):
+    if params in ("", "void"):
+        return []
+    result = []
+    for param in params.split(","):
+        match = PARAM.match(param.strip())
+        result.append((match.group(1).strip(), match.group(2)))
+    return result
+
+
+def pointer_rule(entry, ptype, pname):
+    """(kind, argument) for a pointer parameter, None when not supported."""
+    if pname in OBJECT_ARRAYS and ptype.replace(" ", "") in ("constGLuint*", "GLuint*"):
+        if entry.startswith("glGen"):
+            return ("names_out", OBJECT_ARRAYS[pname])
+        if entry.startswith("glDelete"):
+            return ("names_in", OBJECT_ARRAYS[pname])
+    match = re.match(r"^glUniform([1-4])(f|i|ui)v$", entry)
+    if match:
+        return ("payload", "(size_t)std::max(count, 0) * %s * 4" % match.group(1))
+    match = re.match(r"^glUniformMatrix([2-4])(?:x([2-4]))?fv$", entry)
+    if match:
+        rows = match.group(2) or match.group(1)
+        return ("payload", "(size_t)std::max(count, 0) * %s * %s * 4" % (match.group(1), rows))
+    match = re.match(r"^glVertexAttribI?([1-4])N?(b|ub|s|us|i|ui|f|d)v$", entry)
+    if match:
+        return ("payload", "%d" % (int(match.group(1)) * ELEMENT_BYTES[match.group(2)]))
+    if re.match(r"^glVertexAttribP[1-4]uiv$", entry):
+        return ("payload", "4")
+    if re.match(r"^glTexParameterI?u?[if]v$|^glSamplerParameterI?u?[if]v$", entry):
+        return ("payload", "gltrace::parameterCount(pname) * 4")
+    if re.match(r"^glClearBuffer(iv|uiv|fv)$", entry):
+        return ("payload", "(buffer == GL_COLOR ? 4 : 1) * 4")
+    if entry == "glDrawBuffers":
+        return ("payload", "(size_t)std::max(n, 0) * sizeof(GLenum)")
+    if entry in ("glBufferData", "glBufferSubData"):
+        return ("payload", "(size_t)size")
+    match = re.match(r"^glTex(?:Sub)?Image([123])D$", entry)
+    if match:
+        dims = {"1": "width, 1, 1", "2": "width, height, 1", "3": "width, height, depth"}[match.group(1)]
+        return ("unpack", dims)
+    if re.match(r"^glCompressedTex(?:Sub)?Image[123]D$", entry):
+        return ("compressed", None)
+    if entry == "glReadPixels":
+        return ("pack", None)
+    if re.match(r"^glVertexAttribI?Pointer$", entry) and pname == "pointer":
+        return ("offset", None)
+    if re.match(r"^glDraw(?:Range)?Elements(?:Instanced)?(?:BaseVertex)?$", entry) and pname == "indices":
+        return ("offset", None)
+    if ptype == "const GLchar *" and pname == "name":
+        return ("string", None)
+    if entry == "glShaderSource":
+        return ("source", None)
+    return None
+
+
+def describe(entry, pfn, result, params):
+    """Record and replay code for one entry point, None when unsupported."""
+    args = split_params(params)
+    for _, pname in args:
+        if pname in ("trace", "replay", "in", "result"):
+            sys.exit("%s: parameter '%s' collides with generated code" % (entry, pname))
+    count = args[0][1] if args else ""  # of glGen*/glDelete* arrays
+    record_pre, record_post = [], []
+    replay_pre, replay_post = [], []
+    call_args = []
+    for ptype, pname in args:
+        if "*" in ptype:
+            if entry == "glShaderSource" and pname == "length":
+                replay_pre.append("const GLint* length = nullptr;")
+                call_args.append(pname)
+                continue
+            rule = pointer_rule(entry, ptype, pname)
+            if rule is None:
+                return None
+            kind, arg = rule
+            if kind == "payload":
+                record_pre.append("trace.pointer(%s, %s);" % (pname, arg))
+                replay_pre.append("%s %s = (%s)in.pointer();" % (ptype, pname, ptype))
+            elif kind == "offset":
+                record_pre.append("trace.offset(%s);" % pname)
+                replay_pre.append("%s %s = (%s)in.pointer();" % (ptype, pname, ptype))
+            elif kind == "string":
+                record_pre.append("trace.string(%s);" % pname)
+                replay_pre.append("%s %s = (%s)in.pointer();" % (ptype, pname, ptype))
+            elif kind == "unpack":
+                record_pre.append("trace.unpackPixels(%s, format, type, %s);" % (pname, arg))
+                replay_pre.append("%s %s = (%s)in.pointer();" % (ptype, pname, ptype))
+            elif kind == "compressed":
+                record_pre.append("trace.compressedPixels(%s, imageSize);" % pname)
+                replay_pre.append("%s %s = (%s)in.pointer();" % (ptype, pname, ptype))
+            elif kind == "pack":
+                record_pre.append("trace.packPixels(%s, format, type, width, height);" % pname)
+                replay_pre.append("%s %s = (%s)in.pointer();" % (ptype, pname, ptype))
+            elif kind == "source":
+                record_pre.append("trace.shaderSource(count, %s, length);" % pname)
+                replay_pre.append("const GLchar* source = (const GLchar*)in.pointer();")
+                replay_pre.append("const GLchar* const* %s = &source;" % pname)
+                replay_pre.append("count = 1;")
+            elif kind == "names_in":
+                record_pre.append("trace.pointer(%s, (size_t)std::max(%s, 0) * sizeof(GLuint));" % (pname, count))
+                replay_pre.append("const GLuint* %s = replay.objects(gltrace::%s, (const GLuint*)in.pointer(), %s);"
+                                  % (pname, arg, count))
+            elif kind == "names_out":
+                record_post.append("trace.pointer(%s, (size_t)std::max(%s, 0) * sizeof(GLuint));" % (pname, count))
+                replay_pre.append("GLuint* %s = replay.names(%s);" % (pname, count))
+                replay_post.append("replay.bindObjects(gltrace::%s, (const GLuint*)in.pointer(), %s, %s);"
+                                   % (arg, pname, count))
+            call_args.append(pname)
+            continue
+
+        if ptype == "GLsync":
+            record_pre.append("trace.sync(%s);" % pname)
+            replay_pre.append("GLsync %s = replay.sync(in.value<uint64_t>());" % pname)
+        elif ptype == "GLuint" and pname in OBJECT_PARAMS:
+            record_pre.append("trace.value(%s);" % pname)
+            replay_pre.append("GLuint captured_%s = in.value<GLuint>();" % pname)
+            replay_pre.append("GLuint %s = replay.object(gltrace::%s, captured_%s);" % (pname, OBJECT_PARAMS[pname], pname))
+        elif ptype == "GLint" and pname == "location":
+            record_pre.append("trace.value(%s);" % pname)
+            replay_pre.append("GLint %s = replay.location(in.value<GLint>());" % pname)
+        elif ptype in ("GLDEBUGPROC",):
+            return None
+        else:
+            record_pre.append("trace.value(%s);" % pname)
+            replay_pre.append("%s %s = in.value<%s>();" % (ptype, pname, ptype))
+        call_args.append(pname)
+
+    # state the recorder follows and results the replay maps
+    if entry in ("glBindBuffer", "glBindBufferBase", "glBindBufferRange"):
+        record_post.append("trace.bindBuffer(target, buffer);")
+        replay_post.append("replay.bindBuffer(target, buffer);")
+    elif entry == "glBindVertexArray":
+        record_post.append("trace.bindVertexArray(array);")
+        replay_post.append("replay.bindVertexArray(array);")
+    elif entry == "glDeleteBuffers":
+        record_post.append("trace.deleteBuffers(n, buffers);")
+        replay_post.append("replay.deleteBuffers(n, buffers);")
+    elif entry == "glDeleteVertexArrays":
+        record_post.append("trace.deleteVertexArrays(n, arrays);")
+        replay_post.append("replay.deleteVertexArrays(n, arrays);")
+    elif entry in ("glPixelStorei", "glPixelStoref"):
+        record_post.append("trace.pixelStore(pname, (GLint)param);")
+    elif entry == "glUseProgram":
+        replay_post.append("replay.useProgram(captured_program);")
+    elif entry == "glUnmapBuffer":
+        record_pre.append("trace.unmapped(target);")
+        replay_pre.append("const void* written = in.pointer();")
+        replay_pre.append("replay.unmapped(target, written, in.lastSize());")
+    elif entry == "glMapBufferRange":
+        record_post.append("trace.mapped(target, result, length, access);")
+        replay_post.append("replay.mapped(target, result);")
+    elif entry == "glMapBuffer":
+        record_post.append("GLint size = 0;")
+        record_post.append("glGetBufferParameteriv(target, GL_BUFFER_SIZE, &size);")
+        record_post.append("trace.mapped(target, result, size, access == GL_READ_ONLY ? 0 : GL_MAP_WRITE_BIT);")
+        replay_post.append("replay.mapped(target, result);")
+    elif entry in CREATED_OBJECTS:
+        record_post.append("trace.value(result);")
+        replay_post.append("replay.bindObject(gltrace::%s, in.value<GLuint>(), result);" % CREATED_OBJECTS[entry])
+    elif entry == "glFenceSync":
+        record_post.append("trace.sync(result);")
+        replay_post.append("replay.bindSync(in.value<uint64_t>(), result);")
+    elif entry == "glGetUniformLocation":
+        record_post.append("trace.value(result);")
+        replay_post.append("replay.bindLocation(captured_program, in.value<GLint>(), result);")
+
+    return {
+        "params": params,
+        "args": ", ".join(call_args),
+        "record_pre": record_pre,
+        "record_post": record_post,
+        "replay_pre": replay_pre,
+        "replay_post": replay_post,
+    }
+
+
+def signature(entries):
+    """FNV-1a of every signature, a trace only replays with the same glad.h"""
+    value = 0x811c9dc5
+    for name, pfn, result, params in entries:
+        for byte in ("%s %s(%s);" % (result, name, params)).encode():
+            value = ((value ^ byte) * 0x01000193) & 0xffffffff
+    return value
+
+
+def generate(entries):
+    out = []
+    w = out.append
+    w("// Generated by tools/gen_gl_trace_table.py from GLAD/include/glad/glad.h,")
+    w("// do not edit. Included by gl_trace.h.")
+    w("#ifndef GL_TRACE_TABLE_H")
+    w("#define GL_TRACE_TABLE_H")
+    w("")
+    w("#include <glad/glad.h>")
+    w("")
+    w("#include <cstdint>")
+    w("#include <algorithm>")
+    w("")
+    w("namespace gltrace")
+    w("{")
+    w("    enum : uint32_t { GLAD_SIGNATURE = 0x%08xu };" % signature(entries))
+    w("")
+    w("    enum Entry : uint32_t")
+    w("    {")
+    for name, _, _, _ in entries:
+        w("        ENTRY_%s," % name)
+    w("        ENTRY_COUNT")
+    w("    };")
+    w("")
+    w("    // ------------------------------------------------------------------------")
+    w("    inline const char* entryName(uint32_t entry)")
+    w("    {")
+    w("        static const char* const names[ENTRY_COUNT] = {")
+    for name, _, _, _ in entries:
+        w("            \"%s\"," % name)
+    w("        };")
+    w("        return entry < ENTRY_COUNT ? names[entry] : \"\";")
+    w("    }")
+    w("")
+    w("    // the pointers glad had before install(), a template so the header can")
+    w("    // define them")
+    w("    template<typename Unused = void>")
+    w("    struct Table")
+    w("    {")
+    w("        static void* loaded[ENTRY_COUNT];")
+    w("    };")
+    w("    template<typename Unused> void* Table<Unused>::loaded[ENTRY_COUNT] = {};")
+    w("")
+
+    wrapped = []
+    supported = {}
+    for name, pfn, result, params in entries:
+        if skipped(name):
+            continue
+        wrapped.append((name, pfn))
+        info = describe(name, pfn, result, params)
+        call = "((%s)Table<>::loaded[ENTRY_%s])" % (pfn, name)
+        w("    inline %s APIENTRY record_%s(%s)" % (result, name, params))
+        w("    {")
+        if info is None:
+            w("        recorder().unsupported(ENTRY_%s);" % name)
+            args = ", ".join(p for _, p in split_params(params))
+            w("        %s%s(%s);" % ("" if result == "void" else "return ", call, args))
+            w("    }")
+            continue
+        supported[name] = (pfn, result, info)
+        w("        Recorder& trace = recorder();")
+        w("        trace.begin(ENTRY_%s);" % name)
+        for line in info["record_pre"]:
+            w("        " + line)
+        if result == "void":
+            w("        %s(%s);" % (call, info["args"]))
+        else:
+            w("        %s result = %s(%s);" % (result, call, info["args"]))
+        for line in info["record_post"]:
+            w("        " + line)
+        if result != "void":
+            w("        return result;")
+        w("    }")
+    w("")
+
+    w("    // points every loaded glad_gl* that changes state at its recording")
+    w("    // wrapper, or back")
+    w("    // ------------------------------------------------------------------------")
+    w("    inline void install()")
+    w("    {")
+    for name, pfn in wrapped:
+        w("        if (glad_%s && glad_%s != record_%s)" % (name, name, name))
+        w("        {")
+        w("            Table<>::loaded[ENTRY_%s] = (void*)glad_%s;" % (name, name))
+        w("            glad_%s = record_%s;" % (name, name))
+        w("        }")
+    w("    }")
+    w("    inline void uninstall()")
+    w("    {")
+    for name, pfn in wrapped:
+        w("        if (glad_%s == record_%s)" % (name, name))
+        w("            glad_%s = (%s)Table<>::loaded[ENTRY_%s];" % (name, pfn, name))
+    w("    }")
+    w("")
+
+    w("    // Decodes one record and makes the call through glad. False for entry")
+    w("    // points a trace cannot contain.")
+    w("    // ------------------------------------------------------------------------")
+    w("    inline bool replayCall(uint32_t entry, Reader& in, Replayer& replay)")
+    w("    {")
+    w("        switch (entry)")
+    w("        {")
+    for name, _, _, _ in entries:
+        if name not in supported:
+            continue
+        pfn, result, info = supported[name]
+        w("        case ENTRY_%s:" % name)
+        w("        {")
+        for line in info["replay_pre"]:
+            w("            " + line)
+        if result != "void":
+            w("            %s result = %s();" % (result, result) if "*" not in result else "            %s result = nullptr;" % result)
+        w("            if (glad_%s)" % name)
+        w("            {")
+        w("                replay.beginCall();")
+        if result == "void":
+            w("                glad_%s(%s);" % (name, info["args"]))
+        else:
+            w("                result = glad_%s(%s);" % (name, info["args"]))
+        w("                replay.endCall(ENTRY_%s);" % name)
+        w("            }")
+        w("            else")
+        w("                replay.missing();")
+        for line in info["replay_post"]:
+            w("            " + line)
+        if result != "void" and not info["replay_post"]:
+            w("            (void)result;")
+        w("            return true;")
+        w("        }")
+    w("        default:")
+    w("            return false;")
+    w("        }")
+    w("    }")
+    w("}")
+    w("")
+    w("#endif")
+    return "\r\n".join(out) + "\r\n", len(wrapped), len(supported)
+
+
+def main():
+    entries = parse(GLAD_H)
+    if not entries:
+        sys.exit("no glad_gl* pointers in " + GLAD_H)
+    text, wrapped, supported = generate(entries)
+    with open(OUTPUT, "w", newline="") as f:
+        f.write(text)
+    print("%d entry points, %d wrapped, %d recorded -> %s" % (len(entries), wrapped, supported,
+                                                          os.path.relpath(OUTPUT, ROOT)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,282 @@
+// Runs the app's scene and the stress scenes of benchmark_scenes.h on an
+// offscreen context and writes frame-time percentiles, CPU time per profile
+// zone, GPU time per scope and GL calls per frame as JSON. Linux only,
+// builds with tools/Makefile and runs without a GPU on Mesa llvmpipe:
+//
+//     gl_benchmark [--scene NAME[:COUNT]]... [--frames N] [--warmup N]
+//                  [--size WxH] [--assets DIR] [--out FILE] [--no-gl-counts]
+//     gl_benchmark --micro [NAME]... [--image FILE] [--assets DIR] [--out FILE]
+//
+// Scenes: demo, draws:N (N separate draws), instancing:N (one instanced
+// draw of N hierarchy nodes), overdraw:N (N full screen layers). Without
+// --scene all of them run with their default counts. Each scene gets a
+// fresh context; the shaders and images are loaded from --assets (src/).
+//
+// --micro runs the micro benchmarks of benchmarks.h instead and prints
+// their tables; a name after it picks one, without names all of them run.
+// The image benchmarks work on --image (awesomeface.png) from --assets,
+// image_decode on container.jpg and awesomeface.png as they are on disk; the
+// ones that upload get a small offscreen context.
+#include "headless_context.h"
+#include "headless_benchmark.h"
+#include "benchmark_scenes.h"
+#include "benchmarks.h"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+
+namespace
+{
+    struct SceneRequest
+    {
+        std::string name;
+        uint32_t count;
+    };
+
+    // ------------------------------------------------------------------------
+    uint32_t defaultCount(const std::string& scene)
+    {
+        if (scene == "draws")
+            return 1000;
+        if (scene == "instancing")
+            return 10000;
+        if (scene == "overdraw")
+            return 8;
+        return 0;
+    }
+
+    // ------------------------------------------------------------------------
+    bool runScene(const SceneRequest& request, int width, int height, const HeadlessBenchmarkOptions& options,
+        HeadlessBenchmarkResult& result)
+    {
+        HeadlessContext context;
+        if (!context.create(width, height))
+        {
+            fprintf(stderr, "%s\n", context.error().c_str());
+            return false;
+        }
+        std::string name = request.name + (request.count ? ":" + std::to_string(request.count) : "");
+        if (request.name == "demo")
+            result = runHeadlessBenchmark<DemoBenchmarkScene>(name.c_str(), options, width, height, (GLADloadproc)eglGetProcAddress);
+        else if (request.name == "draws")
+            result = runHeadlessBenchmark<ManyDrawsScene>(name.c_str(), options, request.count);
+        else if (request.name == "instancing")
+            result = runHeadlessBenchmark<InstancingScene>(name.c_str(), options, request.count);
+        else if (request.name == "overdraw")
+            result = runHeadlessBenchmark<OverdrawScene>(name.c_str(), options, request.count);
+        else
+        {
+            fprintf(stderr, "unknown scene %s\n", request.name.c_str());
+            return false;
+        }
+        GLenum error = glGetError();
+        if (error != GL_NO_ERROR)
+            fprintf(stderr, "warning: %s left GL error 0x%04x\n", name.c_str(), error);
+        return true;
+    }
+
+    // what the micro benchmarks work on
+    struct MicroInputs
+    {
+        std::vector<uint8_t> rgba; // --image as RGBA8
+        int width = 0;
+        int height = 0;
+        TextureStorageSupport storage;
+        std::vector<std::vector<uint8_t>> files; // the scene images, still encoded
+    };
+    struct MicroBenchmark
+    {
+        const char* name;
+        void (*run)(const MicroInputs& inputs, std::ostream& out);
+    };
+
+    const MicroBenchmark MICRO_BENCHMARKS[] = {
+        { "block_compression", [](const MicroInputs& in, std::ostream& out) {
+            benchmarkBlockCompression(in.rgba.data(), in.width, in.height, out); } },
+        { "texture_atlas", [](const MicroInputs&, std::ostream& out) { benchmarkTextureAtlas(out); } },
+        { "texture_residency", [](const MicroInputs&, std::ostream& out) { benchmarkTextureResidency(out); } },
+        { "texture_upload", [](const MicroInputs& in, std::ostream& out) {
+            benchmarkTextureUpload(1024, 1024, in.storage, out); } },
+        { "image_decode", [](const MicroInputs& in, std::ostream& out) { benchmarkImageDecode(in.files, out); } },
+        { "transcode", [](const MicroInputs& in, std::ostream& out) {
+            benchmarkTranscode(in.rgba.data(), in.width, in.height, out); } },
+        { "resample", [](const MicroInputs& in, std::ostream& out) {
+            benchmarkResample(in.rgba.data(), in.width, in.height, out); } },
+        { "math", [](const MicroInputs&, std::ostream& out) { benchmarkMath(out); } },
+        { "transform_hierarchy", [](const MicroInputs&, std::ostream& out) { benchmarkTransformHierarchy(out); } },
+        { "matrix_kernels", [](const MicroInputs&, std::ostream& out) { benchmarkMatrixKernels(out); } },
+        { "skinning", [](const MicroInputs&, std::ostream& out) { benchmarkSkinning(out); } },
+    };
+
+    // ------------------------------------------------------------------------
+    bool runMicroBenchmarks(const std::vector<std::string>& names, const char* image, std::ostream& out)
+    {
+        for (const std::string& name : names)
+        {
+            bool known = std::any_of(std::begin(MICRO_BENCHMARKS), std::end(MICRO_BENCHMARKS),
+                [&name](const MicroBenchmark& benchmark) { return name == benchmark.name; });
+            if (!known)
+            {
+                fprintf(stderr, "unknown micro benchmark %s\n", name.c_str());
+                return false;
+            }
+        }
+
+        HeadlessContext context;
+        if (!context.create(64, 64))
+        {
+            fprintf(stderr, "%s\n", context.error().c_str());
+            return false;
+        }
+        MicroInputs inputs;
+        inputs.storage = TextureStorageSupport::query((GLADloadproc)eglGetProcAddress);
+        int channels = 0;
+        stbi_uc* pixels = stbi_load(image, &inputs.width, &inputs.height, &channels, 4);
+        if (!pixels)
+        {
+            fprintf(stderr, "cannot load %s\n", image);
+            return false;
+        }
+        inputs.rgba.assign(pixels, pixels + (size_t)inputs.width * inputs.height * 4);
+        stbi_image_free(pixels);
+        for (const char* path : { "container.jpg", "awesomeface.png" })
+        {
+            std::ifstream file(path, std::ios::binary);
+            if (file)
+                inputs.files.emplace_back(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+
+        for (const MicroBenchmark& benchmark : MICRO_BENCHMARKS)
+        {
+            if (!names.empty() && std::find(names.begin(), names.end(), benchmark.name) == names.end())
+                continue;
+            fprintf(stderr, "%s\n", benchmark.name);
+            benchmark.run(inputs, out);
+            out << "\n";
+        }
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    void usage()
+    {
+        fprintf(stderr, "usage: gl_benchmark [--scene NAME[:COUNT]]... [--frames N] [--warmup N] [--size WxH]\n"
+                        "                    [--assets DIR] [--out FILE] [--no-gl-counts]\n"
+                        "       gl_benchmark --micro [NAME]... [--image FILE] [--assets DIR] [--out FILE]\n"
+                        "scenes: demo, draws, instancing, overdraw\n"
+                        "micro benchmarks:");
+        for (const MicroBenchmark& benchmark : MICRO_BENCHMARKS)
+            fprintf(stderr, " %s", benchmark.name);
+        fprintf(stderr, "\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    HeadlessBenchmarkOptions options;
+    std::vector<SceneRequest> scenes;
+    int width = 800;
+    int height = 600;
+    const char* assets = nullptr;
+    const char* outPath = nullptr;
+    bool micro = false;
+    std::vector<std::string> microNames;
+    const char* image = "awesomeface.png";
+    for (int i = 1; i < argc; i++)
+    {
+        bool hasValue = i + 1 < argc;
+        if (strcmp(argv[i], "--micro") == 0)
+        {
+            micro = true;
+            if (hasValue && argv[i + 1][0] != '-')
+                microNames.push_back(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--image") == 0 && hasValue)
+            image = argv[++i];
+        else if (strcmp(argv[i], "--scene") == 0 && hasValue)
+        {
+            std::string scene = argv[++i];
+            size_t colon = scene.find(':');
+            SceneRequest request;
+            request.name = scene.substr(0, colon);
+            request.count = colon == std::string::npos ? defaultCount(request.name) : (uint32_t)atoi(scene.c_str() + colon + 1);
+            scenes.push_back(request);
+        }
+        else if (strcmp(argv[i], "--frames") == 0 && hasValue)
+            options.frames = (uint32_t)std::max(atoi(argv[++i]), 1);
+        else if (strcmp(argv[i], "--warmup") == 0 && hasValue)
+            options.warmupFrames = (uint32_t)std::max(atoi(argv[++i]), 0);
+        else if (strcmp(argv[i], "--size") == 0 && hasValue)
+        {
+            if (sscanf(argv[++i], "%dx%d", &width, &height) != 2 || width <= 0 || height <= 0)
+            {
+                usage();
+                return 2;
+            }
+        }
+        else if (strcmp(argv[i], "--assets") == 0 && hasValue)
+            assets = argv[++i];
+        else if (strcmp(argv[i], "--out") == 0 && hasValue)
+            outPath = argv[++i];
+        else if (strcmp(argv[i], "--no-gl-counts") == 0)
+            options.countCalls = false;
+        else
+        {
+            usage();
+            return 2;
+        }
+    }
+    if (scenes.empty() && !micro)
+    {
+        for (const char* name : { "demo", "draws", "instancing", "overdraw" })
+            scenes.push_back(SceneRequest{ name, defaultCount(name) });
+    }
+    if (assets && chdir(assets) != 0)
+    {
+        fprintf(stderr, "cannot change to %s\n", assets);
+        return 1;
+    }
+
+    std::ofstream file;
+    if (outPath)
+    {
+        file.open(outPath);
+        if (!file)
+        {
+            fprintf(stderr, "cannot write %s\n", outPath);
+            return 1;
+        }
+    }
+    std::ostream& out = outPath ? file : std::cout;
+    if (micro)
+        return runMicroBenchmarks(microNames, image, out) && out ? 0 : 1;
+
+    std::vector<HeadlessBenchmarkResult> results;
+    for (const SceneRequest& scene : scenes)
+    {
+        HeadlessBenchmarkResult result;
+        if (!runScene(scene, width, height, options, result))
+            return 1;
+        fprintf(stderr, "%-18s setup %8.2f ms  frame p50 %7.3f  p95 %7.3f  p99 %7.3f ms  %6.0f GL calls\n",
+            result.scene.c_str(), result.setupMilliseconds, result.percentile(0.5), result.percentile(0.95),
+            result.percentile(0.99), result.callsPerFrame);
+        results.push_back(std::move(result));
+    }
+
+    out << "{\"benchmarks\":[\n";
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        results[i].writeJson(out);
+        out << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "]}\n";
+    return out ? 0 : 1;
+}
@@ -0,0 +1,257 @@
+// Performance regression suite: runs a fixed set of scenes several times on
+// an offscreen context, takes the median of each metric over the runs and
+// compares it with the committed baseline (tools/perf_baseline.txt) using
+// the noise-aware limits of perf_regression.h. Exits 1 when a metric
+// regressed, with a per-metric report on stdout. Linux only, builds with
+// tools/Makefile and runs without a GPU on Mesa llvmpipe:
+//
+//     gl_regress [--baseline FILE] [--runs N] [--scene NAME]... [--assets DIR]
+//                [--tolerance PERCENT] [--sigmas K] [--update]
+//
+// Scenes: startup (the app's scene until its textures are in), texture_load,
+// many_draws, instancing, shader_compile. --update measures and rewrites
+// the baseline instead of comparing; do that on the machine the suite runs
+// on, the numbers only compare on the same renderer and CPU.
+#include "headless_context.h"
+#include "headless_benchmark.h"
+#include "benchmark_scenes.h"
+#include "perf_regression.h"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+
+namespace
+{
+    const char* const SUITE[] = { "startup", "texture_load", "many_draws", "instancing", "shader_compile" };
+
+    // ------------------------------------------------------------------------
+    void addSample(std::vector<PerfMetric>& metrics, const std::string& name, PerfMetricKind kind, double value)
+    {
+        for (PerfMetric& metric : metrics)
+        {
+            if (metric.name == name)
+            {
+                metric.samples.push_back(value);
+                return;
+            }
+        }
+        PerfMetric metric;
+        metric.name = name;
+        metric.kind = kind;
+        metric.samples.push_back(value);
+        metrics.push_back(metric);
+    }
+
+    // milliseconds per measured frame in a zone of the calling thread
+    // ------------------------------------------------------------------------
+    double phaseMilliseconds(const HeadlessBenchmarkResult& result, const char* zone)
+    {
+        for (const BenchmarkPhase& phase : result.phases)
+        {
+            if (phase.thread == "main" && phase.name == zone)
+                return phase.milliseconds / std::max(result.frameMilliseconds.size(), (size_t)1);
+        }
+        return 0.0;
+    }
+
+    // one run of one scene, its metrics appended as "scene.metric"
+    // ------------------------------------------------------------------------
+    bool runScene(const std::string& scene, std::vector<PerfMetric>& metrics, std::string& renderer)
+    {
+        const int WIDTH = 800;
+        const int HEIGHT = 600;
+        HeadlessContext context;
+        if (!context.create(WIDTH, HEIGHT))
+        {
+            fprintf(stderr, "%s\n", context.error().c_str());
+            return false;
+        }
+        renderer = context.renderer();
+        GLADloadproc loadProc = (GLADloadproc)eglGetProcAddress;
+        const PerfMetricKind MS = PerfMetricKind::Milliseconds;
+        const PerfMetricKind COUNT = PerfMetricKind::Count;
+
+        // loading scenes are measured until ready(), the rest after a warmup
+        HeadlessBenchmarkOptions loading;
+        loading.warmupFrames = 0;
+        loading.frames = 30;
+        HeadlessBenchmarkOptions steady;
+        steady.warmupFrames = 10;
+        steady.frames = 100;
+
+        if (scene == "startup")
+        {
+            HeadlessBenchmarkResult result = runHeadlessBenchmark<DemoBenchmarkScene>("startup", loading, WIDTH, HEIGHT, loadProc);
+            addSample(metrics, "startup.setup_ms", MS, result.setupMilliseconds);
+            addSample(metrics, "startup.ready_ms", MS, result.setupMilliseconds + result.warmupMilliseconds);
+            addSample(metrics, "startup.frame_p50_ms", MS, result.percentile(0.5));
+            addSample(metrics, "startup.gl_calls", COUNT, result.callsPerFrame);
+        }
+        else if (scene == "texture_load")
+        {
+            loading.frames = 1;
+            HeadlessBenchmarkResult result = runHeadlessBenchmark<TextureLoadScene>("texture_load", loading, loadProc);
+            addSample(metrics, "texture_load.ready_ms", MS, result.setupMilliseconds + result.warmupMilliseconds);
+            addSample(metrics, "texture_load.frames", COUNT, result.warmupFrames);
+        }
+        else if (scene == "many_draws")
+        {
+            HeadlessBenchmarkResult result = runHeadlessBenchmark<ManyDrawsScene>("many_draws", steady, 1000u);
+            addSample(metrics, "many_draws.frame_p50_ms", MS, result.percentile(0.5));
+            addSample(metrics, "many_draws.draw_cpu_ms", MS, phaseMilliseconds(result, "draws"));
+            addSample(metrics, "many_draws.gl_calls", COUNT, result.callsPerFrame);
+        }
+        else if (scene == "instancing")
+        {
+            HeadlessBenchmarkResult result = runHeadlessBenchmark<InstancingScene>("instancing", steady, 10000u);
+            addSample(metrics, "instancing.frame_p50_ms", MS, result.percentile(0.5));
+            addSample(metrics, "instancing.update_cpu_ms", MS, phaseMilliseconds(result, "scene update"));
+            addSample(metrics, "instancing.gl_calls", COUNT, result.callsPerFrame);
+        }
+        else if (scene == "shader_compile")
+        {
+            steady.warmupFrames = 2;
+            steady.frames = 10;
+            HeadlessBenchmarkResult result = runHeadlessBenchmark<ShaderCompileScene>("shader_compile", steady);
+            addSample(metrics, "shader_compile.frame_p50_ms", MS, result.percentile(0.5));
+        }
+        else
+        {
+            fprintf(stderr, "unknown scene %s\n", scene.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    std::string absolutePath(const char* path)
+    {
+        char cwd[4096];
+        if (path[0] == '/' || !getcwd(cwd, sizeof(cwd)))
+            return path;
+        return std::string(cwd) + "/" + path;
+    }
+
+    // ------------------------------------------------------------------------
+    void usage()
+    {
+        fprintf(stderr, "usage: gl_regress [--baseline FILE] [--runs N] [--scene NAME]... [--assets DIR]\n"
+                        "                  [--tolerance PERCENT] [--sigmas K] [--update]\n"
+                        "scenes: startup, texture_load, many_draws, instancing, shader_compile\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::string baselinePath = "perf_baseline.txt";
+    std::vector<std::string> scenes;
+    const char* assets = nullptr;
+    int runs = 5;
+    bool update = false;
+    PerfThresholds thresholds;
+    for (int i = 1; i < argc; i++)
+    {
+        bool hasValue = i + 1 < argc;
+        if (strcmp(argv[i], "--baseline") == 0 && hasValue)
+            baselinePath = argv[++i];
+        else if (strcmp(argv[i], "--runs") == 0 && hasValue)
+            runs = std::max(atoi(argv[++i]), 1);
+        else if (strcmp(argv[i], "--scene") == 0 && hasValue)
+            scenes.push_back(argv[++i]);
+        else if (strcmp(argv[i], "--assets") == 0 && hasValue)
+            assets = argv[++i];
+        else if (strcmp(argv[i], "--tolerance") == 0 && hasValue)
+            thresholds.relative = atof(argv[++i]) / 100.0;
+        else if (strcmp(argv[i], "--sigmas") == 0 && hasValue)
+            thresholds.sigmas = atof(argv[++i]);
+        else if (strcmp(argv[i], "--update") == 0)
+            update = true;
+        else
+        {
+            usage();
+            return 2;
+        }
+    }
+    if (scenes.empty())
+        scenes.assign(std::begin(SUITE), std::end(SUITE));
+
+    // the baseline path is relative to where we were started, the assets not
+    baselinePath = absolutePath(baselinePath.c_str());
+    PerfBaseline baseline;
+    if (!update && !baseline.load(baselinePath.c_str()))
+    {
+        fprintf(stderr, "cannot read baseline %s, write one with --update\n", baselinePath.c_str());
+        return 2;
+    }
+    if (assets && chdir(assets) != 0)
+    {
+        fprintf(stderr, "cannot change to %s\n", assets);
+        return 2;
+    }
+    // a warm shader cache would make startup and shader_compile measure file reads
+    setenv("MESA_SHADER_CACHE_DISABLE", "true", 0);
+
+    // runs interleave the scenes, so a slow patch of the machine hits them all
+    std::vector<PerfMetric> metrics;
+    std::string renderer;
+    for (int run = 0; run < runs; run++)
+    {
+        for (const std::string& scene : scenes)
+        {
+            fprintf(stderr, "run %d/%d: %s\n", run + 1, runs, scene.c_str());
+            if (!runScene(scene, metrics, renderer))
+                return 2;
+        }
+    }
+
+    if (update)
+    {
+        // a partial update keeps the baseline's other scenes
+        PerfBaseline previous;
+        if (previous.load(baselinePath.c_str()))
+        {
+            for (const PerfBaselineEntry& entry : previous.entries)
+            {
+                bool remeasured = std::any_of(metrics.begin(), metrics.end(), [&entry](const PerfMetric& metric) {
+                    return metric.name == entry.name;
+                });
+                if (!remeasured)
+                    baseline.entries.push_back(entry);
+            }
+        }
+        for (const PerfMetric& metric : metrics)
+            baseline.entries.push_back(PerfBaselineEntry{ metric.name, metric.median(), metric.mad(), (uint32_t)metric.samples.size() });
+        baseline.renderer = renderer;
+        if (!baseline.save(baselinePath.c_str()))
+        {
+            fprintf(stderr, "cannot write %s\n", baselinePath.c_str());
+            return 2;
+        }
+        fprintf(stderr, "wrote %zu metrics to %s\n", baseline.entries.size(), baselinePath.c_str());
+        return 0;
+    }
+
+    if (baseline.renderer != renderer)
+        fprintf(stderr, "warning: baseline measured on \"%s\", this is \"%s\"\n", baseline.renderer.c_str(), renderer.c_str());
+    std::vector<PerfComparison> comparisons;
+    int regressions = 0;
+    for (const PerfComparison& comparison : comparePerfMetrics(metrics, baseline, thresholds))
+    {
+        // metrics of scenes not run this time are not missing
+        std::string scene = comparison.name.substr(0, comparison.name.find('.'));
+        if (comparison.verdict == PerfVerdict::Missing && std::find(scenes.begin(), scenes.end(), scene) == scenes.end())
+            continue;
+        regressions += comparison.verdict == PerfVerdict::Regressed;
+        comparisons.push_back(comparison);
+    }
+    writePerfReport(std::cout, comparisons);
+    printf("%d of %zu metrics regressed over %d runs\n", regressions, comparisons.size(), runs);
+    return regressions ? 1 : 0;
+}
@@ -0,0 +1,343 @@
+// Replays a GL trace written by GLTraceCapture (main --capture-gl) on an
+// offscreen context and times it, per frame and per entry point. Linux
+// only, builds with tools/Makefile and runs without a GPU on Mesa llvmpipe:
+//
+//     gl_replay gl_capture.gltrace [--repeat N] [--top N] [--csv PREFIX]
+//               [--png DIR] [--golden DIR] [--tolerance N]
+//
+// Frame 0 holds the app's setup and is reported apart. A frame ends with
+// glFinish, so its time includes the GPU work; a call's time is what the
+// driver spends inside it on the CPU.
+//
+// --png writes every frame of the first run to DIR/frame_NNNNN.png, --golden
+// compares them with the ones a known good build wrote there and exits 1 if
+// one differs by more than --tolerance per channel (2); the differing frames
+// are written next to their reference as .actual.png.
+#include "headless_context.h"
+#include "gl_trace.h"
+#include "framebuffer_readback.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+
+namespace
+{
+    struct Trace
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint64_t frames = 0;
+        std::vector<uint32_t> entries; // file id - 1 to entry
+        std::vector<std::pair<std::string, uint64_t>> unsupported;
+        std::vector<uint8_t> data;
+        size_t streamOffset = 0;
+        size_t streamSize = 0;
+    };
+
+    // ------------------------------------------------------------------------
+    bool readFile(const char* path, std::vector<uint8_t>& data)
+    {
+        FILE* file = fopen(path, "rb");
+        if (!file)
+            return false;
+        uint8_t block[1 << 16];
+        size_t read;
+        while ((read = fread(block, 1, sizeof(block), file)) > 0)
+            data.insert(data.end(), block, block + read);
+        fclose(file);
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    bool loadTrace(const char* path, Trace& trace)
+    {
+        if (!readFile(path, trace.data))
+        {
+            fprintf(stderr, "cannot read %s\n", path);
+            return false;
+        }
+        const size_t fixed = 5 + 3 * sizeof(uint32_t);
+        if (trace.data.size() < fixed || memcmp(trace.data.data(), "GLTR", 4) != 0)
+        {
+            fprintf(stderr, "%s is not a GL trace\n", path);
+            return false;
+        }
+        if (trace.data[4] != gltrace::FORMAT_VERSION)
+        {
+            fprintf(stderr, "trace version %u, this replay reads %u\n", trace.data[4], (unsigned)gltrace::FORMAT_VERSION);
+            return false;
+        }
+        uint32_t words[3];
+        memcpy(words, trace.data.data() + 5, sizeof(words));
+        if (words[0] != gltrace::GLAD_SIGNATURE)
+        {
+            fprintf(stderr, "trace recorded with another glad.h (signature %08x, expected %08x)\n",
+                words[0], (unsigned)gltrace::GLAD_SIGNATURE);
+            return false;
+        }
+        trace.width = words[1];
+        trace.height = words[2];
+
+        std::unordered_map<std::string, uint32_t> entryByName;
+        for (uint32_t entry = 0; entry < gltrace::ENTRY_COUNT; entry++)
+            entryByName[gltrace::entryName(entry)] = entry;
+
+        gltrace::Reader in(trace.data.data() + fixed, trace.data.size() - fixed);
+        auto readName = [&in]() {
+            std::string name((size_t)std::min<uint64_t>(in.varint(), in.remaining()), '\0');
+            for (char& c : name)
+                c = (char)in.value<uint8_t>();
+            return name;
+        };
+        trace.frames = in.varint();
+        uint64_t entryCount = in.varint();
+        for (uint64_t i = 0; i < entryCount && !in.failed(); i++)
+        {
+            std::string name = readName();
+            auto it = entryByName.find(name);
+            if (it != entryByName.end())
+                trace.entries.push_back(it->second);
+            else if (!in.failed())
+            {
+                fprintf(stderr, "unknown entry point %s\n", name.c_str());
+                return false;
+            }
+        }
+        uint64_t unsupportedCount = in.varint();
+        for (uint64_t i = 0; i < unsupportedCount && !in.failed(); i++)
+        {
+            std::string name = readName();
+            trace.unsupported.emplace_back(name, in.varint());
+        }
+        trace.streamSize = (size_t)in.varint();
+        trace.streamOffset = trace.data.size() - in.remaining();
+        if (in.failed() || trace.streamSize != in.remaining())
+        {
+            fprintf(stderr, "%s is truncated\n", path);
+            return false;
+        }
+        return true;
+    }
+
+    // replays every frame once, reading them back when readback is set;
+    // false on a broken record
+    // ------------------------------------------------------------------------
+    bool replayTrace(const Trace& trace, gltrace::Replayer& replay, std::vector<double>& frameMs,
+        FramebufferReadback* readback, const HeadlessContext& context)
+    {
+        gltrace::Reader in(trace.data.data() + trace.streamOffset, trace.streamSize);
+        uint64_t frameStart = profilerNanoseconds();
+        while (!in.atEnd())
+        {
+            uint64_t id = in.varint();
+            if (id == 0)
+            {
+                if (readback)
+                    readback->capture(frameMs.size(), context.framebuffer(), 0, 0, context.width(), context.height());
+                glFinish();
+                if (readback)
+                    readback->update();
+                uint64_t now = profilerNanoseconds();
+                frameMs.push_back((now - frameStart) / 1e6);
+                frameStart = now;
+                continue;
+            }
+            if (in.failed() || id > trace.entries.size() ||
+                !gltrace::replayCall(trace.entries[id - 1], in, replay) || in.failed())
+            {
+                fprintf(stderr, "broken record in frame %zu\n", frameMs.size());
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // ------------------------------------------------------------------------
+    double percentile(std::vector<double> values, double p)
+    {
+        if (values.empty())
+            return 0.0;
+        std::sort(values.begin(), values.end());
+        return values[std::min(values.size() - 1, (size_t)(p * (values.size() - 1) + 0.5))];
+    }
+
+    // ------------------------------------------------------------------------
+    void usage()
+    {
+        fprintf(stderr, "usage: gl_replay TRACE [--repeat N] [--top N] [--csv PREFIX]\n"
+                        "                 [--png DIR] [--golden DIR] [--tolerance N]\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const char* path = nullptr;
+    const char* csvPrefix = nullptr;
+    const char* pngDir = nullptr;
+    const char* goldenDir = nullptr;
+    ImageTolerance tolerance;
+    int repeat = 1;
+    int top = 20;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+            repeat = std::max(atoi(argv[++i]), 1);
+        else if (strcmp(argv[i], "--top") == 0 && i + 1 < argc)
+            top = std::max(atoi(argv[++i]), 0);
+        else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc)
+            csvPrefix = argv[++i];
+        else if (strcmp(argv[i], "--png") == 0 && i + 1 < argc)
+            pngDir = argv[++i];
+        else if (strcmp(argv[i], "--golden") == 0 && i + 1 < argc)
+            goldenDir = argv[++i];
+        else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc)
+            tolerance.channel = std::max(atoi(argv[++i]), 0);
+        else if (argv[i][0] != '-' && !path)
+            path = argv[i];
+        else
+        {
+            usage();
+            return 2;
+        }
+    }
+    if (!path)
+    {
+        usage();
+        return 2;
+    }
+
+    Trace trace;
+    if (!loadTrace(path, trace))
+        return 1;
+    for (const auto& unsupported : trace.unsupported)
+        fprintf(stderr, "warning: %llu calls to %s were not recorded\n", (unsigned long long)unsupported.second, unsupported.first.c_str());
+
+    // the first run's frames go to the PNG writer and the comparator
+    ThreadPool pngWorkers;
+    PngFrameWriter pngWriter(pngWorkers, std::string(pngDir ? pngDir : ".") + "/frame_%05llu.png");
+    ImageComparator comparator(std::string(goldenDir ? goldenDir : ".") + "/frame_%05llu.png", tolerance);
+
+    // every repeat gets a fresh context, the trace creates its own objects
+    std::vector<double> frameMs;
+    gltrace::Replayer total(gltrace::ENTRY_COUNT);
+    std::string renderer;
+    for (int run = 0; run < repeat; run++)
+    {
+        HeadlessContext context;
+        if (!context.create((int)std::max(trace.width, 1u), (int)std::max(trace.height, 1u)))
+        {
+            fprintf(stderr, "%s\n", context.error().c_str());
+            return 1;
+        }
+        renderer = context.renderer();
+        gltrace::Replayer replay(gltrace::ENTRY_COUNT, context.framebuffer());
+        std::vector<double> runMs;
+        FramebufferReadback readback;
+        if (pngDir)
+            readback.addSink(pngWriter.sink());
+        if (goldenDir)
+            readback.addSink(comparator.sink());
+        bool readFrames = run == 0 && (pngDir || goldenDir);
+        if (!replayTrace(trace, replay, runMs, readFrames ? &readback : nullptr, context))
+            return 1;
+        readback.flush();
+        readback.release();
+        // the setup frame of later runs would only skew the steady frames
+        frameMs.insert(frameMs.end(), runMs.begin() + (run == 0 || runMs.empty() ? 0 : 1), runMs.end());
+        for (uint32_t entry = 0; entry < gltrace::ENTRY_COUNT; entry++)
+        {
+            total.calls[entry] += replay.calls[entry];
+            total.nanoseconds[entry] += replay.nanoseconds[entry];
+        }
+        total.missingCalls += replay.missingCalls;
+    }
+
+    printf("%s: %llu frames at %ux%u, %zu bytes, %s\n", path, (unsigned long long)trace.frames,
+        trace.width, trace.height, trace.data.size(), renderer.c_str());
+    if (total.missingCalls)
+        printf("%llu calls skipped, missing in this context\n", (unsigned long long)total.missingCalls);
+    if (!frameMs.empty())
+    {
+        std::vector<double> steady(frameMs.begin() + 1, frameMs.end());
+        double sum = 0.0;
+        for (double ms : steady)
+            sum += ms;
+        printf("setup frame %.3f ms\n", frameMs[0]);
+        if (!steady.empty())
+        {
+            printf("%zu frames: mean %.3f ms, p50 %.3f, p95 %.3f, p99 %.3f, max %.3f\n", steady.size(),
+                sum / steady.size(), percentile(steady, 0.5), percentile(steady, 0.95), percentile(steady, 0.99),
+                *std::max_element(steady.begin(), steady.end()));
+        }
+    }
+
+    std::vector<uint32_t> used;
+    for (uint32_t entry = 0; entry < gltrace::ENTRY_COUNT; entry++)
+    {
+        if (total.calls[entry])
+            used.push_back(entry);
+    }
+    std::sort(used.begin(), used.end(), [&total](uint32_t a, uint32_t b) {
+        return total.nanoseconds[a] > total.nanoseconds[b];
+    });
+    printf("%-32s %10s %12s %10s\n", "entry point", "calls", "total ms", "avg us");
+    for (size_t i = 0; i < used.size() && (int)i < top; i++)
+    {
+        uint32_t entry = used[i];
+        printf("%-32s %10llu %12.3f %10.3f\n", gltrace::entryName(entry), (unsigned long long)total.calls[entry],
+            total.nanoseconds[entry] / 1e6, total.nanoseconds[entry] / 1e3 / total.calls[entry]);
+    }
+
+    pngWriter.wait();
+    if (pngDir)
+    {
+        printf("%llu frames written to %s", (unsigned long long)pngWriter.written(), pngDir);
+        if (pngWriter.failed() || pngWriter.dropped())
+            printf(", %llu failed, %llu dropped", (unsigned long long)pngWriter.failed(), (unsigned long long)pngWriter.dropped());
+        printf("\n");
+    }
+    if (goldenDir)
+    {
+        for (const ImageComparison& result : comparator.results())
+        {
+            if (!result.loaded)
+                printf("frame %llu: cannot read %s\n", (unsigned long long)result.frame, result.reference.c_str());
+            else if (!result.matched)
+                printf("frame %llu: %llu pixels differ, by up to %d\n", (unsigned long long)result.frame,
+                    (unsigned long long)result.differingPixels, result.maxDifference);
+        }
+        printf("%zu of %zu frames differ from %s\n", comparator.failures(), comparator.results().size(), goldenDir);
+    }
+
+    if (csvPrefix)
+    {
+        std::string framesPath = std::string(csvPrefix) + "_frames.csv";
+        std::string callsPath = std::string(csvPrefix) + "_calls.csv";
+        FILE* frames = fopen(framesPath.c_str(), "w");
+        FILE* calls = fopen(callsPath.c_str(), "w");
+        if (!frames || !calls)
+        {
+            fprintf(stderr, "cannot write %s\n", (frames ? callsPath : framesPath).c_str());
+            if (frames)
+                fclose(frames);
+            if (calls)
+                fclose(calls);
+            return 1;
+        }
+        fprintf(frames, "frame,ms\n");
+        for (size_t i = 0; i < frameMs.size(); i++)
+            fprintf(frames, "%zu,%.6f\n", i, frameMs[i]);
+        fprintf(calls, "entry,calls,ns\n");
+        for (uint32_t entry : used)
+            fprintf(calls, "%s,%llu,%llu\n", gltrace::entryName(entry), (unsigned long long)total.calls[entry],
+                (unsigned long long)total.nanoseconds[entry]);
+        fclose(frames);
+        fclose(calls);
+    }
+    return goldenDir && comparator.failures() ? 1 : 0;
+}